@@ -855,6 +855,50 @@ _mesa_alloc_opcode( GLcontext *ctx,
 
 
 
+/**
+ * Step through the instructions of a compiled display list.  This lets
+ * drivers post-process their own opcodes once a list has been ended.
+ *
+ * \param list   display list number
+ * \param prev   value returned by the previous call, or NULL to start
+ *               at the head of the list
+ * \param opcode returns the opcode of the instruction
+ * \return pointer to the instruction's data area, or NULL at the end
+ *         of the list.
+ */
+void *
+_mesa_next_list_instruction( GLcontext *ctx, GLuint list, void *prev,
+                             GLint *opcode )
+{
+   Node *n;
+
+   if (prev) {
+      GLint i;
+      n = (Node *) prev - 1;
+      i = (GLint) n[0].opcode - (GLint) OPCODE_DRV_0;
+      if (i >= 0 && i < (GLint) ctx->listext.nr_opcodes)
+         n += ctx->listext.opcode[i].size;
+      else
+         n += InstSize[n[0].opcode];
+   }
+   else {
+      n = (Node *) _mesa_HashLookup(ctx->Shared->DisplayList, list);
+      if (!n)
+         return NULL;
+   }
+
+   while (n[0].opcode == OPCODE_CONTINUE)
+      n = (Node *) n[1].next;
+
+   if (n[0].opcode == OPCODE_END_OF_LIST)
+      return NULL;
+
+   *opcode = (GLint) n[0].opcode;
+   return (void *) &n[1];
+}
+
+
+
 /* Mimic the old behaviour of alloc_instruction:
  *   - sz is in units of sizeof(Node)
  *   - return value a pointer to sizeof(Node) before the actual
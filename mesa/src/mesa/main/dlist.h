@@ -73,6 +73,9 @@ extern int _mesa_alloc_opcode( GLcontext *ctx, GLuint sz,
                                void (*destroy)( GLcontext *, void * ),
                                void (*print)( GLcontext *, void * ) );
 
+extern void *_mesa_next_list_instruction( GLcontext *ctx, GLuint list,
+                                          void *prev, GLint *opcode );
+
 extern void GLAPIENTRY _mesa_save_EvalMesh2(GLenum mode, GLint i1, GLint i2,
 				 GLint j1, GLint j2 );
 extern void GLAPIENTRY _mesa_save_EvalMesh1( GLenum mode, GLint i1, GLint i2 );
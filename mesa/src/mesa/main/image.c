@@ -911,6 +911,518 @@ _mesa_pack_bitmap( GLint width, GLint height, const GLubyte *source,
 }
 
 
+/**********************************************************************/
+/*****                  Fast RGBA span conversion                 *****/
+/**********************************************************************/
+
+/*
+ * _mesa_unpack_chan_color_span() and _mesa_pack_rgba_span() go through
+ * floating point for everything but a few GLchan copies.  The common
+ * 8-bit, packed 16-bit and float client formats are converted here
+ * instead, by a routine looked up from (format, type).  These are only
+ * used when there are no pixel transfer ops, and for multi-byte types
+ * only when SwapBytes is off.
+ *
+ * The results match the general path bit for bit.  The packed channel
+ * widths go through tables built from the same float expressions.  The
+ * SSE2 expansion of those channels uses integer arithmetic instead:
+ * n * 255 / max never lands near a rounding tie, so every flavour of
+ * CLAMPED_FLOAT_TO_UBYTE() gives the rounded quotient.  The SSE2 float
+ * conversion repeats whichever CLAMPED_FLOAT_TO_UBYTE() imports.h picked.
+ */
+
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2_SPANS
+#include <emmintrin.h>
+#endif
+
+typedef void (*unpack_chan_span_func)( GLuint n, const GLvoid *src,
+                                       GLchan *dst, GLuint dstComps,
+                                       const void *layout );
+typedef void (*pack_chan_span_func)( GLuint n, CONST GLchan src[][4],
+                                     GLvoid *dst, const void *layout );
+
+struct chan_span_funcs {
+   GLenum format;
+   GLenum type;
+   unpack_chan_span_func unpack;
+   pack_chan_span_func pack;
+   const void *layout;
+};
+
+/** Bit position and width of each channel in a packed 16-bit pixel */
+struct packed16_layout {
+   GLubyte shift[4];     /* indexed by RCOMP..ACOMP */
+   GLubyte bits[4];      /* 0 for no alpha */
+};
+
+/* Channel width -> value conversion, indexed by width in bits */
+static GLubyte expand_tab[7][64];     /* n-bit value -> GLchan */
+static GLubyte reduce_tab[7][256];    /* GLchan -> n-bit value */
+static GLboolean span_tabs_ready = GL_FALSE;
+
+
+static void
+init_span_tabs( void )
+{
+   static const GLfloat maxval[7] = { 0, 1.0F, 0, 0, 15.0F, 31.0F, 63.0F };
+   GLint bits, i;
+
+   if (span_tabs_ready)
+      return;
+
+   for (bits = 1; bits <= 6; bits++) {
+      if (maxval[bits] == 0.0F)
+         continue;
+      /* as extract_float_rgba() and the clamp in the unpackers */
+      for (i = 0; i < (1 << bits); i++) {
+         GLfloat f = i * (1.0F / maxval[bits]);
+         f = CLAMP(f, 0.0F, 1.0F);
+         CLAMPED_FLOAT_TO_CHAN(expand_tab[bits][i], f);
+      }
+      /* as _mesa_pack_float_rgba_span() */
+      for (i = 0; i < 256; i++) {
+         reduce_tab[bits][i] = (GLubyte) (GLint) (CHAN_TO_FLOAT(i) * maxval[bits]);
+      }
+   }
+   span_tabs_ready = GL_TRUE;
+}
+
+
+#ifdef USE_SSE2_SPANS
+/** Swap bytes 0 and 2 of each 32-bit pixel */
+static INLINE __m128i
+swap_rb_sse2( __m128i v )
+{
+   const __m128i ag = _mm_set1_epi32(0xff00ff00);
+   const __m128i rb = _mm_set1_epi32(0x000000ff);
+   return _mm_or_si128(_mm_and_si128(v, ag),
+                       _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 16), rb),
+                                    _mm_slli_epi32(_mm_and_si128(v, rb), 16)));
+}
+#endif
+
+#ifdef USE_SSE2_SPANS
+/**
+ * CLAMPED_FLOAT_TO_UBYTE() of four floats clamped to [0,1], one result
+ * per 32-bit lane.
+ */
+static INLINE __m128i
+float_to_ubyte_sse2( __m128 f )
+{
+   f = _mm_min_ps(_mm_max_ps(f, _mm_setzero_ps()), _mm_set1_ps(1.0F));
+#if defined(USE_IEEE) && !defined(DEBUG)
+   f = _mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(255.0F / 256.0F)),
+                  _mm_set1_ps(32768.0F));
+   return _mm_and_si128(_mm_castps_si128(f), _mm_set1_epi32(0xff));
+#elif defined(USE_X86_ASM) || defined(__WATCOMC__)
+   /* IROUND() is fistp, round to nearest even */
+   return _mm_cvtps_epi32(_mm_mul_ps(f, _mm_set1_ps(255.0F)));
+#else
+   /* IROUND() is the portable (int) (f + 0.5F) */
+   return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(255.0F)),
+                                      _mm_set1_ps(0.5F)));
+#endif
+}
+
+/*
+ * round(n * 255 / max) for each channel width, as (n * mul + add) >> shift
+ * in 16 bits.
+ */
+static const GLushort expand_mul[7]   = { 0, 255, 0, 0, 17, 527, 259 };
+static const GLushort expand_add[7]   = { 0,   0, 0, 0,  0,  23,  33 };
+static const GLushort expand_shift[7] = { 0,   0, 0, 0,  0,   6,   6 };
+
+static INLINE __m128i
+expand_channel_sse2( __m128i p, GLuint shift, GLuint bits )
+{
+   __m128i c = _mm_srl_epi16(p, _mm_cvtsi32_si128(shift));
+   c = _mm_and_si128(c, _mm_set1_epi16((short) ((1 << bits) - 1)));
+   c = _mm_add_epi16(_mm_mullo_epi16(c, _mm_set1_epi16(expand_mul[bits])),
+                     _mm_set1_epi16(expand_add[bits]));
+   return _mm_srl_epi16(c, _mm_cvtsi32_si128(expand_shift[bits]));
+}
+#endif
+
+
+static void
+unpack_chan_bgra_ubyte( GLuint n, const GLvoid *src, GLchan *dst,
+                        GLuint dstComps, const void *layout )
+{
+   const GLubyte *s = (const GLubyte *) src;
+   GLuint i = 0;
+   (void) layout;
+#ifdef USE_SSE2_SPANS
+   if (dstComps == 4) {
+      for (; i + 4 <= n; i += 4) {
+         __m128i v = _mm_loadu_si128((const __m128i *) (s + i * 4));
+         _mm_storeu_si128((__m128i *) (dst + i * 4), swap_rb_sse2(v));
+      }
+   }
+#endif
+   for (s += i * 4, dst += i * dstComps; i < n; i++, s += 4, dst += dstComps) {
+      dst[RCOMP] = s[2];
+      dst[GCOMP] = s[1];
+      dst[BCOMP] = s[0];
+      if (dstComps == 4)
+         dst[ACOMP] = s[3];
+   }
+}
+
+static void
+pack_chan_bgra_ubyte( GLuint n, CONST GLchan src[][4], GLvoid *dst,
+                      const void *layout )
+{
+   GLubyte *d = (GLubyte *) dst;
+   GLuint i = 0;
+   (void) layout;
+#ifdef USE_SSE2_SPANS
+   for (; i + 4 <= n; i += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i *) src[i]);
+      _mm_storeu_si128((__m128i *) (d + i * 4), swap_rb_sse2(v));
+   }
+#endif
+   for (d += i * 4; i < n; i++, d += 4) {
+      d[0] = src[i][BCOMP];
+      d[1] = src[i][GCOMP];
+      d[2] = src[i][RCOMP];
+      d[3] = src[i][ACOMP];
+   }
+}
+
+static void
+unpack_chan_bgr_ubyte( GLuint n, const GLvoid *src, GLchan *dst,
+                       GLuint dstComps, const void *layout )
+{
+   const GLubyte *s = (const GLubyte *) src;
+   GLuint i;
+   (void) layout;
+   for (i = 0; i < n; i++, s += 3, dst += dstComps) {
+      dst[RCOMP] = s[2];
+      dst[GCOMP] = s[1];
+      dst[BCOMP] = s[0];
+      if (dstComps == 4)
+         dst[ACOMP] = CHAN_MAX;
+   }
+}
+
+static void
+pack_chan_bgr_ubyte( GLuint n, CONST GLchan src[][4], GLvoid *dst,
+                     const void *layout )
+{
+   GLubyte *d = (GLubyte *) dst;
+   GLuint i;
+   (void) layout;
+   for (i = 0; i < n; i++, d += 3) {
+      d[0] = src[i][BCOMP];
+      d[1] = src[i][GCOMP];
+      d[2] = src[i][RCOMP];
+   }
+}
+
+static void
+unpack_chan_abgr_ubyte( GLuint n, const GLvoid *src, GLchan *dst,
+                        GLuint dstComps, const void *layout )
+{
+   const GLubyte *s = (const GLubyte *) src;
+   GLuint i;
+   (void) layout;
+   for (i = 0; i < n; i++, s += 4, dst += dstComps) {
+      dst[RCOMP] = s[3];
+      dst[GCOMP] = s[2];
+      dst[BCOMP] = s[1];
+      if (dstComps == 4)
+         dst[ACOMP] = s[0];
+   }
+}
+
+static void
+pack_chan_abgr_ubyte( GLuint n, CONST GLchan src[][4], GLvoid *dst,
+                      const void *layout )
+{
+   GLubyte *d = (GLubyte *) dst;
+   GLuint i;
+   (void) layout;
+   for (i = 0; i < n; i++, d += 4) {
+      d[0] = src[i][ACOMP];
+      d[1] = src[i][BCOMP];
+      d[2] = src[i][GCOMP];
+      d[3] = src[i][RCOMP];
+   }
+}
+
+
+/*
+ * GL_UNSIGNED_INT_8_8_8_8[_REV]: the layout is the shift of each channel
+ * in the 32-bit value, so one pair of routines covers every format.
+ */
+static const GLubyte shifts_rgba_8888[4]     = { 24, 16,  8,  0 };
+static const GLubyte shifts_rgba_8888_rev[4] = {  0,  8, 16, 24 };
+static const GLubyte shifts_bgra_8888[4]     = {  8, 16, 24,  0 };
+static const GLubyte shifts_bgra_8888_rev[4] = { 16,  8,  0, 24 };
+
+static void
+unpack_chan_8888( GLuint n, const GLvoid *src, GLchan *dst,
+                  GLuint dstComps, const void *layout )
+{
+   const GLubyte *shift = (const GLubyte *) layout;
+   const GLuint *s = (const GLuint *) src;
+   GLuint i;
+   for (i = 0; i < n; i++, dst += dstComps) {
+      const GLuint p = s[i];
+      dst[RCOMP] = (GLchan) (p >> shift[RCOMP]);
+      dst[GCOMP] = (GLchan) (p >> shift[GCOMP]);
+      dst[BCOMP] = (GLchan) (p >> shift[BCOMP]);
+      if (dstComps == 4)
+         dst[ACOMP] = (GLchan) (p >> shift[ACOMP]);
+   }
+}
+
+static void
+pack_chan_8888( GLuint n, CONST GLchan src[][4], GLvoid *dst,
+                const void *layout )
+{
+   const GLubyte *shift = (const GLubyte *) layout;
+   GLuint *d = (GLuint *) dst;
+   GLuint i;
+   for (i = 0; i < n; i++) {
+      d[i] = ((GLuint) src[i][RCOMP] << shift[RCOMP])
+           | ((GLuint) src[i][GCOMP] << shift[GCOMP])
+           | ((GLuint) src[i][BCOMP] << shift[BCOMP])
+           | ((GLuint) src[i][ACOMP] << shift[ACOMP]);
+   }
+}
+
+
+/*
+ * Packed 16-bit types.
+ */
+static const struct packed16_layout layout_rgb_565 =
+   { { 11,  5,  0,  0 }, { 5, 6, 5, 0 } };
+static const struct packed16_layout layout_rgb_565_rev =
+   { {  0,  5, 11,  0 }, { 5, 6, 5, 0 } };
+static const struct packed16_layout layout_rgba_4444 =
+   { { 12,  8,  4,  0 }, { 4, 4, 4, 4 } };
+static const struct packed16_layout layout_rgba_4444_rev =
+   { {  0,  4,  8, 12 }, { 4, 4, 4, 4 } };
+static const struct packed16_layout layout_bgra_4444 =
+   { {  4,  8, 12,  0 }, { 4, 4, 4, 4 } };
+static const struct packed16_layout layout_bgra_4444_rev =
+   { {  8,  4,  0, 12 }, { 4, 4, 4, 4 } };
+static const struct packed16_layout layout_rgba_5551 =
+   { { 11,  6,  1,  0 }, { 5, 5, 5, 1 } };
+static const struct packed16_layout layout_rgba_1555_rev =
+   { {  0,  5, 10, 15 }, { 5, 5, 5, 1 } };
+static const struct packed16_layout layout_bgra_5551 =
+   { {  1,  6, 11,  0 }, { 5, 5, 5, 1 } };
+static const struct packed16_layout layout_bgra_1555_rev =
+   { { 10,  5,  0, 15 }, { 5, 5, 5, 1 } };
+
+#define PACKED16_CHANNEL(P, L, C) \
+   (((P) >> (L)->shift[C]) & ((1 << (L)->bits[C]) - 1))
+
+static void
+unpack_chan_packed16( GLuint n, const GLvoid *src, GLchan *dst,
+                      GLuint dstComps, const void *layout )
+{
+   const struct packed16_layout *l = (const struct packed16_layout *) layout;
+   const GLubyte *rTab = expand_tab[l->bits[RCOMP]];
+   const GLubyte *gTab = expand_tab[l->bits[GCOMP]];
+   const GLubyte *bTab = expand_tab[l->bits[BCOMP]];
+   const GLubyte *aTab = expand_tab[l->bits[ACOMP]];
+   const GLushort *s = (const GLushort *) src;
+   GLuint i = 0;
+
+#ifdef USE_SSE2_SPANS
+   if (dstComps == 4) {
+      const __m128i opaque = _mm_set1_epi16(l->bits[ACOMP] ? 0 : (short) 0xff00);
+      for (; i + 8 <= n; i += 8) {
+         __m128i p = _mm_loadu_si128((const __m128i *) (s + i));
+         __m128i r = expand_channel_sse2(p, l->shift[RCOMP], l->bits[RCOMP]);
+         __m128i g = expand_channel_sse2(p, l->shift[GCOMP], l->bits[GCOMP]);
+         __m128i b = expand_channel_sse2(p, l->shift[BCOMP], l->bits[BCOMP]);
+         __m128i ba = opaque;
+         if (l->bits[ACOMP])
+            ba = _mm_slli_epi16(expand_channel_sse2(p, l->shift[ACOMP],
+                                                    l->bits[ACOMP]), 8);
+         r = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+         ba = _mm_or_si128(b, ba);
+         _mm_storeu_si128((__m128i *) (dst + i * 4), _mm_unpacklo_epi16(r, ba));
+         _mm_storeu_si128((__m128i *) (dst + i * 4 + 16), _mm_unpackhi_epi16(r, ba));
+      }
+   }
+#endif
+   for (dst += i * dstComps; i < n; i++, dst += dstComps) {
+      const GLuint p = s[i];
+      dst[RCOMP] = rTab[PACKED16_CHANNEL(p, l, RCOMP)];
+      dst[GCOMP] = gTab[PACKED16_CHANNEL(p, l, GCOMP)];
+      dst[BCOMP] = bTab[PACKED16_CHANNEL(p, l, BCOMP)];
+      if (dstComps == 4)
+         dst[ACOMP] = l->bits[ACOMP] ? aTab[PACKED16_CHANNEL(p, l, ACOMP)] : CHAN_MAX;
+   }
+}
+
+static void
+pack_chan_packed16( GLuint n, CONST GLchan src[][4], GLvoid *dst,
+                    const void *layout )
+{
+   const struct packed16_layout *l = (const struct packed16_layout *) layout;
+   const GLubyte *rTab = reduce_tab[l->bits[RCOMP]];
+   const GLubyte *gTab = reduce_tab[l->bits[GCOMP]];
+   const GLubyte *bTab = reduce_tab[l->bits[BCOMP]];
+   const GLubyte *aTab = reduce_tab[l->bits[ACOMP]];
+   GLushort *d = (GLushort *) dst;
+   GLuint i;
+   for (i = 0; i < n; i++) {
+      GLuint p = ((GLuint) rTab[src[i][RCOMP]] << l->shift[RCOMP])
+               | ((GLuint) gTab[src[i][GCOMP]] << l->shift[GCOMP])
+               | ((GLuint) bTab[src[i][BCOMP]] << l->shift[BCOMP]);
+      if (l->bits[ACOMP])
+         p |= (GLuint) aTab[src[i][ACOMP]] << l->shift[ACOMP];
+      d[i] = (GLushort) p;
+   }
+}
+
+#undef PACKED16_CHANNEL
+
+
+/*
+ * GL_FLOAT RGB and RGBA; the layout is the number of components.
+ */
+static const GLuint comps_rgb = 3;
+static const GLuint comps_rgba = 4;
+
+static void
+unpack_chan_float( GLuint n, const GLvoid *src, GLchan *dst,
+                   GLuint dstComps, const void *layout )
+{
+   const GLuint srcComps = *(const GLuint *) layout;
+   const GLfloat *s = (const GLfloat *) src;
+   GLuint i = 0;
+
+#ifdef USE_SSE2_SPANS
+   if (srcComps == 4 && dstComps == 4) {
+      for (; i + 4 <= n; i += 4) {
+         __m128i p0 = float_to_ubyte_sse2(_mm_loadu_ps(s + i * 4));
+         __m128i p1 = float_to_ubyte_sse2(_mm_loadu_ps(s + i * 4 + 4));
+         __m128i p2 = float_to_ubyte_sse2(_mm_loadu_ps(s + i * 4 + 8));
+         __m128i p3 = float_to_ubyte_sse2(_mm_loadu_ps(s + i * 4 + 12));
+         p0 = _mm_packs_epi32(p0, p1);
+         p2 = _mm_packs_epi32(p2, p3);
+         _mm_storeu_si128((__m128i *) (dst + i * 4), _mm_packus_epi16(p0, p2));
+      }
+   }
+#endif
+   for (s += i * srcComps, dst += i * dstComps; i < n;
+        i++, s += srcComps, dst += dstComps) {
+      GLfloat f;
+      f = CLAMP(s[RCOMP], 0.0F, 1.0F);
+      CLAMPED_FLOAT_TO_CHAN(dst[RCOMP], f);
+      f = CLAMP(s[GCOMP], 0.0F, 1.0F);
+      CLAMPED_FLOAT_TO_CHAN(dst[GCOMP], f);
+      f = CLAMP(s[BCOMP], 0.0F, 1.0F);
+      CLAMPED_FLOAT_TO_CHAN(dst[BCOMP], f);
+      if (dstComps == 4) {
+         if (srcComps == 4) {
+            f = CLAMP(s[ACOMP], 0.0F, 1.0F);
+            CLAMPED_FLOAT_TO_CHAN(dst[ACOMP], f);
+         }
+         else {
+            dst[ACOMP] = CHAN_MAX;
+         }
+      }
+   }
+}
+
+static void
+pack_chan_float( GLuint n, CONST GLchan src[][4], GLvoid *dst,
+                 const void *layout )
+{
+   const GLuint dstComps = *(const GLuint *) layout;
+   GLfloat *d = (GLfloat *) dst;
+   GLuint i;
+   for (i = 0; i < n; i++, d += dstComps) {
+      d[0] = CHAN_TO_FLOAT(src[i][RCOMP]);
+      d[1] = CHAN_TO_FLOAT(src[i][GCOMP]);
+      d[2] = CHAN_TO_FLOAT(src[i][BCOMP]);
+      if (dstComps == 4)
+         d[3] = CHAN_TO_FLOAT(src[i][ACOMP]);
+   }
+}
+
+
+static const struct chan_span_funcs chan_span_table[] = {
+   { GL_BGRA, GL_UNSIGNED_BYTE,
+     unpack_chan_bgra_ubyte, pack_chan_bgra_ubyte, NULL },
+   { GL_BGR, GL_UNSIGNED_BYTE,
+     unpack_chan_bgr_ubyte, pack_chan_bgr_ubyte, NULL },
+   { GL_ABGR_EXT, GL_UNSIGNED_BYTE,
+     unpack_chan_abgr_ubyte, pack_chan_abgr_ubyte, NULL },
+   { GL_RGBA, GL_UNSIGNED_INT_8_8_8_8,
+     unpack_chan_8888, pack_chan_8888, shifts_rgba_8888 },
+   { GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV,
+     unpack_chan_8888, pack_chan_8888, shifts_rgba_8888_rev },
+   { GL_BGRA, GL_UNSIGNED_INT_8_8_8_8,
+     unpack_chan_8888, pack_chan_8888, shifts_bgra_8888 },
+   { GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
+     unpack_chan_8888, pack_chan_8888, shifts_bgra_8888_rev },
+   { GL_RGB, GL_UNSIGNED_SHORT_5_6_5,
+     unpack_chan_packed16, pack_chan_packed16, &layout_rgb_565 },
+   { GL_RGB, GL_UNSIGNED_SHORT_5_6_5_REV,
+     unpack_chan_packed16, pack_chan_packed16, &layout_rgb_565_rev },
+   { GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4,
+     unpack_chan_packed16, pack_chan_packed16, &layout_rgba_4444 },
+   { GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4_REV,
+     unpack_chan_packed16, pack_chan_packed16, &layout_rgba_4444_rev },
+   { GL_BGRA, GL_UNSIGNED_SHORT_4_4_4_4,
+     unpack_chan_packed16, pack_chan_packed16, &layout_bgra_4444 },
+   { GL_BGRA, GL_UNSIGNED_SHORT_4_4_4_4_REV,
+     unpack_chan_packed16, pack_chan_packed16, &layout_bgra_4444_rev },
+   { GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1,
+     unpack_chan_packed16, pack_chan_packed16, &layout_rgba_5551 },
+   { GL_RGBA, GL_UNSIGNED_SHORT_1_5_5_5_REV,
+     unpack_chan_packed16, pack_chan_packed16, &layout_rgba_1555_rev },
+   { GL_BGRA, GL_UNSIGNED_SHORT_5_5_5_1,
+     unpack_chan_packed16, pack_chan_packed16, &layout_bgra_5551 },
+   { GL_BGRA, GL_UNSIGNED_SHORT_1_5_5_5_REV,
+     unpack_chan_packed16, pack_chan_packed16, &layout_bgra_1555_rev },
+   { GL_RGBA, GL_FLOAT,
+     unpack_chan_float, pack_chan_float, &comps_rgba },
+   { GL_RGB, GL_FLOAT,
+     unpack_chan_float, pack_chan_float, &comps_rgb },
+   { 0, 0, NULL, NULL, NULL }
+};
+
+
+/**
+ * Find the fast converter for a client (format, type), or NULL if the
+ * span has to take the general path.
+ */
+static const struct chan_span_funcs *
+find_chan_span_funcs( GLenum format, GLenum type,
+                      GLboolean swapBytes, GLuint transferOps )
+{
+   const struct chan_span_funcs *f;
+
+   if (transferOps)
+      return NULL;
+   if (swapBytes && type != GL_UNSIGNED_BYTE)
+      return NULL;
+
+   for (f = chan_span_table; f->unpack; f++) {
+      if (f->format == format && f->type == type) {
+         init_span_tabs();
+         return f;
+      }
+   }
+   return NULL;
+}
+
+#endif /* CHAN_TYPE == GL_UNSIGNED_BYTE */
+
+
 /*
  * Used to pack an array [][4] of RGBA GLchan colors as specified
  * by the dstFormat, dstType and dstPacking.  Used by glReadPixels,
@@ -1927,6 +2439,18 @@ _mesa_pack_rgba_span( GLcontext *ctx,
 {
    ASSERT((ctx->NewState & _NEW_PIXEL) == 0 || transferOps == 0);
 
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+   {
+      const struct chan_span_funcs *fast =
+         find_chan_span_funcs(dstFormat, dstType,
+                              dstPacking->SwapBytes, transferOps);
+      if (fast) {
+         fast->pack(n, srcRgba, dstAddr, fast->layout);
+         return;
+      }
+   }
+#endif
+
    /* Test for optimized case first */
    if (transferOps == 0 && dstFormat == GL_RGBA && dstType == CHAN_TYPE) {
       /* common simple case */
@@ -2867,6 +3391,20 @@ _mesa_unpack_chan_color_span( GLcontext *ctx,
       }
    }
 
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+   /* Table-driven converters for other common formats */
+   if (dstFormat == GL_RGBA || dstFormat == GL_RGB) {
+      const struct chan_span_funcs *fast =
+         find_chan_span_funcs(srcFormat, srcType,
+                              srcPacking->SwapBytes, transferOps);
+      if (fast) {
+         fast->unpack(n, source, dest, dstFormat == GL_RGBA ? 4 : 3,
+                      fast->layout);
+         return;
+      }
+   }
+#endif
+
 
    /* general solution begins here */
    {
@@ -3146,7 +3684,31 @@ _mesa_unpack_float_color_span( GLcontext *ctx,
           srcType == GL_UNSIGNED_INT_10_10_10_2 ||
           srcType == GL_UNSIGNED_INT_2_10_10_10_REV);
 
-   /* general solution, no special cases, yet */
+   /* Try simple cases first */
+   if (transferOps == 0 && dstFormat == GL_RGBA) {
+      if (srcType == GL_UNSIGNED_BYTE &&
+          (srcFormat == GL_RGBA || srcFormat == GL_BGRA)) {
+         const GLubyte *src = (const GLubyte *) source;
+         const GLuint rIndex = (srcFormat == GL_RGBA) ? 0 : 2;
+         GLuint i;
+         for (i = 0; i < n; i++) {
+            dest[RCOMP] = UBYTE_TO_FLOAT(src[rIndex]);
+            dest[GCOMP] = UBYTE_TO_FLOAT(src[1]);
+            dest[BCOMP] = UBYTE_TO_FLOAT(src[2 - rIndex]);
+            dest[ACOMP] = UBYTE_TO_FLOAT(src[3]);
+            src += 4;
+            dest += 4;
+         }
+         return;
+      }
+      else if (srcType == GL_FLOAT && srcFormat == GL_RGBA &&
+               !srcPacking->SwapBytes && !clamp) {
+         MEMCPY(dest, source, n * 4 * sizeof(GLfloat));
+         return;
+      }
+   }
+
+   /* general solution */
    {
       GLint dstComponents;
       GLint dstRedIndex, dstGreenIndex, dstBlueIndex, dstAlphaIndex;
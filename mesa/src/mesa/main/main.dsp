@@ -285,6 +285,10 @@ SOURCE=.\texcompress.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\texcompress_s3tc.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\texformat.c
 # End Source File
 # Begin Source File
@@ -293,6 +297,10 @@ SOURCE=.\teximage.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\texmipmap.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\texobj.c
 # End Source File
 # Begin Source File
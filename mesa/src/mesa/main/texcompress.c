@@ -267,6 +267,15 @@ _mesa_compress_teximage( GLcontext *ctx, GLsizei width, GLsizei height,
                          GLubyte *dest, GLint dstRowStride )
 {
    switch (dstFormat->MesaFormat) {
+   case MESA_FORMAT_RGB_DXT1:
+   case MESA_FORMAT_RGBA_DXT1:
+   case MESA_FORMAT_RGBA_DXT3:
+   case MESA_FORMAT_RGBA_DXT5:
+      ASSERT(srcFormat == GL_RGB || srcFormat == GL_RGBA);
+      _mesa_compress_dxtn(srcFormat == GL_RGBA ? 4 : 3, width, height,
+                          source, srcRowStride,
+                          dstFormat->MesaFormat, dest, dstRowStride);
+      return;
    default:
       _mesa_problem(ctx, "Bad dstFormat in _mesa_compress_teximage()");
       return;
@@ -53,12 +53,18 @@ _mesa_compress_teximage( GLcontext *ctx, GLsizei width, GLsizei height,
                          GLint srcRowStride,
                          const struct gl_texture_format *dstFormat,
                          GLubyte *dest, GLint dstRowStride );
+
+extern GLboolean
+_mesa_compress_dxtn( GLint srcComponents, GLsizei width, GLsizei height,
+                     const GLchan *source, GLint srcRowStride,
+                     GLint mesaFormat, GLubyte *dest, GLint dstRowStride );
 #else
 #define _mesa_get_compressed_formats( c, f ) 0
 #define _mesa_compressed_texture_size( c, w, h, d, f ) 0
 #define _mesa_compressed_row_stride( f, w) 0
 #define _mesa_compressed_image_address(c, r, i, f, w, i2 ) 0
 #define _mesa_compress_teximage( c, w, h, sF, s, sRS, dF, d, drs ) ((void)0)
+#define _mesa_compress_dxtn( sC, w, h, s, sRS, mF, d, drs ) GL_FALSE
 #endif
 
 #endif /* TEXCOMPRESS_H */
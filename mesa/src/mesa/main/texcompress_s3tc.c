@@ -0,0 +1,487 @@
+/**
+ * \file texcompress_s3tc.c
+ * S3TC (DXT1/DXT3/DXT5) block encoder.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  5.1
+ *
+ * Copyright (C) 1999-2003  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * The encoder is a single-pass range fit: the colour endpoints are the
+ * corners of the block's (slightly inset) bounding box, picked along the
+ * diagonal that matches the sign of the red/green and blue/green
+ * covariance.  Every texel then takes the nearest palette entry.  This is
+ * far cheaper than a least-squares cluster fit and good enough for
+ * compressing textures at load time.
+ *
+ * The index search is the inner loop; when the compiler targets SSE2 it
+ * runs four texels at a time.  Both paths break ties the same way, so the
+ * output does not depend on which one was compiled in.
+ */
+
+
+#include "glheader.h"
+#include "imports.h"
+#include "macros.h"
+#include "texcompress.h"
+#include "texformat.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2_S3TC
+#include <emmintrin.h>
+#endif
+
+
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+
+/** One 4x4 block of RGBA8 texels, row major */
+typedef GLubyte s3tc_block[16][4];
+
+
+/**
+ * Copy a 4x4 block out of the source image.  Blocks that overhang the
+ * right or bottom edge replicate the last column/row.
+ */
+static void
+fetch_block( s3tc_block blk, GLint srcComponents,
+             GLsizei width, GLsizei height,
+             const GLubyte *source, GLint srcRowStride,
+             GLint bx, GLint by )
+{
+   GLint i, j;
+
+   for (j = 0; j < 4; j++) {
+      const GLint y = MIN2(by + j, height - 1);
+      const GLubyte *row = source + y * srcRowStride * srcComponents;
+      for (i = 0; i < 4; i++) {
+         const GLint x = MIN2(bx + i, width - 1);
+         const GLubyte *src = row + x * srcComponents;
+         GLubyte *dst = blk[j * 4 + i];
+         dst[0] = src[0];
+         dst[1] = src[1];
+         dst[2] = src[2];
+         dst[3] = (srcComponents == 4) ? src[3] : 255;
+      }
+   }
+}
+
+
+static GLushort
+pack_565( const GLint c[3] )
+{
+   const GLuint r = (c[0] * 31 + 127) / 255;
+   const GLuint g = (c[1] * 63 + 127) / 255;
+   const GLuint b = (c[2] * 31 + 127) / 255;
+   return (GLushort) ((r << 11) | (g << 5) | b);
+}
+
+
+static void
+unpack_565( GLushort p, GLint c[4] )
+{
+   const GLint r = (p >> 11) & 0x1f;
+   const GLint g = (p >> 5) & 0x3f;
+   const GLint b = p & 0x1f;
+   c[0] = (r << 3) | (r >> 2);
+   c[1] = (g << 2) | (g >> 4);
+   c[2] = (b << 3) | (b >> 2);
+   c[3] = 0;
+}
+
+
+/**
+ * Choose the two colour endpoints for a block.
+ * Texels with alpha below 128 are skipped when \p skipAlpha is set (they
+ * are encoded as DXT1 transparent black and do not need a colour).
+ */
+static void
+choose_endpoints( s3tc_block blk, GLboolean skipAlpha,
+                  GLint c0[3], GLint c1[3] )
+{
+   GLint mn[3] = { 255, 255, 255 }, mx[3] = { 0, 0, 0 };
+   GLint sum[3] = { 0, 0, 0 };
+   GLint covRG = 0, covBG = 0;
+   GLint i, k, n = 0;
+
+   for (i = 0; i < 16; i++) {
+      if (skipAlpha && blk[i][3] < 128)
+         continue;
+      for (k = 0; k < 3; k++) {
+         mn[k] = MIN2(mn[k], blk[i][k]);
+         mx[k] = MAX2(mx[k], blk[i][k]);
+         sum[k] += blk[i][k];
+      }
+      n++;
+   }
+
+   if (n == 0) {
+      c0[0] = c0[1] = c0[2] = 0;
+      c1[0] = c1[1] = c1[2] = 0;
+      return;
+   }
+
+   /* signs of the covariance, relative to green */
+   for (i = 0; i < 16; i++) {
+      GLint dg;
+      if (skipAlpha && blk[i][3] < 128)
+         continue;
+      dg = blk[i][1] * n - sum[1];
+      covRG += ((blk[i][0] * n - sum[0]) >> 4) * (dg >> 4);
+      covBG += ((blk[i][2] * n - sum[2]) >> 4) * (dg >> 4);
+   }
+
+   /* inset the box by 1/16 of its range to reduce the quantisation error
+    * at the extremes
+    */
+   for (k = 0; k < 3; k++) {
+      const GLint inset = (mx[k] - mn[k]) >> 4;
+      c0[k] = mx[k] - inset;
+      c1[k] = mn[k] + inset;
+   }
+
+   if (covRG < 0) {
+      GLint t = c0[0]; c0[0] = c1[0]; c1[0] = t;
+   }
+   if (covBG < 0) {
+      GLint t = c0[2]; c0[2] = c1[2]; c1[2] = t;
+   }
+}
+
+
+/**
+ * Return the index of the nearest of the first \p n palette entries for
+ * each texel.  Ties go to the lower index.
+ */
+static void
+match_colors_c( s3tc_block blk, GLint pal[4][4], GLint n, GLubyte idx[16] )
+{
+   GLint i, k;
+
+   for (i = 0; i < 16; i++) {
+      GLint best = 0x7fffffff;
+      for (k = 0; k < n; k++) {
+         const GLint dr = blk[i][0] - pal[k][0];
+         const GLint dg = blk[i][1] - pal[k][1];
+         const GLint db = blk[i][2] - pal[k][2];
+         const GLint d = dr * dr + dg * dg + db * db;
+         if (d < best) {
+            best = d;
+            idx[i] = (GLubyte) k;
+         }
+      }
+   }
+}
+
+
+#ifdef USE_SSE2_S3TC
+
+/**
+ * SSE2 version of match_colors_c(), four texels per iteration.
+ */
+static void
+match_colors_sse2( s3tc_block blk, GLint pal[4][4], GLint n, GLubyte idx[16] )
+{
+   const __m128i rgbMask = _mm_set1_epi32(0x00ffffff);
+   const __m128i zero = _mm_setzero_si128();
+   __m128i p[4];
+   GLint i, k;
+
+   for (k = 0; k < n; k++) {
+      p[k] = _mm_setr_epi16((short) pal[k][0], (short) pal[k][1],
+                            (short) pal[k][2], 0,
+                            (short) pal[k][0], (short) pal[k][1],
+                            (short) pal[k][2], 0);
+   }
+
+   for (i = 0; i < 16; i += 4) {
+      __m128i texels = _mm_loadu_si128((const __m128i *) blk[i]);
+      __m128i lo, hi, best, bestIdx;
+      GLint out[4];
+
+      texels = _mm_and_si128(texels, rgbMask);
+      lo = _mm_unpacklo_epi8(texels, zero);
+      hi = _mm_unpackhi_epi8(texels, zero);
+
+      best = _mm_set1_epi32(0x7fffffff);
+      bestIdx = zero;
+
+      for (k = 0; k < n; k++) {
+         __m128i dlo = _mm_sub_epi16(lo, p[k]);
+         __m128i dhi = _mm_sub_epi16(hi, p[k]);
+         __m128 slo, shi;
+         __m128i d, less;
+
+         /* (r*r + g*g, b*b) for each texel, then add the pairs */
+         dlo = _mm_madd_epi16(dlo, dlo);
+         dhi = _mm_madd_epi16(dhi, dhi);
+         slo = _mm_castsi128_ps(dlo);
+         shi = _mm_castsi128_ps(dhi);
+         d = _mm_add_epi32(
+               _mm_castps_si128(_mm_shuffle_ps(slo, shi, _MM_SHUFFLE(2,0,2,0))),
+               _mm_castps_si128(_mm_shuffle_ps(slo, shi, _MM_SHUFFLE(3,1,3,1))));
+
+         less = _mm_cmplt_epi32(d, best);
+         best = _mm_or_si128(_mm_and_si128(less, d),
+                             _mm_andnot_si128(less, best));
+         bestIdx = _mm_or_si128(_mm_and_si128(less, _mm_set1_epi32(k)),
+                                _mm_andnot_si128(less, bestIdx));
+      }
+
+      _mm_storeu_si128((__m128i *) out, bestIdx);
+      idx[i + 0] = (GLubyte) out[0];
+      idx[i + 1] = (GLubyte) out[1];
+      idx[i + 2] = (GLubyte) out[2];
+      idx[i + 3] = (GLubyte) out[3];
+   }
+}
+
+#define match_colors match_colors_sse2
+
+#else
+
+#define match_colors match_colors_c
+
+#endif /* USE_SSE2_S3TC */
+
+
+/**
+ * Encode the 8-byte colour part of a block.
+ * \param dxt1Alpha  use the DXT1 three-colour mode for texels with
+ *                   alpha < 128 (GL_COMPRESSED_RGBA_S3TC_DXT1_EXT)
+ */
+static void
+encode_color_block( s3tc_block blk, GLboolean dxt1Alpha, GLubyte *dest )
+{
+   GLboolean transparent = GL_FALSE;
+   GLint c0[3], c1[3];
+   GLint pal[4][4];
+   GLubyte idx[16];
+   GLushort q0, q1;
+   GLuint bits = 0;
+   GLint i, k;
+
+   if (dxt1Alpha) {
+      for (i = 0; i < 16; i++) {
+         if (blk[i][3] < 128) {
+            transparent = GL_TRUE;
+            break;
+         }
+      }
+   }
+
+   choose_endpoints(blk, transparent, c0, c1);
+   q0 = pack_565(c0);
+   q1 = pack_565(c1);
+
+   if (transparent) {
+      /* three colour mode: q0 <= q1, index 3 is transparent black */
+      if (q0 > q1) {
+         GLushort t = q0; q0 = q1; q1 = t;
+      }
+      unpack_565(q0, pal[0]);
+      unpack_565(q1, pal[1]);
+      for (k = 0; k < 3; k++)
+         pal[2][k] = (pal[0][k] + pal[1][k]) / 2;
+      match_colors_c(blk, pal, 3, idx);
+      for (i = 0; i < 16; i++) {
+         if (blk[i][3] < 128)
+            idx[i] = 3;
+      }
+   }
+   else {
+      /* four colour mode: q0 > q1.  A single colour block has no second
+       * endpoint to tell the modes apart; index 0 is the same in both.
+       */
+      if (q0 < q1) {
+         GLushort t = q0; q0 = q1; q1 = t;
+      }
+      if (q0 == q1) {
+         for (i = 0; i < 16; i++)
+            idx[i] = 0;
+      }
+      else {
+         unpack_565(q0, pal[0]);
+         unpack_565(q1, pal[1]);
+         for (k = 0; k < 3; k++) {
+            pal[2][k] = (2 * pal[0][k] + pal[1][k]) / 3;
+            pal[3][k] = (pal[0][k] + 2 * pal[1][k]) / 3;
+         }
+         match_colors(blk, pal, 4, idx);
+      }
+   }
+
+   for (i = 15; i >= 0; i--)
+      bits = (bits << 2) | idx[i];
+
+   dest[0] = (GLubyte) (q0 & 0xff);
+   dest[1] = (GLubyte) (q0 >> 8);
+   dest[2] = (GLubyte) (q1 & 0xff);
+   dest[3] = (GLubyte) (q1 >> 8);
+   dest[4] = (GLubyte) (bits & 0xff);
+   dest[5] = (GLubyte) ((bits >> 8) & 0xff);
+   dest[6] = (GLubyte) ((bits >> 16) & 0xff);
+   dest[7] = (GLubyte) (bits >> 24);
+}
+
+
+/**
+ * DXT3: explicit 4-bit alpha, texel 0 in the low nibble of byte 0.
+ */
+static void
+encode_alpha_dxt3( s3tc_block blk, GLubyte *dest )
+{
+   GLint i;
+
+   for (i = 0; i < 16; i += 2) {
+      const GLuint a0 = (blk[i][3] * 15 + 127) / 255;
+      const GLuint a1 = (blk[i + 1][3] * 15 + 127) / 255;
+      dest[i / 2] = (GLubyte) (a0 | (a1 << 4));
+   }
+}
+
+
+/**
+ * DXT5: two alpha endpoints and 3-bit indices.  Always uses the eight
+ * value mode (alpha0 > alpha1) with the block's extremes as endpoints.
+ */
+static void
+encode_alpha_dxt5( s3tc_block blk, GLubyte *dest )
+{
+   GLint mn = 255, mx = 0, range;
+   GLubyte idx[16];
+   GLuint bits;
+   GLint i;
+
+   for (i = 0; i < 16; i++) {
+      mn = MIN2(mn, blk[i][3]);
+      mx = MAX2(mx, blk[i][3]);
+   }
+   range = mx - mn;
+
+   for (i = 0; i < 16; i++) {
+      if (range == 0) {
+         idx[i] = 0;
+      }
+      else {
+         /* t = 7 is alpha0 (index 0), t = 0 is alpha1 (index 1) and the
+          * interpolated values run from index 2 (6/7) down to 7 (1/7)
+          */
+         const GLint t = ((blk[i][3] - mn) * 7 + range / 2) / range;
+         idx[i] = (GLubyte) (t == 7 ? 0 : (t == 0 ? 1 : 8 - t));
+      }
+   }
+
+   dest[0] = (GLubyte) mx;
+   dest[1] = (GLubyte) mn;
+
+   /* 48 bits of indices, written as two 24-bit halves */
+   bits = 0;
+   for (i = 7; i >= 0; i--)
+      bits = (bits << 3) | idx[i];
+   dest[2] = (GLubyte) (bits & 0xff);
+   dest[3] = (GLubyte) ((bits >> 8) & 0xff);
+   dest[4] = (GLubyte) ((bits >> 16) & 0xff);
+
+   bits = 0;
+   for (i = 15; i >= 8; i--)
+      bits = (bits << 3) | idx[i];
+   dest[5] = (GLubyte) (bits & 0xff);
+   dest[6] = (GLubyte) ((bits >> 8) & 0xff);
+   dest[7] = (GLubyte) ((bits >> 16) & 0xff);
+}
+
+
+/**
+ * Compress an RGB or RGBA GLchan image to DXT1, DXT3 or DXT5.
+ *
+ * \param srcComponents 3 or 4
+ * \param srcRowStride source stride, in pixels
+ * \param mesaFormat one of the MESA_FORMAT_*_DXT* formats
+ * \param dstRowStride bytes between rows of 4x4 blocks
+ *
+ * \return GL_FALSE if \p mesaFormat isn't an S3TC format.
+ */
+GLboolean
+_mesa_compress_dxtn( GLint srcComponents, GLsizei width, GLsizei height,
+                     const GLchan *source, GLint srcRowStride,
+                     GLint mesaFormat, GLubyte *dest, GLint dstRowStride )
+{
+   s3tc_block blk;
+   GLint x, y;
+
+   ASSERT(srcComponents == 3 || srcComponents == 4);
+
+   switch (mesaFormat) {
+   case MESA_FORMAT_RGB_DXT1:
+   case MESA_FORMAT_RGBA_DXT1:
+   case MESA_FORMAT_RGBA_DXT3:
+   case MESA_FORMAT_RGBA_DXT5:
+      break;
+   default:
+      return GL_FALSE;
+   }
+
+   for (y = 0; y < height; y += 4) {
+      GLubyte *blkDest = dest;
+      for (x = 0; x < width; x += 4) {
+         fetch_block(blk, srcComponents, width, height,
+                     source, srcRowStride, x, y);
+         switch (mesaFormat) {
+         case MESA_FORMAT_RGB_DXT1:
+            encode_color_block(blk, GL_FALSE, blkDest);
+            blkDest += 8;
+            break;
+         case MESA_FORMAT_RGBA_DXT1:
+            encode_color_block(blk, GL_TRUE, blkDest);
+            blkDest += 8;
+            break;
+         case MESA_FORMAT_RGBA_DXT3:
+            encode_alpha_dxt3(blk, blkDest);
+            encode_color_block(blk, GL_FALSE, blkDest + 8);
+            blkDest += 16;
+            break;
+         case MESA_FORMAT_RGBA_DXT5:
+            encode_alpha_dxt5(blk, blkDest);
+            encode_color_block(blk, GL_FALSE, blkDest + 8);
+            blkDest += 16;
+            break;
+         }
+      }
+      dest += dstRowStride;
+   }
+
+   return GL_TRUE;
+}
+
+#else
+
+GLboolean
+_mesa_compress_dxtn( GLint srcComponents, GLsizei width, GLsizei height,
+                     const GLchan *source, GLint srcRowStride,
+                     GLint mesaFormat, GLubyte *dest, GLint dstRowStride )
+{
+   return GL_FALSE;
+}
+
+#endif /* CHAN_TYPE == GL_UNSIGNED_BYTE */
@@ -0,0 +1,446 @@
+/**
+ * \file texmipmap.c
+ * Box and Kaiser mipmap downsamplers for directly addressed texture images.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  5.1
+ *
+ * Copyright (C) 1999-2003  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Unlike make_2d_mipmap() in texstore.c, which works on Mesa's own image
+ * storage, these take explicit row strides so that a driver can filter
+ * straight between locked surface levels.
+ *
+ * Formats with a byte per channel are filtered in place; the 16-bit packed
+ * formats are expanded to four bytes per texel first.  When the compiler
+ * targets SSE2 the four-byte paths run one texel per register; the C and
+ * SSE2 box filters give identical results.
+ */
+
+
+#include "glheader.h"
+#include "imports.h"
+#include "macros.h"
+#include "texformat.h"
+#include "texstore.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2_MIPMAP
+#include <emmintrin.h>
+#endif
+
+
+/**
+ * Kaiser-windowed sinc for a 2:1 reduction (cutoff at half the source
+ * Nyquist, alpha 4, support +/-3 source texels).  Taps sit at distances
+ * 0.5, 1.5 and 2.5 from the centre of each 2x2 block; the weights are
+ * normalised so that all six sum to one.
+ */
+#define KAISER_TAPS 6
+static const GLfloat kaiser_weights[KAISER_TAPS] = {
+   -0.020992482F, 0.094502333F, 0.426490149F,
+    0.426490149F, 0.094502333F, -0.020992482F
+};
+
+
+/**********************************************************************/
+/*****                       Box filter                           *****/
+/**********************************************************************/
+
+static void
+box_row_c(GLint comps, GLint srcWidth,
+          const GLubyte *row0, const GLubyte *row1,
+          GLint dstWidth, GLubyte *dst, GLint first)
+{
+   GLint i, c;
+
+   for (i = first; i < dstWidth; i++) {
+      const GLint x0 = (2 * i) * comps;
+      const GLint x1 = MIN2(2 * i + 1, srcWidth - 1) * comps;
+      for (c = 0; c < comps; c++) {
+         dst[i * comps + c] = (GLubyte)
+            ((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+      }
+   }
+}
+
+
+#ifdef USE_SSE2_MIPMAP
+/**
+ * Four-byte texels, two output texels (four source columns) per step.
+ * \return number of output texels written
+ */
+static GLint
+box_row_sse2(GLint srcWidth,
+             const GLubyte *row0, const GLubyte *row1,
+             GLint dstWidth, GLubyte *dst)
+{
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i two = _mm_set1_epi16(2);
+   GLint i;
+
+   for (i = 0; i + 1 < dstWidth && 2 * i + 3 < srcWidth; i += 2) {
+      const __m128i a = _mm_loadu_si128((const __m128i *) (row0 + i * 8));
+      const __m128i b = _mm_loadu_si128((const __m128i *) (row1 + i * 8));
+      /* vertical sums, texels 0,1 and 2,3 */
+      __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero),
+                                 _mm_unpacklo_epi8(b, zero));
+      __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero),
+                                 _mm_unpackhi_epi8(b, zero));
+      /* horizontal pairs end up in the low quadword of each */
+      lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+      hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+      lo = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), two), 2);
+      _mm_storel_epi64((__m128i *) (dst + i * 4), _mm_packus_epi16(lo, zero));
+   }
+   return i;
+}
+#endif
+
+
+static void
+box_2d(GLint comps,
+       GLint srcWidth, GLint srcHeight,
+       const GLubyte *srcData, GLint srcRowStride,
+       GLint dstWidth, GLint dstHeight,
+       GLubyte *dstData, GLint dstRowStride)
+{
+   GLint j;
+
+   for (j = 0; j < dstHeight; j++) {
+      const GLubyte *row0 = srcData + (2 * j) * srcRowStride;
+      const GLubyte *row1 = srcData + MIN2(2 * j + 1, srcHeight - 1) * srcRowStride;
+      GLubyte *dst = dstData + j * dstRowStride;
+      GLint first = 0;
+#ifdef USE_SSE2_MIPMAP
+      if (comps == 4)
+         first = box_row_sse2(srcWidth, row0, row1, dstWidth, dst);
+#endif
+      box_row_c(comps, srcWidth, row0, row1, dstWidth, dst, first);
+   }
+}
+
+
+/**********************************************************************/
+/*****                      Kaiser filter                         *****/
+/**********************************************************************/
+
+/**
+ * Filter the six source rows around output row j into a row of floats.
+ */
+static void
+kaiser_column(GLint comps, GLint srcWidth, GLint srcHeight,
+              const GLubyte *srcData, GLint srcRowStride,
+              GLint j, GLfloat *temp)
+{
+   const GLint n = srcWidth * comps;
+   GLint k, x;
+
+   for (x = 0; x < n; x++)
+      temp[x] = 0.0F;
+
+   for (k = 0; k < KAISER_TAPS; k++) {
+      const GLint y = CLAMP(2 * j + k - 2, 0, srcHeight - 1);
+      const GLubyte *row = srcData + y * srcRowStride;
+      const GLfloat w = kaiser_weights[k];
+#ifdef USE_SSE2_MIPMAP
+      if (comps == 4) {
+         const __m128i zero = _mm_setzero_si128();
+         const __m128 wv = _mm_set1_ps(w);
+         for (x = 0; x < srcWidth; x++) {
+            __m128i t = _mm_cvtsi32_si128(*(const int *) (row + x * 4));
+            t = _mm_unpacklo_epi16(_mm_unpacklo_epi8(t, zero), zero);
+            _mm_storeu_ps(temp + x * 4,
+                          _mm_add_ps(_mm_loadu_ps(temp + x * 4),
+                                     _mm_mul_ps(_mm_cvtepi32_ps(t), wv)));
+         }
+         continue;
+      }
+#endif
+      for (x = 0; x < n; x++)
+         temp[x] += w * (GLfloat) row[x];
+   }
+}
+
+
+/**
+ * Filter a row of floats horizontally into one row of output texels.
+ */
+static void
+kaiser_row(GLint comps, GLint srcWidth, const GLfloat *temp,
+           GLint dstWidth, GLubyte *dst)
+{
+   GLint i, k, c;
+
+#ifdef USE_SSE2_MIPMAP
+   if (comps == 4) {
+      for (i = 0; i < dstWidth; i++) {
+         __m128 sum = _mm_setzero_ps();
+         __m128i t;
+         for (k = 0; k < KAISER_TAPS; k++) {
+            const GLint x = CLAMP(2 * i + k - 2, 0, srcWidth - 1);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(temp + x * 4),
+                                             _mm_set1_ps(kaiser_weights[k])));
+         }
+         /* round, then saturate to 0..255 */
+         t = _mm_cvtps_epi32(sum);
+         t = _mm_packs_epi32(t, t);
+         *(int *) (dst + i * 4) = _mm_cvtsi128_si32(_mm_packus_epi16(t, t));
+      }
+      return;
+   }
+#endif
+
+   for (i = 0; i < dstWidth; i++) {
+      for (c = 0; c < comps; c++) {
+         GLfloat sum = 0.0F;
+         GLint v;
+         for (k = 0; k < KAISER_TAPS; k++) {
+            const GLint x = CLAMP(2 * i + k - 2, 0, srcWidth - 1);
+            sum += kaiser_weights[k] * temp[x * comps + c];
+         }
+         v = IROUND(sum);
+         dst[i * comps + c] = (GLubyte) CLAMP(v, 0, 255);
+      }
+   }
+}
+
+
+static GLboolean
+kaiser_2d(GLint comps,
+          GLint srcWidth, GLint srcHeight,
+          const GLubyte *srcData, GLint srcRowStride,
+          GLint dstWidth, GLint dstHeight,
+          GLubyte *dstData, GLint dstRowStride)
+{
+   GLfloat *temp = (GLfloat *) MALLOC(srcWidth * comps * sizeof(GLfloat));
+   GLint j;
+
+   if (!temp)
+      return GL_FALSE;
+
+   for (j = 0; j < dstHeight; j++) {
+      kaiser_column(comps, srcWidth, srcHeight, srcData, srcRowStride, j, temp);
+      kaiser_row(comps, srcWidth, temp, dstWidth, dstData + j * dstRowStride);
+   }
+
+   FREE(temp);
+   return GL_TRUE;
+}
+
+
+/**********************************************************************/
+/*****                   16-bit packed formats                    *****/
+/**********************************************************************/
+
+/** Scale an n-bit channel to 8 bits by bit replication */
+#define EXPAND_4(v)  (GLubyte) (((v) << 4) | (v))
+#define EXPAND_5(v)  (GLubyte) (((v) << 3) | ((v) >> 2))
+#define EXPAND_6(v)  (GLubyte) (((v) << 2) | ((v) >> 4))
+
+/** Scale an 8-bit channel back to n bits, rounding */
+#define REDUCE(v, max)  ((((GLuint) (v)) * (max) + 127) / 255)
+
+
+static void
+unpack_16(GLint mesaFormat, GLint width, GLint height,
+          const GLubyte *src, GLint srcRowStride, GLubyte *dst)
+{
+   GLint i, j;
+
+   for (j = 0; j < height; j++) {
+      const GLushort *s = (const GLushort *) (src + j * srcRowStride);
+      for (i = 0; i < width; i++, dst += 4) {
+         const GLushort p = s[i];
+         switch (mesaFormat) {
+         case MESA_FORMAT_RGB565:
+            dst[0] = EXPAND_5((p >> 11) & 0x1f);
+            dst[1] = EXPAND_6((p >> 5) & 0x3f);
+            dst[2] = EXPAND_5(p & 0x1f);
+            dst[3] = 0xff;
+            break;
+         case MESA_FORMAT_ARGB4444:
+            dst[0] = EXPAND_4((p >> 8) & 0xf);
+            dst[1] = EXPAND_4((p >> 4) & 0xf);
+            dst[2] = EXPAND_4(p & 0xf);
+            dst[3] = EXPAND_4(p >> 12);
+            break;
+         default: /* MESA_FORMAT_ARGB1555 */
+            dst[0] = EXPAND_5((p >> 10) & 0x1f);
+            dst[1] = EXPAND_5((p >> 5) & 0x1f);
+            dst[2] = EXPAND_5(p & 0x1f);
+            dst[3] = (p & 0x8000) ? 0xff : 0;
+            break;
+         }
+      }
+   }
+}
+
+
+static void
+pack_16(GLint mesaFormat, GLint width, GLint height,
+        const GLubyte *src, GLubyte *dst, GLint dstRowStride)
+{
+   GLint i, j;
+
+   for (j = 0; j < height; j++) {
+      GLushort *d = (GLushort *) (dst + j * dstRowStride);
+      for (i = 0; i < width; i++, src += 4) {
+         switch (mesaFormat) {
+         case MESA_FORMAT_RGB565:
+            d[i] = (GLushort) ((REDUCE(src[0], 31) << 11) |
+                               (REDUCE(src[1], 63) << 5) |
+                                REDUCE(src[2], 31));
+            break;
+         case MESA_FORMAT_ARGB4444:
+            d[i] = (GLushort) ((REDUCE(src[3], 15) << 12) |
+                               (REDUCE(src[0], 15) << 8) |
+                               (REDUCE(src[1], 15) << 4) |
+                                REDUCE(src[2], 15));
+            break;
+         default: /* MESA_FORMAT_ARGB1555 */
+            d[i] = (GLushort) (((src[3] >= 128) ? 0x8000 : 0) |
+                               (REDUCE(src[0], 31) << 10) |
+                               (REDUCE(src[1], 31) << 5) |
+                                REDUCE(src[2], 31));
+            break;
+         }
+      }
+   }
+}
+
+
+/**********************************************************************/
+/*****                       Entry point                          *****/
+/**********************************************************************/
+
+static GLboolean
+downsample(GLint comps, GLint filter,
+           GLint srcWidth, GLint srcHeight,
+           const GLubyte *srcData, GLint srcRowStride,
+           GLint dstWidth, GLint dstHeight,
+           GLubyte *dstData, GLint dstRowStride)
+{
+   if (filter == MESA_MIPMAP_KAISER)
+      return kaiser_2d(comps, srcWidth, srcHeight, srcData, srcRowStride,
+                       dstWidth, dstHeight, dstData, dstRowStride);
+
+   box_2d(comps, srcWidth, srcHeight, srcData, srcRowStride,
+          dstWidth, dstHeight, dstData, dstRowStride);
+   return GL_TRUE;
+}
+
+
+/**
+ * Compute the next mipmap level of a 2D image.
+ *
+ * \param mesaFormat    MESA_FORMAT_* of both images
+ * \param filter        MESA_MIPMAP_BOX or MESA_MIPMAP_KAISER
+ * \param srcRowStride  bytes between source rows
+ * \param dstWidth      normally MAX2(srcWidth / 2, 1)
+ * \param dstHeight     normally MAX2(srcHeight / 2, 1)
+ * \param dstRowStride  bytes between destination rows
+ *
+ * \return GL_FALSE if the format is not handled (compressed, colour index,
+ * YCbCr or RGB332) or memory ran out; the destination is then untouched.
+ */
+GLboolean
+_mesa_downsample_texture_2d(GLint mesaFormat, GLint filter,
+                            GLint srcWidth, GLint srcHeight,
+                            const GLubyte *srcData, GLint srcRowStride,
+                            GLint dstWidth, GLint dstHeight,
+                            GLubyte *dstData, GLint dstRowStride)
+{
+   GLubyte *srcTemp, *dstTemp;
+   GLint comps;
+
+   switch (mesaFormat) {
+   case MESA_FORMAT_RGBA8888:
+   case MESA_FORMAT_ARGB8888:
+      comps = 4;
+      break;
+   case MESA_FORMAT_RGB888:
+      comps = 3;
+      break;
+   case MESA_FORMAT_AL88:
+      comps = 2;
+      break;
+   case MESA_FORMAT_A8:
+   case MESA_FORMAT_L8:
+   case MESA_FORMAT_I8:
+      comps = 1;
+      break;
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+   case MESA_FORMAT_RGBA:
+      comps = 4;
+      break;
+   case MESA_FORMAT_RGB:
+      comps = 3;
+      break;
+   case MESA_FORMAT_LUMINANCE_ALPHA:
+      comps = 2;
+      break;
+   case MESA_FORMAT_ALPHA:
+   case MESA_FORMAT_LUMINANCE:
+   case MESA_FORMAT_INTENSITY:
+      comps = 1;
+      break;
+#endif
+   case MESA_FORMAT_RGB565:
+   case MESA_FORMAT_ARGB4444:
+   case MESA_FORMAT_ARGB1555:
+      comps = 0;	/* expanded below */
+      break;
+   default:
+      return GL_FALSE;
+   }
+
+   if (comps)
+      return downsample(comps, filter, srcWidth, srcHeight,
+                        srcData, srcRowStride,
+                        dstWidth, dstHeight, dstData, dstRowStride);
+
+   srcTemp = (GLubyte *) MALLOC(srcWidth * srcHeight * 4);
+   dstTemp = (GLubyte *) MALLOC(dstWidth * dstHeight * 4);
+   if (!srcTemp || !dstTemp) {
+      if (srcTemp)
+         FREE(srcTemp);
+      if (dstTemp)
+         FREE(dstTemp);
+      return GL_FALSE;
+   }
+
+   unpack_16(mesaFormat, srcWidth, srcHeight, srcData, srcRowStride, srcTemp);
+   if (downsample(4, filter, srcWidth, srcHeight, srcTemp, srcWidth * 4,
+                  dstWidth, dstHeight, dstTemp, dstWidth * 4)) {
+      pack_16(mesaFormat, dstWidth, dstHeight, dstTemp, dstData, dstRowStride);
+      FREE(srcTemp);
+      FREE(dstTemp);
+      return GL_TRUE;
+   }
+
+   FREE(srcTemp);
+   FREE(dstTemp);
+   return GL_FALSE;
+}
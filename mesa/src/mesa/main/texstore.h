@@ -170,4 +170,16 @@ _mesa_generate_mipmap(GLcontext *ctx, GLenum target,
                       const struct gl_texture_unit *texUnit,
                       struct gl_texture_object *texObj);
 
+
+/** Filters for _mesa_downsample_texture_2d() */
+#define MESA_MIPMAP_BOX     0
+#define MESA_MIPMAP_KAISER  1
+
+extern GLboolean
+_mesa_downsample_texture_2d(GLint mesaFormat, GLint filter,
+                            GLint srcWidth, GLint srcHeight,
+                            const GLubyte *srcData, GLint srcRowStride,
+                            GLint dstWidth, GLint dstHeight,
+                            GLubyte *dstData, GLint dstRowStride);
+
 #endif
@@ -45,6 +45,12 @@
 #include "texformat.h"
 #include "texutil.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_IX86)
+#define USE_SSE2_TEXUTIL
+#include <emmintrin.h>
+#include "x86/common_x86_asm.h"
+#endif
+
 
 #define DEBUG_TEXUTIL 0
 
@@ -74,12 +80,54 @@ struct convert_info {
 
 typedef GLboolean (*convert_func)( const struct convert_info *convert );
 
+/* Converts a run of n texels.  Used for the RGBA/GLubyte sources that
+ * nearly every application hands us, where a whole row can be done with
+ * SSE2.  The SSE2 versions are selected at run time, see
+ * init_convert_rows().
+ */
+typedef void (*convert_row_func)( GLvoid *dst, const GLubyte *src, GLint n );
+
 /* bitvalues for convert->index */
 #define CONVERT_STRIDE_BIT	0x1
 #define CONVERT_UNPACKING_BIT	0x2
 
 
 
+#ifdef USE_SSE2_TEXUTIL
+
+/* Narrow eight 32-bit values that fit in 16 bits to eight GLushorts.
+ * The sign extension keeps _mm_packs_epi32 from saturating them.
+ */
+static INLINE __m128i
+pack_16_sse2( __m128i lo, __m128i hi )
+{
+   lo = _mm_srai_epi32( _mm_slli_epi32( lo, 16 ), 16 );
+   hi = _mm_srai_epi32( _mm_slli_epi32( hi, 16 ), 16 );
+   return _mm_packs_epi32( lo, hi );
+}
+
+/* Defines a row converter that does eight texels per iteration with the
+ * given per-register texel packer and finishes the row with the C loop.
+ */
+#define DEFINE_ROW_16_SSE2( name, pack )				\
+static void								\
+convert_row_##name##_sse2( GLvoid *dst, const GLubyte *src, GLint n )	\
+{									\
+   GLushort *d = (GLushort *) dst;					\
+   GLint i;								\
+									\
+   for ( i = 0 ; i + 8 <= n ; i += 8 ) {				\
+      const __m128i lo = _mm_loadu_si128( (const __m128i *) src );	\
+      const __m128i hi = _mm_loadu_si128( (const __m128i *) (src + 16) ); \
+      _mm_storeu_si128( (__m128i *) (d + i),				\
+			pack_16_sse2( pack( lo ), pack( hi ) ) );	\
+      src += 32;							\
+   }									\
+   convert_row_##name##_c( d + i, src, n - i );				\
+}
+
+#endif
+
 /* =============================================================
  * Convert to RGBA8888 textures:
  */
@@ -185,6 +233,45 @@ CONVERT_RGBA8888( texsubimage3d )
 
 #define SRC_TEXEL_BYTES		4
 
+static void
+convert_row_abgr8888_to_argb8888_c( GLvoid *dst, const GLubyte *src, GLint n )
+{
+   GLuint *d = (GLuint *) dst;
+   GLint i;
+
+   for ( i = 0 ; i < n ; i++ ) {
+      CONVERT_TEXEL( d[i], src );
+      src += 4;
+   }
+}
+
+#ifdef USE_SSE2_TEXUTIL
+static void
+convert_row_abgr8888_to_argb8888_sse2( GLvoid *dst, const GLubyte *src,
+				       GLint n )
+{
+   const __m128i ga = _mm_set1_epi32( (int) 0xff00ff00 );
+   const __m128i rb = _mm_set1_epi32( 0x000000ff );
+   GLuint *d = (GLuint *) dst;
+   GLint i;
+
+   for ( i = 0 ; i + 4 <= n ; i += 4 ) {
+      const __m128i v = _mm_loadu_si128( (const __m128i *) src );
+      const __m128i r = _mm_slli_epi32( _mm_and_si128( v, rb ), 16 );
+      const __m128i b = _mm_and_si128( _mm_srli_epi32( v, 16 ), rb );
+      _mm_storeu_si128( (__m128i *) (d + i),
+			_mm_or_si128( _mm_and_si128( v, ga ),
+				      _mm_or_si128( r, b ) ) );
+      src += 16;
+   }
+   convert_row_abgr8888_to_argb8888_c( d + i, src, n - i );
+}
+#endif
+
+static convert_row_func convert_row_abgr8888_to_argb8888 = convert_row_abgr8888_to_argb8888_c;
+
+#define CONVERT_ROW( dst, src, n )	convert_row_abgr8888_to_argb8888( dst, src, n )
+
 #define TAG(x) x##_abgr8888_to_argb8888
 #define PRESERVE_DST_TYPE
 #include "texutil_tmp.h"
@@ -301,6 +388,35 @@ convert_texsubimage3d_rgb888( const struct convert_info *convert )
 
 #define SRC_TEXEL_BYTES		4
 
+static void
+convert_row_abgr8888_to_rgb565_c( GLvoid *dst, const GLubyte *src, GLint n )
+{
+   GLushort *d = (GLushort *) dst;
+   GLint i;
+
+   for ( i = 0 ; i < n ; i++ ) {
+      CONVERT_TEXEL( d[i], src );
+      src += 4;
+   }
+}
+
+#ifdef USE_SSE2_TEXUTIL
+static INLINE __m128i
+pack_565_sse2( __m128i v )
+{
+   const __m128i r = _mm_slli_epi32( _mm_and_si128( v, _mm_set1_epi32( 0xf8 ) ), 8 );
+   const __m128i g = _mm_and_si128( _mm_srli_epi32( v, 5 ), _mm_set1_epi32( 0x7e0 ) );
+   const __m128i b = _mm_and_si128( _mm_srli_epi32( v, 19 ), _mm_set1_epi32( 0x1f ) );
+   return _mm_or_si128( r, _mm_or_si128( g, b ) );
+}
+
+DEFINE_ROW_16_SSE2( abgr8888_to_rgb565, pack_565_sse2 )
+#endif
+
+static convert_row_func convert_row_abgr8888_to_rgb565 = convert_row_abgr8888_to_rgb565_c;
+
+#define CONVERT_ROW( dst, src, n )	convert_row_abgr8888_to_rgb565( dst, src, n )
+
 #define TAG(x) x##_abgr8888_to_rgb565
 #include "texutil_tmp.h"
 
@@ -369,6 +485,36 @@ CONVERT_RGB565( texsubimage3d )
 
 #define SRC_TEXEL_BYTES		4
 
+static void
+convert_row_abgr8888_to_argb4444_c( GLvoid *dst, const GLubyte *src, GLint n )
+{
+   GLushort *d = (GLushort *) dst;
+   GLint i;
+
+   for ( i = 0 ; i < n ; i++ ) {
+      CONVERT_TEXEL( d[i], src );
+      src += 4;
+   }
+}
+
+#ifdef USE_SSE2_TEXUTIL
+static INLINE __m128i
+pack_4444_sse2( __m128i v )
+{
+   const __m128i a = _mm_and_si128( _mm_srli_epi32( v, 16 ), _mm_set1_epi32( 0xf000 ) );
+   const __m128i r = _mm_slli_epi32( _mm_and_si128( v, _mm_set1_epi32( 0xf0 ) ), 4 );
+   const __m128i g = _mm_and_si128( _mm_srli_epi32( v, 8 ), _mm_set1_epi32( 0xf0 ) );
+   const __m128i b = _mm_and_si128( _mm_srli_epi32( v, 20 ), _mm_set1_epi32( 0x0f ) );
+   return _mm_or_si128( _mm_or_si128( a, r ), _mm_or_si128( g, b ) );
+}
+
+DEFINE_ROW_16_SSE2( abgr8888_to_argb4444, pack_4444_sse2 )
+#endif
+
+static convert_row_func convert_row_abgr8888_to_argb4444 = convert_row_abgr8888_to_argb4444_c;
+
+#define CONVERT_ROW( dst, src, n )	convert_row_abgr8888_to_argb4444( dst, src, n )
+
 #define TAG(x) x##_abgr8888_to_argb4444
 #include "texutil_tmp.h"
 
@@ -463,6 +609,38 @@ CONVERT_ARGB4444( texsubimage3d )
 
 #define SRC_TEXEL_BYTES		4
 
+static void
+convert_row_abgr8888_to_argb1555_c( GLvoid *dst, const GLubyte *src, GLint n )
+{
+   GLushort *d = (GLushort *) dst;
+   GLint i;
+
+   for ( i = 0 ; i < n ; i++ ) {
+      CONVERT_TEXEL( d[i], src );
+      src += 4;
+   }
+}
+
+#ifdef USE_SSE2_TEXUTIL
+static INLINE __m128i
+pack_1555_sse2( __m128i v )
+{
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i a = _mm_andnot_si128( _mm_cmpeq_epi32( _mm_srli_epi32( v, 24 ), zero ),
+				       _mm_set1_epi32( 0x8000 ) );
+   const __m128i r = _mm_slli_epi32( _mm_and_si128( v, _mm_set1_epi32( 0xf8 ) ), 7 );
+   const __m128i g = _mm_and_si128( _mm_srli_epi32( v, 6 ), _mm_set1_epi32( 0x3e0 ) );
+   const __m128i b = _mm_and_si128( _mm_srli_epi32( v, 19 ), _mm_set1_epi32( 0x1f ) );
+   return _mm_or_si128( _mm_or_si128( a, r ), _mm_or_si128( g, b ) );
+}
+
+DEFINE_ROW_16_SSE2( abgr8888_to_argb1555, pack_1555_sse2 )
+#endif
+
+static convert_row_func convert_row_abgr8888_to_argb1555 = convert_row_abgr8888_to_argb1555_c;
+
+#define CONVERT_ROW( dst, src, n )	convert_row_abgr8888_to_argb1555( dst, src, n )
+
 #define TAG(x) x##_abgr8888_to_argb1555
 #include "texutil_tmp.h"
 
@@ -787,6 +965,31 @@ static convert_func convert_texsubimage3d_tab[] = {
 };
 
 
+/* Switch the row converters over to the SSE2 versions when the CPU
+ * supports them.  Done on first use rather than at context creation so
+ * that the CPU is only queried by apps that actually upload textures.
+ */
+static void
+init_convert_rows( void )
+{
+   static GLboolean initialized = GL_FALSE;
+
+   if ( initialized )
+      return;
+
+#ifdef USE_SSE2_TEXUTIL
+   if ( _mesa_x86_cpu_has_sse2() ) {
+      convert_row_abgr8888_to_argb8888 = convert_row_abgr8888_to_argb8888_sse2;
+      convert_row_abgr8888_to_rgb565 = convert_row_abgr8888_to_rgb565_sse2;
+      convert_row_abgr8888_to_argb4444 = convert_row_abgr8888_to_argb4444_sse2;
+      convert_row_abgr8888_to_argb1555 = convert_row_abgr8888_to_argb1555_sse2;
+   }
+#endif
+
+   initialized = GL_TRUE;
+}
+
+
 /* See if we need to care about the pixel store attributes when we're
  * converting the texture image.  This should be stored as
  * unpacking->_SomeBoolean and updated when the values change, to avoid
@@ -827,6 +1030,8 @@ _mesa_convert_texsubimage1d( GLint mesaFormat,
    ASSERT( srcImage );
    ASSERT( dstImage );
 
+   init_convert_rows();
+
    ASSERT( mesaFormat >= MESA_FORMAT_RGBA8888 );
    ASSERT( mesaFormat <= MESA_FORMAT_YCBCR_REV );
 
@@ -893,6 +1098,8 @@ _mesa_convert_texsubimage2d( GLint mesaFormat,  /* dest */
    ASSERT( srcImage );
    ASSERT( dstImage );
 
+   init_convert_rows();
+
    ASSERT( mesaFormat >= MESA_FORMAT_RGBA8888 );
    ASSERT( mesaFormat <= MESA_FORMAT_YCBCR_REV );
 
@@ -935,6 +1142,8 @@ _mesa_convert_texsubimage3d( GLint mesaFormat,  /* dest */
    ASSERT( srcImage );
    ASSERT( dstImage );
 
+   init_convert_rows();
+
    ASSERT( mesaFormat >= MESA_FORMAT_RGBA8888 );
    ASSERT( mesaFormat <= MESA_FORMAT_YCBCR_REV );
 
@@ -18,6 +18,8 @@
  *  - \c CONVER_TEXEL_DWORD - if multiple texels fit in 4 bytes, this macros
  *  will convert/store multiple texels at once
  *  - \c CONVERT_DIRECT - if defined, just memcpy texels from source to destination
+ *  - \c CONVERT_ROW - if defined, code to convert a run of texels at once,
+ *  used instead of the texel loops: CONVERT_ROW( dst, src, count )
  *  - \c SRC_TEXEL_BYTES - bytes per source texel
  *  - \c PRESERVE_DST_TYPE - if defined, don't undefined these macros at end
  *  
@@ -81,6 +83,8 @@ TAG(texsubimage2d)( const struct convert_info *convert )
 
 #ifdef CONVERT_DIRECT
    MEMCPY( dst, src, convert->height * DST_ROW_BYTES );
+#elif defined(CONVERT_ROW)
+   CONVERT_ROW( dst, src, convert->width * convert->height );
 #else
    {
       const GLint texels = convert->width * convert->height;
@@ -116,6 +120,8 @@ TAG(texsubimage3d)( const struct convert_info *convert )
 
 #ifdef CONVERT_DIRECT
    MEMCPY( dst, src, convert->depth * convert->height * DST_ROW_BYTES );
+#elif defined(CONVERT_ROW)
+   CONVERT_ROW( dst, src, convert->width * convert->height * convert->depth );
 #else
    {
       const GLint texels = convert->width * convert->height * convert->depth;
@@ -158,7 +164,10 @@ TAG(texsubimage2d_stride)( const struct convert_info *convert )
 				(convert->yoffset * convert->dstImageWidth +
 				 convert->xoffset) * DST_TEXEL_BYTES);
    GLint adjust;
-   GLint row, col;
+   GLint row;
+#ifndef CONVERT_ROW
+   GLint col;
+#endif
 
    adjust = convert->dstImageWidth - convert->width;
 
@@ -171,11 +180,17 @@ TAG(texsubimage2d_stride)( const struct convert_info *convert )
 #endif
 
    for ( row = 0 ; row < convert->height ; row++ ) {
+#ifdef CONVERT_ROW
+      CONVERT_ROW( dst, src, convert->width );
+      src += convert->width * SRC_TEXEL_BYTES;
+      dst += convert->width + adjust;
+#else
       for ( col = 0 ; col < convert->width ; col++ ) {
 	 CONVERT_TEXEL( *dst++, src );
 	 src += SRC_TEXEL_BYTES;
       }
       dst += adjust;
+#endif
    }
 
    return GL_TRUE;
@@ -191,7 +206,10 @@ TAG(texsubimage3d_stride)( const struct convert_info *convert )
 				  convert->yoffset) * convert->dstImageWidth +
 				 convert->xoffset) * DST_TEXEL_BYTES);
    GLint adjust;
-   GLint row, col, img;
+   GLint row, img;
+#ifndef CONVERT_ROW
+   GLint col;
+#endif
 
    adjust = convert->dstImageWidth - convert->width;
 
@@ -205,11 +223,17 @@ TAG(texsubimage3d_stride)( const struct convert_info *convert )
 
    for ( img = 0 ; img < convert->depth ; img++ ) {
       for ( row = 0 ; row < convert->height ; row++ ) {
+#ifdef CONVERT_ROW
+	 CONVERT_ROW( dst, src, convert->width );
+	 src += convert->width * SRC_TEXEL_BYTES;
+	 dst += convert->width + adjust;
+#else
 	 for ( col = 0 ; col < convert->width ; col++ ) {
 	    CONVERT_TEXEL( *dst++, src );
 	    src += SRC_TEXEL_BYTES;
 	 }
 	 dst += adjust;
+#endif
       }
       /* FIXME: ... */
    }
@@ -241,12 +265,27 @@ TAG(texsubimage2d_unpack)( const struct convert_info *convert )
    const GLint srcRowStride =
       _mesa_image_row_stride( convert->unpacking, convert->width,
 			      convert->format, convert->type );
-   GLint row, col;
+   GLint row;
+#ifndef CONVERT_ROW
+   GLint col;
+#endif
 
 #if DEBUG_TEXUTIL
    _mesa_debug( NULL, __FUNCTION__ "\n" );
 #endif
 
+#ifdef CONVERT_ROW
+   {
+      DST_TYPE *dst = (DST_TYPE *)((GLubyte *)convert->dstImage +
+                                   (convert->yoffset * convert->width +
+                                    convert->xoffset) * DST_TEXEL_BYTES);
+      for ( row = 0 ; row < convert->height ; row++ ) {
+         CONVERT_ROW( dst, src, convert->width );
+         src += srcRowStride;
+         dst += convert->width;
+      }
+   }
+#else
    if (convert->width & (DST_TEXELS_PER_DWORD - 1)) {
       /* Can't use dword conversion (i.e. when width = 1 and texels/dword = 2
        * or width = 2 and texels/dword = 4).
@@ -257,7 +296,7 @@ TAG(texsubimage2d_unpack)( const struct convert_info *convert )
       for ( row = 0 ; row < convert->height ; row++ ) {
          const GLubyte *srcRow = src;
          for ( col = 0; col < convert->width; col++ ) {
-            CONVERT_TEXEL(*dst, src);
+            CONVERT_TEXEL(*dst++, src);
             src += SRC_TEXEL_BYTES;
          }
          src = srcRow + srcRowStride;
@@ -283,6 +322,7 @@ TAG(texsubimage2d_unpack)( const struct convert_info *convert )
 #endif
       }
    }
+#endif
 
    return GL_TRUE;
 }
@@ -302,12 +342,32 @@ TAG(texsubimage3d_unpack)( const struct convert_info *convert )
    const GLint srcRowStride =
       _mesa_image_row_stride( convert->unpacking, convert->width,
 			      convert->format, convert->type );
-   GLint row, col, img;
+   GLint row, img;
+#ifndef CONVERT_ROW
+   GLint col;
+#endif
 
 #if DEBUG_TEXUTIL
    _mesa_debug( NULL, __FUNCTION__ "\n" );
 #endif
 
+#ifdef CONVERT_ROW
+   {
+      DST_TYPE *dst = (DST_TYPE *)((GLubyte *)convert->dstImage +
+                                   ((convert->zoffset * convert->height +
+                                     convert->yoffset) * convert->width +
+                                    convert->xoffset) * DST_TEXEL_BYTES);
+      for ( img = 0 ; img < convert->depth ; img++ ) {
+         const GLubyte *srcImage = src;
+         for ( row = 0 ; row < convert->height ; row++ ) {
+            CONVERT_ROW( dst, src, convert->width );
+            src += srcRowStride;
+            dst += convert->width;
+         }
+         src = srcImage + srcImgStride;
+      }
+   }
+#else
    if (convert->width & (DST_TEXELS_PER_DWORD - 1)) {
       /* Can't use dword conversion (i.e. when width = 1 and texels/dword = 2
        * or width = 2 and texels/dword = 4).
@@ -321,7 +381,7 @@ TAG(texsubimage3d_unpack)( const struct convert_info *convert )
          for ( row = 0 ; row < convert->height ; row++ ) {
             const GLubyte *srcRow = src;
             for ( col = 0; col < convert->width; col++ ) {
-               CONVERT_TEXEL(*dst, src);
+               CONVERT_TEXEL(*dst++, src);
                src += SRC_TEXEL_BYTES;
             }
             src = srcRow + srcRowStride;
@@ -354,6 +414,7 @@ TAG(texsubimage3d_unpack)( const struct convert_info *convert )
          src = srcImage + srcImgStride;
       }
    }
+#endif
 
    return GL_TRUE;
 }
@@ -386,7 +447,7 @@ TAG(texsubimage2d_stride_unpack)( const struct convert_info *convert )
 				(convert->yoffset * convert->dstImageWidth +
 				 convert->xoffset) * DST_TEXEL_BYTES);
    GLint row;
-#ifndef CONVERT_DIRECT
+#if !defined(CONVERT_DIRECT) && !defined(CONVERT_ROW)
    GLint adjust = convert->dstImageWidth - convert->width;
 #endif
 
@@ -402,6 +463,10 @@ TAG(texsubimage2d_stride_unpack)( const struct convert_info *convert )
       MEMCPY( dst, src, DST_ROW_BYTES );
       src += srcRowStride;
       dst += convert->dstImageWidth;
+#elif defined(CONVERT_ROW)
+      CONVERT_ROW( dst, src, convert->width );
+      src += srcRowStride;
+      dst += convert->dstImageWidth;
 #else
       const GLubyte *srcRow = src;
       GLint col;
@@ -437,7 +502,7 @@ TAG(texsubimage3d_stride_unpack)( const struct convert_info *convert )
 				  convert->yoffset) * convert->dstImageWidth +
 				 convert->xoffset) * DST_TEXEL_BYTES);
    GLint row, img;
-#ifndef CONVERT_DIRECT
+#if !defined(CONVERT_DIRECT) && !defined(CONVERT_ROW)
    GLint adjust = convert->dstImageWidth - convert->width;
 #endif
 
@@ -455,6 +520,10 @@ TAG(texsubimage3d_stride_unpack)( const struct convert_info *convert )
 	 MEMCPY( dst, src, DST_ROW_BYTES );
 	 src += srcRowStride;
 	 dst += convert->dstImageWidth;
+#elif defined(CONVERT_ROW)
+	 CONVERT_ROW( dst, src, convert->width );
+	 src += srcRowStride;
+	 dst += convert->dstImageWidth;
 #else
 	 const GLubyte *srcRow = src;
 	 GLint col;
@@ -520,6 +589,7 @@ static convert_func TAG(texsubimage3d_tab)[] = {
 #undef CONVERT_TEXEL
 #undef CONVERT_TEXEL_DWORD
 #undef CONVERT_DIRECT
+#undef CONVERT_ROW
 
 #undef TAG
 
@@ -45,6 +45,10 @@
 #include "common_x86_asm.h"
 #include "imports.h"
 
+#if defined(_MSC_VER) && defined(_M_IX86) && !defined(USE_X86_ASM)
+#include <intrin.h>	/* __cpuid */
+#endif
+
 
 int _mesa_x86_cpu_features = 0;
 
@@ -366,3 +370,35 @@ void _mesa_init_all_x86_transform_asm( void )
 #endif
 }
 
+
+/**
+ * SSE2 check for C code written with compiler intrinsics, such as the
+ * texutil.c row converters.  Those don't depend on USE_X86_ASM, so when
+ * the assembly feature detection above isn't built this asks cpuid
+ * directly.  MESA_NO_ASM switches them off as well.
+ */
+int _mesa_x86_cpu_has_sse2( void )
+{
+#if defined(USE_X86_ASM)
+   /* _math_init() has run by the time any texture is stored */
+   return cpu_has_xmm2 ? 1 : 0;
+#else
+   static int has_sse2 = -1;
+
+   if ( has_sse2 < 0 ) {
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+      has_sse2 = 1;
+#elif defined(_MSC_VER) && defined(_M_IX86)
+      int regs[4];
+      __cpuid( regs, 1 );
+      has_sse2 = (regs[3] & X86_CPU_XMM2) ? 1 : 0;
+#else
+      has_sse2 = 0;
+#endif
+      if ( getenv( "MESA_NO_ASM" ) ) {
+         has_sse2 = 0;
+      }
+   }
+   return has_sse2;
+#endif
+}
@@ -61,4 +61,6 @@ extern int _mesa_x86_cpu_features;
 
 extern void _mesa_init_all_x86_transform_asm( void );
 
+extern int _mesa_x86_cpu_has_sse2( void );
+
 #endif
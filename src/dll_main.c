@@ -38,6 +38,7 @@
 #include "dll_main.h"
 
 #include "gld_driver.h"
+#include "gld_trace.h"
 
 #include "mmsystem.h"
 
@@ -84,6 +85,13 @@ DWORD dwDebugLevel = 0;                 // Log debug level
 
 char szLogPath[_MAX_PATH] = {"\0"};		// Log file path
 
+// The NullDriver build is for measuring CPU cost, so it records by default
+#ifdef GLD5_NULL_DRIVER
+#define GLD_RECORD_DEVICE_DEFAULT	1
+#else
+#define GLD_RECORD_DEVICE_DEFAULT	0
+#endif
+
 // ***********************************************************************
 
 typedef struct {
@@ -102,6 +110,18 @@ typedef struct {
 	BOOL	bAppCustomizations;	// 0=off, 1=on
 	BOOL	bHotKeySupport;		// 0=off, 1=on
 	BOOL	bSplashScreen;		// 0=off, 1=on
+	BOOL	bIndexedPrimitives;	// 0=off, 1=on
+	BOOL	bShaderCache;		// 0=off, 1=on
+	BOOL	bCompressTextures;	// 0=off, 1=on
+	DWORD	dwTextureBudget;	// Megabytes, 0=no budget
+	BOOL	bRecordDevice;		// 0=off, 1=on
+	BOOL	bCaptureTrace;		// 0=off, 1=on
+	BOOL	bProfile;			// 0=off, 1=on
+	BOOL	bCommandStream;		// 0=off, 1=on
+	char	szShaderCachePath[MAX_PATH];
+	char	szRecordFile[MAX_PATH];
+	char	szTraceFile[MAX_PATH];
+	char	szProfileFile[MAX_PATH];
 
 	DWORD	dwAdapter;			// DX8 adapter ordinal
 	DWORD	dwTnL;				// Transform & Lighting type
@@ -179,6 +199,23 @@ BOOL ReadINIFile(
 	ini.bAppCustomizations = GetPrivateProfileInt(szSectionName, "bAppCustomizations", 1, szINIFile);
 	ini.bHotKeySupport = GetPrivateProfileInt(szSectionName, "bHotKeySupport", 0, szINIFile);
 	ini.bSplashScreen = GetPrivateProfileInt(szSectionName, "bSplashScreen", 1, szINIFile);
+	ini.bIndexedPrimitives = GetPrivateProfileInt(szSectionName, "bIndexedPrimitives", 1, szINIFile);
+	ini.bShaderCache = GetPrivateProfileInt(szSectionName, "bShaderCache", 1, szINIFile);
+	ini.bCompressTextures = GetPrivateProfileInt(szSectionName, "bCompressTextures", 0, szINIFile);
+	ini.dwTextureBudget = GetPrivateProfileInt(szSectionName, "dwTextureBudget", 0, szINIFile);
+	ini.bRecordDevice = GetPrivateProfileInt(szSectionName, "bRecordDevice", GLD_RECORD_DEVICE_DEFAULT, szINIFile);
+	ini.bCaptureTrace = GetPrivateProfileInt(szSectionName, "bCaptureTrace", 0, szINIFile);
+	ini.bProfile = GetPrivateProfileInt(szSectionName, "bProfile", 0, szINIFile);
+	ini.bCommandStream = GetPrivateProfileInt(szSectionName, "bCommandStream", 0, szINIFile);
+	// Shader cache, device recording, call traces and profiles live next to the INI file
+	strcpy(ini.szShaderCachePath, szLogPath);
+	strcat(ini.szShaderCachePath, "\\gldcache");
+	strcpy(ini.szRecordFile, szLogPath);
+	strcat(ini.szRecordFile, "\\gldrecord.csv");
+	strcpy(ini.szTraceFile, szLogPath);
+	strcat(ini.szTraceFile, "\\gldtrace.bin");
+	strcpy(ini.szProfileFile, szLogPath);
+	strcat(ini.szProfileFile, "\\gldprofile.json");
 
 	// New for GLDirect 3.x
 	ini.dwAdapter		= GetPrivateProfileInt(szSectionName, "dwAdapter", 0, szINIFile);
@@ -222,6 +259,18 @@ BOOL dllReadRegistry(
 		glb.bAppCustomizations = ini.bAppCustomizations;
         glb.bHotKeySupport = ini.bHotKeySupport;
 //		bSplashScreen = ini.bSplashScreen;
+		glb.bIndexedPrimitives = ini.bIndexedPrimitives;
+		glb.bCompressTextures = ini.bCompressTextures;
+		glb.dwTextureBudget = ini.dwTextureBudget;
+		glb.bCommandStream = ini.bCommandStream;
+		if (ini.bShaderCache)
+			strcpy(glb.szShaderCachePath, ini.szShaderCachePath);
+		if (ini.bRecordDevice)
+			strcpy(glb.szRecordFile, ini.szRecordFile);
+		if (ini.bCaptureTrace)
+			strcpy(glb.szTraceFile, ini.szTraceFile);
+		if (ini.bProfile)
+			strcpy(glb.szProfileFile, ini.szProfileFile);
 
 		// New for GLDirect 3.x
 		glb.dwAdapter		= ini.dwAdapter;
@@ -656,6 +705,7 @@ BOOL gldInitDriver(void)
 	gldLogPrintf(GLDLOG_SYSTEM, "Rendering type   : %s", szRendering[glb.dwRendering]);
 
 	gldLogPrintf(GLDLOG_SYSTEM, "Multithreaded    : %s", glb.bMultiThreaded ? "Enabled" : "Disabled");
+	gldLogPrintf(GLDLOG_SYSTEM, "Command stream   : %s", glb.bCommandStream ? "Enabled" : "Disabled");
 	gldLogPrintf(GLDLOG_SYSTEM, "Display resources: %s", glb.bDirectDrawPersistant ? "Persistant" : "Instanced");
 	gldLogPrintf(GLDLOG_SYSTEM, "Buffer resources : %s", glb.bPersistantBuffers ? "Persistant" : "Instanced");
 
@@ -687,6 +737,9 @@ void gldExitDriver(void)
 		return;
 	bExited = TRUE;
 
+	// Close the call trace before the contexts go
+	gldEndTrace();
+
     // DDraw objects may be invalid when DLL unloads.
 __try {
 
@@ -375,6 +375,8 @@ static void gld_Finish_DX9(
     GLcontext *ctx)
 {
 //    if (ctx) ctx->Driver.Flush(ctx);        // DaveM
+    // Make the calls still queued for the command stream's worker
+    gldSyncStream();
 }
 
 //---------------------------------------------------------------------------
@@ -419,15 +421,15 @@ void gld_NEW_STENCIL(
 
     struct gl_stencil_attrib *pStencil = &ctx->Stencil;
 
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_STENCILENABLE, pStencil->Enabled ? TRUE : FALSE));
+    gldSetRenderState(gld, D3DRS_STENCILENABLE, pStencil->Enabled ? TRUE : FALSE);
     if (pStencil->Enabled) {
-        _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_STENCILFUNC, _gldConvertCompareFunc(pStencil->Function[uiFace])));
-        _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_STENCILREF, pStencil->Ref[uiFace]));
-        _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_STENCILMASK, pStencil->ValueMask[uiFace]));
-        _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_STENCILWRITEMASK, pStencil->WriteMask[uiFace]));
-        _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_STENCILFAIL, _gldConvertStencilOp(pStencil->FailFunc[uiFace])));
-        _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_STENCILZFAIL, _gldConvertStencilOp(pStencil->ZFailFunc[uiFace])));
-        _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_STENCILPASS, _gldConvertStencilOp(pStencil->ZPassFunc[uiFace])));
+        gldSetRenderState(gld, D3DRS_STENCILFUNC, _gldConvertCompareFunc(pStencil->Function[uiFace]));
+        gldSetRenderState(gld, D3DRS_STENCILREF, pStencil->Ref[uiFace]);
+        gldSetRenderState(gld, D3DRS_STENCILMASK, pStencil->ValueMask[uiFace]);
+        gldSetRenderState(gld, D3DRS_STENCILWRITEMASK, pStencil->WriteMask[uiFace]);
+        gldSetRenderState(gld, D3DRS_STENCILFAIL, _gldConvertStencilOp(pStencil->FailFunc[uiFace]));
+        gldSetRenderState(gld, D3DRS_STENCILZFAIL, _gldConvertStencilOp(pStencil->ZFailFunc[uiFace]));
+        gldSetRenderState(gld, D3DRS_STENCILPASS, _gldConvertStencilOp(pStencil->ZPassFunc[uiFace]));
     }
 }
 
@@ -448,23 +450,23 @@ void gld_NEW_COLOR(
 	DWORD		dwAlphaRef = (DWORD)(ctx->Color.AlphaRef * 255.0f);
 
     // Alpha func
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ALPHAFUNC, _gldConvertCompareFunc(ctx->Color.AlphaFunc)));
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ALPHAREF, dwAlphaRef));
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ALPHATESTENABLE, ctx->Color.AlphaEnabled));
+    gldSetRenderState(gld, D3DRS_ALPHAFUNC, _gldConvertCompareFunc(ctx->Color.AlphaFunc));
+    gldSetRenderState(gld, D3DRS_ALPHAREF, dwAlphaRef);
+    gldSetRenderState(gld, D3DRS_ALPHATESTENABLE, ctx->Color.AlphaEnabled);
 
     // Blend func
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ALPHABLENDENABLE, ctx->Color.BlendEnabled));
+    gldSetRenderState(gld, D3DRS_ALPHABLENDENABLE, ctx->Color.BlendEnabled);
     src     = _gldConvertBlendFunc(ctx->Color.BlendSrcRGB, D3DBLEND_ONE);
     dest    = _gldConvertBlendFunc(ctx->Color.BlendDstRGB, D3DBLEND_ZERO);
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_SRCBLEND, src));
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_DESTBLEND, dest));
+    gldSetRenderState(gld, D3DRS_SRCBLEND, src);
+    gldSetRenderState(gld, D3DRS_DESTBLEND, dest);
 
     // Color mask
     if (ctx->Color.ColorMask[0]) dwFlags |= D3DCOLORWRITEENABLE_RED;
     if (ctx->Color.ColorMask[1]) dwFlags |= D3DCOLORWRITEENABLE_GREEN;
     if (ctx->Color.ColorMask[2]) dwFlags |= D3DCOLORWRITEENABLE_BLUE;
     if (ctx->Color.ColorMask[3]) dwFlags |= D3DCOLORWRITEENABLE_ALPHA;
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_COLORWRITEENABLE, dwFlags));
+    gldSetRenderState(gld, D3DRS_COLORWRITEENABLE, dwFlags);
 }
 
 //---------------------------------------------------------------------------
@@ -482,17 +484,17 @@ void gld_NEW_DEPTH(
 #endif
 #endif
 
-	_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ZENABLE, ctx->Depth.Test ? D3DZB_TRUE : D3DZB_FALSE));
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ZWRITEENABLE, ctx->Depth.Mask ? TRUE : FALSE));
+	gldSetRenderState(gld, D3DRS_ZENABLE, ctx->Depth.Test ? D3DZB_TRUE : D3DZB_FALSE);
+    gldSetRenderState(gld, D3DRS_ZWRITEENABLE, ctx->Depth.Mask ? TRUE : FALSE);
 
 	if (glb.bDisableZTrick) {
 //		if ((_gldConvertCompareFunc(ctx->Depth.Func) == 7) && ctx->Depth.Mask) {
 //			_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ZFUNC, D3DCMP_GREATEREQUAL));
 //		} else {
-			_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ZFUNC, D3DCMP_LESSEQUAL));
+			gldSetRenderState(gld, D3DRS_ZFUNC, D3DCMP_LESSEQUAL);
 //		}
 	} else {
-		_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_ZFUNC, _gldConvertCompareFunc(ctx->Depth.Func)));
+		gldSetRenderState(gld, D3DRS_ZFUNC, _gldConvertCompareFunc(ctx->Depth.Func));
 	}
 }
 
@@ -521,7 +523,7 @@ void gld_NEW_POLYGON(
         d3dFillMode = D3DFILL_SOLID;
         break;
     }
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_FILLMODE, d3dFillMode));
+    gldSetRenderState(gld, D3DRS_FILLMODE, d3dFillMode);
 
     if (ctx->Polygon.CullFlag) {
         switch (ctx->Polygon.CullFaceMode) {
@@ -549,7 +551,7 @@ void gld_NEW_POLYGON(
 #if 0
 	d3dCullMode = D3DCULL_NONE; // FOR DEBUGGING
 #endif
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_CULLMODE, d3dCullMode));
+    gldSetRenderState(gld, D3DRS_CULLMODE, d3dCullMode);
 
     // Polygon offset
     if (ctx->Polygon.OffsetFill) {
@@ -557,8 +559,8 @@ void gld_NEW_POLYGON(
 		fSlopeBias	= ctx->Polygon.OffsetFactor;
     }
     // NOTE: SetRenderState() only accepts DWORDs, hence the evil float->DWORD cast below.
-	_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_DEPTHBIAS, *((DWORD*)&fOffset)));
-	_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_SLOPESCALEDEPTHBIAS, *((DWORD*)&fSlopeBias)));
+	gldSetRenderState(gld, D3DRS_DEPTHBIAS, *((DWORD*)&fOffset));
+	gldSetRenderState(gld, D3DRS_SLOPESCALEDEPTHBIAS, *((DWORD*)&fSlopeBias));
 }
 
 //---------------------------------------------------------------------------
@@ -574,12 +576,14 @@ void gld_NEW_FOG(
 	// Only need to enable/disable fog and set fog colour (if enabled).
 	// Actual Fog values for each vertex is calculated in the vertex shader.
 
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_FOGENABLE, bFog));
+    gldSetRenderState(gld, D3DRS_FOGENABLE, bFog);
 
 	if (bFog) {
 		d3dFogColour = gldClampedColour(ctx->Fog.Color);
-		_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_FOGCOLOR, d3dFogColour));
+		gldSetRenderState(gld, D3DRS_FOGCOLOR, d3dFogColour);
 	}
+
+	gldDirtyShaderParams(ctx, _NEW_FOG);
 }
 
 //---------------------------------------------------------------------------
@@ -591,7 +595,9 @@ void gld_NEW_LIGHT(
     GLD_driver_dx9  *gld    = GLD_GET_DX9_DRIVER(gldCtx);
 
     // Shademode
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_SHADEMODE, (ctx->Light.ShadeModel == GL_SMOOTH) ? D3DSHADE_GOURAUD : D3DSHADE_FLAT));
+    gldSetRenderState(gld, D3DRS_SHADEMODE, (ctx->Light.ShadeModel == GL_SMOOTH) ? D3DSHADE_GOURAUD : D3DSHADE_FLAT);
+
+	gldDirtyShaderParams(ctx, _NEW_LIGHT);
 }
 
 //---------------------------------------------------------------------------
@@ -653,6 +659,8 @@ void gld_NEW_MODELVIEW(
 	_GLMatrixToD3DXMatrix(ctx->ModelviewMatrixStack.Top, &gld->matModelView, FALSE);
 	_GLMatrixToD3DXMatrix(ctx->ModelviewMatrixStack.Top, &gld->matInvModelView, TRUE);
 	_gldComputeWorldViewProject(gld);
+
+	gldDirtyShaderParams(ctx, _NEW_MODELVIEW);
 }
 
 //---------------------------------------------------------------------------
@@ -671,6 +679,8 @@ void gld_NEW_PROJECTION(
 	if (ctx->Fog.Enabled) {
 		_GLD_DX9_DEV(SetTransform(gld->pDev, D3DTS_PROJECTION, &gld->matProjection));
 	}
+
+	gldDirtyShaderParams(ctx, _NEW_PROJECTION);
 }
 
 //---------------------------------------------------------------------------
@@ -686,6 +696,8 @@ void gld_NEW_TEXTURE_MATRIX(
 		_GLMatrixToD3DXMatrix(ctx->TextureMatrixStack[i].Top, &gld->matTexture[i], FALSE);
 		_GLMatrixToD3DXMatrix(ctx->TextureMatrixStack[i].Top, &gld->matInvTexture[i], TRUE);
 	}
+
+	gldDirtyShaderParams(ctx, _NEW_TEXTURE_MATRIX);
 }
 
 //---------------------------------------------------------------------------
@@ -764,7 +776,7 @@ void gld_NEW_SCISSOR(
     }
 
     // Enable/disable scissor as required
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_SCISSORTESTENABLE, ctx->Scissor.Enabled));
+    gldSetRenderState(gld, D3DRS_SCISSORTESTENABLE, ctx->Scissor.Enabled);
 }
 
 //---------------------------------------------------------------------------
@@ -775,7 +787,7 @@ void gld_NEW_TRANSFORM(
     GLD_context         *gldCtx = GLD_GET_CONTEXT(ctx);
     GLD_driver_dx9      *gld    = GLD_GET_DX9_DRIVER(gldCtx);
 
-	_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_CLIPPLANEENABLE, ctx->Transform.ClipPlanesEnabled));
+	gldSetRenderState(gld, D3DRS_CLIPPLANEENABLE, ctx->Transform.ClipPlanesEnabled);
 }
 
 //---------------------------------------------------------------------------
@@ -790,6 +802,8 @@ void gld_update_state_DX9(
     if (!gld || !gld->pDev)
         return;
 
+	GLD_PROFILE_BEGIN(GLD_PROFILE_UPDATE_STATE);
+
 	// Array Element helper
 	_ae_invalidate_state(ctx, new_state);
 
@@ -871,6 +885,8 @@ void gld_update_state_DX9(
 	// Note that this is done after the above has updated state.
 	//
 	gldUpdateShaders(ctx);
+
+	GLD_PROFILE_END(GLD_PROFILE_UPDATE_STATE);
 }
 
 //---------------------------------------------------------------------------
@@ -1118,6 +1134,7 @@ void gldSetupDriverPointers_DX9(
     ctx->Driver.CreateTexture           = NULL; // Not yet implemented by Mesa!;
     ctx->Driver.DeleteTexture           = gld_DeleteTexture_DX9;
     ctx->Driver.PrioritizeTexture       = NULL;
+    ctx->Driver.IsTextureResident       = gld_IsTextureResident_DX9;
 
     // Imaging functionality
     ctx->Driver.CopyColorTable          = NULL;
@@ -51,6 +51,7 @@
 #include "texformat.h"
 #include "texstore.h"
 #include "gld_context.h"
+#include "gldirect5.h"
 #include "extensions.h"
 
 // For some reason this is not defined in an above header...
@@ -231,6 +232,11 @@ GLD_extension GLD_multitexList[] = {
     {	(PROC)gldMTexCoord2fSGIS,		"glMTexCoord2fSGIS"			},
     {	(PROC)gldMTexCoord2fvSGIS,		"glMTexCoord2fvSGIS"		},
 
+	// GL_GLD_async_read_pixels
+    {	(PROC)gldReadPixelsAsyncGLD,	"glReadPixelsAsyncGLD"		},
+    {	(PROC)gldPollReadPixelsGLD,		"glPollReadPixelsGLD"		},
+    {	(PROC)gldFinishReadPixelsGLD,	"glFinishReadPixelsGLD"		},
+
 	{	NULL,							"\0"						}
 };
 
@@ -296,6 +302,8 @@ void gldEnableExtensions_DX9(
 	const char *gld_enable_extensions[] = {
 		"GL_EXT_texture_env_add",	// Quake 3
 		"GL_ARB_texture_env_add",	// Quake 3
+		"GL_SGIS_generate_mipmap",	// Levels built in gld5_texture.c
+		"GL_GLD_async_read_pixels",	// gld_readback_dx9.c
 		NULL
 	};
 	
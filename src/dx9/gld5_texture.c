@@ -45,6 +45,7 @@
 #include "colormac.h"
 #include "texstore.h"
 #include "image.h"
+#include "teximage.h"
 // #include "mem.h"
 
 //---------------------------------------------------------------------------
@@ -573,6 +574,17 @@ D3DFORMAT _gldGLFormatToD3DFormat(
 		return D3DFMT_A8R8G8B8;
 	case GL_RGB5_A1:
 		return D3DFMT_A1R5G5B5;
+	case GL_COMPRESSED_ALPHA_ARB:
+		return D3DFMT_A8;
+	case GL_COMPRESSED_LUMINANCE_ARB:
+	case GL_COMPRESSED_INTENSITY_ARB:
+		return D3DFMT_L8;
+	case GL_COMPRESSED_LUMINANCE_ALPHA_ARB:
+		return D3DFMT_A8L8;
+	case GL_COMPRESSED_RGB_ARB:
+		return D3DFMT_DXT1;
+	case GL_COMPRESSED_RGBA_ARB:
+		return D3DFMT_DXT5;
 	}
 
 	// Return an acceptable default
@@ -770,62 +782,134 @@ typedef struct {
 
 //---------------------------------------------------------------------------
 
+void gldReleasePixelTexture(
+	GLD_driver_dx9 *gld)
+{
+	// A dynamic texture lives in POOL_DEFAULT, so this must happen before
+	// Reset(). The next pixel operation creates it again.
+	SAFE_RELEASE(gld->PixelTex.pTex);
+	gld->PixelTex.dwWidth = gld->PixelTex.dwHeight = 0;
+}
+
+//---------------------------------------------------------------------------
+
+static DWORD _gldPixelTextureSize(
+	DWORD dwNeeded,
+	DWORD dwCurrent,
+	DWORD dwMax)
+{
+	// Grow in powers of two so that a run of slightly larger images
+	// does not recreate the texture each time
+	DWORD dwSize = GLD_PIXEL_TEXTURE_MIN;
+
+	while ((dwSize < dwNeeded) || (dwSize < dwCurrent))
+		dwSize <<= 1;
+	return min(dwSize, dwMax);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT _gldGrowPixelTexture(
+	GLD_driver_dx9 *gld,
+	GLsizei width,
+	GLsizei height)
+{
+	GLD_pixelTexture	*pPT = &gld->PixelTex;
+	DWORD				dwWidth, dwHeight;
+	HRESULT				hr;
+
+	if (pPT->pTex && ((DWORD)width <= pPT->dwWidth) && ((DWORD)height <= pPT->dwHeight))
+		return S_OK; // Already big enough
+
+	if (((DWORD)width > gld->d3dCaps9.MaxTextureWidth) ||
+		((DWORD)height > gld->d3dCaps9.MaxTextureHeight))
+		return E_FAIL;
+
+	dwWidth		= _gldPixelTextureSize(width, pPT->dwWidth, gld->d3dCaps9.MaxTextureWidth);
+	dwHeight	= _gldPixelTextureSize(height, pPT->dwHeight, gld->d3dCaps9.MaxTextureHeight);
+	if (gld->d3dCaps9.TextureCaps & D3DPTEXTURECAPS_SQUAREONLY)
+		dwWidth = dwHeight = max(dwWidth, dwHeight);
+
+	SAFE_RELEASE(pPT->pTex);
+	pPT->dwWidth = pPT->dwHeight = 0;
+	pPT->bDynamic = (gld->d3dCaps9.Caps2 & D3DCAPS2_DYNAMICTEXTURES) ? TRUE : FALSE;
+	hr = IDirect3DDevice9_CreateTexture(
+		gld->pDev,
+		dwWidth, dwHeight,
+		1, // miplevels
+		pPT->bDynamic ? D3DUSAGE_DYNAMIC : 0,
+		D3DFMT_A8R8G8B8,
+		pPT->bDynamic ? D3DPOOL_DEFAULT : D3DPOOL_MANAGED,
+		&pPT->pTex,
+		NULL);
+	if (FAILED(hr)) {
+		gldLogError(GLDLOG_WARN, "CreateTexture for pixel operations failed", hr);
+		return hr;
+	}
+	pPT->dwWidth	= dwWidth;
+	pPT->dwHeight	= dwHeight;
+	pPT->dwCreates++;
+
+	return S_OK;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT _gldLockPixelTexture(
+	GLD_driver_dx9 *gld,
+	GLsizei width,
+	GLsizei height,
+	D3DLOCKED_RECT *pLockedRect)
+{
+	//
+	// Lock the top-left width x height texels of the pixel texture,
+	// growing it first if the image does not fit.
+	//
+
+	RECT				rcLock;
+	HRESULT				hr;
+
+	hr = _gldGrowPixelTexture(gld, width, height);
+	if (FAILED(hr))
+		return hr;
+
+	// DISCARD hands back fresh memory if the GPU is still reading the
+	// previous image, so back-to-back pixel operations do not stall.
+	// A managed texture only has the locked corner marked dirty.
+	if (gld->PixelTex.bDynamic)
+		return IDirect3DTexture9_LockRect(gld->PixelTex.pTex, 0, pLockedRect, NULL, D3DLOCK_DISCARD);
+	SetRect(&rcLock, 0, 0, width, height);
+	return IDirect3DTexture9_LockRect(gld->PixelTex.pTex, 0, pLockedRect, &rcLock, 0);
+}
+
+//---------------------------------------------------------------------------
+
 HRESULT _gldDrawPixels(
 	GLcontext *ctx,
 	BOOL bChromakey,	// Alpha test for glBitmap() images
 	GLint x,			// GL x position
 	GLint y,			// GL y position (needs flipping)
 	GLsizei width,		// Width of input image
-	GLsizei height,		// Height of input image
-	IDirect3DSurface9 *pImage)
+	GLsizei height)		// Height of input image
 {
 	//
-	// Draw input image as texture implementing PixelZoom and clipping.
+	// Draw the image in the pixel texture, implementing PixelZoom and clipping.
 	// Any fragment operations currently enabled will be used.
 	//
 
 	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
 	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
 
-	IDirect3DTexture9	*pTexture;
-	D3DSURFACE_DESC		d3dsd;
-	IDirect3DSurface9	*pSurface;
+	IDirect3DTexture9	*pTexture = gld->PixelTex.pTex;
 	_GLD_IMAGE_VERTEX	v[4];
-	HRESULT				hr;
 
 	float				ZoomWidth, ZoomHeight;
 	float				ScaleWidth, ScaleHeight;
 	float				fPixelCenterY; // An adjustment for sampling textures from their pixel center
 
-	// Create a texture to hold image
-	hr = D3DXCreateTexture(
-		gld->pDev,
-		width, height,
-		1, // miplevels
-		0, // usage
-		D3DFMT_A8R8G8B8, // format
-		D3DPOOL_MANAGED, // pool
-		&pTexture);
-	if (FAILED(hr))
-		return hr;
-
-	hr = IDirect3DTexture9_GetSurfaceLevel(pTexture, 0, &pSurface);
-	if (FAILED(hr)) {
-		IDirect3DTexture9_Release(pTexture);
-		return hr;
-	}
-
-	// Copy image into texture
-	hr = D3DXLoadSurfaceFromSurface(
-		pSurface, NULL, NULL,	// Dest surface
-		pImage, NULL, NULL,		// Src surface
-		D3DX_FILTER_POINT,
-		0);
-	IDirect3DSurface9_Release(pSurface);
-	if (FAILED(hr)) {
-		IDirect3DTexture9_Release(pTexture);
-		return hr;
-	}
+	if (!pTexture)
+		return E_FAIL;
+	gld->PixelTex.dwUploads++;
 
 	//
 	// Set up the quad like this (ascii-art ahead!)
@@ -842,12 +926,10 @@ HRESULT _gldDrawPixels(
 	v[0].rhw = v[1].rhw = v[2].rhw = v[3].rhw = 1.0f;
 
 	// Set texcoords
-	// Examine texture size - if different to input width and height
-	// then we'll need to munge the texcoords to fit.
-	IDirect3DTexture9_GetLevelDesc(pTexture, 0, &d3dsd);
-	ScaleWidth = (float)width / (float)d3dsd.Width;
-	ScaleHeight = (float)height / (float)d3dsd.Height;
-	fPixelCenterY = 1.0f / (float)d3dsd.Height;
+	// The image only covers the top-left corner of the texture
+	ScaleWidth = (float)width / (float)gld->PixelTex.dwWidth;
+	ScaleHeight = (float)height / (float)gld->PixelTex.dwHeight;
+	fPixelCenterY = 1.0f / (float)gld->PixelTex.dwHeight;
 	v[0].tu = 0.0f;			v[0].tv = 0.0f;
 	v[1].tu = ScaleWidth;	v[1].tv = 0.0f;
 	v[2].tu = ScaleWidth;	v[2].tv = ScaleHeight - fPixelCenterY;
@@ -864,29 +946,29 @@ HRESULT _gldDrawPixels(
 
 	// Draw image with full HW acceleration
 	// NOTE: Be nice to use a State Block for all this state...
-	IDirect3DDevice9_SetTexture(gld->pDev, 0, (IDirect3DBaseTexture9*)pTexture);
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_CULLMODE, D3DCULL_NONE);
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_CLIPPING, TRUE);
-
-	IDirect3DDevice9_SetSamplerState(gld->pDev, 0, D3DSAMP_MINFILTER, D3DTEXF_POINT);
-	IDirect3DDevice9_SetSamplerState(gld->pDev, 0, D3DSAMP_MIPFILTER, D3DTEXF_NONE);
-	IDirect3DDevice9_SetSamplerState(gld->pDev, 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT);
-	IDirect3DDevice9_SetSamplerState(gld->pDev, 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP);
-	IDirect3DDevice9_SetSamplerState(gld->pDev, 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP);
-
-	IDirect3DDevice9_SetTextureStageState(gld->pDev, 0, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
-	IDirect3DDevice9_SetTextureStageState(gld->pDev, 0, D3DTSS_ALPHAOP, D3DTOP_SELECTARG1);
-	IDirect3DDevice9_SetTextureStageState(gld->pDev, 0, D3DTSS_COLORARG1, D3DTA_TEXTURE);
-	IDirect3DDevice9_SetTextureStageState(gld->pDev, 0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
-	IDirect3DDevice9_SetTextureStageState(gld->pDev, 1, D3DTSS_COLOROP, D3DTOP_DISABLE);
-	IDirect3DDevice9_SetTextureStageState(gld->pDev, 1, D3DTSS_ALPHAOP, D3DTOP_DISABLE);
+	gldSetTexture(gld, 0, (IDirect3DBaseTexture9*)pTexture);
+	gldSetRenderState(gld, D3DRS_CULLMODE, D3DCULL_NONE);
+	gldSetRenderState(gld, D3DRS_CLIPPING, TRUE);
+
+	gldSetSamplerState(gld, 0, D3DSAMP_MINFILTER, D3DTEXF_POINT);
+	gldSetSamplerState(gld, 0, D3DSAMP_MIPFILTER, D3DTEXF_NONE);
+	gldSetSamplerState(gld, 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT);
+	gldSetSamplerState(gld, 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP);
+	gldSetSamplerState(gld, 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP);
+
+	gldSetTextureStageState(gld, 0, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
+	gldSetTextureStageState(gld, 0, D3DTSS_ALPHAOP, D3DTOP_SELECTARG1);
+	gldSetTextureStageState(gld, 0, D3DTSS_COLORARG1, D3DTA_TEXTURE);
+	gldSetTextureStageState(gld, 0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
+	gldSetTextureStageState(gld, 1, D3DTSS_COLOROP, D3DTOP_DISABLE);
+	gldSetTextureStageState(gld, 1, D3DTSS_ALPHAOP, D3DTOP_DISABLE);
 
 	// End current Effect
 	gldEndEffect(gld, gld->iCurEffect);
 
-	IDirect3DDevice9_SetVertexShader(gld->pDev, NULL);
-	IDirect3DDevice9_SetPixelShader(gld->pDev, NULL);
-	IDirect3DDevice9_SetFVF(gld->pDev, _GLD_FVF_IMAGE);
+	gldSetVertexShader(gld, NULL);
+	gldSetPixelShader(gld, NULL);
+	gldSetFVF(gld, _GLD_FVF_IMAGE);
 
 	//
 	// Emulate Chromakey with an Alpha Test.
@@ -894,19 +976,20 @@ HRESULT _gldDrawPixels(
 	//
 	if (bChromakey) {
 		// Switch on alpha testing
-		IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_ALPHATESTENABLE, TRUE);
+		gldSetRenderState(gld, D3DRS_ALPHATESTENABLE, TRUE);
 		// Fragment passes if alpha is greater than reference value
-		IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_ALPHAFUNC, D3DCMP_GREATER);
+		gldSetRenderState(gld, D3DRS_ALPHAFUNC, D3DCMP_GREATER);
 		// Set alpha reference value between Bitmap alpha values of
 		// zero (transparent) and one (opaque).
-		IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_ALPHAREF, 0x7f);
+		gldSetRenderState(gld, D3DRS_ALPHAREF, 0x7f);
 	}
 
 	IDirect3DDevice9_DrawPrimitiveUP(gld->pDev, D3DPT_TRIANGLEFAN, 2, &v, sizeof(_GLD_IMAGE_VERTEX));
+	// DrawPrimitiveUP() leaves stream 0 unset
+	gld->DevState.bVBValid = FALSE;
 
-	// Release texture
-	IDirect3DDevice9_SetTexture(gld->pDev, 0, NULL);
-	IDirect3DTexture9_Release(pTexture);
+	// Unbind the texture; it is kept for the next pixel operation
+	gldSetTexture(gld, 0, NULL);
 
 	// Reset state to before we messed it up
 	FLUSH_VERTICES(ctx, _NEW_ALL);
@@ -915,8 +998,8 @@ HRESULT _gldDrawPixels(
 	gldBeginEffect(gld, gld->iCurEffect);
 
 	// Restore stream to before we messed it up.
-	_GLD_DX9_DEV(SetStreamSource(gld->pDev, 0, gld->pVB, 0, GLD_4D_VERTEX_SIZE));
-	_GLD_DX9_DEV(SetVertexDeclaration(gld->pDev, gld->pVertDecl));
+	gldSetStreamSource(gld, gld->pVB, 0, GLD_4D_VERTEX_SIZE);
+	gldSetVertexDeclaration(gld, gld->pVertDecl);
 
 	return S_OK;
 }
@@ -933,7 +1016,6 @@ void gld_DrawPixels_DX9(
 	GLD_context			*gldCtx;
 	GLD_driver_dx9		*gld;
 
-	IDirect3DSurface9	*pImage;
 	HRESULT				hr;
 	D3DLOCKED_RECT		d3dLockedRect;
 
@@ -944,28 +1026,13 @@ void gld_DrawPixels_DX9(
 	gldCtx	= GLD_GET_CONTEXT(ctx);
 	gld		= GLD_GET_DX9_DRIVER(gldCtx);
 
-	hr = IDirect3DDevice9_CreateOffscreenPlainSurface(
-		gld->pDev, 
-		width,
-		height,
-		D3DFMT_A8R8G8B8,
-		D3DPOOL_SCRATCH,
-		&pImage,
-		NULL);
-	if (FAILED(hr)) {
-		return;
-	}
-
 	//
 	// Use Mesa to fill in image
 	//
 
-	// Lock all of surface 
-	hr = IDirect3DSurface9_LockRect(pImage, &d3dLockedRect, NULL, 0);
-	if (FAILED(hr)) {
-		IDirect3DSurface9_Release(pImage);
+	hr = _gldLockPixelTexture(gld, width, height, &d3dLockedRect);
+	if (FAILED(hr))
 		return;
-	}
 
 	// unpack image, apply transfer ops and store directly in texture
 	_mesa_transfer_teximage(
@@ -979,11 +1046,67 @@ void gld_DrawPixels_DX9(
 		0, /* dstImageStride */
 		format, type, pixels, unpack);
 
-	IDirect3DSurface9_UnlockRect(pImage);
+	IDirect3DTexture9_UnlockRect(gld->PixelTex.pTex, 0);
+
+	_gldDrawPixels(ctx, FALSE, x, y, width, height);
+}
 
-	_gldDrawPixels(ctx, FALSE, x, y, width, height, pImage);
+//---------------------------------------------------------------------------
 
-	IDirect3DSurface9_Release(pImage);
+HRESULT gldDrawImage_DX9(
+	GLcontext *ctx,
+	GLint x,
+	GLint y,
+	GLsizei width,
+	GLsizei height,
+	const DWORD *pPixels)	// ARGB, bottom row first
+{
+	//
+	// Draw an opaque image over the colour buffer, ignoring the GL state
+	// DrawPixels would honour. Used for driver overlays.
+	//
+
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+
+	HRESULT				hr;
+	D3DLOCKED_RECT		d3dLockedRect;
+	BYTE				*pDst;
+	GLfloat				fRasterZ, fZoomX, fZoomY;
+	GLsizei				i;
+
+	hr = _gldLockPixelTexture(gld, width, height, &d3dLockedRect);
+	if (FAILED(hr))
+		return hr;
+	pDst = (BYTE*)d3dLockedRect.pBits;
+	for (i=0; i<height; i++, pDst += d3dLockedRect.Pitch, pPixels += width)
+		memcpy(pDst, pPixels, width * sizeof(DWORD));
+	IDirect3DTexture9_UnlockRect(gld->PixelTex.pTex, 0);
+
+	// _gldDrawPixels() leaves fragment operations alone; switch them off.
+	// Its FLUSH_VERTICES() puts them back from the GL state.
+	gldSetRenderState(gld, D3DRS_ZENABLE, D3DZB_FALSE);
+	gldSetRenderState(gld, D3DRS_ALPHABLENDENABLE, FALSE);
+	gldSetRenderState(gld, D3DRS_ALPHATESTENABLE, FALSE);
+	gldSetRenderState(gld, D3DRS_STENCILENABLE, FALSE);
+	gldSetRenderState(gld, D3DRS_FOGENABLE, FALSE);
+	gldSetRenderState(gld, D3DRS_SCISSORTESTENABLE, FALSE);
+	gldSetRenderState(gld, D3DRS_COLORWRITEENABLE, 0x0000000F);
+
+	fRasterZ	= ctx->Current.RasterPos[2];
+	fZoomX		= ctx->Pixel.ZoomX;
+	fZoomY		= ctx->Pixel.ZoomY;
+	ctx->Current.RasterPos[2]	= 0.0f;
+	ctx->Pixel.ZoomX			= 1.0f;
+	ctx->Pixel.ZoomY			= 1.0f;
+
+	hr = _gldDrawPixels(ctx, FALSE, x, y, width, height);
+
+	ctx->Current.RasterPos[2]	= fRasterZ;
+	ctx->Pixel.ZoomX			= fZoomX;
+	ctx->Pixel.ZoomY			= fZoomY;
+
+	return hr;
 }
 
 //---------------------------------------------------------------------------
@@ -1017,6 +1140,9 @@ void gld_ReadPixels_DX9(
 	case GL_DEPTH_COMPONENT:
 		return;
 	}
+
+	if (gldReadPixels(ctx, x, y, width, height, format, type, pack, dest))
+		return;
 	
 	MesaFormat = _mesa_choose_tex_format(ctx, format, format, type);
 	DstRowStride = _mesa_image_row_stride(pack, width, format, type);
@@ -1162,17 +1288,16 @@ void gld_CopyPixels_DX9(
 {
 	//
 	// NOTE: Not allowed to copy vidmem to vidmem!
-	//       Therefore we use an intermediate image surface.
+	//       D3DX reads the backbuffer back into the pixel texture.
 	//
 
 	GLD_context			*gldCtx;
 	GLD_driver_dx9		*gld;
 
 	IDirect3DSurface9	*pBackbuffer;
-	D3DSURFACE_DESC		d3dsd;
 	IDirect3DSurface9	*pImage;
 	RECT				rcSrc; // Source rect
-	POINT				ptDst; // Dest point
+	RECT				rcDst; // Dest rect
 	HRESULT				hr;
 
 	// Only backbuffer
@@ -1192,36 +1317,27 @@ void gld_CopyPixels_DX9(
 	if (FAILED(hr))
 		return;
 
-	// Get backbuffer description
-	hr = IDirect3DSurface9_GetDesc(pBackbuffer, &d3dsd);
+	// Make room for the image in the pixel texture
+	hr = _gldGrowPixelTexture(gld, width, height);
 	if (FAILED(hr)) {
 		IDirect3DSurface9_Release(pBackbuffer);
 		return;
 	}
-
-	// Create a surface compatible with backbuffer
-	hr = IDirect3DDevice9_CreateOffscreenPlainSurface(
-		gld->pDev, 
-		width,
-		height,
-		d3dsd.Format,
-		D3DPOOL_SCRATCH,
-		&pImage,
-		NULL);
+	hr = IDirect3DTexture9_GetSurfaceLevel(gld->PixelTex.pTex, 0, &pImage);
 	if (FAILED(hr)) {
 		IDirect3DSurface9_Release(pBackbuffer);
 		return;
 	}
 
-	// Compute source rect and dest point
+	// Compute source and dest rects
 	SetRect(&rcSrc, 0, 0, width, height);
 	OffsetRect(&rcSrc, srcx, GLD_FLIP_HEIGHT(srcy, height));
-	ptDst.x = ptDst.y = 0;
+	SetRect(&rcDst, 0, 0, width, height);
 
 	hr = D3DXLoadSurfaceFromSurface(
 			pImage,				// Dest surface
 			NULL,				// Dest palette
-			&rcSrc,				// Dest rect
+			&rcDst,				// Dest rect
 			pBackbuffer,		// Src surface
 			NULL,				// Src palette
 			&rcSrc,				// Src rect
@@ -1229,14 +1345,11 @@ void gld_CopyPixels_DX9(
 			0					// Colorkey (0=no colorkey)
 		);
 	IDirect3DSurface9_Release(pBackbuffer);
-	if (FAILED(hr)) {
-		IDirect3DSurface9_Release(pImage);
+	IDirect3DSurface9_Release(pImage);
+	if (FAILED(hr))
 		return;
-	}
-
-	_gldDrawPixels(ctx, FALSE, dstx, dsty, width, height, pImage);
 
-	IDirect3DSurface9_Release(pImage);
+	_gldDrawPixels(ctx, FALSE, dstx, dsty, width, height);
 }
 
 //---------------------------------------------------------------------------
@@ -1253,7 +1366,6 @@ void gld_Bitmap_DX9(
 	GLD_context			*gldCtx;
 	GLD_driver_dx9		*gld;
 
-	IDirect3DSurface9	*pImage;
 	HRESULT				hr;
 	D3DLOCKED_RECT		d3dLockedRect;
 	BYTE				*pTempBitmap;
@@ -1276,28 +1388,14 @@ void gld_Bitmap_DX9(
 		ctx->Current.RasterColor[2],
 		1.0f); // NOTE: Alpha is One
 
-	hr = IDirect3DDevice9_CreateOffscreenPlainSurface(
-		gld->pDev, 
-		width,
-		height,
-		D3DFMT_A8R8G8B8,
-		D3DPOOL_SCRATCH,
-		&pImage,
-		NULL);
-	if (FAILED(hr)) {
+	pTempBitmap = (BYTE*)_mesa_unpack_bitmap(width, height, bitmap, unpack);
+	if (pTempBitmap == NULL)
 		return;
-	}
 
-	// Lock all of surface 
-	hr = IDirect3DSurface9_LockRect(pImage, &d3dLockedRect, NULL, 0);
+	// Expand the bits straight into the pixel texture
+	hr = _gldLockPixelTexture(gld, width, height, &d3dLockedRect);
 	if (FAILED(hr)) {
-		IDirect3DSurface9_Release(pImage);
-		return;
-	}
-
-	pTempBitmap = (BYTE*)_mesa_unpack_bitmap(width, height, bitmap, unpack);
-	if (pTempBitmap == NULL) {
-		IDirect3DSurface9_Release(pImage);
+		FREE(pTempBitmap);
 		return;
 	}
 
@@ -1341,11 +1439,9 @@ void gld_Bitmap_DX9(
 		0, // dstImageStride
 		GL_BITMAP, GL_COLOR_INDEX, bitmap, unpack);
 */
-	IDirect3DSurface9_UnlockRect(pImage);
-
-	_gldDrawPixels(ctx, TRUE, x, y, width, height, pImage);
+	IDirect3DTexture9_UnlockRect(gld->PixelTex.pTex, 0);
 
-	IDirect3DSurface9_Release(pImage);
+	_gldDrawPixels(ctx, TRUE, x, y, width, height);
 }
 
 //---------------------------------------------------------------------------
@@ -1378,22 +1474,167 @@ void _gldAllocateTexture(
 		{
 			return; // Keep the existing texture
 		}
+		gldDiscardTexStaging(gld, pTex);
 		tObj->DriverData = NULL;
 		_GLD_DX9_TEX(Release(pTex));
 	}
 
 	d3dFormat = _gldGLFormatToD3DFormat(texImage->IntFormat);
+	if (glb.bCompressTextures)
+		d3dFormat = gldCompressedFormat(d3dFormat);
+	// DXT surfaces are made of 4x4 blocks, so the top level must be too
+	if (gldIsCompressedFormat(d3dFormat) &&
+		((texImage->Width & 3) || (texImage->Height & 3)))
+	{
+		d3dFormat = _gldGLFormatToD3DFormat(texImage->Format);
+	}
 	D3DXCreateTexture(
 		gld->pDev,
 		texImage->Width,
 		texImage->Height,
 		// TODO: Re-evaluate mipmapping
-		(glb.bUseMipmaps) ? D3DX_DEFAULT : 1,
+		// GL_SGIS_generate_mipmap needs the full chain to fill in
+		(glb.bUseMipmaps || tObj->GenerateMipmap) ? D3DX_DEFAULT : 1,
 		0,				// Usage
 		d3dFormat,
 		D3DPOOL_MANAGED,
 		&pTex);
 	tObj->DriverData = pTex;
+	gldTrackTexture(ctx, tObj);
+}
+
+//---------------------------------------------------------------------------
+// GL_SGIS_generate_mipmap
+//---------------------------------------------------------------------------
+
+// Private data tag on a D3D texture whose lower levels need regenerating
+const GUID GLD_GUID_MipmapsStale =
+	{ 0x6f1c2a41, 0x9b3e, 0x4d57, { 0x8a, 0x12, 0x3c, 0x5e, 0x77, 0x90, 0xb4, 0x21 } };
+
+//---------------------------------------------------------------------------
+
+static void _gldMarkMipmapsStale(
+	struct gl_texture_object *tObj,
+	GLint level)
+{
+	//
+	// The levels are only built when the texture is next bound, so an app
+	// that uploads level 0 in pieces filters it once.
+	//
+
+	IDirect3DTexture9	*pTex = (IDirect3DTexture9*)tObj->DriverData;
+	DWORD				dwStale = TRUE;
+
+	if ((level != 0) || !tObj->GenerateMipmap || !pTex)
+		return;
+	if (IDirect3DTexture9_GetLevelCount(pTex) < 2)
+		return;
+	IDirect3DTexture9_SetPrivateData(pTex, &GLD_GUID_MipmapsStale, &dwStale, sizeof(dwStale), 0);
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldInitMipmapImages(
+	GLcontext *ctx,
+	GLenum target,
+	struct gl_texture_object *tObj,
+	struct gl_texture_image *texImage)
+{
+	//
+	// Give Mesa an image for every generated level, so that it sees the
+	// texture as mipmap complete. The texels only ever live in Direct3D.
+	//
+
+	const struct gl_texture_unit	*texUnit = &ctx->Texture.Unit[ctx->Texture.CurrentUnit];
+	IDirect3DTexture9				*pTex = (IDirect3DTexture9*)tObj->DriverData;
+	struct gl_texture_image			*dstImage;
+	GLint							width	= texImage->Width;
+	GLint							height	= texImage->Height;
+	GLint							level, nLevels;
+
+	if (!tObj->GenerateMipmap || !pTex)
+		return;
+
+	nLevels = min((GLint)IDirect3DTexture9_GetLevelCount(pTex), tObj->MaxLevel + 1);
+	for (level=1; level<nLevels && (width > 1 || height > 1); level++) {
+		width	= max(width / 2, 1);
+		height	= max(height / 2, 1);
+		dstImage = _mesa_get_tex_image(ctx, texUnit, target, level);
+		if (!dstImage) {
+			_mesa_error(ctx, GL_OUT_OF_MEMORY, "generating mipmaps");
+			return;
+		}
+		_mesa_init_teximage_fields(ctx, target, dstImage, width, height, 1, 0, texImage->IntFormat);
+		dstImage->TexFormat		= texImage->TexFormat;
+		dstImage->FetchTexel	= texImage->TexFormat->FetchTexel2D;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldGenerateMipmaps(
+	GLcontext *ctx,
+	IDirect3DTexture9 *pTex)
+{
+	DWORD					dwStale;
+	DWORD					dwSize = sizeof(dwStale);
+	D3DSURFACE_DESC			d3dsdSrc, d3dsdDst;
+	D3DLOCKED_RECT			lrSrc, lrDst;
+	IDirect3DSurface9		*pSrc, *pDst;
+	const struct gl_texture_format *texFormat;
+	GLint					filter;
+	GLboolean				bDone;
+	DWORD					nLevels, level;
+
+	if (FAILED(IDirect3DTexture9_GetPrivateData(pTex, &GLD_GUID_MipmapsStale, &dwStale, &dwSize)))
+		return; // Levels are up to date
+	IDirect3DTexture9_FreePrivateData(pTex, &GLD_GUID_MipmapsStale);
+
+	filter = (ctx->Hint.GenerateMipmap == GL_NICEST) ? MESA_MIPMAP_KAISER : MESA_MIPMAP_BOX;
+
+	IDirect3DTexture9_GetLevelDesc(pTex, 0, &d3dsdSrc);
+	if (gldIsCompressedFormat(d3dsdSrc.Format)) {
+		// D3DX decodes, filters and re-encodes DXT levels itself
+		D3DXFilterTexture((IDirect3DBaseTexture9*)pTex, NULL, 0,
+			(filter == MESA_MIPMAP_KAISER) ? D3DX_FILTER_TRIANGLE : D3DX_FILTER_BOX);
+		return;
+	}
+	texFormat = _gldMesaFormatForD3DFormat(d3dsdSrc.Format);
+	if (!texFormat) {
+		D3DXFilterTexture((IDirect3DBaseTexture9*)pTex, NULL, 0, D3DX_FILTER_BOX);
+		return;
+	}
+
+	nLevels = IDirect3DTexture9_GetLevelCount(pTex);
+	for (level=1; level<nLevels; level++) {
+		IDirect3DTexture9_GetLevelDesc(pTex, level-1, &d3dsdSrc);
+		IDirect3DTexture9_GetLevelDesc(pTex, level, &d3dsdDst);
+		IDirect3DTexture9_GetSurfaceLevel(pTex, level-1, &pSrc);
+		IDirect3DTexture9_GetSurfaceLevel(pTex, level, &pDst);
+
+		bDone = GL_FALSE;
+		if (SUCCEEDED(IDirect3DSurface9_LockRect(pSrc, &lrSrc, NULL, D3DLOCK_READONLY))) {
+			if (SUCCEEDED(IDirect3DSurface9_LockRect(pDst, &lrDst, NULL, 0))) {
+				bDone = _mesa_downsample_texture_2d(
+					texFormat->MesaFormat,
+					filter,
+					d3dsdSrc.Width, d3dsdSrc.Height,
+					(const GLubyte*)lrSrc.pBits, lrSrc.Pitch,
+					d3dsdDst.Width, d3dsdDst.Height,
+					(GLubyte*)lrDst.pBits, lrDst.Pitch);
+				IDirect3DSurface9_UnlockRect(pDst);
+			}
+			IDirect3DSurface9_UnlockRect(pSrc);
+		}
+		IDirect3DSurface9_Release(pSrc);
+		IDirect3DSurface9_Release(pDst);
+
+		if (!bDone) {
+			// Format Mesa cannot filter; let D3DX do the rest of the chain
+			D3DXFilterTexture((IDirect3DBaseTexture9*)pTex, NULL, level-1, D3DX_FILTER_BOX);
+			return;
+		}
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -1477,6 +1718,19 @@ const struct gl_texture_format* gld_ChooseTextureFormat_DX9(
 		return &_mesa_texformat_argb8888;
 	case GL_RGB5_A1:
 		return &_mesa_texformat_argb1555;
+	// Generic compressed formats are stored as DXT where possible,
+	// but Mesa only needs to know the uncompressed equivalent.
+	case GL_COMPRESSED_ALPHA_ARB:
+		return &_mesa_texformat_a8; // D3DFMT_A8
+	case GL_COMPRESSED_LUMINANCE_ARB:
+	case GL_COMPRESSED_INTENSITY_ARB:
+		return &_mesa_texformat_l8; // D3DFMT_L8
+	case GL_COMPRESSED_LUMINANCE_ALPHA_ARB:
+		return &_mesa_texformat_al88; // D3DFMT_A8L8
+	case GL_COMPRESSED_RGB_ARB:
+		return &_mesa_texformat_rgb565; // D3DFMT_DXT1
+	case GL_COMPRESSED_RGBA_ARB:
+		return &_mesa_texformat_argb8888; // D3DFMT_DXT5
 	default:
 		_mesa_problem(NULL, "unexpected format in fxDDChooseTextureFormat");
 		return NULL;
@@ -1612,9 +1866,63 @@ static void gldTexImage2DScaled(
 
 //---------------------------------------------------------------------------
 
+static void gldTexSubImage2DUnaligned(
+	GLcontext *ctx,
+	GLint xoffset,
+	GLint yoffset,
+	GLint width,
+	GLint height,
+	GLenum format,
+	IDirect3DSurface9 *pSurface,
+	GLenum type,
+	const GLvoid *pixels,
+	const struct gl_pixelstore_attrib *packing,
+	struct gl_texture_image *texImage)
+{
+	RECT			rcSrcRect;
+	RECT			rcDstRect;
+	const GLint		texelBytes = 4;
+	GLvoid			*tempImage;
+
+	tempImage = MALLOC(width * height * texelBytes);
+	if (!tempImage) {
+		_mesa_error(ctx, GL_OUT_OF_MEMORY, "glTexSubImage2D");
+		IDirect3DSurface9_Release(pSurface);
+		return;
+	}
+	// unpack image, apply transfer ops and store in tempImage
+	_mesa_transfer_teximage(ctx, 2, texImage->Format,
+		&_mesa_texformat_argb8888, // dest format
+		tempImage,
+		width, height, 1, 0, 0, 0,
+		width * texelBytes,
+		0, // dstImageStride
+		format, type, pixels, packing);
+
+	SetRect(&rcSrcRect, 0, 0, width, height);
+	SetRect(&rcDstRect, xoffset, yoffset, xoffset + width, yoffset + height);
+
+	D3DXLoadSurfaceFromMemory(
+		pSurface,
+		NULL,
+		&rcDstRect,
+		tempImage,
+		D3DFMT_A8R8G8B8,
+		width * texelBytes,
+		NULL,
+		&rcSrcRect,
+		D3DX_FILTER_NONE,
+		0);
+
+	FREE(tempImage);
+	IDirect3DSurface9_Release(pSurface);
+}
+
+//---------------------------------------------------------------------------
+
 // Faster, more efficient version.
 // Copies subimage straight to dest texture
-void gld_TexImage2D_DX9(
+static void _gldTexImage2D(
 	GLcontext *ctx,
 	GLenum target,
 	GLint level,
@@ -1649,8 +1957,11 @@ void gld_TexImage2D_DX9(
 		internalFormat = GL_RGBA;
 	}
 
+	// Reload the texture if it was evicted, so existing levels survive
+	gldTouchTexture(ctx, tObj);
 	if (level == 0) {
 		_gldAllocateTexture(ctx, tObj, texImage);
+		_gldInitMipmapImages(ctx, target, tObj, texImage);
 	}
 
 	pTex = (IDirect3DTexture9*)tObj->DriverData;
@@ -1661,6 +1972,8 @@ void gld_TexImage2D_DX9(
 	hr = IDirect3DTexture9_GetSurfaceLevel(pTex, level, &pSurface);
 	if (FAILED(hr))
 		return; // Surface level doesn't exist (or just a plain error)
+	_gldMarkMipmapsStale(tObj, level);
+	gldFlushTexStaging(gld, pTex);
 
 	IDirect3DSurface9_GetDesc(pSurface, &d3dsd);
 	if ((width > d3dsd.Width) | (height > d3dsd.Height)) {
@@ -1678,17 +1991,43 @@ void gld_TexImage2D_DX9(
 		return;
 	}
 
-	// unpack image, apply transfer ops and store directly in texture
-	_mesa_transfer_teximage(
-		ctx,
-		2,
-		texImage->Format,
-		_gldMesaFormatForD3DFormat(d3dsd.Format),
-		d3dLockedRect.pBits,
-		width, height, 1, 0, 0, 0,
-		d3dLockedRect.Pitch,
-		0, // dstImageStride
-		format, type, pixels, packing);
+	if (gldIsCompressedFormat(d3dsd.Format)) {
+		// unpack image and encode it straight into the DXT blocks
+		if (!gldCompressTexImage(
+			ctx,
+			texImage,
+			d3dsd.Format,
+			(BYTE*)d3dLockedRect.pBits,
+			d3dLockedRect.Pitch,
+			width, height,
+			format, type, pixels, packing))
+		{
+			// Let D3DX encode it instead
+			IDirect3DSurface9_UnlockRect(pSurface);
+			gldTexSubImage2DUnaligned(ctx, 0, 0, width, height, format, pSurface, type, pixels, packing, texImage);
+			return;
+		}
+	} else if (!gldUploadTexImage(
+			ctx,
+			texImage,
+			d3dsd.Format,
+			(BYTE*)d3dLockedRect.pBits,
+			d3dLockedRect.Pitch,
+			width, height,
+			format, type, pixels, packing))
+	{
+		// unpack image, apply transfer ops and store directly in texture
+		_mesa_transfer_teximage(
+			ctx,
+			2,
+			texImage->Format,
+			_gldMesaFormatForD3DFormat(d3dsd.Format),
+			d3dLockedRect.pBits,
+			width, height, 1, 0, 0, 0,
+			d3dLockedRect.Pitch,
+			0, // dstImageStride
+			format, type, pixels, packing);
+	}
 
 	IDirect3DSurface9_UnlockRect(pSurface);
 	IDirect3DSurface9_Release(pSurface);
@@ -1700,6 +2039,29 @@ void gld_TexImage2D_DX9(
 
 //---------------------------------------------------------------------------
 
+void gld_TexImage2D_DX9(
+	GLcontext *ctx,
+	GLenum target,
+	GLint level,
+	GLint internalFormat,
+	GLint width,
+	GLint height,
+	GLint border,
+	GLenum format,
+	GLenum type,
+	const GLvoid *pixels,
+	const struct gl_pixelstore_attrib *packing,
+	struct gl_texture_object *tObj,
+	struct gl_texture_image *texImage)
+{
+	GLD_PROFILE_BEGIN(GLD_PROFILE_TEX_IMAGE);
+	_gldTexImage2D(ctx, target, level, internalFormat, width, height, border,
+		format, type, pixels, packing, tObj, texImage);
+	GLD_PROFILE_END(GLD_PROFILE_TEX_IMAGE);
+}
+
+//---------------------------------------------------------------------------
+
 void gld_TexImage1D_DX9(GLcontext *ctx, GLenum target, GLint level,
                        GLint internalFormat,
                        GLint width, GLint border,
@@ -1708,6 +2070,9 @@ void gld_TexImage1D_DX9(GLcontext *ctx, GLenum target, GLint level,
                        struct gl_texture_object *texObj,
                        struct gl_texture_image *texImage )
 {
+	// Reload the texture if it was evicted, so existing levels survive
+	if (texObj)
+		gldTouchTexture(ctx, texObj);
 	// A 1D texture is a 2D texture with a height of zero
 	gld_TexImage2D_DX9(ctx, target, level, internalFormat, width, 1, border, format, type, pixels, packing, texObj, texImage);
 }
@@ -1849,6 +2214,7 @@ static void gldTexSubImage2DScaled(
 
 //---------------------------------------------------------------------------
 
+
 // Faster, more efficient version.
 // Copies subimage straight to dest texture
 void gld_TexSubImage2D_DX9( GLcontext *ctx, GLenum target, GLint level,
@@ -1869,11 +2235,12 @@ void gld_TexSubImage2D_DX9( GLcontext *ctx, GLenum target, GLint level,
 	RECT				rcDstRect;
 	D3DLOCKED_RECT		d3dLockedRect;
 	D3DSURFACE_DESC		d3dsd;
+	BOOL				bCompressed;
 
 	if (!tObj || !texImage)
 		return;
 
-	pTex = (IDirect3DTexture9*)tObj->DriverData;
+	pTex = gldTouchTexture(ctx, tObj);
 	if (!pTex)
 		return; // Texture has not been created
 	if (level >= IDirect3DTexture9_GetLevelCount(pTex))
@@ -1881,13 +2248,60 @@ void gld_TexSubImage2D_DX9( GLcontext *ctx, GLenum target, GLint level,
 	hr = IDirect3DTexture9_GetSurfaceLevel(pTex, level, &pSurface);
 	if (FAILED(hr))
 		return; // Surface level doesn't exist (or just a plain error)
+	_gldMarkMipmapsStale(tObj, level);
 
 	IDirect3DSurface9_GetDesc(pSurface, &d3dsd);
 	if ((width > d3dsd.Width) || (height > d3dsd.Height)) {
+		gldFlushTexStaging(gld, pTex);
 		gldTexSubImage2DScaled(ctx, xoffset, yoffset, width, height, format, pSurface, type, pixels, packing, texImage, &d3dsd);
 		return;
 	}
 
+	if (gldIsCompressedFormat(d3dsd.Format)) {
+		// DXT can only be locked and encoded in whole 4x4 blocks. A rect that
+		// splits blocks goes through D3DX, which re-encodes the blocks it touches.
+		if ((xoffset & 3) || (yoffset & 3) ||
+			(((xoffset + width) & 3) && (xoffset + width != (GLint)d3dsd.Width)) ||
+			(((yoffset + height) & 3) && (yoffset + height != (GLint)d3dsd.Height)))
+		{
+			gldTexSubImage2DUnaligned(ctx, xoffset, yoffset, width, height, format, pSurface, type, pixels, packing, texImage);
+			return;
+		}
+		SetRect(&rcDstRect, xoffset, yoffset, xoffset + width, yoffset + height);
+		hr = IDirect3DSurface9_LockRect(pSurface, &d3dLockedRect, &rcDstRect, 0);
+		if (FAILED(hr)) {
+			IDirect3DSurface9_Release(pSurface);
+			return;
+		}
+		bCompressed = gldCompressTexImage(
+			ctx,
+			texImage,
+			d3dsd.Format,
+			(BYTE*)d3dLockedRect.pBits,
+			d3dLockedRect.Pitch,
+			width, height,
+			format, type, pixels, packing);
+		IDirect3DSurface9_UnlockRect(pSurface);
+		if (!bCompressed) {
+			// Let D3DX encode it instead
+			gldTexSubImage2DUnaligned(ctx, xoffset, yoffset, width, height, format, pSurface, type, pixels, packing, texImage);
+			return;
+		}
+		IDirect3DSurface9_Release(pSurface);
+		return;
+	}
+
+	// Small updates are deferred until the texture is next bound
+	if (gldStageTexSubImage(ctx, texImage, pTex, level, &d3dsd,
+			_gldMesaFormatForD3DFormat(d3dsd.Format),
+			xoffset, yoffset, width, height, format, type, pixels, packing))
+	{
+		IDirect3DSurface9_Release(pSurface);
+		return;
+	}
+	// Earlier staged updates must not land on top of this one
+	gldFlushTexStaging(gld, pTex);
+
 	// Dest rectangle must be offset to dest image
 	SetRect(&rcDstRect, 0, 0, width, height);
 	OffsetRect(&rcDstRect, xoffset, yoffset);
@@ -1899,15 +2313,21 @@ void gld_TexSubImage2D_DX9( GLcontext *ctx, GLenum target, GLint level,
 		return;
 	}
 
+	// Copy straight in if the layout already matches, otherwise
 	// unpack image, apply transfer ops and store directly in texture
-	_mesa_transfer_teximage(ctx, 2, texImage->Format,
-		_gldMesaFormatForD3DFormat(d3dsd.Format),
-		d3dLockedRect.pBits,
-		width, height, 1,
-		0, 0, 0, // NOTE: d3dLockedRect.pBits is already offset!!!
-		d3dLockedRect.Pitch,
-		0, // dstImageStride
-		format, type, pixels, packing);
+	if (!gldUploadTexImage(ctx, texImage, d3dsd.Format,
+			(BYTE*)d3dLockedRect.pBits, d3dLockedRect.Pitch,
+			width, height, format, type, pixels, packing))
+	{
+		_mesa_transfer_teximage(ctx, 2, texImage->Format,
+			_gldMesaFormatForD3DFormat(d3dsd.Format),
+			d3dLockedRect.pBits,
+			width, height, 1,
+			0, 0, 0, // NOTE: d3dLockedRect.pBits is already offset!!!
+			d3dLockedRect.Pitch,
+			0, // dstImageStride
+			format, type, pixels, packing);
+	}
 
 
 	IDirect3DSurface9_UnlockRect(pSurface);
@@ -1924,6 +2344,9 @@ void gld_TexSubImage1D_DX9( GLcontext *ctx, GLenum target, GLint level,
                           struct gl_texture_object *texObj,
                           struct gl_texture_image *texImage )
 {
+	// Reload the texture if it was evicted, or the update would be lost
+	if (texObj)
+		gldTouchTexture(ctx, texObj);
 	gld_TexSubImage2D_DX9(ctx, target, level, xoffset, 0, width, 1, format, type, pixels, packing, texObj, texImage);
 }
 
@@ -1937,7 +2360,9 @@ void gld_DeleteTexture_DX9(
 
 	if (tObj) {
 		IDirect3DTexture9 *pTex = (IDirect3DTexture9*)tObj->DriverData;
+		gldUntrackTexture(GLD_GET_DX9_DRIVER(gld), tObj);
 		if (pTex) {
+			gldDiscardTexStaging(GLD_GET_DX9_DRIVER(gld), pTex);
 /*			// Make sure texture is not bound to a stage before releasing it
 			for (int i=0; i<MAX_TEXTURE_UNITS; i++) {
 				if (gld->CurrentTexture[i] == pTex) {
@@ -1960,9 +2385,9 @@ __inline void _gldSetColorOps(
 	D3DTEXTUREOP ColorOp,
 	DWORD ColorArg2)
 {
-	_GLD_DX9_DEV(SetTextureStageState(gld->pDev, unit, D3DTSS_COLORARG1, ColorArg1));
-	_GLD_DX9_DEV(SetTextureStageState(gld->pDev, unit, D3DTSS_COLOROP, ColorOp));
-	_GLD_DX9_DEV(SetTextureStageState(gld->pDev, unit, D3DTSS_COLORARG2, ColorArg2));
+	gldSetTextureStageState(gld, unit, D3DTSS_COLORARG1, ColorArg1);
+	gldSetTextureStageState(gld, unit, D3DTSS_COLOROP, ColorOp);
+	gldSetTextureStageState(gld, unit, D3DTSS_COLORARG2, ColorArg2);
 }
 
 //---------------------------------------------------------------------------
@@ -1974,9 +2399,9 @@ __inline void _gldSetAlphaOps(
 	D3DTEXTUREOP AlphaOp,
 	DWORD AlphaArg2)
 {
-	_GLD_DX9_DEV(SetTextureStageState(gld->pDev, unit, D3DTSS_ALPHAARG1, AlphaArg1));
-	_GLD_DX9_DEV(SetTextureStageState(gld->pDev, unit, D3DTSS_ALPHAOP, AlphaOp));
-	_GLD_DX9_DEV(SetTextureStageState(gld->pDev, unit, D3DTSS_ALPHAARG2, AlphaArg2));
+	gldSetTextureStageState(gld, unit, D3DTSS_ALPHAARG1, AlphaArg1);
+	gldSetTextureStageState(gld, unit, D3DTSS_ALPHAOP, AlphaOp);
+	gldSetTextureStageState(gld, unit, D3DTSS_ALPHAARG2, AlphaArg2);
 }
 
 //---------------------------------------------------------------------------
@@ -2012,10 +2437,10 @@ void gldUpdateTextureUnit(
 	//if (pTex && (pUnit->Enabled & (TEXTURE0_1D | TEXTURE0_2D))) {
 	if (pTex && (pUnit->_ReallyEnabled & (TEXTURE_1D_BIT | TEXTURE_2D_BIT))) {
 		// Enable texturing
-		_GLD_DX9_DEV(SetTexture(gld->pDev, unit, pTex));
+		gldSetTexture(gld, unit, pTex);
 	} else {
 		// Disable texturing, then return
-		_GLD_DX9_DEV(SetTexture(gld->pDev, unit, NULL));
+		gldSetTexture(gld, unit, NULL);
 		if (bPassThrough) {
 			_gldSetColorOps(gld, unit, D3DTA_TEXTURE, D3DTOP_SELECTARG2, D3DTA_DIFFUSE);
 			_gldSetAlphaOps(gld, unit, D3DTA_TEXTURE, D3DTOP_SELECTARG2, D3DTA_DIFFUSE);
@@ -2028,11 +2453,11 @@ void gldUpdateTextureUnit(
 
 	// Texture parameters
 	_gldConvertMinFilter(tObj->MinFilter, &minfilter, &mipfilter);
-	_GLD_DX9_DEV(SetSamplerState(gld->pDev, unit, D3DSAMP_MINFILTER, minfilter));
-	_GLD_DX9_DEV(SetSamplerState(gld->pDev, unit, D3DSAMP_MIPFILTER, mipfilter));
-	_GLD_DX9_DEV(SetSamplerState(gld->pDev, unit, D3DSAMP_MAGFILTER, _gldConvertMagFilter(tObj->MagFilter)));
-	_GLD_DX9_DEV(SetSamplerState(gld->pDev, unit, D3DSAMP_ADDRESSU, _gldConvertWrap(tObj->WrapS)));
-	_GLD_DX9_DEV(SetSamplerState(gld->pDev, unit, D3DSAMP_ADDRESSV, _gldConvertWrap(tObj->WrapT)));
+	gldSetSamplerState(gld, unit, D3DSAMP_MINFILTER, minfilter);
+	gldSetSamplerState(gld, unit, D3DSAMP_MIPFILTER, mipfilter);
+	gldSetSamplerState(gld, unit, D3DSAMP_MAGFILTER, _gldConvertMagFilter(tObj->MagFilter));
+	gldSetSamplerState(gld, unit, D3DSAMP_ADDRESSU, _gldConvertWrap(tObj->WrapS));
+	gldSetSamplerState(gld, unit, D3DSAMP_ADDRESSV, _gldConvertWrap(tObj->WrapT));
 
 	// Texture priority
 	_GLD_DX9_TEX(SetPriority(pTex, (DWORD)(tObj->Priority*65535.0f)));
@@ -2067,7 +2492,7 @@ void gldUpdateTextureUnit(
 	case GL_BLEND:
 		// Set blend colour
 		dwColorArg0 = gldClampedColour(pUnit->EnvColor);
-		_GLD_DX9_DEV(SetTextureStageState(gld->pDev, unit, D3DTSS_COLORARG0, dwColorArg0));
+		gldSetTextureStageState(gld, unit, D3DTSS_COLORARG0, dwColorArg0);
 		iTexEnv += 9;
 		break;
 	case GL_ADD:
@@ -2131,10 +2556,50 @@ void gld_NEW_TEXTURE_DX9(
 #else
 //---------------------------------------------------------------------------
 
+IDirect3DTexture9* gldValidateTextureUnit(
+	GLcontext *ctx,
+	GLuint unit)
+{
+	//
+	// Called for each unit when the effect's texture parameters are
+	// refreshed. Brings the bound D3D texture up to date before the
+	// effect samples it, and returns it.
+	//
+
+	GLD_context						*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9					*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	const struct gl_texture_unit	*pUnit	= &ctx->Texture.Unit[unit];
+	struct gl_texture_object		*tObj	= pUnit->_Current;
+	IDirect3DTexture9				*pTex;
+
+	if (!tObj)
+		return NULL;
+	if (!pUnit->_ReallyEnabled)
+		return (IDirect3DTexture9*)tObj->DriverData;
+
+	// Restores the texture first if the residency budget evicted it
+	pTex = gldTouchTexture(ctx, tObj);
+	if (!pTex)
+		return NULL;
+
+	// Copy any sub-images still waiting in staging
+	gldFlushTexStaging(gld, pTex);
+
+	// Rebuild the lower levels if level 0 changed since the last bind
+	if (tObj->GenerateMipmap)
+		_gldGenerateMipmaps(ctx, pTex);
+
+	return pTex;
+}
+
+//---------------------------------------------------------------------------
+
 void gld_NEW_TEXTURE_DX9(
 	GLcontext *ctx)
 {
-	// ** NOT REQUIRED WHEN USING SHADERS **
+	// Texture stage states are not required when using shaders.
+	// Only the effect parameters need refreshing.
+	gldDirtyShaderParams(ctx, _NEW_TEXTURE);
 }
 #endif
 //---------------------------------------------------------------------------
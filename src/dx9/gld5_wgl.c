@@ -63,8 +63,7 @@ HRESULT _gldDrawPixels(
 	GLint x,			// GL x position
 	GLint y,			// GL y position (needs flipping)
 	GLsizei width,		// Width of input image
-	GLsizei height,		// Height of input image
-	IDirect3DSurface9 *pImage);
+	GLsizei height);	// Height of input image
 
 BOOL GLD_isLicensed(void);
 BOOL GLD_isTimedOut(void);
@@ -222,13 +221,17 @@ void _gldDestroyPrimitiveBuffer(
 	if (gld == NULL)
 		return;
 
+	SAFE_RELEASE(gld->pIB);
 	SAFE_RELEASE(gld->pVB);
 	SAFE_FREE(gld->pPrim);
 
 	// Init vars
 	gld->dwMaxVBVerts = gld->dwMaxPrimVerts = 0;
 	gld->dwFirstVBVert = gld->dwNextVBVert = 0;
+	gld->dwMaxIBIndices = 0;
+	gld->dwFirstIBIndex = gld->dwNextIBIndex = 0;
 	gld->dwPrimVert = 0;
+	gld->ArrayCache.bValid = FALSE;
 }
 
 //---------------------------------------------------------------------------
@@ -237,7 +240,9 @@ void gldResetPrimitiveBuffer(
 	GLD_driver_dx9 *gld)
 {
 	gld->dwFirstVBVert = gld->dwNextVBVert = 0;
+	gld->dwFirstIBIndex = gld->dwNextIBIndex = 0;
 	gld->dwPrimVert = 0;
+	gld->ArrayCache.bValid = FALSE;
 }
 
 //---------------------------------------------------------------------------
@@ -278,6 +283,28 @@ HRESULT _gldCreatePrimitiveBuffer(
 		return hr; // FAILED
 	}
 
+	// Create a companion Index Buffer for indexed primitives.
+	// 16-bit indices are sufficient since the VB never exceeds 65535 vertices.
+	gld->bIndexedPrims	= FALSE;
+	gld->dwMaxIBIndices	= 0;
+	if (glb.bIndexedPrimitives) {
+		hr = IDirect3DDevice9_CreateIndexBuffer(
+			gld->pDev,
+			sizeof(WORD) * gld->dwMaxVBVerts * GLD_IB_VB_RATIO,
+			dwUsage,
+			D3DFMT_INDEX16,
+			D3DPOOL_DEFAULT,
+			&gld->pIB,
+			NULL);
+		if (SUCCEEDED(hr)) {
+			gld->dwMaxIBIndices	= gld->dwMaxVBVerts * GLD_IB_VB_RATIO;
+			gld->bIndexedPrims	= TRUE;
+		} else {
+			// Not fatal; fall back to expanded primitives
+			gldLogError(GLDLOG_WARN, "CreateIndexBuffer failed", hr);
+		}
+	}
+
 	gldResetPrimitiveBuffer(gld);
 
 	return S_OK; // SUCCEEDED
@@ -352,7 +379,7 @@ BOOL gldCreateDrawable_DX(
 //		ZeroMemory(lpCtx, sizeof(lpCtx));
 	}
 
-	d3dDevType = (glb.dwDriver == GLDS_DRIVER_HAL) ? D3DDEVTYPE_HAL : D3DDEVTYPE_REF;
+	d3dDevType = GLD_DEVTYPE_DX9;
 	// TODO: Check this
 //	if (bDefaultDriver)
 //		d3dDevType = D3DDEVTYPE_REF;
@@ -485,15 +512,17 @@ SkipDirectDrawCreate:
 	// Changed D3DCREATE_MIXED_VERTEXPROCESSING to D3DCREATE_HARDWARE_VERTEXPROCESSING. KeithH
 	dwBehaviourFlags = (lpCtx->bHasHWTnL) ?
 		D3DCREATE_HARDWARE_VERTEXPROCESSING : D3DCREATE_SOFTWARE_VERTEXPROCESSING;
-	// Add flag to tell D3D to be thread-safe
-	if (glb.bMultiThreaded)
+	// Add flag to tell D3D to be thread-safe. The command stream's worker
+	// shares the device with the app thread.
+	if (glb.bMultiThreaded || glb.bCommandStream)
 		dwBehaviourFlags |= D3DCREATE_MULTITHREADED;
 	// Add flag to tell D3D to be FPU-safe
 	if (!glb.bFastFPU)
 		dwBehaviourFlags |= D3DCREATE_FPU_PRESERVE;
 
 	// Add flag for Pure device.
-	// This is currently slower. Need to implement state manager before enabling this.
+	// All state setting now goes through the state filter (gld_state_dx9.c),
+	// but Get*() calls remain so this is left disabled.
 //	dwBehaviourFlags |= D3DCREATE_PUREDEVICE;
 
 	hResult = IDirect3D9_CreateDevice(lpCtx->pD3D,
@@ -550,6 +579,20 @@ SkipDirectDrawCreate:
 
 skip_direct3ddevice_create:
 
+	// Count what reaches the device, if gldirect.ini asks for it
+	gldStartRecording(lpCtx->pDev);
+	gldStartProfiling();
+
+	// Submit from a worker thread, if gldirect.ini asks for it. This hooks
+	// the device last, over the recorder.
+	gldStartStream(lpCtx->pDev);
+
+	// Start with an unknown device state. A re-used device may hold anything.
+	gldInitDeviceState(lpCtx);
+
+	// Start the DXT encoding threads, so uploads don't have to
+	gldInitCompressPool(lpCtx);
+
 	// Create buffers to hold primitives
 	hResult = _gldCreatePrimitiveBuffer(lpCtx);
 	if (FAILED(hResult))
@@ -610,9 +653,11 @@ BOOL gldResizeDrawable_DX(
 		ctx->bSceneStarted = FALSE;
 	}
 
-	d3dDevType = (glb.dwDriver == GLDS_DRIVER_HAL) ? D3DDEVTYPE_HAL : D3DDEVTYPE_REF;
+	d3dDevType = GLD_DEVTYPE_DX9;
+#ifndef GLD5_NULL_DRIVER
 	if (!bDefaultDriver)
 		d3dDevType = D3DDEVTYPE_REF; // Force Direct3D Reference Rasterise (software)
+#endif
 
 	// Get the display mode so we can make a compatible backbuffer
 	hResult = IDirect3D9_GetAdapterDisplayMode(gld->pD3D, glb.dwAdapter, &d3ddm);
@@ -624,10 +669,13 @@ BOOL gldResizeDrawable_DX(
 
 	// Release POOL_DEFAULT objects before Reset()
 	_gldDestroyPrimitiveBuffer(gld);
+	gldReleasePixelTexture(gld);
+	gldReleaseReadback(gld);
 
 	// Notify Effects of impending Reset
 	for (i=0; i<gld->nEffects; i++) {
-		ID3DXEffect_OnLostDevice(gld->Effects[i].pEffect);
+		if (gld->Effects[i].pEffect)
+			ID3DXEffect_OnLostDevice(gld->Effects[i].pEffect);
 	}
 
 	// Clear the presentation parameters (sets all members to zero)
@@ -705,6 +753,9 @@ BOOL gldResizeDrawable_DX(
 		//goto cleanup_and_return_with_error;
 	}
 
+	// Reset() returns the device to default state
+	gldInvalidateDeviceState(gld);
+
     // Explicitly Clear resized surfaces (DaveM)
 	{
 		D3DVIEWPORT9 d3dvp1, d3dvp2;
@@ -720,7 +771,7 @@ BOOL gldResizeDrawable_DX(
 	}
 
 	// Set Dither back on again. Some drivers switch this off in the Reset() call...
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_DITHERENABLE, TRUE);
+	gldSetRenderState(gld, D3DRS_DITHERENABLE, TRUE);
 
 	//
 	// Recreate POOL_DEFAULT objects
@@ -729,12 +780,13 @@ BOOL gldResizeDrawable_DX(
 
 	// Notify Effects that Reset has been called
 	for (i=0; i<gld->nEffects; i++) {
-		ID3DXEffect_OnResetDevice(gld->Effects[i].pEffect);
+		if (gld->Effects[i].pEffect)
+			ID3DXEffect_OnResetDevice(gld->Effects[i].pEffect);
 	}
 
 	// Necessary for D3D HW TnL resize when normals not present.(DaveM)
 	if (gld->bHasHWTnL)
-		IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_LIGHTING, FALSE);
+		gldSetRenderState(gld, D3DRS_LIGHTING, FALSE);
 	
 	// Signal a complete state update
 	ctx->glCtx->Driver.UpdateState(ctx->glCtx, _NEW_ALL);
@@ -750,8 +802,8 @@ BOOL gldResizeDrawable_DX(
 	gldBeginEffect(gld, gld->iCurEffect);
 
 	// Reset stream
-	_GLD_DX9_DEV(SetStreamSource(gld->pDev, 0, gld->pVB, 0, GLD_4D_VERTEX_SIZE));
-	_GLD_DX9_DEV(SetVertexDeclaration(gld->pDev, gld->pVertDecl));
+	gldSetStreamSource(gld, gld->pVB, 0, GLD_4D_VERTEX_SIZE);
+	gldSetVertexDeclaration(gld, gld->pVertDecl);
 
 	return TRUE;
 }
@@ -773,11 +825,34 @@ BOOL gldDestroyDrawable_DX(
 
 	lpCtx = (GLD_driver_dx9*)ctx->glPriv;
 
+	gldLogPrintf(GLDLOG_INFO, "Vertex arrays: %u draws (%u from locked ranges), %u left to Mesa",
+		lpCtx->dwArrayDraws, lpCtx->dwArrayCached, lpCtx->dwArrayFallbacks);
+	gldLogPrintf(GLDLOG_INFO, "Pixel operations: %u images, %u texture creations",
+		lpCtx->PixelTex.dwUploads, lpCtx->PixelTex.dwCreates);
+	gldLogPrintf(GLDLOG_INFO, "Glyph atlas: %u glyphs (%ux%u), %u left to Mesa, %u drawn in %u batches",
+		lpCtx->Glyphs.dwCompiled, lpCtx->Glyphs.dwWidth, lpCtx->Glyphs.dwHeight,
+		lpCtx->Glyphs.dwFallbacks, lpCtx->Glyphs.dwDrawn, lpCtx->Glyphs.dwBatches);
+	gldLogPrintf(GLDLOG_INFO, "Texture staging: %u sub-images staged, %u locked directly, %u level locks, %u dirty rects",
+		lpCtx->TexStaging.dwStaged, lpCtx->TexStaging.dwDirect, lpCtx->TexStaging.dwLocks, lpCtx->TexStaging.dwDirtyRects);
+	gldLogPrintf(GLDLOG_INFO, "Readback: %u reads, %u queued (%u stalled, %u dropped), %u left to D3DX",
+		lpCtx->Readback.dwReads, lpCtx->Readback.dwAsyncReads, lpCtx->Readback.dwStalls,
+		lpCtx->Readback.dwDropped, lpCtx->Readback.dwFallbacks);
+
 	// Release buffers used to build up and render primitives
 	_gldDestroyPrimitiveBuffer(lpCtx);
-
-	// Release vertex declaration
+	gldReleasePixelTexture(lpCtx);
+	gldReleaseGlyphs(lpCtx);
+	gldReleaseTexStaging(lpCtx);
+	gldReleaseCompressPool(lpCtx);
+	gldReleaseTextureResidency(lpCtx);
+	gldReleaseReadback(lpCtx);
+
+	// Release vertex declarations
 	SAFE_RELEASE(lpCtx->pVertDecl);
+	gldReleaseVertexFormats(lpCtx);
+
+	// Release the display list geometry heap
+	gldDestroyDListHeap(lpCtx);
 
 	// Hack for exiting DX9 D3D fullscreen page-flipping mode.
 	// Otherwise Quake3 crashes on exit. (DaveM)
@@ -788,13 +863,18 @@ BOOL gldDestroyDrawable_DX(
 
 	// Ensure device isn't holding onto any interfaces before we release it.
 	gldReleaseShaders(lpCtx);
+	gldLogDeviceStateStats(lpCtx);
 	_GLD_DX9_DEV(SetTexture(lpCtx->pDev, 0, NULL));
 	_GLD_DX9_DEV(SetTexture(lpCtx->pDev, 1, NULL));
 	_GLD_DX9_DEV(SetVertexShader(lpCtx->pDev, NULL));
 	_GLD_DX9_DEV(SetPixelShader(lpCtx->pDev, NULL));
 	_GLD_DX9_DEV(SetStreamSource(lpCtx->pDev, 0, NULL, 0, 0));
+	_GLD_DX9_DEV(SetIndices(lpCtx->pDev, NULL));
 	_GLD_DX9_DEV(SetVertexDeclaration(lpCtx->pDev, NULL));
 
+	gldStopStream(lpCtx->pDev);
+	gldStopProfiling();
+	gldStopRecording(lpCtx->pDev);
 	SAFE_RELEASE(lpCtx->pDev);
 	SAFE_RELEASE(lpCtx->pD3D);
 
@@ -979,7 +1059,7 @@ BOOL gldBuildPixelformatList_DX(void)
 	}
 
 	// Work out which D3D device we eant to test with
-	d3dDevType = (glb.dwDriver == GLDS_DRIVER_HAL) ? D3DDEVTYPE_HAL : D3DDEVTYPE_REF;
+	d3dDevType = GLD_DEVTYPE_DX9;
 
 	// Test for Lame device. This is as early as we dare test for this.
 	if (IsDX9DriverLame(pD3D, glb.dwAdapter, d3dDevType)) {
@@ -1002,7 +1082,7 @@ BOOL gldBuildPixelformatList_DX(void)
 		hr = IDirect3D9_CheckDeviceFormat(
 			pD3D,
 			glb.dwAdapter,
-			glb.dwDriver==GLDS_DRIVER_HAL ? D3DDEVTYPE_HAL : D3DDEVTYPE_REF,
+			d3dDevType,
             d3ddm.Format,
 			D3DUSAGE_DEPTHSTENCIL,
 			D3DRTYPE_SURFACE,
@@ -1015,7 +1095,7 @@ BOOL gldBuildPixelformatList_DX(void)
 	    hr = IDirect3D9_CheckDepthStencilMatch(
 				pD3D,
 				glb.dwAdapter,
-                glb.dwDriver==GLDS_DRIVER_HAL ? D3DDEVTYPE_HAL : D3DDEVTYPE_REF,
+                d3dDevType,
                 d3ddm.Format,
                 d3ddm.Format,
                 DepthStencil[i]);
@@ -1148,13 +1228,13 @@ BOOL gldInitialiseMesa_DX(
 	}
 	lpCtx->glCtx->Const.MaxTextureLevels = (TextureLevels) ? TextureLevels : 8;
 
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_LIGHTING, FALSE);
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_CULLMODE, D3DCULL_NONE);
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_DITHERENABLE, TRUE);
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_SHADEMODE, D3DSHADE_GOURAUD);
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_CLIPPING, TRUE); // KeithH
+	gldSetRenderState(gld, D3DRS_LIGHTING, FALSE);
+	gldSetRenderState(gld, D3DRS_CULLMODE, D3DCULL_NONE);
+	gldSetRenderState(gld, D3DRS_DITHERENABLE, TRUE);
+	gldSetRenderState(gld, D3DRS_SHADEMODE, D3DSHADE_GOURAUD);
+	gldSetRenderState(gld, D3DRS_CLIPPING, TRUE); // KeithH
 
-	IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_ZENABLE,
+	gldSetRenderState(gld, D3DRS_ZENABLE,
 		(lpCtx->lpPF->dwDriverData!=D3DFMT_UNKNOWN) ? D3DZB_TRUE : D3DZB_FALSE);
 
 	// Set the view matrix
@@ -1210,6 +1290,8 @@ BOOL gldSwapBuffers_DX(
 	if (gld == NULL)
 		return FALSE;
 
+	GLD_PROFILE_BEGIN(GLD_PROFILE_SWAP_BUFFERS);
+
 	// Flush any outstanding data
 	FLUSH_VERTICES(ctx->glCtx, 0);
 	// Ensure that scene variables are reset, regardless of whether Driver.FlushVertices is NULL.
@@ -1218,6 +1300,10 @@ BOOL gldSwapBuffers_DX(
 	ctx->glCtx->Driver.CurrentExecPrimitive = PRIM_OUTSIDE_BEGIN_END;
 	gld->GLReducedPrim	= PRIM_UNKNOWN;
 
+	// Profiler overlay (Ctrl+F11), over everything the app drew
+	if (glb.bProfileOverlay && ctx->bSceneStarted)
+		gldDrawProfileOverlay(ctx->glCtx);
+
 	// End any Effect currently set
 	gldEndEffect(gld, gld->iCurEffect);
 
@@ -1242,6 +1328,10 @@ BOOL gldSwapBuffers_DX(
 		}
 	}
 
+	// Per-frame effect parameter statistics
+	gldEndFrameShaderParams(gld);
+	gldEndFrameTextureResidency(gld);
+
 	IDirect3DDevice9_BeginScene(gld->pDev);
 	ctx->bSceneStarted = TRUE;
 
@@ -1254,6 +1344,9 @@ BOOL gldSwapBuffers_DX(
 	// Restart the current Effect
 	gldBeginEffect(gld, gld->iCurEffect);
 
+	GLD_PROFILE_END(GLD_PROFILE_SWAP_BUFFERS);
+	gldEndProfileFrame();
+
 	return (FAILED(hr)) ? FALSE : TRUE;
 }
 
@@ -59,7 +59,9 @@ void _mesa_update_state( GLcontext *ctx );
 void mesa_print_display_list( GLuint list );
 void _mesa_noop_vtxfmt_init( GLvertexformat *vfmt );
 
-void gldSaveFlushVertices(GLcontext *ctx);
+static void gldSaveFlushVertices(GLcontext *ctx);
+
+static void _gldDListHeapFree(GLD_driver_dx9 *gld, int iPage, IDirect3DVertexBuffer9 *pVB, DWORD dwStart, DWORD dwCount);
 
 //---------------------------------------------------------------------------
 // Display List defines
@@ -153,7 +155,13 @@ void gldSetStreamSource_Destroy(
 	GLcontext *ctx,
 	void *data)
 {
-	GLD_data_SetStreamSource *pStream = (GLD_data_SetStreamSource *)data;
+	GLD_context					*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9				*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_data_SetStreamSource	*pStream = (GLD_data_SetStreamSource *)data;
+
+	// Return the vertices to the geometry heap
+	if (gld && pStream->pVB && pStream->iHeapPage >= 0)
+		_gldDListHeapFree(gld, pStream->iHeapPage, pStream->pVB, pStream->BaseVertex, pStream->NumVertices);
 
 	// Release the D3D Vertex Buffer
 	SAFE_RELEASE(pStream->pVB);
@@ -167,7 +175,7 @@ void gldSetStreamSource_Print(
 {
 	GLD_data_SetStreamSource *pStream = (GLD_data_SetStreamSource *)data;
 
-	_mesa_printf("SetStreamSource dev=%x stream=%d VB=%x offset=%d stride=%d\n", pStream->pDevice, pStream->StreamNumber, pStream->pVB, pStream->OffsetInBytes, pStream->Stride);
+	_mesa_printf("SetStreamSource dev=%x stream=%d VB=%x offset=%d stride=%d page=%d base=%d verts=%d\n", pStream->pDevice, pStream->StreamNumber, pStream->pVB, pStream->OffsetInBytes, pStream->Stride, pStream->iHeapPage, pStream->BaseVertex, pStream->NumVertices);
 }
 
 //---------------------------------------------------------------------------
@@ -179,8 +187,9 @@ typedef struct {
 	IDirect3DDevice9		*pDevice;
 	D3DPRIMITIVETYPE		PrimitiveType;
 	UINT					StartVertex;
-	UINT					PrimitiveCount;
+	UINT					PrimitiveCount;		// Zero if merged into the previous draw
 	UINT					PointSize;
+	BOOL					bBindStream;		// FALSE if the previous draw left everything bound
 } GLD_data_DrawPrimitive;
 
 //---------------------------------------------------------------------------
@@ -195,18 +204,31 @@ void gldDrawPrimitive_Execute(
 	GLD_data_DrawPrimitive		*pDrawPrim	= (GLD_data_DrawPrimitive *)data;
 	GLD_data_SetStreamSource	*pStream	= (GLD_data_SetStreamSource *)&dl->CurrentStream;
 
-	_mesa_update_state(ctx);
+	// Merged into the previous draw by the optimiser
+	if (pDrawPrim->PrimitiveCount == 0)
+		return;
+
+	// Glyphs queued by earlier opcodes come first
+	if (gld->Glyphs.nQuads)
+		FLUSH_VERTICES(ctx, 0);
+
+	// Only revalidate if an earlier opcode changed something
+	if (ctx->NewState)
+		_mesa_update_state(ctx);
 
-	// Ensure the stream is set
-	IDirect3DDevice9_SetStreamSource(pStream->pDevice, pStream->StreamNumber, pStream->pVB, pStream->OffsetInBytes, pStream->Stride);
+	if (pDrawPrim->bBindStream) {
+		// Ensure the stream is set. Display lists always hold GLD_4D_VERTEX.
+		gldSetStreamSource(gld, pStream->pVB, pStream->OffsetInBytes, pStream->Stride);
+		gldSetVertexDeclaration(gld, gld->pVertDecl);
 
-	if (pDrawPrim->PrimitiveType == D3DPT_POINTLIST) {
-		IDirect3DDevice9_SetRenderState(pDrawPrim->pDevice, D3DRS_POINTSIZE, pDrawPrim->PointSize);
+		if (pDrawPrim->PrimitiveType == D3DPT_POINTLIST) {
+			gldSetRenderState(gld, D3DRS_POINTSIZE, pDrawPrim->PointSize);
+		}
 	}
 
 	// Execute the function
 	if (pDrawPrim->pDevice && pDrawPrim->PrimitiveCount) {
-		IDirect3DDevice9_DrawPrimitive(pDrawPrim->pDevice, pDrawPrim->PrimitiveType, pDrawPrim->StartVertex, pDrawPrim->PrimitiveCount);
+		IDirect3DDevice9_DrawPrimitive(pDrawPrim->pDevice, pDrawPrim->PrimitiveType, pStream->BaseVertex + pDrawPrim->StartVertex, pDrawPrim->PrimitiveCount);
 	} else {
 		//gldLogMessage(GLDLOG_ERROR, "DrawPrimitive_Execute: Bad device or PrimCount\n");
 	}
@@ -229,7 +251,7 @@ void gldDrawPrimitive_Print(
 {
 	GLD_data_DrawPrimitive *pDrawPrim = (GLD_data_DrawPrimitive *)data;
 	char szLine[1024];
-	sprintf(szLine, "DrawPrimitive dev=%x type=%d start=%d primcount=%d ptsize=%d\n", pDrawPrim->pDevice, pDrawPrim->PrimitiveType, pDrawPrim->StartVertex, pDrawPrim->PrimitiveCount, pDrawPrim->PointSize);
+	sprintf(szLine, "DrawPrimitive dev=%x type=%d start=%d primcount=%d ptsize=%d bind=%d\n", pDrawPrim->pDevice, pDrawPrim->PrimitiveType, pDrawPrim->StartVertex, pDrawPrim->PrimitiveCount, pDrawPrim->PointSize, pDrawPrim->bBindStream);
 	_mesa_printf(szLine);
 	gldLogMessage(GLDLOG_INFO, szLine);
 }
@@ -253,6 +275,238 @@ static void _gldEnlargeSavePrimitiveBuffer(
 #endif
 }
 
+//---------------------------------------------------------------------------
+// Geometry heap
+//---------------------------------------------------------------------------
+
+static BOOL _gldDListHeapCreatePage(
+	GLD_driver_dx9 *gld,
+	GLD_dlistHeapPage *pPage)
+{
+	HRESULT			hr;
+	DWORD			dwUsage;
+	GLD_dlistBlock	*pBlock;
+
+	// Static buffer, written once per list. Same usage as the old per-list VBs.
+	dwUsage = D3DUSAGE_WRITEONLY;
+	if (!gld->bHasHWTnL)
+		dwUsage	|= D3DUSAGE_SOFTWAREPROCESSING;
+
+	pBlock = (GLD_dlistBlock*)malloc(sizeof(GLD_dlistBlock));
+	if (pBlock == NULL)
+		return FALSE;
+
+	hr = IDirect3DDevice9_CreateVertexBuffer(
+		gld->pDev,
+		GLD_4D_VERTEX_SIZE * GLD_DLIST_HEAP_PAGE_VERTS,
+		dwUsage,
+		0, // Non-FVF buffer
+		D3DPOOL_MANAGED,
+		&pPage->pVB,
+		NULL);
+	if (FAILED(hr)) {
+		gldLogError(GLDLOG_WARN, "Display list heap: CreateVertexBuffer failed", hr);
+		pPage->pVB = NULL;
+		free(pBlock);
+		return FALSE;
+	}
+
+	// The whole page starts out free
+	pBlock->dwStart		= 0;
+	pBlock->dwCount		= GLD_DLIST_HEAP_PAGE_VERTS;
+	pBlock->pNext		= NULL;
+	pPage->pFree		= pBlock;
+	pPage->dwFreeVerts	= GLD_DLIST_HEAP_PAGE_VERTS;
+
+	gld->DListHeap.Stats.dwPages++;
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldDListHeapReleasePage(
+	GLD_dlistHeapPage *pPage)
+{
+	GLD_dlistBlock *pBlock, *pNext;
+
+	for (pBlock = pPage->pFree; pBlock; pBlock = pNext) {
+		pNext = pBlock->pNext;
+		free(pBlock);
+	}
+	pPage->pFree		= NULL;
+	pPage->dwFreeVerts	= 0;
+	SAFE_RELEASE(pPage->pVB);
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldDListHeapAllocFromPage(
+	GLD_dlistHeapPage *pPage,
+	DWORD dwCount,
+	DWORD *pdwStart)
+{
+	//
+	// First fit. Blocks are carved from the front so that a page fills
+	// from the start and the free space collects at the end.
+	//
+
+	GLD_dlistBlock	**ppBlock;
+	GLD_dlistBlock	*pBlock;
+
+	if (pPage->pVB == NULL || pPage->dwFreeVerts < dwCount)
+		return FALSE;
+
+	for (ppBlock = &pPage->pFree; *ppBlock; ppBlock = &(*ppBlock)->pNext) {
+		pBlock = *ppBlock;
+		if (pBlock->dwCount < dwCount)
+			continue;
+		*pdwStart			= pBlock->dwStart;
+		pBlock->dwStart		+= dwCount;
+		pBlock->dwCount		-= dwCount;
+		pPage->dwFreeVerts	-= dwCount;
+		if (pBlock->dwCount == 0) {
+			*ppBlock = pBlock->pNext;
+			free(pBlock);
+		}
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+//---------------------------------------------------------------------------
+
+static int _gldDListHeapAlloc(
+	GLD_driver_dx9 *gld,
+	DWORD dwCount,
+	DWORD *pdwStart)
+{
+	//
+	// Returns the page the block was allocated from, or -1 if the heap
+	// is full. The page last allocated from is tried first so that
+	// lists compiled together are played back from the same VB.
+	//
+
+	GLD_dlistHeap	*pHeap = &gld->DListHeap;
+	int				i;
+
+	if (dwCount == 0 || dwCount > GLD_DLIST_HEAP_PAGE_VERTS)
+		return -1;
+
+	i = pHeap->iCurPage;
+	if (i < 0 || i >= pHeap->nPages || !_gldDListHeapAllocFromPage(&pHeap->Pages[i], dwCount, pdwStart)) {
+		for (i=0; i<pHeap->nPages; i++) {
+			if (_gldDListHeapAllocFromPage(&pHeap->Pages[i], dwCount, pdwStart))
+				break;
+		}
+		if (i == pHeap->nPages) {
+			// Need a new page. Re-use a released slot if there is one.
+			for (i=0; i<pHeap->nPages; i++) {
+				if (pHeap->Pages[i].pVB == NULL)
+					break;
+			}
+			if (i == GLD_DLIST_HEAP_MAX_PAGES)
+				return -1;
+			if (!_gldDListHeapCreatePage(gld, &pHeap->Pages[i]))
+				return -1;
+			if (i == pHeap->nPages)
+				pHeap->nPages++;
+			_gldDListHeapAllocFromPage(&pHeap->Pages[i], dwCount, pdwStart);
+		}
+	}
+
+	pHeap->iCurPage = i;
+	pHeap->Stats.dwAllocs++;
+	pHeap->Stats.dwUsedVerts += dwCount;
+	if (pHeap->Stats.dwUsedVerts > pHeap->Stats.dwPeakVerts)
+		pHeap->Stats.dwPeakVerts = pHeap->Stats.dwUsedVerts;
+
+	return i;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldDListHeapFree(
+	GLD_driver_dx9 *gld,
+	int iPage,
+	IDirect3DVertexBuffer9 *pVB,
+	DWORD dwStart,
+	DWORD dwCount)
+{
+	GLD_dlistHeap		*pHeap = &gld->DListHeap;
+	GLD_dlistHeapPage	*pPage;
+	GLD_dlistBlock		*pPrev, *pNext, *pBlock;
+
+	// Ignore blocks from a heap that has since been destroyed
+	if (iPage >= pHeap->nPages || pHeap->Pages[iPage].pVB != pVB)
+		return;
+
+	pPage = &pHeap->Pages[iPage];
+
+	// Find the neighbouring free blocks
+	pPrev = NULL;
+	for (pNext = pPage->pFree; pNext && pNext->dwStart < dwStart; pNext = pNext->pNext)
+		pPrev = pNext;
+
+	if (pPrev && pPrev->dwStart + pPrev->dwCount == dwStart) {
+		// Grow the previous block, and absorb the next one if they now touch
+		pPrev->dwCount += dwCount;
+		if (pNext && pPrev->dwStart + pPrev->dwCount == pNext->dwStart) {
+			pPrev->dwCount	+= pNext->dwCount;
+			pPrev->pNext	= pNext->pNext;
+			free(pNext);
+		}
+	} else if (pNext && dwStart + dwCount == pNext->dwStart) {
+		// Grow the next block downwards
+		pNext->dwStart	= dwStart;
+		pNext->dwCount	+= dwCount;
+	} else {
+		pBlock = (GLD_dlistBlock*)malloc(sizeof(GLD_dlistBlock));
+		if (pBlock == NULL)
+			return; // Leak the space rather than fail
+		pBlock->dwStart	= dwStart;
+		pBlock->dwCount	= dwCount;
+		pBlock->pNext	= pNext;
+		if (pPrev)
+			pPrev->pNext = pBlock;
+		else
+			pPage->pFree = pBlock;
+	}
+
+	pPage->dwFreeVerts			+= dwCount;
+	pHeap->Stats.dwFrees++;
+	pHeap->Stats.dwUsedVerts	-= dwCount;
+
+	// Give back empty pages, but keep the one we're filling
+	if (pPage->dwFreeVerts == GLD_DLIST_HEAP_PAGE_VERTS && iPage != pHeap->iCurPage)
+		_gldDListHeapReleasePage(pPage);
+}
+
+//---------------------------------------------------------------------------
+
+void gldDestroyDListHeap(
+	GLD_driver_dx9 *gld)
+{
+	GLD_dlistHeap		*pHeap = &gld->DListHeap;
+	GLD_dlistHeapStats	*pStats = &pHeap->Stats;
+	int					i;
+
+	if (pStats->dwAllocs || pStats->dwPrivate)
+		gldLogPrintf(GLDLOG_INFO, "Display list heap: %lu pages, %lu allocs, %lu frees, %lu private VBs, peak %lu verts",
+			pStats->dwPages, pStats->dwAllocs, pStats->dwFrees, pStats->dwPrivate, pStats->dwPeakVerts);
+	if (gld->DList.dwOpcodesIn)
+		gldLogPrintf(GLDLOG_INFO, "Display list optimiser: %lu opcodes in, %lu out, %lu draws merged",
+			gld->DList.dwOpcodesIn, gld->DList.dwOpcodesOut, gld->DList.dwDrawsMerged);
+
+	// Lists still alive keep their own reference to the page VB
+	for (i=0; i<pHeap->nPages; i++)
+		_gldDListHeapReleasePage(&pHeap->Pages[i]);
+
+	ZeroMemory(pHeap, sizeof(*pHeap));
+	pHeap->iCurPage = -1;
+}
+
 //---------------------------------------------------------------------------
 // Stream Source Utils
 //---------------------------------------------------------------------------
@@ -268,6 +522,7 @@ void _gldCreateStreamSourceNode(
 	node = (GLD_data_SetStreamSource*)_mesa_alloc_instruction(ctx, dl->opSetStreamSource, sizeof(*node));
 
 	ZeroMemory(node, sizeof(*node));
+	node->iHeapPage = -1;
 
 	// Cache the pointer for future use
 	dl->pSetStreamSource = node;
@@ -285,51 +540,57 @@ static void gldFlushStreamSource(
 	HRESULT						hr;
 	IDirect3DVertexBuffer9		*pVB = NULL;
 	DWORD						dwUsage;
-	DWORD						dwPool;
 	GLD_4D_VERTEX				*LockPointer;	// Pointer to VB memory
 	DWORD						dwVBSize;
+	DWORD						dwBaseVert = 0;
+	int							iPage;
 	GLD_data_SetStreamSource	*n;
 
 	// Test to see if our Vertex Buffer has anything in it
 	if (dl->dwNextVBVert == 0)
 		return; // Nothing to do
 
-	// 1. Create a D3D Vertex Buffer
+	// 1. Allocate room in the geometry heap (or a private D3D Vertex Buffer)
 	// 2. copy vertices from our VB into it
 	// 3. fill in the current SetStreamSource opcode
 	// 4. create and insert a new SetStreamSource opcode
 
-	// This is a static buffer.
-	// We want the buffer in the best memory (vidmem->AGP->sysmem) and will lock only once.
-	dwUsage = D3DUSAGE_WRITEONLY;
-
-	// Add flag if no HW TnL
-	if (!gld->bHasHWTnL)
-		dwUsage	|= D3DUSAGE_SOFTWAREPROCESSING;
-
 	// Size of buffer, in bytes
 	dwVBSize = GLD_4D_VERTEX_SIZE * dl->dwNextVBVert;
 
-	// Hint to D3D as to where to put the buffer
-	dwPool = D3DPOOL_MANAGED;
-
-	// Create a D3D buffer
-	hr = IDirect3DDevice9_CreateVertexBuffer(
-		gld->pDev,
-		dwVBSize,
-		dwUsage,
-		0, // Non-FVF buffer
-		dwPool,
-		&pVB,
-		NULL);
-	if (FAILED(hr)) {
-		dl->dwNextVBVert = 0;
-		dl->dwFirstVBVert = 0;
-		return;
+	iPage = _gldDListHeapAlloc(gld, dl->dwNextVBVert, &dwBaseVert);
+	if (iPage >= 0) {
+		// The opcode holds its own reference to the shared VB
+		pVB = gld->DListHeap.Pages[iPage].pVB;
+		IDirect3DVertexBuffer9_AddRef(pVB);
+	} else {
+		// Heap is full. Fall back to a buffer of our own.
+		// We want the buffer in the best memory (vidmem->AGP->sysmem) and will lock only once.
+		dwUsage = D3DUSAGE_WRITEONLY;
+
+		// Add flag if no HW TnL
+		if (!gld->bHasHWTnL)
+			dwUsage	|= D3DUSAGE_SOFTWAREPROCESSING;
+
+		// Create a D3D buffer
+		hr = IDirect3DDevice9_CreateVertexBuffer(
+			gld->pDev,
+			dwVBSize,
+			dwUsage,
+			0, // Non-FVF buffer
+			D3DPOOL_MANAGED,
+			&pVB,
+			NULL);
+		if (FAILED(hr)) {
+			dl->dwNextVBVert = 0;
+			dl->dwFirstVBVert = 0;
+			return;
+		}
+		gld->DListHeap.Stats.dwPrivate++;
 	}
 
-	// Lock the entire buffer ready for filling
-	_GLD_DX9_VB(Lock(pVB, 0, 0, &LockPointer, 0));
+	// Lock just the block we're filling
+	_GLD_DX9_VB(Lock(pVB, dwBaseVert * GLD_4D_VERTEX_SIZE, dwVBSize, &LockPointer, 0));
 
 	// Copy our vertices into the D3D buffer
 	memcpy(LockPointer, dl->pVerts, dwVBSize);
@@ -345,8 +606,11 @@ static void gldFlushStreamSource(
 	n->pDevice			= gld->pDev;			// Pointer to D3D device.
 	n->StreamNumber		= 0;					// Stream number. Currently always zero.
 	n->pVB				= pVB;					// D3D Vertex Buffer pointer
-	n->OffsetInBytes	= 0;					// Offset. Currently always zero.
+	n->OffsetInBytes	= 0;					// Offset. Always zero; DrawPrimitive adds BaseVertex.
 	n->Stride			= GLD_4D_VERTEX_SIZE;	// Stride between each vertex in buffer
+	n->iHeapPage		= iPage;				// Heap page, or -1 for a private VB
+	n->BaseVertex		= dwBaseVert;			// First vertex of our block
+	n->NumVertices		= dl->dwNextVBVert;		// Size of our block
 
 	// Create and insert a new SetStreamSource opcode
 	_gldCreateStreamSourceNode(ctx, dl);
@@ -360,24 +624,6 @@ static void gldFlushStreamSource(
 // Save Begin/End
 //---------------------------------------------------------------------------
 
-static void gldSuperPrimitive(
-	GLcontext *ctx,
-	GLD_display_list *dl)
-{
-	// The current primitive is too big to fit into a our vertex buffer in one go.
-	// Split the primitive into manageable multiples.
-
-	// TODO: Actually put some real code in this function...
-	gldLogMessage(GLDLOG_SYSTEM, "~~ dlist: gldSuperPrimitive! ~~\n");
-
-	// Reset state before returning
-	dl->dwFirstVBVert	= dl->dwNextVBVert = 0;
-	dl->dwPrimVert	= 0;
-	ctx->Driver.SaveNeedFlush = 0;
-}
-
-//---------------------------------------------------------------------------
-
 static void GLAPIENTRY gld_save_Begin(
 	GLenum mode)
 {
@@ -403,9 +649,16 @@ static void GLAPIENTRY gld_save_Begin(
 
 //---------------------------------------------------------------------------
 
-static void GLAPIENTRY gld_save_End(void)
+static void _gldSaveEmitPrimitive(
+	GLcontext *ctx,
+	GLenum mode,
+	GLD_4D_VERTEX *pPrim,
+	int nPrimVerts)
 {
-	GET_CURRENT_CONTEXT(ctx);
+	//
+	// Copy a GL primitive of nPrimVerts vertices into the save VB as a D3D list.
+	//
+
 	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
 	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
 	GLD_display_list	*dl		= &gld->DList;
@@ -418,75 +671,67 @@ static void GLAPIENTRY gld_save_End(void)
 	int					j, count;
 	GLuint				parity;
 
-	if (ctx->Driver.CurrentSavePrimitive == PRIM_OUTSIDE_BEGIN_END) {
-		_mesa_error( ctx, GL_INVALID_OPERATION, "gld_save_End" );
-		goto gld_save_End_bail;
-	}
-
-	if (dl->dwPrimVert == 0)
-		goto gld_save_End_bail; // Nothing to do...
-
 	nGLPrimitives = nD3DPrimitives = nD3DVertices = 0;
 
 	// Calculate primitive count
-	switch (ctx->Driver.CurrentSavePrimitive) {
+	switch (mode) {
 	case GL_POINTS:
-		nGLPrimitives	= dl->dwPrimVert;
+		nGLPrimitives	= nPrimVerts;
 		nD3DPrimitives	= nGLPrimitives; // One vertex per point
 		nD3DVertices	= nD3DPrimitives; // One vertex per point
 		count			= nD3DVertices;
 		break;
 	case GL_LINES:
-		nGLPrimitives	= dl->dwPrimVert / 2;
+		nGLPrimitives	= nPrimVerts / 2;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 2; // Two vertices per line
 		count			= nD3DVertices;
 		break;
 	case GL_LINE_LOOP:
-		nGLPrimitives	= dl->dwPrimVert;
+		nGLPrimitives	= nPrimVerts;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 2; // Two vertices per line
 		count			= nD3DPrimitives;
 		break;
 	case GL_LINE_STRIP:
-		nGLPrimitives	= dl->dwPrimVert - 1;
+		nGLPrimitives	= nPrimVerts - 1;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 2; // Two vertices per line
 		count			= nD3DPrimitives;
 		break;
 	case GL_TRIANGLES:
-		nGLPrimitives	= dl->dwPrimVert / 3;
+		nGLPrimitives	= nPrimVerts / 3;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 3; // Three vertices per triangle
 		count			= nD3DVertices;
 		break;
 	case GL_TRIANGLE_STRIP:
-		nGLPrimitives	= dl->dwPrimVert - 2;
+		nGLPrimitives	= nPrimVerts - 2;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 3; // Three vertices per triangle
-		count			= dl->dwPrimVert;
+		count			= nPrimVerts;
 		break;
 	case GL_TRIANGLE_FAN:
-		nGLPrimitives	= dl->dwPrimVert - 2;
+		nGLPrimitives	= nPrimVerts - 2;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 3; // Three vertices per triangle
-		count			= dl->dwPrimVert;
+		count			= nPrimVerts;
 		break;
 	case GL_QUAD_STRIP:
-		nGLPrimitives	= (dl->dwPrimVert - 2) / 2;
+		nGLPrimitives	= (nPrimVerts - 2) / 2;
 		nD3DPrimitives	= nGLPrimitives * 2;
 		nD3DVertices	= nD3DPrimitives * 3; // Three vertices per triangle, two tris per quad
-		count			= dl->dwPrimVert;
+		count			= nPrimVerts;
 		break;
 	case GL_QUADS:
-		nGLPrimitives	= dl->dwPrimVert / 4;
+		nGLPrimitives	= nPrimVerts / 4;
 		nD3DPrimitives	= nGLPrimitives * 2;	// Two tris per quad
 		nD3DVertices	= nD3DPrimitives * 3;	// Three vertices per triangle, two tris per quad
-		count			= dl->dwPrimVert;
+		count			= nPrimVerts;
 		break;
 	case GL_POLYGON:
 		nGLPrimitives	= 1;
-		nD3DPrimitives	= dl->dwPrimVert - 2;	// Two tris per quad
+		nD3DPrimitives	= nPrimVerts - 2;	// Two tris per quad
 		nD3DVertices	= nD3DPrimitives * 3;	// Three vertices per triangle
 		count			= nD3DPrimitives;
 		break;
@@ -497,14 +742,14 @@ static void GLAPIENTRY gld_save_End(void)
 	// Test for invalid primitives
 	if ((nGLPrimitives <= 0) || (nD3DPrimitives <= 0) || (nD3DVertices <= 0)) {
 		// Bail if too few vertices
-		goto gld_save_End_bail;
+		return;
 	}
 
 	// Detect Super Primitives
 	if (nD3DVertices > dl->dwMaxVBVerts) {
-		// Huge primitive - pass off work to another function
-		gldSuperPrimitive(ctx, dl);
-		goto gld_save_End_bail;
+		// Huge primitive - split it into chunks that fit
+		gldSplitPrimitive(ctx, mode, pPrim, nPrimVerts, dl->dwMaxVBVerts, _gldSaveEmitPrimitive);
+		return;
 	}
 
 	// Determine whether there's enough room in the VB for the new vertices
@@ -516,14 +761,14 @@ static void GLAPIENTRY gld_save_End(void)
 	}
 
 	// Pointer to first vertex in primitive
-	pSrc = dl->pPrim;
+	pSrc = pPrim;
 
 	// Calculate where to start filling
 	pDst = &dl->pVerts[dl->dwNextVBVert];
 
 	// Put vertices into VB
 	// NOTE: Keep Provoking Vertex in mind! D3D takes flatshaded colour from 1st vertex in primitive
-	switch (ctx->Driver.CurrentSavePrimitive) {
+	switch (mode) {
 	case GL_POINTS:
 		// Straight one-to-one copy
 		memcpy(pDst, pSrc, GLD_4D_VERTEX_SIZE * nD3DVertices);
@@ -617,6 +862,26 @@ static void GLAPIENTRY gld_save_End(void)
 
 	// Notify a need to flush
 	ctx->Driver.SaveNeedFlush |= FLUSH_STORED_VERTICES;
+}
+
+//---------------------------------------------------------------------------
+
+static void GLAPIENTRY gld_save_End(void)
+{
+	GET_CURRENT_CONTEXT(ctx);
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_display_list	*dl		= &gld->DList;
+
+	if (ctx->Driver.CurrentSavePrimitive == PRIM_OUTSIDE_BEGIN_END) {
+		_mesa_error( ctx, GL_INVALID_OPERATION, "gld_save_End" );
+		goto gld_save_End_bail;
+	}
+
+	if (dl->dwPrimVert == 0)
+		goto gld_save_End_bail; // Nothing to do...
+
+	_gldSaveEmitPrimitive(ctx, ctx->Driver.CurrentSavePrimitive, dl->pPrim, dl->dwPrimVert);
 
 gld_save_End_bail:
 	// Prepare for next primitive
@@ -1322,12 +1587,110 @@ static void gldSaveFlushVertices(
 		n->StartVertex		= dl->dwFirstVBVert;
 		n->PrimitiveCount	= nPrimitives;
 		n->PointSize		= PointSize;
+		n->bBindStream		= TRUE;
 	}
 
 	dl->dwFirstVBVert			= dl->dwNextVBVert;
 	ctx->Driver.SaveNeedFlush	= 0;
 }
 
+//---------------------------------------------------------------------------
+// List optimiser
+//---------------------------------------------------------------------------
+
+static UINT _gldPrimitiveVerts(
+	D3DPRIMITIVETYPE d3dpt,
+	UINT nPrimitives)
+{
+	// Display lists only hold list primitives
+	switch (d3dpt) {
+	case D3DPT_LINELIST:		return nPrimitives * 2;
+	case D3DPT_TRIANGLELIST:	return nPrimitives * 3;
+	default:					return nPrimitives;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldOptimiseList(
+	GLcontext *ctx,
+	GLD_display_list *dl)
+{
+	//
+	// Runs once a list has been ended. Mesa's own opcodes may change any
+	// state, so only runs of our opcodes with nothing in between are
+	// touched:
+	// - a draw from the same VB, with the same primitive type and point
+	//   size as the previous draw, doesn't need the stream re-bound.
+	// - if its vertices also follow on from the previous draw, it is
+	//   folded into that draw and left with a zero primitive count.
+	//
+
+	GLD_context					*gldCtx		= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9				*gld		= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_data_SetStreamSource	*pStream	= NULL;	// Current stream
+	GLD_data_SetStreamSource	*pPrevStream = NULL;	// Stream of pPrev
+	GLD_data_DrawPrimitive		*pPrev		= NULL;	// Previous draw, if nothing came between
+	GLD_data_DrawPrimitive		*pDraw;
+	void						*data;
+	GLint						opcode;
+	DWORD						dwIn		= 0;
+	DWORD						dwOut		= 0;
+
+	for (data = _mesa_next_list_instruction(ctx, dl->List, NULL, &opcode); data;
+		 data = _mesa_next_list_instruction(ctx, dl->List, data, &opcode))
+	{
+		dwIn++;
+
+		if (opcode == dl->opSetStreamSource) {
+			// Only changes which vertices the next draw uses
+			pStream = (GLD_data_SetStreamSource*)data;
+			dwOut++;
+			continue;
+		}
+
+		if (opcode != dl->opDrawPrimitive) {
+			// May change state, or draw through the immediate mode VB
+			pPrev = NULL;
+			dwOut++;
+			continue;
+		}
+
+		pDraw = (GLD_data_DrawPrimitive*)data;
+		if (pDraw->PrimitiveCount == 0)
+			continue;
+
+		if (pPrev && pPrevStream && pStream && pStream->pVB && pStream->pVB == pPrevStream->pVB &&
+			pDraw->PrimitiveType == pPrev->PrimitiveType &&
+			pDraw->PointSize == pPrev->PointSize)
+		{
+			pDraw->bBindStream = FALSE;
+
+			if (pPrevStream->BaseVertex + pPrev->StartVertex + _gldPrimitiveVerts(pPrev->PrimitiveType, pPrev->PrimitiveCount) ==
+				pStream->BaseVertex + pDraw->StartVertex &&
+				pPrev->PrimitiveCount + pDraw->PrimitiveCount <= gld->d3dCaps9.MaxPrimitiveCount)
+			{
+				pPrev->PrimitiveCount	+= pDraw->PrimitiveCount;
+				pDraw->PrimitiveCount	= 0;
+				dl->dwDrawsMerged++;
+				continue;
+			}
+		}
+
+		pPrev		= pDraw;
+		pPrevStream	= pStream;
+		dwOut++;
+	}
+
+	dl->dwOpcodesIn		+= dwIn;
+	dl->dwOpcodesOut	+= dwOut;
+
+#ifdef DEBUG
+	if (dwIn != dwOut)
+		gldLogPrintf(GLDLOG_SYSTEM, "** List %d optimised: %lu opcodes -> %lu **", dl->List, dwIn, dwOut);
+#endif
+}
+
 //---------------------------------------------------------------------------
 // GLD5 display list support
 //---------------------------------------------------------------------------
@@ -1361,6 +1724,9 @@ static void gldNewList(
 	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
 	GLD_display_list	*dl		= &gld->DList;
 
+	// Remember the list for the optimiser; Mesa forgets it before EndList
+	dl->List				= list;
+
 	// Create buffer to hold primitives (data between glBegin and glEnd).
 	// This buffer will be enlarged as required
 	dl->dwMaxPrimVerts		= 0;
@@ -1394,6 +1760,9 @@ static void gldEndList(
 	// Save any outstanding vertices to the display list
 	gldFlushStreamSource(ctx);
 
+	// Tidy up the finished list
+	_gldOptimiseList(ctx, dl);
+
 	// Delete our Vertex Buffer
 	SAFE_FREE(dl->pVerts);
 	dl->dwMaxVBVerts	= 0;
@@ -1411,11 +1780,8 @@ static void gldEndList(
 static void gldEndCallList(
 	GLcontext *ctx)
 {
-	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
-	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
-
-	// Reset the stream source
-	_GLD_DX9_DEV(SetStreamSource(gld->pDev, 0, gld->pVB, 0, GLD_4D_VERTEX_SIZE));
+	// Nothing to do. d3dFlushVertices() binds its own stream before drawing,
+	// so leaving the list's VB bound lets the next list skip the re-bind.
 }
 
 //---------------------------------------------------------------------------
@@ -1521,6 +1887,10 @@ BOOL _gld_install_save_vtxfmt(
 	ctx->Driver.NotifySaveBegin		= gldNotifySaveBegin;
 	ctx->Driver.SaveFlushVertices	= gldSaveFlushVertices;
 
+	// Compile glBitmap glyphs into the glyph atlas
+	if (!glb.bUseMesaDisplayLists && !gldInstallGlyphs(ctx))
+		gldLogMessage(GLDLOG_WARN, "Glyph atlas unavailable; using Mesa glBitmap lists\n");
+
 	return TRUE;
 }
 
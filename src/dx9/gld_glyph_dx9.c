@@ -0,0 +1,599 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Glyph atlas. glBitmap calls compiled into display lists,
+*               such as the lists built by wglUseFontBitmaps, are packed
+*               into one alpha texture. Calling the lists queues textured
+*               quads, so a glCallLists string is drawn in a single batch.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+#include <d3dx9tex.h>
+
+#include "glheader.h"
+#include "context.h"
+#include "dlist.h"
+#include "image.h"
+#include "imports.h"
+#include "macros.h"
+#include "mtypes.h"
+
+void _mesa_update_state( GLcontext *ctx );
+
+//---------------------------------------------------------------------------
+
+#define _GLD_FVF_GLYPH	(D3DFVF_XYZRHW | D3DFVF_DIFFUSE | D3DFVF_TEX1)
+
+// Gap left around each glyph so point sampling never picks up a neighbour
+#define GLD_GLYPH_PAD	1
+
+// Source of GLD_glyphCache.dwAtlasId. A driver freed and reallocated at the
+// same address still gets a new id, so its glyphs cannot be mistaken.
+static LONG lGlyphAtlasIds = 0;
+
+//---------------------------------------------------------------------------
+// Display List Opcode: Glyph
+//---------------------------------------------------------------------------
+
+typedef struct {
+	DWORD				dwAtlasId;		// Atlas that holds the glyph
+	GLsizei				width;			// Zero if the bitmap only moves the raster position
+	GLsizei				height;
+	GLfloat				xorig, yorig;
+	GLfloat				xmove, ymove;
+	WORD				x, y;			// Position in the atlas
+	GLubyte				*pBitmap;		// Unpacked bits, for when the atlas cannot be used
+} GLD_data_Glyph;
+
+//---------------------------------------------------------------------------
+// Atlas
+//---------------------------------------------------------------------------
+
+static BOOL _gldCreateGlyphAtlas(
+	GLD_driver_dx9 *gld,
+	DWORD dwHeight)
+{
+	//
+	// (Re)create the atlas texture at the given height and fill it from
+	// the shadow copy. The old texture is kept if this fails.
+	//
+
+	GLD_glyphCache		*pGC = &gld->Glyphs;
+	IDirect3DTexture9	*pTex;
+	IDirect3DSurface9	*pSurface;
+	BYTE				*pShadow;
+	RECT				rcSrc;
+	HRESULT				hr;
+
+	pShadow = (BYTE*)realloc(pGC->pShadow, pGC->dwWidth * dwHeight);
+	if (pShadow == NULL)
+		return FALSE;
+	pGC->pShadow = pShadow;
+	ZeroMemory(pShadow + pGC->dwWidth * pGC->dwHeight, pGC->dwWidth * (dwHeight - pGC->dwHeight));
+
+	// D3DX picks the nearest supported format if A8 is not available
+	hr = D3DXCreateTexture(
+		gld->pDev,
+		pGC->dwWidth,
+		dwHeight,
+		1,				// miplevels
+		0,				// Usage
+		D3DFMT_A8,
+		D3DPOOL_MANAGED,
+		&pTex);
+	if (FAILED(hr)) {
+		gldLogError(GLDLOG_WARN, "CreateTexture for glyph atlas failed", hr);
+		return FALSE;
+	}
+
+	IDirect3DTexture9_GetSurfaceLevel(pTex, 0, &pSurface);
+	SetRect(&rcSrc, 0, 0, pGC->dwWidth, dwHeight);
+	D3DXLoadSurfaceFromMemory(
+		pSurface,
+		NULL,
+		NULL,
+		pShadow,
+		D3DFMT_A8,
+		pGC->dwWidth,
+		NULL,
+		&rcSrc,
+		D3DX_FILTER_NONE,
+		0);
+	IDirect3DSurface9_Release(pSurface);
+
+	SAFE_RELEASE(pGC->pTex);
+	pGC->pTex		= pTex;
+	pGC->dwHeight	= dwHeight;
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldPlaceGlyph(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLsizei width,
+	GLsizei height,
+	WORD *pX,
+	WORD *pY)
+{
+	//
+	// Find room for a glyph with simple shelf packing. Font glyphs are
+	// all much the same height, so little space is wasted.
+	//
+
+	GLD_glyphCache	*pGC = &gld->Glyphs;
+	DWORD			dwWidth		= width + GLD_GLYPH_PAD;
+	DWORD			dwHeight	= height + GLD_GLYPH_PAD;
+	DWORD			dwNewHeight;
+
+	if (pGC->pTex == NULL) {
+		pGC->dwWidth		= min(GLD_GLYPH_ATLAS_WIDTH, gld->d3dCaps9.MaxTextureWidth);
+		pGC->dwMaxHeight	= min(GLD_GLYPH_ATLAS_MAX_HEIGHT, gld->d3dCaps9.MaxTextureHeight);
+		dwNewHeight			= GLD_GLYPH_ATLAS_MIN_HEIGHT;
+		if (gld->d3dCaps9.TextureCaps & D3DPTEXTURECAPS_SQUAREONLY)
+			dwNewHeight = pGC->dwMaxHeight = pGC->dwWidth;
+		pGC->dwHeight = 0;
+		if (!_gldCreateGlyphAtlas(gld, dwNewHeight))
+			return FALSE;
+	}
+
+	if (dwWidth > pGC->dwWidth)
+		return FALSE;
+
+	// Open a new shelf if the glyph does not fit on the current one
+	if (pGC->dwShelfX + dwWidth > pGC->dwWidth) {
+		pGC->dwShelfY		+= pGC->dwShelfHeight;
+		pGC->dwShelfX		= 0;
+		pGC->dwShelfHeight	= 0;
+	}
+
+	// Grow the atlas downwards if the shelf runs off the bottom
+	if (pGC->dwShelfY + dwHeight > pGC->dwHeight) {
+		dwNewHeight = pGC->dwHeight;
+		while ((dwNewHeight < pGC->dwShelfY + dwHeight) && (dwNewHeight < pGC->dwMaxHeight))
+			dwNewHeight <<= 1;
+		if (pGC->dwShelfY + dwHeight > dwNewHeight)
+			return FALSE; // Full
+		// Queued quads have texcoords for the old height
+		if (pGC->nQuads)
+			gldFlushGlyphs(ctx);
+		if (!_gldCreateGlyphAtlas(gld, dwNewHeight))
+			return FALSE;
+	}
+
+	*pX = (WORD)pGC->dwShelfX;
+	*pY = (WORD)pGC->dwShelfY;
+	pGC->dwShelfX		+= dwWidth;
+	pGC->dwShelfHeight	= max(pGC->dwShelfHeight, dwHeight);
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldStoreGlyph(
+	GLD_driver_dx9 *gld,
+	const GLubyte *pBitmap,
+	GLsizei width,
+	GLsizei height,
+	WORD x,
+	WORD y)
+{
+	//
+	// Expand the bits into the shadow copy as 0/255 alpha and upload the
+	// glyph's rectangle. Atlas rows run bottom-up, like the bitmap.
+	//
+
+	GLD_glyphCache		*pGC = &gld->Glyphs;
+	IDirect3DSurface9	*pSurface;
+	RECT				rc;
+	const GLubyte		*src;
+	BYTE				*pDst;
+	int					i, j;
+
+	for (i=0; i<height; i++) {
+		src = (const GLubyte *) _mesa_image_address(
+			&_mesa_native_packing, pBitmap, width, height, GL_COLOR_INDEX, GL_BITMAP,
+			0, i, 0);
+		pDst = pGC->pShadow + (y + i) * pGC->dwWidth + x;
+		for (j=0; j<width; j++)
+			pDst[j] = (src[j >> 3] & (128 >> (j & 7))) ? 0xFF : 0x00;
+	}
+
+	IDirect3DTexture9_GetSurfaceLevel(pGC->pTex, 0, &pSurface);
+	SetRect(&rc, x, y, x + width, y + height);
+	D3DXLoadSurfaceFromMemory(
+		pSurface,
+		NULL,
+		&rc,
+		pGC->pShadow,
+		D3DFMT_A8,
+		pGC->dwWidth,
+		NULL,
+		&rc,
+		D3DX_FILTER_NONE,
+		0);
+	IDirect3DSurface9_Release(pSurface);
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldAllocGlyphBatch(
+	GLD_glyphCache *pGC)
+{
+	WORD	*pIdx;
+	int		i;
+
+	pGC->pVerts		= (GLD_GLYPH_VERTEX*)malloc(GLD_GLYPH_BATCH_QUADS * 4 * sizeof(GLD_GLYPH_VERTEX));
+	pGC->pIndices	= (WORD*)malloc(GLD_GLYPH_BATCH_QUADS * 6 * sizeof(WORD));
+	if ((pGC->pVerts == NULL) || (pGC->pIndices == NULL)) {
+		SAFE_FREE(pGC->pVerts);
+		SAFE_FREE(pGC->pIndices);
+		return FALSE;
+	}
+
+	// Quads are emitted 0-1-2-3 counter-clockwise from bottom-left
+	for (i=0, pIdx=pGC->pIndices; i<GLD_GLYPH_BATCH_QUADS; i++, pIdx+=6) {
+		pIdx[0] = i*4 + 0;	pIdx[1] = i*4 + 1;	pIdx[2] = i*4 + 2;
+		pIdx[3] = i*4 + 0;	pIdx[4] = i*4 + 2;	pIdx[5] = i*4 + 3;
+	}
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldFlushGlyphs(
+	GLcontext *ctx)
+{
+	//
+	// Draw the queued glyph quads in one call. State is set up the same
+	// way as for glBitmap images; Mesa re-applies the GL state afterwards.
+	//
+
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_glyphCache		*pGC	= &gld->Glyphs;
+
+	if (pGC->nQuads == 0)
+		return;
+
+	gldSetTexture(gld, 0, (IDirect3DBaseTexture9*)pGC->pTex);
+	gldSetRenderState(gld, D3DRS_CULLMODE, D3DCULL_NONE);
+	gldSetRenderState(gld, D3DRS_CLIPPING, TRUE);
+
+	gldSetSamplerState(gld, 0, D3DSAMP_MINFILTER, D3DTEXF_POINT);
+	gldSetSamplerState(gld, 0, D3DSAMP_MIPFILTER, D3DTEXF_NONE);
+	gldSetSamplerState(gld, 0, D3DSAMP_MAGFILTER, D3DTEXF_POINT);
+	gldSetSamplerState(gld, 0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP);
+	gldSetSamplerState(gld, 0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP);
+
+	// Colour comes from the raster colour, coverage from the atlas
+	gldSetTextureStageState(gld, 0, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
+	gldSetTextureStageState(gld, 0, D3DTSS_ALPHAOP, D3DTOP_SELECTARG1);
+	gldSetTextureStageState(gld, 0, D3DTSS_COLORARG1, D3DTA_DIFFUSE);
+	gldSetTextureStageState(gld, 0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
+	gldSetTextureStageState(gld, 1, D3DTSS_COLOROP, D3DTOP_DISABLE);
+	gldSetTextureStageState(gld, 1, D3DTSS_ALPHAOP, D3DTOP_DISABLE);
+
+	// End current Effect
+	gldEndEffect(gld, gld->iCurEffect);
+
+	gldSetVertexShader(gld, NULL);
+	gldSetPixelShader(gld, NULL);
+	gldSetFVF(gld, _GLD_FVF_GLYPH);
+
+	// Clear bits are not drawn; as for glBitmap images
+	gldSetRenderState(gld, D3DRS_ALPHATESTENABLE, TRUE);
+	gldSetRenderState(gld, D3DRS_ALPHAFUNC, D3DCMP_GREATER);
+	gldSetRenderState(gld, D3DRS_ALPHAREF, 0x7f);
+
+	_GLD_DX9_DEV(DrawIndexedPrimitiveUP(
+		gld->pDev,
+		D3DPT_TRIANGLELIST,
+		0,
+		pGC->nQuads * 4,
+		pGC->nQuads * 2,
+		pGC->pIndices,
+		D3DFMT_INDEX16,
+		pGC->pVerts,
+		sizeof(GLD_GLYPH_VERTEX)));
+	// DrawIndexedPrimitiveUP() leaves stream 0 and the indices unset
+	gld->DevState.bVBValid = FALSE;
+	gld->DevState.bIBValid = FALSE;
+
+	gldSetTexture(gld, 0, NULL);
+
+	pGC->dwDrawn += pGC->nQuads;
+	pGC->dwBatches++;
+	pGC->nQuads = 0;
+
+	// Reset state to before we messed it up. This can be called from
+	// FlushVertices, so mark the state directly rather than flushing.
+	ctx->NewState |= _NEW_ALL;
+
+	// Start the current Effect
+	gldBeginEffect(gld, gld->iCurEffect);
+
+	// Restore stream to before we messed it up.
+	gldSetStreamSource(gld, gld->pVB, 0, GLD_4D_VERTEX_SIZE);
+	gldSetVertexDeclaration(gld, gld->pVertDecl);
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldQueueGlyph(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLD_data_Glyph *pGlyph,
+	GLint x,
+	GLint y)
+{
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_glyphCache		*pGC	= &gld->Glyphs;
+	GLD_GLYPH_VERTEX	*v;
+	D3DCOLOR			dwColor;
+	FLOAT				x0, y0, x1, y1;
+	FLOAT				u0, v0, u1, v1;
+
+	// Vertices already in the VB were issued before this glyph
+	if (gld->dwNextVBVert != gld->dwFirstVBVert)
+		FLUSH_VERTICES(ctx, 0);
+	if (pGC->nQuads >= GLD_GLYPH_BATCH_QUADS)
+		gldFlushGlyphs(ctx);
+
+	if (ctx->NewState)
+		_mesa_update_state(ctx);
+
+	dwColor = D3DCOLOR_COLORVALUE(
+		ctx->Current.RasterColor[0],
+		ctx->Current.RasterColor[1],
+		ctx->Current.RasterColor[2],
+		1.0f);
+
+	// Window rectangle, shifted by half a pixel so texels land on pixels
+	x0 = (FLOAT)x - 0.5f;
+	x1 = x0 + pGlyph->width;
+	y0 = (FLOAT)gldCtx->dwHeight - y - 0.5f;		// Bottom edge
+	y1 = y0 - pGlyph->height;						// Top edge
+
+	u0 = (FLOAT)pGlyph->x / pGC->dwWidth;
+	u1 = (FLOAT)(pGlyph->x + pGlyph->width) / pGC->dwWidth;
+	v0 = (FLOAT)pGlyph->y / pGC->dwHeight;
+	v1 = (FLOAT)(pGlyph->y + pGlyph->height) / pGC->dwHeight;
+
+	//
+	// 3--2
+	// |  |
+	// 0--1
+	//
+	v = &pGC->pVerts[pGC->nQuads * 4];
+	v[0].x = x0;	v[0].y = y0;	v[0].tu = u0;	v[0].tv = v0;
+	v[1].x = x1;	v[1].y = y0;	v[1].tu = u1;	v[1].tv = v0;
+	v[2].x = x1;	v[2].y = y1;	v[2].tu = u1;	v[2].tv = v1;
+	v[3].x = x0;	v[3].y = y1;	v[3].tu = u0;	v[3].tv = v1;
+	v[0].z = v[1].z = v[2].z = v[3].z = ctx->Current.RasterPos[2];
+	v[0].rhw = v[1].rhw = v[2].rhw = v[3].rhw = 1.0f;
+	v[0].color = v[1].color = v[2].color = v[3].color = dwColor;
+	pGC->nQuads++;
+
+	// Anything else that draws has to flush the batch first. A reduced
+	// primitive that matches nothing makes glBegin and the array paths do so.
+	gld->GLReducedPrim		= PRIM_UNKNOWN;
+	ctx->Driver.NeedFlush	|= FLUSH_STORED_VERTICES;
+}
+
+//---------------------------------------------------------------------------
+
+static void gldGlyph_Execute(
+	GLcontext *ctx,
+	void *data)
+{
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_data_Glyph		*pGlyph	= (GLD_data_Glyph *)data;
+
+	if ((pGlyph->dwAtlasId != gld->Glyphs.dwAtlasId) || (pGlyph->pBitmap && (gld->Glyphs.pTex == NULL)) ||
+		(ctx->RenderMode != GL_RENDER) ||
+		(ctx->Driver.CurrentExecPrimitive != PRIM_OUTSIDE_BEGIN_END))
+	{
+		// Same as Mesa's OPCODE_BITMAP; this also reports any errors
+		const struct gl_pixelstore_attrib save = ctx->Unpack;
+		ctx->Unpack = _mesa_native_packing;
+		(*ctx->Exec->Bitmap)(pGlyph->width, pGlyph->height,
+			pGlyph->xorig, pGlyph->yorig, pGlyph->xmove, pGlyph->ymove, pGlyph->pBitmap);
+		ctx->Unpack = save;
+		return;
+	}
+
+	if (!ctx->Current.RasterPosValid)
+		return; // do nothing
+
+	if (pGlyph->pBitmap) {
+		// Truncate, as _mesa_Bitmap() does
+		_gldQueueGlyph(ctx, gld, pGlyph,
+			IFLOOR(ctx->Current.RasterPos[0] - pGlyph->xorig),
+			IFLOOR(ctx->Current.RasterPos[1] - pGlyph->yorig));
+		ctx->OcclusionResult = GL_TRUE;
+	}
+
+	ctx->Current.RasterPos[0] += pGlyph->xmove;
+	ctx->Current.RasterPos[1] += pGlyph->ymove;
+}
+
+//---------------------------------------------------------------------------
+
+static void gldGlyph_Destroy(
+	GLcontext *ctx,
+	void *data)
+{
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_data_Glyph		*pGlyph	= (GLD_data_Glyph *)data;
+	GLD_glyphCache		*pGC;
+
+	if (pGlyph->pBitmap && gld && (pGlyph->dwAtlasId == gld->Glyphs.dwAtlasId)) {
+		// Once every glyph is gone the atlas can be packed from the top again
+		pGC = &gld->Glyphs;
+		if (pGC->dwLive && (--pGC->dwLive == 0)) {
+			pGC->dwShelfX = pGC->dwShelfY = pGC->dwShelfHeight = 0;
+		}
+	}
+	if (pGlyph->pBitmap)
+		FREE(pGlyph->pBitmap);
+}
+
+//---------------------------------------------------------------------------
+
+static void gldGlyph_Print(
+	GLcontext *ctx,
+	void *data)
+{
+	GLD_data_Glyph *pGlyph = (GLD_data_Glyph *)data;
+
+	_mesa_printf("Glyph %d x %d orig=%g,%g move=%g,%g atlas=%d,%d\n", pGlyph->width, pGlyph->height, pGlyph->xorig, pGlyph->yorig, pGlyph->xmove, pGlyph->ymove, pGlyph->x, pGlyph->y);
+}
+
+//---------------------------------------------------------------------------
+// Save function
+//---------------------------------------------------------------------------
+
+static void GLAPIENTRY gld_save_Bitmap(
+	GLsizei width,
+	GLsizei height,
+	GLfloat xorig,
+	GLfloat yorig,
+	GLfloat xmove,
+	GLfloat ymove,
+	const GLubyte *pixels)
+{
+	GET_CURRENT_CONTEXT(ctx);
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_display_list	*dl		= &gld->DList;
+	GLD_glyphCache		*pGC	= &gld->Glyphs;
+	GLD_data_Glyph		*n;
+	GLubyte				*pBitmap = NULL;
+	WORD				x = 0, y = 0;
+
+	// Errors, big images and bitmaps inside glBegin/glEnd are Mesa's
+	if ((width < 0) || (height < 0) ||
+		(width > GLD_GLYPH_MAX_SIZE) || (height > GLD_GLYPH_MAX_SIZE) ||
+		(ctx->Driver.CurrentSavePrimitive <= GL_POLYGON))
+	{
+		pGC->SaveBitmap(width, height, xorig, yorig, xmove, ymove, pixels);
+		return;
+	}
+
+	// A NULL or empty bitmap only moves the raster position
+	if (pixels && width && height) {
+		pBitmap = (GLubyte*)_mesa_unpack_bitmap(width, height, pixels, &ctx->Unpack);
+		if ((pBitmap == NULL) || !_gldPlaceGlyph(ctx, gld, width, height, &x, &y)) {
+			if (pBitmap)
+				FREE(pBitmap);
+			pGC->dwFallbacks++;
+			pGC->SaveBitmap(width, height, xorig, yorig, xmove, ymove, pixels);
+			return;
+		}
+		_gldStoreGlyph(gld, pBitmap, width, height, x, y);
+		pGC->dwCompiled++;
+		pGC->dwLive++;
+	}
+
+	if (ctx->Driver.SaveNeedFlush)
+		ctx->Driver.SaveFlushVertices(ctx);
+
+	n = (GLD_data_Glyph*)_mesa_alloc_instruction(ctx, dl->opGlyph, sizeof(*n));
+	if (n) {
+		n->dwAtlasId	= pGC->dwAtlasId;
+		n->width		= pBitmap ? width : 0;
+		n->height		= pBitmap ? height : 0;
+		n->xorig		= xorig;
+		n->yorig		= yorig;
+		n->xmove		= xmove;
+		n->ymove		= ymove;
+		n->x			= x;
+		n->y			= y;
+		n->pBitmap		= pBitmap;
+	} else if (pBitmap) {
+		FREE(pBitmap);
+		pGC->dwLive--;
+	}
+
+	if (ctx->ExecuteFlag) {
+		(*ctx->Exec->Bitmap)(width, height, xorig, yorig, xmove, ymove, pixels);
+	}
+}
+
+//---------------------------------------------------------------------------
+
+BOOL gldInstallGlyphs(
+	GLcontext *ctx)
+{
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_display_list	*dl		= &gld->DList;
+	GLD_glyphCache		*pGC	= &gld->Glyphs;
+
+	dl->opGlyph = _mesa_alloc_opcode(ctx, sizeof(GLD_data_Glyph), gldGlyph_Execute, gldGlyph_Destroy, gldGlyph_Print);
+	if (dl->opGlyph == -1)
+		return FALSE;
+
+	if (!_gldAllocGlyphBatch(pGC))
+		return FALSE;
+	pGC->dwAtlasId = (DWORD)InterlockedIncrement(&lGlyphAtlasIds);
+
+	// glBitmap is not part of the vertex format, so hook the save table directly
+	pGC->SaveBitmap		= ctx->Save->Bitmap;
+	ctx->Save->Bitmap	= gld_save_Bitmap;
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldReleaseGlyphs(
+	GLD_driver_dx9 *gld)
+{
+	GLD_glyphCache *pGC = &gld->Glyphs;
+
+	SAFE_RELEASE(pGC->pTex);
+	SAFE_FREE(pGC->pShadow);
+	SAFE_FREE(pGC->pVerts);
+	SAFE_FREE(pGC->pIndices);
+	pGC->nQuads = 0;
+	// Glyphs compiled against this atlas fall back to Mesa from now on
+	pGC->dwAtlasId = 0;
+}
+
+//---------------------------------------------------------------------------
@@ -0,0 +1,561 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  CPU profiler. Times the driver's hot paths with the TSC,
+*               keeps the last frames for an overlay drawn at SwapBuffers,
+*               and writes a Chrome trace (chrome://tracing) to
+*               gldprofile.json.
+*
+*********************************************************************************/
+
+#include <intrin.h>
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+//---------------------------------------------------------------------------
+// Each thread that enters a scope gets its own block, found through TLS,
+// so timing a scope takes no lock. A block holds a ring of the last
+// scopes it closed, for the trace, and the scope totals of the current
+// frame, which the thread that calls SwapBuffers adds to the frame ring.
+// The trace reads the other threads' rings without stopping them, so an
+// event being written while the trace is dumped may come out garbled.
+//
+// Threads can outlive the device (and the profiler), so the blocks are
+// kept for the life of the process.
+//---------------------------------------------------------------------------
+
+#define GLD_PROFILE_MAX_THREADS		32
+#define GLD_PROFILE_MAX_DEPTH		16
+#define GLD_PROFILE_EVENTS			32768	// Per thread. Must be a power of two.
+#define GLD_PROFILE_FRAMES			1024	// Must be a power of two.
+
+// Overlay layout
+#define GLD_OVL_WIDTH				256
+#define GLD_OVL_ROW					12
+#define GLD_OVL_BAR_X				14
+#define GLD_OVL_BAR_WIDTH			160
+#define GLD_OVL_TEXT_X				184
+#define GLD_OVL_GRAPH				48
+#define GLD_OVL_HEIGHT				(2 + (GLD_PROFILE_SCOPES + 2) * GLD_OVL_ROW + GLD_OVL_GRAPH + 2)
+#define GLD_OVL_BUDGET_US			16667	// Full bar, and half the graph height
+
+typedef struct {
+	ULONGLONG			qStart;			// TSC at entry
+	DWORD				dwTicks;		// TSC ticks inside, clamped to 32 bits
+	WORD				wScope;
+	WORD				wDepth;
+} GLD_profileEvent;
+
+typedef struct {
+	DWORD				dwThreadId;
+	GLD_profileEvent	*pEvents;
+	DWORD				dwEvents;		// Events written. The ring holds the last GLD_PROFILE_EVENTS.
+	int					nDepth;
+	GLD_profileScope	Stack[GLD_PROFILE_MAX_DEPTH];
+	ULONGLONG			qStack[GLD_PROFILE_MAX_DEPTH];
+	ULONGLONG			qFrameTicks[GLD_PROFILE_SCOPES];	// Since the last gldEndProfileFrame()
+	DWORD				dwFrameCalls[GLD_PROFILE_SCOPES];
+} GLD_profileThread;
+
+typedef struct {
+	ULONGLONG			qEnd;			// TSC at SwapBuffers
+	ULONGLONG			qTicks[GLD_PROFILE_SCOPES];
+	DWORD				dwCalls[GLD_PROFILE_SCOPES];
+	GLD_frameCounts		Counts;
+} GLD_profileFrame;
+
+typedef struct {
+	int					nDevices;		// Devices being profiled
+	BOOL				bTls;
+	DWORD				dwTls;
+
+	GLD_profileThread	*pThreads[GLD_PROFILE_MAX_THREADS];
+	LONG				nThreads;
+
+	// TSC rate, measured against QueryPerformanceCounter since the start
+	ULONGLONG			qTscStart;
+	LARGE_INTEGER		liStart;
+	LARGE_INTEGER		liFreq;
+	double				fTicksPerUs;
+
+	GLD_profileFrame	Frames[GLD_PROFILE_FRAMES];
+	DWORD				dwFrames;		// Frames ended. The ring holds the last GLD_PROFILE_FRAMES.
+
+	DWORD				*pOverlay;		// GLD_OVL_WIDTH x GLD_OVL_HEIGHT, bottom-up
+} GLD_profiler;
+
+static GLD_profiler gldProf;
+
+BOOL gldProfileActive = FALSE;
+
+static const char *szScopeNames[GLD_PROFILE_SCOPES] = {
+	"SwapBuffers",
+	"UpdateState",
+	"UpdateShaders",
+	"FindEffect",
+	"End",
+	"FlushVertices",
+	"TexImage2D",
+};
+
+// Overlay colour of each scope
+static const DWORD dwScopeColours[GLD_PROFILE_SCOPES] = {
+	0xFF4080FF,
+	0xFFFF8040,
+	0xFFFFD040,
+	0xFFC060FF,
+	0xFF40D0D0,
+	0xFF80FF40,
+	0xFFFF60A0,
+};
+
+// Overlay colours of the draws, states, locks and upload KB counts
+static const DWORD dwCountColours[4] = {
+	0xFF40D0D0,
+	0xFFFF8040,
+	0xFF80FF40,
+	0xFFFF60A0,
+};
+
+// 3x5 digits, then '.'. Bit 2 is the left column.
+static const BYTE gldOvlFont[11][5] = {
+	{7,5,5,5,7}, {2,6,2,2,7}, {7,1,7,4,7}, {7,1,7,1,7}, {5,5,7,1,1},
+	{7,4,7,1,7}, {7,4,7,5,7}, {7,1,1,1,1}, {7,5,7,5,7}, {7,5,7,1,7},
+	{0,0,0,0,2},
+};
+
+//---------------------------------------------------------------------------
+
+static GLD_profileThread* _gldGetProfileThread(void)
+{
+	GLD_profileThread	*pThread;
+	LONG				n;
+
+	pThread = (GLD_profileThread*)TlsGetValue(gldProf.dwTls);
+	if (pThread)
+		return pThread;
+
+	// First scope on this thread
+	if (gldProf.nThreads >= GLD_PROFILE_MAX_THREADS)
+		return NULL;
+	pThread = (GLD_profileThread*)CALLOC(sizeof(GLD_profileThread));
+	if (!pThread)
+		return NULL;
+	pThread->pEvents = (GLD_profileEvent*)MALLOC(GLD_PROFILE_EVENTS * sizeof(GLD_profileEvent));
+	if (!pThread->pEvents) {
+		FREE(pThread);
+		return NULL;
+	}
+	pThread->dwThreadId = GetCurrentThreadId();
+
+	n = InterlockedIncrement(&gldProf.nThreads) - 1;
+	if (n >= GLD_PROFILE_MAX_THREADS) {
+		// Lost the race for the last slot
+		FREE(pThread->pEvents);
+		FREE(pThread);
+		return NULL;
+	}
+	gldProf.pThreads[n] = pThread;
+	TlsSetValue(gldProf.dwTls, pThread);
+	return pThread;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldCalibrateProfiler(void)
+{
+	LARGE_INTEGER	liNow;
+	ULONGLONG		qTsc = __rdtsc();
+	double			fUs;
+
+	QueryPerformanceCounter(&liNow);
+	fUs = (double)(liNow.QuadPart - gldProf.liStart.QuadPart) * 1000000.0 / (double)gldProf.liFreq.QuadPart;
+	// Too short an interval gives a poor rate; keep the previous one
+	if (fUs > 1000.0)
+		gldProf.fTicksPerUs = (double)(qTsc - gldProf.qTscStart) / fUs;
+}
+
+//---------------------------------------------------------------------------
+
+static double _gldTicksToUs(
+	ULONGLONG qTicks)
+{
+	return (double)qTicks / gldProf.fTicksPerUs;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldWriteProfile(void)
+{
+	FILE				*fp;
+	GLD_profileThread	*pThread;
+	GLD_profileEvent	*pEvent;
+	GLD_profileFrame	*pFrame;
+	DWORD				dwFirst, dwEvents;
+	DWORD				i, j;
+	LONG				nThreads;
+	const char			*szSep = "";
+
+	_gldCalibrateProfiler();
+
+	fp = fopen(glb.szProfileFile, "w");
+	if (!fp) {
+		gldLogPrintf(GLDLOG_WARN, "Profiler: unable to open %s", glb.szProfileFile);
+		return;
+	}
+
+	fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", fp);
+
+	nThreads = min(gldProf.nThreads, GLD_PROFILE_MAX_THREADS);
+	for (i=0; i<(DWORD)nThreads; i++) {
+		pThread = gldProf.pThreads[i];
+		if (!pThread)
+			continue; // Still being registered
+		fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"GL thread %u\"}}",
+			szSep, pThread->dwThreadId, pThread->dwThreadId);
+		szSep = ",\n";
+
+		dwEvents = min(pThread->dwEvents, GLD_PROFILE_EVENTS);
+		dwFirst = pThread->dwEvents - dwEvents;
+		for (j=0; j<dwEvents; j++) {
+			pEvent = &pThread->pEvents[(dwFirst + j) & (GLD_PROFILE_EVENTS-1)];
+			if (pEvent->wScope >= GLD_PROFILE_SCOPES || pEvent->qStart < gldProf.qTscStart)
+				continue;
+			fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"gld\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+				szScopeNames[pEvent->wScope],
+				pThread->dwThreadId,
+				_gldTicksToUs(pEvent->qStart - gldProf.qTscStart),
+				_gldTicksToUs(pEvent->dwTicks));
+		}
+	}
+
+	// A counter sample and a marker at the end of each frame
+	dwEvents = min(gldProf.dwFrames, GLD_PROFILE_FRAMES);
+	dwFirst = gldProf.dwFrames - dwEvents;
+	for (j=0; j<dwEvents; j++) {
+		double fTs;
+		pFrame = &gldProf.Frames[(dwFirst + j) & (GLD_PROFILE_FRAMES-1)];
+		fTs = _gldTicksToUs(pFrame->qEnd - gldProf.qTscStart);
+		fprintf(fp, "%s{\"name\":\"device\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"draws\":%u,\"states\":%u,\"locks\":%u,\"upload_bytes\":%u}}",
+			szSep, fTs,
+			pFrame->Counts.dwDraws,
+			pFrame->Counts.dwStates,
+			pFrame->Counts.dwLocks,
+			pFrame->Counts.dwUploadBytes);
+		fprintf(fp, ",\n{\"name\":\"frame %u\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f}",
+			dwFirst + j, fTs);
+		szSep = ",\n";
+	}
+
+	fputs("\n]}\n", fp);
+	fclose(fp);
+
+	gldLogPrintf(GLDLOG_INFO, "Profiler: wrote %s (%u frames)", glb.szProfileFile, dwEvents);
+}
+
+//---------------------------------------------------------------------------
+
+void gldStartProfiling(void)
+{
+	LONG	i;
+
+	if (!glb.szProfileFile[0])
+		return;
+	if (gldProf.nDevices++)
+		return;
+
+	if (!gldProf.bTls) {
+		gldProf.dwTls = TlsAlloc();
+		if (gldProf.dwTls == TLS_OUT_OF_INDEXES) {
+			gldLogPrintf(GLDLOG_WARN, "Profiler: out of TLS indexes");
+			gldProf.nDevices = 0;
+			return;
+		}
+		gldProf.bTls = TRUE;
+	}
+
+	if (!gldProf.pOverlay)
+		gldProf.pOverlay = (DWORD*)MALLOC(GLD_OVL_WIDTH * GLD_OVL_HEIGHT * sizeof(DWORD));
+
+	// Forget what earlier devices timed
+	for (i=0; i<min(gldProf.nThreads, GLD_PROFILE_MAX_THREADS); i++) {
+		GLD_profileThread *pThread = gldProf.pThreads[i];
+		if (!pThread)
+			continue;
+		pThread->dwEvents = 0;
+		pThread->nDepth = 0;
+		ZeroMemory(pThread->qFrameTicks, sizeof(pThread->qFrameTicks));
+		ZeroMemory(pThread->dwFrameCalls, sizeof(pThread->dwFrameCalls));
+	}
+	gldProf.dwFrames = 0;
+
+	QueryPerformanceFrequency(&gldProf.liFreq);
+	QueryPerformanceCounter(&gldProf.liStart);
+	gldProf.qTscStart = __rdtsc();
+	gldProf.fTicksPerUs = 1000.0; // Until there is something to measure against
+
+	gldProfileActive = TRUE;
+	gldLogPrintf(GLDLOG_INFO, "Profiler: on, Ctrl+F11 toggles the overlay, Ctrl+Shift+F11 writes %s", glb.szProfileFile);
+}
+
+//---------------------------------------------------------------------------
+
+void gldStopProfiling(void)
+{
+	if (!gldProf.nDevices)
+		return;
+	if (--gldProf.nDevices)
+		return;
+
+	gldProfileActive = FALSE;
+	_gldWriteProfile();
+
+	if (gldProf.pOverlay) {
+		FREE(gldProf.pOverlay);
+		gldProf.pOverlay = NULL;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+void gldProfileBegin(
+	GLD_profileScope Scope)
+{
+	GLD_profileThread *pThread = _gldGetProfileThread();
+
+	if (!pThread)
+		return;
+	if (pThread->nDepth < GLD_PROFILE_MAX_DEPTH) {
+		pThread->Stack[pThread->nDepth] = Scope;
+		pThread->qStack[pThread->nDepth] = __rdtsc();
+	}
+	// Deeper scopes are counted but not timed
+	pThread->nDepth++;
+}
+
+//---------------------------------------------------------------------------
+
+void gldProfileEnd(
+	GLD_profileScope Scope)
+{
+	GLD_profileThread	*pThread = (GLD_profileThread*)TlsGetValue(gldProf.dwTls);
+	GLD_profileEvent	*pEvent;
+	ULONGLONG			qTicks;
+	int					n;
+
+	if (!pThread || !pThread->nDepth)
+		return;
+	n = pThread->nDepth - 1;
+	if (n >= GLD_PROFILE_MAX_DEPTH) {
+		pThread->nDepth--;
+		return;
+	}
+	// The scope was entered before the profiler started
+	if (pThread->Stack[n] != Scope)
+		return;
+	pThread->nDepth--;
+
+	qTicks = __rdtsc() - pThread->qStack[n];
+	pThread->qFrameTicks[Scope] += qTicks;
+	pThread->dwFrameCalls[Scope]++;
+
+	pEvent = &pThread->pEvents[pThread->dwEvents & (GLD_PROFILE_EVENTS-1)];
+	pEvent->qStart	= pThread->qStack[n];
+	pEvent->dwTicks	= (DWORD)min(qTicks, 0xFFFFFFFF);
+	pEvent->wScope	= (WORD)Scope;
+	pEvent->wDepth	= (WORD)n;
+	pThread->dwEvents++;
+}
+
+//---------------------------------------------------------------------------
+
+void gldEndProfileFrame(void)
+{
+	GLD_profileThread	*pThread;
+	GLD_profileFrame	*pFrame;
+
+	if (!gldProfileActive)
+		return;
+	pThread = _gldGetProfileThread();
+	if (!pThread)
+		return;
+
+	pFrame = &gldProf.Frames[gldProf.dwFrames & (GLD_PROFILE_FRAMES-1)];
+	pFrame->qEnd = __rdtsc();
+	memcpy(pFrame->qTicks, pThread->qFrameTicks, sizeof(pFrame->qTicks));
+	memcpy(pFrame->dwCalls, pThread->dwFrameCalls, sizeof(pFrame->dwCalls));
+	ZeroMemory(pThread->qFrameTicks, sizeof(pThread->qFrameTicks));
+	ZeroMemory(pThread->dwFrameCalls, sizeof(pThread->dwFrameCalls));
+	gldGetRecordedFrame(&pFrame->Counts);
+	gldProf.dwFrames++;
+
+	_gldCalibrateProfiler();
+
+	if (glb.bProfileDump) {
+		glb.bProfileDump = FALSE;
+		_gldWriteProfile();
+	}
+}
+
+//---------------------------------------------------------------------------
+// Overlay
+//---------------------------------------------------------------------------
+
+static void _gldOvlFill(
+	int x,
+	int y,
+	int w,
+	int h,
+	DWORD dwColour)
+{
+	DWORD	*pRow;
+	int		i;
+
+	// Clip to the overlay. y is from the top.
+	if (x < 0) { w += x; x = 0; }
+	if (y < 0) { h += y; y = 0; }
+	if (x + w > GLD_OVL_WIDTH)
+		w = GLD_OVL_WIDTH - x;
+	if (y + h > GLD_OVL_HEIGHT)
+		h = GLD_OVL_HEIGHT - y;
+
+	for (; h > 0; h--, y++) {
+		pRow = gldProf.pOverlay + (GLD_OVL_HEIGHT - 1 - y) * GLD_OVL_WIDTH + x;
+		for (i=0; i<w; i++)
+			pRow[i] = dwColour;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldOvlText(
+	int x,
+	int y,
+	const char *szText,
+	DWORD dwColour)
+{
+	int		c, row, col;
+
+	// Digits and '.' only, two pixels to a font pixel
+	for (; *szText; szText++, x += 8) {
+		if (*szText >= '0' && *szText <= '9')
+			c = *szText - '0';
+		else if (*szText == '.')
+			c = 10;
+		else
+			continue;
+		for (row=0; row<5; row++)
+			for (col=0; col<3; col++)
+				if (gldOvlFont[c][row] & (4 >> col))
+					_gldOvlFill(x + col*2, y + row*2, 2, 2, dwColour);
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldOvlBar(
+	int y,
+	DWORD dwColour,
+	double fUs)
+{
+	char	szText[16];
+	int		w;
+
+	// Swatch, bar against the frame budget, and milliseconds
+	_gldOvlFill(2, y + 1, 8, 8, dwColour);
+	w = (int)(fUs * GLD_OVL_BAR_WIDTH / GLD_OVL_BUDGET_US);
+	_gldOvlFill(GLD_OVL_BAR_X, y + 2, min(w, GLD_OVL_BAR_WIDTH), 6, dwColour);
+	_snprintf(szText, sizeof(szText), "%.2f", min(fUs / 1000.0, 99.99));
+	szText[sizeof(szText)-1] = '\0';
+	_gldOvlText(GLD_OVL_TEXT_X, y, szText, 0xFFFFFFFF);
+}
+
+//---------------------------------------------------------------------------
+
+void gldDrawProfileOverlay(
+	GLcontext *ctx)
+{
+	const GLD_profileFrame	*pFrame, *pPrev;
+	DWORD					dwCounts[4];
+	char					szText[16];
+	double					fUs;
+	int						i, y, h, nHistory;
+
+	if (!gldProfileActive || !gldProf.pOverlay || !ctx->DrawBuffer || gldProf.dwFrames < 2)
+		return;
+
+	pFrame = &gldProf.Frames[(gldProf.dwFrames-1) & (GLD_PROFILE_FRAMES-1)];
+	pPrev = &gldProf.Frames[(gldProf.dwFrames-2) & (GLD_PROFILE_FRAMES-1)];
+
+	_gldOvlFill(0, 0, GLD_OVL_WIDTH, GLD_OVL_HEIGHT, 0xFF101018);
+
+	// A row per scope, then the whole frame
+	y = 2;
+	for (i=0; i<GLD_PROFILE_SCOPES; i++, y += GLD_OVL_ROW)
+		_gldOvlBar(y, dwScopeColours[i], _gldTicksToUs(pFrame->qTicks[i]));
+	_gldOvlBar(y, 0xFFFFFFFF, _gldTicksToUs(pFrame->qEnd - pPrev->qEnd));
+	y += GLD_OVL_ROW;
+
+	// Draws, states, locks and upload KB
+	dwCounts[0] = pFrame->Counts.dwDraws;
+	dwCounts[1] = pFrame->Counts.dwStates;
+	dwCounts[2] = pFrame->Counts.dwLocks;
+	dwCounts[3] = pFrame->Counts.dwUploadBytes / 1024;
+	for (i=0; i<4; i++) {
+		_gldOvlFill(i*64 + 2, y + 1, 8, 8, dwCountColours[i]);
+		_snprintf(szText, sizeof(szText), "%u", min(dwCounts[i], 999999));
+		szText[sizeof(szText)-1] = '\0';
+		_gldOvlText(i*64 + 12, y, szText, 0xFFFFFFFF);
+	}
+	y += GLD_OVL_ROW;
+
+	// Frame times, newest on the right. The line is the budget.
+	nHistory = (int)min(gldProf.dwFrames - 1, min(GLD_OVL_WIDTH, GLD_PROFILE_FRAMES - 1));
+	for (i=0; i<nHistory; i++) {
+		DWORD n = gldProf.dwFrames - 1 - i;
+		pFrame = &gldProf.Frames[n & (GLD_PROFILE_FRAMES-1)];
+		pPrev = &gldProf.Frames[(n-1) & (GLD_PROFILE_FRAMES-1)];
+		fUs = _gldTicksToUs(pFrame->qEnd - pPrev->qEnd);
+		h = (int)(fUs * (GLD_OVL_GRAPH / 2) / GLD_OVL_BUDGET_US);
+		h = min(max(h, 1), GLD_OVL_GRAPH);
+		_gldOvlFill(GLD_OVL_WIDTH - 1 - i, y + GLD_OVL_GRAPH - h, 1, h,
+			(fUs > GLD_OVL_BUDGET_US) ? 0xFFFF4040 : 0xFF40FF40);
+	}
+	_gldOvlFill(0, y + GLD_OVL_GRAPH / 2, GLD_OVL_WIDTH, 1, 0xFF808080);
+
+	// Top left of the window
+	y = ctx->DrawBuffer->Height - GLD_OVL_HEIGHT - 8;
+	if (y < 0 || ctx->DrawBuffer->Width < GLD_OVL_WIDTH + 8)
+		return;
+	gldDrawImage_DX9(ctx, 8, y, GLD_OVL_WIDTH, GLD_OVL_HEIGHT, gldProf.pOverlay);
+}
+
+//---------------------------------------------------------------------------
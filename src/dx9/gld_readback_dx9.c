@@ -0,0 +1,483 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Backbuffer readback. glReadPixels copies into a ring of
+*               persistent surfaces; GL_GLD_async_read_pixels lets the app
+*               queue a read and collect it a frame or two later.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+#include "texformat.h"
+#include "texstore.h"
+#include "image.h"
+#include "state.h"
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldValidateReadback(
+	GLD_driver_dx9 *gld,
+	const D3DSURFACE_DESC *pBB)
+{
+	GLD_readback *pRB = &gld->Readback;
+
+	// The packers below only know the 32-bit layouts
+	if ((pBB->Format != D3DFMT_X8R8G8B8) && (pBB->Format != D3DFMT_A8R8G8B8))
+		return FALSE;
+
+	if ((pRB->Width != pBB->Width) || (pRB->Height != pBB->Height) || (pRB->Format != pBB->Format)) {
+		gldReleaseReadback(gld);
+		pRB->Width	= pBB->Width;
+		pRB->Height	= pBB->Height;
+		pRB->Format	= pBB->Format;
+	}
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldCreateReadbackSlot(
+	GLD_driver_dx9 *gld,
+	GLD_readbackSlot *pSlot)
+{
+	GLD_readback	*pRB = &gld->Readback;
+	HRESULT			hr;
+
+	if (pSlot->pCopy)
+		return TRUE;
+
+	hr = IDirect3DDevice9_CreateRenderTarget(
+		gld->pDev,
+		pRB->Width,
+		pRB->Height,
+		pRB->Format,
+		D3DMULTISAMPLE_NONE,
+		0,
+		FALSE, // Only ever read through pSysmem
+		&pSlot->pCopy,
+		NULL);
+	if (FAILED(hr)) {
+		gldLogError(GLDLOG_WARN, "Readback CreateRenderTarget failed", hr);
+		return FALSE;
+	}
+
+	hr = IDirect3DDevice9_CreateOffscreenPlainSurface(
+		gld->pDev,
+		pRB->Width,
+		pRB->Height,
+		pRB->Format,
+		D3DPOOL_SYSTEMMEM,
+		&pSlot->pSysmem,
+		NULL);
+	if (FAILED(hr)) {
+		gldLogError(GLDLOG_WARN, "Readback CreateOffscreenPlainSurface failed", hr);
+		SAFE_RELEASE(pSlot->pCopy);
+		return FALSE;
+	}
+
+	// Without an event query the read simply waits in GetRenderTargetData
+	if (FAILED(IDirect3DDevice9_CreateQuery(gld->pDev, D3DQUERYTYPE_EVENT, &pSlot->pEvent)))
+		pSlot->pEvent = NULL;
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldPackReadbackRows(
+	GLcontext *ctx,
+	const GLD_readbackSlot *pSlot,
+	D3DFORMAT d3dFormat,
+	const BYTE *pBits,
+	INT iPitch)
+{
+	const struct gl_pixelstore_attrib	*pack	= &pSlot->Pack;
+	GLint								width	= pSlot->rc.right - pSlot->rc.left;
+	GLint								height	= pSlot->rc.bottom - pSlot->rc.top;
+	DWORD								dwAlpha	= (d3dFormat == D3DFMT_X8R8G8B8) ? 0xff000000 : 0;
+	BOOL								bFast;
+	const struct gl_texture_format		*MesaFormat = NULL;
+	GLint								DstRowStride = 0;
+	DWORD								*pTemp = NULL;
+	const DWORD							*pSrc;
+	GLubyte								*pDst;
+	GLint								i, j;
+
+	bFast = !ctx->_ImageTransferState && !pack->SwapBytes && (pSlot->type == GL_UNSIGNED_BYTE) &&
+		((pSlot->format == GL_BGRA) || (pSlot->format == GL_RGBA) || (pSlot->format == GL_RGB));
+
+	if (!bFast) {
+		MesaFormat		= _mesa_choose_tex_format(ctx, pSlot->format, pSlot->format, pSlot->type);
+		DstRowStride	= _mesa_image_row_stride(pack, width, pSlot->format, pSlot->type);
+		if (dwAlpha) {
+			pTemp = (DWORD*)MALLOC(width * sizeof(DWORD));
+			if (!pTemp)
+				return;
+		}
+	}
+
+	// GL rows run bottom-up; the surface is top-down
+	for (i=0; i<height; i++) {
+		pSrc = (const DWORD*)(pBits + iPitch * (height-i-1));
+		pDst = (GLubyte*)_mesa_image_address(pack, pSlot->pixels, width, height, pSlot->format, pSlot->type,
+			0, pack->Invert ? (height-i-1) : i, 0);
+
+		if (!bFast) {
+			if (pTemp) {
+				for (j=0; j<width; j++)
+					pTemp[j] = pSrc[j] | dwAlpha;
+				pSrc = pTemp;
+			}
+			_mesa_transfer_teximage(ctx, 2, GL_RGBA, MesaFormat,
+				pDst,
+				width, 1, 1, 0, 0, 0,
+				DstRowStride,
+				0, // dstImageStride
+				GL_BGRA, GL_UNSIGNED_BYTE, pSrc, &_mesa_native_packing);
+			continue;
+		}
+
+		switch (pSlot->format) {
+		case GL_BGRA:
+			if (dwAlpha) {
+				for (j=0; j<width; j++)
+					((DWORD*)pDst)[j] = pSrc[j] | dwAlpha;
+			} else {
+				memcpy(pDst, pSrc, width * 4);
+			}
+			break;
+		case GL_RGBA:
+			gldSwapRedBlue32(pDst, (const GLubyte*)pSrc, width, dwAlpha);
+			break;
+		case GL_RGB:
+			for (j=0; j<width; j++, pDst+=3) {
+				pDst[0] = (GLubyte)(pSrc[j] >> 16);
+				pDst[1] = (GLubyte)(pSrc[j] >> 8);
+				pDst[2] = (GLubyte)(pSrc[j]);
+			}
+			break;
+		}
+	}
+
+	if (pTemp)
+		FREE(pTemp);
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldCompleteReadback(
+	GLcontext *ctx,
+	GLD_readbackSlot *pSlot,
+	BOOL bWait)
+{
+	GLD_context		*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9	*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	D3DLOCKED_RECT	d3dLockedRect;
+	HRESULT			hr;
+
+	if (pSlot->pEvent) {
+		// Anything but S_FALSE (done, or a lost device) stops the wait
+		while ((hr = IDirect3DQuery9_GetData(pSlot->pEvent, NULL, 0, D3DGETDATA_FLUSH)) == S_FALSE) {
+			if (!bWait)
+				return FALSE;
+			Sleep(0);
+		}
+	}
+
+	// The slot is finished with whether or not the copy survived
+	pSlot->bPending = FALSE;
+
+	hr = IDirect3DDevice9_GetRenderTargetData(gld->pDev, pSlot->pCopy, pSlot->pSysmem);
+	if (FAILED(hr)) {
+		gldLogError(GLDLOG_WARN, "Readback GetRenderTargetData failed", hr);
+		return TRUE;
+	}
+	hr = IDirect3DSurface9_LockRect(pSlot->pSysmem, &d3dLockedRect, &pSlot->rc, D3DLOCK_READONLY);
+	if (FAILED(hr))
+		return TRUE;
+
+	_gldPackReadbackRows(ctx, pSlot, gld->Readback.Format, (const BYTE*)d3dLockedRect.pBits, d3dLockedRect.Pitch);
+
+	IDirect3DSurface9_UnlockRect(pSlot->pSysmem);
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldQueueReadback(
+	GLcontext *ctx,
+	GLint x,
+	GLint y,
+	GLsizei width,
+	GLsizei height,
+	GLenum format,
+	GLenum type,
+	const struct gl_pixelstore_attrib *pack,
+	GLvoid *pixels,
+	GLD_readbackSlot **ppSlot)
+{
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_readback		*pRB	= &gld->Readback;
+	GLD_readbackSlot	*pSlot;
+	IDirect3DSurface9	*pBackbuffer;
+	D3DSURFACE_DESC		d3dsd;
+	RECT				rc;
+	HRESULT				hr;
+
+	switch (format) {
+	case GL_STENCIL_INDEX:
+	case GL_DEPTH_COMPONENT:
+	case GL_COLOR_INDEX:
+		return FALSE;
+	}
+	if ((width <= 0) || (height <= 0))
+		return FALSE;
+
+	hr = IDirect3DDevice9_GetBackBuffer(gld->pDev, 0, 0, D3DBACKBUFFER_TYPE_MONO, &pBackbuffer);
+	if (FAILED(hr))
+		return FALSE;
+	IDirect3DSurface9_GetDesc(pBackbuffer, &d3dsd);
+
+	// Reads that hang off the edge are left to the D3DX path
+	SetRect(&rc, x, gldCtx->dwHeight - y - height, x + width, gldCtx->dwHeight - y);
+	if ((rc.left < 0) || (rc.top < 0) || (rc.right > (LONG)d3dsd.Width) || (rc.bottom > (LONG)d3dsd.Height) ||
+		!_gldValidateReadback(gld, &d3dsd))
+	{
+		IDirect3DSurface9_Release(pBackbuffer);
+		return FALSE;
+	}
+
+	pSlot = &pRB->Slots[pRB->iNext];
+	if (pSlot->bPending) {
+		// Ring is full; the oldest read has to land first
+		_gldCompleteReadback(ctx, pSlot, TRUE);
+		pRB->dwStalls++;
+	}
+	if (!_gldCreateReadbackSlot(gld, pSlot)) {
+		IDirect3DSurface9_Release(pBackbuffer);
+		return FALSE;
+	}
+
+	// StretchRect also resolves a multisampled backbuffer
+	hr = IDirect3DDevice9_StretchRect(gld->pDev, pBackbuffer, &rc, pSlot->pCopy, &rc, D3DTEXF_NONE);
+	IDirect3DSurface9_Release(pBackbuffer);
+	if (FAILED(hr))
+		return FALSE;
+	if (pSlot->pEvent)
+		IDirect3DQuery9_Issue(pSlot->pEvent, D3DISSUE_END);
+
+	pSlot->bPending	= TRUE;
+	pSlot->rc		= rc;
+	pSlot->format	= format;
+	pSlot->type		= type;
+	pSlot->pixels	= pixels;
+	pSlot->Pack		= *pack;
+	if (++pRB->uNextTicket == 0)
+		pRB->uNextTicket = 1; // Zero is never a ticket
+	pSlot->uTicket	= pRB->uNextTicket;
+
+	*ppSlot = pSlot;
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static GLD_readbackSlot* _gldFindReadback(
+	GLD_driver_dx9 *gld,
+	GLuint ticket)
+{
+	int i;
+
+	for (i=0; i<GLD_READBACK_SLOTS; i++) {
+		if (gld->Readback.Slots[i].bPending && (gld->Readback.Slots[i].uTicket == ticket))
+			return &gld->Readback.Slots[i];
+	}
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+
+BOOL gldReadPixels(
+	GLcontext *ctx,
+	GLint x,
+	GLint y,
+	GLsizei width,
+	GLsizei height,
+	GLenum format,
+	GLenum type,
+	const struct gl_pixelstore_attrib *pack,
+	GLvoid *dest)
+{
+	//
+	// glReadPixels through the readback ring. Returns FALSE if the read
+	// is one the caller has to do itself.
+	//
+
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_readbackSlot	*pSlot;
+
+	if (!_gldQueueReadback(ctx, x, y, width, height, format, type, pack, dest, &pSlot)) {
+		gld->Readback.dwFallbacks++;
+		return FALSE;
+	}
+	// Same slot next time; nothing is left in flight
+	_gldCompleteReadback(ctx, pSlot, TRUE);
+	gld->Readback.dwReads++;
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+// GL_GLD_async_read_pixels
+//---------------------------------------------------------------------------
+
+GLuint APIENTRY gldReadPixelsAsyncGLD(
+	GLint x,
+	GLint y,
+	GLsizei width,
+	GLsizei height,
+	GLenum format,
+	GLenum type,
+	GLvoid *pixels)
+{
+	GLD_context			*gldCtx;
+	GLD_driver_dx9		*gld;
+	GLD_readback		*pRB;
+	GLD_readbackSlot	*pSlot;
+	GET_CURRENT_CONTEXT(ctx);
+
+	if (!ctx)
+		return 0;
+	ASSERT_OUTSIDE_BEGIN_END_AND_FLUSH_WITH_RETVAL(ctx, 0);
+
+	if ((width < 0) || (height < 0)) {
+		_mesa_error(ctx, GL_INVALID_VALUE, "glReadPixelsAsyncGLD(width=%d height=%d)", width, height);
+		return 0;
+	}
+	if (!pixels) {
+		_mesa_error(ctx, GL_INVALID_VALUE, "glReadPixelsAsyncGLD(pixels)");
+		return 0;
+	}
+	if (ctx->NewState)
+		_mesa_update_state(ctx);
+
+	gldCtx	= GLD_GET_CONTEXT(ctx);
+	gld		= GLD_GET_DX9_DRIVER(gldCtx);
+	pRB		= &gld->Readback;
+
+	if (!_gldQueueReadback(ctx, x, y, width, height, format, type, &ctx->Pack, pixels, &pSlot)) {
+		// Read it now and hand back a ticket that is already done
+		(*ctx->Driver.ReadPixels)(ctx, x, y, width, height, format, type, &ctx->Pack, pixels);
+		if (++pRB->uNextTicket == 0)
+			pRB->uNextTicket = 1;
+		return pRB->uNextTicket;
+	}
+
+	pRB->iNext = (pRB->iNext + 1) % GLD_READBACK_SLOTS;
+	pRB->dwAsyncReads++;
+	return pSlot->uTicket;
+}
+
+//---------------------------------------------------------------------------
+
+GLboolean APIENTRY gldPollReadPixelsGLD(
+	GLuint ticket)
+{
+	GLD_context			*gldCtx;
+	GLD_readbackSlot	*pSlot;
+	GET_CURRENT_CONTEXT(ctx);
+
+	if (!ctx)
+		return GL_TRUE;
+	ASSERT_OUTSIDE_BEGIN_END_WITH_RETVAL(ctx, GL_TRUE);
+
+	gldCtx	= GLD_GET_CONTEXT(ctx);
+	pSlot	= _gldFindReadback(GLD_GET_DX9_DRIVER(gldCtx), ticket);
+	if (!pSlot)
+		return GL_TRUE; // Done, dropped, or never issued
+	return _gldCompleteReadback(ctx, pSlot, FALSE) ? GL_TRUE : GL_FALSE;
+}
+
+//---------------------------------------------------------------------------
+
+void APIENTRY gldFinishReadPixelsGLD(
+	GLuint ticket)
+{
+	GLD_context			*gldCtx;
+	GLD_readbackSlot	*pSlot;
+	GET_CURRENT_CONTEXT(ctx);
+
+	if (!ctx)
+		return;
+	ASSERT_OUTSIDE_BEGIN_END(ctx);
+
+	gldCtx	= GLD_GET_CONTEXT(ctx);
+	pSlot	= _gldFindReadback(GLD_GET_DX9_DRIVER(gldCtx), ticket);
+	if (pSlot)
+		_gldCompleteReadback(ctx, pSlot, TRUE);
+}
+
+//---------------------------------------------------------------------------
+
+void gldReleaseReadback(
+	GLD_driver_dx9 *gld)
+{
+	//
+	// The copies live in POOL_DEFAULT, so this must run before Reset().
+	// Reads still in flight are lost; their tickets poll as done.
+	//
+
+	GLD_readback		*pRB = &gld->Readback;
+	GLD_readbackSlot	*pSlot;
+	DWORD				dwDropped = 0;
+	int					i;
+
+	for (i=0; i<GLD_READBACK_SLOTS; i++) {
+		pSlot = &pRB->Slots[i];
+		if (pSlot->bPending)
+			dwDropped++;
+		pSlot->bPending = FALSE;
+		SAFE_RELEASE(pSlot->pEvent);
+		SAFE_RELEASE(pSlot->pSysmem);
+		SAFE_RELEASE(pSlot->pCopy);
+	}
+	if (dwDropped)
+		gldLogPrintf(GLDLOG_WARN, "Readback: %u pending reads dropped", dwDropped);
+
+	pRB->dwDropped	+= dwDropped;
+	pRB->Width		= 0;
+	pRB->Height		= 0;
+	pRB->iNext		= 0;
+}
+
+//---------------------------------------------------------------------------
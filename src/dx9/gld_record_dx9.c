@@ -0,0 +1,820 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Device call recorder. Counts the calls, bytes and lock
+*               patterns that reach Direct3D and the CPU time of each frame,
+*               and writes them a line per frame to gldrecord.csv.
+*
+*********************************************************************************/
+
+#include <stddef.h>
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+//---------------------------------------------------------------------------
+// The recorder replaces the vtable pointer of the device, and of each
+// buffer, texture and surface it creates, with a copy in which the methods
+// of interest count and then call the runtime's own. Everything that uses
+// the objects goes through the copy, D3DX included, without any change to
+// the calling code.
+//
+// Objects can outlive the device (and the recorder), so the copies are
+// kept for the life of the process. The runtime's vtable is stored in
+// front of each copy.
+//---------------------------------------------------------------------------
+
+#define GLD_REC_MAX_CLASSES		16
+
+#define _GLD_REC_REAL(type, This)	((const type *)((const void**)(This)->lpVtbl)[-1])
+
+// Counters for one frame. All DWORDs, so they can be totalled as an array.
+typedef struct {
+	DWORD		dwDraws;			// Draw*Primitive calls
+	DWORD		dwPrims;			// Primitives they drew
+	DWORD		dwUPDraws;			// ...of which Draw*PrimitiveUP
+	DWORD		dwUPBytes;			// Vertex and index bytes passed by pointer
+	DWORD		dwStates;			// Render, sampler and texture stage states, transforms
+	DWORD		dwTextures;			// SetTexture
+	DWORD		dwStreams;			// Stream sources, indices, declarations and FVFs
+	DWORD		dwShaders;			// SetVertexShader, SetPixelShader
+	DWORD		dwConstants;		// Shader constant registers set
+	DWORD		dwClears;
+	DWORD		dwCopies;			// StretchRect, GetRenderTargetData, UpdateSurface, UpdateTexture
+	DWORD		dwCreates;			// Buffers, textures and surfaces created
+	DWORD		dwVBLocks;
+	DWORD		dwIBLocks;
+	DWORD		dwTexLocks;
+	DWORD		dwSurfLocks;
+	DWORD		dwLockBytes;		// Bytes spanned by the locked ranges and rows
+	DWORD		dwDiscards;			// Locks with D3DLOCK_DISCARD
+	DWORD		dwNoOverwrites;		// Locks with D3DLOCK_NOOVERWRITE
+	DWORD		dwReadOnly;			// Locks with D3DLOCK_READONLY
+} GLD_recCounts;
+
+#define GLD_REC_COUNTERS		((int)(sizeof(GLD_recCounts) / sizeof(DWORD)))
+
+// Per-frame average of one counter
+#define _GLD_REC_AVERAGE(member)	(gldRec.qwTotals[offsetof(GLD_recCounts, member) / sizeof(DWORD)] / gldRec.dwFrames)
+
+static const char szRecHeader[] =
+	"frame,cpu_us,draws,prims,up_draws,up_bytes,states,textures,streams,shaders,"
+	"constants,clears,copies,creates,vb_locks,ib_locks,tex_locks,surf_locks,"
+	"lock_bytes,discard,nooverwrite,readonly\n";
+
+typedef struct {
+	const void		*pReal;			// The runtime's vtable
+	const void		*pHooked;		// Our copy of it
+} GLD_recClass;
+
+typedef struct {
+	int				nDevices;		// Devices being recorded
+	FILE			*fp;			// Per-frame CSV, or NULL
+	BOOL			bFileWritten;	// The CSV was started by this process
+
+	GLD_recClass	Classes[GLD_REC_MAX_CLASSES];
+	int				nClasses;
+
+	LARGE_INTEGER	liFreq;
+	LARGE_INTEGER	liFrameStart;	// Previous Present(), or 0
+	GLD_recCounts	Frame;			// Counts since the previous Present()
+	GLD_recCounts	LastFrame;		// Counts of the frame before that
+	ULONGLONG		qwTotals[GLD_REC_COUNTERS];
+	DWORD			dwFrames;
+	ULONGLONG		qwTotalTicks;
+	LONGLONG		qMinTicks;
+	LONGLONG		qMaxTicks;
+} GLD_recorder;
+
+static GLD_recorder gldRec;
+
+//---------------------------------------------------------------------------
+
+static void _gldHookObject(
+	void *pObj,
+	size_t cbVtbl,
+	void (*pfnHook)(void *pVtbl))
+{
+	const void	**ppVtbl = (const void**)pObj;
+	BYTE		*pBlock;
+	int			i;
+
+	if (!pObj)
+		return;
+
+	for (i=0; i<gldRec.nClasses; i++) {
+		if (*ppVtbl == gldRec.Classes[i].pHooked)
+			return; // Already recorded
+		if (*ppVtbl == gldRec.Classes[i].pReal) {
+			*ppVtbl = gldRec.Classes[i].pHooked;
+			return;
+		}
+	}
+
+	// First object of this class
+	if (gldRec.nClasses == GLD_REC_MAX_CLASSES)
+		return;
+	pBlock = (BYTE*)MALLOC(sizeof(void*) + cbVtbl);
+	if (!pBlock)
+		return;
+	*(const void**)pBlock = *ppVtbl;
+	memcpy(pBlock + sizeof(void*), *ppVtbl, cbVtbl);
+	pfnHook(pBlock + sizeof(void*));
+	gldRec.Classes[gldRec.nClasses].pReal	= *ppVtbl;
+	gldRec.Classes[gldRec.nClasses].pHooked	= pBlock + sizeof(void*);
+	gldRec.nClasses++;
+	*ppVtbl = pBlock + sizeof(void*);
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldRecordLock(
+	DWORD *pdwLocks,
+	DWORD dwBytes,
+	DWORD Flags)
+{
+	if (!gldRec.nDevices)
+		return;
+	(*pdwLocks)++;
+	gldRec.Frame.dwLockBytes += dwBytes;
+	if (Flags & D3DLOCK_DISCARD)
+		gldRec.Frame.dwDiscards++;
+	if (Flags & D3DLOCK_NOOVERWRITE)
+		gldRec.Frame.dwNoOverwrites++;
+	if (Flags & D3DLOCK_READONLY)
+		gldRec.Frame.dwReadOnly++;
+}
+
+//---------------------------------------------------------------------------
+
+static DWORD _gldLockedRowBytes(
+	const D3DSURFACE_DESC *pDesc,
+	const RECT *pRect,
+	INT Pitch)
+{
+	DWORD dwRows = pRect ? (pRect->bottom - pRect->top) : pDesc->Height;
+
+	// Compressed surfaces are pitched in rows of 4x4 blocks
+	if (gldIsCompressedFormat(pDesc->Format))
+		dwRows = (dwRows + 3) / 4;
+	return dwRows * Pitch;
+}
+
+//---------------------------------------------------------------------------
+// Resources
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecVBLock(
+	IDirect3DVertexBuffer9 *This,
+	UINT OffsetToLock,
+	UINT SizeToLock,
+	void **ppbData,
+	DWORD Flags)
+{
+	D3DVERTEXBUFFER_DESC	d3dvbd;
+	HRESULT					hr;
+
+	hr = _GLD_REC_REAL(IDirect3DVertexBuffer9Vtbl, This)->Lock(This, OffsetToLock, SizeToLock, ppbData, Flags);
+	if (SUCCEEDED(hr)) {
+		if (!SizeToLock && SUCCEEDED(IDirect3DVertexBuffer9_GetDesc(This, &d3dvbd)))
+			SizeToLock = d3dvbd.Size - OffsetToLock;
+		_gldRecordLock(&gldRec.Frame.dwVBLocks, SizeToLock, Flags);
+	}
+	return hr;
+}
+
+static void _gldHookVertexBufferVtbl(
+	void *pVtbl)
+{
+	((IDirect3DVertexBuffer9Vtbl*)pVtbl)->Lock = _gldRecVBLock;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecIBLock(
+	IDirect3DIndexBuffer9 *This,
+	UINT OffsetToLock,
+	UINT SizeToLock,
+	void **ppbData,
+	DWORD Flags)
+{
+	D3DINDEXBUFFER_DESC		d3dibd;
+	HRESULT					hr;
+
+	hr = _GLD_REC_REAL(IDirect3DIndexBuffer9Vtbl, This)->Lock(This, OffsetToLock, SizeToLock, ppbData, Flags);
+	if (SUCCEEDED(hr)) {
+		if (!SizeToLock && SUCCEEDED(IDirect3DIndexBuffer9_GetDesc(This, &d3dibd)))
+			SizeToLock = d3dibd.Size - OffsetToLock;
+		_gldRecordLock(&gldRec.Frame.dwIBLocks, SizeToLock, Flags);
+	}
+	return hr;
+}
+
+static void _gldHookIndexBufferVtbl(
+	void *pVtbl)
+{
+	((IDirect3DIndexBuffer9Vtbl*)pVtbl)->Lock = _gldRecIBLock;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecSurfaceLockRect(
+	IDirect3DSurface9 *This,
+	D3DLOCKED_RECT *pLockedRect,
+	CONST RECT *pRect,
+	DWORD Flags)
+{
+	D3DSURFACE_DESC	d3dsd;
+	HRESULT			hr;
+
+	hr = _GLD_REC_REAL(IDirect3DSurface9Vtbl, This)->LockRect(This, pLockedRect, pRect, Flags);
+	if (SUCCEEDED(hr) && SUCCEEDED(IDirect3DSurface9_GetDesc(This, &d3dsd)))
+		_gldRecordLock(&gldRec.Frame.dwSurfLocks, _gldLockedRowBytes(&d3dsd, pRect, pLockedRect->Pitch), Flags);
+	return hr;
+}
+
+static void _gldHookSurfaceVtbl(
+	void *pVtbl)
+{
+	((IDirect3DSurface9Vtbl*)pVtbl)->LockRect = _gldRecSurfaceLockRect;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecTexLockRect(
+	IDirect3DTexture9 *This,
+	UINT Level,
+	D3DLOCKED_RECT *pLockedRect,
+	CONST RECT *pRect,
+	DWORD Flags)
+{
+	D3DSURFACE_DESC	d3dsd;
+	HRESULT			hr;
+
+	hr = _GLD_REC_REAL(IDirect3DTexture9Vtbl, This)->LockRect(This, Level, pLockedRect, pRect, Flags);
+	if (SUCCEEDED(hr) && SUCCEEDED(IDirect3DTexture9_GetLevelDesc(This, Level, &d3dsd)))
+		_gldRecordLock(&gldRec.Frame.dwTexLocks, _gldLockedRowBytes(&d3dsd, pRect, pLockedRect->Pitch), Flags);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecTexGetSurfaceLevel(
+	IDirect3DTexture9 *This,
+	UINT Level,
+	IDirect3DSurface9 **ppSurfaceLevel)
+{
+	HRESULT hr;
+
+	// Texture staging and D3DX lock levels through their surfaces
+	hr = _GLD_REC_REAL(IDirect3DTexture9Vtbl, This)->GetSurfaceLevel(This, Level, ppSurfaceLevel);
+	if (SUCCEEDED(hr))
+		_gldHookObject(*ppSurfaceLevel, sizeof(IDirect3DSurface9Vtbl), _gldHookSurfaceVtbl);
+	return hr;
+}
+
+static void _gldHookTextureVtbl(
+	void *pVtbl)
+{
+	((IDirect3DTexture9Vtbl*)pVtbl)->LockRect			= _gldRecTexLockRect;
+	((IDirect3DTexture9Vtbl*)pVtbl)->GetSurfaceLevel	= _gldRecTexGetSurfaceLevel;
+}
+
+//---------------------------------------------------------------------------
+// Device
+//---------------------------------------------------------------------------
+
+static void _gldEndRecordFrame(
+	LONGLONG qTicks)
+{
+	const DWORD	*pdwFrame = (const DWORD*)&gldRec.Frame;
+	DWORD		dwMicroSecs;
+	int			i;
+
+	for (i=0; i<GLD_REC_COUNTERS; i++)
+		gldRec.qwTotals[i] += pdwFrame[i];
+	if (!gldRec.dwFrames || (qTicks < gldRec.qMinTicks))
+		gldRec.qMinTicks = qTicks;
+	if (!gldRec.dwFrames || (qTicks > gldRec.qMaxTicks))
+		gldRec.qMaxTicks = qTicks;
+	gldRec.qwTotalTicks += qTicks;
+	gldRec.dwFrames++;
+
+	if (gldRec.fp) {
+		dwMicroSecs = (DWORD)(qTicks * 1000000 / gldRec.liFreq.QuadPart);
+		fprintf(gldRec.fp, "%u,%u", gldRec.dwFrames, dwMicroSecs);
+		for (i=0; i<GLD_REC_COUNTERS; i++)
+			fprintf(gldRec.fp, ",%u", pdwFrame[i]);
+		fputc('\n', gldRec.fp);
+	}
+
+	gldRec.LastFrame = gldRec.Frame;
+	ZeroMemory(&gldRec.Frame, sizeof(gldRec.Frame));
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecPresent(
+	IDirect3DDevice9 *This,
+	CONST RECT *pSourceRect,
+	CONST RECT *pDestRect,
+	HWND hDestWindowOverride,
+	CONST RGNDATA *pDirtyRegion)
+{
+	LARGE_INTEGER li;
+
+	// A frame is everything from one Present() to the next. On the
+	// NullDriver build that is the CPU cost of the app and of GLDirect.
+	if (gldRec.nDevices) {
+		QueryPerformanceCounter(&li);
+		if (gldRec.liFrameStart.QuadPart)
+			_gldEndRecordFrame(li.QuadPart - gldRec.liFrameStart.QuadPart);
+		gldRec.liFrameStart = li;
+	}
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->Present(This, pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion);
+}
+
+//---------------------------------------------------------------------------
+
+static UINT _gldPrimVerts(
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT PrimitiveCount)
+{
+	switch (PrimitiveType) {
+	case D3DPT_POINTLIST:		return PrimitiveCount;
+	case D3DPT_LINELIST:		return PrimitiveCount * 2;
+	case D3DPT_LINESTRIP:		return PrimitiveCount + 1;
+	case D3DPT_TRIANGLELIST:	return PrimitiveCount * 3;
+	default:					return PrimitiveCount + 2; // Strips and fans
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecDrawPrimitive(
+	IDirect3DDevice9 *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT StartVertex,
+	UINT PrimitiveCount)
+{
+	gldRec.Frame.dwDraws++;
+	gldRec.Frame.dwPrims += PrimitiveCount;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->DrawPrimitive(This, PrimitiveType, StartVertex, PrimitiveCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecDrawIndexedPrimitive(
+	IDirect3DDevice9 *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	INT BaseVertexIndex,
+	UINT MinVertexIndex,
+	UINT NumVertices,
+	UINT startIndex,
+	UINT primCount)
+{
+	gldRec.Frame.dwDraws++;
+	gldRec.Frame.dwPrims += primCount;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->DrawIndexedPrimitive(This, PrimitiveType, BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecDrawPrimitiveUP(
+	IDirect3DDevice9 *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT PrimitiveCount,
+	CONST void *pVertexStreamZeroData,
+	UINT VertexStreamZeroStride)
+{
+	gldRec.Frame.dwDraws++;
+	gldRec.Frame.dwUPDraws++;
+	gldRec.Frame.dwPrims += PrimitiveCount;
+	gldRec.Frame.dwUPBytes += _gldPrimVerts(PrimitiveType, PrimitiveCount) * VertexStreamZeroStride;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->DrawPrimitiveUP(This, PrimitiveType, PrimitiveCount, pVertexStreamZeroData, VertexStreamZeroStride);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecDrawIndexedPrimitiveUP(
+	IDirect3DDevice9 *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT MinVertexIndex,
+	UINT NumVertices,
+	UINT PrimitiveCount,
+	CONST void *pIndexData,
+	D3DFORMAT IndexDataFormat,
+	CONST void *pVertexStreamZeroData,
+	UINT VertexStreamZeroStride)
+{
+	gldRec.Frame.dwDraws++;
+	gldRec.Frame.dwUPDraws++;
+	gldRec.Frame.dwPrims += PrimitiveCount;
+	gldRec.Frame.dwUPBytes += NumVertices * VertexStreamZeroStride +
+		_gldPrimVerts(PrimitiveType, PrimitiveCount) * ((IndexDataFormat == D3DFMT_INDEX32) ? 4 : 2);
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->DrawIndexedPrimitiveUP(This, PrimitiveType, MinVertexIndex, NumVertices, PrimitiveCount, pIndexData, IndexDataFormat, pVertexStreamZeroData, VertexStreamZeroStride);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetRenderState(
+	IDirect3DDevice9 *This,
+	D3DRENDERSTATETYPE State,
+	DWORD Value)
+{
+	gldRec.Frame.dwStates++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetRenderState(This, State, Value);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetSamplerState(
+	IDirect3DDevice9 *This,
+	DWORD Sampler,
+	D3DSAMPLERSTATETYPE Type,
+	DWORD Value)
+{
+	gldRec.Frame.dwStates++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetSamplerState(This, Sampler, Type, Value);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetTextureStageState(
+	IDirect3DDevice9 *This,
+	DWORD Stage,
+	D3DTEXTURESTAGESTATETYPE Type,
+	DWORD Value)
+{
+	gldRec.Frame.dwStates++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetTextureStageState(This, Stage, Type, Value);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetTransform(
+	IDirect3DDevice9 *This,
+	D3DTRANSFORMSTATETYPE State,
+	CONST D3DMATRIX *pMatrix)
+{
+	gldRec.Frame.dwStates++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetTransform(This, State, pMatrix);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetTexture(
+	IDirect3DDevice9 *This,
+	DWORD Stage,
+	IDirect3DBaseTexture9 *pTexture)
+{
+	gldRec.Frame.dwTextures++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetTexture(This, Stage, pTexture);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetStreamSource(
+	IDirect3DDevice9 *This,
+	UINT StreamNumber,
+	IDirect3DVertexBuffer9 *pStreamData,
+	UINT OffsetInBytes,
+	UINT Stride)
+{
+	gldRec.Frame.dwStreams++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetStreamSource(This, StreamNumber, pStreamData, OffsetInBytes, Stride);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetIndices(
+	IDirect3DDevice9 *This,
+	IDirect3DIndexBuffer9 *pIndexData)
+{
+	gldRec.Frame.dwStreams++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetIndices(This, pIndexData);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetVertexDeclaration(
+	IDirect3DDevice9 *This,
+	IDirect3DVertexDeclaration9 *pDecl)
+{
+	gldRec.Frame.dwStreams++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetVertexDeclaration(This, pDecl);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetFVF(
+	IDirect3DDevice9 *This,
+	DWORD FVF)
+{
+	gldRec.Frame.dwStreams++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetFVF(This, FVF);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetVertexShader(
+	IDirect3DDevice9 *This,
+	IDirect3DVertexShader9 *pShader)
+{
+	gldRec.Frame.dwShaders++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetVertexShader(This, pShader);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetPixelShader(
+	IDirect3DDevice9 *This,
+	IDirect3DPixelShader9 *pShader)
+{
+	gldRec.Frame.dwShaders++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetPixelShader(This, pShader);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetVertexShaderConstantF(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	CONST float *pConstantData,
+	UINT Vector4fCount)
+{
+	gldRec.Frame.dwConstants += Vector4fCount;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetVertexShaderConstantF(This, StartRegister, pConstantData, Vector4fCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecSetPixelShaderConstantF(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	CONST float *pConstantData,
+	UINT Vector4fCount)
+{
+	gldRec.Frame.dwConstants += Vector4fCount;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->SetPixelShaderConstantF(This, StartRegister, pConstantData, Vector4fCount);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecClear(
+	IDirect3DDevice9 *This,
+	DWORD Count,
+	CONST D3DRECT *pRects,
+	DWORD Flags,
+	D3DCOLOR Color,
+	float Z,
+	DWORD Stencil)
+{
+	gldRec.Frame.dwClears++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->Clear(This, Count, pRects, Flags, Color, Z, Stencil);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecStretchRect(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 *pSourceSurface,
+	CONST RECT *pSourceRect,
+	IDirect3DSurface9 *pDestSurface,
+	CONST RECT *pDestRect,
+	D3DTEXTUREFILTERTYPE Filter)
+{
+	gldRec.Frame.dwCopies++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->StretchRect(This, pSourceSurface, pSourceRect, pDestSurface, pDestRect, Filter);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecGetRenderTargetData(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 *pRenderTarget,
+	IDirect3DSurface9 *pDestSurface)
+{
+	gldRec.Frame.dwCopies++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->GetRenderTargetData(This, pRenderTarget, pDestSurface);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecUpdateSurface(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 *pSourceSurface,
+	CONST RECT *pSourceRect,
+	IDirect3DSurface9 *pDestinationSurface,
+	CONST POINT *pDestPoint)
+{
+	gldRec.Frame.dwCopies++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->UpdateSurface(This, pSourceSurface, pSourceRect, pDestinationSurface, pDestPoint);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecUpdateTexture(
+	IDirect3DDevice9 *This,
+	IDirect3DBaseTexture9 *pSourceTexture,
+	IDirect3DBaseTexture9 *pDestinationTexture)
+{
+	gldRec.Frame.dwCopies++;
+	return _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->UpdateTexture(This, pSourceTexture, pDestinationTexture);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldRecCreateTexture(
+	IDirect3DDevice9 *This,
+	UINT Width,
+	UINT Height,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DTexture9 **ppTexture,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	gldRec.Frame.dwCreates++;
+	hr = _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->CreateTexture(This, Width, Height, Levels, Usage, Format, Pool, ppTexture, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldHookObject(*ppTexture, sizeof(IDirect3DTexture9Vtbl), _gldHookTextureVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecCreateVertexBuffer(
+	IDirect3DDevice9 *This,
+	UINT Length,
+	DWORD Usage,
+	DWORD FVF,
+	D3DPOOL Pool,
+	IDirect3DVertexBuffer9 **ppVertexBuffer,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	gldRec.Frame.dwCreates++;
+	hr = _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->CreateVertexBuffer(This, Length, Usage, FVF, Pool, ppVertexBuffer, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldHookObject(*ppVertexBuffer, sizeof(IDirect3DVertexBuffer9Vtbl), _gldHookVertexBufferVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecCreateIndexBuffer(
+	IDirect3DDevice9 *This,
+	UINT Length,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DIndexBuffer9 **ppIndexBuffer,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	gldRec.Frame.dwCreates++;
+	hr = _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->CreateIndexBuffer(This, Length, Usage, Format, Pool, ppIndexBuffer, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldHookObject(*ppIndexBuffer, sizeof(IDirect3DIndexBuffer9Vtbl), _gldHookIndexBufferVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldRecCreateOffscreenPlainSurface(
+	IDirect3DDevice9 *This,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DSurface9 **ppSurface,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	gldRec.Frame.dwCreates++;
+	hr = _GLD_REC_REAL(IDirect3DDevice9Vtbl, This)->CreateOffscreenPlainSurface(This, Width, Height, Format, Pool, ppSurface, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldHookObject(*ppSurface, sizeof(IDirect3DSurface9Vtbl), _gldHookSurfaceVtbl);
+	return hr;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldHookDeviceVtbl(
+	void *pVtbl)
+{
+	IDirect3DDevice9Vtbl *v = (IDirect3DDevice9Vtbl*)pVtbl;
+
+	v->Present						= _gldRecPresent;
+	v->DrawPrimitive				= _gldRecDrawPrimitive;
+	v->DrawIndexedPrimitive			= _gldRecDrawIndexedPrimitive;
+	v->DrawPrimitiveUP				= _gldRecDrawPrimitiveUP;
+	v->DrawIndexedPrimitiveUP		= _gldRecDrawIndexedPrimitiveUP;
+	v->SetRenderState				= _gldRecSetRenderState;
+	v->SetSamplerState				= _gldRecSetSamplerState;
+	v->SetTextureStageState			= _gldRecSetTextureStageState;
+	v->SetTransform					= _gldRecSetTransform;
+	v->SetTexture					= _gldRecSetTexture;
+	v->SetStreamSource				= _gldRecSetStreamSource;
+	v->SetIndices					= _gldRecSetIndices;
+	v->SetVertexDeclaration			= _gldRecSetVertexDeclaration;
+	v->SetFVF						= _gldRecSetFVF;
+	v->SetVertexShader				= _gldRecSetVertexShader;
+	v->SetPixelShader				= _gldRecSetPixelShader;
+	v->SetVertexShaderConstantF		= _gldRecSetVertexShaderConstantF;
+	v->SetPixelShaderConstantF		= _gldRecSetPixelShaderConstantF;
+	v->Clear						= _gldRecClear;
+	v->StretchRect					= _gldRecStretchRect;
+	v->GetRenderTargetData			= _gldRecGetRenderTargetData;
+	v->UpdateSurface				= _gldRecUpdateSurface;
+	v->UpdateTexture				= _gldRecUpdateTexture;
+	v->CreateTexture				= _gldRecCreateTexture;
+	v->CreateVertexBuffer			= _gldRecCreateVertexBuffer;
+	v->CreateIndexBuffer			= _gldRecCreateIndexBuffer;
+	v->CreateOffscreenPlainSurface	= _gldRecCreateOffscreenPlainSurface;
+}
+
+//---------------------------------------------------------------------------
+
+void gldStartRecording(
+	IDirect3DDevice9 *pDev)
+{
+	//
+	// Record pDev and everything it creates from now on. Called straight
+	// after the device is created, so the buffers are recorded too. The
+	// profiler shows the counts, so it turns the recorder on as well.
+	//
+
+	if ((!glb.szRecordFile[0] && !glb.szProfileFile[0]) || !pDev)
+		return;
+
+	_gldHookObject(pDev, sizeof(IDirect3DDevice9Vtbl), _gldHookDeviceVtbl);
+
+	if (gldRec.nDevices++)
+		return;
+
+	QueryPerformanceFrequency(&gldRec.liFreq);
+	gldRec.liFrameStart.QuadPart = 0;
+	ZeroMemory(&gldRec.Frame, sizeof(gldRec.Frame));
+	ZeroMemory(&gldRec.LastFrame, sizeof(gldRec.LastFrame));
+	ZeroMemory(gldRec.qwTotals, sizeof(gldRec.qwTotals));
+	gldRec.dwFrames		= 0;
+	gldRec.qwTotalTicks	= 0;
+
+	if (!glb.szRecordFile[0])
+		return;
+
+	// Start a new file per process; later devices append to it
+	gldRec.fp = fopen(glb.szRecordFile, gldRec.bFileWritten ? "a" : "w");
+	if (!gldRec.fp) {
+		gldLogPrintf(GLDLOG_WARN, "Recorder: unable to open %s", glb.szRecordFile);
+		return;
+	}
+	if (!gldRec.bFileWritten)
+		fputs(szRecHeader, gldRec.fp);
+	gldRec.bFileWritten = TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldStopRecording(
+	IDirect3DDevice9 *pDev)
+{
+	if (!gldRec.nDevices || !pDev)
+		return;
+	if (--gldRec.nDevices)
+		return;
+
+	if (gldRec.fp) {
+		fclose(gldRec.fp);
+		gldRec.fp = NULL;
+	}
+
+	if (!gldRec.dwFrames)
+		return;
+	gldLogPrintf(GLDLOG_INFO, "Recorder: %u frames, CPU us/frame %I64u avg, %I64u min, %I64u max",
+		gldRec.dwFrames,
+		gldRec.qwTotalTicks * 1000000 / gldRec.dwFrames / gldRec.liFreq.QuadPart,
+		(ULONGLONG)gldRec.qMinTicks * 1000000 / gldRec.liFreq.QuadPart,
+		(ULONGLONG)gldRec.qMaxTicks * 1000000 / gldRec.liFreq.QuadPart);
+	gldLogPrintf(GLDLOG_INFO, "Recorder: per frame %I64u draws, %I64u prims, %I64u states, %I64u textures, %I64u streams, %I64u locks, %I64u lock bytes",
+		_GLD_REC_AVERAGE(dwDraws),
+		_GLD_REC_AVERAGE(dwPrims),
+		_GLD_REC_AVERAGE(dwStates),
+		_GLD_REC_AVERAGE(dwTextures),
+		_GLD_REC_AVERAGE(dwStreams),
+		_GLD_REC_AVERAGE(dwVBLocks) + _GLD_REC_AVERAGE(dwIBLocks) + _GLD_REC_AVERAGE(dwTexLocks) + _GLD_REC_AVERAGE(dwSurfLocks),
+		_GLD_REC_AVERAGE(dwLockBytes));
+}
+
+//---------------------------------------------------------------------------
+
+void gldGetRecordedFrame(
+	GLD_frameCounts *pCounts)
+{
+	// Counts of the last whole frame, or zeros if nothing is recorded
+	const GLD_recCounts *f = &gldRec.LastFrame;
+
+	if (!gldRec.nDevices) {
+		ZeroMemory(pCounts, sizeof(*pCounts));
+		return;
+	}
+	pCounts->dwDraws		= f->dwDraws;
+	pCounts->dwStates		= f->dwStates + f->dwTextures + f->dwStreams + f->dwShaders;
+	pCounts->dwLocks		= f->dwVBLocks + f->dwIBLocks + f->dwTexLocks + f->dwSurfLocks;
+	pCounts->dwUploadBytes	= f->dwLockBytes + f->dwUPBytes;
+}
+
+//---------------------------------------------------------------------------
@@ -0,0 +1,300 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Persistent on-disk cache of compiled run-time effects.
+*
+*********************************************************************************/
+
+#pragma warning( disable:4996) // secure versions of strcat(), etc
+
+#include "gld_context.h"
+#include "gld_globals.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+//---------------------------------------------------------------------------
+// Defines
+//---------------------------------------------------------------------------
+
+// Entries larger than this are assumed to be corrupt
+#define GLD_SHADER_CACHE_MAX_ENTRY	(1024*1024)
+
+//---------------------------------------------------------------------------
+
+static DWORD _gldShaderCacheChecksum(
+	DWORD dwChecksum,
+	const void *pData,
+	DWORD dwSize)
+{
+	//
+	// Adler-32. Pass 1 for the first block.
+	//
+
+	const BYTE	*p	= (const BYTE*)pData;
+	DWORD		a	= dwChecksum & 0xffff;
+	DWORD		b	= dwChecksum >> 16;
+	DWORD		n;
+
+	while (dwSize) {
+		// 5552 is the largest block that cannot overflow b
+		n = (dwSize < 5552) ? dwSize : 5552;
+		dwSize -= n;
+		while (n--) {
+			a += *p++;
+			b += a;
+		}
+		a %= 65521;
+		b %= 65521;
+	}
+
+	return (b << 16) | a;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldShaderCacheFilename(
+	const GLD_effect_state *pEffectState,
+	DWORD dwHash,
+	char *pszFile)
+{
+	//
+	// The effect cache hash is only 32 bits. An Adler-32 of the state is
+	// appended, so that two states whose hashes collide do not keep
+	// replacing each other's entry. The state stored in the entry is
+	// still compared on load.
+	//
+
+	DWORD dwChecksum = _gldShaderCacheChecksum(1, pEffectState, sizeof(GLD_effect_state));
+
+	sprintf(pszFile, "%s\\%08x%08x.gfx", glb.szShaderCachePath, dwHash, dwChecksum);
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldReadShaderCacheFile(
+	GLD_driver_dx9 *gld,
+	const char *pszFile,
+	GLD_effect_state *pEffectState,
+	void **ppData,
+	DWORD *pdwDataSize)
+{
+	//
+	// Read and validate a shader cache entry.
+	// Entries written by another driver version or for another device are rejected.
+	//
+
+	FILE					*fp;
+	GLD_shaderCacheHeader	hdr;
+	BYTE					*pEntry;
+	DWORD					dwEntrySize;
+	DWORD					dwChecksum;
+
+	fp = fopen(pszFile, "rb");
+	if (fp == NULL)
+		return FALSE;
+
+	if ((fread(&hdr, sizeof(hdr), 1, fp) != 1) ||
+		(hdr.dwMagic != GLD_SHADER_CACHE_MAGIC) ||
+		(hdr.dwVersion != GLD_SHADER_CACHE_VERSION) ||
+		(hdr.dwD3DXVersion != D3DX_SDK_VERSION) ||
+		(hdr.dwStateSize != sizeof(GLD_effect_state)) ||
+		(hdr.dwVSTarget != gld->dwVSTarget) ||
+		(hdr.dwPSTarget != gld->dwPSTarget) ||
+		(hdr.dwFlags != gld->dwEffectFlags) ||
+		(hdr.dwDataSize == 0) ||
+		(hdr.dwSourceSize > GLD_SHADER_CACHE_MAX_ENTRY) ||
+		(hdr.dwDataSize > GLD_SHADER_CACHE_MAX_ENTRY))
+	{
+		fclose(fp);
+		return FALSE;
+	}
+
+	dwEntrySize = hdr.dwStateSize + hdr.dwSourceSize + hdr.dwDataSize;
+	pEntry = (BYTE*)malloc(dwEntrySize);
+	if (pEntry == NULL) {
+		fclose(fp);
+		return FALSE;
+	}
+	if (fread(pEntry, dwEntrySize, 1, fp) != 1) {
+		free(pEntry);
+		fclose(fp);
+		return FALSE;
+	}
+	fclose(fp);
+
+	dwChecksum = _gldShaderCacheChecksum(1, pEntry, dwEntrySize);
+	if (dwChecksum != hdr.dwChecksum) {
+		gldLogPrintf(GLDLOG_WARN, "Shader cache: %s is corrupt", pszFile);
+		free(pEntry);
+		return FALSE;
+	}
+
+	// Move the compiled effect to the front; the caller owns the buffer.
+	memcpy(pEffectState, pEntry, sizeof(GLD_effect_state));
+	memmove(pEntry, pEntry + hdr.dwStateSize + hdr.dwSourceSize, hdr.dwDataSize);
+	*ppData			= pEntry;
+	*pdwDataSize	= hdr.dwDataSize;
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldPreloadShaderCache(
+	GLD_driver_dx9 *gld)
+{
+	//
+	// Create every cached effect for this device up front, so that the
+	// state combinations seen in previous runs do not stall when first used.
+	//
+
+	WIN32_FIND_DATA		fd;
+	HANDLE				hFind;
+	char				szFile[MAX_PATH];
+	GLD_effect_state	State;
+	void				*pData;
+	DWORD				dwDataSize;
+	int					nLoaded		= 0;
+	int					nSkipped	= 0;
+
+	if (glb.szShaderCachePath[0] == '\0')
+		return;
+
+	sprintf(szFile, "%s\\*.gfx", glb.szShaderCachePath);
+	hFind = FindFirstFile(szFile, &fd);
+	if (hFind == INVALID_HANDLE_VALUE)
+		return;
+
+	do {
+		sprintf(szFile, "%s\\%s", glb.szShaderCachePath, fd.cFileName);
+		if (!_gldReadShaderCacheFile(gld, szFile, &State, &pData, &dwDataSize)) {
+			nSkipped++;
+			continue;
+		}
+		if (gldPreloadEffect(gld, &State, pData, dwDataSize))
+			nLoaded++;
+		else
+			nSkipped++;
+		free(pData);
+	} while ((gld->nEffects < GLD_MAX_EFFECTS) && FindNextFile(hFind, &fd));
+
+	FindClose(hFind);
+
+	gldLogPrintf(GLDLOG_INFO, "Shader cache: preloaded %d effects, skipped %d", nLoaded, nSkipped);
+}
+
+//---------------------------------------------------------------------------
+
+BOOL gldReadShaderCache(
+	GLD_driver_dx9 *gld,
+	const GLD_effect_state *pEffectState,
+	DWORD dwHash,
+	void **ppData,
+	DWORD *pdwDataSize)
+{
+	char				szFile[MAX_PATH];
+	GLD_effect_state	State;
+
+	if (glb.szShaderCachePath[0] == '\0')
+		return FALSE;
+
+	_gldShaderCacheFilename(pEffectState, dwHash, szFile);
+	if (!_gldReadShaderCacheFile(gld, szFile, &State, ppData, pdwDataSize))
+		return FALSE;
+
+	// Guard against hash collisions
+	if (memcmp(&State, pEffectState, sizeof(GLD_effect_state)) != 0) {
+		free(*ppData);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldWriteShaderCache(
+	GLD_driver_dx9 *gld,
+	const GLD_effect_state *pEffectState,
+	DWORD dwHash,
+	const char *pszSource,
+	const void *pData,
+	DWORD dwDataSize)
+{
+	//
+	// Write to a temporary file and rename it into place, so that another
+	// process reading the cache never sees a partial entry.
+	//
+
+	FILE					*fp;
+	GLD_shaderCacheHeader	hdr;
+	char					szFile[MAX_PATH];
+	char					szTemp[MAX_PATH];
+	BOOL					bOK;
+
+	if (glb.szShaderCachePath[0] == '\0')
+		return;
+
+	// Fails harmlessly if the directory already exists
+	CreateDirectory(glb.szShaderCachePath, NULL);
+
+	_gldShaderCacheFilename(pEffectState, dwHash, szFile);
+	sprintf(szTemp, "%s.%lu", szFile, GetCurrentProcessId());
+
+	hdr.dwMagic			= GLD_SHADER_CACHE_MAGIC;
+	hdr.dwVersion		= GLD_SHADER_CACHE_VERSION;
+	hdr.dwD3DXVersion	= D3DX_SDK_VERSION;
+	hdr.dwStateSize		= sizeof(GLD_effect_state);
+	hdr.dwVSTarget		= gld->dwVSTarget;
+	hdr.dwPSTarget		= gld->dwPSTarget;
+	hdr.dwFlags			= gld->dwEffectFlags;
+	hdr.dwHash			= dwHash;
+	hdr.dwSourceSize	= strlen(pszSource);
+	hdr.dwDataSize		= dwDataSize;
+	hdr.dwChecksum		= _gldShaderCacheChecksum(1, pEffectState, sizeof(GLD_effect_state));
+	hdr.dwChecksum		= _gldShaderCacheChecksum(hdr.dwChecksum, pszSource, hdr.dwSourceSize);
+	hdr.dwChecksum		= _gldShaderCacheChecksum(hdr.dwChecksum, pData, dwDataSize);
+
+	fp = fopen(szTemp, "wb");
+	if (fp == NULL)
+		return;
+	bOK =	(fwrite(&hdr, sizeof(hdr), 1, fp) == 1) &&
+			(fwrite(pEffectState, sizeof(GLD_effect_state), 1, fp) == 1) &&
+			(fwrite(pszSource, hdr.dwSourceSize, 1, fp) == 1) &&
+			(fwrite(pData, dwDataSize, 1, fp) == 1);
+	if (fclose(fp) != 0)
+		bOK = FALSE;
+
+	if (!bOK || !MoveFileEx(szTemp, szFile, MOVEFILE_REPLACE_EXISTING)) {
+		gldLogPrintf(GLDLOG_WARN, "Shader cache: unable to write %s", szFile);
+		DeleteFile(szTemp);
+	}
+}
+
+//---------------------------------------------------------------------------
@@ -267,16 +267,13 @@ static const char *g_pszTestEffectTextured =
 // Shader Text
 //---------------------------------------------------------------------------
 
+// VS_INPUT is built from the vertex format. See _gldBuildVertexShaderInput().
 static const char *g_pszVertexShaderInput =
 "\n"
 "struct VS_INPUT\n"
 "{\n"
 "    float4 Pos  : POSITION;\n"
-"    float4 Diff : COLOR0;\n"
-"    float3 Norm : NORMAL;\n"
-"    float4 Tex0 : TEXCOORD0;\n"
-"    float4 Tex1 : TEXCOORD1;\n"
-"};\n";
+"    float4 Diff : COLOR0;\n";
 
 //---------------------------------------------------------------------------
 
@@ -511,25 +508,66 @@ static D3DXHANDLE _gldGetIndexedEffectVariable(
 
 //---------------------------------------------------------------------------
 
-static __inline void _gldSetEffectVector(
-	ID3DXEffect *pEffect,
-	D3DXHANDLE hParam,
+static __inline void _gldShadowParam(
+	GLD_driver_dx9 *gld,
+	int iParam,			// GLD_PARAM_* group
+	void *pShadow,
+	const void *pValue,
+	size_t size)
+{
+	// Update a shadow copy. Bump the group generation only if the value changed.
+	if (memcmp(pShadow, pValue, size) != 0) {
+		memcpy(pShadow, pValue, size);
+		gld->dwParamGen[iParam]++;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static __inline void _gldShadowParamVector(
+	GLD_driver_dx9 *gld,
+	int iParam,
+	D3DXVECTOR4 *pShadow,
 	const GLfloat *p4f)
 {
-	// Update the shader parameter with the supplied vector
 	D3DXVECTOR4 d3dxVec;
 
+	gl4fToVec4(&d3dxVec, p4f);
+	_gldShadowParam(gld, iParam, pShadow, &d3dxVec, sizeof(d3dxVec));
+}
+
+//---------------------------------------------------------------------------
+
+static __inline void _gldSetEffectVector(
+	GLD_driver_dx9 *gld,
+	ID3DXEffect *pEffect,
+	D3DXHANDLE hParam,
+	const D3DXVECTOR4 *pVec)
+{
 	if (!hParam)
 		return;
 
-	d3dxVec.x = p4f[0];
-	d3dxVec.y = p4f[1];
-	d3dxVec.z = p4f[2];
-	d3dxVec.w = p4f[3];
+	ASSERT(pEffect);
+
+	ID3DXEffect_SetVector(pEffect, hParam, pVec);
+	gld->dwParamBytes += sizeof(D3DXVECTOR4);
+}
+
+//---------------------------------------------------------------------------
+
+static __inline void _gldSetEffectMatrix(
+	GLD_driver_dx9 *gld,
+	ID3DXEffect *pEffect,
+	D3DXHANDLE hParam,
+	const D3DXMATRIX *pMat)
+{
+	if (!hParam)
+		return;
 
 	ASSERT(pEffect);
 
-	ID3DXEffect_SetVector(pEffect, hParam, &d3dxVec);
+	ID3DXEffect_SetMatrix(pEffect, hParam, pMat);
+	gld->dwParamBytes += sizeof(D3DXMATRIX);
 }
 
 //---------------------------------------------------------------------------
@@ -970,6 +1008,85 @@ static void _gldBuildLightingFace(
 
 //---------------------------------------------------------------------------
 
+static void _gldBuildVertexShaderInput(
+	char *pszHLSL,
+	DWORD dwVF)
+{
+	//
+	// Only declare the inputs present in the compact vertex format.
+	// Texcoords are always read as float4; D3D fills in z=0, w=1 for float2 elements.
+	//
+
+	int		i;
+	char	szLine[256];
+
+	strcat(pszHLSL, g_pszVertexShaderInput);
+	if (dwVF & GLD_VF_NORMAL)
+		strcat(pszHLSL, "    float3 Norm : NORMAL;\n");
+	for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++) {
+		if (dwVF & (GLD_VF_TEX2(i) | GLD_VF_TEX4(i))) {
+			sprintf(szLine, "    float4 Tex%d : TEXCOORD%d;\n", i, i);
+			strcat(pszHLSL, szLine);
+		}
+	}
+	strcat(pszHLSL, "};\n");
+}
+
+//---------------------------------------------------------------------------
+
+static DWORD _gldVertexFormat(
+	const GLD_effect_state *pState)
+{
+	//
+	// Determine which vertex elements the vertex shader for this state will read.
+	// Must agree with the inputs referenced by _gldBuildShaderText().
+	//
+
+	const GLuint	uiGenHandled = TEXGEN_SPHERE_MAP | TEXGEN_OBJ_LINEAR | TEXGEN_EYE_LINEAR;
+	int				i;
+	DWORD			dwVF = 0;
+	GLuint			uiUnitMask;
+	GLuint			uiGen, uiRead;
+
+	// Normals are needed for lighting and some texgen modes
+	if ((pState->Texture._GenFlags & TEXGEN_NEED_NORMALS) || pState->Light.Enabled)
+		dwVF |= GLD_VF_NORMAL;
+
+	// Texcoords are needed by enabled units for every component that is not
+	// generated. _gldTexGenFunctionString() falls back to In.TexN for texgen
+	// modes it has no HLSL for (reflection and normal map), so those count
+	// as read too. Only .xy is sampled, unless a texture matrix mixes in .zw.
+	for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++) {
+		uiUnitMask = (1 << i);
+		if (!(pState->Texture._EnabledUnits & uiUnitMask))
+			continue;
+		uiGen = pState->Texture.Unit[i].TexGenEnabled;
+		if (!uiGen) {
+			uiRead = S_BIT | T_BIT;
+		} else {
+			uiRead = 0;
+			if ((uiGen & S_BIT) && !(pState->Texture.Unit[i]._GenBitS & uiGenHandled))
+				uiRead |= S_BIT;
+			if ((uiGen & T_BIT) && !(pState->Texture.Unit[i]._GenBitT & uiGenHandled))
+				uiRead |= T_BIT;
+			if ((uiGen & R_BIT) && !(pState->Texture.Unit[i]._GenBitR & uiGenHandled))
+				uiRead |= R_BIT;
+			if ((uiGen & Q_BIT) && !(pState->Texture.Unit[i]._GenBitQ & uiGenHandled))
+				uiRead |= Q_BIT;
+		}
+		if (!uiRead)
+			continue;
+		if ((pState->Texture._TexMatEnabled & uiUnitMask) || (uiRead & (R_BIT | Q_BIT)))
+			dwVF |= GLD_VF_TEX4(i);
+		else
+			dwVF |= GLD_VF_TEX2(i);
+	}
+
+	return dwVF;
+}
+
+//---------------------------------------------------------------------------
+
 static char *_gldBuildShaderText(
 	const GLD_effect *pGLDEffect,
 	DWORD dwVSVersion,	// Vertex Shader version
@@ -1044,7 +1161,7 @@ static char *_gldBuildShaderText(
 	//
 
 	// Default structs
-	strcat(pszHLSL, g_pszVertexShaderInput);
+	_gldBuildVertexShaderInput(pszHLSL, pState->VertexFormat);
 	strcat(pszHLSL, (pState->Fog.Enabled) ? g_pszVertexShaderOutputFog : g_pszVertexShaderOutput);
 	if (pState->Light.Enabled) {
 		strcat(pszHLSL, g_pszGLD_HLSL_light);
@@ -1496,95 +1613,234 @@ static char *_gldBuildShaderText(
 
 //---------------------------------------------------------------------------
 
-static int _gldFindEffect(
-	GLD_driver_dx9 *gld,
+// Effect cache
+//---------------------------------------------------------------------------
+
+static DWORD _gldHashEffectState(
 	const GLD_effect_state *pEffectState)
+{
+	//
+	// FNV-1a digest of the effect state.
+	// The state is zeroed before it is filled in, so padding bytes are always zero.
+	//
+
+	const BYTE	*p		= (const BYTE*)pEffectState;
+	DWORD		dwHash	= 2166136261;
+	int			i;
+
+	for (i=0; i<sizeof(GLD_effect_state); i++) {
+		dwHash ^= p[i];
+		dwHash *= 16777619;
+	}
+
+	return dwHash;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldUnlinkEffectLRU(
+	GLD_driver_dx9 *gld,
+	int iEffect)
+{
+	GLD_effect *pGLDEffect = &gld->Effects[iEffect];
+
+	if (pGLDEffect->iLRUPrev >= 0)
+		gld->Effects[pGLDEffect->iLRUPrev].iLRUNext = pGLDEffect->iLRUNext;
+	else
+		gld->iEffectMRU = pGLDEffect->iLRUNext;
+
+	if (pGLDEffect->iLRUNext >= 0)
+		gld->Effects[pGLDEffect->iLRUNext].iLRUPrev = pGLDEffect->iLRUPrev;
+	else
+		gld->iEffectLRU = pGLDEffect->iLRUPrev;
+
+	pGLDEffect->iLRUPrev = pGLDEffect->iLRUNext = -1;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldPushEffectMRU(
+	GLD_driver_dx9 *gld,
+	int iEffect)
+{
+	GLD_effect *pGLDEffect = &gld->Effects[iEffect];
+
+	pGLDEffect->iLRUPrev = -1;
+	pGLDEffect->iLRUNext = gld->iEffectMRU;
+	if (gld->iEffectMRU >= 0)
+		gld->Effects[gld->iEffectMRU].iLRUPrev = iEffect;
+	else
+		gld->iEffectLRU = iEffect;
+	gld->iEffectMRU = iEffect;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldUnlinkEffectHash(
+	GLD_driver_dx9 *gld,
+	int iEffect)
+{
+	int *pLink = &gld->iEffectHash[gld->Effects[iEffect].dwHash & (GLD_EFFECT_HASH_SIZE-1)];
+
+	while (*pLink >= 0) {
+		if (*pLink == iEffect) {
+			*pLink = gld->Effects[iEffect].iHashNext;
+			break;
+		}
+		pLink = &gld->Effects[*pLink].iHashNext;
+	}
+	gld->Effects[iEffect].iHashNext = -1;
+}
+
+//---------------------------------------------------------------------------
+
+static int _gldAllocEffect(
+	GLD_driver_dx9 *gld)
+{
+	//
+	// Obtain a free effect slot, evicting the least recently used effect if full.
+	//
+
+	int iEffect;
+
+	// Previously freed slot
+	if (gld->iEffectFree >= 0) {
+		iEffect = gld->iEffectFree;
+		gld->iEffectFree = gld->Effects[iEffect].iHashNext;
+		return iEffect;
+	}
+
+	// Unused slot
+	if (gld->nEffects < GLD_MAX_EFFECTS)
+		return gld->nEffects++;
+
+	// Evict. Never evict the effect that is currently begun.
+	iEffect = gld->iEffectLRU;
+	if (iEffect == gld->iLastEffect)
+		iEffect = gld->Effects[iEffect].iLRUPrev;
+	if (iEffect < 0)
+		return -1;
+
+	_gldUnlinkEffectLRU(gld, iEffect);
+	_gldUnlinkEffectHash(gld, iEffect);
+	SAFE_RELEASE(gld->Effects[iEffect].pEffect);
+	gld->EffectStats.dwEvictions++;
+
+	return iEffect;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldFreeEffect(
+	GLD_driver_dx9 *gld,
+	int iEffect)
+{
+	// Return a slot that could not be filled to the free list
+	gld->Effects[iEffect].pEffect	= NULL;
+	gld->Effects[iEffect].iHashNext	= gld->iEffectFree;
+	gld->iEffectFree				= iEffect;
+}
+
+//---------------------------------------------------------------------------
+
+static int _gldLookupEffect(
+	GLD_driver_dx9 *gld,
+	const GLD_effect_state *pEffectState,
+	DWORD dwHash)
+{
+	int			iEffect;
+	GLD_effect	*pGLDEffect;
+
+	for (iEffect = gld->iEffectHash[dwHash & (GLD_EFFECT_HASH_SIZE-1)]; iEffect >= 0; iEffect = pGLDEffect->iHashNext) {
+		pGLDEffect = &gld->Effects[iEffect];
+		if ((pGLDEffect->dwHash == dwHash) &&
+			(memcmp(&pGLDEffect->State, pEffectState, sizeof(GLD_effect_state)) == 0))
+			return iEffect;
+	}
+
+	return -1;
+}
+
+//---------------------------------------------------------------------------
+
+static ID3DXBuffer *_gldCompileEffect(
+	GLD_driver_dx9 *gld,
+	const char *pszEffect)
+{
+	//
+	// Compile HLSL effect text to a binary effect that can be
+	// stored in the shader cache and handed to D3DXCreateEffect().
+	//
+
+	HRESULT				hr;
+	ID3DXEffectCompiler	*pCompiler	= NULL;
+	ID3DXBuffer			*pData		= NULL;
+
+	gld->EffectStats.dwCompiles++;
+
+	hr = D3DXCreateEffectCompiler(
+			pszEffect,				// effect text
+			strlen(pszEffect),
+			NULL,					// macro defines
+			NULL,					// includes
+			gld->dwEffectFlags,		// Flags
+			&pCompiler,
+			NULL					// Ptr to buffer returning compile errors
+			);
+	if (FAILED(hr))
+		return NULL;
+
+	hr = ID3DXEffectCompiler_CompileEffect(pCompiler, gld->dwEffectFlags, &pData, NULL);
+	SAFE_RELEASE(pCompiler);
+	if (FAILED(hr)) {
+		SAFE_RELEASE(pData);
+		return NULL;
+	}
+
+	return pData;
+}
+
+//---------------------------------------------------------------------------
+
+static int _gldCreateEffect(
+	GLD_driver_dx9 *gld,
+	const GLD_effect_state *pEffectState,
+	DWORD dwHash,
+	const void *pData,		// Effect text or compiled effect
+	DWORD dwDataSize)
 {
 	int				i;
+	int				iEffect;
 	HRESULT			hr;
-	DWORD			dwFlags;
 	GLD_effect		*pGLDEffect;
 	ID3DXEffect		*pEffect;
-	char			*pszEffect;
 	GLD_handles		*pHandles;
 
-	// See if effect has already been cached.
-	pGLDEffect = gld->Effects;
-	for (i=0; i<gld->nEffects; i++, pGLDEffect++) {
-		if (memcmp(&pGLDEffect->State, pEffectState, sizeof(GLD_effect_state)) == 0)
-			return i; // Found a matching effect. Return its index.
-	}
-
-	//
-	// Effect not found. Create it.
-	//
+	iEffect = _gldAllocEffect(gld);
+	if (iEffect < 0)
+		return -1;
+	pGLDEffect = &gld->Effects[iEffect];
 
 	// Reset all vars in effect
 	ZeroMemory(pGLDEffect, sizeof(GLD_effect));
 
 	// Copy effect details
 	pGLDEffect->State = *pEffectState;
-#if 1
-	// ENABLE THIS TO FIX MISSING FOG IN MOHAA
-	// SM 3.x is not working with DX 9.0b SDK; remove this when 9.0c SDK build works
-    if (D3DSHADER_VERSION_MAJOR(gld->d3dCaps9.VertexShaderVersion) > 2 ||
-        D3DSHADER_VERSION_MAJOR(gld->d3dCaps9.PixelShaderVersion) > 2)
-        pszEffect = _gldBuildShaderText(pGLDEffect, D3DVS_VERSION(2,0), D3DPS_VERSION(2,0), gld->nEffects);
-    else
-    // end of DX 9.0b SDK hack
-#endif
-#if 1
-	pszEffect = _gldBuildShaderText(pGLDEffect, gld->d3dCaps9.VertexShaderVersion, gld->d3dCaps9.PixelShaderVersion, gld->nEffects);
-#else
-	// FOR TESTING ONLY
-	// Force compilation for a particular pixel shader target
-	//pszEffect = _gldBuildShaderText(pGLDEffect, D3DPS_VERSION(1,4), gld->nEffects);
-	//pszEffect = _gldBuildShaderText(pGLDEffect, D3DVS_VERSION(1,1), D3DPS_VERSION(1,1), gld->nEffects);
-	pszEffect = _gldBuildShaderText(pGLDEffect, D3DVS_VERSION(1,1), D3DPS_VERSION(1,3), gld->nEffects);
-#endif
-
-#ifdef _DEBUG
-	// Always debug shaders in DEBUG builds
-	dwFlags = D3DXSHADER_PARTIALPRECISION | D3DXSHADER_DEBUG;
-	// Problem with D3DXSHADER_SKIPOPTIMIZATION;
-#else
-	dwFlags = D3DXSHADER_PARTIALPRECISION;	// For nVidia parts
-#endif
-
-	// dwFlags |= D3DXSHADER_USE_LEGACY_D3DX9_31_DLL;
 
 	hr = D3DXCreateEffect(
 			gld->pDev,				// device
-			pszEffect,				// .fx filename and path
-			strlen(pszEffect),
+			pData,					// effect text or binary
+			dwDataSize,
 			NULL,					// macro defines
 			NULL,					// includes
-			dwFlags,				// Flags
+			gld->dwEffectFlags,		// Flags
 			gld->pEffectPool,		// pool
 			&pGLDEffect->pEffect,	// pointer to DX9 effect
 			NULL					// Ptr to buffer returning compile errors
 			);
-	free(pszEffect); // Done with effect text. Free memory before we return
 	if (FAILED(hr)) {
-#if 0
+		_gldFreeEffect(gld, iEffect);
 		return -1;
-#else
-		// Effect compilation failed. Fallback to a default effect.
-		hr = D3DXCreateEffect(
-				gld->pDev,				// device
-				g_pszDefaultEffect,		// .fx filename and path
-				strlen(g_pszDefaultEffect),
-				NULL,					// macro defines
-				NULL,					// includes
-				dwFlags,				// Flags
-				gld->pEffectPool,		// pool
-				&pGLDEffect->pEffect,	// pointer to DX9 effect
-				NULL					// Ptr to buffer returning compile errors
-				);
-		if (FAILED(hr)) {
-			return -1;
-		}
-#endif
 	}
 
 	// Obtain pointer for efficiency
@@ -1644,16 +1900,124 @@ static int _gldFindEffect(
 	// Obtain Techniques
 	pGLDEffect->hTechnique = ID3DXEffect_GetTechniqueByName(pGLDEffect->pEffect, "tecGLDirect");
 
-	// Return
-	i = gld->nEffects;
-	gld->nEffects++;
-	return i;
+	// Route the effect's state changes through the device state filter
+	ID3DXEffect_SetStateManager(pGLDEffect->pEffect, &gld->DevState.StateManager);
+
+	// Add to the cache
+	pGLDEffect->dwHash		= dwHash;
+	pGLDEffect->iHashNext	= gld->iEffectHash[dwHash & (GLD_EFFECT_HASH_SIZE-1)];
+	gld->iEffectHash[dwHash & (GLD_EFFECT_HASH_SIZE-1)] = iEffect;
+	_gldPushEffectMRU(gld, iEffect);
+
+	return iEffect;
 }
 
 //---------------------------------------------------------------------------
+
+static int _gldFindEffect(
+	GLD_driver_dx9 *gld,
+	const GLD_effect_state *pEffectState)
+{
+	int				iEffect;
+	DWORD			dwHash;
+	GLD_effect		TempEffect;
+	char			*pszEffect;
+	ID3DXBuffer		*pCompiled;
+	void			*pData;
+	DWORD			dwDataSize;
+
+	// See if effect has already been cached.
+	dwHash = _gldHashEffectState(pEffectState);
+	iEffect = _gldLookupEffect(gld, pEffectState, dwHash);
+	if (iEffect >= 0) {
+		// Found a matching effect. Return its index.
+		gld->EffectStats.dwHits++;
+		if (gld->iEffectMRU != iEffect) {
+			_gldUnlinkEffectLRU(gld, iEffect);
+			_gldPushEffectMRU(gld, iEffect);
+		}
+		return iEffect;
+	}
+	gld->EffectStats.dwMisses++;
+
+	//
+	// Effect not found. Try the shader cache on disk.
+	//
+
+	if (gldReadShaderCache(gld, pEffectState, dwHash, &pData, &dwDataSize)) {
+		iEffect = _gldCreateEffect(gld, pEffectState, dwHash, pData, dwDataSize);
+		free(pData);
+		if (iEffect >= 0) {
+			gld->EffectStats.dwDiskLoads++;
+			return iEffect;
+		}
+	}
+
+	//
+	// Not on disk either. Generate and compile it.
+	//
+
+	ZeroMemory(&TempEffect, sizeof(TempEffect));
+	TempEffect.State = *pEffectState;
+#if 1
+	pszEffect = _gldBuildShaderText(&TempEffect, gld->dwVSTarget, gld->dwPSTarget, gld->EffectStats.dwCompiles);
+#else
+	// FOR TESTING ONLY
+	// Force compilation for a particular pixel shader target
+	//pszEffect = _gldBuildShaderText(&TempEffect, D3DPS_VERSION(1,4), gld->EffectStats.dwCompiles);
+	//pszEffect = _gldBuildShaderText(&TempEffect, D3DVS_VERSION(1,1), D3DPS_VERSION(1,1), gld->EffectStats.dwCompiles);
+	pszEffect = _gldBuildShaderText(&TempEffect, D3DVS_VERSION(1,1), D3DPS_VERSION(1,3), gld->EffectStats.dwCompiles);
+#endif
+
+	pCompiled = _gldCompileEffect(gld, pszEffect);
+	if (pCompiled) {
+		pData		= ID3DXBuffer_GetBufferPointer(pCompiled);
+		dwDataSize	= ID3DXBuffer_GetBufferSize(pCompiled);
+		iEffect		= _gldCreateEffect(gld, pEffectState, dwHash, pData, dwDataSize);
+		if (iEffect >= 0)
+			gldWriteShaderCache(gld, pEffectState, dwHash, pszEffect, pData, dwDataSize);
+		SAFE_RELEASE(pCompiled);
+	}
+	free(pszEffect); // Done with effect text. Free memory before we return
+
+	if (iEffect < 0) {
+		// Effect compilation failed. Fallback to a default effect.
+		iEffect = _gldCreateEffect(gld, pEffectState, dwHash, g_pszDefaultEffect, strlen(g_pszDefaultEffect));
+	}
+
+	return iEffect;
+}
+
 //---------------------------------------------------------------------------
 
-void gldUpdateShaders(
+BOOL gldPreloadEffect(
+	GLD_driver_dx9 *gld,
+	const GLD_effect_state *pEffectState,
+	const void *pData,
+	DWORD dwDataSize)
+{
+	//
+	// Create an effect from a compiled shader cache entry ahead of use.
+	// Preloading never evicts; it stops once the cache is full.
+	//
+
+	DWORD dwHash = _gldHashEffectState(pEffectState);
+
+	if (_gldLookupEffect(gld, pEffectState, dwHash) >= 0)
+		return TRUE;
+	if ((gld->nEffects >= GLD_MAX_EFFECTS) && (gld->iEffectFree < 0))
+		return FALSE;
+	if (_gldCreateEffect(gld, pEffectState, dwHash, pData, dwDataSize) < 0)
+		return FALSE;
+
+	gld->EffectStats.dwDiskLoads++;
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+static void _gldUpdateShaders(
 	GLcontext *ctx)
 {
 	int								i;
@@ -1663,7 +2027,7 @@ void gldUpdateShaders(
 	GLD_effect						*pGLDEffect;
 	GLD_handles						*pHandles;
 	ID3DXEffect						*pEffect;
-	const struct gl_light			*glLit;
+	GLD_shaderParams				*pParams;
 	UINT							uiBytes;
 	BOOL							bEffectChanged = FALSE;
 
@@ -1686,7 +2050,7 @@ void gldUpdateShaders(
 		gldES.Texture._TexMatEnabled	= ctx->Texture._TexMatEnabled;
 		for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++) {
 			GLuint UnitMask = (GLuint)1 << i;
-			if (ctx->Texture._EnabledUnits && UnitMask) {
+			if (ctx->Texture._EnabledUnits & UnitMask) {
 				// Obtain pointers
 				const struct gl_texture_unit *glUnit	= &ctx->Texture.Unit[i];
 				GLD_effect_texunit *gldUnit				= &gldES.Texture.Unit[i];
@@ -1730,9 +2094,20 @@ void gldUpdateShaders(
 		}
 	}
 
+	//
+	// Vertex format
+	//
+	gldES.VertexFormat = _gldVertexFormat(&gldES);
+	// Compact formats are only used for indexed primitives
+	gld->dwVF = gld->bIndexedPrims ? gldES.VertexFormat : GLD_VF_FULL;
+	if (!gldCreateVertexFormat(gld, gld->dwVF))
+		gld->dwVF = GLD_VF_FULL;
+
 	// Find a matching effect (or create a new one)
 	gld->iCurEffect = -1;
+	GLD_PROFILE_BEGIN(GLD_PROFILE_FIND_EFFECT);
 	i = _gldFindEffect(gld, &gldES);
+	GLD_PROFILE_END(GLD_PROFILE_FIND_EFFECT);
 	if (i < 0) {
 		gldLogMessage(GLDLOG_ERROR, "FindEffect failed\n");
 		return;
@@ -1767,82 +2142,69 @@ void gldUpdateShaders(
 	}
 
 	//
-	// Now update Effect paramters
+	// Now update Effect paramters.
+	// Only groups that changed since this effect last saw them are uploaded.
 	//
 
-	pHandles = &pGLDEffect->Handles;
+#define _GLD_PARAM_DIRTY(p)		(pGLDEffect->dwParamGen[(p)] != gld->dwParamGen[(p)])
+#define _GLD_PARAM_CLEAN(p)		pGLDEffect->dwParamGen[(p)] = gld->dwParamGen[(p)]
+
+	pHandles	= &pGLDEffect->Handles;
+	pParams		= &gld->Params;
 
 	// matWorldViewProject must be set in all vertex shaders, otherwise the input vertex cannot be transformed!
 	ASSERT(pHandles->matWorldViewProject); // Sanity test in DEBUG builds
-	if (pHandles->matWorldViewProject)
-		ID3DXEffect_SetMatrix(pEffect, pHandles->matWorldViewProject, &gld->matModelViewProject);
-	if (pHandles->matWorldView)
-		ID3DXEffect_SetMatrix(pEffect, pHandles->matWorldView, &gld->matModelView);
-	if (pHandles->matInvWorldView)
-		ID3DXEffect_SetMatrix(pEffect, pHandles->matInvWorldView, &gld->matInvModelView);
+	if (_GLD_PARAM_DIRTY(GLD_PARAM_WORLDVIEWPROJECT)) {
+		_gldSetEffectMatrix(gld, pEffect, pHandles->matWorldViewProject, &pParams->matWorldViewProject);
+		_GLD_PARAM_CLEAN(GLD_PARAM_WORLDVIEWPROJECT);
+	}
+	if (_GLD_PARAM_DIRTY(GLD_PARAM_WORLDVIEW)) {
+		_gldSetEffectMatrix(gld, pEffect, pHandles->matWorldView, &pParams->matWorldView);
+		_gldSetEffectMatrix(gld, pEffect, pHandles->matInvWorldView, &pParams->matInvWorldView);
+		_GLD_PARAM_CLEAN(GLD_PARAM_WORLDVIEW);
+	}
 
 	//
 	// Only update light state if lighting is enabled
 	//
 	if (ctx->Light.Enabled) {
-		const struct gl_material	*mat = &ctx->Light.Material;
-		GLD_HLSL_light				Light;	// Ensure this is defined without packing!
-		// Global ambient light
-		_gldSetEffectVector(pEffect, pHandles->Ambient, ctx->Light.Model.Ambient);
-		// Front Material
-		_gldSetEffectVector(pEffect, pHandles->mtlFrontAmbient, mat->Attrib[MAT_ATTRIB_FRONT_AMBIENT]);
-		_gldSetEffectVector(pEffect, pHandles->mtlFrontDiffuse, mat->Attrib[MAT_ATTRIB_FRONT_DIFFUSE]);
-		_gldSetEffectVector(pEffect, pHandles->mtlFrontSpecular, mat->Attrib[MAT_ATTRIB_FRONT_SPECULAR]);
-		_gldSetEffectVector(pEffect, pHandles->mtlFrontEmissive, mat->Attrib[MAT_ATTRIB_FRONT_EMISSION]);
-		if (pHandles->mtlFrontShininess)
-			ID3DXEffect_SetFloat(pEffect, pHandles->mtlFrontShininess, mat->Attrib[MAT_ATTRIB_FRONT_SHININESS][0]);
-		// Back Material
-		if (ctx->Light.Model.TwoSide) {
-			_gldSetEffectVector(pEffect, pHandles->mtlBackAmbient, mat->Attrib[MAT_ATTRIB_BACK_AMBIENT]);
-			_gldSetEffectVector(pEffect, pHandles->mtlBackDiffuse, mat->Attrib[MAT_ATTRIB_BACK_DIFFUSE]);
-			_gldSetEffectVector(pEffect, pHandles->mtlBackSpecular, mat->Attrib[MAT_ATTRIB_BACK_SPECULAR]);
-			_gldSetEffectVector(pEffect, pHandles->mtlBackEmissive, mat->Attrib[MAT_ATTRIB_BACK_EMISSION]);
-			if (pHandles->mtlBackShininess)
-				ID3DXEffect_SetFloat(pEffect, pHandles->mtlBackShininess, mat->Attrib[MAT_ATTRIB_BACK_SHININESS][0]);
+		if (_GLD_PARAM_DIRTY(GLD_PARAM_MATERIAL)) {
+			// Global ambient light
+			_gldSetEffectVector(gld, pEffect, pHandles->Ambient, &pParams->Ambient);
+			// Front Material
+			_gldSetEffectVector(gld, pEffect, pHandles->mtlFrontAmbient, &pParams->mtlFrontAmbient);
+			_gldSetEffectVector(gld, pEffect, pHandles->mtlFrontDiffuse, &pParams->mtlFrontDiffuse);
+			_gldSetEffectVector(gld, pEffect, pHandles->mtlFrontSpecular, &pParams->mtlFrontSpecular);
+			_gldSetEffectVector(gld, pEffect, pHandles->mtlFrontEmissive, &pParams->mtlFrontEmissive);
+			if (pHandles->mtlFrontShininess) {
+				ID3DXEffect_SetFloat(pEffect, pHandles->mtlFrontShininess, pParams->mtlFrontShininess);
+				gld->dwParamBytes += sizeof(float);
+			}
+			// Back Material
+			if (ctx->Light.Model.TwoSide) {
+				_gldSetEffectVector(gld, pEffect, pHandles->mtlBackAmbient, &pParams->mtlBackAmbient);
+				_gldSetEffectVector(gld, pEffect, pHandles->mtlBackDiffuse, &pParams->mtlBackDiffuse);
+				_gldSetEffectVector(gld, pEffect, pHandles->mtlBackSpecular, &pParams->mtlBackSpecular);
+				_gldSetEffectVector(gld, pEffect, pHandles->mtlBackEmissive, &pParams->mtlBackEmissive);
+				if (pHandles->mtlBackShininess) {
+					ID3DXEffect_SetFloat(pEffect, pHandles->mtlBackShininess, pParams->mtlBackShininess);
+					gld->dwParamBytes += sizeof(float);
+				}
+			}
+			_GLD_PARAM_CLEAN(GLD_PARAM_MATERIAL);
 		}
 		// Lights
-		glLit = &ctx->Light.Light[0];
-		for (i=0; i<GLD_MAX_LIGHTS_DX9; i++, glLit++) {
-			if (pHandles->Lights[i]) {
-				gl4fToVec4(&Light.Front.Ambient, glLit->Ambient);
-				gl4fToVec4(&Light.Front.Diffuse, glLit->Diffuse);
-				gl4fToVec4(&Light.Front.Specular, glLit->Specular);
-				gl3fToVec4(&Light.Front._Ambient,	glLit->_MatAmbient[0]);
-				gl3fToVec4(&Light.Front._Diffuse,	glLit->_MatDiffuse[0]);
-				gl3fToVec4(&Light.Front._Specular,	glLit->_MatSpecular[0]);
-				if (ctx->Light.Model.TwoSide) {
-					gl4fToVec4(&Light.Back.Ambient, glLit->Ambient);
-					gl4fToVec4(&Light.Back.Diffuse, glLit->Diffuse);
-					gl4fToVec4(&Light.Back.Specular, glLit->Specular);
-					gl3fToVec4(&Light.Back._Ambient,	glLit->_MatAmbient[1]);
-					gl3fToVec4(&Light.Back._Diffuse,	glLit->_MatDiffuse[1]);
-					gl3fToVec4(&Light.Back._Specular,	glLit->_MatSpecular[1]);
-				}
-				if (glLit->_Flags & LIGHT_SPOT) {
-					gl4fToVec4(&Light.Position, glLit->_Position);
-					gl4fToVec4(&Light.Direction, glLit->EyeDirection);
-				} else if (glLit->_Flags & LIGHT_POSITIONAL) {
-					gl4fToVec4(&Light.Position, glLit->_Position);
-				} else {
-					Light.Direction = gld->LightDir[i];
-				}
-				Light.Attenuation.x	= glLit->ConstantAttenuation;
-				Light.Attenuation.y	= glLit->LinearAttenuation;
-				Light.Attenuation.z	= glLit->QuadraticAttenuation;
-				Light.SpotLight.x	= glLit->_CosCutoff;
-				Light.SpotLight.y	= glLit->SpotExponent;
+		for (i=0; i<GLD_MAX_LIGHTS_DX9; i++) {
+			if (pHandles->Lights[i] && _GLD_PARAM_DIRTY(GLD_PARAM_LIGHT0+i)) {
 #ifdef DEBUG
-				uiBytes = sizeof(Light);
+				uiBytes = sizeof(GLD_HLSL_light);
 #else
 				// Pass in D3DX_DEFAULT if you know you buffer is large enough to contain the entire parameter, and want to skip size validation.
 				uiBytes = D3DX_DEFAULT;
 #endif
-				ID3DXEffect_SetValue(pEffect, pHandles->Lights[i], &Light, uiBytes);
+				ID3DXEffect_SetValue(pEffect, pHandles->Lights[i], &pParams->Lights[i], uiBytes);
+				gld->dwParamBytes += sizeof(GLD_HLSL_light);
+				_GLD_PARAM_CLEAN(GLD_PARAM_LIGHT0+i);
 			}
 		}
 	}
@@ -1851,41 +2213,138 @@ void gldUpdateShaders(
 	if (ctx->Texture._EnabledUnits) {
 		// Texture units
 		for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++) {
-			const struct gl_texture_unit	*pUnit = &ctx->Texture.Unit[i];
-			const struct gl_texture_object	*tObj = pUnit->_Current;
-			// Diffuse Texture
-			if (pHandles->texDiffuse[i])
-				ID3DXEffect_SetTexture(pEffect, pHandles->texDiffuse[i], tObj->DriverData);
-			// Texture env colour (for GL_BLEND)
-			if (pHandles->EnvColor[i])
-				_gldSetEffectVector(pEffect, pHandles->EnvColor[i], &pUnit->EnvColor[0]);
-			// Eye plane texgen
-			if (pHandles->TexPlaneS[i])
-				_gldSetEffectVector(pEffect, pHandles->TexPlaneS[i], (pUnit->GenModeS == GL_OBJECT_LINEAR) ? &pUnit->ObjectPlaneS[0] : &pUnit->EyePlaneS[0]);
-			if (pHandles->TexPlaneT[i])
-				_gldSetEffectVector(pEffect, pHandles->TexPlaneT[i], (pUnit->GenModeT == GL_OBJECT_LINEAR) ? &pUnit->ObjectPlaneT[0] : &pUnit->EyePlaneT[0]);
-			if (pHandles->TexPlaneR[i])
-				_gldSetEffectVector(pEffect, pHandles->TexPlaneR[i], (pUnit->GenModeR == GL_OBJECT_LINEAR) ? &pUnit->ObjectPlaneR[0] : &pUnit->EyePlaneR[0]);
-			if (pHandles->TexPlaneQ[i])
-				_gldSetEffectVector(pEffect, pHandles->TexPlaneQ[i], (pUnit->GenModeQ == GL_OBJECT_LINEAR) ? &pUnit->ObjectPlaneQ[0] : &pUnit->EyePlaneQ[0]);
+			if (_GLD_PARAM_DIRTY(GLD_PARAM_TEXUNIT0+i)) {
+				// Diffuse Texture
+				if (pHandles->texDiffuse[i])
+					ID3DXEffect_SetTexture(pEffect, pHandles->texDiffuse[i], pParams->texDiffuse[i]);
+				// Texture env colour (for GL_BLEND)
+				_gldSetEffectVector(gld, pEffect, pHandles->EnvColor[i], &pParams->EnvColor[i]);
+				// Eye plane texgen
+				_gldSetEffectVector(gld, pEffect, pHandles->TexPlaneS[i], &pParams->TexPlaneS[i]);
+				_gldSetEffectVector(gld, pEffect, pHandles->TexPlaneT[i], &pParams->TexPlaneT[i]);
+				_gldSetEffectVector(gld, pEffect, pHandles->TexPlaneR[i], &pParams->TexPlaneR[i]);
+				_gldSetEffectVector(gld, pEffect, pHandles->TexPlaneQ[i], &pParams->TexPlaneQ[i]);
+				_GLD_PARAM_CLEAN(GLD_PARAM_TEXUNIT0+i);
+			}
+			if (_GLD_PARAM_DIRTY(GLD_PARAM_TEXMATRIX0+i)) {
+				// Texture matrix
+				_gldSetEffectMatrix(gld, pEffect, pHandles->matTexture[i], &pParams->matTexture[i]);
+				// Inverse Texture matrix
+				_gldSetEffectMatrix(gld, pEffect, pHandles->matInvTexture[i], &pParams->matInvTexture[i]);
+				_GLD_PARAM_CLEAN(GLD_PARAM_TEXMATRIX0+i);
+			}
 		}
 	}
 
-	// Only update texture state if texturing is enabled
-	if (ctx->Texture._EnabledUnits) {
-		// Texture units
+	// Only update fog state if fog is enabled
+	if (ctx->Fog.Enabled && _GLD_PARAM_DIRTY(GLD_PARAM_FOG)) {
+		_gldSetEffectVector(gld, pEffect, pHandles->Fog, &pParams->Fog);
+		_GLD_PARAM_CLEAN(GLD_PARAM_FOG);
+	}
+
+#undef _GLD_PARAM_DIRTY
+#undef _GLD_PARAM_CLEAN
+}
+
+//---------------------------------------------------------------------------
+
+void gldUpdateShaders(
+	GLcontext *ctx)
+{
+	// _gldUpdateShaders() has several ways out; time them all here
+	GLD_PROFILE_BEGIN(GLD_PROFILE_UPDATE_SHADERS);
+	_gldUpdateShaders(ctx);
+	GLD_PROFILE_END(GLD_PROFILE_UPDATE_SHADERS);
+}
+
+//---------------------------------------------------------------------------
+
+void gldDirtyShaderParams(
+	GLcontext *ctx,
+	GLuint new_state)
+{
+	//
+	// Called by the gld_NEW_* state handlers once the driver copy of the
+	// state is up to date. Refreshes the shadow copies of the effect
+	// parameters that depend on new_state, bumping the generation of any
+	// parameter group whose value actually changed.
+	//
+
+	GLD_context			*gldCtx		= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld		= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_shaderParams	*pParams	= &gld->Params;
+	int					i;
+
+	// Matrices
+	if (new_state & (_NEW_MODELVIEW | _NEW_PROJECTION)) {
+		_gldShadowParam(gld, GLD_PARAM_WORLDVIEWPROJECT, &pParams->matWorldViewProject, &gld->matModelViewProject, sizeof(D3DXMATRIX));
+	}
+	if (new_state & _NEW_MODELVIEW) {
+		_gldShadowParam(gld, GLD_PARAM_WORLDVIEW, &pParams->matWorldView, &gld->matModelView, sizeof(D3DXMATRIX));
+		_gldShadowParam(gld, GLD_PARAM_WORLDVIEW, &pParams->matInvWorldView, &gld->matInvModelView, sizeof(D3DXMATRIX));
+	}
+	if (new_state & _NEW_TEXTURE_MATRIX) {
 		for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++) {
-			// Texture matrix
-			if (pHandles->matTexture[i])
-				ID3DXEffect_SetMatrix(pEffect, pHandles->matTexture[i], &gld->matTexture[i]);
-			// Inverse Texture matrix
-			if (pHandles->matInvTexture[i])
-				ID3DXEffect_SetMatrix(pEffect, pHandles->matInvTexture[i], &gld->matInvTexture[i]);
+			_gldShadowParam(gld, GLD_PARAM_TEXMATRIX0+i, &pParams->matTexture[i], &gld->matTexture[i], sizeof(D3DXMATRIX));
+			_gldShadowParam(gld, GLD_PARAM_TEXMATRIX0+i, &pParams->matInvTexture[i], &gld->matInvTexture[i], sizeof(D3DXMATRIX));
 		}
 	}
 
-	// Only update fog state if fog is enabled
-	if (ctx->Fog.Enabled && pHandles->Fog) {
+	// Material and lights
+	if (new_state & _NEW_LIGHT) {
+		const struct gl_material	*mat = &ctx->Light.Material;
+		const struct gl_light		*glLit;
+		GLD_HLSL_light				Light;
+
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->Ambient, ctx->Light.Model.Ambient);
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->mtlFrontAmbient, mat->Attrib[MAT_ATTRIB_FRONT_AMBIENT]);
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->mtlFrontDiffuse, mat->Attrib[MAT_ATTRIB_FRONT_DIFFUSE]);
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->mtlFrontSpecular, mat->Attrib[MAT_ATTRIB_FRONT_SPECULAR]);
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->mtlFrontEmissive, mat->Attrib[MAT_ATTRIB_FRONT_EMISSION]);
+		_gldShadowParam(gld, GLD_PARAM_MATERIAL, &pParams->mtlFrontShininess, &mat->Attrib[MAT_ATTRIB_FRONT_SHININESS][0], sizeof(float));
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->mtlBackAmbient, mat->Attrib[MAT_ATTRIB_BACK_AMBIENT]);
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->mtlBackDiffuse, mat->Attrib[MAT_ATTRIB_BACK_DIFFUSE]);
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->mtlBackSpecular, mat->Attrib[MAT_ATTRIB_BACK_SPECULAR]);
+		_gldShadowParamVector(gld, GLD_PARAM_MATERIAL, &pParams->mtlBackEmissive, mat->Attrib[MAT_ATTRIB_BACK_EMISSION]);
+		_gldShadowParam(gld, GLD_PARAM_MATERIAL, &pParams->mtlBackShininess, &mat->Attrib[MAT_ATTRIB_BACK_SHININESS][0], sizeof(float));
+
+		glLit = &ctx->Light.Light[0];
+		for (i=0; i<GLD_MAX_LIGHTS_DX9; i++, glLit++) {
+			// Zeroed so that unused members compare equal
+			ZeroMemory(&Light, sizeof(Light));
+			gl4fToVec4(&Light.Front.Ambient, glLit->Ambient);
+			gl4fToVec4(&Light.Front.Diffuse, glLit->Diffuse);
+			gl4fToVec4(&Light.Front.Specular, glLit->Specular);
+			gl3fToVec4(&Light.Front._Ambient,	glLit->_MatAmbient[0]);
+			gl3fToVec4(&Light.Front._Diffuse,	glLit->_MatDiffuse[0]);
+			gl3fToVec4(&Light.Front._Specular,	glLit->_MatSpecular[0]);
+			if (ctx->Light.Model.TwoSide) {
+				gl4fToVec4(&Light.Back.Ambient, glLit->Ambient);
+				gl4fToVec4(&Light.Back.Diffuse, glLit->Diffuse);
+				gl4fToVec4(&Light.Back.Specular, glLit->Specular);
+				gl3fToVec4(&Light.Back._Ambient,	glLit->_MatAmbient[1]);
+				gl3fToVec4(&Light.Back._Diffuse,	glLit->_MatDiffuse[1]);
+				gl3fToVec4(&Light.Back._Specular,	glLit->_MatSpecular[1]);
+			}
+			if (glLit->_Flags & LIGHT_SPOT) {
+				gl4fToVec4(&Light.Position, glLit->_Position);
+				gl4fToVec4(&Light.Direction, glLit->EyeDirection);
+			} else if (glLit->_Flags & LIGHT_POSITIONAL) {
+				gl4fToVec4(&Light.Position, glLit->_Position);
+			} else {
+				Light.Direction = gld->LightDir[i];
+			}
+			Light.Attenuation.x	= glLit->ConstantAttenuation;
+			Light.Attenuation.y	= glLit->LinearAttenuation;
+			Light.Attenuation.z	= glLit->QuadraticAttenuation;
+			Light.SpotLight.x	= glLit->_CosCutoff;
+			Light.SpotLight.y	= glLit->SpotExponent;
+			_gldShadowParam(gld, GLD_PARAM_LIGHT0+i, &pParams->Lights[i], &Light, sizeof(Light));
+		}
+	}
+
+	// Fog
+	if (new_state & _NEW_FOG) {
 		D3DXVECTOR4	vFog;
 		// Pack Start, End and Density into a single VEC4.
 		// This should result in a single constant register begin used in the shader.
@@ -1893,8 +2352,80 @@ void gldUpdateShaders(
 		vFog.y = ctx->Fog.End;
 		vFog.z = ctx->Fog.Density;
 		vFog.w = 1.0f;
-		ID3DXEffect_SetVector(pEffect, pHandles->Fog, &vFog);
+		_gldShadowParam(gld, GLD_PARAM_FOG, &pParams->Fog, &vFog, sizeof(vFog));
+	}
+
+	// Texture units
+	if (new_state & _NEW_TEXTURE) {
+		for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++) {
+			const struct gl_texture_unit	*pUnit = &ctx->Texture.Unit[i];
+			void							*pTex = gldValidateTextureUnit(ctx, i);
+			_gldShadowParam(gld, GLD_PARAM_TEXUNIT0+i, &pParams->texDiffuse[i], &pTex, sizeof(pTex));
+			_gldShadowParamVector(gld, GLD_PARAM_TEXUNIT0+i, &pParams->EnvColor[i], &pUnit->EnvColor[0]);
+			_gldShadowParamVector(gld, GLD_PARAM_TEXUNIT0+i, &pParams->TexPlaneS[i], (pUnit->GenModeS == GL_OBJECT_LINEAR) ? &pUnit->ObjectPlaneS[0] : &pUnit->EyePlaneS[0]);
+			_gldShadowParamVector(gld, GLD_PARAM_TEXUNIT0+i, &pParams->TexPlaneT[i], (pUnit->GenModeT == GL_OBJECT_LINEAR) ? &pUnit->ObjectPlaneT[0] : &pUnit->EyePlaneT[0]);
+			_gldShadowParamVector(gld, GLD_PARAM_TEXUNIT0+i, &pParams->TexPlaneR[i], (pUnit->GenModeR == GL_OBJECT_LINEAR) ? &pUnit->ObjectPlaneR[0] : &pUnit->EyePlaneR[0]);
+			_gldShadowParamVector(gld, GLD_PARAM_TEXUNIT0+i, &pParams->TexPlaneQ[i], (pUnit->GenModeQ == GL_OBJECT_LINEAR) ? &pUnit->ObjectPlaneQ[0] : &pUnit->EyePlaneQ[0]);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------
+
+void gldEndFrameShaderParams(
+	GLD_driver_dx9 *gld)
+{
+	// Called once per Present()
+	gld->dwFrameParamBytes = gld->dwParamBytes;
+	if (gld->dwParamBytes > gld->dwPeakParamBytes)
+		gld->dwPeakParamBytes = gld->dwParamBytes;
+	gld->dwParamBytes = 0;
+}
+
+//---------------------------------------------------------------------------
+
+void gldInitShaders(
+	GLD_driver_dx9 *gld)
+{
+	int i;
+
+	// Shader targets. These key the shader cache, along with the effect state.
+	gld->dwVSTarget		= gld->d3dCaps9.VertexShaderVersion;
+	gld->dwPSTarget		= gld->d3dCaps9.PixelShaderVersion;
+#if 1
+	// ENABLE THIS TO FIX MISSING FOG IN MOHAA
+	// SM 3.x is not working with DX 9.0b SDK; remove this when 9.0c SDK build works
+	if (D3DSHADER_VERSION_MAJOR(gld->dwVSTarget) > 2 ||
+		D3DSHADER_VERSION_MAJOR(gld->dwPSTarget) > 2)
+	{
+		gld->dwVSTarget	= D3DVS_VERSION(2,0);
+		gld->dwPSTarget	= D3DPS_VERSION(2,0);
 	}
+	// end of DX 9.0b SDK hack
+#endif
+
+#ifdef _DEBUG
+	// Always debug shaders in DEBUG builds
+	gld->dwEffectFlags	= D3DXSHADER_PARTIALPRECISION | D3DXSHADER_DEBUG;
+	// Problem with D3DXSHADER_SKIPOPTIMIZATION;
+#else
+	gld->dwEffectFlags	= D3DXSHADER_PARTIALPRECISION;	// For nVidia parts
+#endif
+	// gld->dwEffectFlags |= D3DXSHADER_USE_LEGACY_D3DX9_31_DLL;
+
+	gld->nEffects		= 0;
+	gld->iCurEffect		= -1; // No effect current
+	gld->iLastEffect	= -1; // No effect current
+	gld->iEffectMRU		= -1;
+	gld->iEffectLRU		= -1;
+	gld->iEffectFree	= -1;
+	for (i=0; i<GLD_EFFECT_HASH_SIZE; i++)
+		gld->iEffectHash[i] = -1;
+	ZeroMemory(&gld->EffectStats, sizeof(gld->EffectStats));
+
+	// New effects start at generation zero, so they upload every parameter
+	for (i=0; i<GLD_PARAM_COUNT; i++)
+		gld->dwParamGen[i] = 1;
 }
 
 //---------------------------------------------------------------------------
@@ -1904,6 +2435,12 @@ void gldReleaseShaders(
 {
 	int i;
 
+	gldLogPrintf(GLDLOG_INFO, "Effect cache: %lu hits, %lu misses, %lu compiles, %lu disk loads, %lu evictions",
+		gld->EffectStats.dwHits, gld->EffectStats.dwMisses, gld->EffectStats.dwCompiles,
+		gld->EffectStats.dwDiskLoads, gld->EffectStats.dwEvictions);
+	gldLogPrintf(GLDLOG_INFO, "Effect parameters: %lu bytes last frame, %lu bytes peak",
+		gld->dwFrameParamBytes, gld->dwPeakParamBytes);
+
 	SAFE_RELEASE(gld->pEffectPool);
 
 	for (i=0; i<gld->nEffects; i++) {
@@ -1911,7 +2448,7 @@ void gldReleaseShaders(
 		SAFE_RELEASE(gld->Effects[i].pEffect);
 	}
 
-	gld->nEffects = 0;
+	gldInitShaders(gld);
 }
 
 //---------------------------------------------------------------------------
@@ -1963,6 +2500,8 @@ void gldEndEffect(
 	ID3DXEffect_End(pGLDEffect->pEffect);
 
 #ifdef _DEBUG
+	// End() restored the state saved by Begin() behind the filter's back
+	gldInvalidateDeviceState(gld);
 	D3DPERF_EndEvent(); // gldBeginEffect
 #endif
 }
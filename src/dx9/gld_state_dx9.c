@@ -0,0 +1,580 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Redundant device state filter. Shadows render, sampler,
+*               texture stage, texture and stream state so that calls
+*               which would not change the device are dropped.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+//---------------------------------------------------------------------------
+// Filtered device calls
+//---------------------------------------------------------------------------
+
+static void _gldSetRenderState(
+	GLD_deviceState *pState,
+	D3DRENDERSTATETYPE State,
+	DWORD Value)
+{
+	pState->Stats.dwCalls[GLD_STATE_RENDER]++;
+	if (State < GLD_MAX_RENDERSTATES) {
+		if (pState->bRSValid[State] && pState->dwRS[State] == Value) {
+			pState->Stats.dwFiltered[GLD_STATE_RENDER]++;
+			return;
+		}
+		pState->dwRS[State]		= Value;
+		pState->bRSValid[State]	= TRUE;
+	}
+	_GLD_DX9_DEV(SetRenderState(pState->pDev, State, Value));
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldSetSamplerState(
+	GLD_deviceState *pState,
+	DWORD Sampler,
+	D3DSAMPLERSTATETYPE Type,
+	DWORD Value)
+{
+	pState->Stats.dwCalls[GLD_STATE_SAMPLER]++;
+	if (Sampler < GLD_MAX_SAMPLERS && Type < GLD_MAX_SAMPLERSTATES) {
+		if (pState->bSSValid[Sampler][Type] && pState->dwSS[Sampler][Type] == Value) {
+			pState->Stats.dwFiltered[GLD_STATE_SAMPLER]++;
+			return;
+		}
+		pState->dwSS[Sampler][Type]		= Value;
+		pState->bSSValid[Sampler][Type]	= TRUE;
+	}
+	_GLD_DX9_DEV(SetSamplerState(pState->pDev, Sampler, Type, Value));
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldSetTextureStageState(
+	GLD_deviceState *pState,
+	DWORD Stage,
+	D3DTEXTURESTAGESTATETYPE Type,
+	DWORD Value)
+{
+	pState->Stats.dwCalls[GLD_STATE_TEXTURESTAGE]++;
+	if (Stage < GLD_MAX_TEXTURESTAGES && Type < GLD_MAX_TSS) {
+		if (pState->bTSSValid[Stage][Type] && pState->dwTSS[Stage][Type] == Value) {
+			pState->Stats.dwFiltered[GLD_STATE_TEXTURESTAGE]++;
+			return;
+		}
+		pState->dwTSS[Stage][Type]		= Value;
+		pState->bTSSValid[Stage][Type]	= TRUE;
+	}
+	_GLD_DX9_DEV(SetTextureStageState(pState->pDev, Stage, Type, Value));
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldSetTexture(
+	GLD_deviceState *pState,
+	DWORD Sampler,
+	IDirect3DBaseTexture9 *pTexture)
+{
+	// The device holds a reference to a bound texture, so a shadowed
+	// pointer cannot be reused by a new texture while it is still bound.
+	pState->Stats.dwCalls[GLD_STATE_TEXTURE]++;
+	if (Sampler < GLD_MAX_SAMPLERS) {
+		if (pState->bTextureValid[Sampler] && pState->pTexture[Sampler] == pTexture) {
+			pState->Stats.dwFiltered[GLD_STATE_TEXTURE]++;
+			return;
+		}
+		pState->pTexture[Sampler]		= pTexture;
+		pState->bTextureValid[Sampler]	= TRUE;
+	}
+	_GLD_DX9_DEV(SetTexture(pState->pDev, Sampler, pTexture));
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldSetVertexShader(
+	GLD_deviceState *pState,
+	IDirect3DVertexShader9 *pShader)
+{
+	pState->Stats.dwCalls[GLD_STATE_SHADER]++;
+	if (pState->bVSValid && pState->pVS == pShader) {
+		pState->Stats.dwFiltered[GLD_STATE_SHADER]++;
+		return;
+	}
+	pState->pVS			= pShader;
+	pState->bVSValid	= TRUE;
+	_GLD_DX9_DEV(SetVertexShader(pState->pDev, pShader));
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldSetPixelShader(
+	GLD_deviceState *pState,
+	IDirect3DPixelShader9 *pShader)
+{
+	pState->Stats.dwCalls[GLD_STATE_SHADER]++;
+	if (pState->bPSValid && pState->pPS == pShader) {
+		pState->Stats.dwFiltered[GLD_STATE_SHADER]++;
+		return;
+	}
+	pState->pPS			= pShader;
+	pState->bPSValid	= TRUE;
+	_GLD_DX9_DEV(SetPixelShader(pState->pDev, pShader));
+}
+
+//---------------------------------------------------------------------------
+// ID3DXEffectStateManager
+//---------------------------------------------------------------------------
+
+//
+// Effects call these instead of the device when BeginPass() applies the
+// states in the technique. The object is owned by the driver data, so
+// reference counting is a no-op.
+//
+
+#define _GLD_SM_STATE(This) ((GLD_deviceState*)(This))
+
+static HRESULT STDMETHODCALLTYPE _gldSM_QueryInterface(
+	ID3DXEffectStateManager *This,
+	REFIID iid,
+	LPVOID *ppv)
+{
+	if (IsEqualIID(iid, &IID_IUnknown) || IsEqualIID(iid, &IID_ID3DXEffectStateManager)) {
+		*ppv = This;
+		return S_OK;
+	}
+	*ppv = NULL;
+	return E_NOINTERFACE;
+}
+
+static ULONG STDMETHODCALLTYPE _gldSM_AddRef(
+	ID3DXEffectStateManager *This)
+{
+	return 1;
+}
+
+static ULONG STDMETHODCALLTYPE _gldSM_Release(
+	ID3DXEffectStateManager *This)
+{
+	return 1;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetTransform(
+	ID3DXEffectStateManager *This,
+	D3DTRANSFORMSTATETYPE State,
+	CONST D3DMATRIX *pMatrix)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_OTHER]++;
+	return IDirect3DDevice9_SetTransform(_GLD_SM_STATE(This)->pDev, State, pMatrix);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetMaterial(
+	ID3DXEffectStateManager *This,
+	CONST D3DMATERIAL9 *pMaterial)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_OTHER]++;
+	return IDirect3DDevice9_SetMaterial(_GLD_SM_STATE(This)->pDev, pMaterial);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetLight(
+	ID3DXEffectStateManager *This,
+	DWORD Index,
+	CONST D3DLIGHT9 *pLight)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_OTHER]++;
+	return IDirect3DDevice9_SetLight(_GLD_SM_STATE(This)->pDev, Index, pLight);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_LightEnable(
+	ID3DXEffectStateManager *This,
+	DWORD Index,
+	BOOL Enable)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_OTHER]++;
+	return IDirect3DDevice9_LightEnable(_GLD_SM_STATE(This)->pDev, Index, Enable);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetRenderState(
+	ID3DXEffectStateManager *This,
+	D3DRENDERSTATETYPE State,
+	DWORD Value)
+{
+	_gldSetRenderState(_GLD_SM_STATE(This), State, Value);
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetTexture(
+	ID3DXEffectStateManager *This,
+	DWORD Stage,
+	LPDIRECT3DBASETEXTURE9 pTexture)
+{
+	_gldSetTexture(_GLD_SM_STATE(This), Stage, pTexture);
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetTextureStageState(
+	ID3DXEffectStateManager *This,
+	DWORD Stage,
+	D3DTEXTURESTAGESTATETYPE Type,
+	DWORD Value)
+{
+	_gldSetTextureStageState(_GLD_SM_STATE(This), Stage, Type, Value);
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetSamplerState(
+	ID3DXEffectStateManager *This,
+	DWORD Sampler,
+	D3DSAMPLERSTATETYPE Type,
+	DWORD Value)
+{
+	_gldSetSamplerState(_GLD_SM_STATE(This), Sampler, Type, Value);
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetNPatchMode(
+	ID3DXEffectStateManager *This,
+	FLOAT NumSegments)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_OTHER]++;
+	return IDirect3DDevice9_SetNPatchMode(_GLD_SM_STATE(This)->pDev, NumSegments);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetFVF(
+	ID3DXEffectStateManager *This,
+	DWORD FVF)
+{
+	// SetFVF() replaces the vertex declaration
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_DECL]++;
+	_GLD_SM_STATE(This)->bDeclValid = FALSE;
+	return IDirect3DDevice9_SetFVF(_GLD_SM_STATE(This)->pDev, FVF);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetVertexShader(
+	ID3DXEffectStateManager *This,
+	LPDIRECT3DVERTEXSHADER9 pShader)
+{
+	_gldSetVertexShader(_GLD_SM_STATE(This), pShader);
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetVertexShaderConstantF(
+	ID3DXEffectStateManager *This,
+	UINT RegisterIndex,
+	CONST FLOAT *pConstantData,
+	UINT RegisterCount)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_CONSTANT]++;
+	return IDirect3DDevice9_SetVertexShaderConstantF(_GLD_SM_STATE(This)->pDev, RegisterIndex, pConstantData, RegisterCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetVertexShaderConstantI(
+	ID3DXEffectStateManager *This,
+	UINT RegisterIndex,
+	CONST INT *pConstantData,
+	UINT RegisterCount)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_CONSTANT]++;
+	return IDirect3DDevice9_SetVertexShaderConstantI(_GLD_SM_STATE(This)->pDev, RegisterIndex, pConstantData, RegisterCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetVertexShaderConstantB(
+	ID3DXEffectStateManager *This,
+	UINT RegisterIndex,
+	CONST BOOL *pConstantData,
+	UINT RegisterCount)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_CONSTANT]++;
+	return IDirect3DDevice9_SetVertexShaderConstantB(_GLD_SM_STATE(This)->pDev, RegisterIndex, pConstantData, RegisterCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetPixelShader(
+	ID3DXEffectStateManager *This,
+	LPDIRECT3DPIXELSHADER9 pShader)
+{
+	_gldSetPixelShader(_GLD_SM_STATE(This), pShader);
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetPixelShaderConstantF(
+	ID3DXEffectStateManager *This,
+	UINT RegisterIndex,
+	CONST FLOAT *pConstantData,
+	UINT RegisterCount)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_CONSTANT]++;
+	return IDirect3DDevice9_SetPixelShaderConstantF(_GLD_SM_STATE(This)->pDev, RegisterIndex, pConstantData, RegisterCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetPixelShaderConstantI(
+	ID3DXEffectStateManager *This,
+	UINT RegisterIndex,
+	CONST INT *pConstantData,
+	UINT RegisterCount)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_CONSTANT]++;
+	return IDirect3DDevice9_SetPixelShaderConstantI(_GLD_SM_STATE(This)->pDev, RegisterIndex, pConstantData, RegisterCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldSM_SetPixelShaderConstantB(
+	ID3DXEffectStateManager *This,
+	UINT RegisterIndex,
+	CONST BOOL *pConstantData,
+	UINT RegisterCount)
+{
+	_GLD_SM_STATE(This)->Stats.dwCalls[GLD_STATE_CONSTANT]++;
+	return IDirect3DDevice9_SetPixelShaderConstantB(_GLD_SM_STATE(This)->pDev, RegisterIndex, pConstantData, RegisterCount);
+}
+
+#undef _GLD_SM_STATE
+
+// Order must match ID3DXEffectStateManager in d3dx9effect.h
+static ID3DXEffectStateManagerVtbl g_gldStateManagerVtbl = {
+	_gldSM_QueryInterface,
+	_gldSM_AddRef,
+	_gldSM_Release,
+	_gldSM_SetTransform,
+	_gldSM_SetMaterial,
+	_gldSM_SetLight,
+	_gldSM_LightEnable,
+	_gldSM_SetRenderState,
+	_gldSM_SetTexture,
+	_gldSM_SetTextureStageState,
+	_gldSM_SetSamplerState,
+	_gldSM_SetNPatchMode,
+	_gldSM_SetFVF,
+	_gldSM_SetVertexShader,
+	_gldSM_SetVertexShaderConstantF,
+	_gldSM_SetVertexShaderConstantI,
+	_gldSM_SetVertexShaderConstantB,
+	_gldSM_SetPixelShader,
+	_gldSM_SetPixelShaderConstantF,
+	_gldSM_SetPixelShaderConstantI,
+	_gldSM_SetPixelShaderConstantB,
+};
+
+//---------------------------------------------------------------------------
+// Driver interface
+//---------------------------------------------------------------------------
+
+void gldInitDeviceState(
+	GLD_driver_dx9 *gld)
+{
+	//
+	// Call once gld->pDev has been created.
+	//
+
+	GLD_deviceState *pState = &gld->DevState;
+
+	pState->StateManager.lpVtbl	= &g_gldStateManagerVtbl;
+	pState->pDev				= gld->pDev;
+	ZeroMemory(&pState->Stats, sizeof(pState->Stats));
+	gldInvalidateDeviceState(gld);
+}
+
+//---------------------------------------------------------------------------
+
+void gldInvalidateDeviceState(
+	GLD_driver_dx9 *gld)
+{
+	//
+	// Forget the shadowed values. Needed after Reset(), or when something
+	// outside the filter (eg. a saved state block) may have changed the device.
+	//
+
+	GLD_deviceState *pState = &gld->DevState;
+
+	ZeroMemory(pState->bRSValid, sizeof(pState->bRSValid));
+	ZeroMemory(pState->bSSValid, sizeof(pState->bSSValid));
+	ZeroMemory(pState->bTSSValid, sizeof(pState->bTSSValid));
+	ZeroMemory(pState->bTextureValid, sizeof(pState->bTextureValid));
+	pState->bVBValid	= FALSE;
+	pState->bIBValid	= FALSE;
+	pState->bDeclValid	= FALSE;
+	pState->bVSValid	= FALSE;
+	pState->bPSValid	= FALSE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldLogDeviceStateStats(
+	GLD_driver_dx9 *gld)
+{
+	static const char *szType[GLD_STATE_COUNT] = {
+		"RenderState", "SamplerState", "TextureStageState", "Texture",
+		"StreamSource", "Indices", "VertexDeclaration", "Shader",
+		"ShaderConstant", "Other",
+	};
+	GLD_stateStats	*pStats = &gld->DevState.Stats;
+	int				i;
+
+	for (i=0; i<GLD_STATE_COUNT; i++) {
+		if (pStats->dwCalls[i])
+			gldLogPrintf(GLDLOG_INFO, "State filter: %s %lu calls, %lu redundant",
+				szType[i], pStats->dwCalls[i], pStats->dwFiltered[i]);
+	}
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetRenderState(
+	GLD_driver_dx9 *gld,
+	D3DRENDERSTATETYPE State,
+	DWORD Value)
+{
+	_gldSetRenderState(&gld->DevState, State, Value);
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetSamplerState(
+	GLD_driver_dx9 *gld,
+	DWORD Sampler,
+	D3DSAMPLERSTATETYPE Type,
+	DWORD Value)
+{
+	_gldSetSamplerState(&gld->DevState, Sampler, Type, Value);
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetTextureStageState(
+	GLD_driver_dx9 *gld,
+	DWORD Stage,
+	D3DTEXTURESTAGESTATETYPE Type,
+	DWORD Value)
+{
+	_gldSetTextureStageState(&gld->DevState, Stage, Type, Value);
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetTexture(
+	GLD_driver_dx9 *gld,
+	DWORD Sampler,
+	IDirect3DBaseTexture9 *pTexture)
+{
+	_gldSetTexture(&gld->DevState, Sampler, pTexture);
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetStreamSource(
+	GLD_driver_dx9 *gld,
+	IDirect3DVertexBuffer9 *pVB,
+	UINT OffsetInBytes,
+	UINT Stride)
+{
+	// Stream 0 is the only stream GLDirect uses
+	GLD_deviceState *pState = &gld->DevState;
+
+	pState->Stats.dwCalls[GLD_STATE_STREAM]++;
+	if (pState->bVBValid && pState->pVB == pVB &&
+		pState->uVBOffset == OffsetInBytes && pState->uVBStride == Stride)
+	{
+		pState->Stats.dwFiltered[GLD_STATE_STREAM]++;
+		return;
+	}
+	pState->pVB			= pVB;
+	pState->uVBOffset	= OffsetInBytes;
+	pState->uVBStride	= Stride;
+	pState->bVBValid	= TRUE;
+	_GLD_DX9_DEV(SetStreamSource(pState->pDev, 0, pVB, OffsetInBytes, Stride));
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetIndices(
+	GLD_driver_dx9 *gld,
+	IDirect3DIndexBuffer9 *pIB)
+{
+	GLD_deviceState *pState = &gld->DevState;
+
+	pState->Stats.dwCalls[GLD_STATE_INDICES]++;
+	if (pState->bIBValid && pState->pIB == pIB) {
+		pState->Stats.dwFiltered[GLD_STATE_INDICES]++;
+		return;
+	}
+	pState->pIB			= pIB;
+	pState->bIBValid	= TRUE;
+	_GLD_DX9_DEV(SetIndices(pState->pDev, pIB));
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetVertexDeclaration(
+	GLD_driver_dx9 *gld,
+	IDirect3DVertexDeclaration9 *pDecl)
+{
+	GLD_deviceState *pState = &gld->DevState;
+
+	pState->Stats.dwCalls[GLD_STATE_DECL]++;
+	if (pState->bDeclValid && pState->pDecl == pDecl) {
+		pState->Stats.dwFiltered[GLD_STATE_DECL]++;
+		return;
+	}
+	pState->pDecl		= pDecl;
+	pState->bDeclValid	= TRUE;
+	_GLD_DX9_DEV(SetVertexDeclaration(pState->pDev, pDecl));
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetFVF(
+	GLD_driver_dx9 *gld,
+	DWORD FVF)
+{
+	// SetFVF() replaces the vertex declaration, so the shadow is lost
+	gld->DevState.Stats.dwCalls[GLD_STATE_DECL]++;
+	gld->DevState.bDeclValid = FALSE;
+	_GLD_DX9_DEV(SetFVF(gld->pDev, FVF));
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetVertexShader(
+	GLD_driver_dx9 *gld,
+	IDirect3DVertexShader9 *pShader)
+{
+	_gldSetVertexShader(&gld->DevState, pShader);
+}
+
+//---------------------------------------------------------------------------
+
+void gldSetPixelShader(
+	GLD_driver_dx9 *gld,
+	IDirect3DPixelShader9 *pShader)
+{
+	_gldSetPixelShader(&gld->DevState, pShader);
+}
+
+//---------------------------------------------------------------------------
@@ -0,0 +1,2385 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Command stream. Queues the state, draw and present calls
+*               GLDirect makes on the device and submits them to Direct3D
+*               from a worker thread.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+//---------------------------------------------------------------------------
+// Mesa and the GLDirect driver keep running on the app thread, so glGet*
+// and the rest of the GL state are answered there as before. Only the time
+// spent inside the Direct3D runtime and the IHV driver moves to the worker.
+//
+// The stream hooks the device the same way the recorder does: its copy of
+// the vtable encodes each call into a single-producer, single-consumer
+// ring instead of making it. It is hooked last, so its copy is always the
+// one in the object and the vtable it calls through is the recorder's (if
+// any) or the runtime's.
+//
+// Calls that need the device to have caught up drain the ring first and
+// are then made directly on the app thread; the device is created with
+// D3DCREATE_MULTITHREADED so the idle worker and the app thread can share
+// it. These are:
+//   - Reset, GetBackBuffer and the surface copies (glReadPixels, resizes)
+//   - LockRect on textures and surfaces (texture uploads, readback)
+//   - Lock on vertex and index buffers, except D3DLOCK_NOOVERWRITE.
+//     A discard would rename the buffer under the draws still queued.
+//   - The state Get*() methods and state blocks
+//   - Every other device method, except the IUnknown ones that do not
+//     release it and the creation of objects GLDirect never locks
+//   - Query Issue(), so an event follows the draws queued before it
+// glFinish() drains the ring too. GetViewport() and TestCooperativeLevel()
+// are answered from values kept on the app thread.
+//---------------------------------------------------------------------------
+
+#define GLD_STREAM_RING_SIZE	(4 * 1024 * 1024)			// Bytes, a power of two
+#define GLD_STREAM_MAX_DATA		(GLD_STREAM_RING_SIZE / 4)	// Larger calls are made in place
+#define GLD_STREAM_MAX_FRAMES	2		// Presents queued before the app thread waits
+#define GLD_STREAM_SPIN			4000	// Polls before the worker sleeps
+#define GLD_STREAM_MAX_CLASSES	16
+#define GLD_STREAM_MAX_ARGS		8
+#define GLD_STREAM_MAX_ERRORS	8		// Failed deferred calls logged
+
+#define _GLD_STREAM_REAL(type, This)	((const type *)((const void**)(This)->lpVtbl)[-1])
+
+typedef enum {
+	GLD_STREAM_PAD = 0,					// Skip to the start of the ring
+	GLD_STREAM_SET_RENDER_STATE,
+	GLD_STREAM_SET_SAMPLER_STATE,
+	GLD_STREAM_SET_TEXTURE_STAGE_STATE,
+	GLD_STREAM_SET_TRANSFORM,
+	GLD_STREAM_SET_TEXTURE,
+	GLD_STREAM_SET_STREAM_SOURCE,
+	GLD_STREAM_SET_INDICES,
+	GLD_STREAM_SET_VERTEX_DECLARATION,
+	GLD_STREAM_SET_FVF,
+	GLD_STREAM_SET_VERTEX_SHADER,
+	GLD_STREAM_SET_PIXEL_SHADER,
+	GLD_STREAM_SET_VS_CONSTANT_F,
+	GLD_STREAM_SET_VS_CONSTANT_I,
+	GLD_STREAM_SET_VS_CONSTANT_B,
+	GLD_STREAM_SET_PS_CONSTANT_F,
+	GLD_STREAM_SET_PS_CONSTANT_I,
+	GLD_STREAM_SET_PS_CONSTANT_B,
+	GLD_STREAM_SET_VIEWPORT,
+	GLD_STREAM_SET_SCISSOR_RECT,
+	GLD_STREAM_SET_CLIP_PLANE,
+	GLD_STREAM_SET_MATERIAL,
+	GLD_STREAM_SET_LIGHT,
+	GLD_STREAM_LIGHT_ENABLE,
+	GLD_STREAM_SET_NPATCH_MODE,
+	GLD_STREAM_SET_SOFTWARE_VP,
+	GLD_STREAM_DRAW_PRIMITIVE,
+	GLD_STREAM_DRAW_INDEXED_PRIMITIVE,
+	GLD_STREAM_DRAW_PRIMITIVE_UP,
+	GLD_STREAM_DRAW_INDEXED_PRIMITIVE_UP,
+	GLD_STREAM_CLEAR,
+	GLD_STREAM_BEGIN_SCENE,
+	GLD_STREAM_END_SCENE,
+	GLD_STREAM_PRESENT,
+} GLD_streamOp;
+
+// One call in the ring. Any data it points to follows it.
+typedef struct {
+	WORD			wOp;				// GLD_streamOp
+	WORD			wRelease;			// Bit n: Release() the object in Args[n] once made
+	DWORD			dwSize;				// Bytes, call and data, a multiple of 8
+	UINT_PTR		Args[GLD_STREAM_MAX_ARGS];
+} GLD_streamCmd;
+
+#define _GLD_STREAM_DATA(pCmd)		((BYTE*)((pCmd) + 1))
+
+typedef struct {
+	const void		*pReal;			// The vtable under ours
+	const void		*pHooked;		// Our copy of it
+} GLD_streamClass;
+
+typedef struct {
+	IDirect3DDevice9	*pDev;			// The device being streamed, or NULL
+	BOOL				bDead;			// The worker has gone; make calls in place
+	DWORD				dwWorkerId;
+
+	BYTE				*pRing;
+	DWORD				dwHead;			// Bytes written by the app thread
+	volatile LONG		lHead;			// ...and published to the worker
+	volatile LONG		lTail;			// Bytes the worker has made the calls for
+	volatile LONG		lWorkerIdle;	// The worker is waiting on hWork
+	volatile LONG		lAppWaiting;	// The app thread is waiting on hDone
+	volatile LONG		lStop;
+	LONG				lFramesQueued;	// Presents written
+	volatile LONG		lFramesDone;	// Presents made
+	volatile LONG		hrCooperative;	// Failure seen by the worker, or D3D_OK
+
+	HANDLE				hThread;
+	HANDLE				hWork;			// Wakes the worker
+	HANDLE				hDone;			// Wakes the app thread
+	HANDLE				hStopped;
+
+	D3DVIEWPORT9		Viewport;		// Last SetViewport()
+	BOOL				bViewport;		// Viewport is valid
+
+	GLD_streamClass		Classes[GLD_STREAM_MAX_CLASSES];
+	int					nClasses;
+
+	// Statistics, for the log
+	DWORD				dwCommands;
+	ULONGLONG			qwBytes;
+	DWORD				dwSyncs;		// Drains for calls made in place
+	DWORD				dwLockSyncs;	// ...of which were for locks
+	DWORD				dwFrameWaits;	// Presents that waited for the worker
+	DWORD				dwErrors;		// Deferred calls that failed
+} GLD_stream;
+
+static GLD_stream gldStream;
+
+//---------------------------------------------------------------------------
+
+static void _gldStreamHookObject(
+	void *pObj,
+	size_t cbVtbl,
+	void (*pfnHook)(void *pVtbl))
+{
+	const void	**ppVtbl = (const void**)pObj;
+	BYTE		*pBlock;
+	int			i;
+
+	if (!pObj)
+		return;
+
+	for (i=0; i<gldStream.nClasses; i++) {
+		if (*ppVtbl == gldStream.Classes[i].pHooked)
+			return; // Already streamed
+		if (*ppVtbl == gldStream.Classes[i].pReal) {
+			*ppVtbl = gldStream.Classes[i].pHooked;
+			return;
+		}
+	}
+
+	// First object of this class
+	if (gldStream.nClasses == GLD_STREAM_MAX_CLASSES)
+		return;
+	pBlock = (BYTE*)MALLOC(sizeof(void*) + cbVtbl);
+	if (!pBlock)
+		return;
+	*(const void**)pBlock = *ppVtbl;
+	memcpy(pBlock + sizeof(void*), *ppVtbl, cbVtbl);
+	pfnHook(pBlock + sizeof(void*));
+	gldStream.Classes[gldStream.nClasses].pReal		= *ppVtbl;
+	gldStream.Classes[gldStream.nClasses].pHooked	= pBlock + sizeof(void*);
+	gldStream.nClasses++;
+	*ppVtbl = pBlock + sizeof(void*);
+}
+
+//---------------------------------------------------------------------------
+
+static __inline BOOL _gldStreamActive(
+	void *This)
+{
+	// This is NULL for resources, which can only belong to the streamed
+	// device while there is one. The worker itself always calls through.
+	return gldStream.pDev &&
+		!gldStream.bDead &&
+		(!This || (This == (void*)gldStream.pDev)) &&
+		(GetCurrentThreadId() != gldStream.dwWorkerId);
+}
+
+//---------------------------------------------------------------------------
+// App thread
+//---------------------------------------------------------------------------
+
+static void _gldStreamWait(
+	DWORD dwTailSeen)
+{
+	HANDLE hWait[2];
+
+	//
+	// Sleep until the worker moves on from dwTailSeen. The flag is raised
+	// before the tail is looked at again, and the worker lowers the tail
+	// before it looks at the flag, so one of them always sees the other.
+	//
+
+	InterlockedExchange(&gldStream.lAppWaiting, 1);
+	if ((DWORD)gldStream.lTail == dwTailSeen) {
+		hWait[0] = gldStream.hDone;
+		hWait[1] = gldStream.hThread;
+		if (WaitForMultipleObjects(2, hWait, FALSE, INFINITE) != WAIT_OBJECT_0) {
+			// Killed with the process, or never to return
+			gldStream.bDead = TRUE;
+			gldLogMessage(GLDLOG_WARN, "Stream: worker has gone, calls are now made in place\n");
+		}
+	}
+	InterlockedExchange(&gldStream.lAppWaiting, 0);
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldStreamDrain(void)
+{
+	DWORD dwTail;
+
+	while (!gldStream.bDead) {
+		dwTail = (DWORD)gldStream.lTail;
+		if (dwTail == gldStream.dwHead)
+			return;
+		_gldStreamWait(dwTail);
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldStreamSync(
+	void *This)
+{
+	// Make the queued calls before one that is made in place
+	if (!_gldStreamActive(This))
+		return;
+	gldStream.dwSyncs++;
+	if (gldStream.dwHead != (DWORD)gldStream.lTail)
+		_gldStreamDrain();
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldStreamSyncLock(
+	DWORD Flags)
+{
+	if (!_gldStreamActive(NULL) || (Flags & D3DLOCK_NOOVERWRITE))
+		return;
+	gldStream.dwLockSyncs++;
+	_gldStreamSync(NULL);
+}
+
+//---------------------------------------------------------------------------
+
+static GLD_streamCmd *_gldStreamAlloc(
+	void *This,
+	GLD_streamOp Op,
+	DWORD cbData)
+{
+	GLD_streamCmd	*pCmd;
+	DWORD			dwSize;
+	DWORD			dwOffset;
+	DWORD			dwPad;
+	DWORD			dwTail;
+
+	//
+	// Room for a call and cbData bytes after it, or NULL if the call is to
+	// be made in place. Nothing is seen by the worker until it is committed.
+	//
+
+	if (!_gldStreamActive(This))
+		return NULL;
+	if (cbData > GLD_STREAM_MAX_DATA) {
+		_gldStreamSync(This);
+		return NULL;
+	}
+
+	dwSize		= (sizeof(GLD_streamCmd) + cbData + 7) & ~7;
+	dwOffset	= gldStream.dwHead & (GLD_STREAM_RING_SIZE - 1);
+	dwPad		= (dwOffset + dwSize > GLD_STREAM_RING_SIZE) ? (GLD_STREAM_RING_SIZE - dwOffset) : 0;
+
+	for (;;) {
+		dwTail = (DWORD)gldStream.lTail;
+		if (gldStream.dwHead + dwPad + dwSize - dwTail <= GLD_STREAM_RING_SIZE)
+			break;
+		_gldStreamWait(dwTail);
+		if (gldStream.bDead)
+			return NULL;
+	}
+
+	// Calls are never split across the end of the ring
+	if (dwPad) {
+		pCmd = (GLD_streamCmd*)(gldStream.pRing + dwOffset);
+		pCmd->wOp		= GLD_STREAM_PAD;
+		pCmd->dwSize	= dwPad;
+		gldStream.dwHead += dwPad;
+	}
+
+	pCmd = (GLD_streamCmd*)(gldStream.pRing + (gldStream.dwHead & (GLD_STREAM_RING_SIZE - 1)));
+	pCmd->wOp		= (WORD)Op;
+	pCmd->wRelease	= 0;
+	pCmd->dwSize	= dwSize;
+	return pCmd;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldStreamRef(
+	GLD_streamCmd *pCmd,
+	int iArg,
+	void *pObj)
+{
+	// Keep an object alive until the worker has used it
+	pCmd->Args[iArg] = (UINT_PTR)pObj;
+	if (pObj) {
+		((IUnknown*)pObj)->lpVtbl->AddRef((IUnknown*)pObj);
+		pCmd->wRelease |= (1 << iArg);
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT _gldStreamCommit(
+	GLD_streamCmd *pCmd)
+{
+	gldStream.dwCommands++;
+	gldStream.qwBytes	+= pCmd->dwSize;
+	gldStream.dwHead	+= pCmd->dwSize;
+	InterlockedExchange(&gldStream.lHead, (LONG)gldStream.dwHead);
+	if (gldStream.lWorkerIdle)
+		SetEvent(gldStream.hWork);
+	return D3D_OK;
+}
+
+//---------------------------------------------------------------------------
+// Worker
+//---------------------------------------------------------------------------
+
+static void _gldStreamExecute(
+	GLD_streamCmd *pCmd)
+{
+	const IDirect3DDevice9Vtbl	*v		= _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, gldStream.pDev);
+	IDirect3DDevice9			*pDev	= gldStream.pDev;
+	const UINT_PTR				*a		= pCmd->Args;
+	BYTE						*pData	= _GLD_STREAM_DATA(pCmd);
+	HRESULT						hr		= D3D_OK;
+	int							i;
+
+	switch (pCmd->wOp) {
+	case GLD_STREAM_SET_RENDER_STATE:
+		hr = v->SetRenderState(pDev, (D3DRENDERSTATETYPE)a[0], (DWORD)a[1]);
+		break;
+	case GLD_STREAM_SET_SAMPLER_STATE:
+		hr = v->SetSamplerState(pDev, (DWORD)a[0], (D3DSAMPLERSTATETYPE)a[1], (DWORD)a[2]);
+		break;
+	case GLD_STREAM_SET_TEXTURE_STAGE_STATE:
+		hr = v->SetTextureStageState(pDev, (DWORD)a[0], (D3DTEXTURESTAGESTATETYPE)a[1], (DWORD)a[2]);
+		break;
+	case GLD_STREAM_SET_TRANSFORM:
+		hr = v->SetTransform(pDev, (D3DTRANSFORMSTATETYPE)a[0], (CONST D3DMATRIX*)pData);
+		break;
+	case GLD_STREAM_SET_TEXTURE:
+		hr = v->SetTexture(pDev, (DWORD)a[0], (IDirect3DBaseTexture9*)a[1]);
+		break;
+	case GLD_STREAM_SET_STREAM_SOURCE:
+		hr = v->SetStreamSource(pDev, (UINT)a[0], (IDirect3DVertexBuffer9*)a[1], (UINT)a[2], (UINT)a[3]);
+		break;
+	case GLD_STREAM_SET_INDICES:
+		hr = v->SetIndices(pDev, (IDirect3DIndexBuffer9*)a[0]);
+		break;
+	case GLD_STREAM_SET_VERTEX_DECLARATION:
+		hr = v->SetVertexDeclaration(pDev, (IDirect3DVertexDeclaration9*)a[0]);
+		break;
+	case GLD_STREAM_SET_FVF:
+		hr = v->SetFVF(pDev, (DWORD)a[0]);
+		break;
+	case GLD_STREAM_SET_VERTEX_SHADER:
+		hr = v->SetVertexShader(pDev, (IDirect3DVertexShader9*)a[0]);
+		break;
+	case GLD_STREAM_SET_PIXEL_SHADER:
+		hr = v->SetPixelShader(pDev, (IDirect3DPixelShader9*)a[0]);
+		break;
+	case GLD_STREAM_SET_VS_CONSTANT_F:
+		hr = v->SetVertexShaderConstantF(pDev, (UINT)a[0], (CONST float*)pData, (UINT)a[1]);
+		break;
+	case GLD_STREAM_SET_VS_CONSTANT_I:
+		hr = v->SetVertexShaderConstantI(pDev, (UINT)a[0], (CONST int*)pData, (UINT)a[1]);
+		break;
+	case GLD_STREAM_SET_VS_CONSTANT_B:
+		hr = v->SetVertexShaderConstantB(pDev, (UINT)a[0], (CONST BOOL*)pData, (UINT)a[1]);
+		break;
+	case GLD_STREAM_SET_PS_CONSTANT_F:
+		hr = v->SetPixelShaderConstantF(pDev, (UINT)a[0], (CONST float*)pData, (UINT)a[1]);
+		break;
+	case GLD_STREAM_SET_PS_CONSTANT_I:
+		hr = v->SetPixelShaderConstantI(pDev, (UINT)a[0], (CONST int*)pData, (UINT)a[1]);
+		break;
+	case GLD_STREAM_SET_PS_CONSTANT_B:
+		hr = v->SetPixelShaderConstantB(pDev, (UINT)a[0], (CONST BOOL*)pData, (UINT)a[1]);
+		break;
+	case GLD_STREAM_SET_VIEWPORT:
+		hr = v->SetViewport(pDev, (CONST D3DVIEWPORT9*)pData);
+		break;
+	case GLD_STREAM_SET_SCISSOR_RECT:
+		hr = v->SetScissorRect(pDev, (CONST RECT*)pData);
+		break;
+	case GLD_STREAM_SET_CLIP_PLANE:
+		hr = v->SetClipPlane(pDev, (DWORD)a[0], (CONST float*)pData);
+		break;
+	case GLD_STREAM_SET_MATERIAL:
+		hr = v->SetMaterial(pDev, (CONST D3DMATERIAL9*)pData);
+		break;
+	case GLD_STREAM_SET_LIGHT:
+		hr = v->SetLight(pDev, (DWORD)a[0], (CONST D3DLIGHT9*)pData);
+		break;
+	case GLD_STREAM_LIGHT_ENABLE:
+		hr = v->LightEnable(pDev, (DWORD)a[0], (BOOL)a[1]);
+		break;
+	case GLD_STREAM_SET_NPATCH_MODE:
+		hr = v->SetNPatchMode(pDev, *(float*)pData);
+		break;
+	case GLD_STREAM_SET_SOFTWARE_VP:
+		hr = v->SetSoftwareVertexProcessing(pDev, (BOOL)a[0]);
+		break;
+	case GLD_STREAM_DRAW_PRIMITIVE:
+		hr = v->DrawPrimitive(pDev, (D3DPRIMITIVETYPE)a[0], (UINT)a[1], (UINT)a[2]);
+		break;
+	case GLD_STREAM_DRAW_INDEXED_PRIMITIVE:
+		hr = v->DrawIndexedPrimitive(pDev, (D3DPRIMITIVETYPE)a[0], (INT)a[1], (UINT)a[2], (UINT)a[3], (UINT)a[4], (UINT)a[5]);
+		break;
+	case GLD_STREAM_DRAW_PRIMITIVE_UP:
+		hr = v->DrawPrimitiveUP(pDev, (D3DPRIMITIVETYPE)a[0], (UINT)a[1], pData, (UINT)a[2]);
+		break;
+	case GLD_STREAM_DRAW_INDEXED_PRIMITIVE_UP:
+		// Indices follow the vertices, at offset a[6]
+		hr = v->DrawIndexedPrimitiveUP(pDev, (D3DPRIMITIVETYPE)a[0], (UINT)a[1], (UINT)a[2], (UINT)a[3],
+			pData + a[6], (D3DFORMAT)a[4], pData, (UINT)a[5]);
+		break;
+	case GLD_STREAM_CLEAR:
+		// Z leads the rectangles
+		hr = v->Clear(pDev, (DWORD)a[0], a[0] ? (CONST D3DRECT*)(pData + 8) : NULL,
+			(DWORD)a[1], (D3DCOLOR)a[2], *(float*)pData, (DWORD)a[3]);
+		break;
+	case GLD_STREAM_BEGIN_SCENE:
+		hr = v->BeginScene(pDev);
+		break;
+	case GLD_STREAM_END_SCENE:
+		hr = v->EndScene(pDev);
+		break;
+	case GLD_STREAM_PRESENT:
+		// A lost device shows up here first. TestCooperativeLevel() on the
+		// app thread looks for it, and nothing else needs logging.
+		hr = v->Present(pDev, NULL, NULL, (HWND)a[0], NULL);
+		if (FAILED(hr))
+			InterlockedExchange(&gldStream.hrCooperative, hr);
+		InterlockedIncrement(&gldStream.lFramesDone);
+		hr = D3D_OK;
+		break;
+	}
+
+	if (FAILED(hr) && (gldStream.dwErrors++ < GLD_STREAM_MAX_ERRORS))
+		gldLogPrintf(GLDLOG_WARN, "Stream: deferred call %u failed (0x%08x)", pCmd->wOp, hr);
+
+	for (i=0; pCmd->wRelease; i++) {
+		if (pCmd->wRelease & (1 << i)) {
+			((IUnknown*)a[i])->lpVtbl->Release((IUnknown*)a[i]);
+			pCmd->wRelease &= ~(1 << i);
+		}
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static DWORD WINAPI _gldStreamWorker(
+	LPVOID lpParameter)
+{
+	GLD_streamCmd	*pCmd;
+	DWORD			dwTail = (DWORD)gldStream.lTail;
+	int				i;
+
+	for (;;) {
+		// A busy app writes the next call while the last is being made.
+		// Poll for a while before paying for a sleep and a wake-up.
+		for (i=0; ((DWORD)gldStream.lHead == dwTail) && (i < GLD_STREAM_SPIN); i++)
+			YieldProcessor();
+
+		if ((DWORD)gldStream.lHead == dwTail) {
+			if (gldStream.lStop)
+				break;
+			InterlockedExchange(&gldStream.lWorkerIdle, 1);
+			if (((DWORD)gldStream.lHead == dwTail) && !gldStream.lStop)
+				WaitForSingleObject(gldStream.hWork, INFINITE);
+			InterlockedExchange(&gldStream.lWorkerIdle, 0);
+			continue;
+		}
+
+		pCmd = (GLD_streamCmd*)(gldStream.pRing + (dwTail & (GLD_STREAM_RING_SIZE - 1)));
+		if (pCmd->wOp != GLD_STREAM_PAD)
+			_gldStreamExecute(pCmd);
+		dwTail += pCmd->dwSize;
+		InterlockedExchange(&gldStream.lTail, (LONG)dwTail);
+		if (gldStream.lAppWaiting)
+			SetEvent(gldStream.hDone);
+	}
+
+	SetEvent(gldStream.hStopped);
+	return 0;
+}
+
+//---------------------------------------------------------------------------
+// Resources
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamVBLock(
+	IDirect3DVertexBuffer9 *This,
+	UINT OffsetToLock,
+	UINT SizeToLock,
+	void **ppbData,
+	DWORD Flags)
+{
+	_gldStreamSyncLock(Flags);
+	return _GLD_STREAM_REAL(IDirect3DVertexBuffer9Vtbl, This)->Lock(This, OffsetToLock, SizeToLock, ppbData, Flags);
+}
+
+static void _gldHookStreamVertexBufferVtbl(
+	void *pVtbl)
+{
+	((IDirect3DVertexBuffer9Vtbl*)pVtbl)->Lock = _gldStreamVBLock;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamIBLock(
+	IDirect3DIndexBuffer9 *This,
+	UINT OffsetToLock,
+	UINT SizeToLock,
+	void **ppbData,
+	DWORD Flags)
+{
+	_gldStreamSyncLock(Flags);
+	return _GLD_STREAM_REAL(IDirect3DIndexBuffer9Vtbl, This)->Lock(This, OffsetToLock, SizeToLock, ppbData, Flags);
+}
+
+static void _gldHookStreamIndexBufferVtbl(
+	void *pVtbl)
+{
+	((IDirect3DIndexBuffer9Vtbl*)pVtbl)->Lock = _gldStreamIBLock;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSurfaceLockRect(
+	IDirect3DSurface9 *This,
+	D3DLOCKED_RECT *pLockedRect,
+	CONST RECT *pRect,
+	DWORD Flags)
+{
+	// Queued draws may still read the surface, or write to it
+	_gldStreamSyncLock(0);
+	return _GLD_STREAM_REAL(IDirect3DSurface9Vtbl, This)->LockRect(This, pLockedRect, pRect, Flags);
+}
+
+static void _gldHookStreamSurfaceVtbl(
+	void *pVtbl)
+{
+	((IDirect3DSurface9Vtbl*)pVtbl)->LockRect = _gldStreamSurfaceLockRect;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamTexLockRect(
+	IDirect3DTexture9 *This,
+	UINT Level,
+	D3DLOCKED_RECT *pLockedRect,
+	CONST RECT *pRect,
+	DWORD Flags)
+{
+	_gldStreamSyncLock(0);
+	return _GLD_STREAM_REAL(IDirect3DTexture9Vtbl, This)->LockRect(This, Level, pLockedRect, pRect, Flags);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamTexGetSurfaceLevel(
+	IDirect3DTexture9 *This,
+	UINT Level,
+	IDirect3DSurface9 **ppSurfaceLevel)
+{
+	HRESULT hr;
+
+	hr = _GLD_STREAM_REAL(IDirect3DTexture9Vtbl, This)->GetSurfaceLevel(This, Level, ppSurfaceLevel);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppSurfaceLevel, sizeof(IDirect3DSurface9Vtbl), _gldHookStreamSurfaceVtbl);
+	return hr;
+}
+
+static void _gldHookStreamTextureVtbl(
+	void *pVtbl)
+{
+	((IDirect3DTexture9Vtbl*)pVtbl)->LockRect			= _gldStreamTexLockRect;
+	((IDirect3DTexture9Vtbl*)pVtbl)->GetSurfaceLevel	= _gldStreamTexGetSurfaceLevel;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamStateBlockCapture(
+	IDirect3DStateBlock9 *This)
+{
+	_gldStreamSync(NULL);
+	return _GLD_STREAM_REAL(IDirect3DStateBlock9Vtbl, This)->Capture(This);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamStateBlockApply(
+	IDirect3DStateBlock9 *This)
+{
+	_gldStreamSync(NULL);
+	return _GLD_STREAM_REAL(IDirect3DStateBlock9Vtbl, This)->Apply(This);
+}
+
+static void _gldHookStreamStateBlockVtbl(
+	void *pVtbl)
+{
+	((IDirect3DStateBlock9Vtbl*)pVtbl)->Capture	= _gldStreamStateBlockCapture;
+	((IDirect3DStateBlock9Vtbl*)pVtbl)->Apply	= _gldStreamStateBlockApply;
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamQueryIssue(
+	IDirect3DQuery9 *This,
+	DWORD dwIssueFlags)
+{
+	// An event query has to follow the draws queued before it
+	_gldStreamSync(NULL);
+	return _GLD_STREAM_REAL(IDirect3DQuery9Vtbl, This)->Issue(This, dwIssueFlags);
+}
+
+static void _gldHookStreamQueryVtbl(
+	void *pVtbl)
+{
+	((IDirect3DQuery9Vtbl*)pVtbl)->Issue	= _gldStreamQueryIssue;
+}
+
+//---------------------------------------------------------------------------
+// Device: deferred calls
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetRenderState(
+	IDirect3DDevice9 *This,
+	D3DRENDERSTATETYPE State,
+	DWORD Value)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_RENDER_STATE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetRenderState(This, State, Value);
+	pCmd->Args[0] = State;
+	pCmd->Args[1] = Value;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetSamplerState(
+	IDirect3DDevice9 *This,
+	DWORD Sampler,
+	D3DSAMPLERSTATETYPE Type,
+	DWORD Value)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_SAMPLER_STATE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetSamplerState(This, Sampler, Type, Value);
+	pCmd->Args[0] = Sampler;
+	pCmd->Args[1] = Type;
+	pCmd->Args[2] = Value;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetTextureStageState(
+	IDirect3DDevice9 *This,
+	DWORD Stage,
+	D3DTEXTURESTAGESTATETYPE Type,
+	DWORD Value)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_TEXTURE_STAGE_STATE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetTextureStageState(This, Stage, Type, Value);
+	pCmd->Args[0] = Stage;
+	pCmd->Args[1] = Type;
+	pCmd->Args[2] = Value;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetTransform(
+	IDirect3DDevice9 *This,
+	D3DTRANSFORMSTATETYPE State,
+	CONST D3DMATRIX *pMatrix)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_TRANSFORM, sizeof(D3DMATRIX));
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetTransform(This, State, pMatrix);
+	pCmd->Args[0] = State;
+	memcpy(_GLD_STREAM_DATA(pCmd), pMatrix, sizeof(D3DMATRIX));
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetTexture(
+	IDirect3DDevice9 *This,
+	DWORD Stage,
+	IDirect3DBaseTexture9 *pTexture)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_TEXTURE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetTexture(This, Stage, pTexture);
+	pCmd->Args[0] = Stage;
+	_gldStreamRef(pCmd, 1, pTexture);
+	return _gldStreamCommit(pCmd);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetStreamSource(
+	IDirect3DDevice9 *This,
+	UINT StreamNumber,
+	IDirect3DVertexBuffer9 *pStreamData,
+	UINT OffsetInBytes,
+	UINT Stride)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_STREAM_SOURCE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetStreamSource(This, StreamNumber, pStreamData, OffsetInBytes, Stride);
+	pCmd->Args[0] = StreamNumber;
+	_gldStreamRef(pCmd, 1, pStreamData);
+	pCmd->Args[2] = OffsetInBytes;
+	pCmd->Args[3] = Stride;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetIndices(
+	IDirect3DDevice9 *This,
+	IDirect3DIndexBuffer9 *pIndexData)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_INDICES, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetIndices(This, pIndexData);
+	_gldStreamRef(pCmd, 0, pIndexData);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetVertexDeclaration(
+	IDirect3DDevice9 *This,
+	IDirect3DVertexDeclaration9 *pDecl)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_VERTEX_DECLARATION, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetVertexDeclaration(This, pDecl);
+	_gldStreamRef(pCmd, 0, pDecl);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetFVF(
+	IDirect3DDevice9 *This,
+	DWORD FVF)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_FVF, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetFVF(This, FVF);
+	pCmd->Args[0] = FVF;
+	return _gldStreamCommit(pCmd);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetVertexShader(
+	IDirect3DDevice9 *This,
+	IDirect3DVertexShader9 *pShader)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_VERTEX_SHADER, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetVertexShader(This, pShader);
+	_gldStreamRef(pCmd, 0, pShader);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetPixelShader(
+	IDirect3DDevice9 *This,
+	IDirect3DPixelShader9 *pShader)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_PIXEL_SHADER, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetPixelShader(This, pShader);
+	_gldStreamRef(pCmd, 0, pShader);
+	return _gldStreamCommit(pCmd);
+}
+
+//---------------------------------------------------------------------------
+
+static GLD_streamCmd *_gldStreamAllocConstants(
+	IDirect3DDevice9 *This,
+	GLD_streamOp Op,
+	UINT StartRegister,
+	CONST void *pConstantData,
+	UINT cbConstant,
+	UINT Count)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, Op, cbConstant * Count);
+
+	if (pCmd) {
+		pCmd->Args[0] = StartRegister;
+		pCmd->Args[1] = Count;
+		memcpy(_GLD_STREAM_DATA(pCmd), pConstantData, cbConstant * Count);
+	}
+	return pCmd;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetVertexShaderConstantF(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	CONST float *pConstantData,
+	UINT Vector4fCount)
+{
+	GLD_streamCmd *pCmd = _gldStreamAllocConstants(This, GLD_STREAM_SET_VS_CONSTANT_F, StartRegister, pConstantData, 4 * sizeof(float), Vector4fCount);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetVertexShaderConstantF(This, StartRegister, pConstantData, Vector4fCount);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetVertexShaderConstantI(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	CONST int *pConstantData,
+	UINT Vector4iCount)
+{
+	GLD_streamCmd *pCmd = _gldStreamAllocConstants(This, GLD_STREAM_SET_VS_CONSTANT_I, StartRegister, pConstantData, 4 * sizeof(int), Vector4iCount);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetVertexShaderConstantI(This, StartRegister, pConstantData, Vector4iCount);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetVertexShaderConstantB(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	CONST BOOL *pConstantData,
+	UINT BoolCount)
+{
+	GLD_streamCmd *pCmd = _gldStreamAllocConstants(This, GLD_STREAM_SET_VS_CONSTANT_B, StartRegister, pConstantData, sizeof(BOOL), BoolCount);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetVertexShaderConstantB(This, StartRegister, pConstantData, BoolCount);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetPixelShaderConstantF(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	CONST float *pConstantData,
+	UINT Vector4fCount)
+{
+	GLD_streamCmd *pCmd = _gldStreamAllocConstants(This, GLD_STREAM_SET_PS_CONSTANT_F, StartRegister, pConstantData, 4 * sizeof(float), Vector4fCount);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetPixelShaderConstantF(This, StartRegister, pConstantData, Vector4fCount);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetPixelShaderConstantI(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	CONST int *pConstantData,
+	UINT Vector4iCount)
+{
+	GLD_streamCmd *pCmd = _gldStreamAllocConstants(This, GLD_STREAM_SET_PS_CONSTANT_I, StartRegister, pConstantData, 4 * sizeof(int), Vector4iCount);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetPixelShaderConstantI(This, StartRegister, pConstantData, Vector4iCount);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetPixelShaderConstantB(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	CONST BOOL *pConstantData,
+	UINT BoolCount)
+{
+	GLD_streamCmd *pCmd = _gldStreamAllocConstants(This, GLD_STREAM_SET_PS_CONSTANT_B, StartRegister, pConstantData, sizeof(BOOL), BoolCount);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetPixelShaderConstantB(This, StartRegister, pConstantData, BoolCount);
+	return _gldStreamCommit(pCmd);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetViewport(
+	IDirect3DDevice9 *This,
+	CONST D3DVIEWPORT9 *pViewport)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_VIEWPORT, sizeof(D3DVIEWPORT9));
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetViewport(This, pViewport);
+	memcpy(_GLD_STREAM_DATA(pCmd), pViewport, sizeof(D3DVIEWPORT9));
+	// For GetViewport()
+	gldStream.Viewport	= *pViewport;
+	gldStream.bViewport	= TRUE;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetScissorRect(
+	IDirect3DDevice9 *This,
+	CONST RECT *pRect)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_SCISSOR_RECT, sizeof(RECT));
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetScissorRect(This, pRect);
+	memcpy(_GLD_STREAM_DATA(pCmd), pRect, sizeof(RECT));
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetClipPlane(
+	IDirect3DDevice9 *This,
+	DWORD Index,
+	CONST float *pPlane)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_CLIP_PLANE, 4 * sizeof(float));
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetClipPlane(This, Index, pPlane);
+	pCmd->Args[0] = Index;
+	memcpy(_GLD_STREAM_DATA(pCmd), pPlane, 4 * sizeof(float));
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetMaterial(
+	IDirect3DDevice9 *This,
+	CONST D3DMATERIAL9 *pMaterial)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_MATERIAL, sizeof(D3DMATERIAL9));
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetMaterial(This, pMaterial);
+	memcpy(_GLD_STREAM_DATA(pCmd), pMaterial, sizeof(D3DMATERIAL9));
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetLight(
+	IDirect3DDevice9 *This,
+	DWORD Index,
+	CONST D3DLIGHT9 *pLight)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_LIGHT, sizeof(D3DLIGHT9));
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetLight(This, Index, pLight);
+	pCmd->Args[0] = Index;
+	memcpy(_GLD_STREAM_DATA(pCmd), pLight, sizeof(D3DLIGHT9));
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamLightEnable(
+	IDirect3DDevice9 *This,
+	DWORD Index,
+	BOOL Enable)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_LIGHT_ENABLE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->LightEnable(This, Index, Enable);
+	pCmd->Args[0] = Index;
+	pCmd->Args[1] = Enable;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetNPatchMode(
+	IDirect3DDevice9 *This,
+	float nSegments)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_NPATCH_MODE, sizeof(float));
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetNPatchMode(This, nSegments);
+	*(float*)_GLD_STREAM_DATA(pCmd) = nSegments;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetSoftwareVertexProcessing(
+	IDirect3DDevice9 *This,
+	BOOL bSoftware)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_SET_SOFTWARE_VP, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetSoftwareVertexProcessing(This, bSoftware);
+	pCmd->Args[0] = bSoftware;
+	return _gldStreamCommit(pCmd);
+}
+
+//---------------------------------------------------------------------------
+
+static UINT _gldStreamPrimVerts(
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT PrimitiveCount)
+{
+	switch (PrimitiveType) {
+	case D3DPT_POINTLIST:		return PrimitiveCount;
+	case D3DPT_LINELIST:		return PrimitiveCount * 2;
+	case D3DPT_LINESTRIP:		return PrimitiveCount + 1;
+	case D3DPT_TRIANGLELIST:	return PrimitiveCount * 3;
+	default:					return PrimitiveCount + 2; // Strips and fans
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamDrawPrimitive(
+	IDirect3DDevice9 *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT StartVertex,
+	UINT PrimitiveCount)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_DRAW_PRIMITIVE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->DrawPrimitive(This, PrimitiveType, StartVertex, PrimitiveCount);
+	pCmd->Args[0] = PrimitiveType;
+	pCmd->Args[1] = StartVertex;
+	pCmd->Args[2] = PrimitiveCount;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamDrawIndexedPrimitive(
+	IDirect3DDevice9 *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	INT BaseVertexIndex,
+	UINT MinVertexIndex,
+	UINT NumVertices,
+	UINT startIndex,
+	UINT primCount)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_DRAW_INDEXED_PRIMITIVE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->DrawIndexedPrimitive(This, PrimitiveType, BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount);
+	pCmd->Args[0] = PrimitiveType;
+	pCmd->Args[1] = (UINT_PTR)(INT_PTR)BaseVertexIndex;
+	pCmd->Args[2] = MinVertexIndex;
+	pCmd->Args[3] = NumVertices;
+	pCmd->Args[4] = startIndex;
+	pCmd->Args[5] = primCount;
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamDrawPrimitiveUP(
+	IDirect3DDevice9 *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT PrimitiveCount,
+	CONST void *pVertexStreamZeroData,
+	UINT VertexStreamZeroStride)
+{
+	DWORD			cbVerts = _gldStreamPrimVerts(PrimitiveType, PrimitiveCount) * VertexStreamZeroStride;
+	GLD_streamCmd	*pCmd	= _gldStreamAlloc(This, GLD_STREAM_DRAW_PRIMITIVE_UP, cbVerts);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->DrawPrimitiveUP(This, PrimitiveType, PrimitiveCount, pVertexStreamZeroData, VertexStreamZeroStride);
+	pCmd->Args[0] = PrimitiveType;
+	pCmd->Args[1] = PrimitiveCount;
+	pCmd->Args[2] = VertexStreamZeroStride;
+	memcpy(_GLD_STREAM_DATA(pCmd), pVertexStreamZeroData, cbVerts);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamDrawIndexedPrimitiveUP(
+	IDirect3DDevice9 *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT MinVertexIndex,
+	UINT NumVertices,
+	UINT PrimitiveCount,
+	CONST void *pIndexData,
+	D3DFORMAT IndexDataFormat,
+	CONST void *pVertexStreamZeroData,
+	UINT VertexStreamZeroStride)
+{
+	// The indices are relative to pVertexStreamZeroData, so the vertices
+	// are copied from there, not from MinVertexIndex.
+	DWORD			cbVerts		= ((MinVertexIndex + NumVertices) * VertexStreamZeroStride + 7) & ~7;
+	DWORD			cbIndices	= _gldStreamPrimVerts(PrimitiveType, PrimitiveCount) * ((IndexDataFormat == D3DFMT_INDEX32) ? 4 : 2);
+	GLD_streamCmd	*pCmd		= _gldStreamAlloc(This, GLD_STREAM_DRAW_INDEXED_PRIMITIVE_UP, cbVerts + cbIndices);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->DrawIndexedPrimitiveUP(This, PrimitiveType, MinVertexIndex, NumVertices, PrimitiveCount, pIndexData, IndexDataFormat, pVertexStreamZeroData, VertexStreamZeroStride);
+	pCmd->Args[0] = PrimitiveType;
+	pCmd->Args[1] = MinVertexIndex;
+	pCmd->Args[2] = NumVertices;
+	pCmd->Args[3] = PrimitiveCount;
+	pCmd->Args[4] = IndexDataFormat;
+	pCmd->Args[5] = VertexStreamZeroStride;
+	pCmd->Args[6] = cbVerts;
+	memcpy(_GLD_STREAM_DATA(pCmd), pVertexStreamZeroData, (MinVertexIndex + NumVertices) * VertexStreamZeroStride);
+	memcpy(_GLD_STREAM_DATA(pCmd) + cbVerts, pIndexData, cbIndices);
+	return _gldStreamCommit(pCmd);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamClear(
+	IDirect3DDevice9 *This,
+	DWORD Count,
+	CONST D3DRECT *pRects,
+	DWORD Flags,
+	D3DCOLOR Color,
+	float Z,
+	DWORD Stencil)
+{
+	GLD_streamCmd *pCmd;
+
+	if (!pRects)
+		Count = 0;
+	pCmd = _gldStreamAlloc(This, GLD_STREAM_CLEAR, 8 + Count * sizeof(D3DRECT));
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->Clear(This, Count, pRects, Flags, Color, Z, Stencil);
+	pCmd->Args[0] = Count;
+	pCmd->Args[1] = Flags;
+	pCmd->Args[2] = Color;
+	pCmd->Args[3] = Stencil;
+	*(float*)_GLD_STREAM_DATA(pCmd) = Z;
+	if (Count)
+		memcpy(_GLD_STREAM_DATA(pCmd) + 8, pRects, Count * sizeof(D3DRECT));
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamBeginScene(
+	IDirect3DDevice9 *This)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_BEGIN_SCENE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->BeginScene(This);
+	return _gldStreamCommit(pCmd);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamEndScene(
+	IDirect3DDevice9 *This)
+{
+	GLD_streamCmd *pCmd = _gldStreamAlloc(This, GLD_STREAM_END_SCENE, 0);
+
+	if (!pCmd)
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->EndScene(This);
+	return _gldStreamCommit(pCmd);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamPresent(
+	IDirect3DDevice9 *This,
+	CONST RECT *pSourceRect,
+	CONST RECT *pDestRect,
+	HWND hDestWindowOverride,
+	CONST RGNDATA *pDirtyRegion)
+{
+	GLD_streamCmd	*pCmd;
+	DWORD			dwTail;
+
+	// GLDirect presents the whole back buffer; anything else is made in place
+	if (_gldStreamActive(This) && (pSourceRect || pDestRect || pDirtyRegion))
+		_gldStreamSync(This);
+	else if (_gldStreamActive(This)) {
+		// Keep the app no more than GLD_STREAM_MAX_FRAMES ahead of the
+		// worker, as the runtime would keep it ahead of the GPU.
+		if (gldStream.lFramesQueued - gldStream.lFramesDone >= GLD_STREAM_MAX_FRAMES)
+			gldStream.dwFrameWaits++;
+		while (!gldStream.bDead) {
+			dwTail = (DWORD)gldStream.lTail;
+			if (gldStream.lFramesQueued - gldStream.lFramesDone < GLD_STREAM_MAX_FRAMES)
+				break;
+			_gldStreamWait(dwTail);
+		}
+		pCmd = _gldStreamAlloc(This, GLD_STREAM_PRESENT, 0);
+		if (pCmd) {
+			pCmd->Args[0] = (UINT_PTR)hDestWindowOverride;
+			gldStream.lFramesQueued++;
+			return _gldStreamCommit(pCmd);
+		}
+	}
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->Present(This, pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion);
+}
+
+//---------------------------------------------------------------------------
+// Device: calls answered on the app thread
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetViewport(
+	IDirect3DDevice9 *This,
+	D3DVIEWPORT9 *pViewport)
+{
+	if (_gldStreamActive(This) && gldStream.bViewport) {
+		*pViewport = gldStream.Viewport;
+		return D3D_OK;
+	}
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetViewport(This, pViewport);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamTestCooperativeLevel(
+	IDirect3DDevice9 *This)
+{
+	HRESULT hr;
+
+	// Called every frame. Only ask the device once a Present() has failed.
+	if (!_gldStreamActive(This))
+		return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->TestCooperativeLevel(This);
+	if (gldStream.hrCooperative == D3D_OK)
+		return D3D_OK;
+	_gldStreamSync(This);
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->TestCooperativeLevel(This);
+	InterlockedExchange(&gldStream.hrCooperative, hr);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamReset(
+	IDirect3DDevice9 *This,
+	D3DPRESENT_PARAMETERS *pPresentationParameters)
+{
+	HRESULT hr;
+
+	_gldStreamSync(This);
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->Reset(This, pPresentationParameters);
+	// Reset() sets the viewport to the new back buffer
+	if (This == gldStream.pDev) {
+		gldStream.bViewport = FALSE;
+		if (SUCCEEDED(hr))
+			InterlockedExchange(&gldStream.hrCooperative, D3D_OK);
+	}
+	return hr;
+}
+
+//---------------------------------------------------------------------------
+// Device: calls made in place once the queue has drained
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetBackBuffer(
+	IDirect3DDevice9 *This,
+	UINT iSwapChain,
+	UINT iBackBuffer,
+	D3DBACKBUFFER_TYPE Type,
+	IDirect3DSurface9 **ppBackBuffer)
+{
+	// The caller reads from it or renders to it next
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetBackBuffer(This, iSwapChain, iBackBuffer, Type, ppBackBuffer);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamStretchRect(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 *pSourceSurface,
+	CONST RECT *pSourceRect,
+	IDirect3DSurface9 *pDestSurface,
+	CONST RECT *pDestRect,
+	D3DTEXTUREFILTERTYPE Filter)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->StretchRect(This, pSourceSurface, pSourceRect, pDestSurface, pDestRect, Filter);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetRenderTargetData(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 *pRenderTarget,
+	IDirect3DSurface9 *pDestSurface)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetRenderTargetData(This, pRenderTarget, pDestSurface);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamUpdateSurface(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 *pSourceSurface,
+	CONST RECT *pSourceRect,
+	IDirect3DSurface9 *pDestinationSurface,
+	CONST POINT *pDestPoint)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->UpdateSurface(This, pSourceSurface, pSourceRect, pDestinationSurface, pDestPoint);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamUpdateTexture(
+	IDirect3DDevice9 *This,
+	IDirect3DBaseTexture9 *pSourceTexture,
+	IDirect3DBaseTexture9 *pDestinationTexture)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->UpdateTexture(This, pSourceTexture, pDestinationTexture);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetRenderTarget(
+	IDirect3DDevice9 *This,
+	DWORD RenderTargetIndex,
+	IDirect3DSurface9 *pRenderTarget)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetRenderTarget(This, RenderTargetIndex, pRenderTarget);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetDepthStencilSurface(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 *pNewZStencil)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetDepthStencilSurface(This, pNewZStencil);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamValidateDevice(
+	IDirect3DDevice9 *This,
+	DWORD *pNumPasses)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->ValidateDevice(This, pNumPasses);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamEvictManagedResources(
+	IDirect3DDevice9 *This)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->EvictManagedResources(This);
+}
+
+static ULONG STDMETHODCALLTYPE _gldStreamRelease(
+	IDirect3DDevice9 *This)
+{
+	// The last reference must not go while calls are still queued
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->Release(This);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetCursorProperties(
+	IDirect3DDevice9 *This,
+	UINT XHotSpot,
+	UINT YHotSpot,
+	IDirect3DSurface9 *pCursorBitmap)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetCursorProperties(This, XHotSpot, YHotSpot, pCursorBitmap);
+}
+
+static void STDMETHODCALLTYPE _gldStreamSetCursorPosition(
+	IDirect3DDevice9 *This,
+	int X,
+	int Y,
+	DWORD Flags)
+{
+	_gldStreamSync(This);
+	_GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetCursorPosition(This, X, Y, Flags);
+}
+
+static BOOL STDMETHODCALLTYPE _gldStreamShowCursor(
+	IDirect3DDevice9 *This,
+	BOOL bShow)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->ShowCursor(This, bShow);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetDialogBoxMode(
+	IDirect3DDevice9 *This,
+	BOOL bEnableDialogs)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetDialogBoxMode(This, bEnableDialogs);
+}
+
+static void STDMETHODCALLTYPE _gldStreamSetGammaRamp(
+	IDirect3DDevice9 *This,
+	UINT iSwapChain,
+	DWORD Flags,
+	CONST D3DGAMMARAMP *pRamp)
+{
+	_gldStreamSync(This);
+	_GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetGammaRamp(This, iSwapChain, Flags, pRamp);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateAdditionalSwapChain(
+	IDirect3DDevice9 *This,
+	D3DPRESENT_PARAMETERS *pPresentationParameters,
+	IDirect3DSwapChain9 **pSwapChain)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateAdditionalSwapChain(This, pPresentationParameters, pSwapChain);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetSwapChain(
+	IDirect3DDevice9 *This,
+	UINT iSwapChain,
+	IDirect3DSwapChain9 **pSwapChain)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetSwapChain(This, iSwapChain, pSwapChain);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetFrontBufferData(
+	IDirect3DDevice9 *This,
+	UINT iSwapChain,
+	IDirect3DSurface9 *pDestSurface)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetFrontBufferData(This, iSwapChain, pDestSurface);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamColorFill(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 *pSurface,
+	CONST RECT *pRect,
+	D3DCOLOR color)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->ColorFill(This, pSurface, pRect, color);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamMultiplyTransform(
+	IDirect3DDevice9 *This,
+	D3DTRANSFORMSTATETYPE State,
+	CONST D3DMATRIX *pMatrix)
+{
+	// Multiplies the transform that is still queued
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->MultiplyTransform(This, State, pMatrix);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetClipStatus(
+	IDirect3DDevice9 *This,
+	CONST D3DCLIPSTATUS9 *pClipStatus)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetClipStatus(This, pClipStatus);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetPaletteEntries(
+	IDirect3DDevice9 *This,
+	UINT PaletteNumber,
+	CONST PALETTEENTRY *pEntries)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetPaletteEntries(This, PaletteNumber, pEntries);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetCurrentTexturePalette(
+	IDirect3DDevice9 *This,
+	UINT PaletteNumber)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetCurrentTexturePalette(This, PaletteNumber);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamSetStreamSourceFreq(
+	IDirect3DDevice9 *This,
+	UINT StreamNumber,
+	UINT Setting)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->SetStreamSourceFreq(This, StreamNumber, Setting);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamProcessVertices(
+	IDirect3DDevice9 *This,
+	UINT SrcStartIndex,
+	UINT DestIndex,
+	UINT VertexCount,
+	IDirect3DVertexBuffer9 *pDestBuffer,
+	IDirect3DVertexDeclaration9 *pVertexDecl,
+	DWORD Flags)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->ProcessVertices(This, SrcStartIndex, DestIndex, VertexCount, pDestBuffer, pVertexDecl, Flags);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamDrawRectPatch(
+	IDirect3DDevice9 *This,
+	UINT Handle,
+	CONST float *pNumSegs,
+	CONST D3DRECTPATCH_INFO *pRectPatchInfo)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->DrawRectPatch(This, Handle, pNumSegs, pRectPatchInfo);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamDrawTriPatch(
+	IDirect3DDevice9 *This,
+	UINT Handle,
+	CONST float *pNumSegs,
+	CONST D3DTRIPATCH_INFO *pTriPatchInfo)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->DrawTriPatch(This, Handle, pNumSegs, pTriPatchInfo);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamDeletePatch(
+	IDirect3DDevice9 *This,
+	UINT Handle)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->DeletePatch(This, Handle);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetRenderState(
+	IDirect3DDevice9 *This,
+	D3DRENDERSTATETYPE State,
+	DWORD *pValue)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetRenderState(This, State, pValue);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetSamplerState(
+	IDirect3DDevice9 *This,
+	DWORD Sampler,
+	D3DSAMPLERSTATETYPE Type,
+	DWORD *pValue)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetSamplerState(This, Sampler, Type, pValue);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetTextureStageState(
+	IDirect3DDevice9 *This,
+	DWORD Stage,
+	D3DTEXTURESTAGESTATETYPE Type,
+	DWORD *pValue)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetTextureStageState(This, Stage, Type, pValue);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetTransform(
+	IDirect3DDevice9 *This,
+	D3DTRANSFORMSTATETYPE State,
+	D3DMATRIX *pMatrix)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetTransform(This, State, pMatrix);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetTexture(
+	IDirect3DDevice9 *This,
+	DWORD Stage,
+	IDirect3DBaseTexture9 **ppTexture)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetTexture(This, Stage, ppTexture);
+}
+
+static UINT STDMETHODCALLTYPE _gldStreamGetAvailableTextureMem(
+	IDirect3DDevice9 *This)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetAvailableTextureMem(This);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetDirect3D(
+	IDirect3DDevice9 *This,
+	IDirect3D9 **ppD3D9)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetDirect3D(This, ppD3D9);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetDeviceCaps(
+	IDirect3DDevice9 *This,
+	D3DCAPS9 *pCaps)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetDeviceCaps(This, pCaps);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetDisplayMode(
+	IDirect3DDevice9 *This,
+	UINT iSwapChain,
+	D3DDISPLAYMODE *pMode)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetDisplayMode(This, iSwapChain, pMode);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetCreationParameters(
+	IDirect3DDevice9 *This,
+	D3DDEVICE_CREATION_PARAMETERS *pParameters)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetCreationParameters(This, pParameters);
+}
+
+static UINT STDMETHODCALLTYPE _gldStreamGetNumberOfSwapChains(
+	IDirect3DDevice9 *This)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetNumberOfSwapChains(This);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetRasterStatus(
+	IDirect3DDevice9 *This,
+	UINT iSwapChain,
+	D3DRASTER_STATUS *pRasterStatus)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetRasterStatus(This, iSwapChain, pRasterStatus);
+}
+
+static void STDMETHODCALLTYPE _gldStreamGetGammaRamp(
+	IDirect3DDevice9 *This,
+	UINT iSwapChain,
+	D3DGAMMARAMP *pRamp)
+{
+	_gldStreamSync(This);
+	_GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetGammaRamp(This, iSwapChain, pRamp);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetRenderTarget(
+	IDirect3DDevice9 *This,
+	DWORD RenderTargetIndex,
+	IDirect3DSurface9 **ppRenderTarget)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetRenderTarget(This, RenderTargetIndex, ppRenderTarget);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetDepthStencilSurface(
+	IDirect3DDevice9 *This,
+	IDirect3DSurface9 **ppZStencilSurface)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetDepthStencilSurface(This, ppZStencilSurface);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetMaterial(
+	IDirect3DDevice9 *This,
+	D3DMATERIAL9 *pMaterial)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetMaterial(This, pMaterial);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetLight(
+	IDirect3DDevice9 *This,
+	DWORD Index,
+	D3DLIGHT9 *pLight)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetLight(This, Index, pLight);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetLightEnable(
+	IDirect3DDevice9 *This,
+	DWORD Index,
+	BOOL *pEnable)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetLightEnable(This, Index, pEnable);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetClipPlane(
+	IDirect3DDevice9 *This,
+	DWORD Index,
+	float *pPlane)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetClipPlane(This, Index, pPlane);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetClipStatus(
+	IDirect3DDevice9 *This,
+	D3DCLIPSTATUS9 *pClipStatus)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetClipStatus(This, pClipStatus);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetPaletteEntries(
+	IDirect3DDevice9 *This,
+	UINT PaletteNumber,
+	PALETTEENTRY *pEntries)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetPaletteEntries(This, PaletteNumber, pEntries);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetCurrentTexturePalette(
+	IDirect3DDevice9 *This,
+	UINT *PaletteNumber)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetCurrentTexturePalette(This, PaletteNumber);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetScissorRect(
+	IDirect3DDevice9 *This,
+	RECT *pRect)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetScissorRect(This, pRect);
+}
+
+static BOOL STDMETHODCALLTYPE _gldStreamGetSoftwareVertexProcessing(
+	IDirect3DDevice9 *This)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetSoftwareVertexProcessing(This);
+}
+
+static float STDMETHODCALLTYPE _gldStreamGetNPatchMode(
+	IDirect3DDevice9 *This)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetNPatchMode(This);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetVertexDeclaration(
+	IDirect3DDevice9 *This,
+	IDirect3DVertexDeclaration9 **ppDecl)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetVertexDeclaration(This, ppDecl);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetFVF(
+	IDirect3DDevice9 *This,
+	DWORD *pFVF)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetFVF(This, pFVF);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetVertexShader(
+	IDirect3DDevice9 *This,
+	IDirect3DVertexShader9 **ppShader)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetVertexShader(This, ppShader);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetVertexShaderConstantF(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	float *pConstantData,
+	UINT Vector4fCount)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetVertexShaderConstantF(This, StartRegister, pConstantData, Vector4fCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetVertexShaderConstantI(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	int *pConstantData,
+	UINT Vector4iCount)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetVertexShaderConstantI(This, StartRegister, pConstantData, Vector4iCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetVertexShaderConstantB(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	BOOL *pConstantData,
+	UINT BoolCount)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetVertexShaderConstantB(This, StartRegister, pConstantData, BoolCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetStreamSource(
+	IDirect3DDevice9 *This,
+	UINT StreamNumber,
+	IDirect3DVertexBuffer9 **ppStreamData,
+	UINT *pOffsetInBytes,
+	UINT *pStride)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetStreamSource(This, StreamNumber, ppStreamData, pOffsetInBytes, pStride);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetStreamSourceFreq(
+	IDirect3DDevice9 *This,
+	UINT StreamNumber,
+	UINT *pSetting)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetStreamSourceFreq(This, StreamNumber, pSetting);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetIndices(
+	IDirect3DDevice9 *This,
+	IDirect3DIndexBuffer9 **ppIndexData)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetIndices(This, ppIndexData);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetPixelShader(
+	IDirect3DDevice9 *This,
+	IDirect3DPixelShader9 **ppShader)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetPixelShader(This, ppShader);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetPixelShaderConstantF(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	float *pConstantData,
+	UINT Vector4fCount)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetPixelShaderConstantF(This, StartRegister, pConstantData, Vector4fCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetPixelShaderConstantI(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	int *pConstantData,
+	UINT Vector4iCount)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetPixelShaderConstantI(This, StartRegister, pConstantData, Vector4iCount);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamGetPixelShaderConstantB(
+	IDirect3DDevice9 *This,
+	UINT StartRegister,
+	BOOL *pConstantData,
+	UINT BoolCount)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->GetPixelShaderConstantB(This, StartRegister, pConstantData, BoolCount);
+}
+
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateStateBlock(
+	IDirect3DDevice9 *This,
+	D3DSTATEBLOCKTYPE Type,
+	IDirect3DStateBlock9 **ppSB)
+{
+	HRESULT hr;
+
+	// Captures the device state as it is created. D3DX effects save
+	// state this way unless they are begun with D3DXFX_DONOTSAVESTATE.
+	_gldStreamSync(This);
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateStateBlock(This, Type, ppSB);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppSB, sizeof(IDirect3DStateBlock9Vtbl), _gldHookStreamStateBlockVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamBeginStateBlock(
+	IDirect3DDevice9 *This)
+{
+	_gldStreamSync(This);
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->BeginStateBlock(This);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamEndStateBlock(
+	IDirect3DDevice9 *This,
+	IDirect3DStateBlock9 **ppSB)
+{
+	HRESULT hr;
+
+	_gldStreamSync(This);
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->EndStateBlock(This, ppSB);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppSB, sizeof(IDirect3DStateBlock9Vtbl), _gldHookStreamStateBlockVtbl);
+	return hr;
+}
+
+//---------------------------------------------------------------------------
+// Device: resources are hooked as they are created
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateTexture(
+	IDirect3DDevice9 *This,
+	UINT Width,
+	UINT Height,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DTexture9 **ppTexture,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateTexture(This, Width, Height, Levels, Usage, Format, Pool, ppTexture, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppTexture, sizeof(IDirect3DTexture9Vtbl), _gldHookStreamTextureVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateVertexBuffer(
+	IDirect3DDevice9 *This,
+	UINT Length,
+	DWORD Usage,
+	DWORD FVF,
+	D3DPOOL Pool,
+	IDirect3DVertexBuffer9 **ppVertexBuffer,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateVertexBuffer(This, Length, Usage, FVF, Pool, ppVertexBuffer, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppVertexBuffer, sizeof(IDirect3DVertexBuffer9Vtbl), _gldHookStreamVertexBufferVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateIndexBuffer(
+	IDirect3DDevice9 *This,
+	UINT Length,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DIndexBuffer9 **ppIndexBuffer,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateIndexBuffer(This, Length, Usage, Format, Pool, ppIndexBuffer, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppIndexBuffer, sizeof(IDirect3DIndexBuffer9Vtbl), _gldHookStreamIndexBufferVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateOffscreenPlainSurface(
+	IDirect3DDevice9 *This,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DSurface9 **ppSurface,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	// Readback copies are locked once GetRenderTargetData() has been made
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateOffscreenPlainSurface(This, Width, Height, Format, Pool, ppSurface, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppSurface, sizeof(IDirect3DSurface9Vtbl), _gldHookStreamSurfaceVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateRenderTarget(
+	IDirect3DDevice9 *This,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	D3DMULTISAMPLE_TYPE MultiSample,
+	DWORD MultisampleQuality,
+	BOOL Lockable,
+	IDirect3DSurface9 **ppSurface,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateRenderTarget(This, Width, Height, Format, MultiSample, MultisampleQuality, Lockable, ppSurface, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppSurface, sizeof(IDirect3DSurface9Vtbl), _gldHookStreamSurfaceVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateDepthStencilSurface(
+	IDirect3DDevice9 *This,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	D3DMULTISAMPLE_TYPE MultiSample,
+	DWORD MultisampleQuality,
+	BOOL Discard,
+	IDirect3DSurface9 **ppSurface,
+	HANDLE *pSharedHandle)
+{
+	HRESULT hr;
+
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateDepthStencilSurface(This, Width, Height, Format, MultiSample, MultisampleQuality, Discard, ppSurface, pSharedHandle);
+	if (SUCCEEDED(hr))
+		_gldStreamHookObject(*ppSurface, sizeof(IDirect3DSurface9Vtbl), _gldHookStreamSurfaceVtbl);
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateQuery(
+	IDirect3DDevice9 *This,
+	D3DQUERYTYPE Type,
+	IDirect3DQuery9 **ppQuery)
+{
+	HRESULT hr;
+
+	// A NULL ppQuery only asks whether the type is supported
+	hr = _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateQuery(This, Type, ppQuery);
+	if (SUCCEEDED(hr) && ppQuery)
+		_gldStreamHookObject(*ppQuery, sizeof(IDirect3DQuery9Vtbl), _gldHookStreamQueryVtbl);
+	return hr;
+}
+
+//---------------------------------------------------------------------------
+// Device: calls that are safe on a D3DCREATE_MULTITHREADED device at any
+// time, and create objects that GLDirect never locks
+//---------------------------------------------------------------------------
+
+static HRESULT STDMETHODCALLTYPE _gldStreamQueryInterface(
+	IDirect3DDevice9 *This,
+	REFIID riid,
+	void **ppvObj)
+{
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->QueryInterface(This, riid, ppvObj);
+}
+
+static ULONG STDMETHODCALLTYPE _gldStreamAddRef(
+	IDirect3DDevice9 *This)
+{
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->AddRef(This);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateVolumeTexture(
+	IDirect3DDevice9 *This,
+	UINT Width,
+	UINT Height,
+	UINT Depth,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DVolumeTexture9 **ppVolumeTexture,
+	HANDLE *pSharedHandle)
+{
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateVolumeTexture(This, Width, Height, Depth, Levels, Usage, Format, Pool, ppVolumeTexture, pSharedHandle);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateCubeTexture(
+	IDirect3DDevice9 *This,
+	UINT EdgeLength,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DCubeTexture9 **ppCubeTexture,
+	HANDLE *pSharedHandle)
+{
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateCubeTexture(This, EdgeLength, Levels, Usage, Format, Pool, ppCubeTexture, pSharedHandle);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateVertexDeclaration(
+	IDirect3DDevice9 *This,
+	CONST D3DVERTEXELEMENT9 *pVertexElements,
+	IDirect3DVertexDeclaration9 **ppDecl)
+{
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateVertexDeclaration(This, pVertexElements, ppDecl);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreateVertexShader(
+	IDirect3DDevice9 *This,
+	CONST DWORD *pFunction,
+	IDirect3DVertexShader9 **ppShader)
+{
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreateVertexShader(This, pFunction, ppShader);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldStreamCreatePixelShader(
+	IDirect3DDevice9 *This,
+	CONST DWORD *pFunction,
+	IDirect3DPixelShader9 **ppShader)
+{
+	return _GLD_STREAM_REAL(IDirect3DDevice9Vtbl, This)->CreatePixelShader(This, pFunction, ppShader);
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldHookStreamDeviceVtbl(
+	void *pVtbl)
+{
+	IDirect3DDevice9Vtbl *v = (IDirect3DDevice9Vtbl*)pVtbl;
+
+	// Deferred
+	v->SetRenderState				= _gldStreamSetRenderState;
+	v->SetSamplerState				= _gldStreamSetSamplerState;
+	v->SetTextureStageState			= _gldStreamSetTextureStageState;
+	v->SetTransform					= _gldStreamSetTransform;
+	v->SetTexture					= _gldStreamSetTexture;
+	v->SetStreamSource				= _gldStreamSetStreamSource;
+	v->SetIndices					= _gldStreamSetIndices;
+	v->SetVertexDeclaration			= _gldStreamSetVertexDeclaration;
+	v->SetFVF						= _gldStreamSetFVF;
+	v->SetVertexShader				= _gldStreamSetVertexShader;
+	v->SetPixelShader				= _gldStreamSetPixelShader;
+	v->SetVertexShaderConstantF		= _gldStreamSetVertexShaderConstantF;
+	v->SetVertexShaderConstantI		= _gldStreamSetVertexShaderConstantI;
+	v->SetVertexShaderConstantB		= _gldStreamSetVertexShaderConstantB;
+	v->SetPixelShaderConstantF		= _gldStreamSetPixelShaderConstantF;
+	v->SetPixelShaderConstantI		= _gldStreamSetPixelShaderConstantI;
+	v->SetPixelShaderConstantB		= _gldStreamSetPixelShaderConstantB;
+	v->SetViewport					= _gldStreamSetViewport;
+	v->SetScissorRect				= _gldStreamSetScissorRect;
+	v->SetClipPlane					= _gldStreamSetClipPlane;
+	v->SetMaterial					= _gldStreamSetMaterial;
+	v->SetLight						= _gldStreamSetLight;
+	v->LightEnable					= _gldStreamLightEnable;
+	v->SetNPatchMode				= _gldStreamSetNPatchMode;
+	v->SetSoftwareVertexProcessing	= _gldStreamSetSoftwareVertexProcessing;
+	v->DrawPrimitive				= _gldStreamDrawPrimitive;
+	v->DrawIndexedPrimitive			= _gldStreamDrawIndexedPrimitive;
+	v->DrawPrimitiveUP				= _gldStreamDrawPrimitiveUP;
+	v->DrawIndexedPrimitiveUP		= _gldStreamDrawIndexedPrimitiveUP;
+	v->Clear						= _gldStreamClear;
+	v->BeginScene					= _gldStreamBeginScene;
+	v->EndScene						= _gldStreamEndScene;
+	v->Present						= _gldStreamPresent;
+
+	// Answered on the app thread
+	v->GetViewport					= _gldStreamGetViewport;
+	v->TestCooperativeLevel			= _gldStreamTestCooperativeLevel;
+	v->Reset						= _gldStreamReset;
+
+	// Made in place
+	v->GetBackBuffer				= _gldStreamGetBackBuffer;
+	v->StretchRect					= _gldStreamStretchRect;
+	v->GetRenderTargetData			= _gldStreamGetRenderTargetData;
+	v->UpdateSurface				= _gldStreamUpdateSurface;
+	v->UpdateTexture				= _gldStreamUpdateTexture;
+	v->SetRenderTarget				= _gldStreamSetRenderTarget;
+	v->SetDepthStencilSurface		= _gldStreamSetDepthStencilSurface;
+	v->ValidateDevice				= _gldStreamValidateDevice;
+	v->EvictManagedResources		= _gldStreamEvictManagedResources;
+	v->GetRenderState				= _gldStreamGetRenderState;
+	v->GetSamplerState				= _gldStreamGetSamplerState;
+	v->GetTextureStageState			= _gldStreamGetTextureStageState;
+	v->GetTransform					= _gldStreamGetTransform;
+	v->GetTexture					= _gldStreamGetTexture;
+	v->CreateStateBlock				= _gldStreamCreateStateBlock;
+	v->BeginStateBlock				= _gldStreamBeginStateBlock;
+	v->EndStateBlock				= _gldStreamEndStateBlock;
+	v->Release						= _gldStreamRelease;
+	v->SetCursorProperties			= _gldStreamSetCursorProperties;
+	v->SetCursorPosition			= _gldStreamSetCursorPosition;
+	v->ShowCursor					= _gldStreamShowCursor;
+	v->SetDialogBoxMode				= _gldStreamSetDialogBoxMode;
+	v->SetGammaRamp					= _gldStreamSetGammaRamp;
+	v->CreateAdditionalSwapChain	= _gldStreamCreateAdditionalSwapChain;
+	v->GetSwapChain					= _gldStreamGetSwapChain;
+	v->GetFrontBufferData			= _gldStreamGetFrontBufferData;
+	v->ColorFill					= _gldStreamColorFill;
+	v->MultiplyTransform			= _gldStreamMultiplyTransform;
+	v->SetClipStatus				= _gldStreamSetClipStatus;
+	v->SetPaletteEntries			= _gldStreamSetPaletteEntries;
+	v->SetCurrentTexturePalette		= _gldStreamSetCurrentTexturePalette;
+	v->SetStreamSourceFreq			= _gldStreamSetStreamSourceFreq;
+	v->ProcessVertices				= _gldStreamProcessVertices;
+	v->DrawRectPatch				= _gldStreamDrawRectPatch;
+	v->DrawTriPatch					= _gldStreamDrawTriPatch;
+	v->DeletePatch					= _gldStreamDeletePatch;
+	v->GetAvailableTextureMem		= _gldStreamGetAvailableTextureMem;
+	v->GetDirect3D					= _gldStreamGetDirect3D;
+	v->GetDeviceCaps				= _gldStreamGetDeviceCaps;
+	v->GetDisplayMode				= _gldStreamGetDisplayMode;
+	v->GetCreationParameters		= _gldStreamGetCreationParameters;
+	v->GetNumberOfSwapChains		= _gldStreamGetNumberOfSwapChains;
+	v->GetRasterStatus				= _gldStreamGetRasterStatus;
+	v->GetGammaRamp					= _gldStreamGetGammaRamp;
+	v->GetRenderTarget				= _gldStreamGetRenderTarget;
+	v->GetDepthStencilSurface		= _gldStreamGetDepthStencilSurface;
+	v->GetMaterial					= _gldStreamGetMaterial;
+	v->GetLight						= _gldStreamGetLight;
+	v->GetLightEnable				= _gldStreamGetLightEnable;
+	v->GetClipPlane					= _gldStreamGetClipPlane;
+	v->GetClipStatus				= _gldStreamGetClipStatus;
+	v->GetPaletteEntries			= _gldStreamGetPaletteEntries;
+	v->GetCurrentTexturePalette		= _gldStreamGetCurrentTexturePalette;
+	v->GetScissorRect				= _gldStreamGetScissorRect;
+	v->GetSoftwareVertexProcessing	= _gldStreamGetSoftwareVertexProcessing;
+	v->GetNPatchMode				= _gldStreamGetNPatchMode;
+	v->GetVertexDeclaration			= _gldStreamGetVertexDeclaration;
+	v->GetFVF						= _gldStreamGetFVF;
+	v->GetVertexShader				= _gldStreamGetVertexShader;
+	v->GetVertexShaderConstantF		= _gldStreamGetVertexShaderConstantF;
+	v->GetVertexShaderConstantI		= _gldStreamGetVertexShaderConstantI;
+	v->GetVertexShaderConstantB		= _gldStreamGetVertexShaderConstantB;
+	v->GetStreamSource				= _gldStreamGetStreamSource;
+	v->GetStreamSourceFreq			= _gldStreamGetStreamSourceFreq;
+	v->GetIndices					= _gldStreamGetIndices;
+	v->GetPixelShader				= _gldStreamGetPixelShader;
+	v->GetPixelShaderConstantF		= _gldStreamGetPixelShaderConstantF;
+	v->GetPixelShaderConstantI		= _gldStreamGetPixelShaderConstantI;
+	v->GetPixelShaderConstantB		= _gldStreamGetPixelShaderConstantB;
+
+	// Resources
+	v->CreateTexture				= _gldStreamCreateTexture;
+	v->CreateVertexBuffer			= _gldStreamCreateVertexBuffer;
+	v->CreateIndexBuffer			= _gldStreamCreateIndexBuffer;
+	v->CreateOffscreenPlainSurface	= _gldStreamCreateOffscreenPlainSurface;
+	v->CreateRenderTarget			= _gldStreamCreateRenderTarget;
+	v->CreateDepthStencilSurface	= _gldStreamCreateDepthStencilSurface;
+	v->CreateQuery					= _gldStreamCreateQuery;
+
+	// Made directly, without draining
+	v->QueryInterface				= _gldStreamQueryInterface;
+	v->AddRef						= _gldStreamAddRef;
+	v->CreateVolumeTexture			= _gldStreamCreateVolumeTexture;
+	v->CreateCubeTexture			= _gldStreamCreateCubeTexture;
+	v->CreateVertexDeclaration		= _gldStreamCreateVertexDeclaration;
+	v->CreateVertexShader			= _gldStreamCreateVertexShader;
+	v->CreatePixelShader			= _gldStreamCreatePixelShader;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldStreamCloseHandles(void)
+{
+	if (gldStream.hThread) {
+		CloseHandle(gldStream.hThread);
+		gldStream.hThread = NULL;
+	}
+	if (gldStream.hWork) {
+		CloseHandle(gldStream.hWork);
+		gldStream.hWork = NULL;
+	}
+	if (gldStream.hDone) {
+		CloseHandle(gldStream.hDone);
+		gldStream.hDone = NULL;
+	}
+	if (gldStream.hStopped) {
+		CloseHandle(gldStream.hStopped);
+		gldStream.hStopped = NULL;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+void gldStartStream(
+	IDirect3DDevice9 *pDev)
+{
+	//
+	// Queue pDev's calls for a worker thread. Called after the recorder
+	// and profiler have hooked the device, and only one device is streamed
+	// at a time; any others are driven from the app thread as before.
+	//
+
+	if (!glb.bCommandStream || !pDev)
+		return;
+	if (gldStream.pDev) {
+		if (gldStream.pDev != pDev)
+			gldLogMessage(GLDLOG_INFO, "Stream: already streaming a device, this one is not streamed\n");
+		return;
+	}
+
+	if (!gldStream.pRing) {
+		gldStream.pRing = (BYTE*)MALLOC(GLD_STREAM_RING_SIZE);
+		if (!gldStream.pRing) {
+			gldLogMessage(GLDLOG_WARN, "Stream: unable to allocate the ring\n");
+			return;
+		}
+	}
+
+	gldStream.dwHead		= 0;
+	gldStream.lHead			= 0;
+	gldStream.lTail			= 0;
+	gldStream.lWorkerIdle	= 0;
+	gldStream.lAppWaiting	= 0;
+	gldStream.lStop			= 0;
+	gldStream.lFramesQueued	= 0;
+	gldStream.lFramesDone	= 0;
+	gldStream.hrCooperative	= D3D_OK;
+	gldStream.bViewport		= FALSE;
+	gldStream.bDead			= FALSE;
+	gldStream.dwCommands	= 0;
+	gldStream.qwBytes		= 0;
+	gldStream.dwSyncs		= 0;
+	gldStream.dwLockSyncs	= 0;
+	gldStream.dwFrameWaits	= 0;
+	gldStream.dwErrors		= 0;
+
+	gldStream.hWork		= CreateEvent(NULL, FALSE, FALSE, NULL);
+	gldStream.hDone		= CreateEvent(NULL, FALSE, FALSE, NULL);
+	gldStream.hStopped	= CreateEvent(NULL, TRUE, FALSE, NULL);
+	if (gldStream.hWork && gldStream.hDone && gldStream.hStopped)
+		gldStream.hThread = CreateThread(NULL, 0, _gldStreamWorker, NULL, 0, &gldStream.dwWorkerId);
+	if (!gldStream.hThread) {
+		gldLogMessage(GLDLOG_WARN, "Stream: unable to start the worker\n");
+		_gldStreamCloseHandles();
+		return;
+	}
+
+	// Buffers and textures the device already has are hooked by the
+	// GLDirect calls that create them, which all come after this.
+	_gldStreamHookObject(pDev, sizeof(IDirect3DDevice9Vtbl), _gldHookStreamDeviceVtbl);
+	gldStream.pDev = pDev;
+
+	gldLogMessage(GLDLOG_INFO, "Stream: submitting device calls from a worker thread\n");
+}
+
+//---------------------------------------------------------------------------
+
+void gldSyncStream(void)
+{
+	// glFinish()
+	_gldStreamSync(NULL);
+}
+
+//---------------------------------------------------------------------------
+
+void gldStopStream(
+	IDirect3DDevice9 *pDev)
+{
+	HANDLE	hWait[2];
+	DWORD	dwWait;
+	DWORD	dwFrames;
+
+	if (!pDev || (pDev != gldStream.pDev))
+		return;
+
+	// Make the last calls, then stop the worker. When the process is
+	// exiting it has already been killed, so wait for either it to stop
+	// or its thread to end, as gldLogClose() does.
+	_gldStreamDrain();
+	InterlockedExchange(&gldStream.lStop, 1);
+	SetEvent(gldStream.hWork);
+	hWait[0] = gldStream.hStopped;
+	hWait[1] = gldStream.hThread;
+	dwWait = WaitForMultipleObjects(2, hWait, FALSE, 1000);
+
+	gldStream.pDev = NULL;
+	gldStream.dwWorkerId = 0;
+	_gldStreamCloseHandles();
+
+	// A worker that is still running may yet look at the ring
+	if ((dwWait == WAIT_OBJECT_0) || (dwWait == WAIT_OBJECT_0 + 1)) {
+		FREE(gldStream.pRing);
+		gldStream.pRing = NULL;
+	}
+
+	dwFrames = gldStream.lFramesQueued ? gldStream.lFramesQueued : 1;
+	gldLogPrintf(GLDLOG_INFO, "Stream: %u frames, %u calls, %I64u KB queued",
+		gldStream.lFramesQueued,
+		gldStream.dwCommands,
+		gldStream.qwBytes / 1024);
+	gldLogPrintf(GLDLOG_INFO, "Stream: per frame %u calls, %u drains (%u for locks); %u frames waited for the worker",
+		gldStream.dwCommands / dwFrames,
+		gldStream.dwSyncs / dwFrames,
+		gldStream.dwLockSyncs / dwFrames,
+		gldStream.dwFrameWaits);
+}
+
+//---------------------------------------------------------------------------
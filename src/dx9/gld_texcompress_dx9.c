@@ -0,0 +1,315 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  DXT texture storage. Unpacks GL images and encodes them
+*               straight into locked DXT1/3/5 surfaces, splitting large
+*               images across a pool of worker threads.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+#include "texformat.h"
+#include "texstore.h"
+#include "texcompress.h"
+
+//---------------------------------------------------------------------------
+
+// Images at least this big are encoded on more than one thread
+#define GLD_COMPRESS_MT_TEXELS		(256*256)
+
+typedef struct {
+	GLcontext							*ctx;
+	const struct gl_texture_format		*dstFormat;
+	const GLchan						*pSrc;		// RGBA GLchan rows
+	GLint								width;
+	GLint								height;		// Rows in this band
+	BYTE								*pDst;		// First block row of band
+	INT									iPitch;		// Bytes per block row
+} GLD_compressBand;
+
+//---------------------------------------------------------------------------
+
+BOOL gldIsCompressedFormat(
+	D3DFORMAT d3dFormat)
+{
+	switch (d3dFormat) {
+	case D3DFMT_DXT1:
+	case D3DFMT_DXT2:
+	case D3DFMT_DXT3:
+	case D3DFMT_DXT4:
+	case D3DFMT_DXT5:
+		return TRUE;
+	}
+	return FALSE;
+}
+
+//---------------------------------------------------------------------------
+
+D3DFORMAT gldCompressedFormat(
+	D3DFORMAT d3dFormat)
+{
+	// DXT equivalent of an uncompressed format, for bCompressTextures.
+	// Luminance and alpha formats are already small and do not
+	// survive DXT colour quantisation well, so they are left alone.
+	switch (d3dFormat) {
+	case D3DFMT_R8G8B8:
+	case D3DFMT_X8R8G8B8:
+	case D3DFMT_R5G6B5:
+	case D3DFMT_X1R5G5B5:
+	case D3DFMT_X4R4G4B4:
+		return D3DFMT_DXT1;
+	case D3DFMT_A8R8G8B8:
+	case D3DFMT_A4R4G4B4:
+	case D3DFMT_A1R5G5B5:
+		return D3DFMT_DXT5;
+	}
+	return d3dFormat;
+}
+
+//---------------------------------------------------------------------------
+
+static const struct gl_texture_format* _gldMesaCompressedFormat(
+	D3DFORMAT d3dFormat)
+{
+	switch (d3dFormat) {
+	case D3DFMT_DXT1:
+		return &_mesa_texformat_rgb_dxt1;
+	case D3DFMT_DXT2:
+	case D3DFMT_DXT3:
+		return &_mesa_texformat_rgba_dxt3;
+	case D3DFMT_DXT4:
+	case D3DFMT_DXT5:
+		return &_mesa_texformat_rgba_dxt5;
+	}
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldCompressBand(
+	GLD_compressBand *pBand)
+{
+	_mesa_compress_teximage(
+		pBand->ctx,
+		pBand->width,
+		pBand->height,
+		GL_RGBA,
+		pBand->pSrc,
+		pBand->width,	// Source stride in pixels
+		pBand->dstFormat,
+		pBand->pDst,
+		pBand->iPitch);
+}
+
+//---------------------------------------------------------------------------
+
+static DWORD WINAPI _gldCompressWorker(
+	LPVOID lpParam)
+{
+	GLD_compressWorker *pWorker = (GLD_compressWorker*)lpParam;
+
+	while (WaitForSingleObject(pWorker->hWork, INFINITE) == WAIT_OBJECT_0) {
+		if (!pWorker->pBand)
+			break;
+		_gldCompressBand((GLD_compressBand*)pWorker->pBand);
+		SetEvent(pWorker->hDone);
+	}
+	return 0;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldCloseCompressWorker(
+	GLD_compressWorker *pWorker)
+{
+	if (pWorker->hThread)
+		CloseHandle(pWorker->hThread);
+	if (pWorker->hWork)
+		CloseHandle(pWorker->hWork);
+	if (pWorker->hDone)
+		CloseHandle(pWorker->hDone);
+	ZeroMemory(pWorker, sizeof(*pWorker));
+}
+
+//---------------------------------------------------------------------------
+
+void gldInitCompressPool(
+	GLD_driver_dx9 *gld)
+{
+	GLD_compressPool	*pPool = &gld->CompressPool;
+	GLD_compressWorker	*pWorker;
+	SYSTEM_INFO			si;
+	int					nThreads;
+
+	if (pPool->nWorkers)
+		return; // Context is being re-used
+	// Textures are only stored as DXT for bCompressTextures, or for the
+	// generic GL_COMPRESSED_* formats of ARB_texture_compression
+	if (!glb.bCompressTextures && !glb.bGL13Needed)
+		return;
+
+	// One worker per extra CPU; the GL thread encodes a band too
+	GetSystemInfo(&si);
+	nThreads = min((int)si.dwNumberOfProcessors, GLD_MAX_COMPRESS_THREADS);
+	while (pPool->nWorkers < nThreads - 1) {
+		pWorker = &pPool->Workers[pPool->nWorkers];
+		pWorker->hWork	= CreateEvent(NULL, FALSE, FALSE, NULL);
+		pWorker->hDone	= CreateEvent(NULL, FALSE, FALSE, NULL);
+		if (pWorker->hWork && pWorker->hDone)
+			pWorker->hThread = CreateThread(NULL, 0, _gldCompressWorker, pWorker, 0, NULL);
+		if (!pWorker->hThread) {
+			gldLogMessage(GLDLOG_WARN, "DXT: unable to start an encoding thread\n");
+			_gldCloseCompressWorker(pWorker);
+			break;
+		}
+		pPool->nWorkers++;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+void gldReleaseCompressPool(
+	GLD_driver_dx9 *gld)
+{
+	GLD_compressPool	*pPool = &gld->CompressPool;
+	HANDLE				hThreads[GLD_MAX_COMPRESS_THREADS-1];
+	int					i;
+
+	if (!pPool->nWorkers)
+		return;
+
+	// When the process is exiting the workers have already been killed,
+	// and their handles are signalled, so this does not hang.
+	for (i=0; i<pPool->nWorkers; i++) {
+		pPool->Workers[i].pBand = NULL;
+		SetEvent(pPool->Workers[i].hWork);
+		hThreads[i] = pPool->Workers[i].hThread;
+	}
+	WaitForMultipleObjects(pPool->nWorkers, hThreads, TRUE, 1000);
+	for (i=0; i<pPool->nWorkers; i++)
+		_gldCloseCompressWorker(&pPool->Workers[i]);
+	pPool->nWorkers = 0;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldCompressBands(
+	GLD_compressPool *pPool,
+	GLD_compressBand *pImage)
+{
+	GLD_compressBand	Bands[GLD_MAX_COMPRESS_THREADS];
+	HANDLE				hDone[GLD_MAX_COMPRESS_THREADS-1];
+	int					nBlockRows, nBands, nBandRows;
+	int					i;
+
+	nBlockRows = (pImage->height + 3) / 4;
+	nBands = 1;
+	if (pImage->width * pImage->height >= GLD_COMPRESS_MT_TEXELS)
+		nBands = min(pPool->nWorkers + 1, nBlockRows);
+	if (nBands <= 1) {
+		_gldCompressBand(pImage);
+		return;
+	}
+
+	// Bands are whole rows of blocks; only the last one may be ragged,
+	// and rounding up the rows may leave fewer bands than workers
+	nBandRows = (nBlockRows + nBands - 1) / nBands;
+	nBands = (nBlockRows + nBandRows - 1) / nBandRows;
+	for (i=0; i<nBands; i++) {
+		const int y = i * nBandRows * 4;
+		Bands[i]		= *pImage;
+		Bands[i].pSrc	= pImage->pSrc + y * pImage->width * 4;
+		Bands[i].height	= min(nBandRows * 4, pImage->height - y);
+		Bands[i].pDst	= pImage->pDst + i * nBandRows * pImage->iPitch;
+	}
+
+	// Worker i-1 takes band i; the calling thread takes the first itself
+	for (i=1; i<nBands; i++) {
+		pPool->Workers[i-1].pBand = &Bands[i];
+		hDone[i-1] = pPool->Workers[i-1].hDone;
+		SetEvent(pPool->Workers[i-1].hWork);
+	}
+	_gldCompressBand(&Bands[0]);
+	WaitForMultipleObjects(nBands - 1, hDone, TRUE, INFINITE);
+}
+
+//---------------------------------------------------------------------------
+
+BOOL gldCompressTexImage(
+	GLcontext *ctx,
+	struct gl_texture_image *texImage,
+	D3DFORMAT d3dFormat,
+	BYTE *pDst,
+	INT iPitch,
+	GLint width,
+	GLint height,
+	GLenum format,
+	GLenum type,
+	const GLvoid *pixels,
+	const struct gl_pixelstore_attrib *packing)
+{
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_compressBand	Image;
+	GLchan				*pTemp;
+
+	Image.dstFormat = _gldMesaCompressedFormat(d3dFormat);
+	if (!Image.dstFormat)
+		return FALSE;
+
+	// Unpack and apply transfer ops into plain RGBA, then encode
+	pTemp = (GLchan*)MALLOC(width * height * 4 * sizeof(GLchan));
+	if (!pTemp) {
+		_mesa_error(ctx, GL_OUT_OF_MEMORY, "glTexImage2D");
+		return FALSE;
+	}
+	_mesa_transfer_teximage(ctx, 2, texImage->Format,
+		&_mesa_texformat_rgba, // dest format
+		pTemp,
+		width, height, 1, 0, 0, 0,
+		width * 4 * sizeof(GLchan),
+		0, // dstImageStride
+		format, type, pixels, packing);
+
+	Image.ctx		= ctx;
+	Image.pSrc		= pTemp;
+	Image.width		= width;
+	Image.height	= height;
+	Image.pDst		= pDst;
+	Image.iPitch	= iPitch;
+	_gldCompressBands(&gld->CompressPool, &Image);
+
+	FREE(pTemp);
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
@@ -0,0 +1,474 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Texture residency. Keeps the managed textures within the
+*               dwTextureBudget setting by saving the least recently used,
+*               lowest priority ones to disk and reloading them on demand.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+#include <d3dx9tex.h>
+
+//---------------------------------------------------------------------------
+
+#define GLD_RESIDENCY_HASH(tObj)	((((DWORD)(UINT_PTR)(tObj)) >> 4) & (GLD_RESIDENCY_HASH_SIZE-1))
+
+//---------------------------------------------------------------------------
+
+static DWORD _gldTextureBytes(
+	IDirect3DTexture9 *pTex)
+{
+	D3DSURFACE_DESC	d3dsd;
+	DWORD			dwBytes = 0;
+	DWORD			dwBlocks;
+	DWORD			i, nLevels;
+
+	nLevels = IDirect3DTexture9_GetLevelCount(pTex);
+	for (i=0; i<nLevels; i++) {
+		IDirect3DTexture9_GetLevelDesc(pTex, i, &d3dsd);
+		dwBlocks = ((d3dsd.Width + 3) / 4) * ((d3dsd.Height + 3) / 4);
+		switch (d3dsd.Format) {
+		case D3DFMT_DXT1:
+			dwBytes += dwBlocks * 8;
+			break;
+		case D3DFMT_DXT2:
+		case D3DFMT_DXT3:
+		case D3DFMT_DXT4:
+		case D3DFMT_DXT5:
+			dwBytes += dwBlocks * 16;
+			break;
+		case D3DFMT_R8G8B8:
+			dwBytes += d3dsd.Width * d3dsd.Height * 3;
+			break;
+		case D3DFMT_A8R8G8B8:
+		case D3DFMT_X8R8G8B8:
+			dwBytes += d3dsd.Width * d3dsd.Height * 4;
+			break;
+		case D3DFMT_A8:
+		case D3DFMT_L8:
+		case D3DFMT_R3G3B2:
+			dwBytes += d3dsd.Width * d3dsd.Height;
+			break;
+		default:
+			dwBytes += d3dsd.Width * d3dsd.Height * 2;
+			break;
+		}
+	}
+	return dwBytes;
+}
+
+//---------------------------------------------------------------------------
+
+static GLD_residentTexture* _gldFindResident(
+	GLD_textureResidency *pRes,
+	struct gl_texture_object *tObj)
+{
+	GLD_residentTexture *pRT;
+
+	for (pRT = pRes->pHash[GLD_RESIDENCY_HASH(tObj)]; pRT; pRT = pRT->pHashNext) {
+		if (pRT->tObj == tObj)
+			return pRT;
+	}
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldUnlinkResident(
+	GLD_textureResidency *pRes,
+	GLD_residentTexture *pRT)
+{
+	if (pRT->pPrev)
+		pRT->pPrev->pNext = pRT->pNext;
+	else
+		pRes->pMRU = pRT->pNext;
+	if (pRT->pNext)
+		pRT->pNext->pPrev = pRT->pPrev;
+	else
+		pRes->pLRU = pRT->pPrev;
+	pRT->pPrev = pRT->pNext = NULL;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldUseResident(
+	GLD_textureResidency *pRes,
+	GLD_residentTexture *pRT)
+{
+	// Move to the most recently used end and count it in this frame's working set
+	if (pRes->pMRU != pRT) {
+		if (pRT->pPrev || pRT->pNext)
+			_gldUnlinkResident(pRes, pRT);
+		pRT->pNext = pRes->pMRU;
+		if (pRes->pMRU)
+			pRes->pMRU->pPrev = pRT;
+		pRes->pMRU = pRT;
+		if (!pRes->pLRU)
+			pRes->pLRU = pRT;
+	}
+	if (pRT->dwLastFrame != pRes->dwFrame) {
+		pRT->dwLastFrame = pRes->dwFrame;
+		pRes->dwFrameBytes += pRT->dwBytes;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldShadowFileName(
+	GLD_textureResidency *pRes,
+	DWORD dwShadow,
+	char *szFile)
+{
+	sprintf(szFile, "%sgld%08x_%08x.dds", pRes->szShadowPath, GetCurrentProcessId(), dwShadow);
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldIsTextureBound(
+	GLD_driver_dx9 *gld,
+	IDirect3DTexture9 *pTex)
+{
+	// The state filter would skip rebinding a new texture at the same address
+	int i;
+
+	for (i=0; i<GLD_MAX_SAMPLERS; i++) {
+		if (gld->DevState.bTextureValid[i] && (gld->DevState.pTexture[i] == (IDirect3DBaseTexture9*)pTex))
+			return TRUE;
+	}
+	return FALSE;
+}
+
+//---------------------------------------------------------------------------
+
+static GLD_residentTexture* _gldChooseVictim(
+	GLD_driver_dx9 *gld)
+{
+	//
+	// Walk from the least recently used end. Textures used this frame or
+	// still bound are never evicted. A texture is kept for longer the
+	// higher its priority; if everything is within its time, the least
+	// recently used candidate goes anyway.
+	//
+
+	GLD_textureResidency	*pRes		= &gld->Residency;
+	GLD_residentTexture		*pRT;
+	GLD_residentTexture		*pOldest	= NULL;
+	IDirect3DTexture9		*pTex;
+	DWORD					dwAge;
+
+	for (pRT = pRes->pLRU; pRT; pRT = pRT->pPrev) {
+		pTex = (IDirect3DTexture9*)pRT->tObj->DriverData;
+		if (pRT->dwShadow || !pTex)
+			continue;
+		if (pRT->dwLastFrame == pRes->dwFrame)
+			break; // Everything from here on is in use
+		if (_gldIsTextureBound(gld, pTex))
+			continue;
+		dwAge = pRes->dwFrame - pRT->dwLastFrame;
+		if (dwAge >= (DWORD)(pRT->tObj->Priority * GLD_RESIDENCY_PRIORITY_FRAMES))
+			return pRT;
+		if (!pOldest)
+			pOldest = pRT;
+	}
+	return pOldest;
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldEvictTexture(
+	GLD_driver_dx9 *gld,
+	GLD_residentTexture *pRT)
+{
+	GLD_textureResidency	*pRes = &gld->Residency;
+	IDirect3DTexture9		*pTex = (IDirect3DTexture9*)pRT->tObj->DriverData;
+	DWORD					dwStale;
+	DWORD					dwSize = sizeof(dwStale);
+	char					szFile[MAX_PATH];
+	HRESULT					hr;
+
+	if (!pRes->szShadowPath[0])
+		GetTempPath(sizeof(pRes->szShadowPath), pRes->szShadowPath);
+
+	// Pending sub-images have to be in the surface before it is saved
+	gldFlushTexStaging(gld, pTex);
+
+	_gldShadowFileName(pRes, ++pRes->dwNextShadow, szFile);
+	hr = D3DXSaveTextureToFile(szFile, D3DXIFF_DDS, (IDirect3DBaseTexture9*)pTex, NULL);
+	if (FAILED(hr)) {
+		gldLogError(GLDLOG_WARN, "Texture residency: D3DXSaveTextureToFile", hr);
+		pRes->dwFailures++;
+		// Keep it loaded, and out of the way of the next search
+		_gldUseResident(pRes, pRT);
+		return FALSE;
+	}
+
+	pRT->bStaleMips		= SUCCEEDED(IDirect3DTexture9_GetPrivateData(pTex, &GLD_GUID_MipmapsStale, &dwStale, &dwSize));
+	pRT->dwShadow		= pRes->dwNextShadow;
+	pRT->tObj->DriverData = NULL;
+	IDirect3DTexture9_Release(pTex);
+
+	pRes->dwResidentBytes -= pRT->dwBytes;
+	pRes->dwEvictions++;
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldEnforceTextureBudget(
+	GLD_driver_dx9 *gld)
+{
+	GLD_textureResidency	*pRes		= &gld->Residency;
+	DWORD					dwBudget	= glb.dwTextureBudget * 1024 * 1024;
+	GLD_residentTexture		*pRT;
+
+	while (pRes->dwResidentBytes > dwBudget) {
+		pRT = _gldChooseVictim(gld);
+		if (!pRT || !_gldEvictTexture(gld, pRT))
+			break; // Working set is bigger than the budget
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldRestoreTexture(
+	GLD_driver_dx9 *gld,
+	GLD_residentTexture *pRT)
+{
+	GLD_textureResidency	*pRes = &gld->Residency;
+	IDirect3DTexture9		*pTex = NULL;
+	DWORD					dwStale = TRUE;
+	char					szFile[MAX_PATH];
+	HRESULT					hr;
+
+	_gldShadowFileName(pRes, pRT->dwShadow, szFile);
+	hr = D3DXCreateTextureFromFileEx(
+		gld->pDev,
+		szFile,
+		D3DX_FROM_FILE,
+		D3DX_FROM_FILE,
+		D3DX_FROM_FILE,
+		0,					// Usage
+		D3DFMT_FROM_FILE,
+		D3DPOOL_MANAGED,
+		D3DX_FILTER_NONE,
+		D3DX_FILTER_NONE,
+		0,					// Colour key
+		NULL,
+		NULL,
+		&pTex);
+	DeleteFile(szFile);
+	pRT->dwShadow = 0;
+
+	if (FAILED(hr)) {
+		// The texture stays unloaded until the app specifies it again
+		gldLogError(GLDLOG_WARN, "Texture residency: D3DXCreateTextureFromFileEx", hr);
+		pRes->dwFailures++;
+		return;
+	}
+	if (pRT->bStaleMips)
+		IDirect3DTexture9_SetPrivateData(pTex, &GLD_GUID_MipmapsStale, &dwStale, sizeof(dwStale), 0);
+
+	pRT->tObj->DriverData = pTex;
+	pRes->dwResidentBytes += pRT->dwBytes;
+	pRes->dwPeakBytes = max(pRes->dwPeakBytes, pRes->dwResidentBytes);
+	pRes->dwRestores++;
+}
+
+//---------------------------------------------------------------------------
+
+IDirect3DTexture9* gldTouchTexture(
+	GLcontext *ctx,
+	struct gl_texture_object *tObj)
+{
+	//
+	// Called whenever a texture is about to be used or written.
+	// Reloads it if it was evicted.
+	//
+
+	GLD_context				*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9			*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_textureResidency	*pRes	= &gld->Residency;
+	GLD_residentTexture		*pRT;
+
+	if (pRes->dwTextures && ((pRT = _gldFindResident(pRes, tObj)) != NULL)) {
+		_gldUseResident(pRes, pRT);
+		if (pRT->dwShadow) {
+			_gldRestoreTexture(gld, pRT);
+			_gldEnforceTextureBudget(gld);
+		}
+	}
+	return (IDirect3DTexture9*)tObj->DriverData;
+}
+
+//---------------------------------------------------------------------------
+
+void gldTrackTexture(
+	GLcontext *ctx,
+	struct gl_texture_object *tObj)
+{
+	//
+	// Called when a texture's D3D texture has been (re)created.
+	//
+
+	GLD_context				*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9			*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_textureResidency	*pRes	= &gld->Residency;
+	IDirect3DTexture9		*pTex	= (IDirect3DTexture9*)tObj->DriverData;
+	GLD_residentTexture		*pRT;
+	DWORD					dwHash;
+	char					szFile[MAX_PATH];
+
+	if (!glb.dwTextureBudget || !pTex)
+		return;
+
+	pRT = _gldFindResident(pRes, tObj);
+	if (pRT && pRT->dwShadow) {
+		// Specified again while evicted; the saved copy is out of date and
+		// its bytes were already taken off the resident total
+		_gldShadowFileName(pRes, pRT->dwShadow, szFile);
+		DeleteFile(szFile);
+		pRT->dwShadow	= 0;
+		pRT->bStaleMips	= FALSE;
+	} else if (pRT) {
+		// Replaced texture; the old one has already been released
+		pRes->dwResidentBytes -= pRT->dwBytes;
+	} else {
+		pRT = (GLD_residentTexture*)CALLOC(sizeof(GLD_residentTexture));
+		if (!pRT)
+			return;
+		pRT->tObj			= tObj;
+		pRT->dwLastFrame	= pRes->dwFrame - 1;
+		dwHash				= GLD_RESIDENCY_HASH(tObj);
+		pRT->pHashNext		= pRes->pHash[dwHash];
+		pRes->pHash[dwHash]	= pRT;
+		pRes->dwTextures++;
+	}
+	pRT->dwBytes = _gldTextureBytes(pTex);
+	pRes->dwResidentBytes += pRT->dwBytes;
+	pRes->dwPeakBytes = max(pRes->dwPeakBytes, pRes->dwResidentBytes);
+	_gldUseResident(pRes, pRT);
+
+	_gldEnforceTextureBudget(gld);
+}
+
+//---------------------------------------------------------------------------
+
+void gldUntrackTexture(
+	GLD_driver_dx9 *gld,
+	struct gl_texture_object *tObj)
+{
+	GLD_textureResidency	*pRes = &gld->Residency;
+	GLD_residentTexture		**ppRT;
+	GLD_residentTexture		*pRT;
+	char					szFile[MAX_PATH];
+
+	if (!pRes->dwTextures)
+		return;
+
+	for (ppRT = &pRes->pHash[GLD_RESIDENCY_HASH(tObj)]; *ppRT; ppRT = &(*ppRT)->pHashNext) {
+		if ((*ppRT)->tObj == tObj)
+			break;
+	}
+	pRT = *ppRT;
+	if (!pRT)
+		return;
+
+	*ppRT = pRT->pHashNext;
+	_gldUnlinkResident(pRes, pRT);
+	if (pRT->dwShadow) {
+		_gldShadowFileName(pRes, pRT->dwShadow, szFile);
+		DeleteFile(szFile);
+	} else {
+		pRes->dwResidentBytes -= pRT->dwBytes;
+	}
+	pRes->dwTextures--;
+	FREE(pRT);
+}
+
+//---------------------------------------------------------------------------
+
+GLboolean gld_IsTextureResident_DX9(
+	GLcontext *ctx,
+	struct gl_texture_object *tObj)
+{
+	// Managed textures are as resident as Direct3D can make them;
+	// only the ones saved to disk are not.
+	return tObj->DriverData ? GL_TRUE : GL_FALSE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldEndFrameTextureResidency(
+	GLD_driver_dx9 *gld)
+{
+	GLD_textureResidency *pRes = &gld->Residency;
+
+	pRes->dwPeakFrameBytes = max(pRes->dwPeakFrameBytes, pRes->dwFrameBytes);
+	pRes->dwFrameBytes = 0;
+	pRes->dwFrame++;
+}
+
+//---------------------------------------------------------------------------
+
+void gldReleaseTextureResidency(
+	GLD_driver_dx9 *gld)
+{
+	GLD_textureResidency	*pRes = &gld->Residency;
+	GLD_residentTexture		*pRT, *pNext;
+	char					szFile[MAX_PATH];
+
+	if (glb.dwTextureBudget) {
+		gldLogPrintf(GLDLOG_INFO, "Texture residency: %u textures, %u KB resident (peak %u KB), largest frame working set %u KB, budget %u MB",
+			pRes->dwTextures, pRes->dwResidentBytes / 1024, pRes->dwPeakBytes / 1024,
+			pRes->dwPeakFrameBytes / 1024, glb.dwTextureBudget);
+		gldLogPrintf(GLDLOG_INFO, "Texture residency: %u evictions, %u restores, %u failures",
+			pRes->dwEvictions, pRes->dwRestores, pRes->dwFailures);
+	}
+
+	// Resident textures belong to Mesa's texture objects; only the
+	// shadow files and the bookkeeping are ours.
+	for (pRT = pRes->pMRU; pRT; pRT = pNext) {
+		pNext = pRT->pNext;
+		if (pRT->dwShadow) {
+			_gldShadowFileName(pRes, pRT->dwShadow, szFile);
+			DeleteFile(szFile);
+		}
+		FREE(pRT);
+	}
+	memset(pRes->pHash, 0, sizeof(pRes->pHash));
+	pRes->pMRU = pRes->pLRU = NULL;
+	pRes->dwTextures = 0;
+	pRes->dwResidentBytes = 0;
+}
+
+//---------------------------------------------------------------------------
@@ -0,0 +1,303 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Texture sub-image staging. Small glTexSubImage2D updates to
+*               managed textures are converted into system memory and
+*               written to the surface when the texture is next bound.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+#include "texformat.h"
+#include "texstore.h"
+
+//---------------------------------------------------------------------------
+
+static void _gldMergeDirtyRect(
+	RECT *pDirty,
+	int *pnDirty,
+	const RECT *prc)
+{
+	RECT	rc = *prc;
+	int		i = 0;
+
+	// Fold in every rect this one overlaps or touches. A merge can grow
+	// the rect into ones already passed, so start again after each.
+	while (i < *pnDirty) {
+		if ((rc.left <= pDirty[i].right) && (pDirty[i].left <= rc.right) &&
+			(rc.top <= pDirty[i].bottom) && (pDirty[i].top <= rc.bottom))
+		{
+			UnionRect(&rc, &rc, &pDirty[i]);
+			pDirty[i] = pDirty[--(*pnDirty)];
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	if (*pnDirty < GLD_TEXSTAGE_MAX_DIRTY)
+		pDirty[(*pnDirty)++] = rc;
+	else
+		UnionRect(&pDirty[0], &pDirty[0], &rc); // Overlap only costs re-upload
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldFlushStagedLevel(
+	GLD_driver_dx9 *gld,
+	int iFirst)
+{
+	GLD_texStaging		*pStage		= &gld->TexStaging;
+	IDirect3DTexture9	*pTex		= pStage->pImages[iFirst].pTex;
+	UINT				Level		= pStage->pImages[iFirst].Level;
+	GLD_stagedImage		*pImg;
+	IDirect3DSurface9	*pSurface;
+	D3DSURFACE_DESC		d3dsd;
+	D3DLOCKED_RECT		d3dLockedRect;
+	RECT				rcLock		= pStage->pImages[iFirst].rc;
+	RECT				rcDirty[GLD_TEXSTAGE_MAX_DIRTY];
+	RECT				rc;
+	int					nDirty		= 0;
+	BOOL				bLocked		= FALSE;
+	const BYTE			*pSrc;
+	BYTE				*pDst;
+	LONG				y;
+	int					i;
+
+	// One lock covers every pending image for this level
+	for (i=iFirst+1; i<pStage->nImages; i++) {
+		pImg = &pStage->pImages[i];
+		if ((pImg->pTex == pTex) && (pImg->Level == Level))
+			UnionRect(&rcLock, &rcLock, &pImg->rc);
+	}
+
+	if (SUCCEEDED(IDirect3DTexture9_GetSurfaceLevel(pTex, Level, &pSurface))) {
+		// The dirty rects are added below, once they have been merged
+		bLocked = SUCCEEDED(IDirect3DSurface9_LockRect(pSurface, &d3dLockedRect, &rcLock, D3DLOCK_NO_DIRTY_UPDATE));
+		if (!bLocked)
+			IDirect3DSurface9_Release(pSurface);
+	}
+	if (bLocked)
+		pStage->dwLocks++;
+
+	// Write in the order the app made the calls, so later updates win
+	for (i=iFirst; i<pStage->nImages; i++) {
+		pImg = &pStage->pImages[i];
+		if ((pImg->pTex != pTex) || (pImg->Level != Level))
+			continue;
+		if (bLocked) {
+			pSrc = pStage->pData + pImg->dwOffset;
+			pDst = (BYTE*)d3dLockedRect.pBits +
+				(pImg->rc.top - rcLock.top) * d3dLockedRect.Pitch +
+				(pImg->rc.left - rcLock.left) * pImg->dwTexelBytes;
+			for (y=pImg->rc.top; y<pImg->rc.bottom; y++) {
+				memcpy(pDst, pSrc, (pImg->rc.right - pImg->rc.left) * pImg->dwTexelBytes);
+				pSrc += pImg->dwPitch;
+				pDst += d3dLockedRect.Pitch;
+			}
+			_gldMergeDirtyRect(rcDirty, &nDirty, &pImg->rc);
+		}
+		pImg->pTex = NULL; // Written (or lost with the lock)
+	}
+
+	if (!bLocked)
+		return;
+	IDirect3DSurface9_UnlockRect(pSurface);
+	IDirect3DSurface9_Release(pSurface);
+
+	// AddDirtyRect takes top level coordinates
+	IDirect3DTexture9_GetLevelDesc(pTex, 0, &d3dsd);
+	for (i=0; i<nDirty; i++) {
+		rc.left		= rcDirty[i].left << Level;
+		rc.top		= rcDirty[i].top << Level;
+		rc.right	= min(rcDirty[i].right << Level, (LONG)d3dsd.Width);
+		rc.bottom	= min(rcDirty[i].bottom << Level, (LONG)d3dsd.Height);
+		IDirect3DTexture9_AddDirtyRect(pTex, &rc);
+	}
+	pStage->dwDirtyRects += nDirty;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldCompactTexStaging(
+	GLD_texStaging *pStage)
+{
+	int i, n;
+
+	for (i=0, n=0; i<pStage->nImages; i++) {
+		if (pStage->pImages[i].pTex)
+			pStage->pImages[n++] = pStage->pImages[i];
+	}
+	pStage->nImages = n;
+	if (n == 0)
+		pStage->dwUsed = 0; // Texel space is only reclaimed when empty
+}
+
+//---------------------------------------------------------------------------
+
+BOOL gldStageTexSubImage(
+	GLcontext *ctx,
+	struct gl_texture_image *texImage,
+	IDirect3DTexture9 *pTex,
+	GLint level,
+	const D3DSURFACE_DESC *pDesc,
+	const struct gl_texture_format *texFormat,
+	GLint xoffset,
+	GLint yoffset,
+	GLint width,
+	GLint height,
+	GLenum format,
+	GLenum type,
+	const GLvoid *pixels,
+	const struct gl_pixelstore_attrib *packing)
+{
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLD_texStaging		*pStage	= &gld->TexStaging;
+	GLD_stagedImage		*pImg;
+	DWORD				dwPitch, dwSize;
+	BYTE				*pDst;
+
+	// Only managed surfaces have a system copy worth deferring to
+	if ((pDesc->Pool != D3DPOOL_MANAGED) || gldIsCompressedFormat(pDesc->Format) || !texFormat || !pixels)
+		return FALSE;
+	if (width * height * GLD_TEXSTAGE_MAX_FRACTION > (GLint)(pDesc->Width * pDesc->Height)) {
+		pStage->dwDirect++;
+		return FALSE;
+	}
+
+	dwPitch	= (width * texFormat->TexelBytes + 3) & ~3;
+	dwSize	= dwPitch * height;
+	if (dwSize > GLD_TEXSTAGE_MAX_BYTES)
+		return FALSE;
+
+	if (!pStage->pImages) {
+		pStage->pImages	= (GLD_stagedImage*)MALLOC(GLD_TEXSTAGE_MAX_IMAGES * sizeof(GLD_stagedImage));
+		pStage->pData	= (BYTE*)MALLOC(GLD_TEXSTAGE_MAX_BYTES);
+		if (!pStage->pImages || !pStage->pData) {
+			gldReleaseTexStaging(gld);
+			return FALSE;
+		}
+	}
+	if ((pStage->nImages == GLD_TEXSTAGE_MAX_IMAGES) || (pStage->dwUsed + dwSize > GLD_TEXSTAGE_MAX_BYTES))
+		gldFlushTexStaging(gld, NULL);
+
+	// Convert now, while the app's pointer is still valid
+	pDst = pStage->pData + pStage->dwUsed;
+	if (!gldUploadTexImage(ctx, texImage, pDesc->Format, pDst, dwPitch, width, height, format, type, pixels, packing)) {
+		_mesa_transfer_teximage(ctx, 2, texImage->Format,
+			texFormat,
+			pDst,
+			width, height, 1,
+			0, 0, 0,
+			dwPitch,
+			0, // dstImageStride
+			format, type, pixels, packing);
+	}
+
+	pImg = &pStage->pImages[pStage->nImages++];
+	pImg->pTex			= pTex;
+	pImg->Level			= level;
+	SetRect(&pImg->rc, xoffset, yoffset, xoffset + width, yoffset + height);
+	pImg->dwOffset		= pStage->dwUsed;
+	pImg->dwPitch		= dwPitch;
+	pImg->dwTexelBytes	= texFormat->TexelBytes;
+	pStage->dwUsed		+= dwSize;
+	pStage->dwStaged++;
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldFlushTexStaging(
+	GLD_driver_dx9 *gld,
+	IDirect3DTexture9 *pTex)
+{
+	//
+	// Write the pending sub-images of one texture, or of all of them if
+	// pTex is NULL.
+	//
+
+	GLD_texStaging	*pStage = &gld->TexStaging;
+	GLD_stagedImage	*pImg;
+	int				i;
+
+	if (!pStage->nImages)
+		return;
+
+	for (i=0; i<pStage->nImages; i++) {
+		pImg = &pStage->pImages[i];
+		if (pImg->pTex && (!pTex || (pImg->pTex == pTex)))
+			_gldFlushStagedLevel(gld, i);
+	}
+	_gldCompactTexStaging(pStage);
+}
+
+//---------------------------------------------------------------------------
+
+void gldDiscardTexStaging(
+	GLD_driver_dx9 *gld,
+	IDirect3DTexture9 *pTex)
+{
+	GLD_texStaging	*pStage = &gld->TexStaging;
+	int				i;
+
+	if (!pStage->nImages)
+		return;
+
+	for (i=0; i<pStage->nImages; i++) {
+		if (pStage->pImages[i].pTex == pTex)
+			pStage->pImages[i].pTex = NULL;
+	}
+	_gldCompactTexStaging(pStage);
+}
+
+//---------------------------------------------------------------------------
+
+void gldReleaseTexStaging(
+	GLD_driver_dx9 *gld)
+{
+	GLD_texStaging *pStage = &gld->TexStaging;
+
+	if (pStage->pImages) {
+		FREE(pStage->pImages);
+		pStage->pImages = NULL;
+	}
+	if (pStage->pData) {
+		FREE(pStage->pData);
+		pStage->pData = NULL;
+	}
+	pStage->nImages	= 0;
+	pStage->dwUsed	= 0;
+}
+
+//---------------------------------------------------------------------------
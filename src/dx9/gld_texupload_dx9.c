@@ -0,0 +1,275 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Direct texture upload. Copies or swizzles GL images straight
+*               into a locked surface when the app's data already has the
+*               layout of the D3D format, bypassing Mesa's texstore.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_log.h"
+#include "gldirect5.h"
+
+#include "image.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLD_UPLOAD_SSE2
+#include <emmintrin.h>
+#endif
+
+//---------------------------------------------------------------------------
+
+typedef void (*GLD_uploadRow)(BYTE *pDst, const GLubyte *pSrc, GLint nTexels, GLint nBytes);
+
+typedef struct {
+	D3DFORMAT		d3dFormat;
+	GLenum			format;			// App's pixel format...
+	GLenum			type;			// ...and type
+	GLenum			baseFormat;		// Base internal format of the texture image
+	GLD_uploadRow	UploadRow;
+} GLD_uploadPath;
+
+//---------------------------------------------------------------------------
+// Row kernels
+//---------------------------------------------------------------------------
+
+static void _gldUploadCopy(
+	BYTE *pDst,
+	const GLubyte *pSrc,
+	GLint nTexels,
+	GLint nBytes)
+{
+	memcpy(pDst, pSrc, nBytes);
+}
+
+//---------------------------------------------------------------------------
+
+void gldSwapRedBlue32(
+	BYTE *pDst,
+	const GLubyte *pSrc,
+	GLint nTexels,
+	DWORD dwAlpha)
+{
+	//
+	// RGBA <-> BGRA, one way or the other. dwAlpha is ORed into each texel,
+	// so 0xff000000 makes an X8R8G8B8 source read as opaque.
+	//
+
+	GLint	i = 0;
+	DWORD	dw;
+
+#ifdef GLD_UPLOAD_SSE2
+	const __m128i	ag = _mm_set1_epi32(0xff00ff00);
+	const __m128i	rb = _mm_set1_epi32(0x000000ff);
+	const __m128i	a  = _mm_set1_epi32(dwAlpha);
+	__m128i			v;
+
+	for (; i+4 <= nTexels; i+=4) {
+		v = _mm_loadu_si128((const __m128i*)(pSrc + i*4));
+		v = _mm_or_si128(_mm_or_si128(_mm_and_si128(v, ag), a),
+			_mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 16), rb),
+						 _mm_slli_epi32(_mm_and_si128(v, rb), 16)));
+		_mm_storeu_si128((__m128i*)(pDst + i*4), v);
+	}
+#endif
+	for (; i<nTexels; i++) {
+		dw = ((const DWORD*)pSrc)[i];
+		((DWORD*)pDst)[i] = (dw & 0xff00ff00) | ((dw >> 16) & 0xff) | ((dw & 0xff) << 16) | dwAlpha;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldUploadRGBAtoBGRA(
+	BYTE *pDst,
+	const GLubyte *pSrc,
+	GLint nTexels,
+	GLint nBytes)
+{
+	gldSwapRedBlue32(pDst, pSrc, nTexels, 0);
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldUploadRGBtoXRGB(
+	BYTE *pDst,
+	const GLubyte *pSrc,
+	GLint nTexels,
+	GLint nBytes)
+{
+	GLint	i = 0;
+
+#ifdef GLD_UPLOAD_SSE2
+	const __m128i	g  = _mm_set1_epi32(0x0000ff00);
+	const __m128i	rb = _mm_set1_epi32(0x000000ff);
+	const __m128i	a  = _mm_set1_epi32(0xff000000);
+	__m128i			v;
+
+	// Four texels are 12 bytes but each load reads 16,
+	// so stop while there are still two texels spare.
+	for (; i+6 <= nTexels; i+=4) {
+		v = _mm_loadu_si128((const __m128i*)(pSrc + i*3));
+		v = _mm_unpacklo_epi64(
+			_mm_unpacklo_epi32(v, _mm_srli_si128(v, 3)),
+			_mm_unpacklo_epi32(_mm_srli_si128(v, 6), _mm_srli_si128(v, 9)));
+		v = _mm_or_si128(_mm_or_si128(_mm_and_si128(v, g), a),
+			_mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 16), rb),
+						 _mm_slli_epi32(_mm_and_si128(v, rb), 16)));
+		_mm_storeu_si128((__m128i*)(pDst + i*4), v);
+	}
+#endif
+	for (pSrc+=i*3; i<nTexels; i++, pSrc+=3) {
+		((DWORD*)pDst)[i] = 0xff000000 | (pSrc[0] << 16) | (pSrc[1] << 8) | pSrc[2];
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldUploadRGBtoBGR(
+	BYTE *pDst,
+	const GLubyte *pSrc,
+	GLint nTexels,
+	GLint nBytes)
+{
+	GLint	i;
+
+	for (i=0; i<nTexels; i++, pDst+=3, pSrc+=3) {
+		pDst[0] = pSrc[2];
+		pDst[1] = pSrc[1];
+		pDst[2] = pSrc[0];
+	}
+}
+
+//---------------------------------------------------------------------------
+
+// Layouts that need no Mesa conversion. The base format column guards
+// against Mesa's base format remapping: RGB data into an RGBA texture must
+// still get alpha 1, and luminance, intensity and colour index images that
+// land on an RGB format need replicating or a palette lookup. Anything not
+// listed goes through Mesa's texstore.
+static const GLD_uploadPath gldUploadPaths[] = {
+	{ D3DFMT_A8R8G8B8, GL_BGRA,				GL_UNSIGNED_BYTE,				GL_RGBA,			_gldUploadCopy },
+	{ D3DFMT_A8R8G8B8, GL_BGRA,				GL_UNSIGNED_INT_8_8_8_8_REV,	GL_RGBA,			_gldUploadCopy },
+	{ D3DFMT_A8R8G8B8, GL_RGBA,				GL_UNSIGNED_BYTE,				GL_RGBA,			_gldUploadRGBAtoBGRA },
+	{ D3DFMT_A8R8G8B8, GL_RGB,				GL_UNSIGNED_BYTE,				GL_RGBA,			_gldUploadRGBtoXRGB },
+	{ D3DFMT_A8R8G8B8, GL_RGB,				GL_UNSIGNED_BYTE,				GL_RGB,				_gldUploadRGBtoXRGB },
+	{ D3DFMT_X8R8G8B8, GL_BGRA,				GL_UNSIGNED_BYTE,				GL_RGB,				_gldUploadCopy },
+	{ D3DFMT_X8R8G8B8, GL_BGRA,				GL_UNSIGNED_INT_8_8_8_8_REV,	GL_RGB,				_gldUploadCopy },
+	{ D3DFMT_X8R8G8B8, GL_RGBA,				GL_UNSIGNED_BYTE,				GL_RGB,				_gldUploadRGBAtoBGRA },
+	{ D3DFMT_X8R8G8B8, GL_RGB,				GL_UNSIGNED_BYTE,				GL_RGB,				_gldUploadRGBtoXRGB },
+	{ D3DFMT_R8G8B8,   GL_BGR,				GL_UNSIGNED_BYTE,				GL_RGB,				_gldUploadCopy },
+	{ D3DFMT_R8G8B8,   GL_RGB,				GL_UNSIGNED_BYTE,				GL_RGB,				_gldUploadRGBtoBGR },
+	{ D3DFMT_R5G6B5,   GL_RGB,				GL_UNSIGNED_SHORT_5_6_5,		GL_RGB,				_gldUploadCopy },
+	{ D3DFMT_A1R5G5B5, GL_BGRA,				GL_UNSIGNED_SHORT_1_5_5_5_REV,	GL_RGBA,			_gldUploadCopy },
+	{ D3DFMT_X1R5G5B5, GL_BGRA,				GL_UNSIGNED_SHORT_1_5_5_5_REV,	GL_RGB,				_gldUploadCopy },
+	{ D3DFMT_A4R4G4B4, GL_BGRA,				GL_UNSIGNED_SHORT_4_4_4_4_REV,	GL_RGBA,			_gldUploadCopy },
+	{ D3DFMT_X4R4G4B4, GL_BGRA,				GL_UNSIGNED_SHORT_4_4_4_4_REV,	GL_RGB,				_gldUploadCopy },
+	{ D3DFMT_L8,       GL_LUMINANCE,		GL_UNSIGNED_BYTE,				GL_LUMINANCE,		_gldUploadCopy },
+	{ D3DFMT_L8,       GL_LUMINANCE,		GL_UNSIGNED_BYTE,				GL_INTENSITY,		_gldUploadCopy },
+	{ D3DFMT_A8,       GL_ALPHA,			GL_UNSIGNED_BYTE,				GL_ALPHA,			_gldUploadCopy },
+	{ D3DFMT_A8L8,     GL_LUMINANCE_ALPHA,	GL_UNSIGNED_BYTE,				GL_LUMINANCE_ALPHA,	_gldUploadCopy },
+};
+
+#define GLD_UPLOAD_PATHS (sizeof(gldUploadPaths) / sizeof(gldUploadPaths[0]))
+
+//---------------------------------------------------------------------------
+
+static const GLD_uploadPath* _gldFindUploadPath(
+	GLcontext *ctx,
+	struct gl_texture_image *texImage,
+	D3DFORMAT d3dFormat,
+	GLenum format,
+	GLenum type,
+	const struct gl_pixelstore_attrib *packing)
+{
+	const GLD_uploadPath	*pPath;
+	int						i;
+
+	// Pixel transfer ops and byte swapping must go through Mesa
+	if (ctx->_ImageTransferState || packing->SwapBytes)
+		return NULL;
+
+	for (i=0, pPath=gldUploadPaths; i<GLD_UPLOAD_PATHS; i++, pPath++) {
+		if ((pPath->d3dFormat == d3dFormat) &&
+			(pPath->format == format) &&
+			(pPath->type == type) &&
+			(pPath->baseFormat == texImage->Format))
+			return pPath;
+	}
+	return NULL;
+}
+
+//---------------------------------------------------------------------------
+
+BOOL gldUploadTexImage(
+	GLcontext *ctx,
+	struct gl_texture_image *texImage,
+	D3DFORMAT d3dFormat,
+	BYTE *pDst,
+	INT iPitch,
+	GLint width,
+	GLint height,
+	GLenum format,
+	GLenum type,
+	const GLvoid *pixels,
+	const struct gl_pixelstore_attrib *packing)
+{
+	const GLD_uploadPath	*pPath;
+	const GLubyte			*pSrc;
+	GLint					iSrcStride;
+	GLint					nRowBytes;
+	GLint					y;
+
+	if (!pixels)
+		return FALSE;
+	pPath = _gldFindUploadPath(ctx, texImage, d3dFormat, format, type, packing);
+	if (!pPath)
+		return FALSE;
+
+	// Honour the unpack row length, skips and alignment
+	pSrc		= (const GLubyte*)_mesa_image_address(packing, pixels, width, height, format, type, 0, 0, 0);
+	iSrcStride	= _mesa_image_row_stride(packing, width, format, type);
+	nRowBytes	= width * _mesa_bytes_per_pixel(format, type);
+
+	if ((pPath->UploadRow == _gldUploadCopy) && (iSrcStride == nRowBytes) && (iPitch == nRowBytes)) {
+		// Both images are contiguous
+		memcpy(pDst, pSrc, nRowBytes * height);
+		return TRUE;
+	}
+
+	for (y=0; y<height; y++) {
+		pPath->UploadRow(pDst, pSrc, width, nRowBytes);
+		pDst += iPitch;
+		pSrc += iSrcStride;
+	}
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
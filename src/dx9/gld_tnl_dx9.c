@@ -54,10 +54,9 @@
 #include "state.h" // mesa_update_state()
 #include "api_noop.h"
 #include "api_arrayelt.h"
+#include "api_validate.h"
 #include "m_eval.h" // Evaluator functions
 
-GLboolean _mesa_validate_DrawElements(GLcontext *ctx,GLenum mode, GLsizei count, GLenum type, const GLvoid *indices);
-
 extern HGLRC	iCurrentContext;
 extern HWND		g_hwndList; // Handle to error-output listbox in editor window
 
@@ -211,6 +210,166 @@ static void _gldEmitVertex(
 	gld->dwPrimVert++;
 }
 
+//---------------------------------------------------------------------------
+// Vertex formats
+//---------------------------------------------------------------------------
+
+static void _gldSetVertexElement(
+	D3DVERTEXELEMENT9 *pElem,
+	WORD wOffset,
+	BYTE Type,
+	BYTE Usage,
+	BYTE UsageIndex)
+{
+	pElem->Stream		= 0;
+	pElem->Offset		= wOffset;
+	pElem->Type			= Type;
+	pElem->Method		= D3DDECLMETHOD_DEFAULT;
+	pElem->Usage		= Usage;
+	pElem->UsageIndex	= UsageIndex;
+}
+
+//---------------------------------------------------------------------------
+
+BOOL gldCreateVertexFormat(
+	GLD_driver_dx9 *gld,
+	DWORD dwVF)
+{
+	//
+	// Create the vertex declaration for a compact vertex format, if not already created.
+	//
+
+	static const D3DVERTEXELEMENT9	DeclEnd = D3DDECL_END();
+	D3DVERTEXELEMENT9				Decl[6];
+	D3DVERTEXELEMENT9				*pElem = Decl;
+	WORD							wOffset = 0;
+	int								i;
+	HRESULT							hr;
+
+	ASSERT(dwVF < GLD_VF_COUNT);
+
+	if (gld->VF[dwVF].pDecl)
+		return TRUE; // Already created
+
+	_gldSetVertexElement(pElem++, wOffset, D3DDECLTYPE_FLOAT4, D3DDECLUSAGE_POSITION, 0);
+	wOffset += sizeof(D3DXVECTOR4);
+	if (dwVF & GLD_VF_NORMAL) {
+		_gldSetVertexElement(pElem++, wOffset, D3DDECLTYPE_FLOAT3, D3DDECLUSAGE_NORMAL, 0);
+		wOffset += sizeof(D3DXVECTOR3);
+	}
+	_gldSetVertexElement(pElem++, wOffset, D3DDECLTYPE_D3DCOLOR, D3DDECLUSAGE_COLOR, 0);
+	wOffset += sizeof(D3DCOLOR);
+	for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++) {
+		if (dwVF & GLD_VF_TEX2(i)) {
+			_gldSetVertexElement(pElem++, wOffset, D3DDECLTYPE_FLOAT2, D3DDECLUSAGE_TEXCOORD, (BYTE)i);
+			wOffset += sizeof(D3DXVECTOR2);
+		} else if (dwVF & GLD_VF_TEX4(i)) {
+			_gldSetVertexElement(pElem++, wOffset, D3DDECLTYPE_FLOAT4, D3DDECLUSAGE_TEXCOORD, (BYTE)i);
+			wOffset += sizeof(D3DXVECTOR4);
+		}
+	}
+	*pElem = DeclEnd;
+
+	hr = IDirect3DDevice9_CreateVertexDeclaration(gld->pDev, Decl, &gld->VF[dwVF].pDecl);
+	if (FAILED(hr)) {
+		gldLogError(GLDLOG_ERROR, "CreateVertexDeclaration (compact) failed", hr);
+		return FALSE;
+	}
+	gld->VF[dwVF].dwStride = wOffset;
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+void gldReleaseVertexFormats(
+	GLD_driver_dx9 *gld)
+{
+	int i;
+
+	for (i=0; i<GLD_VF_COUNT; i++) {
+		SAFE_RELEASE(gld->VF[i].pDecl);
+		gld->VF[i].dwStride = 0;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldPackVertices(
+	DWORD dwVF,
+	BYTE *pDst,
+	const GLD_4D_VERTEX *pSrc,
+	int nVerts)
+{
+	//
+	// Copy vertices into the Vertex Buffer in a compact vertex format.
+	// The common formats have their own loops; others use the generic path.
+	//
+
+	int		j, i;
+
+	switch (dwVF) {
+	case GLD_VF_FULL:
+		memcpy(pDst, pSrc, GLD_4D_VERTEX_SIZE * nVerts);
+		break;
+	case 0:
+		{
+			GLD_VERTEX_PC *pV = (GLD_VERTEX_PC*)pDst;
+			for (j=0; j<nVerts; j++, pV++, pSrc++) {
+				pV->Position	= pSrc->Position;
+				pV->Diffuse		= pSrc->Diffuse;
+			}
+		}
+		break;
+	case GLD_VF_TEX2(0):
+		{
+			GLD_VERTEX_PCT *pV = (GLD_VERTEX_PCT*)pDst;
+			for (j=0; j<nVerts; j++, pV++, pSrc++) {
+				pV->Position	= pSrc->Position;
+				pV->Diffuse		= pSrc->Diffuse;
+				pV->Tex0.x		= pSrc->Tex0.x;
+				pV->Tex0.y		= pSrc->Tex0.y;
+			}
+		}
+		break;
+	case GLD_VF_TEX2(0) | GLD_VF_TEX2(1):
+		{
+			GLD_VERTEX_PCT2 *pV = (GLD_VERTEX_PCT2*)pDst;
+			for (j=0; j<nVerts; j++, pV++, pSrc++) {
+				pV->Position	= pSrc->Position;
+				pV->Diffuse		= pSrc->Diffuse;
+				pV->Tex0.x		= pSrc->Tex0.x;
+				pV->Tex0.y		= pSrc->Tex0.y;
+				pV->Tex1.x		= pSrc->Tex1.x;
+				pV->Tex1.y		= pSrc->Tex1.y;
+			}
+		}
+		break;
+	default:
+		for (j=0; j<nVerts; j++, pSrc++) {
+			const D3DXVECTOR4 *pTex = &pSrc->Tex0;
+			memcpy(pDst, &pSrc->Position, sizeof(D3DXVECTOR4));
+			pDst += sizeof(D3DXVECTOR4);
+			if (dwVF & GLD_VF_NORMAL) {
+				memcpy(pDst, &pSrc->Normal, sizeof(D3DXVECTOR3));
+				pDst += sizeof(D3DXVECTOR3);
+			}
+			memcpy(pDst, &pSrc->Diffuse, sizeof(D3DCOLOR));
+			pDst += sizeof(D3DCOLOR);
+			for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++, pTex++) {
+				if (dwVF & GLD_VF_TEX2(i)) {
+					memcpy(pDst, pTex, sizeof(D3DXVECTOR2));
+					pDst += sizeof(D3DXVECTOR2);
+				} else if (dwVF & GLD_VF_TEX4(i)) {
+					memcpy(pDst, pTex, sizeof(D3DXVECTOR4));
+					pDst += sizeof(D3DXVECTOR4);
+				}
+			}
+		}
+		break;
+	}
+}
+
 //---------------------------------------------------------------------------
 // Evaluators
 //---------------------------------------------------------------------------
@@ -763,19 +922,294 @@ void GLAPIENTRY d3dVertexAttrib4fvNV(
 // Begin/End
 //---------------------------------------------------------------------------
 
-static void gldSuperPrimitive(
+static void _gldEmitIndices(
+	GLenum mode,
+	WORD wBase,
+	int count,
+	WORD *pDst)
+{
+	//
+	// Emit the indices that turn a GL primitive into a D3D list.
+	// wBase is the VB index of the first vertex of the primitive.
+	// NOTE: Same ordering as the expanded copy in d3dEnd(), so the
+	//       provoking vertex is handled entirely by the index order.
+	//
+
+	int		j;
+	WORD	w;
+	GLuint	parity;
+
+	switch (mode) {
+	case GL_POINTS:
+		for (j=0, w=wBase; j<count; j++)
+			*pDst++ = w++;
+		break;
+	case GL_LINES:
+		// Flatshaded colour: GL=second vertex, D3D=first vertex
+		for (j=0, w=wBase; j<count; j+=2, w+=2, pDst+=2) {
+			pDst[0] = w+1;
+			pDst[1] = w;
+		}
+		break;
+	case GL_LINE_LOOP:
+		for (j=1; j<count; j++, pDst+=2) {
+			pDst[0] = wBase+j;
+			pDst[1] = wBase+j-1;
+		}
+		// Close off the loop with a line from the last to the first vertex
+		pDst[0] = wBase+j-1;
+		pDst[1] = wBase;
+		break;
+	case GL_LINE_STRIP:
+		for (j=1; j<count+1; j++, pDst+=2) {
+			pDst[0] = wBase+j;
+			pDst[1] = wBase+j-1;
+		}
+		break;
+	case GL_TRIANGLES:
+		for (j=0, w=wBase; j<count; j+=3, w+=3, pDst+=3) {
+			pDst[0] = w+2;
+			pDst[1] = w;
+			pDst[2] = w+1;
+		}
+		break;
+	case GL_TRIANGLE_STRIP:
+		parity = 0;
+		for (j=2; j<count; j++, parity^=1, pDst+=3) {
+			pDst[0] = wBase+j;
+			pDst[1] = wBase+j-2+parity;
+			pDst[2] = wBase+j-1-parity;
+		}
+		break;
+	case GL_TRIANGLE_FAN:
+		for (j=2; j<count; j++, pDst+=3) {
+			pDst[0] = wBase+j;
+			pDst[1] = wBase;
+			pDst[2] = wBase+j-1;
+		}
+		break;
+	case GL_QUAD_STRIP:
+		for (j=3; j<count; j+=2, pDst+=6) {
+			pDst[0] = wBase+j;
+			pDst[1] = wBase+j-1;
+			pDst[2] = wBase+j-3;
+			pDst[3] = wBase+j;
+			pDst[4] = wBase+j-3;
+			pDst[5] = wBase+j-2;
+		}
+		break;
+	case GL_QUADS:
+		for (j=0, w=wBase; j<count; j+=4, w+=4, pDst+=6) {
+			pDst[0] = w+3;
+			pDst[1] = w;
+			pDst[2] = w+1;
+			pDst[3] = w+3;
+			pDst[4] = w+1;
+			pDst[5] = w+2;
+		}
+		break;
+	case GL_POLYGON:
+		// Flatshade colour for each triangle comes from 1st vertex
+		for (j=1; j<count+1; j++, pDst+=3) {
+			pDst[0] = wBase;
+			pDst[1] = wBase+j;
+			pDst[2] = wBase+j+1;
+		}
+		break;
+	default:
+		ASSERT(0); // Sanity test...
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldSyncVertexFormat(
 	GLcontext *ctx,
 	GLD_driver_dx9 *gld)
 {
-	// The current primitive is too big to fit into a our vertex buffer in one go.
-	// Split the primitive into manageable multiples.
+	//
+	// Vertex format has changed. Flush vertices of the old format and
+	// carry on from the first whole vertex of the new format.
+	//
+
+	DWORD	dwStride;
+
+	if (gld->dwVF == gld->dwVBVF)
+		return;
+
+	FLUSH_VERTICES(ctx, 0);
+	dwStride			= gld->VF[gld->dwVF].dwStride;
+	gld->dwNextVBVert	= (gld->dwNextVBVert * gld->VF[gld->dwVBVF].dwStride + dwStride - 1) / dwStride;
+	gld->dwFirstVBVert	= gld->dwNextVBVert;
+	gld->dwVBVF			= gld->dwVF;
+
+	// Vertices already in the VB are in the old format
+	gld->ArrayCache.bValid = FALSE;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldEndIndexed(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLenum mode,
+	GLD_4D_VERTEX *pSrc,
+	int nPrimVerts,
+	int nD3DVertices,
+	int count)
+{
+	//
+	// Indexed version of the VB fill in _gldEmitPrimitive().
+	// Each vertex of the primitive is copied once; nD3DVertices indices are emitted.
+	//
+
+	int					nVerts;			// Number of unique vertices used by primitive
+	BYTE				*pVerts;		// Pointer to VB memory
+	WORD				*pIndices;		// Pointer to IB memory
+	DWORD				dwFlags;
+	DWORD				dwOffset, dwSize;	// Size and offset of lock
+	DWORD				dwStride;		// Size of a vertex in the VB
+
+	// Trailing vertices of an incomplete primitive are never referenced
+	nVerts = min(nPrimVerts, nD3DVertices);
+
+	_gldSyncVertexFormat(ctx, gld);
+	dwStride = gld->VF[gld->dwVBVF].dwStride;
+
+	// Determine whether there's enough room in the VB and IB
+	if (((gld->dwNextVBVert + nVerts) >= gld->dwMaxVBVerts) ||
+		((gld->dwNextIBIndex + nD3DVertices) >= gld->dwMaxIBIndices))
+	{
+		// No room - make some!
+		FLUSH_VERTICES(ctx, 0);
+		// Start at the beginning of the buffers again
+		gld->dwFirstVBVert = gld->dwNextVBVert = 0;
+		gld->dwFirstIBIndex = gld->dwNextIBIndex = 0;
+		gld->ArrayCache.bValid = FALSE;
+	}
+
+	// Vertices: one-to-one copy in the compact format
+	if (gld->dwNextVBVert == 0) {
+		dwOffset	= 0;
+		dwSize		= 0;
+		dwFlags		= D3DLOCK_DISCARD;
+	} else {
+		dwOffset	= dwStride * gld->dwNextVBVert;
+		dwSize		= dwStride * nVerts;
+		dwFlags		= D3DLOCK_NOOVERWRITE;
+	}
+	_GLD_DX9_VB(Lock(gld->pVB, dwOffset, dwSize, &pVerts, dwFlags));
+	_gldPackVertices(gld->dwVBVF, pVerts, pSrc, nVerts);
+	_GLD_DX9_VB(Unlock(gld->pVB));
+
+	// Indices: provoking vertex is taken care of by the index order
+	if (gld->dwNextIBIndex == 0) {
+		dwOffset	= 0;
+		dwSize		= 0;
+		dwFlags		= D3DLOCK_DISCARD;
+	} else {
+		dwOffset	= sizeof(WORD) * gld->dwNextIBIndex;
+		dwSize		= sizeof(WORD) * nD3DVertices;
+		dwFlags		= D3DLOCK_NOOVERWRITE;
+	}
+	_GLD_DX9_IB(Lock(gld->pIB, dwOffset, dwSize, &pIndices, dwFlags));
+	_gldEmitIndices(mode, (WORD)gld->dwNextVBVert, count, pIndices);
+	_GLD_DX9_IB(Unlock(gld->pIB));
+
+	// Update counts
+	gld->dwNextVBVert	+= nVerts;
+	gld->dwNextIBIndex	+= nD3DVertices;
+
+	// Notify a need to flush
+	ctx->Driver.NeedFlush |= FLUSH_STORED_VERTICES;
+}
+
+void gldSplitPrimitive(
+	GLcontext *ctx,
+	GLenum mode,
+	GLD_4D_VERTEX *pPrim,
+	int nVerts,
+	int nMaxD3DVerts,
+	GLD_emitPrimitive EmitPrimitive)
+{
+	//
+	// A primitive is too big to fit into a vertex buffer in one go.
+	// Split it into chunks that expand to no more than nMaxD3DVerts vertices
+	// and pass each chunk to EmitPrimitive(), which locks and fills once per chunk.
+	//
+	// Strips overlap by the vertices they share and always advance by an even
+	// number of vertices, so triangle strip parity and quad strip pairing hold.
+	// Fans and polygons keep vertex 0 as the centre of every chunk.
+	// Line loops are sent as line strips followed by the closing line.
+	//
+
+	GLD_4D_VERTEX	vSaved;
+	int				nChunk;		// Maximum input vertices per chunk
+	int				nOverlap;	// Vertices shared by consecutive chunks
+	int				i, n;
+
+	switch (mode) {
+	case GL_POINTS:
+		nChunk		= nMaxD3DVerts;
+		nOverlap	= 0;
+		break;
+	case GL_LINES:
+		nChunk		= nMaxD3DVerts & ~1;
+		nOverlap	= 0;
+		break;
+	case GL_LINE_LOOP:
+	case GL_LINE_STRIP:
+		nChunk		= nMaxD3DVerts / 2 + 1;
+		nOverlap	= 1;
+		break;
+	case GL_TRIANGLES:
+		nChunk		= (nMaxD3DVerts / 3) * 3;
+		nOverlap	= 0;
+		break;
+	case GL_TRIANGLE_STRIP:
+		nChunk		= nMaxD3DVerts / 3 + 2;
+		nChunk		-= (nChunk - 2) & 1;	// Even advance preserves parity
+		nOverlap	= 2;
+		break;
+	case GL_QUAD_STRIP:
+		nChunk		= (nMaxD3DVerts / 3 + 2) & ~1;
+		nOverlap	= 2;
+		break;
+	case GL_QUADS:
+		nChunk		= (nMaxD3DVerts / 6) * 4;
+		nOverlap	= 0;
+		break;
+	case GL_TRIANGLE_FAN:
+	case GL_POLYGON:
+		// Each chunk is centre vertex plus edge vertices.
+		// The centre is temporarily copied in front of the chunk's first edge vertex;
+		// the vertex it displaces has already been sent with the previous chunk.
+		nChunk = nMaxD3DVerts / 3 + 2;
+		for (i=1; i<nVerts-1; i+=n-2) {
+			n			= min(nChunk, nVerts - i + 1);
+			vSaved		= pPrim[i-1];
+			pPrim[i-1]	= pPrim[0];
+			EmitPrimitive(ctx, mode, &pPrim[i-1], n);
+			pPrim[i-1]	= vSaved;
+		}
+		return;
+	default:
+		ASSERT(0);
+		return;
+	}
 
-	// TODO: Actually put some real code in this function...
-	gldLogMessage(GLDLOG_SYSTEM, "~~ imm: gldSuperPrimitive! ~~\n");
+	for (i=0; i<nVerts-nOverlap; i+=n-nOverlap) {
+		n = min(nChunk, nVerts - i);
+		EmitPrimitive(ctx, (mode == GL_LINE_LOOP) ? GL_LINE_STRIP : mode, &pPrim[i], n);
+	}
 
-	// Reset state before returning
-	gldResetPrimitiveBuffer(gld);
-	ctx->Driver.NeedFlush &= ~FLUSH_STORED_VERTICES;
+	if (mode == GL_LINE_LOOP) {
+		// Close off the loop with a line from the last to the first vertex
+		vSaved				= pPrim[nVerts-2];
+		pPrim[nVerts-2]		= pPrim[0];
+		EmitPrimitive(ctx, GL_LINE_STRIP, &pPrim[nVerts-2], 2);
+		pPrim[nVerts-2]		= vSaved;
+	}
 }
 
 //---------------------------------------------------------------------------
@@ -809,11 +1243,18 @@ static void GLAPIENTRY d3dBegin(GLenum mode)
 
 //---------------------------------------------------------------------------
 
-static void GLAPIENTRY d3dEnd(void)
+static void _gldEmitPrimitive(
+	GLcontext *ctx,
+	GLenum mode,
+	GLD_4D_VERTEX *pPrim,
+	int nPrimVerts)
 {
-	GET_CURRENT_CONTEXT(ctx);
-	GLD_context		*gldCtx	= GLD_GET_CONTEXT(ctx);
-	GLD_driver_dx9	*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	//
+	// Copy a GL primitive of nPrimVerts vertices into the VB as a D3D list.
+	//
+
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
 
 	int					nGLPrimitives;	// Number of GL primitives
 	int					nD3DPrimitives;	// Number of Direct3D primitives
@@ -826,76 +1267,67 @@ static void GLAPIENTRY d3dEnd(void)
 	int					j, count;
 	GLuint				parity;
 
-	if (ctx->Driver.CurrentExecPrimitive == PRIM_OUTSIDE_BEGIN_END) {
-		_mesa_error( ctx, GL_INVALID_OPERATION, "glEnd" );
-		goto d3dEnd_bail;
-	}
-
-	if (gld->dwPrimVert == 0) {
-		goto d3dEnd_bail; // Nothing to do...
-	}
-
 	nGLPrimitives = nD3DPrimitives = nD3DVertices = 0;
 
 	// Calculate primitive count
-	switch (ctx->Driver.CurrentExecPrimitive) {
+	switch (mode) {
 	case GL_POINTS:
-		nGLPrimitives	= gld->dwPrimVert;
+		nGLPrimitives	= nPrimVerts;
 		nD3DPrimitives	= nGLPrimitives; // One vertex per point
 		nD3DVertices	= nD3DPrimitives; // One vertex per point
 		count			= nD3DVertices;
 		break;
 	case GL_LINES:
-		nGLPrimitives	= gld->dwPrimVert / 2;
+		nGLPrimitives	= nPrimVerts / 2;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 2; // Two vertices per line
 		count			= nD3DVertices;
 		break;
 	case GL_LINE_LOOP:
-		nGLPrimitives	= gld->dwPrimVert;
+		nGLPrimitives	= nPrimVerts;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 2; // Two vertices per line
 		count			= nD3DPrimitives;
 		break;
 	case GL_LINE_STRIP:
-		nGLPrimitives	= gld->dwPrimVert - 1;
+		nGLPrimitives	= nPrimVerts - 1;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 2; // Two vertices per line
 		count			= nD3DPrimitives;
 		break;
 	case GL_TRIANGLES:
-		nGLPrimitives	= gld->dwPrimVert / 3;
+		nGLPrimitives	= nPrimVerts / 3;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 3; // Three vertices per triangle
 		count			= nD3DVertices;
 		break;
 	case GL_TRIANGLE_STRIP:
-		nGLPrimitives	= gld->dwPrimVert - 2;
+		nGLPrimitives	= nPrimVerts - 2;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 3; // Three vertices per triangle
-		count			= gld->dwPrimVert;
+		count			= nPrimVerts;
 		break;
 	case GL_TRIANGLE_FAN:
-		nGLPrimitives	= gld->dwPrimVert - 2;
+		nGLPrimitives	= nPrimVerts - 2;
 		nD3DPrimitives	= nGLPrimitives;
 		nD3DVertices	= nD3DPrimitives * 3; // Three vertices per triangle
-		count			= gld->dwPrimVert;
+		count			= nPrimVerts;
 		break;
 	case GL_QUAD_STRIP:
-		nGLPrimitives	= (gld->dwPrimVert - 2) / 2;
+		nGLPrimitives	= (nPrimVerts - 2) / 2;
 		nD3DPrimitives	= nGLPrimitives * 2;
 		nD3DVertices	= nD3DPrimitives * 3; // Three vertices per triangle, two tris per quad
-		count			= gld->dwPrimVert;
+		count			= nPrimVerts;
 		break;
 	case GL_QUADS:
-		nGLPrimitives	= gld->dwPrimVert / 4;
+		nGLPrimitives	= nPrimVerts / 4;
 		nD3DPrimitives	= nGLPrimitives * 2;	// Two tris per quad
 		nD3DVertices	= nD3DPrimitives * 3;	// Three vertices per triangle, two tris per quad
-		count			= gld->dwPrimVert;
+		count			= nPrimVerts;
 		break;
 	case GL_POLYGON:
 		nGLPrimitives	= 1;
-		nD3DPrimitives	= gld->dwPrimVert - 2;	// Two tris per quad
+		nD3DPrimitives	= nPrimVerts - 2;	// Two tris per quad
 		nD3DVertices	= nD3DPrimitives * 3;	// Three vertices per triangle
 		count			= nD3DPrimitives;
 		break;
@@ -915,14 +1347,20 @@ static void GLAPIENTRY d3dEnd(void)
 	// Test for invalid primitives
 	if ((nGLPrimitives <= 0) || (nD3DPrimitives <= 0) || (nD3DVertices <= 0)) {
 		// Bail if too few vertices
-		goto d3dEnd_bail;
+		return;
 	}
 
 	// Detect Super Primitives
 	if (nD3DVertices > gld->dwMaxVBVerts) {
-		// Huge primitive - pass off work to another function
-		gldSuperPrimitive(ctx, gld);
-		goto d3dEnd_bail;
+		// Huge primitive - split it into chunks that fit
+		gldSplitPrimitive(ctx, mode, pPrim, nPrimVerts, gld->dwMaxVBVerts, _gldEmitPrimitive);
+		return;
+	}
+
+	// Indexed primitives write each vertex once
+	if (gld->bIndexedPrims) {
+		_gldEndIndexed(ctx, gld, mode, pPrim, nPrimVerts, nD3DVertices, count);
+		return;
 	}
 
 	// Determine whether there's enough room in the VB for the new vertices
@@ -931,10 +1369,11 @@ static void GLAPIENTRY d3dEnd(void)
 		FLUSH_VERTICES(ctx, 0);
 		// Start at the beginning of the buffer again
 		gld->dwFirstVBVert = gld->dwNextVBVert = 0;
+		gld->ArrayCache.bValid = FALSE;
 	}
 
 	// Pointer to first vertex in primitive
-	pSrc = gld->pPrim;
+	pSrc = pPrim;
 
 	// Decide on the flags for the Lock
 	if (gld->dwNextVBVert == 0) {
@@ -957,7 +1396,7 @@ static void GLAPIENTRY d3dEnd(void)
 
 	// Put vertices into VB
 	// NOTE: Keep Provoking Vertex in mind! D3D takes flatshaded colour from 1st vertex in primitive
-	switch (ctx->Driver.CurrentExecPrimitive) {
+	switch (mode) {
 	case GL_POINTS:
 		// Straight one-to-one copy
 		memcpy(pDst, pSrc, GLD_4D_VERTEX_SIZE * nD3DVertices);
@@ -1050,64 +1489,823 @@ static void GLAPIENTRY d3dEnd(void)
 	_GLD_DX9_VB(Unlock(gld->pVB));
 
 	// Update count of vertices in VB
-	gld->dwNextVBVert += nD3DVertices;
+	gld->dwNextVBVert	+= nD3DVertices;
 
 	// Notify a need to flush
 	ctx->Driver.NeedFlush |= FLUSH_STORED_VERTICES;
+}
+
+//---------------------------------------------------------------------------
+
+static void GLAPIENTRY d3dEnd(void)
+{
+	GET_CURRENT_CONTEXT(ctx);
+	GLD_context		*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9	*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+
+	GLD_PROFILE_BEGIN(GLD_PROFILE_D3D_END);
+
+	if (ctx->Driver.CurrentExecPrimitive == PRIM_OUTSIDE_BEGIN_END) {
+		_mesa_error( ctx, GL_INVALID_OPERATION, "glEnd" );
+		goto d3dEnd_bail;
+	}
+
+	if (gld->dwPrimVert == 0) {
+		goto d3dEnd_bail; // Nothing to do...
+	}
+
+	_gldEmitPrimitive(ctx, ctx->Driver.CurrentExecPrimitive, gld->pPrim, gld->dwPrimVert);
 
 d3dEnd_bail:
 	// Prepare for next primitive
 	gld->dwPrimVert	= 0;
 	ctx->Driver.CurrentExecPrimitive = PRIM_OUTSIDE_BEGIN_END;
+
+	GLD_PROFILE_END(GLD_PROFILE_D3D_END);
 }
 
 //---------------------------------------------------------------------------
-// Driver callbacks
+// Vertex arrays
 //---------------------------------------------------------------------------
 
-static void d3dFlushVertices(
-	GLcontext *ctx,
-	GLuint flags)
-{
-	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
-	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+// Generic attribute arrays are only used by vertex programs; leave them to Mesa.
+#define GLD_ARRAY_UNSUPPORTED	(~(_NEW_ARRAY_ATTRIB_0 - 1))
 
-	D3DPRIMITIVETYPE	d3dpt;
-	DWORD				nVertices, nPrimitives;
+#define _GLD_VERTEX_FLOATS		(GLD_4D_VERTEX_SIZE / sizeof(GLfloat))
+#define _GLD_TO_FLOAT(x)		((GLfloat)(x))
 
-	if (flags & FLUSH_UPDATE_CURRENT) {
+// Convert n elements of TYPE into floats, one GLD_4D_VERTEX apart
+#define _GLD_CONVERT_ARRAY(TYPE, CONV)										\
+	for (j=0; j<n; j++, pSrc+=nStride, pDst+=_GLD_VERTEX_FLOATS) {			\
+		const TYPE *s = (const TYPE*)pSrc;									\
+		for (i=0; i<nSize; i++)												\
+			pDst[i] = CONV(s[i]);											\
 	}
 
-	if (!(flags & FLUSH_STORED_VERTICES))
-		return; // Not being asked to flush vertices
+//---------------------------------------------------------------------------
 
-	// Determine number of vertices in current batch
-	nVertices = gld->dwNextVBVert - gld->dwFirstVBVert;
+static const GLubyte *_gldArrayData(
+	const struct gl_client_array *pArray,
+	GLuint start)
+{
+	// Ptr is an offset when a vertex buffer object is bound
+	return ADD_POINTERS(pArray->BufferObj->Data, pArray->Ptr) + start * pArray->StrideB;
+}
 
-	// Bail if nothing to do
-	if (nVertices <= 0) {
-		goto bail;
-	}
+//---------------------------------------------------------------------------
 
-	// Determine number of primitives to draw
+static void _gldConvertArray(
+	const struct gl_client_array *pArray,
+	GLuint start,
+	GLuint n,
+	GLfloat *pDst,
+	GLboolean bNormalize)
+{
+	//
+	// Convert n elements of a client array into GLD_4D_VERTEX floats.
+	// Only the first Size components of each vertex are written.
+	// The type is switched on once; each format has its own loop.
+	//
+
+	const GLubyte	*pSrc	= _gldArrayData(pArray, start);
+	GLsizei			nStride	= pArray->StrideB;
+	GLint			nSize	= pArray->Size;
+	GLuint			j;
+	GLint			i;
+
+	switch (pArray->Type) {
+	case GL_FLOAT:
+		_GLD_CONVERT_ARRAY(GLfloat, _GLD_TO_FLOAT);
+		break;
+	case GL_DOUBLE:
+		_GLD_CONVERT_ARRAY(GLdouble, _GLD_TO_FLOAT);
+		break;
+	case GL_BYTE:
+		if (bNormalize) {
+			_GLD_CONVERT_ARRAY(GLbyte, BYTE_TO_FLOAT);
+		} else {
+			_GLD_CONVERT_ARRAY(GLbyte, _GLD_TO_FLOAT);
+		}
+		break;
+	case GL_UNSIGNED_BYTE:
+		if (bNormalize) {
+			_GLD_CONVERT_ARRAY(GLubyte, UBYTE_TO_FLOAT);
+		} else {
+			_GLD_CONVERT_ARRAY(GLubyte, _GLD_TO_FLOAT);
+		}
+		break;
+	case GL_SHORT:
+		if (bNormalize) {
+			_GLD_CONVERT_ARRAY(GLshort, SHORT_TO_FLOAT);
+		} else {
+			_GLD_CONVERT_ARRAY(GLshort, _GLD_TO_FLOAT);
+		}
+		break;
+	case GL_UNSIGNED_SHORT:
+		if (bNormalize) {
+			_GLD_CONVERT_ARRAY(GLushort, USHORT_TO_FLOAT);
+		} else {
+			_GLD_CONVERT_ARRAY(GLushort, _GLD_TO_FLOAT);
+		}
+		break;
+	case GL_INT:
+		if (bNormalize) {
+			_GLD_CONVERT_ARRAY(GLint, INT_TO_FLOAT);
+		} else {
+			_GLD_CONVERT_ARRAY(GLint, _GLD_TO_FLOAT);
+		}
+		break;
+	case GL_UNSIGNED_INT:
+		if (bNormalize) {
+			_GLD_CONVERT_ARRAY(GLuint, UINT_TO_FLOAT);
+		} else {
+			_GLD_CONVERT_ARRAY(GLuint, _GLD_TO_FLOAT);
+		}
+		break;
+	default:
+		ASSERT(0); // Array type was validated by Mesa
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldArrayDefaults(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLD_4D_VERTEX *pV)
+{
+	//
+	// Build the vertex that every converted element starts from.
+	// Disabled arrays take the current attribute, as glArrayElement() would.
+	// Enabled arrays take GL's defaults for the components they don't supply.
+	//
+
+	const struct gl_array_attrib	*pArrays = &ctx->Array;
+	const GLfloat					*f;
+	D3DXVECTOR4						*pTex;
+	int								i;
+
+	memset(pV, 0, sizeof(GLD_4D_VERTEX));
+
+	pV->Position.w = 1.0f;
+
+	if (!pArrays->Normal.Enabled) {
+		f = ctx->Current.Attrib[VERT_ATTRIB_NORMAL];
+		pV->Normal.x	= f[0];
+		pV->Normal.y	= f[1];
+		pV->Normal.z	= f[2];
+	}
+
+	if (!pArrays->Color.Enabled)
+		pV->Diffuse = gldClampedColour(ctx->Current.Attrib[VERT_ATTRIB_COLOR0]);
+
+	for (i=0, pTex=&pV->Tex0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++, pTex++) {
+		if (pArrays->TexCoord[i].Enabled) {
+			pTex->w = 1.0f;
+		} else {
+			f = ctx->Current.Attrib[VERT_ATTRIB_TEX0 + i];
+			pTex->x = f[0];
+			pTex->y = f[1];
+			pTex->z = f[2];
+			pTex->w = f[3];
+		}
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldConvertArrays(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	const GLD_4D_VERTEX *pDefaults,
+	GLD_4D_VERTEX *pDst,
+	GLuint start,
+	GLuint n)
+{
+	//
+	// Convert array elements [start, start+n) into GLD_4D_VERTEX, one array at a time.
+	//
+
+	const struct gl_array_attrib	*pArrays	= &ctx->Array;
+	const struct gl_client_array	*pColor		= &pArrays->Color;
+	const GLubyte					*pSrc;
+	GLfloat							c[4];
+	GLuint							j;
+	int								i;
+
+	for (j=0; j<n; j++)
+		pDst[j] = *pDefaults;
+
+	_gldConvertArray(&pArrays->Vertex, start, n, &pDst->Position.x, GL_FALSE);
+	if (gld->fViewportY != 0.0f) {
+		for (j=0; j<n; j++)
+			pDst[j].Position.y -= gld->fViewportY;
+	}
+
+	if (pArrays->Normal.Enabled)
+		_gldConvertArray(&pArrays->Normal, start, n, &pDst->Normal.x, GL_TRUE);
+
+	if (pColor->Enabled) {
+		if ((pColor->Type == GL_UNSIGNED_BYTE) && (pColor->Size == 4)) {
+			// Common case: bytes go straight into the D3DCOLOR
+			pSrc = _gldArrayData(pColor, start);
+			for (j=0; j<n; j++, pSrc+=pColor->StrideB)
+				pDst[j].Diffuse = D3DCOLOR_RGBA(pSrc[0], pSrc[1], pSrc[2], pSrc[3]);
+		} else {
+			for (j=0; j<n; j++) {
+				c[3] = 1.0f;
+				_gldConvertArray(pColor, start + j, 1, c, GL_TRUE);
+				pDst[j].Diffuse = gldClampedColour(c);
+			}
+		}
+	}
+
+	for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++) {
+		if (pArrays->TexCoord[i].Enabled)
+			_gldConvertArray(&pArrays->TexCoord[i], start, n, i ? &pDst->Tex1.x : &pDst->Tex0.x, GL_FALSE);
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldArrayKey(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	const GLD_4D_VERTEX *pDefaults,
+	GLuint first,
+	GLuint count,
+	GLD_arrayKey *pKey)
+{
+	//
+	// Describe a range of elements so a converted copy can be recognised later.
+	// Zeroed first so keys can be compared with memcmp().
+	//
+
+	const struct gl_client_array	*pArray[GLD_ARRAY_SOURCES];
+	GLD_arraySource					*pSrc;
+	int								i;
+
+	pArray[0] = &ctx->Array.Vertex;
+	pArray[1] = &ctx->Array.Normal;
+	pArray[2] = &ctx->Array.Color;
+	for (i=0; i<GLD_MAX_TEXTURE_UNITS_DX9; i++)
+		pArray[3 + i] = &ctx->Array.TexCoord[i];
+
+	memset(pKey, 0, sizeof(GLD_arrayKey));
+	pKey->First			= first;
+	pKey->Count			= count;
+	pKey->fViewportY	= gld->fViewportY;
+	pKey->vDefaults		= *pDefaults;
+	for (i=0, pSrc=pKey->Src; i<GLD_ARRAY_SOURCES; i++, pSrc++) {
+		if (!pArray[i]->Enabled)
+			continue;
+		pSrc->pData		= _gldArrayData(pArray[i], 0);
+		pSrc->Type		= pArray[i]->Type;
+		pSrc->Size		= pArray[i]->Size;
+		pSrc->StrideB	= pArray[i]->StrideB;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static __inline GLuint _gldArrayElement(
+	GLenum type,
+	const GLvoid *indices,
+	int i)
+{
+	switch (type) {
+	case GL_UNSIGNED_BYTE:
+		return ((const GLubyte*)indices)[i];
+	case GL_UNSIGNED_SHORT:
+		return ((const GLushort*)indices)[i];
+	default:
+		return ((const GLuint*)indices)[i];
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldArrayElementRange(
+	GLenum type,
+	const GLvoid *indices,
+	GLsizei count,
+	GLuint *pMin,
+	GLuint *pMax)
+{
+	//
+	// Find the range of elements referenced by glDrawElements().
+	//
+
+	GLuint	lo = ~0u, hi = 0;
+	GLsizei	i;
+
+#define _GLD_SCAN_INDICES(TYPE)							\
+	for (i=0; i<count; i++) {							\
+		GLuint e = ((const TYPE*)indices)[i];			\
+		if (e < lo) lo = e;								\
+		if (e > hi) hi = e;								\
+	}
+
+	switch (type) {
+	case GL_UNSIGNED_BYTE:
+		_GLD_SCAN_INDICES(GLubyte);
+		break;
+	case GL_UNSIGNED_SHORT:
+		_GLD_SCAN_INDICES(GLushort);
+		break;
+	default:
+		_GLD_SCAN_INDICES(GLuint);
+		break;
+	}
+
+#undef _GLD_SCAN_INDICES
+
+	*pMin = lo;
+	*pMax = hi;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldArrayConvertRange(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLuint lo,
+	GLuint hi,
+	GLuint *pFirst,
+	GLuint *pCount)
+{
+	//
+	// Elements lo..hi are referenced. While the arrays are locked
+	// (GL_EXT_compiled_vertex_array) convert the whole locked range instead,
+	// so the following draws from the same arrays can reuse it.
+	//
+
+	const struct gl_array_attrib *pArrays = &ctx->Array;
+
+	if (pArrays->LockCount &&
+		(pArrays->LockCount < gld->dwMaxVBVerts) &&
+		(lo >= pArrays->LockFirst) &&
+		(hi < pArrays->LockFirst + pArrays->LockCount))
+	{
+		*pFirst	= pArrays->LockFirst;
+		*pCount	= pArrays->LockCount;
+	} else {
+		*pFirst	= lo;
+		*pCount	= hi - lo + 1;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static int _gldListVertexCount(
+	GLenum mode,
+	int nPrimVerts,
+	int *pCount)
+{
+	//
+	// Number of D3D list vertices a GL primitive expands to, as in _gldEmitPrimitive().
+	// *pCount receives the count that _gldEmitIndices() expects for the mode.
+	//
+
+	int nD3DVertices;
+
+	switch (mode) {
+	case GL_POINTS:
+		nD3DVertices	= nPrimVerts;
+		*pCount			= nD3DVertices;
+		break;
+	case GL_LINES:
+		nD3DVertices	= (nPrimVerts / 2) * 2;
+		*pCount			= nD3DVertices;
+		break;
+	case GL_LINE_LOOP:
+		nD3DVertices	= nPrimVerts * 2;
+		*pCount			= nPrimVerts;
+		break;
+	case GL_LINE_STRIP:
+		nD3DVertices	= (nPrimVerts - 1) * 2;
+		*pCount			= nPrimVerts - 1;
+		break;
+	case GL_TRIANGLES:
+		nD3DVertices	= (nPrimVerts / 3) * 3;
+		*pCount			= nD3DVertices;
+		break;
+	case GL_TRIANGLE_STRIP:
+	case GL_TRIANGLE_FAN:
+		nD3DVertices	= (nPrimVerts - 2) * 3;
+		*pCount			= nPrimVerts;
+		break;
+	case GL_QUAD_STRIP:
+		nD3DVertices	= ((nPrimVerts - 2) / 2) * 6;
+		*pCount			= nPrimVerts;
+		break;
+	case GL_QUADS:
+		nD3DVertices	= (nPrimVerts / 4) * 6;
+		*pCount			= nPrimVerts;
+		break;
+	case GL_POLYGON:
+		nD3DVertices	= (nPrimVerts - 2) * 3;
+		*pCount			= nPrimVerts - 2;
+		break;
+	default:
+		ASSERT(0);
+		return 0;
+	}
+
+	return nD3DVertices;
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldArraysSupported(
+	GLcontext *ctx)
+{
+	// Vertex programs read generic attributes that GLD_4D_VERTEX can't hold
+	if (ctx->VertexProgram.Enabled)
+		return FALSE;
+	if (ctx->Array._Enabled & GLD_ARRAY_UNSUPPORTED)
+		return FALSE;
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldArrayBegin(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLenum mode)
+{
+	//
+	// Same reduced primitive handling as d3dBegin().
+	// Mesa state has already been updated by the validate functions.
+	//
+
+	GLenum GLReducedPrim = gldReducedPrim(mode);
+
+	if (GLReducedPrim != gld->GLReducedPrim) {
+		FLUSH_VERTICES(ctx, 0);
+		gld->GLReducedPrim = GLReducedPrim;
+	}
+}
+
+//---------------------------------------------------------------------------
+
+static BOOL _gldDrawArrayIndexed(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLenum mode,
+	GLuint first,
+	GLuint nVerts,
+	GLuint start,
+	GLsizei count,
+	GLenum type,
+	const GLvoid *indices)
+{
+	//
+	// Draw count array elements as one indexed batch.
+	// Elements [first, first+nVerts) are converted and written to the VB once;
+	// the GL indices (or a run from start if indices is NULL) are rebased into the IB.
+	// Returns FALSE if the draw doesn't fit in the dynamic buffers.
+	//
+
+	GLD_4D_VERTEX		vDefaults;
+	GLD_arrayKey		Key;
+	BOOL				bLocked;		// Range is the locked range
+	BOOL				bCached;		// Locked range is already in the VB
+	int					nD3DVertices;	// Indices emitted
+	int					nEmit;			// Count passed to _gldEmitIndices()
+	DWORD				dwVBVert;		// VB index of element 'first'
+	BYTE				*pVerts;		// Pointer to VB memory
+	WORD				*pIndices;		// Pointer to IB memory
+	DWORD				dwFlags;
+	DWORD				dwOffset, dwSize;	// Size and offset of lock
+	DWORD				dwStride;		// Size of a vertex in the VB
+	int					iBias;
+	int					k;
+
+	nD3DVertices = _gldListVertexCount(mode, count, &nEmit);
+	if (nD3DVertices <= 0)
+		return TRUE; // Too few vertices; nothing to draw
+
+	if (!gld->bIndexedPrims ||
+		(count > 65536) ||
+		(nVerts >= gld->dwMaxVBVerts) ||
+		((DWORD)nD3DVertices >= gld->dwMaxIBIndices))
+		return FALSE;
+
+	_gldSyncVertexFormat(ctx, gld);
+	dwStride = gld->VF[gld->dwVBVF].dwStride;
+
+	_gldArrayDefaults(ctx, gld, &vDefaults);
+
+	// Compiled vertex arrays: reuse the locked range if nothing it depends on has changed
+	bLocked = ctx->Array.LockCount && (first == ctx->Array.LockFirst) && (nVerts == ctx->Array.LockCount);
+	bCached = FALSE;
+	if (bLocked) {
+		_gldArrayKey(ctx, gld, &vDefaults, first, nVerts, &Key);
+		bCached = gld->ArrayCache.bValid && !memcmp(&Key, &gld->ArrayCache.Key, sizeof(Key));
+	}
+
+	// Determine whether there's enough room in the VB and IB
+	if (((gld->dwNextVBVert + (bCached ? 0 : nVerts)) >= gld->dwMaxVBVerts) ||
+		((gld->dwNextIBIndex + nD3DVertices) >= gld->dwMaxIBIndices))
+	{
+		// No room - make some!
+		FLUSH_VERTICES(ctx, 0);
+		// Start at the beginning of the buffers again
+		gld->dwFirstVBVert = gld->dwNextVBVert = 0;
+		gld->dwFirstIBIndex = gld->dwNextIBIndex = 0;
+		gld->ArrayCache.bValid = FALSE;
+		bCached = FALSE;
+	}
+
+	if (bCached) {
+		dwVBVert = gld->ArrayCache.dwVBVert;
+		// The batch must span the cached vertices for DrawIndexedPrimitive's vertex range
+		if (dwVBVert < gld->dwFirstVBVert)
+			gld->dwFirstVBVert = dwVBVert;
+		gld->dwArrayCached++;
+	} else {
+		// Convert into the staging buffer
+		if (nVerts > gld->dwMaxArrayVerts) {
+			gld->dwMaxArrayVerts = nVerts;
+			gld->pArrayVerts = realloc(gld->pArrayVerts, GLD_4D_VERTEX_SIZE * gld->dwMaxArrayVerts);
+			ASSERT(gld->pArrayVerts);
+		}
+		_gldConvertArrays(ctx, gld, &vDefaults, gld->pArrayVerts, first, nVerts);
+
+		// Vertices: one-to-one copy in the compact format
+		if (gld->dwNextVBVert == 0) {
+			dwOffset	= 0;
+			dwSize		= 0;
+			dwFlags		= D3DLOCK_DISCARD;
+		} else {
+			dwOffset	= dwStride * gld->dwNextVBVert;
+			dwSize		= dwStride * nVerts;
+			dwFlags		= D3DLOCK_NOOVERWRITE;
+		}
+		_GLD_DX9_VB(Lock(gld->pVB, dwOffset, dwSize, &pVerts, dwFlags));
+		_gldPackVertices(gld->dwVBVF, pVerts, gld->pArrayVerts, nVerts);
+		_GLD_DX9_VB(Unlock(gld->pVB));
+
+		dwVBVert			= gld->dwNextVBVert;
+		gld->dwNextVBVert	+= nVerts;
+
+		if (bLocked) {
+			gld->ArrayCache.bValid		= TRUE;
+			gld->ArrayCache.dwVBVert	= dwVBVert;
+			gld->ArrayCache.Key			= Key;
+		}
+	}
+
+	// Indices: provoking vertex is taken care of by the index order
+	if (gld->dwNextIBIndex == 0) {
+		dwOffset	= 0;
+		dwSize		= 0;
+		dwFlags		= D3DLOCK_DISCARD;
+	} else {
+		dwOffset	= sizeof(WORD) * gld->dwNextIBIndex;
+		dwSize		= sizeof(WORD) * nD3DVertices;
+		dwFlags		= D3DLOCK_NOOVERWRITE;
+	}
+	_GLD_DX9_IB(Lock(gld->pIB, dwOffset, dwSize, &pIndices, dwFlags));
+	if (indices == NULL) {
+		_gldEmitIndices(mode, (WORD)(dwVBVert + start - first), nEmit, pIndices);
+	} else {
+		// Emit positions within the element list, then replace each with its VB index
+		_gldEmitIndices(mode, 0, nEmit, pIndices);
+		iBias = (int)dwVBVert - (int)first;
+		switch (type) {
+		case GL_UNSIGNED_BYTE:
+			for (k=0; k<nD3DVertices; k++)
+				pIndices[k] = (WORD)(((const GLubyte*)indices)[pIndices[k]] + iBias);
+			break;
+		case GL_UNSIGNED_SHORT:
+			for (k=0; k<nD3DVertices; k++)
+				pIndices[k] = (WORD)(((const GLushort*)indices)[pIndices[k]] + iBias);
+			break;
+		default:
+			for (k=0; k<nD3DVertices; k++)
+				pIndices[k] = (WORD)(((const GLuint*)indices)[pIndices[k]] + iBias);
+			break;
+		}
+	}
+	_GLD_DX9_IB(Unlock(gld->pIB));
+
+	// Update counts
+	gld->dwNextIBIndex	+= nD3DVertices;
+
+	// Notify a need to flush
+	ctx->Driver.NeedFlush |= FLUSH_STORED_VERTICES;
+
+	return TRUE;
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldDrawArrayGather(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLenum mode,
+	GLuint start,
+	GLsizei count,
+	GLenum type,
+	const GLvoid *indices)
+{
+	//
+	// Convert the elements in draw order into the primitive buffer and let
+	// _gldEmitPrimitive() expand or split them like a glBegin/glEnd primitive.
+	// Used when indexed primitives are off or the draw is too big for one batch.
+	//
+
+	GLD_4D_VERTEX	vDefaults;
+	GLsizei			k;
+
+	if ((DWORD)count > gld->dwMaxPrimVerts) {
+		gld->dwMaxPrimVerts = count;
+		gld->pPrim = realloc(gld->pPrim, GLD_4D_VERTEX_SIZE * gld->dwMaxPrimVerts);
+		ASSERT(gld->pPrim);
+	}
+
+	_gldArrayDefaults(ctx, gld, &vDefaults);
+	if (indices == NULL) {
+		_gldConvertArrays(ctx, gld, &vDefaults, gld->pPrim, start, count);
+	} else {
+		for (k=0; k<count; k++)
+			_gldConvertArrays(ctx, gld, &vDefaults, &gld->pPrim[k], _gldArrayElement(type, indices, k), 1);
+	}
+
+	_gldEmitPrimitive(ctx, mode, gld->pPrim, count);
+}
+
+//---------------------------------------------------------------------------
+
+static void _gldDrawArrayElements(
+	GLcontext *ctx,
+	GLD_driver_dx9 *gld,
+	GLenum mode,
+	GLuint lo,
+	GLuint hi,
+	GLsizei count,
+	GLenum type,
+	const GLvoid *indices)
+{
+	GLuint	first, nVerts;
+
+	// Indices may live in an element array buffer object
+	indices = ADD_POINTERS(ctx->Array.ElementArrayBufferObj->Data, (const GLubyte*)indices);
+
+	// No usable range given; find it
+	if ((hi < lo) || (hi - lo >= gld->dwMaxVBVerts))
+		_gldArrayElementRange(type, indices, count, &lo, &hi);
+
+	_gldArrayBegin(ctx, gld, mode);
+	_gldArrayConvertRange(ctx, gld, lo, hi, &first, &nVerts);
+	if (!_gldDrawArrayIndexed(ctx, gld, mode, first, nVerts, 0, count, type, indices))
+		_gldDrawArrayGather(ctx, gld, mode, 0, count, type, indices);
+
+	gld->dwArrayDraws++;
+}
+
+//---------------------------------------------------------------------------
+
+static void GLAPIENTRY d3dDrawArrays(
+	GLenum mode,
+	GLint start,
+	GLsizei count)
+{
+	GET_CURRENT_CONTEXT(ctx);
+	GLD_context		*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9	*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+	GLuint			first, nVerts;
+
+	if (!_gldArraysSupported(ctx)) {
+		gld->dwArrayFallbacks++;
+		_mesa_noop_DrawArrays(mode, start, count);
+		return;
+	}
+
+	if (!_mesa_validate_DrawArrays(ctx, mode, start, count))
+		return;
+
+	_gldArrayBegin(ctx, gld, mode);
+	_gldArrayConvertRange(ctx, gld, start, start + count - 1, &first, &nVerts);
+	if (!_gldDrawArrayIndexed(ctx, gld, mode, first, nVerts, start, count, 0, NULL))
+		_gldDrawArrayGather(ctx, gld, mode, start, count, 0, NULL);
+
+	gld->dwArrayDraws++;
+}
+
+//---------------------------------------------------------------------------
+
+static void GLAPIENTRY d3dDrawElements(
+	GLenum mode,
+	GLsizei count,
+	GLenum type,
+	const GLvoid *indices)
+{
+	GET_CURRENT_CONTEXT(ctx);
+	GLD_context		*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9	*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+
+	if (!_gldArraysSupported(ctx)) {
+		gld->dwArrayFallbacks++;
+		_mesa_noop_DrawElements(mode, count, type, indices);
+		return;
+	}
+
+	if (!_mesa_validate_DrawElements(ctx, mode, count, type, indices))
+		return;
+
+	_gldDrawArrayElements(ctx, gld, mode, 1, 0, count, type, indices);
+}
+
+//---------------------------------------------------------------------------
+
+static void GLAPIENTRY d3dDrawRangeElements(
+	GLenum mode,
+	GLuint start,
+	GLuint end,
+	GLsizei count,
+	GLenum type,
+	const GLvoid *indices)
+{
+	GET_CURRENT_CONTEXT(ctx);
+	GLD_context		*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9	*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+
+	if (!_gldArraysSupported(ctx)) {
+		gld->dwArrayFallbacks++;
+		_mesa_noop_DrawRangeElements(mode, start, end, count, type, indices);
+		return;
+	}
+
+	if (!_mesa_validate_DrawRangeElements(ctx, mode, start, end, count, type, indices))
+		return;
+
+	// The range bounds conversion; no need to scan the indices
+	_gldDrawArrayElements(ctx, gld, mode, start, end, count, type, indices);
+}
+
+//---------------------------------------------------------------------------
+// Driver callbacks
+//---------------------------------------------------------------------------
+
+static void d3dFlushVertices(
+	GLcontext *ctx,
+	GLuint flags)
+{
+	GLD_context			*gldCtx	= GLD_GET_CONTEXT(ctx);
+	GLD_driver_dx9		*gld	= GLD_GET_DX9_DRIVER(gldCtx);
+
+	D3DPRIMITIVETYPE	d3dpt;
+	DWORD				nVertices, nPrimitives;
+	DWORD				nElements;	// Vertices or indices that make up the primitives
+
+	if (flags & FLUSH_UPDATE_CURRENT) {
+	}
+
+	if (!(flags & FLUSH_STORED_VERTICES))
+		return; // Not being asked to flush vertices
+
+	GLD_PROFILE_BEGIN(GLD_PROFILE_FLUSH_VERTICES);
+
+	// Display list glyphs; never queued alongside vertices
+	if (gld->Glyphs.nQuads)
+		gldFlushGlyphs(ctx);
+
+	// Determine number of vertices in current batch
+	nVertices = gld->dwNextVBVert - gld->dwFirstVBVert;
+
+	// Bail if nothing to do
+	if (nVertices <= 0) {
+		goto bail;
+	}
+
+	// Indexed batches are sized by their indices
+	nElements = gld->bIndexedPrims ? (gld->dwNextIBIndex - gld->dwFirstIBIndex) : nVertices;
+
+	// Determine number of primitives to draw
 	switch (gld->GLReducedPrim) {
 	case GL_POINTS:
-		IDirect3DDevice9_SetRenderState(gld->pDev, D3DRS_POINTSIZE, *((DWORD*)&ctx->Point._Size));
+		gldSetRenderState(gld, D3DRS_POINTSIZE, *((DWORD*)&ctx->Point._Size));
 		d3dpt		= D3DPT_POINTLIST;
-		nPrimitives	= nVertices;
+		nPrimitives	= nElements;
 		break;
 	case GL_LINES:
 		d3dpt		= D3DPT_LINELIST;
-		nPrimitives	= nVertices / 2;
+		nPrimitives	= nElements / 2;
 		break;
 	case GL_TRIANGLES:
 		d3dpt		= D3DPT_TRIANGLELIST;
-		nPrimitives	= nVertices / 3;
+		nPrimitives	= nElements / 3;
 		break;
 	case PRIM_UNKNOWN:
+		GLD_PROFILE_END(GLD_PROFILE_FLUSH_VERTICES);
 		return; // Invalid primitive type
 	default:
 		ASSERT(0);
+		GLD_PROFILE_END(GLD_PROFILE_FLUSH_VERTICES);
 		return;
 	}
 
@@ -1127,23 +2325,31 @@ static void d3dFlushVertices(
 		ID3DXEffect_CommitChanges(pGLDEffect->pEffect);
 	}
 
-	// TODO: Reduce redundant SetStreamSource() calls
-	_GLD_DX9_DEV(SetStreamSource(gld->pDev, 0, gld->pVB, 0, GLD_4D_VERTEX_SIZE));
-	_GLD_DX9_DEV(DrawPrimitive(gld->pDev, d3dpt, gld->dwFirstVBVert, nPrimitives));
+	gldSetStreamSource(gld, gld->pVB, 0, gld->VF[gld->dwVBVF].dwStride);
+	gldSetVertexDeclaration(gld, gld->VF[gld->dwVBVF].pDecl);
+	if (gld->bIndexedPrims) {
+		gldSetIndices(gld, gld->pIB);
+		_GLD_DX9_DEV(DrawIndexedPrimitive(gld->pDev, d3dpt, 0, gld->dwFirstVBVert, nVertices, gld->dwFirstIBIndex, nPrimitives));
+	} else {
+		_GLD_DX9_DEV(DrawPrimitive(gld->pDev, d3dpt, gld->dwFirstVBVert, nPrimitives));
+	}
 #else
 	//
 	// Fixed Function. For testing only.
 	//
 	_GLD_DX9_DEV(SetTransform(gld->pDev, D3DTS_PROJECTION, &gld->matProjection));
 	_GLD_DX9_DEV(SetTransform(gld->pDev, D3DTS_WORLD, &gld->matModelView));
-	_GLD_DX9_DEV(SetPixelShader(gld->pDev, NULL));
-	_GLD_DX9_DEV(SetVertexShader(gld->pDev, NULL));
+	gldSetPixelShader(gld, NULL);
+	gldSetVertexShader(gld, NULL);
 	_GLD_DX9_DEV(DrawPrimitive(gld->pDev, d3dpt, gld->dwFirstVBVert, nPrimitives));
 #endif
 
 bail:
 	gld->dwFirstVBVert		= gld->dwNextVBVert;
+	gld->dwFirstIBIndex		= gld->dwNextIBIndex;
 	ctx->Driver.NeedFlush	= 0;
+
+	GLD_PROFILE_END(GLD_PROFILE_FLUSH_VERTICES);
 }
 
 //---------------------------------------------------------------------------
@@ -1200,6 +2406,9 @@ void gldDestroyD3DTnl(GLcontext *ctx)
 		gld->vfExec = NULL;
 	}
 
+	SAFE_FREE(gld->pArrayVerts);
+	gld->dwMaxArrayVerts = 0;
+
    _ae_destroy_context( ctx );
 }
 
@@ -1300,6 +2509,11 @@ BOOL gldInstallD3DTnl(GLcontext *ctx)
 	vf->VertexAttrib4fNV		= d3dVertexAttrib4fNV;
 	vf->VertexAttrib4fvNV		= d3dVertexAttrib4fvNV;
 
+	// Vertex arrays are converted in bulk rather than element by element
+	vf->DrawArrays				= d3dDrawArrays;
+	vf->DrawElements			= d3dDrawElements;
+	vf->DrawRangeElements		= d3dDrawRangeElements;
+
 #if 0
 	// For debugging
 	vf->DrawElements			= _gldDrawElements;
@@ -1327,12 +2541,16 @@ BOOL gldInstallD3DTnl(GLcontext *ctx)
 	//gld->GLPrim							= PRIM_UNKNOWN;
 	gld->GLReducedPrim					= PRIM_UNKNOWN;
 
-	gld->nEffects		= 0;
-	gld->iCurEffect		= -1; // No effect current
-	gld->iLastEffect	= -1; // No effect current
+	// Empty effect cache; no effect current
+	gldInitShaders(gld);
 
 	gld->fViewportY		= 0.0f;
 
+	// Start with the full vertex format. gldUpdateShaders() selects a compact one.
+	gldCreateVertexFormat(gld, GLD_VF_FULL);
+	gld->dwVF			= GLD_VF_FULL;
+	gld->dwVBVF			= GLD_VF_FULL;
+
 	// Default Direction for directional lights
 	for (i=0; i<GLD_MAX_LIGHTS_DX9; i++) {
 		gld->LightDir[i].x = 0.0f;
@@ -1344,16 +2562,19 @@ BOOL gldInstallD3DTnl(GLcontext *ctx)
 	// Create en effect pool to allow vars to be shared between effects
 	D3DXCreateEffectPool(&gld->pEffectPool);
 
+	// Create effects compiled by previous runs
+	gldPreloadShaderCache(gld);
+
 	// Update the runtime shader generator
 	gldUpdateShaders(ctx);
 
 	// Set some state
-	_GLD_DX9_DEV(SetStreamSource(gld->pDev, 0, gld->pVB, 0, GLD_4D_VERTEX_SIZE));
-	_GLD_DX9_DEV(SetVertexDeclaration(gld->pDev, gld->pVertDecl));
+	gldSetStreamSource(gld, gld->pVB, 0, GLD_4D_VERTEX_SIZE);
+	gldSetVertexDeclaration(gld, gld->pVertDecl);
 
-    _GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_CLIPPING, TRUE));
+    gldSetRenderState(gld, D3DRS_CLIPPING, TRUE);
 	_GLD_DX9_DEV(SetSoftwareVertexProcessing(gld->pDev, !gld->bHasHWTnL));
-	_GLD_DX9_DEV(SetRenderState(gld->pDev, D3DRS_LIGHTING, FALSE));
+	gldSetRenderState(gld, D3DRS_LIGHTING, FALSE);
 
 	return TRUE;
 }
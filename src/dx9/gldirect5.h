@@ -77,6 +77,14 @@
 // Typedef for obtaining function from d3d9.dll
 typedef IDirect3D9* (WINAPI *FNDIRECT3DCREATE9) (UINT);
 
+// Device type for glb.dwDriver. The NullDriver build uses a device that
+// does no rendering, so it runs without graphics hardware.
+#ifdef GLD5_NULL_DRIVER
+#define GLD_DEVTYPE_DX9		D3DDEVTYPE_NULLREF
+#else
+#define GLD_DEVTYPE_DX9		((glb.dwDriver == GLDS_DRIVER_HAL) ? D3DDEVTYPE_HAL : D3DDEVTYPE_REF)
+#endif
+
 //---------------------------------------------------------------------------
 
 #ifdef _DEBUG
@@ -90,11 +98,13 @@ typedef IDirect3D9* (WINAPI *FNDIRECT3DCREATE9) (UINT);
 #define _GLD_DX9(func)		_GLD_TEST_HRESULT(IDirect3D9_##func##)
 #define _GLD_DX9_DEV(func)	_GLD_TEST_HRESULT(IDirect3DDevice9_##func##)
 #define _GLD_DX9_VB(func)	_GLD_TEST_HRESULT(IDirect3DVertexBuffer9_##func##)
+#define _GLD_DX9_IB(func)	_GLD_TEST_HRESULT(IDirect3DIndexBuffer9_##func##)
 #define _GLD_DX9_TEX(func)	_GLD_TEST_HRESULT(IDirect3DTexture9_##func##)
 #else
 #define _GLD_DX9(func)		IDirect3D9_##func
 #define _GLD_DX9_DEV(func)	IDirect3DDevice9_##func
 #define _GLD_DX9_VB(func)	IDirect3DVertexBuffer9_##func
+#define _GLD_DX9_IB(func)	IDirect3DIndexBuffer9_##func
 #define _GLD_DX9_TEX(func)	IDirect3DTexture9_##func
 #endif
 
@@ -163,6 +173,46 @@ typedef struct {
 
 #define GLD_4D_VERTEX_SIZE (sizeof(GLD_4D_VERTEX))
 
+//
+// Compact vertex formats.
+// Vertices are always assembled as GLD_4D_VERTEX, but only the elements that
+// the current vertex shader reads are packed into the Vertex Buffer.
+// Position (float4) and Diffuse (D3DCOLOR) are always present, in that order,
+// followed by the optional elements below in the same order as GLD_4D_VERTEX.
+//
+
+#define GLD_VF_NORMAL			0x01					// float3 normal
+#define GLD_VF_TEX2(unit)		(0x02 << ((unit)*2))	// float2 texcoord
+#define GLD_VF_TEX4(unit)		(0x04 << ((unit)*2))	// float4 texcoord
+#define GLD_VF_COUNT			0x20					// Number of possible formats
+#define GLD_VF_FULL				(GLD_VF_NORMAL | GLD_VF_TEX4(0) | GLD_VF_TEX4(1)) // Same as GLD_4D_VERTEX
+
+// Unlit, untextured
+typedef struct {
+	D3DXVECTOR4		Position;
+	D3DCOLOR		Diffuse;
+} GLD_VERTEX_PC;
+
+// Unlit, single texture
+typedef struct {
+	D3DXVECTOR4		Position;
+	D3DCOLOR		Diffuse;
+	D3DXVECTOR2		Tex0;
+} GLD_VERTEX_PCT;
+
+// Unlit, two textures (e.g. lightmapped)
+typedef struct {
+	D3DXVECTOR4		Position;
+	D3DCOLOR		Diffuse;
+	D3DXVECTOR2		Tex0;
+	D3DXVECTOR2		Tex1;
+} GLD_VERTEX_PCT2;
+
+typedef struct {
+	IDirect3DVertexDeclaration9	*pDecl;		// Declaration (created on demand)
+	DWORD						dwStride;	// Size of one vertex, in bytes
+} GLD_vertexFormat;
+
 //---------------------------------------------------------------------------
 // Effects (Vertex Shaders and Pixel Shaders)
 //---------------------------------------------------------------------------
@@ -274,6 +324,7 @@ typedef struct {
 	GLD_effect_texture		Texture;
 	GLD_effect_lightstate	Light;
 	GLD_effect_fog			Fog;
+	DWORD					VertexFormat;	// GLD_VF_* elements read by the vertex shader
 } GLD_effect_state;
 
 //---------------------------------------------------------------------------
@@ -323,13 +374,171 @@ typedef struct {
 
 //---------------------------------------------------------------------------
 
+//
+// Effect parameter groups. Each group has a generation counter that is
+// bumped when its shadow value changes; an effect only uploads the groups
+// whose generation differs from the one it last uploaded.
+//
+#define GLD_PARAM_WORLDVIEWPROJECT	0
+#define GLD_PARAM_WORLDVIEW			1	// WorldView and its inverse
+#define GLD_PARAM_MATERIAL			2	// Scene ambient, front and back material
+#define GLD_PARAM_LIGHT0			3
+#define GLD_PARAM_FOG				(GLD_PARAM_LIGHT0 + GLD_MAX_LIGHTS_DX9)
+#define GLD_PARAM_TEXMATRIX0		(GLD_PARAM_FOG + 1)
+#define GLD_PARAM_TEXUNIT0			(GLD_PARAM_TEXMATRIX0 + GLD_MAX_TEXTURE_UNITS_DX9)	// Texture, env colour and texgen planes
+#define GLD_PARAM_COUNT				(GLD_PARAM_TEXUNIT0 + GLD_MAX_TEXTURE_UNITS_DX9)
+
+//
+// Shadow copies of effect parameter values, in the form they are uploaded.
+//
+typedef struct {
+	D3DXMATRIX			matWorldViewProject;
+	D3DXMATRIX			matWorldView;
+	D3DXMATRIX			matInvWorldView;
+	// Material
+	D3DXVECTOR4			Ambient;
+	D3DXVECTOR4			mtlFrontAmbient;
+	D3DXVECTOR4			mtlFrontDiffuse;
+	D3DXVECTOR4			mtlFrontSpecular;
+	D3DXVECTOR4			mtlFrontEmissive;
+	float				mtlFrontShininess;
+	D3DXVECTOR4			mtlBackAmbient;
+	D3DXVECTOR4			mtlBackDiffuse;
+	D3DXVECTOR4			mtlBackSpecular;
+	D3DXVECTOR4			mtlBackEmissive;
+	float				mtlBackShininess;
+	// Lights
+	GLD_HLSL_light		Lights[GLD_MAX_LIGHTS_DX9];
+	// Fog: Start, End, Density, 1 in .xyzw
+	D3DXVECTOR4			Fog;
+	// Texture units
+	D3DXMATRIX			matTexture[GLD_MAX_TEXTURE_UNITS_DX9];
+	D3DXMATRIX			matInvTexture[GLD_MAX_TEXTURE_UNITS_DX9];
+	void				*texDiffuse[GLD_MAX_TEXTURE_UNITS_DX9];
+	D3DXVECTOR4			EnvColor[GLD_MAX_TEXTURE_UNITS_DX9];
+	D3DXVECTOR4			TexPlaneS[GLD_MAX_TEXTURE_UNITS_DX9];
+	D3DXVECTOR4			TexPlaneT[GLD_MAX_TEXTURE_UNITS_DX9];
+	D3DXVECTOR4			TexPlaneR[GLD_MAX_TEXTURE_UNITS_DX9];
+	D3DXVECTOR4			TexPlaneQ[GLD_MAX_TEXTURE_UNITS_DX9];
+} GLD_shaderParams;
+
+//---------------------------------------------------------------------------
+
 typedef struct {
 	GLD_effect_state	State;
 	ID3DXEffect			*pEffect;				// The compiled Effect, ready for Direct3D to use
 	D3DXHANDLE			hTechnique;				// Technique handle
 	GLD_handles			Handles;			
+	// Effect cache
+	DWORD				dwHash;					// Digest of State
+	int					iHashNext;				// Next effect in hash bucket (or free list), or -1
+	int					iLRUPrev;				// More recently used effect, or -1
+	int					iLRUNext;				// Less recently used effect, or -1
+	// Generation of each parameter group last uploaded to this effect
+	DWORD				dwParamGen[GLD_PARAM_COUNT];
 } GLD_effect;
 
+// Effect cache sizes
+#define GLD_MAX_EFFECTS			128		// Compiled effects kept per context
+#define GLD_EFFECT_HASH_SIZE	256		// Hash buckets. Must be a power of two.
+
+typedef struct {
+	DWORD				dwHits;			// Lookups that found a compiled effect
+	DWORD				dwMisses;		// Lookups that did not
+	DWORD				dwCompiles;		// HLSL compilations
+	DWORD				dwEvictions;	// Effects released to make room
+	DWORD				dwDiskLoads;	// Effects created from the shader cache
+} GLD_effectStats;
+
+// Shader cache file. Stored next to gldirect.ini as gldcache\<hash><adler32>.gfx:
+//   GLD_shaderCacheHeader
+//   GLD_effect_state		(dwStateSize bytes)
+//   HLSL source			(dwSourceSize bytes, not terminated)
+//   Compiled effect		(dwDataSize bytes)
+#define GLD_SHADER_CACHE_MAGIC		0x53444c47	// 'GLDS'
+#define GLD_SHADER_CACHE_VERSION	2			// Bump whenever the generated HLSL changes
+
+typedef struct {
+	DWORD				dwMagic;		// GLD_SHADER_CACHE_MAGIC
+	DWORD				dwVersion;		// GLD_SHADER_CACHE_VERSION
+	DWORD				dwD3DXVersion;	// D3DX_SDK_VERSION of the compiler
+	DWORD				dwStateSize;	// sizeof(GLD_effect_state)
+	DWORD				dwVSTarget;		// Vertex shader version compiled for
+	DWORD				dwPSTarget;		// Pixel shader version compiled for
+	DWORD				dwFlags;		// D3DXSHADER_* compile flags
+	DWORD				dwHash;			// Digest of the effect state
+	DWORD				dwSourceSize;
+	DWORD				dwDataSize;
+	DWORD				dwChecksum;		// Of everything following the header
+} GLD_shaderCacheHeader;
+
+//---------------------------------------------------------------------------
+// Device state filter
+//---------------------------------------------------------------------------
+
+#define GLD_MAX_RENDERSTATES	256		// Covers every D3DRENDERSTATETYPE
+#define GLD_MAX_SAMPLERS		16		// Pixel shader samplers. Others pass straight through.
+#define GLD_MAX_SAMPLERSTATES	14		// D3DSAMP_DMAPOFFSET + 1
+#define GLD_MAX_TEXTURESTAGES	8
+#define GLD_MAX_TSS				33		// D3DTSS_CONSTANT + 1
+
+// Kinds of device call seen by the state filter
+typedef enum {
+	GLD_STATE_RENDER		= 0,
+	GLD_STATE_SAMPLER		= 1,
+	GLD_STATE_TEXTURESTAGE	= 2,
+	GLD_STATE_TEXTURE		= 3,
+	GLD_STATE_STREAM		= 4,
+	GLD_STATE_INDICES		= 5,
+	GLD_STATE_DECL			= 6,
+	GLD_STATE_SHADER		= 7,	// Vertex and pixel shaders
+	GLD_STATE_CONSTANT		= 8,	// Shader constants (never filtered)
+	GLD_STATE_OTHER			= 9,	// Fixed-function state set by effects (never filtered)
+	GLD_STATE_COUNT
+} GLD_stateType;
+
+typedef struct {
+	DWORD						dwCalls[GLD_STATE_COUNT];		// Calls made by the driver and its effects
+	DWORD						dwFiltered[GLD_STATE_COUNT];	// Calls dropped as redundant
+} GLD_stateStats;
+
+//
+// Last value sent to the device for each state. A value is only used
+// once its Valid flag is set; everything is invalidated when the device
+// is created or Reset() restores the default state.
+//
+// The state manager must be the first member: it is handed to D3DX as an
+// ID3DXEffectStateManager so that effects go through the filter too.
+//
+typedef struct {
+	ID3DXEffectStateManager		StateManager;
+	IDirect3DDevice9			*pDev;
+
+	DWORD						dwRS[GLD_MAX_RENDERSTATES];
+	BYTE						bRSValid[GLD_MAX_RENDERSTATES];
+	DWORD						dwSS[GLD_MAX_SAMPLERS][GLD_MAX_SAMPLERSTATES];
+	BYTE						bSSValid[GLD_MAX_SAMPLERS][GLD_MAX_SAMPLERSTATES];
+	DWORD						dwTSS[GLD_MAX_TEXTURESTAGES][GLD_MAX_TSS];
+	BYTE						bTSSValid[GLD_MAX_TEXTURESTAGES][GLD_MAX_TSS];
+	IDirect3DBaseTexture9		*pTexture[GLD_MAX_SAMPLERS];
+	BYTE						bTextureValid[GLD_MAX_SAMPLERS];
+
+	IDirect3DVertexBuffer9		*pVB;			// Stream 0
+	UINT						uVBOffset;
+	UINT						uVBStride;
+	BOOL						bVBValid;
+	IDirect3DIndexBuffer9		*pIB;
+	BOOL						bIBValid;
+	IDirect3DVertexDeclaration9	*pDecl;
+	BOOL						bDeclValid;
+	IDirect3DVertexShader9		*pVS;
+	BOOL						bVSValid;
+	IDirect3DPixelShader9		*pPS;
+	BOOL						bPSValid;
+
+	GLD_stateStats				Stats;
+} GLD_deviceState;
+
 //---------------------------------------------------------------------------
 // Display lists
 //---------------------------------------------------------------------------
@@ -341,15 +550,59 @@ typedef struct {
 	IDirect3DVertexBuffer9		*pVB;
 	UINT						OffsetInBytes;
 	UINT						Stride;
+	// Geometry heap block holding the vertices
+	int							iHeapPage;		// Page of the geometry heap, or -1 for a private VB
+	UINT						BaseVertex;		// First vertex of the block in pVB
+	UINT						NumVertices;	// Size of the block
 } GLD_data_SetStreamSource;
 
 //---------------------------------------------------------------------------
 
+//
+// Geometry heap. Compiled lists are sub-allocated from a few large
+// managed vertex buffers instead of each getting its own. Successive
+// lists share a buffer, so playback rarely has to change the stream.
+//
+
+#define GLD_DLIST_HEAP_PAGE_VERTS	65536	// Vertices per heap VB; holds one full save buffer
+#define GLD_DLIST_HEAP_MAX_PAGES	64		// Beyond this, lists get private VBs
+
+typedef struct _GLD_dlistBlock {
+	DWORD						dwStart;		// First free vertex
+	DWORD						dwCount;		// Number of free vertices
+	struct _GLD_dlistBlock		*pNext;			// Next free block, in address order
+} GLD_dlistBlock;
+
+typedef struct {
+	IDirect3DVertexBuffer9		*pVB;			// NULL if the page is not allocated
+	GLD_dlistBlock				*pFree;			// Free blocks, in address order
+	DWORD						dwFreeVerts;	// Total free vertices in the page
+} GLD_dlistHeapPage;
+
+typedef struct {
+	DWORD						dwAllocs;		// Blocks allocated
+	DWORD						dwFrees;		// Blocks freed
+	DWORD						dwPrivate;		// Lists that fell back to a private VB
+	DWORD						dwPages;		// Heap VBs created
+	DWORD						dwUsedVerts;	// Vertices currently allocated
+	DWORD						dwPeakVerts;	// Most vertices allocated at once
+} GLD_dlistHeapStats;
+
+typedef struct {
+	GLD_dlistHeapPage			Pages[GLD_DLIST_HEAP_MAX_PAGES];
+	int							nPages;			// Page slots in use
+	int							iCurPage;		// Page last allocated from
+	GLD_dlistHeapStats			Stats;
+} GLD_dlistHeap;
+
+//---------------------------------------------------------------------------
+
 typedef struct {
 	// Opcodes. These are what we insert into the display list along with Mesa's opcodes.
 	int							opSetStreamSource;	// Set a Direct3D VB (Vertex Buffer) as "current"
 	int							opDrawPrimitive;	// Draw primitives using current D3D VB.
 	int							opEvalCoord;		// Emit EvalCoord1f or EvalCoord2f
+	int							opGlyph;			// Draw a glBitmap from the glyph atlas
 
 	// We'll keep a pointer to the previous SetStreamSource node so we can fill it in
 	// when we know how many vertices will be in the D3D Vertex Buffer.
@@ -374,8 +627,247 @@ typedef struct {
 	GLD_4D_VERTEX				*pVerts;			// Vertex buffer
 	DWORD						dwFirstVBVert;		// First vert of current primitive type
 	DWORD						dwNextVBVert;		// Index of next free vert in Vertex Buffer
+
+	// List optimiser
+	GLuint						List;				// List being compiled
+	DWORD						dwOpcodesIn;		// Opcodes seen by the optimiser
+	DWORD						dwOpcodesOut;		// Opcodes left after optimising
+	DWORD						dwDrawsMerged;		// DrawPrimitive opcodes folded into their predecessor
 } GLD_display_list;
 
+//---------------------------------------------------------------------------
+// Vertex arrays
+//---------------------------------------------------------------------------
+
+// Vertex, normal, colour and one texcoord array per unit
+#define GLD_ARRAY_SOURCES		(3 + GLD_MAX_TEXTURE_UNITS_DX9)
+
+typedef struct {
+	const GLubyte				*pData;			// NULL if the array is disabled
+	GLenum						Type;
+	GLint						Size;
+	GLsizei						StrideB;
+} GLD_arraySource;
+
+// Everything a converted range of array elements depends on
+typedef struct {
+	GLuint						First;			// First element of the range
+	GLuint						Count;			// Number of elements in the range
+	float						fViewportY;
+	GLD_4D_VERTEX				vDefaults;		// Attributes not supplied by an array
+	GLD_arraySource				Src[GLD_ARRAY_SOURCES];
+} GLD_arrayKey;
+
+// Range of locked (compiled) vertex arrays already in pVB
+typedef struct {
+	BOOL						bValid;
+	DWORD						dwVBVert;		// VB index of the first element
+	GLD_arrayKey				Key;
+} GLD_arrayCache;
+
+//---------------------------------------------------------------------------
+// Pixel operations
+//---------------------------------------------------------------------------
+
+// Smallest side of the glDrawPixels/glBitmap streaming texture
+#define GLD_PIXEL_TEXTURE_MIN	256
+
+// Persistent texture that glDrawPixels, glBitmap and glCopyPixels images
+// are unpacked into. It only ever grows, so steady state is a single lock.
+typedef struct {
+	IDirect3DTexture9			*pTex;
+	DWORD						dwWidth;		// Allocated size
+	DWORD						dwHeight;
+	BOOL						bDynamic;		// D3DUSAGE_DYNAMIC in POOL_DEFAULT, else managed
+	DWORD						dwUploads;		// Images drawn through the texture
+	DWORD						dwCreates;		// Times it was (re)created
+} GLD_pixelTexture;
+
+//---------------------------------------------------------------------------
+// Glyph atlas
+//---------------------------------------------------------------------------
+
+// Bitmaps bigger than this in either direction are left to Mesa's glBitmap opcode
+#define GLD_GLYPH_MAX_SIZE			128
+// Atlas width, and the heights it starts at and may grow to
+#define GLD_GLYPH_ATLAS_WIDTH		512
+#define GLD_GLYPH_ATLAS_MIN_HEIGHT	128
+#define GLD_GLYPH_ATLAS_MAX_HEIGHT	1024
+// Glyph quads queued before the batch must be drawn
+#define GLD_GLYPH_BATCH_QUADS		1024
+
+typedef struct {
+	FLOAT						x, y;		// 2D raster coords
+	FLOAT						z;			// depth value
+	FLOAT						rhw;		// reciprocal homogenous W (always 1.0f)
+	D3DCOLOR					color;		// Raster colour
+	FLOAT						tu, tv;		// Atlas texcoords
+} GLD_GLYPH_VERTEX;
+
+// glBitmap calls compiled into display lists (wglUseFontBitmaps glyphs, for one)
+// keep their bits in one alpha texture and are drawn as batched textured quads.
+typedef struct {
+	IDirect3DTexture9			*pTex;			// Managed, so it survives Reset()
+	BYTE						*pShadow;		// System copy of the atlas, used when it grows
+	DWORD						dwWidth;
+	DWORD						dwHeight;
+	DWORD						dwMaxHeight;
+	DWORD						dwShelfX;		// Next free column on the open shelf
+	DWORD						dwShelfY;		// Top row of the open shelf
+	DWORD						dwShelfHeight;	// Tallest glyph on the open shelf
+	DWORD						dwLive;			// Glyph opcodes holding atlas space
+	DWORD						dwAtlasId;		// Unique per installed cache; 0 once released
+
+	// Quads waiting to be drawn
+	GLD_GLYPH_VERTEX			*pVerts;
+	WORD						*pIndices;		// Fixed two-triangle pattern per quad
+	DWORD						nQuads;
+
+	// Mesa's save function, for bitmaps the atlas cannot take
+	void (GLAPIENTRYP			SaveBitmap)(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap);
+
+	DWORD						dwCompiled;		// Bitmaps placed in the atlas
+	DWORD						dwFallbacks;	// Bitmaps left to Mesa
+	DWORD						dwDrawn;		// Glyph quads drawn
+	DWORD						dwBatches;		// Draw calls for them
+} GLD_glyphCache;
+
+//---------------------------------------------------------------------------
+// Texture sub-image staging
+//---------------------------------------------------------------------------
+
+// Sub-images bigger than this fraction of their level are locked directly
+#define GLD_TEXSTAGE_MAX_FRACTION	4
+// Pending sub-images, and the bytes they hold, before everything is flushed
+#define GLD_TEXSTAGE_MAX_IMAGES		256
+#define GLD_TEXSTAGE_MAX_BYTES		(4*1024*1024)
+// Dirty rects passed to AddDirtyRect per level before they are merged into one
+#define GLD_TEXSTAGE_MAX_DIRTY		8
+
+typedef struct {
+	IDirect3DTexture9			*pTex;			// Not AddRef'd; discarded before the texture is released
+	UINT						Level;
+	RECT						rc;				// Destination in the level
+	DWORD						dwOffset;		// Converted texels in GLD_texStaging.pData
+	DWORD						dwPitch;
+	DWORD						dwTexelBytes;
+} GLD_stagedImage;
+
+// glTexSubImage2D updates to managed textures (lightmaps, video frames) are
+// converted into system memory and written when the texture is next bound,
+// one lock per level and only the merged dirty rects re-uploaded.
+typedef struct {
+	GLD_stagedImage				*pImages;
+	int							nImages;
+	BYTE						*pData;
+	DWORD						dwUsed;			// Bytes of pData in use
+
+	DWORD						dwStaged;		// Sub-images staged
+	DWORD						dwDirect;		// Sub-images locked directly
+	DWORD						dwLocks;		// Level locks made by flushes
+	DWORD						dwDirtyRects;	// Rects passed to AddDirtyRect
+} GLD_texStaging;
+
+//---------------------------------------------------------------------------
+// DXT texture storage
+//---------------------------------------------------------------------------
+
+#define GLD_MAX_COMPRESS_THREADS		8	// Including the GL thread
+
+typedef struct {
+	HANDLE							hThread;
+	HANDLE							hWork;		// Auto-reset; pBand is ready
+	HANDLE							hDone;		// Auto-reset; pBand has been encoded
+	void							*pBand;		// Band to encode; NULL tells the worker to exit
+} GLD_compressWorker;
+
+// Workers that encode the lower bands of a large DXT upload while the
+// GL thread encodes the first. Started with the context, so uploads
+// do not pay for creating threads.
+typedef struct {
+	GLD_compressWorker				Workers[GLD_MAX_COMPRESS_THREADS-1];
+	int								nWorkers;
+} GLD_compressPool;
+
+//---------------------------------------------------------------------------
+// Texture residency
+//---------------------------------------------------------------------------
+
+#define GLD_RESIDENCY_HASH_SIZE			1024	// Must be a power of two
+// Frames a texture of priority 1.0 is kept after its last use, when
+// there is an older or lower priority texture that can go instead
+#define GLD_RESIDENCY_PRIORITY_FRAMES	600
+
+typedef struct _GLD_residentTexture {
+	struct gl_texture_object		*tObj;
+	DWORD							dwBytes;		// Size of every level
+	DWORD							dwLastFrame;	// Frame the texture was last used in
+	DWORD							dwShadow;		// Shadow file number; 0 while resident
+	BOOL							bStaleMips;		// Mipmaps were stale when evicted
+	struct _GLD_residentTexture		*pHashNext;
+	struct _GLD_residentTexture		*pPrev;			// Towards most recently used
+	struct _GLD_residentTexture		*pNext;			// Towards least recently used
+} GLD_residentTexture;
+
+// With dwTextureBudget set, managed textures over the budget are saved
+// to DDS files in the temp directory and released, so they no longer
+// hold system memory, then reloaded when they are next used.
+typedef struct {
+	GLD_residentTexture				*pHash[GLD_RESIDENCY_HASH_SIZE];
+	GLD_residentTexture				*pMRU;
+	GLD_residentTexture				*pLRU;
+	DWORD							dwFrame;
+	DWORD							dwNextShadow;
+	char							szShadowPath[MAX_PATH];	// Temp directory, with trailing slash
+
+	DWORD							dwTextures;			// Textures tracked
+	DWORD							dwResidentBytes;
+	DWORD							dwPeakBytes;		// Most bytes resident at once
+	DWORD							dwFrameBytes;		// Bytes used so far this frame
+	DWORD							dwPeakFrameBytes;	// Largest working set of a frame
+	DWORD							dwEvictions;
+	DWORD							dwRestores;
+	DWORD							dwFailures;			// Textures that could not be saved or reloaded
+} GLD_textureResidency;
+
+//---------------------------------------------------------------------------
+// Pixel readback
+//---------------------------------------------------------------------------
+
+// Readbacks that can be in flight at once
+#define GLD_READBACK_SLOTS			3
+
+typedef struct {
+	IDirect3DSurface9			*pCopy;			// POOL_DEFAULT render target the backbuffer is copied to
+	IDirect3DSurface9			*pSysmem;		// POOL_SYSTEMMEM surface it is read back through
+	IDirect3DQuery9				*pEvent;		// Signalled when the copy is done, if supported
+	BOOL						bPending;		// Copied but not yet written to the app
+	GLuint						uTicket;
+	RECT						rc;				// Backbuffer rect, top-down
+	GLenum						format;
+	GLenum						type;
+	GLvoid						*pixels;
+	struct gl_pixelstore_attrib	Pack;
+} GLD_readbackSlot;
+
+// glReadPixels, and the GL_GLD_async_read_pixels queue, copy the
+// backbuffer on the GPU and only read it back when the copy is done.
+// The surfaces persist for as long as the backbuffer size does not change.
+typedef struct {
+	GLD_readbackSlot			Slots[GLD_READBACK_SLOTS];
+	UINT						Width;			// Backbuffer the surfaces were made for
+	UINT						Height;
+	D3DFORMAT					Format;
+	int							iNext;			// Slot the next readback goes in
+	GLuint						uNextTicket;
+
+	DWORD						dwReads;		// glReadPixels calls
+	DWORD						dwAsyncReads;	// Readbacks queued
+	DWORD						dwStalls;		// ...that had to wait for a full ring
+	DWORD						dwDropped;		// ...lost to a resize or Reset()
+	DWORD						dwFallbacks;	// Reads left to the D3DX path
+} GLD_readback;
+
 //---------------------------------------------------------------------------
 // Context struct
 //---------------------------------------------------------------------------
@@ -399,6 +891,7 @@ typedef struct {
 	BOOL						bHasHWTnL;				// Device has Hardware Transform/Light?
 	IDirect3D9					*pD3D;					// Base Direct3D9 interface
 	IDirect3DDevice9			*pDev;					// Direct3D9 Device interface
+	GLD_deviceState				DevState;				// Redundant state filter for pDev
 	D3DXMATRIX					matProjection;			// Projection matrix for D3D TnL
 	D3DXMATRIX					matModelView;			// Model/View matrix for D3D TnL
 	D3DXMATRIX					matInvModelView;		// Inverse Model/View matrix for D3D TnL
@@ -406,6 +899,9 @@ typedef struct {
 	D3DXMATRIX					matTexture[GLD_MAX_TEXTURE_UNITS_DX9];		// Texture matrix per unit
 	D3DXMATRIX					matInvTexture[GLD_MAX_TEXTURE_UNITS_DX9];	// Inverse texture matrix per unit
 	IDirect3DVertexDeclaration9	*pVertDecl;				// Vertex declaration for GLD_4D_VERTEX
+	GLD_vertexFormat			VF[GLD_VF_COUNT];		// Compact vertex formats
+	DWORD						dwVF;					// Vertex format required by current state
+	DWORD						dwVBVF;					// Vertex format of vertices in pVB
 
 	// Mesa Vertex Formats for Exec mode and Save mode.
 	GLvertexformat				*vfExec;		// exec vertex format (for Mesa)
@@ -424,13 +920,51 @@ typedef struct {
 	DWORD						dwFirstVBVert;	// Index of first vert in Vertex Buffer
 	DWORD						dwNextVBVert;	// Index of next free vert in Vertex Buffer
 
+	//
+	// Indexed primitives: each unique vertex is written to the VB once and the
+	// expansion (and provoking vertex order) of strips, fans, quads and polygons
+	// is done with 16-bit indices instead.
+	//
+	BOOL						bIndexedPrims;	// Render immediate mode with DrawIndexedPrimitive?
+	DWORD						dwMaxIBIndices;	// Capacity of Index Buffer.
+	IDirect3DIndexBuffer9		*pIB;			// Indices into pVB
+	DWORD						dwFirstIBIndex;	// Index of first index in Index Buffer
+	DWORD						dwNextIBIndex;	// Index of next free index in Index Buffer
+
 	DWORD						dwMaxPrimVerts;	// Capacity of primitive buffer.
 	GLD_4D_VERTEX				*pPrim;			// primitive buffer
 	DWORD						dwPrimVert;		// Index of next free vert in primitive buffer
 
+	// glDrawArrays/glDrawElements convert array ranges through this
+	GLD_4D_VERTEX				*pArrayVerts;		// Staging buffer for converted elements
+	DWORD						dwMaxArrayVerts;	// Capacity of staging buffer
+	GLD_arrayCache				ArrayCache;			// Locked range already in pVB
+	DWORD						dwArrayDraws;		// Array draws handled natively
+	DWORD						dwArrayCached;		// ...that reused a locked range
+	DWORD						dwArrayFallbacks;	// Array draws left to Mesa
+
+	// glDrawPixels/glBitmap/glCopyPixels image texture
+	GLD_pixelTexture			PixelTex;
+
+	// Display list glBitmap glyphs
+	GLD_glyphCache				Glyphs;
+
+	// Deferred glTexSubImage2D updates
+	GLD_texStaging				TexStaging;
+
+	// DXT encoding threads
+	GLD_compressPool			CompressPool;
+
+	// Texture memory budget
+	GLD_textureResidency		Residency;
+
+	// glReadPixels surfaces
+	GLD_readback				Readback;
+
 	//
 	// Display list support
 	GLD_display_list			DList;			// Data for current Display List 
+	GLD_dlistHeap				DListHeap;		// Shared VBs for compiled lists
 
 	//
 	// Run-time shader generation
@@ -438,8 +972,23 @@ typedef struct {
 	ID3DXEffectPool				*pEffectPool;	// This allows parameters to be shared between effects
 	int							iLastEffect;	// Index of previous effect (or -1)
 	int							iCurEffect;		// Index of current effect (or -1)
-	int							nEffects;		// Count of current effects
-	GLD_effect					Effects[100];	// TODO: Use linked list
+	int							nEffects;		// Count of effect slots in use
+	GLD_effect					Effects[GLD_MAX_EFFECTS];
+	int							iEffectHash[GLD_EFFECT_HASH_SIZE];	// First effect in each bucket, or -1
+	int							iEffectMRU;		// Most recently used effect, or -1
+	int							iEffectLRU;		// Least recently used effect, or -1
+	int							iEffectFree;	// Free list of effect slots, or -1
+	GLD_effectStats				EffectStats;
+	DWORD						dwVSTarget;		// Vertex shader version effects are compiled for
+	DWORD						dwPSTarget;		// Pixel shader version effects are compiled for
+	DWORD						dwEffectFlags;	// D3DXSHADER_* compile flags
+
+	// Effect parameters
+	GLD_shaderParams			Params;			// Shadow copies of parameter values
+	DWORD						dwParamGen[GLD_PARAM_COUNT];	// Generation of each parameter group
+	DWORD						dwParamBytes;		// Constant bytes uploaded this frame
+	DWORD						dwFrameParamBytes;	// Constant bytes uploaded last frame
+	DWORD						dwPeakParamBytes;	// Most constant bytes uploaded in one frame
 
 	// Keep track of direction of directional lights.
 	D3DXVECTOR4					LightDir[GLD_MAX_LIGHTS_DX9];
@@ -450,9 +999,45 @@ typedef struct {
 
 #define GLD_GET_DX9_DRIVER(c) (GLD_driver_dx9*)(c)->glPriv
 
+// Callback used to emit each chunk of a split primitive
+typedef void (*GLD_emitPrimitive)(GLcontext *ctx, GLenum mode, GLD_4D_VERTEX *pPrim, int nPrimVerts);
+
 // If we run out of space in the primitive buffer (pPrim) then enlarge it by this amount.
 #define GLD_PRIM_BLOCK_SIZE		2000 // Number of vertices to add to primitive buffer
 
+// Size of the immediate mode index buffer, as a multiple of the vertex buffer size.
+#define GLD_IB_VB_RATIO			2
+
+//---------------------------------------------------------------------------
+// CPU profiler
+//---------------------------------------------------------------------------
+
+// Timed scopes. Names for the trace and overlay are in gld_profile_dx9.c.
+typedef enum {
+	GLD_PROFILE_SWAP_BUFFERS,		// gldSwapBuffers_DX
+	GLD_PROFILE_UPDATE_STATE,		// gld_update_state_DX9
+	GLD_PROFILE_UPDATE_SHADERS,		// gldUpdateShaders
+	GLD_PROFILE_FIND_EFFECT,		// _gldFindEffect
+	GLD_PROFILE_D3D_END,			// d3dEnd
+	GLD_PROFILE_FLUSH_VERTICES,		// d3dFlushVertices
+	GLD_PROFILE_TEX_IMAGE,			// gld_TexImage2D_DX9
+	GLD_PROFILE_SCOPES
+} GLD_profileScope;
+
+// A scope costs one test of gldProfileActive while the profiler is off.
+// Every GLD_PROFILE_BEGIN must be matched by a GLD_PROFILE_END of the
+// same scope on each path out of the code it times.
+#define GLD_PROFILE_BEGIN(s)	do { if (gldProfileActive) gldProfileBegin(s); } while (0)
+#define GLD_PROFILE_END(s)		do { if (gldProfileActive) gldProfileEnd(s); } while (0)
+
+// Device calls of one frame, taken from the device call recorder
+typedef struct {
+	DWORD		dwDraws;
+	DWORD		dwStates;			// States, textures, streams and shaders set
+	DWORD		dwLocks;
+	DWORD		dwUploadBytes;		// Locked and Draw*UP bytes
+} GLD_frameCounts;
+
 //---------------------------------------------------------------------------
 // Function prototypes
 //---------------------------------------------------------------------------
@@ -479,6 +1064,7 @@ void							gldCopyTexSubImage3D_DX9(GLcontext *ctx, GLenum target, GLint level,
 
 // Texture functions
 void							gld_NEW_TEXTURE_DX9(GLcontext *ctx);
+IDirect3DTexture9*				gldValidateTextureUnit(GLcontext *ctx, GLuint unit);
 void							gld_DrawPixels_DX9(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, const struct gl_pixelstore_attrib *unpack, const GLvoid *pixels);
 void							gld_ReadPixels_DX9(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, const struct gl_pixelstore_attrib *unpack, GLvoid *dest);
 void							gld_CopyPixels_DX9(GLcontext *ctx, GLint srcx, GLint srcy, GLsizei width, GLsizei height, GLint dstx, GLint dsty, GLenum type);
@@ -490,18 +1076,105 @@ void							gld_TexSubImage2D_DX9( GLcontext *ctx, GLenum target, GLint level, GL
 void							gld_TexSubImage1D_DX9(GLcontext *ctx, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid *pixels, const struct gl_pixelstore_attrib *packing, struct gl_texture_object *texObj, struct gl_texture_image *texImage);
 void							gld_DeleteTexture_DX9(GLcontext *ctx, struct gl_texture_object *tObj);
 void							gld_ResetLineStipple_DX9(GLcontext *ctx);
+void							gldReleasePixelTexture(GLD_driver_dx9 *gld);
+HRESULT							gldDrawImage_DX9(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height, const DWORD *pPixels);
+extern const GUID				GLD_GUID_MipmapsStale;
+
+// DXT texture storage
+BOOL							gldIsCompressedFormat(D3DFORMAT d3dFormat);
+D3DFORMAT						gldCompressedFormat(D3DFORMAT d3dFormat);
+BOOL							gldCompressTexImage(GLcontext *ctx, struct gl_texture_image *texImage, D3DFORMAT d3dFormat, BYTE *pDst, INT iPitch, GLint width, GLint height, GLenum format, GLenum type, const GLvoid *pixels, const struct gl_pixelstore_attrib *packing);
+void							gldInitCompressPool(GLD_driver_dx9 *gld);
+void							gldReleaseCompressPool(GLD_driver_dx9 *gld);
+
+// Direct texture upload
+BOOL							gldUploadTexImage(GLcontext *ctx, struct gl_texture_image *texImage, D3DFORMAT d3dFormat, BYTE *pDst, INT iPitch, GLint width, GLint height, GLenum format, GLenum type, const GLvoid *pixels, const struct gl_pixelstore_attrib *packing);
+void							gldSwapRedBlue32(BYTE *pDst, const GLubyte *pSrc, GLint nTexels, DWORD dwAlpha);
+
+// Texture sub-image staging
+BOOL							gldStageTexSubImage(GLcontext *ctx, struct gl_texture_image *texImage, IDirect3DTexture9 *pTex, GLint level, const D3DSURFACE_DESC *pDesc, const struct gl_texture_format *texFormat, GLint xoffset, GLint yoffset, GLint width, GLint height, GLenum format, GLenum type, const GLvoid *pixels, const struct gl_pixelstore_attrib *packing);
+void							gldFlushTexStaging(GLD_driver_dx9 *gld, IDirect3DTexture9 *pTex);
+void							gldDiscardTexStaging(GLD_driver_dx9 *gld, IDirect3DTexture9 *pTex);
+void							gldReleaseTexStaging(GLD_driver_dx9 *gld);
+
+// Texture residency
+IDirect3DTexture9*				gldTouchTexture(GLcontext *ctx, struct gl_texture_object *tObj);
+void							gldTrackTexture(GLcontext *ctx, struct gl_texture_object *tObj);
+void							gldUntrackTexture(GLD_driver_dx9 *gld, struct gl_texture_object *tObj);
+GLboolean						gld_IsTextureResident_DX9(GLcontext *ctx, struct gl_texture_object *tObj);
+void							gldEndFrameTextureResidency(GLD_driver_dx9 *gld);
+void							gldReleaseTextureResidency(GLD_driver_dx9 *gld);
+
+// Pixel readback
+BOOL							gldReadPixels(GLcontext *ctx, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, const struct gl_pixelstore_attrib *pack, GLvoid *dest);
+GLuint APIENTRY					gldReadPixelsAsyncGLD(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels);
+GLboolean APIENTRY				gldPollReadPixelsGLD(GLuint ticket);
+void APIENTRY					gldFinishReadPixelsGLD(GLuint ticket);
+void							gldReleaseReadback(GLD_driver_dx9 *gld);
+
+// Device call recorder
+void							gldStartRecording(IDirect3DDevice9 *pDev);
+void							gldStopRecording(IDirect3DDevice9 *pDev);
+void							gldGetRecordedFrame(GLD_frameCounts *pCounts);
+
+// CPU profiler
+extern BOOL						gldProfileActive;
+void							gldStartProfiling(void);
+void							gldStopProfiling(void);
+void							gldProfileBegin(GLD_profileScope Scope);
+void							gldProfileEnd(GLD_profileScope Scope);
+void							gldEndProfileFrame(void);
+void							gldDrawProfileOverlay(GLcontext *ctx);
+
+// Command stream
+void							gldStartStream(IDirect3DDevice9 *pDev);
+void							gldStopStream(IDirect3DDevice9 *pDev);
+void							gldSyncStream(void);
 
 void							gldResetPrimitiveBuffer(GLD_driver_dx9 *gld);
 GLenum							gldReducedPrim(GLenum mode);
+BOOL							gldCreateVertexFormat(GLD_driver_dx9 *gld, DWORD dwVF);
+void							gldReleaseVertexFormats(GLD_driver_dx9 *gld);
+void							gldSplitPrimitive(GLcontext *ctx, GLenum mode, GLD_4D_VERTEX *pPrim, int nVerts, int nMaxD3DVerts, GLD_emitPrimitive EmitPrimitive);
+
+// Glyph atlas
+BOOL							gldInstallGlyphs(GLcontext *ctx);
+void							gldFlushGlyphs(GLcontext *ctx);
+void							gldReleaseGlyphs(GLD_driver_dx9 *gld);
 
 // Display List support
 BOOL							_gld_install_save_vtxfmt(GLcontext *ctx);
+void							gldDestroyDListHeap(GLD_driver_dx9 *gld);
+
+// Device state filter
+void							gldInitDeviceState(GLD_driver_dx9 *gld);
+void							gldInvalidateDeviceState(GLD_driver_dx9 *gld);
+void							gldLogDeviceStateStats(GLD_driver_dx9 *gld);
+void							gldSetRenderState(GLD_driver_dx9 *gld, D3DRENDERSTATETYPE State, DWORD Value);
+void							gldSetSamplerState(GLD_driver_dx9 *gld, DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value);
+void							gldSetTextureStageState(GLD_driver_dx9 *gld, DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value);
+void							gldSetTexture(GLD_driver_dx9 *gld, DWORD Sampler, IDirect3DBaseTexture9 *pTexture);
+void							gldSetStreamSource(GLD_driver_dx9 *gld, IDirect3DVertexBuffer9 *pVB, UINT OffsetInBytes, UINT Stride);
+void							gldSetIndices(GLD_driver_dx9 *gld, IDirect3DIndexBuffer9 *pIB);
+void							gldSetVertexDeclaration(GLD_driver_dx9 *gld, IDirect3DVertexDeclaration9 *pDecl);
+void							gldSetFVF(GLD_driver_dx9 *gld, DWORD FVF);
+void							gldSetVertexShader(GLD_driver_dx9 *gld, IDirect3DVertexShader9 *pShader);
+void							gldSetPixelShader(GLD_driver_dx9 *gld, IDirect3DPixelShader9 *pShader);
 
 // Run-time shader generation
 void							gldUpdateShaders(GLcontext *ctx);
+void							gldInitShaders(GLD_driver_dx9 *gld);
 void							gldReleaseShaders(GLD_driver_dx9 *gld);
+void							gldDirtyShaderParams(GLcontext *ctx, GLuint new_state);
+void							gldEndFrameShaderParams(GLD_driver_dx9 *gld);
 void							gldBeginEffect(GLD_driver_dx9 *gld, int iEffect);
 void							gldEndEffect(GLD_driver_dx9 *gld, int iEffect);
+BOOL							gldPreloadEffect(GLD_driver_dx9 *gld, const GLD_effect_state *pEffectState, const void *pData, DWORD dwDataSize);
+
+// Persistent shader cache
+void							gldPreloadShaderCache(GLD_driver_dx9 *gld);
+BOOL							gldReadShaderCache(GLD_driver_dx9 *gld, const GLD_effect_state *pEffectState, DWORD dwHash, void **ppData, DWORD *pdwDataSize);
+void							gldWriteShaderCache(GLD_driver_dx9 *gld, const GLD_effect_state *pEffectState, DWORD dwHash, const char *pszSource, const void *pData, DWORD dwDataSize);
 
 D3DCOLOR						gldClampedColour(GLfloat *c);
 
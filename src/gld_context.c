@@ -38,6 +38,7 @@
 #include "gld_context.h"
 
 #include "gld_driver.h"
+#include "gld_trace.h"
 
 extern void _gld_mesa_warning(GLcontext *, char *);
 extern void _gld_mesa_fatal(GLcontext *, char *);
@@ -152,7 +153,7 @@ static void DetectOS(void)
 
 HWND hWndEvent = NULL;					// event monitor window
 HWND hWndLastActive = NULL;				// last active client window
-LONG __stdcall GLD_EventWndProc(HWND hwnd,UINT msg,WPARAM wParam,LPARAM lParam);
+static LONG __stdcall GLD_EventWndProc(HWND hwnd,UINT msg,WPARAM wParam,LPARAM lParam);
 
 // ***********************************************************************
 
@@ -486,6 +487,16 @@ LRESULT CALLBACK gldKeyProc(
 	WPARAM wParam,
 	LPARAM lParam)
 {
+	// Profiler keys, on key down (bit 31 of lParam clear)
+	if ((code == HC_ACTION) && !(lParam & 0x80000000) && glb.szProfileFile[0] &&
+		(wParam == VK_F11) && (GetKeyState(VK_CONTROL) & 0x8000))
+	{
+		if (GetKeyState(VK_SHIFT) & 0x8000)
+			glb.bProfileDump = TRUE;
+		else
+			glb.bProfileOverlay = !glb.bProfileOverlay;
+	}
+
 	return CallNextHookEx(hKeyHook, code, wParam, lParam);
 }
 
@@ -1019,6 +1030,9 @@ BOOL gldMakeCurrent(
 		lpCtx->bHasBeenCurrent = TRUE;
 	}
 
+	// Start the call trace, if one was asked for, once GL is usable
+	gldBeginTrace(lpCtx->dwWidth, lpCtx->dwHeight);
+
 	// Don't want to spit this out *every* frame...
 	//gldLogPrintf(GLDLOG_SYSTEM, "gldMakeCurrent: width = %d, height = %d", lpCtx->dwWidth, lpCtx->dwHeight);
 
@@ -1196,6 +1210,7 @@ BOOL gldSwapBuffers(
 
 	// Notify Mesa of impending swap, so Mesa can flush internal buffers.
 	_mesa_notifySwapBuffers(lpCtx->glCtx);
+	gldTraceEndFrame(lpCtx->dwWidth, lpCtx->dwHeight);
 	// Now perform driver buffer swap
 	_gldDriver.SwapBuffers(lpCtx, hDC, hWnd);
 
@@ -47,7 +47,7 @@
 #endif // STRICT
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
-#include <GL\gl.h>
+#include <GL/gl.h>
 
 #include "gld_macros.h"
 #include "gld_globals.h"
@@ -142,6 +142,32 @@ void gldInitGlobals()
 	// This can be enabled for any app, as required, as an app-customisation.
 	glb.bUseMesaDisplayLists	= FALSE;
 
+	// Render immediate mode primitives with indices
+	glb.bIndexedPrimitives		= TRUE;
+
+	// Only compress textures the app asked to have compressed
+	glb.bCompressTextures		= FALSE;
+
+	// Let Direct3D manage every texture
+	glb.dwTextureBudget			= 0;
+
+	// No shader cache unless gldirect.ini is found
+	glb.szShaderCachePath[0]	= '\0';
+
+	// No device recording unless gldirect.ini is found
+	glb.szRecordFile[0]			= '\0';
+
+	// No call trace unless gldirect.ini asks for one
+	glb.szTraceFile[0]			= '\0';
+
+	// Submit to Direct3D from the app thread
+	glb.bCommandStream			= FALSE;
+
+	// No profiler unless gldirect.ini asks for one
+	glb.szProfileFile[0]		= '\0';
+	glb.bProfileOverlay			= FALSE;
+	glb.bProfileDump			= FALSE;
+
 	glb.iAppCustomisation			= -1; // Not yet detected
 }
 
@@ -156,6 +156,64 @@ typedef struct {
 	// Default value: FALSE
 	BOOL				bUseMesaDisplayLists;
 
+	// bIndexedPrimitives:
+	// If TRUE, immediate mode primitives are rendered with DrawIndexedPrimitive,
+	// writing each vertex once. If FALSE, primitives are expanded into lists.
+	// Default value: TRUE
+	BOOL				bIndexedPrimitives;
+
+	// bCompressTextures:
+	// If TRUE, RGB and RGBA textures are stored as DXT1 and DXT5 regardless of
+	// the requested internal format. Generic GL_COMPRESSED_* formats are
+	// always stored compressed.
+	// Default value: FALSE
+	BOOL				bCompressTextures;
+
+	// dwTextureBudget:
+	// Megabytes of managed textures kept loaded. Least recently used, low
+	// priority textures over the budget are saved to the temp directory
+	// and reloaded on next use. 0 means no budget.
+	// Default value: 0
+	DWORD				dwTextureBudget;
+
+	// szShaderCachePath:
+	// Directory holding compiled effects between runs, next to gldirect.ini.
+	// Empty if there is no ini file or the cache is disabled with bShaderCache=0.
+	// Default value: empty
+	char				szShaderCachePath[MAX_PATH];
+
+	// szRecordFile:
+	// CSV file the device call recorder writes a line per frame to, next
+	// to gldirect.ini. Empty if there is no ini file or bRecordDevice=0.
+	// Default value: empty
+	char				szRecordFile[MAX_PATH];
+
+	// szTraceFile:
+	// Binary trace of every GL call, for replay with gldreplay, next to
+	// gldirect.ini. Empty if there is no ini file or bCaptureTrace=0.
+	// Default value: empty
+	char				szTraceFile[MAX_PATH];
+
+	// szProfileFile:
+	// Chrome trace (chrome://tracing) JSON the CPU profiler writes when the
+	// device is released, next to gldirect.ini. Empty if there is no ini
+	// file or bProfile=0, in which case the profiler is off.
+	// Default value: empty
+	char				szProfileFile[MAX_PATH];
+
+	// bCommandStream:
+	// If TRUE, the state, draw and present calls GLDirect makes on the
+	// device are queued for a worker thread that submits them to Direct3D.
+	// Mesa and the GL entry points stay on the app thread.
+	// Default value: FALSE
+	BOOL				bCommandStream;
+
+	// Profiler hot-keys, set by gldKeyProc() and acted on at the next
+	// SwapBuffers: Ctrl+F11 toggles the overlay, Ctrl+Shift+F11 writes
+	// szProfileFile straight away.
+	BOOL				bProfileOverlay;
+	BOOL				bProfileDump;
+
     DWORD				dwAdapter;				// Primary DX8 adapter
 	DWORD				dwTnL;					// TnL setting
 	DWORD				dwMultisample;			// Multisample Off
@@ -31,7 +31,8 @@
 * Language:     ANSI C
 * Environment:  Windows 9x (Win32)
 *
-* Description:  Logging functions.
+* Description:  Logging functions. Messages are queued without a lock and
+*               written to the log file by a background thread.
 *
 *********************************************************************************/
 
@@ -42,8 +43,53 @@
 #include "gld_driver.h"
 
 // ***********************************************************************
+//
+// Messages are formatted on the calling thread's stack and queued in a
+// ring of fixed-size records, which a writer thread drains to the file.
+// Any number of threads can queue at once without a lock: a record is
+// claimed by advancing lEnqueue with a compare-exchange, and marked
+// complete through its sequence number. Only the holder of lDrainLock
+// takes records out (the writer, or a thread flushing the log itself).
+//
+// Critical messages, and gldLogClose(), drain the ring on the calling
+// thread, so they are on disk before a crash or exit.
+//
+// ***********************************************************************
+
+#define GLDLOG_RECORD_SIZE		512		// Longer messages are truncated
+#define GLDLOG_RECORDS			512		// Must be a power of two
+#define GLDLOG_REPEAT_SLOTS		64		// Must be a power of two
+#define GLDLOG_REPEAT_LIMIT		8		// Repeats of a message allowed per window
+#define GLDLOG_REPEAT_WINDOW	1000	// Milliseconds
+#define GLDLOG_WRITE_INTERVAL	100		// Milliseconds between writer wake-ups
+
+typedef struct {
+	volatile LONG		lSeq;			// Index it was claimed at + 1 when complete
+	GLDLOG_severityType	severity;
+	char				szText[GLDLOG_RECORD_SIZE];
+} GLD_logRecord;
+
+// Recent messages, for rate limiting. Races only make the counts approximate.
+typedef struct {
+	DWORD				dwHash;
+	DWORD				dwStart;		// GetTickCount() the window started
+	LONG				lCount;			// Times seen in the window
+	char				szText[64];		// Start of the message, for the summary
+} GLD_logRepeat;
+
+static GLD_logRecord			gldLogRing[GLDLOG_RECORDS];
+static volatile LONG			lEnqueue;										// Next record to claim
+static LONG						lDequeue;										// Next record to write
+static volatile LONG			lDrainLock;
+static volatile LONG			lSignalled;										// Writer has been woken
+static volatile LONG			lDropped;										// Messages lost to a full ring
+static GLD_logRepeat			gldLogRepeats[GLDLOG_REPEAT_SLOTS];
+
+static HANDLE					hLogThread = NULL;
+static HANDLE					hLogWake = NULL;
+static HANDLE					hLogStopped = NULL;
+static volatile BOOL			bLogStop = FALSE;
 
-static char						gldLogbuf[1024];
 static FILE*					fpGLDLog = NULL;								// Log file pointer
 static char						szGLDLogName[_MAX_PATH] = {GLDLOG_FILENAME};	// Filename of the log
 static GLDLOG_loggingMethodType	gldLoggingMethod = GLDLOG_NONE;					// Default to No Logging
@@ -52,24 +98,221 @@ static BOOL						bUIWarning = FALSE;								// MessageBox warning ?
 
 // ***********************************************************************
 
+static BOOL _gldLogLockDrain(
+	DWORD dwTimeout)
+{
+	DWORD dwStart = GetTickCount();
+
+	while (InterlockedCompareExchange((LONG*)&lDrainLock, 1, 0) != 0) {
+		// The holder may have been killed with the process; go ahead anyway
+		if (GetTickCount() - dwStart > dwTimeout)
+			return FALSE;
+		Sleep(0);
+	}
+	return TRUE;
+}
+
+// ***********************************************************************
+
+static void _gldLogDrain(void)
+{
+	//
+	// Write out every complete record. The caller holds lDrainLock.
+	//
+
+	GLD_logRecord	*pRec;
+	BOOL			bDebugger = IsDebuggerPresent();
+	LONG			lLost;
+	char			buf[64];
+
+	for (;;) {
+		pRec = &gldLogRing[lDequeue & (GLDLOG_RECORDS-1)];
+		if (pRec->lSeq != lDequeue + 1)
+			break; // Empty, or the next record is still being written
+		if (fpGLDLog)
+			fputs(pRec->szText, fpGLDLog);
+		if (bDebugger)
+			OutputDebugString(pRec->szText); // Echo to debugger
+		// Hand the record back to the producers, a lap on
+		InterlockedExchange((LONG*)&pRec->lSeq, lDequeue + GLDLOG_RECORDS);
+		lDequeue++;
+	}
+
+	lLost = InterlockedExchange((LONG*)&lDropped, 0);
+	if (lLost) {
+		sprintf(buf, "GLD: (%s) %d messages lost, log overrun\n", gldLogSeverityMessages[GLDLOG_WARN], lLost);
+		if (fpGLDLog)
+			fputs(buf, fpGLDLog);
+		if (bDebugger)
+			OutputDebugString(buf);
+	}
+
+	if (fpGLDLog && gldLoggingMethod == GLDLOG_CRASHPROOF)
+		fflush(fpGLDLog); // Write info to disk
+}
+
+// ***********************************************************************
+
+static void _gldLogFlush(void)
+{
+	BOOL bLocked = _gldLogLockDrain(1000);
+
+	_gldLogDrain();
+	if (fpGLDLog)
+		fflush(fpGLDLog);
+	if (bLocked)
+		InterlockedExchange((LONG*)&lDrainLock, 0);
+}
+
+// ***********************************************************************
+
+static DWORD WINAPI _gldLogWriter(
+	LPVOID lpParam)
+{
+	while (!bLogStop) {
+		WaitForSingleObject(hLogWake, GLDLOG_WRITE_INTERVAL);
+		InterlockedExchange((LONG*)&lSignalled, 0);
+		if (bLogStop)
+			break;
+		_gldLogLockDrain(INFINITE);
+		_gldLogDrain();
+		InterlockedExchange((LONG*)&lDrainLock, 0);
+	}
+
+	SetEvent(hLogStopped);
+	return 0;
+}
+
+// ***********************************************************************
+
+static BOOL _gldLogQueue(
+	GLDLOG_severityType severity,
+	const char *szText)
+{
+	//
+	// Copy szText into the next free record. Returns FALSE if the ring is full.
+	//
+
+	GLD_logRecord	*pRec;
+	LONG			lPos, lDiff;
+
+	lPos = lEnqueue;
+	for (;;) {
+		pRec = &gldLogRing[lPos & (GLDLOG_RECORDS-1)];
+		lDiff = pRec->lSeq - lPos;
+		if (lDiff == 0) {
+			// Free; try to claim it
+			if (InterlockedCompareExchange((LONG*)&lEnqueue, lPos + 1, lPos) == lPos)
+				break;
+			lPos = lEnqueue;
+		} else if (lDiff < 0) {
+			return FALSE; // Not yet written out
+		} else {
+			lPos = lEnqueue; // Claimed by another thread
+		}
+	}
+
+	pRec->severity = severity;
+	lstrcpyn(pRec->szText, szText, GLDLOG_RECORD_SIZE);
+	InterlockedExchange((LONG*)&pRec->lSeq, lPos + 1);
+
+	// Wake the writer, once per batch
+	if (hLogWake && !InterlockedExchange((LONG*)&lSignalled, 1))
+		SetEvent(hLogWake);
+	return TRUE;
+}
+
+// ***********************************************************************
+
+static void _gldLogRepeatSummary(
+	GLD_logRepeat *pRep)
+{
+	char buf[GLDLOG_RECORD_SIZE];
+
+	if (pRep->lCount <= GLDLOG_REPEAT_LIMIT)
+		return;
+	_snprintf(buf, sizeof(buf), "GLD: (%s) %d repeats of \"%s\" not logged\n",
+		gldLogSeverityMessages[GLDLOG_INFO], pRep->lCount - GLDLOG_REPEAT_LIMIT, pRep->szText);
+	buf[sizeof(buf)-1] = '\0';
+	_gldLogQueue(GLDLOG_INFO, buf);
+}
+
+// ***********************************************************************
+
+static BOOL _gldLogRepeated(
+	const char *szText)
+{
+	//
+	// Returns TRUE if szText has been logged too often lately.
+	// When a window ends with repeats held back, a summary is queued.
+	//
+
+	GLD_logRepeat	*pRep;
+	DWORD			dwHash = 2166136261u;	// FNV-1a
+	DWORD			dwNow = GetTickCount();
+	const char		*p;
+
+	for (p=szText; *p; p++)
+		dwHash = (dwHash ^ (BYTE)*p) * 16777619u;
+	pRep = &gldLogRepeats[dwHash & (GLDLOG_REPEAT_SLOTS-1)];
+
+	if (pRep->dwHash == dwHash && dwNow - pRep->dwStart < GLDLOG_REPEAT_WINDOW)
+		return InterlockedIncrement(&pRep->lCount) > GLDLOG_REPEAT_LIMIT;
+
+	// New message, or a new window
+	_gldLogRepeatSummary(pRep);
+	pRep->dwHash	= dwHash;
+	pRep->dwStart	= dwNow;
+	pRep->lCount	= 1;
+	lstrcpyn(pRep->szText, szText, sizeof(pRep->szText));
+	// Drop the newline, if it fitted
+	for (p=pRep->szText; *p; p++)
+		if (*p == '\n')
+			pRep->szText[p - pRep->szText] = '\0';
+	return FALSE;
+}
+
+// ***********************************************************************
+
 void gldLogOpen(
 	GLDLOG_loggingMethodType LoggingMethod,
 	GLDLOG_severityType Severity)
 {
+	int i;
+
 	if (fpGLDLog != NULL) {
 		// Tried to re-open the log
 		gldLogMessage(GLDLOG_WARN, "Tried to re-open the log file\n");
 		return;
 	}
 
+	if (LoggingMethod == GLDLOG_NONE)
+		return;
+
+	// Crash-proof logs have always been appended to
+	fpGLDLog = fopen(szGLDLogName, (LoggingMethod == GLDLOG_NORMAL) ? "wt" : "at");
+	if (fpGLDLog == NULL)
+		return;
+
+	// Empty ring
+	for (i=0; i<GLDLOG_RECORDS; i++)
+		gldLogRing[i].lSeq = i;
+	lEnqueue	= 0;
+	lDequeue	= 0;
+	lDrainLock	= 0;
+	lSignalled	= 0;
+	lDropped	= 0;
+	ZeroMemory(gldLogRepeats, sizeof(gldLogRepeats));
+
 	gldLoggingMethod	= LoggingMethod;
 	gldDebugLevel		= Severity;
 
-	if (gldLoggingMethod == GLDLOG_NORMAL) {
-		fpGLDLog = fopen(szGLDLogName, "wt");
-        if (fpGLDLog == NULL)
-            return;
-    }
+	// Without a writer thread, every message is written as it is logged
+	bLogStop	= FALSE;
+	hLogWake	= CreateEvent(NULL, FALSE, FALSE, NULL);
+	hLogStopped	= CreateEvent(NULL, TRUE, FALSE, NULL);
+	if (hLogWake && hLogStopped)
+		hLogThread = CreateThread(NULL, 0, _gldLogWriter, NULL, 0, NULL);
 
 	gldLogMessage(GLDLOG_SYSTEM, "-> Logging Started\n");
 }
@@ -78,15 +321,43 @@ void gldLogOpen(
 
 void gldLogClose()
 {
+	HANDLE	hWait[2];
+	int		i;
+
 	// Determine whether the log is already closed
-	if (fpGLDLog == NULL && gldLoggingMethod == GLDLOG_NORMAL)
+	if (fpGLDLog == NULL)
 		return; // Nothing to do.
 
+	for (i=0; i<GLDLOG_REPEAT_SLOTS; i++)
+		_gldLogRepeatSummary(&gldLogRepeats[i]);
 	gldLogMessage(GLDLOG_SYSTEM, "<- Logging Ended\n");
 
-	if (gldLoggingMethod == GLDLOG_NORMAL) {
-		fclose(fpGLDLog);
-		fpGLDLog = NULL;
+	// Stop the writer. When the process is exiting it has already been
+	// killed, so wait for either it to stop or its thread to end.
+	// (Waiting for the thread alone would hang inside DLL_PROCESS_DETACH.)
+	if (hLogThread) {
+		bLogStop = TRUE;
+		SetEvent(hLogWake);
+		hWait[0] = hLogStopped;
+		hWait[1] = hLogThread;
+		WaitForMultipleObjects(2, hWait, FALSE, 1000);
+		CloseHandle(hLogThread);
+		hLogThread = NULL;
+	}
+
+	// Anything still queued is written here
+	gldLoggingMethod = GLDLOG_NONE;
+	_gldLogFlush();
+	fclose(fpGLDLog);
+	fpGLDLog = NULL;
+
+	if (hLogWake) {
+		CloseHandle(hLogWake);
+		hLogWake = NULL;
+	}
+	if (hLogStopped) {
+		CloseHandle(hLogStopped);
+		hLogStopped = NULL;
 	}
 }
 
@@ -96,33 +367,38 @@ void gldLogMessage(
 	GLDLOG_severityType severity,
 	LPSTR message)
 {
-	char buf[1024];
+	char buf[GLDLOG_RECORD_SIZE];
 
 	// Bail if logging is disabled
 	if (gldLoggingMethod == GLDLOG_NONE)
 		return;
 
-	if (gldLoggingMethod == GLDLOG_CRASHPROOF)
-		fpGLDLog = fopen(szGLDLogName, "at");
-
-	if (fpGLDLog == NULL)
-		return;
-
 	if (severity >= gldDebugLevel) {
-		sprintf(buf, "GLD: (%s) %s", gldLogSeverityMessages[severity], message);
-		fputs(buf, fpGLDLog); // Write string to file
-		OutputDebugString(buf); // Echo to debugger
-	}
-
-	if (gldLoggingMethod == GLDLOG_CRASHPROOF) {
-		fflush(fpGLDLog); // Write info to disk
-		fclose(fpGLDLog);
-		fpGLDLog = NULL;
+		// System and critical messages always get through
+		if (severity < GLDLOG_CRITICAL && _gldLogRepeated(message))
+			return;
+
+		_snprintf(buf, sizeof(buf), "GLD: (%s) %s", gldLogSeverityMessages[severity], message);
+		buf[sizeof(buf)-1] = '\0';
+
+		if (!_gldLogQueue(severity, buf)) {
+			// Full. Make room for errors; drop the rest.
+			if (severity >= GLDLOG_ERROR) {
+				_gldLogFlush();
+				_gldLogQueue(severity, buf);
+			} else {
+				InterlockedIncrement((LONG*)&lDropped);
+			}
+		}
+
+		// No writer, or a message that must be on disk before a crash
+		if (!hLogThread || severity == GLDLOG_CRITICAL)
+			_gldLogFlush();
 	}
 
 	// Popup message box if critical error
 	if (bUIWarning && severity == GLDLOG_CRITICAL) {
-		MessageBox(NULL, buf, "GLDirect", MB_OK | MB_ICONWARNING | MB_TASKMODAL);
+		MessageBox(NULL, message, "GLDirect", MB_OK | MB_ICONWARNING | MB_TASKMODAL);
 	}
 }
 
@@ -135,12 +411,20 @@ void gldLogError(
 	HRESULT hResult)
 {
 	char dxErrStr[1024];
+	char buf[GLDLOG_RECORD_SIZE];
+
+	if (gldLoggingMethod == GLDLOG_NONE || severity < gldDebugLevel)
+		return;
+
 	_gldDriver.GetDXErrorString(hResult, &dxErrStr[0], sizeof(dxErrStr));
 	if (FAILED(hResult)) {
-		sprintf(gldLogbuf, "GLD: %s %8x:[ %s ]\n", message, hResult, dxErrStr);
+		_snprintf(buf, sizeof(buf), "GLD: %s %8x:[ %s ]\n", message, hResult, dxErrStr);
 	} else
-		sprintf(gldLogbuf, "GLD: %s\n", message);
-	gldLogMessage(severity, gldLogbuf);
+		_snprintf(buf, sizeof(buf), "GLD: %s\n", message);
+	// Truncated messages still end the line
+	buf[sizeof(buf)-2] = '\n';
+	buf[sizeof(buf)-1] = '\0';
+	gldLogMessage(severity, buf);
 }
 
 // ***********************************************************************
@@ -151,14 +435,24 @@ void gldLogPrintf(
 	...)
 {
 	va_list args;
+	char	buf[GLDLOG_RECORD_SIZE];
+	int		n;
+
+	// Formatting is the expensive part; skip it for messages not logged
+	if (gldLoggingMethod == GLDLOG_NONE || severity < gldDebugLevel)
+		return;
 
 	va_start(args, message);
-	vsprintf(gldLogbuf, message, args);
+	n = _vsnprintf(buf, sizeof(buf) - 1, message, args);
 	va_end(args);
 
-	lstrcat(gldLogbuf, "\n");
+	// Truncated messages still end the line
+	if (n < 0 || n > (int)sizeof(buf) - 2)
+		n = sizeof(buf) - 2;
+	buf[n]		= '\n';
+	buf[n+1]	= '\0';
 
-	gldLogMessage(severity, gldLogbuf);
+	gldLogMessage(severity, buf);
 }
 
 // ***********************************************************************
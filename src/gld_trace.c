@@ -0,0 +1,967 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  GL call trace capture. Installs a dispatch override that
+*               writes every call the application makes to a trace file
+*               before passing it on, for replay with gldreplay.
+*
+*********************************************************************************/
+
+#include "gld_context.h"
+#include "gld_trace.h"
+
+#include "glapi.h"
+#include "glapioffsets.h"
+#include "glapitable.h"
+#include "eval.h"
+#include "image.h"
+#include "teximage.h"
+
+// ***********************************************************************
+
+#define GLD_TRACE_BLOCK_SIZE	(256*1024)	// A block is written once past this
+#define GLD_TRACE_MAX_ARGS		1024		// Encoded arguments of one call
+#define GLD_TRACE_MAX_BLOBS		65536		// Blob ids are reset past this
+#define GLD_TRACE_BLOB_SLOTS	(GLD_TRACE_MAX_BLOBS*2)
+
+typedef struct {
+	unsigned __int64	qHash;
+	DWORD				dwSize;
+	DWORD				dwId;				// 0 if the slot is free
+} GLD_traceBlob;
+
+typedef struct {
+	BOOL				bStarted;			// Only one trace per process
+	BOOL				bActive;			// Calls are being written
+	int					nDepth;				// Nested dispatch from inside GL
+	FILE				*fp;
+	struct _glapi_table	*pTable;			// The override table
+
+	BYTE				Args[GLD_TRACE_MAX_ARGS];
+	BYTE				*pArg;				// Next free byte of Args
+	DWORD				dwOp;				// Call being encoded
+
+	BYTE				*pBlock;			// Whole ops waiting to be written
+	DWORD				dwBlockUsed;
+	DWORD				dwBlockSize;
+
+	GLD_traceBlob		*pBlobs;			// Hash table of blobs sent so far
+	DWORD				nBlobs;
+
+	DWORD				dwWidth;			// Drawable size last sent
+	DWORD				dwHeight;
+
+	// Statistics
+	DWORD				dwFrames;
+	ULONGLONG			qwCalls;
+	ULONGLONG			qwUnsupported;
+	ULONGLONG			qwFileBytes;
+	ULONGLONG			qwBlobBytes;
+	ULONGLONG			qwDedupBytes;
+} GLD_trace;
+
+static GLD_trace gldTrace;
+
+extern void *__glapi_noop_table[];
+
+// ***********************************************************************
+
+static void _gldTraceFail(
+	const char *szReason)
+{
+	//
+	// Stop writing but keep forwarding: the override stays installed
+	// for the life of the process.
+	//
+
+	if (gldTrace.bActive)
+		gldLogPrintf(GLDLOG_WARN, "Trace: %s, capture stopped after %u frames", szReason, gldTrace.dwFrames);
+	gldTrace.bActive = FALSE;
+}
+
+// ***********************************************************************
+
+static __inline BYTE *_gldTracePutVarint(
+	BYTE *p,
+	DWORD v)
+{
+	while (v >= 0x80) {
+		*p++ = (BYTE)(v | 0x80);
+		v >>= 7;
+	}
+	*p++ = (BYTE)v;
+	return p;
+}
+
+static __inline BYTE *_gldTracePutVarint64(
+	BYTE *p,
+	ULONGLONG v)
+{
+	while (v >= 0x80) {
+		*p++ = (BYTE)(v | 0x80);
+		v >>= 7;
+	}
+	*p++ = (BYTE)v;
+	return p;
+}
+
+// ***********************************************************************
+
+static BYTE *_gldTraceReserve(
+	DWORD dwBytes)
+{
+	//
+	// Returns room for dwBytes at the end of the block, growing it to
+	// hold large blobs. NULL once capture has stopped.
+	//
+
+	BYTE	*pNew;
+	DWORD	dwSize;
+
+	if (!gldTrace.bActive)
+		return NULL;
+	if (gldTrace.dwBlockUsed + dwBytes > gldTrace.dwBlockSize) {
+		dwSize = max(gldTrace.dwBlockSize * 2, gldTrace.dwBlockUsed + dwBytes);
+		pNew = (BYTE*)MALLOC(dwSize);
+		if (!pNew) {
+			_gldTraceFail("out of memory");
+			return NULL;
+		}
+		memcpy(pNew, gldTrace.pBlock, gldTrace.dwBlockUsed);
+		FREE(gldTrace.pBlock);
+		gldTrace.pBlock			= pNew;
+		gldTrace.dwBlockSize	= dwSize;
+	}
+	return gldTrace.pBlock + gldTrace.dwBlockUsed;
+}
+
+// ***********************************************************************
+
+static void _gldTraceFlushBlock(void)
+{
+	DWORD	dwHeader[3];
+
+	if (!gldTrace.dwBlockUsed)
+		return;
+
+	dwHeader[0] = GLD_TRACE_BLOCK_MAGIC;
+	dwHeader[1] = gldTrace.dwBlockUsed;
+	dwHeader[2] = (DWORD)gldTraceHash(gldTrace.pBlock, gldTrace.dwBlockUsed);
+	if ((fwrite(dwHeader, sizeof(dwHeader), 1, gldTrace.fp) != 1) ||
+		(fwrite(gldTrace.pBlock, gldTrace.dwBlockUsed, 1, gldTrace.fp) != 1))
+	{
+		_gldTraceFail("unable to write trace file");
+	}
+	gldTrace.qwFileBytes += sizeof(dwHeader) + gldTrace.dwBlockUsed;
+	gldTrace.dwBlockUsed = 0;
+}
+
+// ***********************************************************************
+
+static void _gldTraceSpecialOp(
+	DWORD dwOp,
+	DWORD dwArg0,
+	DWORD dwArg1,
+	int nArgs)
+{
+	BYTE *p = _gldTraceReserve(15);
+
+	if (!p)
+		return;
+	p = _gldTracePutVarint(p, dwOp);
+	if (nArgs > 0)
+		p = _gldTracePutVarint(p, dwArg0);
+	if (nArgs > 1)
+		p = _gldTracePutVarint(p, dwArg1);
+	gldTrace.dwBlockUsed = p - gldTrace.pBlock;
+}
+
+// ***********************************************************************
+
+static DWORD _gldTraceBlob(
+	const void *pData,
+	DWORD dwSize)
+{
+	//
+	// Returns the id of a blob holding pData, sending it first if the
+	// same bytes have not been sent before.
+	//
+
+	unsigned __int64	qHash	= gldTraceHash(pData, dwSize);
+	DWORD				i		= (DWORD)qHash & (GLD_TRACE_BLOB_SLOTS - 1);
+	GLD_traceBlob		*pBlob;
+	BYTE				*p;
+
+	for (;;) {
+		pBlob = &gldTrace.pBlobs[i];
+		if (!pBlob->dwId)
+			break;
+		if ((pBlob->qHash == qHash) && (pBlob->dwSize == dwSize)) {
+			gldTrace.qwDedupBytes += dwSize;
+			return pBlob->dwId;
+		}
+		i = (i + 1) & (GLD_TRACE_BLOB_SLOTS - 1);
+	}
+
+	// Keep the table half empty; the replayer frees its copies too
+	if (gldTrace.nBlobs == GLD_TRACE_MAX_BLOBS) {
+		memset(gldTrace.pBlobs, 0, GLD_TRACE_BLOB_SLOTS * sizeof(GLD_traceBlob));
+		gldTrace.nBlobs = 0;
+		_gldTraceSpecialOp(GLD_TRACE_OP_BLOB_RESET, 0, 0, 0);
+		pBlob = &gldTrace.pBlobs[(DWORD)qHash & (GLD_TRACE_BLOB_SLOTS - 1)];
+	}
+
+	p = _gldTraceReserve(15 + dwSize);
+	if (!p)
+		return 0;
+	pBlob->qHash	= qHash;
+	pBlob->dwSize	= dwSize;
+	pBlob->dwId		= ++gldTrace.nBlobs;
+	p = _gldTracePutVarint(p, GLD_TRACE_OP_BLOB);
+	p = _gldTracePutVarint(p, pBlob->dwId);
+	p = _gldTracePutVarint(p, dwSize);
+	memcpy(p, pData, dwSize);
+	gldTrace.dwBlockUsed = (p + dwSize) - gldTrace.pBlock;
+	gldTrace.qwBlobBytes += dwSize;
+	return pBlob->dwId;
+}
+
+// ***********************************************************************
+// Call encoding, used by gld_trace_tmp.h
+// ***********************************************************************
+
+#define _GLD_TRACE_REAL	_gldTraceReal()
+
+static __inline struct _glapi_table *_gldTraceReal(void)
+{
+	// The table Mesa would have dispatched through without the override
+	GET_CURRENT_CONTEXT(ctx);
+	return ctx ? ctx->CurrentDispatch : (struct _glapi_table *)__glapi_noop_table;
+}
+
+static __inline GLboolean _gldTraceEnter(void)
+{
+	// Calls GL makes to itself while running one are not recorded
+	return (gldTrace.nDepth++ == 0) && gldTrace.bActive;
+}
+
+static __inline void _gldTraceExit(void)
+{
+	gldTrace.nDepth--;
+}
+
+static __inline void _gldTraceBeginOp(
+	DWORD dwOp)
+{
+	gldTrace.dwOp	= dwOp;
+	gldTrace.pArg	= gldTrace.Args;
+}
+
+static void _gldTraceEndOp(void)
+{
+	DWORD	dwArgs	= gldTrace.pArg - gldTrace.Args;
+	BYTE	*p		= _gldTraceReserve(5 + dwArgs);
+
+	if (!p)
+		return;
+	p = _gldTracePutVarint(p, gldTrace.dwOp);
+	memcpy(p, gldTrace.Args, dwArgs);
+	gldTrace.dwBlockUsed = (p + dwArgs) - gldTrace.pBlock;
+	gldTrace.qwCalls++;
+	if (gldTrace.dwBlockUsed >= GLD_TRACE_BLOCK_SIZE)
+		_gldTraceFlushBlock();
+}
+
+static __inline void _gldTraceUnsupported(void)
+{
+	// Recorded without arguments so the replayer can count it
+	gldTrace.qwUnsupported++;
+}
+
+static __inline void _gldTraceU32(
+	GLuint v)
+{
+	gldTrace.pArg = _gldTracePutVarint(gldTrace.pArg, v);
+}
+
+static __inline void _gldTraceS32(
+	GLint v)
+{
+	gldTrace.pArg = _gldTracePutVarint(gldTrace.pArg, ((GLuint)v << 1) ^ (GLuint)(v >> 31));
+}
+
+static __inline void _gldTraceS64(
+	__int64 v)
+{
+	gldTrace.pArg = _gldTracePutVarint64(gldTrace.pArg, ((ULONGLONG)v << 1) ^ (ULONGLONG)(v >> 63));
+}
+
+static __inline void _gldTraceF32(
+	GLfloat v)
+{
+	memcpy(gldTrace.pArg, &v, 4);
+	gldTrace.pArg += 4;
+}
+
+static __inline void _gldTraceF64(
+	GLdouble v)
+{
+	memcpy(gldTrace.pArg, &v, 8);
+	gldTrace.pArg += 8;
+}
+
+static void _gldTraceIn(
+	const void *pData,
+	GLuint dwSize)
+{
+	if (!pData) {
+		*gldTrace.pArg++ = GLD_TRACE_PTR_NULL;
+	} else if (dwSize <= GLD_TRACE_INLINE_MAX) {
+		*gldTrace.pArg++ = GLD_TRACE_PTR_INLINE;
+		*gldTrace.pArg++ = (BYTE)dwSize;
+		memcpy(gldTrace.pArg, pData, dwSize);
+		gldTrace.pArg += dwSize;
+	} else {
+		*gldTrace.pArg++ = GLD_TRACE_PTR_BLOB;
+		gldTrace.pArg = _gldTracePutVarint(gldTrace.pArg, _gldTraceBlob(pData, dwSize));
+	}
+}
+
+static void _gldTraceRebased(
+	const GLubyte *pData,
+	GLuint dwSize,
+	GLuint dwBefore)
+{
+	// pData is dwBefore bytes into an array; the replayer points there too
+	*gldTrace.pArg++ = GLD_TRACE_PTR_REBASED;
+	gldTrace.pArg = _gldTracePutVarint(gldTrace.pArg, _gldTraceBlob(pData, dwSize));
+	gldTrace.pArg = _gldTracePutVarint(gldTrace.pArg, dwBefore);
+}
+
+static void _gldTraceOut(
+	const void *pData,
+	GLuint dwSize)
+{
+	if (!pData) {
+		*gldTrace.pArg++ = GLD_TRACE_PTR_NULL;
+	} else if (!dwSize) {
+		*gldTrace.pArg++ = GLD_TRACE_PTR_UNSIZED;
+	} else {
+		*gldTrace.pArg++ = GLD_TRACE_PTR_OUTPUT;
+		gldTrace.pArg = _gldTracePutVarint(gldTrace.pArg, dwSize);
+	}
+}
+
+static void _gldTracePersistent(
+	const void *pData,
+	GLuint dwSize)
+{
+	if (!pData) {
+		*gldTrace.pArg++ = GLD_TRACE_PTR_NULL;
+	} else {
+		*gldTrace.pArg++ = GLD_TRACE_PTR_PERSIST;
+		gldTrace.pArg = _gldTracePutVarint(gldTrace.pArg, dwSize);
+	}
+}
+
+static void _gldTraceOffset(
+	const void *pOffset)
+{
+	*gldTrace.pArg++ = GLD_TRACE_PTR_OFFSET;
+	gldTrace.pArg = _gldTracePutVarint64(gldTrace.pArg, (ULONGLONG)(size_t)pOffset);
+}
+
+static void _gldTraceArrayPointer(
+	const void *pPointer)
+{
+	//
+	// Client memory is sent at draw time, when the range in use is
+	// known; an offset into a buffer object can go out as it is.
+	//
+
+	GET_CURRENT_CONTEXT(ctx);
+
+	if (ctx && ctx->Array.ArrayBufferObj->Name)
+		_gldTraceOffset(pPointer);
+	else
+		*gldTrace.pArg++ = GLD_TRACE_PTR_NULL;
+}
+
+static void _gldTraceElements(
+	const void *pIndices,
+	GLuint dwSize)
+{
+	GET_CURRENT_CONTEXT(ctx);
+
+	if (ctx && ctx->Array.ElementArrayBufferObj->Name)
+		_gldTraceOffset(pIndices);
+	else
+		_gldTraceIn(pIndices, dwSize);
+}
+
+// ***********************************************************************
+// Sizes of the data behind pointer arguments
+// ***********************************************************************
+
+static GLuint _gldTraceTypeSize(
+	GLenum type)
+{
+	switch (type) {
+	case GL_BYTE:
+	case GL_UNSIGNED_BYTE:
+		return 1;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_2_BYTES:
+		return 2;
+	case GL_3_BYTES:
+		return 3;
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT:
+	case GL_4_BYTES:
+		return 4;
+	case GL_DOUBLE:
+		return 8;
+	}
+	return 0;
+}
+
+static GLuint _gldTraceCallListsSize(
+	GLsizei n,
+	GLenum type)
+{
+	return (n > 0) ? n * _gldTraceTypeSize(type) : 0;
+}
+
+static GLuint _gldTraceParamCount(
+	GLenum pname)
+{
+	//
+	// Values taken by the vector forms of the state setters. Enums with
+	// a single value are left to the default.
+	//
+
+	switch (pname) {
+	case GL_FOG_COLOR:
+	case GL_AMBIENT:
+	case GL_DIFFUSE:
+	case GL_SPECULAR:
+	case GL_POSITION:
+	case GL_EMISSION:
+	case GL_AMBIENT_AND_DIFFUSE:
+	case GL_LIGHT_MODEL_AMBIENT:
+	case GL_TEXTURE_BORDER_COLOR:
+	case GL_TEXTURE_ENV_COLOR:
+	case GL_OBJECT_PLANE:
+	case GL_EYE_PLANE:
+	case GL_COLOR_TABLE_SCALE:
+	case GL_COLOR_TABLE_BIAS:
+	case GL_CONVOLUTION_BORDER_COLOR:
+	case GL_CONVOLUTION_FILTER_SCALE:
+	case GL_CONVOLUTION_FILTER_BIAS:
+	case GL_CONSTANT_COLOR0_NV:
+	case GL_CONSTANT_COLOR1_NV:
+		return 4;
+	case GL_SPOT_DIRECTION:
+	case GL_COLOR_INDEXES:
+	case GL_POINT_DISTANCE_ATTENUATION_ARB:
+		return 3;
+	}
+	return 1;
+}
+
+static GLuint _gldTraceMapSize(
+	GLenum target,
+	GLint ustride,
+	GLint uorder,
+	GLint vstride,
+	GLint vorder)
+{
+	// Values read by glMap1/glMap2; vorder is 0 for glMap1
+	GLuint k = _mesa_evaluator_components(target);
+
+	if (!k || (uorder < 1) || (vorder < 0) || (ustride < 0) || (vstride < 0))
+		return 0;
+	return (uorder - 1) * ustride + (vorder ? (vorder - 1) * vstride : 0) + k;
+}
+
+static GLuint _gldTraceImageSize(
+	const void *pixels,
+	GLsizei width,
+	GLsizei height,
+	GLsizei depth,
+	GLenum format,
+	GLenum type,
+	GLboolean bPack)
+{
+	//
+	// Bytes from pixels to the end of the last pixel read or written,
+	// under the current pixel store state.
+	//
+
+	GET_CURRENT_CONTEXT(ctx);
+	const GLubyte	*pLast;
+	GLint			nBytes;
+
+	if (!ctx || !pixels || (width <= 0) || (height <= 0) || (depth <= 0))
+		return 0;
+	nBytes = (type == GL_BITMAP) ? 1 : _mesa_bytes_per_pixel(format, type);
+	if (nBytes <= 0)
+		return 0;
+	pLast = (const GLubyte*)_mesa_image_address(bPack ? &ctx->Pack : &ctx->Unpack,
+		pixels, width, height, format, type, depth - 1, height - 1, width - 1);
+	if (!pLast)
+		return 0;
+	return (pLast - (const GLubyte*)pixels) + nBytes;
+}
+
+static struct gl_texture_image *_gldTraceTexImage(
+	GLcontext *ctx,
+	GLenum target,
+	GLint level)
+{
+	if (!ctx || (level < 0) || (level >= MAX_TEXTURE_LEVELS))
+		return NULL;
+	return _mesa_select_tex_image(ctx, &ctx->Texture.Unit[ctx->Texture.CurrentUnit], target, level);
+}
+
+static GLuint _gldTraceTexImageSize(
+	GLenum target,
+	GLint level,
+	GLenum format,
+	GLenum type,
+	const void *pixels)
+{
+	GET_CURRENT_CONTEXT(ctx);
+	struct gl_texture_image *texImage = _gldTraceTexImage(ctx, target, level);
+
+	if (!texImage)
+		return 0;
+	return _gldTraceImageSize(pixels, texImage->Width, texImage->Height, texImage->Depth, format, type, GL_TRUE);
+}
+
+static GLuint _gldTraceCompressedImageSize(
+	GLenum target,
+	GLint level)
+{
+	GET_CURRENT_CONTEXT(ctx);
+	struct gl_texture_image *texImage = _gldTraceTexImage(ctx, target, level);
+
+	return (texImage && texImage->IsCompressed) ? texImage->CompressedSize : 0;
+}
+
+// ***********************************************************************
+// Vertex arrays
+// ***********************************************************************
+
+static BOOL _gldTraceIsClientArray(
+	const struct gl_client_array *pArray)
+{
+	return pArray->Enabled && pArray->Ptr && !pArray->BufferObj->Name;
+}
+
+static BOOL _gldTraceAnyClientArray(
+	const struct gl_array_attrib *pAttrib)
+{
+	GLuint i;
+
+	if (_gldTraceIsClientArray(&pAttrib->Vertex) || _gldTraceIsClientArray(&pAttrib->Normal) ||
+		_gldTraceIsClientArray(&pAttrib->Color) || _gldTraceIsClientArray(&pAttrib->SecondaryColor) ||
+		_gldTraceIsClientArray(&pAttrib->FogCoord) || _gldTraceIsClientArray(&pAttrib->Index) ||
+		_gldTraceIsClientArray(&pAttrib->EdgeFlag))
+	{
+		return TRUE;
+	}
+	for (i=0; i<MAX_TEXTURE_COORD_UNITS; i++) {
+		if (_gldTraceIsClientArray(&pAttrib->TexCoord[i]))
+			return TRUE;
+	}
+	for (i=0; i<VERT_ATTRIB_MAX; i++) {
+		if (_gldTraceIsClientArray(&pAttrib->VertexAttrib[i]))
+			return TRUE;
+	}
+	return FALSE;
+}
+
+static void _gldTraceClientArray(
+	DWORD dwOp,
+	const struct gl_client_array *pArray,
+	GLuint index,
+	GLint iMin,
+	GLint iMax)
+{
+	//
+	// Re-sends the pointer call for one client array with the elements
+	// iMin to iMax as a blob.
+	//
+
+	GLuint	dwElement;
+
+	if (!_gldTraceIsClientArray(pArray))
+		return;
+
+	_gldTraceBeginOp(dwOp);
+	switch (dwOp) {
+	case _gloffset_NormalPointer:
+		dwElement = 3 * _gldTraceTypeSize(pArray->Type);
+		_gldTraceU32(pArray->Type);
+		_gldTraceS32(pArray->Stride);
+		break;
+	case _gloffset_IndexPointer:
+	case _gloffset_FogCoordPointerEXT:
+		dwElement = _gldTraceTypeSize(pArray->Type);
+		_gldTraceU32(pArray->Type);
+		_gldTraceS32(pArray->Stride);
+		break;
+	case _gloffset_EdgeFlagPointer:
+		dwElement = sizeof(GLboolean);
+		_gldTraceS32(pArray->Stride);
+		break;
+	case _gloffset_VertexAttribPointerARB:
+		dwElement = pArray->Size * _gldTraceTypeSize(pArray->Type);
+		_gldTraceU32(index);
+		_gldTraceS32(pArray->Size);
+		_gldTraceU32(pArray->Type);
+		_gldTraceU32(pArray->Normalized);
+		_gldTraceS32(pArray->Stride);
+		break;
+	default:
+		dwElement = pArray->Size * _gldTraceTypeSize(pArray->Type);
+		_gldTraceS32(pArray->Size);
+		_gldTraceU32(pArray->Type);
+		_gldTraceS32(pArray->Stride);
+		break;
+	}
+	_gldTraceRebased(pArray->Ptr + iMin * pArray->StrideB,
+		(iMax - iMin) * pArray->StrideB + dwElement,
+		iMin * pArray->StrideB);
+	_gldTraceEndOp();
+}
+
+static void _gldTraceClientArrays(
+	GLint iMin,
+	GLint iMax)
+{
+	//
+	// Sends the client arrays a draw call is about to read. They go out
+	// with no array buffer bound so the replayer's pointers are not taken
+	// as offsets.
+	//
+
+	GET_CURRENT_CONTEXT(ctx);
+	struct gl_array_attrib	*pAttrib;
+	GLuint					i;
+
+	if (!ctx || (iMin < 0) || (iMax < iMin))
+		return;
+	pAttrib = &ctx->Array;
+	if (!_gldTraceAnyClientArray(pAttrib))
+		return;
+
+	if (pAttrib->ArrayBufferObj->Name) {
+		_gldTraceBeginOp(_gloffset_BindBufferARB);
+		_gldTraceU32(GL_ARRAY_BUFFER_ARB);
+		_gldTraceU32(0);
+		_gldTraceEndOp();
+	}
+
+	_gldTraceClientArray(_gloffset_VertexPointer, &pAttrib->Vertex, 0, iMin, iMax);
+	_gldTraceClientArray(_gloffset_NormalPointer, &pAttrib->Normal, 0, iMin, iMax);
+	_gldTraceClientArray(_gloffset_ColorPointer, &pAttrib->Color, 0, iMin, iMax);
+	_gldTraceClientArray(_gloffset_SecondaryColorPointerEXT, &pAttrib->SecondaryColor, 0, iMin, iMax);
+	_gldTraceClientArray(_gloffset_FogCoordPointerEXT, &pAttrib->FogCoord, 0, iMin, iMax);
+	_gldTraceClientArray(_gloffset_IndexPointer, &pAttrib->Index, 0, iMin, iMax);
+	_gldTraceClientArray(_gloffset_EdgeFlagPointer, &pAttrib->EdgeFlag, 0, iMin, iMax);
+
+	for (i=0; i<MAX_TEXTURE_COORD_UNITS; i++) {
+		if (!_gldTraceIsClientArray(&pAttrib->TexCoord[i]))
+			continue;
+		if (i != (GLuint)pAttrib->ActiveTexture) {
+			_gldTraceBeginOp(_gloffset_ClientActiveTextureARB);
+			_gldTraceU32(GL_TEXTURE0_ARB + i);
+			_gldTraceEndOp();
+		}
+		_gldTraceClientArray(_gloffset_TexCoordPointer, &pAttrib->TexCoord[i], 0, iMin, iMax);
+		if (i != (GLuint)pAttrib->ActiveTexture) {
+			_gldTraceBeginOp(_gloffset_ClientActiveTextureARB);
+			_gldTraceU32(GL_TEXTURE0_ARB + pAttrib->ActiveTexture);
+			_gldTraceEndOp();
+		}
+	}
+
+	for (i=0; i<VERT_ATTRIB_MAX; i++)
+		_gldTraceClientArray(_gloffset_VertexAttribPointerARB, &pAttrib->VertexAttrib[i], i, iMin, iMax);
+
+	if (pAttrib->ArrayBufferObj->Name) {
+		_gldTraceBeginOp(_gloffset_BindBufferARB);
+		_gldTraceU32(GL_ARRAY_BUFFER_ARB);
+		_gldTraceU32(pAttrib->ArrayBufferObj->Name);
+		_gldTraceEndOp();
+	}
+}
+
+static void _gldTraceDrawElements(
+	GLsizei count,
+	GLenum type,
+	const GLvoid *indices)
+{
+	// Finds the range of elements the indices refer to
+	GET_CURRENT_CONTEXT(ctx);
+	const GLubyte	*pIndices = (const GLubyte*)indices;
+	GLuint			iMin = ~0u, iMax = 0, n;
+	GLsizei			i;
+
+	if (!ctx || (count <= 0) || !_gldTraceAnyClientArray(&ctx->Array))
+		return;
+	if (ctx->Array.ElementArrayBufferObj->Name) {
+		if (!ctx->Array.ElementArrayBufferObj->Data)
+			return;
+		pIndices = ctx->Array.ElementArrayBufferObj->Data + (size_t)indices;
+	}
+	if (!pIndices)
+		return;
+
+	for (i=0; i<count; i++) {
+		switch (type) {
+		case GL_UNSIGNED_BYTE:	n = pIndices[i];					break;
+		case GL_UNSIGNED_SHORT:	n = ((const GLushort*)pIndices)[i];	break;
+		case GL_UNSIGNED_INT:	n = ((const GLuint*)pIndices)[i];	break;
+		default:				return;
+		}
+		if (n < iMin)
+			iMin = n;
+		if (n > iMax)
+			iMax = n;
+	}
+	_gldTraceClientArrays(iMin, iMax);
+}
+
+static void _gldTraceMultiDrawArrays(
+	GLenum mode,
+	GLint *first,
+	GLsizei *count,
+	GLsizei primcount)
+{
+	// Sent as the glDrawArrays calls it stands for
+	GLsizei i;
+
+	for (i=0; i<primcount; i++) {
+		if (count[i] <= 0)
+			continue;
+		_gldTraceClientArrays(first[i], first[i] + count[i] - 1);
+		_gldTraceBeginOp(_gloffset_DrawArrays);
+		_gldTraceU32(mode);
+		_gldTraceS32(first[i]);
+		_gldTraceS32(count[i]);
+		_gldTraceEndOp();
+	}
+}
+
+static void _gldTraceMultiDrawElements(
+	GLenum mode,
+	const GLsizei *count,
+	GLenum type,
+	const GLvoid **indices,
+	GLsizei primcount)
+{
+	GLsizei i;
+
+	for (i=0; i<primcount; i++) {
+		if (count[i] <= 0)
+			continue;
+		_gldTraceDrawElements(count[i], type, indices[i]);
+		_gldTraceBeginOp(_gloffset_DrawElements);
+		_gldTraceU32(mode);
+		_gldTraceS32(count[i]);
+		_gldTraceU32(type);
+		_gldTraceElements(indices[i], count[i] * _gldTraceTypeSize(type));
+		_gldTraceEndOp();
+	}
+}
+
+// ***********************************************************************
+// Mapped buffer objects
+// ***********************************************************************
+
+static struct gl_buffer_object *_gldTraceBufferObject(
+	GLenum target)
+{
+	GET_CURRENT_CONTEXT(ctx);
+
+	if (!ctx)
+		return NULL;
+	if (target == GL_ARRAY_BUFFER_ARB)
+		return ctx->Array.ArrayBufferObj;
+	if (target == GL_ELEMENT_ARRAY_BUFFER_ARB)
+		return ctx->Array.ElementArrayBufferObj;
+	return NULL;
+}
+
+static GLboolean _gldTraceMappedForWrite(
+	GLenum target)
+{
+	struct gl_buffer_object *bufObj = _gldTraceBufferObject(target);
+
+	return bufObj && bufObj->Name && bufObj->Pointer && (bufObj->Access != GL_READ_ONLY_ARB);
+}
+
+static void _gldTraceBufferContents(
+	GLenum target)
+{
+	//
+	// Writes through a mapping are not seen by the dispatch layer, so
+	// the buffer is sent whole once it is unmapped.
+	//
+
+	struct gl_buffer_object *bufObj = _gldTraceBufferObject(target);
+
+	if (!bufObj || !bufObj->Data || !bufObj->Size)
+		return;
+	_gldTraceBeginOp(_gloffset_BufferSubDataARB);
+	_gldTraceU32(target);
+	_gldTraceS64(0);
+	_gldTraceS64(bufObj->Size);
+	_gldTraceIn(bufObj->Data, bufObj->Size);
+	_gldTraceEndOp();
+}
+
+// ***********************************************************************
+
+#define GLD_TRACE_CAPTURE
+#include "gld_trace_tmp.h"
+
+// ***********************************************************************
+
+void gldBeginTrace(
+	DWORD dwWidth,
+	DWORD dwHeight)
+{
+	//
+	// Starts capture the first time a context is made current, if the
+	// trace is enabled in gldirect.ini. Calls are recorded from the
+	// thread that did so; the trace runs until the process exits.
+	//
+
+	DWORD	dwHeader[2];
+	GLuint	nSlots;
+
+	if (!glb.szTraceFile[0] || gldTrace.bStarted)
+		return;
+	gldTrace.bStarted = TRUE;
+
+	nSlots					= _glapi_get_dispatch_table_size();
+	gldTrace.pTable			= (struct _glapi_table*)MALLOC(nSlots * sizeof(void*));
+	gldTrace.pBlobs			= (GLD_traceBlob*)CALLOC(GLD_TRACE_BLOB_SLOTS * sizeof(GLD_traceBlob));
+	gldTrace.pBlock			= (BYTE*)MALLOC(GLD_TRACE_BLOCK_SIZE + GLD_TRACE_MAX_ARGS);
+	gldTrace.dwBlockSize	= GLD_TRACE_BLOCK_SIZE + GLD_TRACE_MAX_ARGS;
+	if (!gldTrace.pTable || !gldTrace.pBlobs || !gldTrace.pBlock) {
+		gldLogMessage(GLDLOG_WARN, "Trace: out of memory\n");
+		return;
+	}
+
+	gldTrace.fp = fopen(glb.szTraceFile, "wb");
+	if (!gldTrace.fp) {
+		gldLogPrintf(GLDLOG_WARN, "Trace: unable to open %s", glb.szTraceFile);
+		return;
+	}
+	dwHeader[0] = GLD_TRACE_VERSION;
+	dwHeader[1] = GLD_TRACE_SLOTS;
+	fwrite(GLD_TRACE_MAGIC, 8, 1, gldTrace.fp);
+	fwrite(dwHeader, sizeof(dwHeader), 1, gldTrace.fp);
+	gldTrace.qwFileBytes = GLD_TRACE_HEADER_SIZE;
+
+	// Entry points added at runtime go straight through
+	memcpy(gldTrace.pTable, _glapi_get_dispatch(), nSlots * sizeof(void*));
+	_gldTraceInitTable(gldTrace.pTable);
+
+	gldTrace.bActive	= TRUE;
+	gldTrace.dwWidth	= dwWidth;
+	gldTrace.dwHeight	= dwHeight;
+	_gldTraceSpecialOp(GLD_TRACE_OP_RESIZE, dwWidth, dwHeight, 2);
+
+	_glapi_begin_dispatch_override(gldTrace.pTable);
+	gldLogPrintf(GLDLOG_SYSTEM, "Trace: writing GL calls to %s", glb.szTraceFile);
+}
+
+// ***********************************************************************
+
+void gldTraceEndFrame(
+	DWORD dwWidth,
+	DWORD dwHeight)
+{
+	if (!gldTrace.bActive)
+		return;
+
+	_gldTraceSpecialOp(GLD_TRACE_OP_FRAME, 0, 0, 0);
+	gldTrace.dwFrames++;
+	if ((dwWidth != gldTrace.dwWidth) || (dwHeight != gldTrace.dwHeight)) {
+		gldTrace.dwWidth	= dwWidth;
+		gldTrace.dwHeight	= dwHeight;
+		_gldTraceSpecialOp(GLD_TRACE_OP_RESIZE, dwWidth, dwHeight, 2);
+	}
+	if (gldTrace.dwBlockUsed >= GLD_TRACE_BLOCK_SIZE)
+		_gldTraceFlushBlock();
+}
+
+// ***********************************************************************
+
+void gldEndTrace(void)
+{
+	//
+	// Closes the trace file. The override table is left in place, with
+	// nothing more written, in case GL is called after this.
+	//
+
+	if (!gldTrace.fp)
+		return;
+
+	if (gldTrace.bActive)
+		_gldTraceSpecialOp(GLD_TRACE_OP_END, 0, 0, 0);
+	_gldTraceFlushBlock();
+	gldTrace.bActive = FALSE;
+	fclose(gldTrace.fp);
+	gldTrace.fp = NULL;
+
+	gldLogPrintf(GLDLOG_SYSTEM, "Trace: %u frames, %I64u calls (%I64u unsupported), %I64u bytes written",
+		gldTrace.dwFrames, gldTrace.qwCalls, gldTrace.qwUnsupported, gldTrace.qwFileBytes);
+	gldLogPrintf(GLDLOG_SYSTEM, "Trace: %I64u bytes of blobs sent, %I64u bytes deduplicated",
+		gldTrace.qwBlobBytes, gldTrace.qwDedupBytes);
+
+	if (gldTrace.pBlobs) {
+		FREE(gldTrace.pBlobs);
+		gldTrace.pBlobs = NULL;
+	}
+	if (gldTrace.pBlock) {
+		FREE(gldTrace.pBlock);
+		gldTrace.pBlock = NULL;
+	}
+}
+
+// ***********************************************************************
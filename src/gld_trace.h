@@ -0,0 +1,133 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  GL call trace file format, shared by the capture layer and
+*               the gldreplay tool.
+*
+*********************************************************************************/
+
+#ifndef __GLD_TRACE_H
+#define __GLD_TRACE_H
+
+#include <string.h>
+
+/*---------------------- Macros and type definitions ----------------------*/
+
+//
+// A trace file is a 16 byte header followed by blocks:
+//
+//   header:  "GLDTRACE", DWORD version, DWORD number of dispatch slots
+//   block:   DWORD magic, DWORD payload bytes, DWORD payload checksum,
+//            payload
+//
+// Blocks only ever end between ops, so a trace cut short by a crash
+// replays up to its last whole block. The concatenated payloads are a
+// stream of ops, each a varint opcode followed by its arguments. Opcodes
+// below the slot count are GL calls, numbered by their _glapi_table
+// offset; the rest are the GLD_TRACE_OP_ codes below.
+//
+// Call arguments are varints for integers (zigzag for signed types),
+// raw little-endian bytes for floats and doubles, and a tagged form for
+// pointers (GLD_TRACE_PTR_). Data of more than GLD_TRACE_INLINE_MAX
+// bytes is sent once as a blob and referred to by id after that.
+//
+
+#define GLD_TRACE_MAGIC			"GLDTRACE"
+#define GLD_TRACE_VERSION		1
+#define GLD_TRACE_BLOCK_MAGIC	0x4B4C4247		// "GBLK"
+#define GLD_TRACE_HEADER_SIZE	16
+#define GLD_TRACE_BLOCK_HEADER	12
+
+#define GLD_TRACE_INLINE_MAX	64				// Larger data goes in blobs
+
+// Ops other than GL calls
+#define GLD_TRACE_OP_FRAME		1024			// SwapBuffers
+#define GLD_TRACE_OP_RESIZE		1025			// varint width, height
+#define GLD_TRACE_OP_BLOB		1026			// varint id, size; data
+#define GLD_TRACE_OP_BLOB_RESET	1027			// All blob ids are released
+#define GLD_TRACE_OP_END		1028			// Trace closed normally
+
+// Pointer argument tags
+#define GLD_TRACE_PTR_NULL		0
+#define GLD_TRACE_PTR_INLINE	1				// varint size; data
+#define GLD_TRACE_PTR_BLOB		2				// varint blob id
+#define GLD_TRACE_PTR_OFFSET	3				// varint buffer object offset
+#define GLD_TRACE_PTR_REBASED	4				// varint blob id, bytes before it
+#define GLD_TRACE_PTR_OUTPUT	5				// varint size of scratch buffer
+#define GLD_TRACE_PTR_UNSIZED	6				// Output of unknown size; skip call
+#define GLD_TRACE_PTR_PERSIST	7				// varint size of lasting buffer
+
+//---------------------------------------------------------------------------
+
+static __inline unsigned __int64 gldTraceHash(
+	const void *pData,
+	unsigned int dwSize)
+{
+	//
+	// 64 bit hash of a blob or block, eight bytes a step. Not
+	// cryptographic; blobs are told apart by hash and size alone.
+	//
+
+	const unsigned char	*p		= (const unsigned char*)pData;
+	unsigned __int64	h		= 0x9E3779B97F4A7C15 ^ dwSize;
+	unsigned __int64	w;
+	unsigned int		i;
+
+	for (i=0; i+8<=dwSize; i+=8) {
+		memcpy(&w, p + i, 8);
+		h = (h ^ w) * 0xFF51AFD7ED558CCD;
+		h ^= h >> 32;
+	}
+	for (; i<dwSize; i++)
+		h = (h ^ p[i]) * 0x100000001B3;
+	h ^= h >> 29;
+	h *= 0xC4CEB9FE1A85EC53;
+	h ^= h >> 32;
+	return h;
+}
+
+/*------------------------- Function Prototypes ---------------------------*/
+
+#ifndef GLD_TRACE_REPLAY
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+void	gldBeginTrace(DWORD dwWidth, DWORD dwHeight);
+void	gldEndTrace(void);
+void	gldTraceEndFrame(DWORD dwWidth, DWORD dwHeight);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif // GLD_TRACE_REPLAY
+
+#endif
@@ -0,0 +1,323 @@
+#!/usr/bin/env python
+
+# Generates gld_trace_tmp.h, the per-entry point capture and replay code
+# for the GL call trace, from Mesa's dispatch table.
+#
+# Usage: python gld_trace.py ../mesa/src/mesa/glapi/glapitable.h > gld_trace_tmp.h
+#
+# Every slot of struct _glapi_table gets a capture function that encodes
+# its arguments and forwards to the real dispatch table, and a replay
+# function that decodes them again and calls the backend. Scalars are
+# encoded by type. Pointers need to know how many bytes they address, so
+# every pointer parameter is sized by one of the rules below; a const
+# pointer with no rule makes the whole call unsupported, which is
+# recorded without arguments and skipped on replay.
+
+import re
+import sys
+
+# Scalar types and the encoder used for each
+SCALARS = {
+	'GLenum':			'U32',
+	'GLuint':			'U32',
+	'GLbitfield':		'U32',
+	'GLushort':			'U32',
+	'GLubyte':			'U32',
+	'GLboolean':		'U32',
+	'GLint':			'S32',
+	'GLsizei':			'S32',
+	'GLshort':			'S32',
+	'GLbyte':			'S32',
+	'GLfloat':			'F32',
+	'GLclampf':			'F32',
+	'GLdouble':			'F64',
+	'GLclampd':			'F64',
+	'GLintptrARB':		'S64',
+	'GLsizeiptrARB':	'S64',
+}
+
+# Vertex array pointers: an offset when a buffer object is bound, else
+# re-sent from the array state at each draw
+ARRAY_POINTERS = [
+	'ColorPointer', 'EdgeFlagPointer', 'IndexPointer', 'NormalPointer',
+	'TexCoordPointer', 'VertexPointer', 'InterleavedArrays',
+	'ColorPointerEXT', 'EdgeFlagPointerEXT', 'IndexPointerEXT',
+	'NormalPointerEXT', 'TexCoordPointerEXT', 'VertexPointerEXT',
+	'SecondaryColorPointerEXT', 'FogCoordPointerEXT',
+	'VertexWeightPointerEXT', 'VertexAttribPointerNV',
+	'VertexAttribPointerARB',
+]
+
+# Statements run before a call is encoded
+PRE_HOOKS = {
+	'DrawArrays':			'_gldTraceClientArrays(first, first + count - 1);',
+	'DrawElements':			'_gldTraceDrawElements(count, type, indices);',
+	'DrawRangeElements':	'_gldTraceClientArrays(start, end);',
+}
+
+# Calls that are written out by hand in gld_trace.c
+CUSTOM = {
+	'MultiDrawArraysEXT':	'_gldTraceMultiDrawArrays(mode, first, count, primcount);',
+	'MultiDrawElementsEXT':	'_gldTraceMultiDrawElements(mode, count, type, indices, primcount);',
+}
+
+# Calls recorded as the calls they make back into the dispatch table;
+# glArrayElement becomes the immediate mode calls for one vertex
+PASSTHROUGH = ['ArrayElement']
+
+# Buffers written back after a call returns
+POST_HOOKS = {
+	'UnmapBufferARB':	('GLboolean bWrite = GL_FALSE;',
+						 'bWrite = _gldTraceMappedForWrite(target);',
+						 'if (bWrite) _gldTraceBufferContents(target);'),
+}
+
+def image(ptr, w, h, d, fmt, typ, pack):
+	return '_gldTraceImageSize(%s, %s, %s, %s, %s, %s, %s)' % (ptr, w, h, d, fmt, typ, pack)
+
+PCOUNT = '_gldTraceParamCount(pname) * sizeof(%s)'
+
+# Byte counts of pointer parameters, by function and parameter. %s is
+# replaced by the pointed-to type.
+SIZES = {
+	'CallLists':				{'lists': '_gldTraceCallListsSize(n, type)'},
+	'Bitmap':					{'bitmap': image('bitmap', 'width', 'height', '1', 'GL_COLOR_INDEX', 'GL_BITMAP', '0')},
+	'PolygonStipple':			{'mask': image('mask', '32', '32', '1', 'GL_COLOR_INDEX', 'GL_BITMAP', '0')},
+	'GetPolygonStipple':		{'mask': image('mask', '32', '32', '1', 'GL_COLOR_INDEX', 'GL_BITMAP', '1')},
+	'TexImage1D':				{'pixels': image('pixels', 'width', '1', '1', 'format', 'type', '0')},
+	'TexImage2D':				{'pixels': image('pixels', 'width', 'height', '1', 'format', 'type', '0')},
+	'TexImage3D':				{'pixels': image('pixels', 'width', 'height', 'depth', 'format', 'type', '0')},
+	'TexSubImage1D':			{'pixels': image('pixels', 'width', '1', '1', 'format', 'type', '0')},
+	'TexSubImage2D':			{'pixels': image('pixels', 'width', 'height', '1', 'format', 'type', '0')},
+	'TexSubImage3D':			{'pixels': image('pixels', 'width', 'height', 'depth', 'format', 'type', '0')},
+	'DrawPixels':				{'pixels': image('pixels', 'width', 'height', '1', 'format', 'type', '0')},
+	'ReadPixels':				{'pixels': image('pixels', 'width', 'height', '1', 'format', 'type', '1')},
+	'ColorTable':				{'table': image('table', 'width', '1', '1', 'format', 'type', '0')},
+	'ColorSubTable':			{'data': image('data', 'count', '1', '1', 'format', 'type', '0')},
+	'ConvolutionFilter1D':		{'image': image('image', 'width', '1', '1', 'format', 'type', '0')},
+	'ConvolutionFilter2D':		{'image': image('image', 'width', 'height', '1', 'format', 'type', '0')},
+	'SeparableFilter2D':		{'row': image('row', 'width', '1', '1', 'format', 'type', '0'),
+								 'column': image('column', 'height', '1', '1', 'format', 'type', '0')},
+	'GetTexImage':				{'pixels': '_gldTraceTexImageSize(target, level, format, type, pixels)'},
+	'GetCompressedTexImageARB':	{'img': '_gldTraceCompressedImageSize(target, level)'},
+	'CompressedTexImage1DARB':	{'data': 'imageSize'},
+	'CompressedTexImage2DARB':	{'data': 'imageSize'},
+	'CompressedTexImage3DARB':	{'data': 'imageSize'},
+	'CompressedTexSubImage1DARB':	{'data': 'imageSize'},
+	'CompressedTexSubImage2DARB':	{'data': 'imageSize'},
+	'CompressedTexSubImage3DARB':	{'data': 'imageSize'},
+	'ClipPlane':				{'equation': '4 * sizeof(%s)'},
+	'ReferencePlaneSGIX':		{'equation': '4 * sizeof(%s)'},
+	'Rectdv':					{'v1': '2 * sizeof(%s)', 'v2': '2 * sizeof(%s)'},
+	'Rectfv':					{'v1': '2 * sizeof(%s)', 'v2': '2 * sizeof(%s)'},
+	'Rectiv':					{'v1': '2 * sizeof(%s)', 'v2': '2 * sizeof(%s)'},
+	'Rectsv':					{'v1': '2 * sizeof(%s)', 'v2': '2 * sizeof(%s)'},
+	'Map1d':					{'points': '_gldTraceMapSize(target, stride, order, 0, 0) * sizeof(%s)'},
+	'Map1f':					{'points': '_gldTraceMapSize(target, stride, order, 0, 0) * sizeof(%s)'},
+	'Map2d':					{'points': '_gldTraceMapSize(target, ustride, uorder, vstride, vorder) * sizeof(%s)'},
+	'Map2f':					{'points': '_gldTraceMapSize(target, ustride, uorder, vstride, vorder) * sizeof(%s)'},
+	'PixelMapfv':				{'values': 'mapsize * sizeof(%s)'},
+	'PixelMapuiv':				{'values': 'mapsize * sizeof(%s)'},
+	'PixelMapusv':				{'values': 'mapsize * sizeof(%s)'},
+	'GetPixelMapfv':			{'values': 'MAX_PIXEL_MAP_TABLE * sizeof(%s)'},
+	'GetPixelMapuiv':			{'values': 'MAX_PIXEL_MAP_TABLE * sizeof(%s)'},
+	'GetPixelMapusv':			{'values': 'MAX_PIXEL_MAP_TABLE * sizeof(%s)'},
+	'DrawElements':				{'indices': 'count * _gldTraceTypeSize(type)'},
+	'DrawRangeElements':		{'indices': 'count * _gldTraceTypeSize(type)'},
+	'PrioritizeTextures':		{'textures': 'n * sizeof(%s)', 'priorities': 'n * sizeof(%s)'},
+	'TexFilterFuncSGIS':		{'weights': 'n * sizeof(%s)'},
+	'DetailTexFuncSGIS':		{'points': 'n * 2 * sizeof(%s)'},
+	'SharpenTexFuncSGIS':		{'points': 'n * 2 * sizeof(%s)'},
+	'ExecuteProgramNV':			{'params': '4 * sizeof(%s)'},
+	'LoadProgramNV':			{'program': 'len'},
+	'ProgramStringARB':			{'string': 'len'},
+	'ProgramNamedParameter4fNV':	{'name': 'len'},
+	'ProgramNamedParameter4dNV':	{'name': 'len'},
+	'GetProgramNamedParameterfvNV':	{'name': 'len'},
+	'GetProgramNamedParameterdvNV':	{'name': 'len'},
+	'ProgramParameters4dvNV':	{'params': 'num * 4 * sizeof(%s)'},
+	'ProgramParameters4fvNV':	{'params': 'num * 4 * sizeof(%s)'},
+	'BufferDataARB':			{'data': 'size'},
+	'BufferSubDataARB':			{'data': 'size'},
+	'GetBufferSubDataARB':		{'data': 'size'},
+	'FeedbackBuffer':			{'buffer': 'size * sizeof(%s)'},
+	'SelectBuffer':				{'buffer': 'size * sizeof(%s)'},
+	'InstrumentsBufferSGIX':	{'buffer': 'size * sizeof(%s)'},
+	'PollInstrumentsSGIX':		{'marker_p': '1 * sizeof(%s)'},
+	'CullParameterdvEXT':		{'params': '4 * sizeof(%s)'},
+	'CullParameterfvEXT':		{'params': '4 * sizeof(%s)'},
+}
+
+# Inputs the table declares without const
+INPUTS = [('CullParameterdvEXT', 'params'), ('CullParameterfvEXT', 'params')]
+
+# Outputs the GL keeps writing to after the call returns
+PERSISTENT = [('FeedbackBuffer', 'buffer'), ('SelectBuffer', 'buffer'), ('InstrumentsBufferSGIX', 'buffer')]
+
+# Parameters named like these hold the element count of the other
+# pointer parameters of the call
+COUNT_NAMES = ['n']
+
+VECTOR = re.compile(r'^\w*?([1-4])N?(b|s|i|f|d|ub|us|ui)v(ARB|EXT|NV|MESA|ATI|SGIS|SGIX)?$')
+PLURAL = re.compile(r'^VertexAttribs([1-4])')
+PARAMS = re.compile(r'(Fog|Light|LightModel|Material|TexParameter|TexEnv|TexGen|ColorTableParameter|'
+					r'ConvolutionParameter|PixelTexGenParameter|SpriteParameter|PointParameter|'
+					r'ListParameter|FragmentLight|FragmentLightModel|FragmentMaterial|CombinerParameter)'
+					r'[dfi]v')
+
+class Param:
+	def __init__(self, text):
+		m = re.match(r'^(.*?)\s*(\w+)$', text.strip())
+		self.type = m.group(1).strip()
+		self.name = m.group(2)
+		self.pointer = '*' in self.type
+		self.const = self.type.startswith('const')
+		base = self.type.replace('const', '').replace('*', '').strip()
+		# The pointed-to type; void data is sized in bytes
+		if self.type.count('*') > 1:
+			self.target = 'GLvoid *'
+		elif base in ('GLvoid', 'void'):
+			self.target = 'GLubyte'
+		else:
+			self.target = base
+
+def size_of(func, p, params):
+	# Returns the C byte count of the data p addresses, or None
+	if func in SIZES and p.name in SIZES[func]:
+		expr = SIZES[func][p.name]
+		return expr % p.target if '%s' in expr else expr
+	m = PLURAL.match(func)
+	if m:
+		return 'n * %s * sizeof(%s)' % (m.group(1), p.target)
+	m = VECTOR.match(func)
+	if m:
+		return '%s * sizeof(%s)' % (m.group(1), p.target)
+	if PARAMS.match(func) and any(q.name == 'pname' for q in params):
+		return PCOUNT % p.target
+	if func.startswith('Index') or func in ('EdgeFlagv', 'FogCoordfvEXT', 'FogCoorddvEXT', 'VertexWeightfvEXT'):
+		return '1 * sizeof(%s)' % p.target
+	if re.search(r'(Load|Mult)(Transpose)?Matrix', func):
+		return '16 * sizeof(%s)' % p.target
+	if any(q.name in COUNT_NAMES for q in params) and p.target != 'GLubyte':
+		return 'n * sizeof(%s)' % p.target
+	if not p.const and func.startswith('Get') and p.target != 'GLubyte':
+		# State queries return at most a matrix
+		return '16 * sizeof(%s)' % p.target
+	return None
+
+def encode(func, params):
+	# Returns (statements, supported) to encode the arguments of func
+	lines = []
+	for p in params:
+		if not p.pointer:
+			lines.append('_gldTrace%s(%s);' % (SCALARS[p.type], p.name))
+		elif func in ARRAY_POINTERS and p.const:
+			lines.append('_gldTraceArrayPointer(%s);' % p.name)
+		elif func in ('DrawElements', 'DrawRangeElements') and p.name == 'indices':
+			lines.append('_gldTraceElements(%s, %s);' % (p.name, size_of(func, p, params)))
+		elif (func, p.name) in PERSISTENT:
+			lines.append('_gldTracePersistent(%s, %s);' % (p.name, size_of(func, p, params)))
+		else:
+			size = size_of(func, p, params)
+			if p.const or (func, p.name) in INPUTS:
+				if size is None:
+					return ([], False)
+				lines.append('_gldTraceIn(%s, %s);' % (p.name, size))
+			else:
+				lines.append('_gldTraceOut(%s, %s);' % (p.name, size or '0'))
+	return (lines, True)
+
+def decode(p):
+	if not p.pointer:
+		return '(%s) _gldReplay%s(pReplay)' % (p.type, SCALARS[p.type])
+	return '(%s) _gldReplayPtr(pReplay)' % p.type
+
+def main():
+	src = open(sys.argv[1]).read()
+	rx = re.compile(r'^\s*(.+?)\s*\(GLAPIENTRYP (\w+)\)\((.*)\); /\* (\d+) \*/', re.M)
+	funcs = []
+	for ret, name, params, offset in rx.findall(src):
+		plist = [] if params.strip() == 'void' else [Param(t) for t in params.split(',')]
+		funcs.append((ret, name, plist, int(offset)))
+	funcs.sort(key=lambda f: f[3])
+
+	out = sys.stdout.write
+	out('/* DO NOT EDIT!  This file is generated by the gld_trace.py script. */\n\n')
+	out('/*\n')
+	out(' * Capture and replay functions for every GL dispatch slot. Include with\n')
+	out(' * GLD_TRACE_CAPTURE defined to get _gldTraceInitTable(), or with\n')
+	out(' * GLD_TRACE_REPLAY defined to get _gldReplayFuncs[] and _gldTraceNames[].\n')
+	out(' */\n\n')
+	out('#define GLD_TRACE_SLOTS %d\n\n' % len(funcs))
+
+	out('#ifdef GLD_TRACE_CAPTURE\n\n')
+	for ret, name, params, offset in funcs:
+		args = ', '.join(p.name for p in params)
+		decl = ', '.join('%s %s' % (p.type, p.name) if not p.type.endswith('*') else '%s%s' % (p.type, p.name) for p in params) or 'void'
+		out('static %s GLAPIENTRY _gldTrace_%s(%s)\n{\n' % (ret, name, decl))
+		if name in PASSTHROUGH:
+			out('   %s_GLD_TRACE_REAL->%s(%s);\n}\n\n' % ('return ' if ret != 'void' else '', name, ', '.join(p.name for p in params)))
+			continue
+		if ret != 'void':
+			out('   %s ret;\n' % ret)
+		hook = POST_HOOKS.get(name)
+		if hook:
+			out('   %s\n' % hook[0])
+		out('   GLboolean bTrace = _gldTraceEnter();\n')
+		out('   if (bTrace) {\n')
+		if hook:
+			out('      %s\n' % hook[1])
+		if name in CUSTOM:
+			out('      %s\n' % CUSTOM[name])
+		else:
+			if name in PRE_HOOKS:
+				out('      %s\n' % PRE_HOOKS[name])
+			lines, supported = encode(name, params)
+			out('      _gldTraceBeginOp(_gloffset_%s);\n' % name)
+			if not supported:
+				out('      _gldTraceUnsupported();\n')
+			for l in lines:
+				out('      %s\n' % l)
+			out('      _gldTraceEndOp();\n')
+		out('   }\n')
+		call = '_GLD_TRACE_REAL->%s(%s)' % (name, args)
+		out('   %s%s;\n' % ('ret = ' if ret != 'void' else '', call))
+		if hook:
+			out('   if (bTrace)\n      %s\n' % hook[2])
+		out('   _gldTraceExit();\n')
+		if ret != 'void':
+			out('   return ret;\n')
+		out('}\n\n')
+
+	out('static void _gldTraceInitTable(struct _glapi_table *t)\n{\n')
+	for ret, name, params, offset in funcs:
+		out('   t->%s = _gldTrace_%s;\n' % (name, name))
+	out('}\n\n')
+	out('#endif /* GLD_TRACE_CAPTURE */\n\n')
+
+	out('#ifdef GLD_TRACE_REPLAY\n\n')
+	for ret, name, params, offset in funcs:
+		out('static void _gldReplay_%s(GLD_replay *pReplay)\n{\n' % name)
+		if name in CUSTOM or not encode(name, params)[1]:
+			# Recorded without arguments
+			out('   pReplay->bSkip = GL_TRUE;\n}\n\n')
+			continue
+		for p in params:
+			out('   %s %s = %s;\n' % (p.type, p.name, decode(p)))
+		args = ', '.join(p.name for p in params)
+		out('   if (_GLD_REPLAY_OK(pReplay, %s))\n' % name)
+		out('      %spReplay->Table.%s(%s);\n' % ('(void) ' if ret != 'void' else '', name, args))
+		out('}\n\n')
+
+	out('static void (*const _gldReplayFuncs[GLD_TRACE_SLOTS])(GLD_replay *pReplay) = {\n')
+	for ret, name, params, offset in funcs:
+		out('   _gldReplay_%s,\n' % name)
+	out('};\n\n')
+	out('static const char *const _gldTraceNames[GLD_TRACE_SLOTS] = {\n')
+	for ret, name, params, offset in funcs:
+		out('   "gl%s",\n' % name)
+	out('};\n\n')
+	out('#endif /* GLD_TRACE_REPLAY */\n')
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,17977 @@
+/* DO NOT EDIT!  This file is generated by the gld_trace.py script. */
+
+/*
+ * Capture and replay functions for every GL dispatch slot. Include with
+ * GLD_TRACE_CAPTURE defined to get _gldTraceInitTable(), or with
+ * GLD_TRACE_REPLAY defined to get _gldReplayFuncs[] and _gldTraceNames[].
+ */
+
+#define GLD_TRACE_SLOTS 710
+
+#ifdef GLD_TRACE_CAPTURE
+
+static void GLAPIENTRY _gldTrace_NewList(GLuint list, GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_NewList);
+      _gldTraceU32(list);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->NewList(list, mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EndList(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EndList);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EndList();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CallList(GLuint list)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CallList);
+      _gldTraceU32(list);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CallList(list);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CallLists(GLsizei n, GLenum type, const GLvoid *lists)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CallLists);
+      _gldTraceS32(n);
+      _gldTraceU32(type);
+      _gldTraceIn(lists, _gldTraceCallListsSize(n, type));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CallLists(n, type, lists);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DeleteLists(GLuint list, GLsizei range)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DeleteLists);
+      _gldTraceU32(list);
+      _gldTraceS32(range);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DeleteLists(list, range);
+   _gldTraceExit();
+}
+
+static GLuint GLAPIENTRY _gldTrace_GenLists(GLsizei range)
+{
+   GLuint ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GenLists);
+      _gldTraceS32(range);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->GenLists(range);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_ListBase(GLuint base)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ListBase);
+      _gldTraceU32(base);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ListBase(base);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Begin(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Begin);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Begin(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Bitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Bitmap);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceF32(xorig);
+      _gldTraceF32(yorig);
+      _gldTraceF32(xmove);
+      _gldTraceF32(ymove);
+      _gldTraceIn(bitmap, _gldTraceImageSize(bitmap, width, height, 1, GL_COLOR_INDEX, GL_BITMAP, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Bitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3b(GLbyte red, GLbyte green, GLbyte blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3b);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3b(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3bv(const GLbyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3bv);
+      _gldTraceIn(v, 3 * sizeof(GLbyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3bv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3d(GLdouble red, GLdouble green, GLdouble blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3d);
+      _gldTraceF64(red);
+      _gldTraceF64(green);
+      _gldTraceF64(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3d(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3dv);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3f(GLfloat red, GLfloat green, GLfloat blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3f);
+      _gldTraceF32(red);
+      _gldTraceF32(green);
+      _gldTraceF32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3f(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3fv);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3i(GLint red, GLint green, GLint blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3i);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3i(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3iv);
+      _gldTraceIn(v, 3 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3s(GLshort red, GLshort green, GLshort blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3s);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3s(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3sv);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3ub(GLubyte red, GLubyte green, GLubyte blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3ub);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3ub(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3ubv(const GLubyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3ubv);
+      _gldTraceIn(v, 3 * sizeof(GLubyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3ubv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3ui(GLuint red, GLuint green, GLuint blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3ui);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3ui(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3uiv(const GLuint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3uiv);
+      _gldTraceIn(v, 3 * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3uiv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3us(GLushort red, GLushort green, GLushort blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3us);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3us(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color3usv(const GLushort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color3usv);
+      _gldTraceIn(v, 3 * sizeof(GLushort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color3usv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4b);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceS32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4b(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4bv(const GLbyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4bv);
+      _gldTraceIn(v, 4 * sizeof(GLbyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4bv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4d);
+      _gldTraceF64(red);
+      _gldTraceF64(green);
+      _gldTraceF64(blue);
+      _gldTraceF64(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4d(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4dv);
+      _gldTraceIn(v, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4f);
+      _gldTraceF32(red);
+      _gldTraceF32(green);
+      _gldTraceF32(blue);
+      _gldTraceF32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4f(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4fv);
+      _gldTraceIn(v, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4i(GLint red, GLint green, GLint blue, GLint alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4i);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceS32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4i(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4iv);
+      _gldTraceIn(v, 4 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4s);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceS32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4s(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4sv);
+      _gldTraceIn(v, 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4ub);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceU32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4ub(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4ubv(const GLubyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4ubv);
+      _gldTraceIn(v, 4 * sizeof(GLubyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4ubv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4ui);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceU32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4ui(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4uiv(const GLuint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4uiv);
+      _gldTraceIn(v, 4 * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4uiv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4us);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceU32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4us(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Color4usv(const GLushort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Color4usv);
+      _gldTraceIn(v, 4 * sizeof(GLushort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Color4usv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EdgeFlag(GLboolean flag)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EdgeFlag);
+      _gldTraceU32(flag);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EdgeFlag(flag);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EdgeFlagv(const GLboolean *flag)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EdgeFlagv);
+      _gldTraceIn(flag, 1 * sizeof(GLboolean));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EdgeFlagv(flag);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_End(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_End);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->End();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexd(GLdouble c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexd);
+      _gldTraceF64(c);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexd(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexdv(const GLdouble *c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexdv);
+      _gldTraceIn(c, 1 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexdv(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexf(GLfloat c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexf);
+      _gldTraceF32(c);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexf(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexfv(const GLfloat *c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexfv);
+      _gldTraceIn(c, 1 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexfv(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexi(GLint c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexi);
+      _gldTraceS32(c);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexi(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexiv(const GLint *c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexiv);
+      _gldTraceIn(c, 1 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexiv(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexs(GLshort c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexs);
+      _gldTraceS32(c);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexs(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexsv(const GLshort *c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexsv);
+      _gldTraceIn(c, 1 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexsv(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3b(GLbyte nx, GLbyte ny, GLbyte nz)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3b);
+      _gldTraceS32(nx);
+      _gldTraceS32(ny);
+      _gldTraceS32(nz);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3b(nx, ny, nz);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3bv(const GLbyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3bv);
+      _gldTraceIn(v, 3 * sizeof(GLbyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3bv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3d(GLdouble nx, GLdouble ny, GLdouble nz)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3d);
+      _gldTraceF64(nx);
+      _gldTraceF64(ny);
+      _gldTraceF64(nz);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3d(nx, ny, nz);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3dv);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3f);
+      _gldTraceF32(nx);
+      _gldTraceF32(ny);
+      _gldTraceF32(nz);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3f(nx, ny, nz);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3fv);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3i(GLint nx, GLint ny, GLint nz)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3i);
+      _gldTraceS32(nx);
+      _gldTraceS32(ny);
+      _gldTraceS32(nz);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3i(nx, ny, nz);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3iv);
+      _gldTraceIn(v, 3 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3s(GLshort nx, GLshort ny, GLshort nz)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3s);
+      _gldTraceS32(nx);
+      _gldTraceS32(ny);
+      _gldTraceS32(nz);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3s(nx, ny, nz);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Normal3sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Normal3sv);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Normal3sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos2d(GLdouble x, GLdouble y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos2d);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos2d(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos2dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos2dv);
+      _gldTraceIn(v, 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos2dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos2f(GLfloat x, GLfloat y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos2f);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos2f(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos2fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos2fv);
+      _gldTraceIn(v, 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos2fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos2i(GLint x, GLint y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos2i);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos2i(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos2iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos2iv);
+      _gldTraceIn(v, 2 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos2iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos2s(GLshort x, GLshort y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos2s);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos2s(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos2sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos2sv);
+      _gldTraceIn(v, 2 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos2sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos3d(GLdouble x, GLdouble y, GLdouble z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos3d);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos3d(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos3dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos3dv);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos3dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos3f);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos3f(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos3fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos3fv);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos3fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos3i(GLint x, GLint y, GLint z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos3i);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos3i(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos3iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos3iv);
+      _gldTraceIn(v, 3 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos3iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos3s(GLshort x, GLshort y, GLshort z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos3s);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos3s(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos3sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos3sv);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos3sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos4d);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceF64(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos4d(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos4dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos4dv);
+      _gldTraceIn(v, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos4dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos4f);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceF32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos4f(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos4fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos4fv);
+      _gldTraceIn(v, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos4fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos4i(GLint x, GLint y, GLint z, GLint w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos4i);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceS32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos4i(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos4iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos4iv);
+      _gldTraceIn(v, 4 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos4iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos4s);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceS32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos4s(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RasterPos4sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RasterPos4sv);
+      _gldTraceIn(v, 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RasterPos4sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rectd);
+      _gldTraceF64(x1);
+      _gldTraceF64(y1);
+      _gldTraceF64(x2);
+      _gldTraceF64(y2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rectd(x1, y1, x2, y2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rectdv(const GLdouble *v1, const GLdouble *v2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rectdv);
+      _gldTraceIn(v1, 2 * sizeof(GLdouble));
+      _gldTraceIn(v2, 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rectdv(v1, v2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rectf);
+      _gldTraceF32(x1);
+      _gldTraceF32(y1);
+      _gldTraceF32(x2);
+      _gldTraceF32(y2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rectf(x1, y1, x2, y2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rectfv(const GLfloat *v1, const GLfloat *v2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rectfv);
+      _gldTraceIn(v1, 2 * sizeof(GLfloat));
+      _gldTraceIn(v2, 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rectfv(v1, v2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Recti(GLint x1, GLint y1, GLint x2, GLint y2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Recti);
+      _gldTraceS32(x1);
+      _gldTraceS32(y1);
+      _gldTraceS32(x2);
+      _gldTraceS32(y2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Recti(x1, y1, x2, y2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rectiv(const GLint *v1, const GLint *v2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rectiv);
+      _gldTraceIn(v1, 2 * sizeof(GLint));
+      _gldTraceIn(v2, 2 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rectiv(v1, v2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rects);
+      _gldTraceS32(x1);
+      _gldTraceS32(y1);
+      _gldTraceS32(x2);
+      _gldTraceS32(y2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rects(x1, y1, x2, y2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rectsv(const GLshort *v1, const GLshort *v2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rectsv);
+      _gldTraceIn(v1, 2 * sizeof(GLshort));
+      _gldTraceIn(v2, 2 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rectsv(v1, v2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord1d(GLdouble s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord1d);
+      _gldTraceF64(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord1d(s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord1dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord1dv);
+      _gldTraceIn(v, 1 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord1dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord1f(GLfloat s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord1f);
+      _gldTraceF32(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord1f(s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord1fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord1fv);
+      _gldTraceIn(v, 1 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord1fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord1i(GLint s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord1i);
+      _gldTraceS32(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord1i(s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord1iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord1iv);
+      _gldTraceIn(v, 1 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord1iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord1s(GLshort s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord1s);
+      _gldTraceS32(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord1s(s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord1sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord1sv);
+      _gldTraceIn(v, 1 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord1sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord2d(GLdouble s, GLdouble t)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord2d);
+      _gldTraceF64(s);
+      _gldTraceF64(t);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord2d(s, t);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord2dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord2dv);
+      _gldTraceIn(v, 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord2dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord2f(GLfloat s, GLfloat t)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord2f);
+      _gldTraceF32(s);
+      _gldTraceF32(t);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord2f(s, t);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord2fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord2fv);
+      _gldTraceIn(v, 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord2fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord2i(GLint s, GLint t)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord2i);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord2i(s, t);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord2iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord2iv);
+      _gldTraceIn(v, 2 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord2iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord2s(GLshort s, GLshort t)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord2s);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord2s(s, t);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord2sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord2sv);
+      _gldTraceIn(v, 2 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord2sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord3d(GLdouble s, GLdouble t, GLdouble r)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord3d);
+      _gldTraceF64(s);
+      _gldTraceF64(t);
+      _gldTraceF64(r);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord3d(s, t, r);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord3dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord3dv);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord3dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord3f(GLfloat s, GLfloat t, GLfloat r)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord3f);
+      _gldTraceF32(s);
+      _gldTraceF32(t);
+      _gldTraceF32(r);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord3f(s, t, r);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord3fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord3fv);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord3fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord3i(GLint s, GLint t, GLint r)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord3i);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceS32(r);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord3i(s, t, r);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord3iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord3iv);
+      _gldTraceIn(v, 3 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord3iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord3s(GLshort s, GLshort t, GLshort r)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord3s);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceS32(r);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord3s(s, t, r);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord3sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord3sv);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord3sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord4d);
+      _gldTraceF64(s);
+      _gldTraceF64(t);
+      _gldTraceF64(r);
+      _gldTraceF64(q);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord4d(s, t, r, q);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord4dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord4dv);
+      _gldTraceIn(v, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord4dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord4f);
+      _gldTraceF32(s);
+      _gldTraceF32(t);
+      _gldTraceF32(r);
+      _gldTraceF32(q);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord4f(s, t, r, q);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord4fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord4fv);
+      _gldTraceIn(v, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord4fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord4i(GLint s, GLint t, GLint r, GLint q)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord4i);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceS32(r);
+      _gldTraceS32(q);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord4i(s, t, r, q);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord4iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord4iv);
+      _gldTraceIn(v, 4 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord4iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord4s);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceS32(r);
+      _gldTraceS32(q);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord4s(s, t, r, q);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoord4sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoord4sv);
+      _gldTraceIn(v, 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoord4sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex2d(GLdouble x, GLdouble y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex2d);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex2d(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex2dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex2dv);
+      _gldTraceIn(v, 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex2dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex2f(GLfloat x, GLfloat y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex2f);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex2f(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex2fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex2fv);
+      _gldTraceIn(v, 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex2fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex2i(GLint x, GLint y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex2i);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex2i(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex2iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex2iv);
+      _gldTraceIn(v, 2 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex2iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex2s(GLshort x, GLshort y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex2s);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex2s(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex2sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex2sv);
+      _gldTraceIn(v, 2 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex2sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex3d(GLdouble x, GLdouble y, GLdouble z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex3d);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex3d(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex3dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex3dv);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex3dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex3f(GLfloat x, GLfloat y, GLfloat z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex3f);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex3f(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex3fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex3fv);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex3fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex3i(GLint x, GLint y, GLint z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex3i);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex3i(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex3iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex3iv);
+      _gldTraceIn(v, 3 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex3iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex3s(GLshort x, GLshort y, GLshort z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex3s);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex3s(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex3sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex3sv);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex3sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex4d);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceF64(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex4d(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex4dv(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex4dv);
+      _gldTraceIn(v, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex4dv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex4f);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceF32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex4f(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex4fv(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex4fv);
+      _gldTraceIn(v, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex4fv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex4i(GLint x, GLint y, GLint z, GLint w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex4i);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceS32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex4i(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex4iv(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex4iv);
+      _gldTraceIn(v, 4 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex4iv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex4s);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceS32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex4s(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Vertex4sv(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Vertex4sv);
+      _gldTraceIn(v, 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Vertex4sv(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ClipPlane(GLenum plane, const GLdouble *equation)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ClipPlane);
+      _gldTraceU32(plane);
+      _gldTraceIn(equation, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ClipPlane(plane, equation);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ColorMaterial(GLenum face, GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ColorMaterial);
+      _gldTraceU32(face);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ColorMaterial(face, mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CullFace(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CullFace);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CullFace(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Fogf(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Fogf);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Fogf(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Fogfv(GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Fogfv);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Fogfv(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Fogi(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Fogi);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Fogi(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Fogiv(GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Fogiv);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Fogiv(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FrontFace(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FrontFace);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FrontFace(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Hint(GLenum target, GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Hint);
+      _gldTraceU32(target);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Hint(target, mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Lightf(GLenum light, GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Lightf);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Lightf(light, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Lightfv);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Lightfv(light, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Lighti(GLenum light, GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Lighti);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Lighti(light, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Lightiv(GLenum light, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Lightiv);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Lightiv(light, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LightModelf(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LightModelf);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LightModelf(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LightModelfv(GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LightModelfv);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LightModelfv(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LightModeli(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LightModeli);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LightModeli(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LightModeliv(GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LightModeliv);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LightModeliv(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LineStipple(GLint factor, GLushort pattern)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LineStipple);
+      _gldTraceS32(factor);
+      _gldTraceU32(pattern);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LineStipple(factor, pattern);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LineWidth(GLfloat width)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LineWidth);
+      _gldTraceF32(width);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LineWidth(width);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Materialf(GLenum face, GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Materialf);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Materialf(face, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Materialfv);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Materialfv(face, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Materiali(GLenum face, GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Materiali);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Materiali(face, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Materialiv(GLenum face, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Materialiv);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Materialiv(face, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PointSize(GLfloat size)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PointSize);
+      _gldTraceF32(size);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PointSize(size);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PolygonMode(GLenum face, GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PolygonMode);
+      _gldTraceU32(face);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PolygonMode(face, mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PolygonStipple(const GLubyte *mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PolygonStipple);
+      _gldTraceIn(mask, _gldTraceImageSize(mask, 32, 32, 1, GL_COLOR_INDEX, GL_BITMAP, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PolygonStipple(mask);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Scissor);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Scissor(x, y, width, height);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ShadeModel(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ShadeModel);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ShadeModel(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexParameterf);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexParameterf(target, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexParameterfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexParameterfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexParameteri(GLenum target, GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexParameteri);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexParameteri(target, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexParameteriv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexParameteriv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexImage1D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceS32(border);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(pixels, _gldTraceImageSize(pixels, width, 1, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexImage2D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceS32(border);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(pixels, _gldTraceImageSize(pixels, width, height, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexEnvf(GLenum target, GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexEnvf);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexEnvf(target, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexEnvfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexEnvfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexEnvi(GLenum target, GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexEnvi);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexEnvi(target, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexEnviv(GLenum target, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexEnviv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexEnviv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexGend(GLenum coord, GLenum pname, GLdouble param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexGend);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceF64(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexGend(coord, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexGendv(GLenum coord, GLenum pname, const GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexGendv);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexGendv(coord, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexGenf(GLenum coord, GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexGenf);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexGenf(coord, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexGenfv(GLenum coord, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexGenfv);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexGenfv(coord, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexGeni(GLenum coord, GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexGeni);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexGeni(coord, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexGeniv(GLenum coord, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexGeniv);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexGeniv(coord, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FeedbackBuffer);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTracePersistent(buffer, size * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FeedbackBuffer(size, type, buffer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SelectBuffer(GLsizei size, GLuint *buffer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SelectBuffer);
+      _gldTraceS32(size);
+      _gldTracePersistent(buffer, size * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SelectBuffer(size, buffer);
+   _gldTraceExit();
+}
+
+static GLint GLAPIENTRY _gldTrace_RenderMode(GLenum mode)
+{
+   GLint ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RenderMode);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->RenderMode(mode);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_InitNames(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_InitNames);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->InitNames();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LoadName(GLuint name)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LoadName);
+      _gldTraceU32(name);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LoadName(name);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PassThrough(GLfloat token)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PassThrough);
+      _gldTraceF32(token);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PassThrough(token);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PopName(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PopName);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PopName();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PushName(GLuint name)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PushName);
+      _gldTraceU32(name);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PushName(name);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DrawBuffer(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DrawBuffer);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DrawBuffer(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Clear(GLbitfield mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Clear);
+      _gldTraceU32(mask);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Clear(mask);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ClearAccum);
+      _gldTraceF32(red);
+      _gldTraceF32(green);
+      _gldTraceF32(blue);
+      _gldTraceF32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ClearAccum(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ClearIndex(GLfloat c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ClearIndex);
+      _gldTraceF32(c);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ClearIndex(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ClearColor);
+      _gldTraceF32(red);
+      _gldTraceF32(green);
+      _gldTraceF32(blue);
+      _gldTraceF32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ClearColor(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ClearStencil(GLint s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ClearStencil);
+      _gldTraceS32(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ClearStencil(s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ClearDepth(GLclampd depth)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ClearDepth);
+      _gldTraceF64(depth);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ClearDepth(depth);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_StencilMask(GLuint mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_StencilMask);
+      _gldTraceU32(mask);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->StencilMask(mask);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ColorMask);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceU32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ColorMask(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DepthMask(GLboolean flag)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DepthMask);
+      _gldTraceU32(flag);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DepthMask(flag);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_IndexMask(GLuint mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IndexMask);
+      _gldTraceU32(mask);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->IndexMask(mask);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Accum(GLenum op, GLfloat value)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Accum);
+      _gldTraceU32(op);
+      _gldTraceF32(value);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Accum(op, value);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Disable(GLenum cap)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Disable);
+      _gldTraceU32(cap);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Disable(cap);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Enable(GLenum cap)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Enable);
+      _gldTraceU32(cap);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Enable(cap);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Finish(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Finish);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Finish();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Flush(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Flush);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Flush();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PopAttrib(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PopAttrib);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PopAttrib();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PushAttrib(GLbitfield mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PushAttrib);
+      _gldTraceU32(mask);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PushAttrib(mask);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Map1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Map1d);
+      _gldTraceU32(target);
+      _gldTraceF64(u1);
+      _gldTraceF64(u2);
+      _gldTraceS32(stride);
+      _gldTraceS32(order);
+      _gldTraceIn(points, _gldTraceMapSize(target, stride, order, 0, 0) * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Map1d(target, u1, u2, stride, order, points);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Map1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Map1f);
+      _gldTraceU32(target);
+      _gldTraceF32(u1);
+      _gldTraceF32(u2);
+      _gldTraceS32(stride);
+      _gldTraceS32(order);
+      _gldTraceIn(points, _gldTraceMapSize(target, stride, order, 0, 0) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Map1f(target, u1, u2, stride, order, points);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Map2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Map2d);
+      _gldTraceU32(target);
+      _gldTraceF64(u1);
+      _gldTraceF64(u2);
+      _gldTraceS32(ustride);
+      _gldTraceS32(uorder);
+      _gldTraceF64(v1);
+      _gldTraceF64(v2);
+      _gldTraceS32(vstride);
+      _gldTraceS32(vorder);
+      _gldTraceIn(points, _gldTraceMapSize(target, ustride, uorder, vstride, vorder) * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Map2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Map2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Map2f);
+      _gldTraceU32(target);
+      _gldTraceF32(u1);
+      _gldTraceF32(u2);
+      _gldTraceS32(ustride);
+      _gldTraceS32(uorder);
+      _gldTraceF32(v1);
+      _gldTraceF32(v2);
+      _gldTraceS32(vstride);
+      _gldTraceS32(vorder);
+      _gldTraceIn(points, _gldTraceMapSize(target, ustride, uorder, vstride, vorder) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Map2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MapGrid1d(GLint un, GLdouble u1, GLdouble u2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MapGrid1d);
+      _gldTraceS32(un);
+      _gldTraceF64(u1);
+      _gldTraceF64(u2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MapGrid1d(un, u1, u2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MapGrid1f(GLint un, GLfloat u1, GLfloat u2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MapGrid1f);
+      _gldTraceS32(un);
+      _gldTraceF32(u1);
+      _gldTraceF32(u2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MapGrid1f(un, u1, u2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MapGrid2d);
+      _gldTraceS32(un);
+      _gldTraceF64(u1);
+      _gldTraceF64(u2);
+      _gldTraceS32(vn);
+      _gldTraceF64(v1);
+      _gldTraceF64(v2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MapGrid2d(un, u1, u2, vn, v1, v2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MapGrid2f);
+      _gldTraceS32(un);
+      _gldTraceF32(u1);
+      _gldTraceF32(u2);
+      _gldTraceS32(vn);
+      _gldTraceF32(v1);
+      _gldTraceF32(v2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MapGrid2f(un, u1, u2, vn, v1, v2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalCoord1d(GLdouble u)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalCoord1d);
+      _gldTraceF64(u);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalCoord1d(u);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalCoord1dv(const GLdouble *u)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalCoord1dv);
+      _gldTraceIn(u, 1 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalCoord1dv(u);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalCoord1f(GLfloat u)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalCoord1f);
+      _gldTraceF32(u);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalCoord1f(u);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalCoord1fv(const GLfloat *u)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalCoord1fv);
+      _gldTraceIn(u, 1 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalCoord1fv(u);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalCoord2d(GLdouble u, GLdouble v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalCoord2d);
+      _gldTraceF64(u);
+      _gldTraceF64(v);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalCoord2d(u, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalCoord2dv(const GLdouble *u)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalCoord2dv);
+      _gldTraceIn(u, 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalCoord2dv(u);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalCoord2f(GLfloat u, GLfloat v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalCoord2f);
+      _gldTraceF32(u);
+      _gldTraceF32(v);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalCoord2f(u, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalCoord2fv(const GLfloat *u)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalCoord2fv);
+      _gldTraceIn(u, 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalCoord2fv(u);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalMesh1(GLenum mode, GLint i1, GLint i2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalMesh1);
+      _gldTraceU32(mode);
+      _gldTraceS32(i1);
+      _gldTraceS32(i2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalMesh1(mode, i1, i2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalPoint1(GLint i)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalPoint1);
+      _gldTraceS32(i);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalPoint1(i);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalMesh2);
+      _gldTraceU32(mode);
+      _gldTraceS32(i1);
+      _gldTraceS32(i2);
+      _gldTraceS32(j1);
+      _gldTraceS32(j2);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalMesh2(mode, i1, i2, j1, j2);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EvalPoint2(GLint i, GLint j)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EvalPoint2);
+      _gldTraceS32(i);
+      _gldTraceS32(j);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EvalPoint2(i, j);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_AlphaFunc(GLenum func, GLclampf ref)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_AlphaFunc);
+      _gldTraceU32(func);
+      _gldTraceF32(ref);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->AlphaFunc(func, ref);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BlendFunc);
+      _gldTraceU32(sfactor);
+      _gldTraceU32(dfactor);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BlendFunc(sfactor, dfactor);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LogicOp(GLenum opcode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LogicOp);
+      _gldTraceU32(opcode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LogicOp(opcode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_StencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_StencilFunc);
+      _gldTraceU32(func);
+      _gldTraceS32(ref);
+      _gldTraceU32(mask);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->StencilFunc(func, ref, mask);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_StencilOp);
+      _gldTraceU32(fail);
+      _gldTraceU32(zfail);
+      _gldTraceU32(zpass);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->StencilOp(fail, zfail, zpass);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DepthFunc(GLenum func)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DepthFunc);
+      _gldTraceU32(func);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DepthFunc(func);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelZoom(GLfloat xfactor, GLfloat yfactor)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelZoom);
+      _gldTraceF32(xfactor);
+      _gldTraceF32(yfactor);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelZoom(xfactor, yfactor);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelTransferf(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelTransferf);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelTransferf(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelTransferi(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelTransferi);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelTransferi(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelStoref(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelStoref);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelStoref(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelStorei(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelStorei);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelStorei(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelMapfv);
+      _gldTraceU32(map);
+      _gldTraceS32(mapsize);
+      _gldTraceIn(values, mapsize * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelMapfv(map, mapsize, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelMapuiv);
+      _gldTraceU32(map);
+      _gldTraceS32(mapsize);
+      _gldTraceIn(values, mapsize * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelMapuiv(map, mapsize, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelMapusv);
+      _gldTraceU32(map);
+      _gldTraceS32(mapsize);
+      _gldTraceIn(values, mapsize * sizeof(GLushort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelMapusv(map, mapsize, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ReadBuffer(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ReadBuffer);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ReadBuffer(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyPixels);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceU32(type);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyPixels(x, y, width, height, type);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ReadPixels);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(pixels, _gldTraceImageSize(pixels, width, height, 1, format, type, 1));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ReadPixels(x, y, width, height, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DrawPixels);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(pixels, _gldTraceImageSize(pixels, width, height, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DrawPixels(width, height, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetBooleanv(GLenum pname, GLboolean *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetBooleanv);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLboolean));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetBooleanv(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetClipPlane(GLenum plane, GLdouble *equation)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetClipPlane);
+      _gldTraceU32(plane);
+      _gldTraceOut(equation, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetClipPlane(plane, equation);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetDoublev(GLenum pname, GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetDoublev);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetDoublev(pname, params);
+   _gldTraceExit();
+}
+
+static GLenum GLAPIENTRY _gldTrace_GetError(void)
+{
+   GLenum ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetError);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->GetError();
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_GetFloatv(GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetFloatv);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetFloatv(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetIntegerv(GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetIntegerv);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetIntegerv(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetLightfv);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetLightfv(light, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetLightiv(GLenum light, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetLightiv);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetLightiv(light, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMapdv(GLenum target, GLenum query, GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMapdv);
+      _gldTraceU32(target);
+      _gldTraceU32(query);
+      _gldTraceOut(v, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMapdv(target, query, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMapfv(GLenum target, GLenum query, GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMapfv);
+      _gldTraceU32(target);
+      _gldTraceU32(query);
+      _gldTraceOut(v, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMapfv(target, query, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMapiv(GLenum target, GLenum query, GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMapiv);
+      _gldTraceU32(target);
+      _gldTraceU32(query);
+      _gldTraceOut(v, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMapiv(target, query, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMaterialfv);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMaterialfv(face, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMaterialiv(GLenum face, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMaterialiv);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMaterialiv(face, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetPixelMapfv(GLenum map, GLfloat *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetPixelMapfv);
+      _gldTraceU32(map);
+      _gldTraceOut(values, MAX_PIXEL_MAP_TABLE * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetPixelMapfv(map, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetPixelMapuiv(GLenum map, GLuint *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetPixelMapuiv);
+      _gldTraceU32(map);
+      _gldTraceOut(values, MAX_PIXEL_MAP_TABLE * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetPixelMapuiv(map, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetPixelMapusv(GLenum map, GLushort *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetPixelMapusv);
+      _gldTraceU32(map);
+      _gldTraceOut(values, MAX_PIXEL_MAP_TABLE * sizeof(GLushort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetPixelMapusv(map, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetPolygonStipple(GLubyte *mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetPolygonStipple);
+      _gldTraceOut(mask, _gldTraceImageSize(mask, 32, 32, 1, GL_COLOR_INDEX, GL_BITMAP, 1));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetPolygonStipple(mask);
+   _gldTraceExit();
+}
+
+static const GLubyte * GLAPIENTRY _gldTrace_GetString(GLenum name)
+{
+   const GLubyte * ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetString);
+      _gldTraceU32(name);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->GetString(name);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexEnvfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexEnvfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexEnviv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexEnviv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexGendv(GLenum coord, GLenum pname, GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexGendv);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexGendv(coord, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexGenfv(GLenum coord, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexGenfv);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexGenfv(coord, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexGeniv(GLenum coord, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexGeniv);
+      _gldTraceU32(coord);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexGeniv(coord, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexImage);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(pixels, _gldTraceTexImageSize(target, level, format, type, pixels));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexImage(target, level, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexParameterfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexParameterfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexParameteriv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexParameteriv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexLevelParameterfv);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexLevelParameterfv(target, level, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexLevelParameteriv);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexLevelParameteriv(target, level, pname, params);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_IsEnabled(GLenum cap)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IsEnabled);
+      _gldTraceU32(cap);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->IsEnabled(cap);
+   _gldTraceExit();
+   return ret;
+}
+
+static GLboolean GLAPIENTRY _gldTrace_IsList(GLuint list)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IsList);
+      _gldTraceU32(list);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->IsList(list);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_DepthRange(GLclampd zNear, GLclampd zFar)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DepthRange);
+      _gldTraceF64(zNear);
+      _gldTraceF64(zFar);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DepthRange(zNear, zFar);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Frustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Frustum);
+      _gldTraceF64(left);
+      _gldTraceF64(right);
+      _gldTraceF64(bottom);
+      _gldTraceF64(top);
+      _gldTraceF64(zNear);
+      _gldTraceF64(zFar);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Frustum(left, right, bottom, top, zNear, zFar);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LoadIdentity(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LoadIdentity);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LoadIdentity();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LoadMatrixf(const GLfloat *m)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LoadMatrixf);
+      _gldTraceIn(m, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LoadMatrixf(m);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LoadMatrixd(const GLdouble *m)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LoadMatrixd);
+      _gldTraceIn(m, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LoadMatrixd(m);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MatrixMode(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MatrixMode);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MatrixMode(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultMatrixf(const GLfloat *m)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultMatrixf);
+      _gldTraceIn(m, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultMatrixf(m);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultMatrixd(const GLdouble *m)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultMatrixd);
+      _gldTraceIn(m, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultMatrixd(m);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Ortho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Ortho);
+      _gldTraceF64(left);
+      _gldTraceF64(right);
+      _gldTraceF64(bottom);
+      _gldTraceF64(top);
+      _gldTraceF64(zNear);
+      _gldTraceF64(zFar);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Ortho(left, right, bottom, top, zNear, zFar);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PopMatrix(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PopMatrix);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PopMatrix();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PushMatrix(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PushMatrix);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PushMatrix();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rotated);
+      _gldTraceF64(angle);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rotated(angle, x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Rotatef);
+      _gldTraceF32(angle);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Rotatef(angle, x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Scaled(GLdouble x, GLdouble y, GLdouble z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Scaled);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Scaled(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Scalef(GLfloat x, GLfloat y, GLfloat z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Scalef);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Scalef(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Translated(GLdouble x, GLdouble y, GLdouble z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Translated);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Translated(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Translatef(GLfloat x, GLfloat y, GLfloat z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Translatef);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Translatef(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Viewport);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Viewport(x, y, width, height);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ArrayElement(GLint i)
+{
+   _GLD_TRACE_REAL->ArrayElement(i);
+}
+
+static void GLAPIENTRY _gldTrace_BindTexture(GLenum target, GLuint texture)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BindTexture);
+      _gldTraceU32(target);
+      _gldTraceU32(texture);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BindTexture(target, texture);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ColorPointer);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ColorPointer(size, type, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DisableClientState(GLenum array)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DisableClientState);
+      _gldTraceU32(array);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DisableClientState(array);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceClientArrays(first, first + count - 1);
+      _gldTraceBeginOp(_gloffset_DrawArrays);
+      _gldTraceU32(mode);
+      _gldTraceS32(first);
+      _gldTraceS32(count);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DrawArrays(mode, first, count);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceDrawElements(count, type, indices);
+      _gldTraceBeginOp(_gloffset_DrawElements);
+      _gldTraceU32(mode);
+      _gldTraceS32(count);
+      _gldTraceU32(type);
+      _gldTraceElements(indices, count * _gldTraceTypeSize(type));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DrawElements(mode, count, type, indices);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EdgeFlagPointer(GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EdgeFlagPointer);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EdgeFlagPointer(stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EnableClientState(GLenum array)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EnableClientState);
+      _gldTraceU32(array);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EnableClientState(array);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_IndexPointer(GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IndexPointer);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->IndexPointer(type, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexub(GLubyte c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexub);
+      _gldTraceU32(c);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexub(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Indexubv(const GLubyte *c)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Indexubv);
+      _gldTraceIn(c, 1 * sizeof(GLubyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Indexubv(c);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_InterleavedArrays(GLenum format, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_InterleavedArrays);
+      _gldTraceU32(format);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->InterleavedArrays(format, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_NormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_NormalPointer);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->NormalPointer(type, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PolygonOffset(GLfloat factor, GLfloat units)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PolygonOffset);
+      _gldTraceF32(factor);
+      _gldTraceF32(units);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PolygonOffset(factor, units);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoordPointer);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoordPointer(size, type, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexPointer);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexPointer(size, type, stride, pointer);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_AreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_AreTexturesResident);
+      _gldTraceS32(n);
+      _gldTraceIn(textures, n * sizeof(GLuint));
+      _gldTraceOut(residences, n * sizeof(GLboolean));
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->AreTexturesResident(n, textures, residences);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyTexImage1D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(border);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyTexImage1D(target, level, internalformat, x, y, width, border);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyTexImage2D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceS32(border);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyTexSubImage1D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyTexSubImage1D(target, level, xoffset, x, y, width);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyTexSubImage2D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(yoffset);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DeleteTextures(GLsizei n, const GLuint *textures)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DeleteTextures);
+      _gldTraceS32(n);
+      _gldTraceIn(textures, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DeleteTextures(n, textures);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GenTextures(GLsizei n, GLuint *textures)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GenTextures);
+      _gldTraceS32(n);
+      _gldTraceOut(textures, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GenTextures(n, textures);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetPointerv(GLenum pname, GLvoid **params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetPointerv);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLvoid *));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetPointerv(pname, params);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_IsTexture(GLuint texture)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IsTexture);
+      _gldTraceU32(texture);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->IsTexture(texture);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_PrioritizeTextures(GLsizei n, const GLuint *textures, const GLclampf *priorities)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PrioritizeTextures);
+      _gldTraceS32(n);
+      _gldTraceIn(textures, n * sizeof(GLuint));
+      _gldTraceIn(priorities, n * sizeof(GLclampf));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PrioritizeTextures(n, textures, priorities);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexSubImage1D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(width);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(pixels, _gldTraceImageSize(pixels, width, 1, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexSubImage2D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(yoffset);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(pixels, _gldTraceImageSize(pixels, width, height, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PopClientAttrib(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PopClientAttrib);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PopClientAttrib();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PushClientAttrib(GLbitfield mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PushClientAttrib);
+      _gldTraceU32(mask);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PushClientAttrib(mask);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_BlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BlendColor);
+      _gldTraceF32(red);
+      _gldTraceF32(green);
+      _gldTraceF32(blue);
+      _gldTraceF32(alpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BlendColor(red, green, blue, alpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_BlendEquation(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BlendEquation);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BlendEquation(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid *indices)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceClientArrays(start, end);
+      _gldTraceBeginOp(_gloffset_DrawRangeElements);
+      _gldTraceU32(mode);
+      _gldTraceU32(start);
+      _gldTraceU32(end);
+      _gldTraceS32(count);
+      _gldTraceU32(type);
+      _gldTraceElements(indices, count * _gldTraceTypeSize(type));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DrawRangeElements(mode, start, end, count, type, indices);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid *table)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ColorTable);
+      _gldTraceU32(target);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(table, _gldTraceImageSize(table, width, 1, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ColorTable(target, internalformat, width, format, type, table);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ColorTableParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ColorTableParameterfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ColorTableParameterfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ColorTableParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ColorTableParameteriv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ColorTableParameteriv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyColorTable(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyColorTable);
+      _gldTraceU32(target);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyColorTable(target, internalformat, x, y, width);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTable(GLenum target, GLenum format, GLenum type, GLvoid *table)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTable);
+      _gldTraceU32(target);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(table, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTable(target, format, type, table);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTableParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTableParameterfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTableParameterfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTableParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTableParameteriv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTableParameteriv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ColorSubTable);
+      _gldTraceU32(target);
+      _gldTraceS32(start);
+      _gldTraceS32(count);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(data, _gldTraceImageSize(data, count, 1, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ColorSubTable(target, start, count, format, type, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyColorSubTable);
+      _gldTraceU32(target);
+      _gldTraceS32(start);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyColorSubTable(target, start, x, y, width);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid *image)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ConvolutionFilter1D);
+      _gldTraceU32(target);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(image, _gldTraceImageSize(image, width, 1, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ConvolutionFilter1D(target, internalformat, width, format, type, image);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *image)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ConvolutionFilter2D);
+      _gldTraceU32(target);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(image, _gldTraceImageSize(image, width, height, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ConvolutionFilter2D(target, internalformat, width, height, format, type, image);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ConvolutionParameterf);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceF32(params);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ConvolutionParameterf(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ConvolutionParameterfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ConvolutionParameterfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ConvolutionParameteri(GLenum target, GLenum pname, GLint params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ConvolutionParameteri);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceS32(params);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ConvolutionParameteri(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ConvolutionParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ConvolutionParameteriv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ConvolutionParameteriv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyConvolutionFilter1D);
+      _gldTraceU32(target);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyConvolutionFilter1D(target, internalformat, x, y, width);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyConvolutionFilter2D);
+      _gldTraceU32(target);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyConvolutionFilter2D(target, internalformat, x, y, width, height);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetConvolutionFilter(GLenum target, GLenum format, GLenum type, GLvoid *image)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetConvolutionFilter);
+      _gldTraceU32(target);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(image, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetConvolutionFilter(target, format, type, image);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetConvolutionParameterfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetConvolutionParameterfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetConvolutionParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetConvolutionParameteriv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetConvolutionParameteriv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetSeparableFilter(GLenum target, GLenum format, GLenum type, GLvoid *row, GLvoid *column, GLvoid *span)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetSeparableFilter);
+      _gldTraceU32(target);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(row, 0);
+      _gldTraceOut(column, 0);
+      _gldTraceOut(span, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetSeparableFilter(target, format, type, row, column, span);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *row, const GLvoid *column)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SeparableFilter2D);
+      _gldTraceU32(target);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(row, _gldTraceImageSize(row, width, 1, 1, format, type, 0));
+      _gldTraceIn(column, _gldTraceImageSize(column, height, 1, 1, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SeparableFilter2D(target, internalformat, width, height, format, type, row, column);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetHistogram);
+      _gldTraceU32(target);
+      _gldTraceU32(reset);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(values, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetHistogram(target, reset, format, type, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetHistogramParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetHistogramParameterfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetHistogramParameterfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetHistogramParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetHistogramParameteriv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetHistogramParameteriv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMinmax);
+      _gldTraceU32(target);
+      _gldTraceU32(reset);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(values, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMinmax(target, reset, format, type, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMinmaxParameterfv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMinmaxParameterfv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMinmaxParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMinmaxParameteriv);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMinmaxParameteriv(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Histogram(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Histogram);
+      _gldTraceU32(target);
+      _gldTraceS32(width);
+      _gldTraceU32(internalformat);
+      _gldTraceU32(sink);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Histogram(target, width, internalformat, sink);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_Minmax(GLenum target, GLenum internalformat, GLboolean sink)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_Minmax);
+      _gldTraceU32(target);
+      _gldTraceU32(internalformat);
+      _gldTraceU32(sink);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->Minmax(target, internalformat, sink);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ResetHistogram(GLenum target)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ResetHistogram);
+      _gldTraceU32(target);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ResetHistogram(target);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ResetMinmax(GLenum target)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ResetMinmax);
+      _gldTraceU32(target);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ResetMinmax(target);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexImage3D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceS32(depth);
+      _gldTraceS32(border);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(pixels, _gldTraceImageSize(pixels, width, height, depth, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexSubImage3D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(yoffset);
+      _gldTraceS32(zoffset);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceS32(depth);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceIn(pixels, _gldTraceImageSize(pixels, width, height, depth, format, type, 0));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CopyTexSubImage3D);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(yoffset);
+      _gldTraceS32(zoffset);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ActiveTextureARB(GLenum texture)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ActiveTextureARB);
+      _gldTraceU32(texture);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ActiveTextureARB(texture);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ClientActiveTextureARB(GLenum texture)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ClientActiveTextureARB);
+      _gldTraceU32(texture);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ClientActiveTextureARB(texture);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord1dARB(GLenum target, GLdouble s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord1dARB);
+      _gldTraceU32(target);
+      _gldTraceF64(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord1dARB(target, s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord1dvARB(GLenum target, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord1dvARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 1 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord1dvARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord1fARB(GLenum target, GLfloat s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord1fARB);
+      _gldTraceU32(target);
+      _gldTraceF32(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord1fARB(target, s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord1fvARB(GLenum target, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord1fvARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 1 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord1fvARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord1iARB(GLenum target, GLint s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord1iARB);
+      _gldTraceU32(target);
+      _gldTraceS32(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord1iARB(target, s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord1ivARB(GLenum target, const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord1ivARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 1 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord1ivARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord1sARB(GLenum target, GLshort s)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord1sARB);
+      _gldTraceU32(target);
+      _gldTraceS32(s);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord1sARB(target, s);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord1svARB(GLenum target, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord1svARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 1 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord1svARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord2dARB);
+      _gldTraceU32(target);
+      _gldTraceF64(s);
+      _gldTraceF64(t);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord2dARB(target, s, t);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord2dvARB(GLenum target, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord2dvARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord2dvARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord2fARB);
+      _gldTraceU32(target);
+      _gldTraceF32(s);
+      _gldTraceF32(t);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord2fARB(target, s, t);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord2fvARB(GLenum target, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord2fvARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord2fvARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord2iARB(GLenum target, GLint s, GLint t)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord2iARB);
+      _gldTraceU32(target);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord2iARB(target, s, t);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord2ivARB(GLenum target, const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord2ivARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 2 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord2ivARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord2sARB);
+      _gldTraceU32(target);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord2sARB(target, s, t);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord2svARB(GLenum target, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord2svARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 2 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord2svARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord3dARB);
+      _gldTraceU32(target);
+      _gldTraceF64(s);
+      _gldTraceF64(t);
+      _gldTraceF64(r);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord3dARB(target, s, t, r);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord3dvARB(GLenum target, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord3dvARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord3dvARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord3fARB);
+      _gldTraceU32(target);
+      _gldTraceF32(s);
+      _gldTraceF32(t);
+      _gldTraceF32(r);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord3fARB(target, s, t, r);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord3fvARB(GLenum target, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord3fvARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord3fvARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord3iARB);
+      _gldTraceU32(target);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceS32(r);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord3iARB(target, s, t, r);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord3ivARB(GLenum target, const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord3ivARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 3 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord3ivARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord3sARB);
+      _gldTraceU32(target);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceS32(r);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord3sARB(target, s, t, r);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord3svARB(GLenum target, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord3svARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord3svARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord4dARB);
+      _gldTraceU32(target);
+      _gldTraceF64(s);
+      _gldTraceF64(t);
+      _gldTraceF64(r);
+      _gldTraceF64(q);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord4dARB(target, s, t, r, q);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord4dvARB(GLenum target, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord4dvARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord4dvARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord4fARB);
+      _gldTraceU32(target);
+      _gldTraceF32(s);
+      _gldTraceF32(t);
+      _gldTraceF32(r);
+      _gldTraceF32(q);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord4fARB(target, s, t, r, q);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord4fvARB(GLenum target, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord4fvARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord4fvARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord4iARB);
+      _gldTraceU32(target);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceS32(r);
+      _gldTraceS32(q);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord4iARB(target, s, t, r, q);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord4ivARB(GLenum target, const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord4ivARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 4 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord4ivARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord4sARB);
+      _gldTraceU32(target);
+      _gldTraceS32(s);
+      _gldTraceS32(t);
+      _gldTraceS32(r);
+      _gldTraceS32(q);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord4sARB(target, s, t, r, q);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiTexCoord4svARB(GLenum target, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiTexCoord4svARB);
+      _gldTraceU32(target);
+      _gldTraceIn(v, 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiTexCoord4svARB(target, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LoadTransposeMatrixfARB(const GLfloat *m)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LoadTransposeMatrixfARB);
+      _gldTraceIn(m, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LoadTransposeMatrixfARB(m);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LoadTransposeMatrixdARB(const GLdouble *m)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LoadTransposeMatrixdARB);
+      _gldTraceIn(m, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LoadTransposeMatrixdARB(m);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultTransposeMatrixfARB(const GLfloat *m)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultTransposeMatrixfARB);
+      _gldTraceIn(m, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultTransposeMatrixfARB(m);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultTransposeMatrixdARB(const GLdouble *m)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultTransposeMatrixdARB);
+      _gldTraceIn(m, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultTransposeMatrixdARB(m);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SampleCoverageARB(GLclampf value, GLboolean invert)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SampleCoverageARB);
+      _gldTraceF32(value);
+      _gldTraceU32(invert);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SampleCoverageARB(value, invert);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace___unused413(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset___unused413);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->__unused413();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PolygonOffsetEXT(GLfloat factor, GLfloat bias)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PolygonOffsetEXT);
+      _gldTraceF32(factor);
+      _gldTraceF32(bias);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PolygonOffsetEXT(factor, bias);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTexFilterFuncSGIS(GLenum target, GLenum filter, GLfloat *weights)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTexFilterFuncSGIS);
+      _gldTraceU32(target);
+      _gldTraceU32(filter);
+      _gldTraceOut(weights, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTexFilterFuncSGIS(target, filter, weights);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexFilterFuncSGIS(GLenum target, GLenum filter, GLsizei n, const GLfloat *weights)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexFilterFuncSGIS);
+      _gldTraceU32(target);
+      _gldTraceU32(filter);
+      _gldTraceS32(n);
+      _gldTraceIn(weights, n * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexFilterFuncSGIS(target, filter, n, weights);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetHistogramEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetHistogramEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(reset);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(values, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetHistogramEXT(target, reset, format, type, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetHistogramParameterfvEXT(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetHistogramParameterfvEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetHistogramParameterfvEXT(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetHistogramParameterivEXT(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetHistogramParameterivEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetHistogramParameterivEXT(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMinmaxEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid *values)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMinmaxEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(reset);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(values, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMinmaxEXT(target, reset, format, type, values);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMinmaxParameterfvEXT(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMinmaxParameterfvEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMinmaxParameterfvEXT(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetMinmaxParameterivEXT(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetMinmaxParameterivEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetMinmaxParameterivEXT(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetConvolutionFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid *image)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetConvolutionFilterEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(image, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetConvolutionFilterEXT(target, format, type, image);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetConvolutionParameterfvEXT(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetConvolutionParameterfvEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetConvolutionParameterfvEXT(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetConvolutionParameterivEXT(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetConvolutionParameterivEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetConvolutionParameterivEXT(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetSeparableFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid *row, GLvoid *column, GLvoid *span)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetSeparableFilterEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(row, 0);
+      _gldTraceOut(column, 0);
+      _gldTraceOut(span, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetSeparableFilterEXT(target, format, type, row, column, span);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTableSGI(GLenum target, GLenum format, GLenum type, GLvoid *table)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTableSGI);
+      _gldTraceU32(target);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(table, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTableSGI(target, format, type, table);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTableParameterfvSGI(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTableParameterfvSGI);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTableParameterfvSGI(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTableParameterivSGI(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTableParameterivSGI);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTableParameterivSGI(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelTexGenSGIX(GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelTexGenSGIX);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelTexGenSGIX(mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelTexGenParameteriSGIS(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelTexGenParameteriSGIS);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelTexGenParameteriSGIS(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelTexGenParameterivSGIS(GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelTexGenParameterivSGIS);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelTexGenParameterivSGIS(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelTexGenParameterfSGIS(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelTexGenParameterfSGIS);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelTexGenParameterfSGIS(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PixelTexGenParameterfvSGIS(GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PixelTexGenParameterfvSGIS);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PixelTexGenParameterfvSGIS(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetPixelTexGenParameterivSGIS(GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetPixelTexGenParameterivSGIS);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetPixelTexGenParameterivSGIS(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetPixelTexGenParameterfvSGIS(GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetPixelTexGenParameterfvSGIS);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetPixelTexGenParameterfvSGIS(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexImage4DSGIS(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexImage4DSGIS);
+      _gldTraceUnsupported();
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexImage4DSGIS(target, level, internalformat, width, height, depth, size4d, border, format, type, pixels);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexSubImage4DSGIS(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const GLvoid *pixels)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexSubImage4DSGIS);
+      _gldTraceUnsupported();
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexSubImage4DSGIS(target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_AreTexturesResidentEXT(GLsizei n, const GLuint *textures, GLboolean *residences)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_AreTexturesResidentEXT);
+      _gldTraceS32(n);
+      _gldTraceIn(textures, n * sizeof(GLuint));
+      _gldTraceOut(residences, n * sizeof(GLboolean));
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->AreTexturesResidentEXT(n, textures, residences);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_GenTexturesEXT(GLsizei n, GLuint *textures)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GenTexturesEXT);
+      _gldTraceS32(n);
+      _gldTraceOut(textures, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GenTexturesEXT(n, textures);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_IsTextureEXT(GLuint texture)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IsTextureEXT);
+      _gldTraceU32(texture);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->IsTextureEXT(texture);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_DetailTexFuncSGIS(GLenum target, GLsizei n, const GLfloat *points)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DetailTexFuncSGIS);
+      _gldTraceU32(target);
+      _gldTraceS32(n);
+      _gldTraceIn(points, n * 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DetailTexFuncSGIS(target, n, points);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetDetailTexFuncSGIS(GLenum target, GLfloat *points)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetDetailTexFuncSGIS);
+      _gldTraceU32(target);
+      _gldTraceOut(points, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetDetailTexFuncSGIS(target, points);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SharpenTexFuncSGIS(GLenum target, GLsizei n, const GLfloat *points)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SharpenTexFuncSGIS);
+      _gldTraceU32(target);
+      _gldTraceS32(n);
+      _gldTraceIn(points, n * 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SharpenTexFuncSGIS(target, n, points);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetSharpenTexFuncSGIS(GLenum target, GLfloat *points)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetSharpenTexFuncSGIS);
+      _gldTraceU32(target);
+      _gldTraceOut(points, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetSharpenTexFuncSGIS(target, points);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SampleMaskSGIS(GLclampf value, GLboolean invert)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SampleMaskSGIS);
+      _gldTraceF32(value);
+      _gldTraceU32(invert);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SampleMaskSGIS(value, invert);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SamplePatternSGIS(GLenum pattern)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SamplePatternSGIS);
+      _gldTraceU32(pattern);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SamplePatternSGIS(pattern);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ColorPointerEXT);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceS32(count);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ColorPointerEXT(size, type, stride, count, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EdgeFlagPointerEXT(GLsizei stride, GLsizei count, const GLboolean *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EdgeFlagPointerEXT);
+      _gldTraceS32(stride);
+      _gldTraceS32(count);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EdgeFlagPointerEXT(stride, count, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_IndexPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IndexPointerEXT);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceS32(count);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->IndexPointerEXT(type, stride, count, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_NormalPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_NormalPointerEXT);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceS32(count);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->NormalPointerEXT(type, stride, count, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TexCoordPointerEXT);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceS32(count);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TexCoordPointerEXT(size, type, stride, count, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexPointerEXT);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceS32(count);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexPointerEXT(size, type, stride, count, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SpriteParameterfSGIX(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SpriteParameterfSGIX);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SpriteParameterfSGIX(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SpriteParameterfvSGIX(GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SpriteParameterfvSGIX);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SpriteParameterfvSGIX(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SpriteParameteriSGIX(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SpriteParameteriSGIX);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SpriteParameteriSGIX(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SpriteParameterivSGIX(GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SpriteParameterivSGIX);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SpriteParameterivSGIX(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PointParameterfEXT(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PointParameterfEXT);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PointParameterfEXT(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PointParameterfvEXT(GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PointParameterfvEXT);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PointParameterfvEXT(pname, params);
+   _gldTraceExit();
+}
+
+static GLint GLAPIENTRY _gldTrace_GetInstrumentsSGIX(void)
+{
+   GLint ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetInstrumentsSGIX);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->GetInstrumentsSGIX();
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_InstrumentsBufferSGIX(GLsizei size, GLint *buffer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_InstrumentsBufferSGIX);
+      _gldTraceS32(size);
+      _gldTracePersistent(buffer, size * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->InstrumentsBufferSGIX(size, buffer);
+   _gldTraceExit();
+}
+
+static GLint GLAPIENTRY _gldTrace_PollInstrumentsSGIX(GLint *marker_p)
+{
+   GLint ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PollInstrumentsSGIX);
+      _gldTraceOut(marker_p, 1 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->PollInstrumentsSGIX(marker_p);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_ReadInstrumentsSGIX(GLint marker)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ReadInstrumentsSGIX);
+      _gldTraceS32(marker);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ReadInstrumentsSGIX(marker);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_StartInstrumentsSGIX(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_StartInstrumentsSGIX);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->StartInstrumentsSGIX();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_StopInstrumentsSGIX(GLint marker)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_StopInstrumentsSGIX);
+      _gldTraceS32(marker);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->StopInstrumentsSGIX(marker);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FrameZoomSGIX(GLint factor)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FrameZoomSGIX);
+      _gldTraceS32(factor);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FrameZoomSGIX(factor);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TagSampleBufferSGIX(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TagSampleBufferSGIX);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TagSampleBufferSGIX();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ReferencePlaneSGIX(const GLdouble *equation)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ReferencePlaneSGIX);
+      _gldTraceIn(equation, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ReferencePlaneSGIX(equation);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FlushRasterSGIX(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FlushRasterSGIX);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FlushRasterSGIX();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetListParameterfvSGIX(GLuint list, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetListParameterfvSGIX);
+      _gldTraceU32(list);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetListParameterfvSGIX(list, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetListParameterivSGIX(GLuint list, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetListParameterivSGIX);
+      _gldTraceU32(list);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetListParameterivSGIX(list, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ListParameterfSGIX(GLuint list, GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ListParameterfSGIX);
+      _gldTraceU32(list);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ListParameterfSGIX(list, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ListParameterfvSGIX(GLuint list, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ListParameterfvSGIX);
+      _gldTraceU32(list);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ListParameterfvSGIX(list, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ListParameteriSGIX(GLuint list, GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ListParameteriSGIX);
+      _gldTraceU32(list);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ListParameteriSGIX(list, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ListParameterivSGIX(GLuint list, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ListParameterivSGIX);
+      _gldTraceU32(list);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ListParameterivSGIX(list, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentColorMaterialSGIX(GLenum face, GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentColorMaterialSGIX);
+      _gldTraceU32(face);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentColorMaterialSGIX(face, mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentLightfSGIX(GLenum light, GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentLightfSGIX);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentLightfSGIX(light, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentLightfvSGIX(GLenum light, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentLightfvSGIX);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentLightfvSGIX(light, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentLightiSGIX(GLenum light, GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentLightiSGIX);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentLightiSGIX(light, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentLightivSGIX(GLenum light, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentLightivSGIX);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentLightivSGIX(light, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentLightModelfSGIX(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentLightModelfSGIX);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentLightModelfSGIX(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentLightModelfvSGIX(GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentLightModelfvSGIX);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentLightModelfvSGIX(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentLightModeliSGIX(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentLightModeliSGIX);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentLightModeliSGIX(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentLightModelivSGIX(GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentLightModelivSGIX);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentLightModelivSGIX(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentMaterialfSGIX(GLenum face, GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentMaterialfSGIX);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentMaterialfSGIX(face, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentMaterialfvSGIX(GLenum face, GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentMaterialfvSGIX);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentMaterialfvSGIX(face, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentMaterialiSGIX(GLenum face, GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentMaterialiSGIX);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentMaterialiSGIX(face, pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FragmentMaterialivSGIX(GLenum face, GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FragmentMaterialivSGIX);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FragmentMaterialivSGIX(face, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetFragmentLightfvSGIX(GLenum light, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetFragmentLightfvSGIX);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetFragmentLightfvSGIX(light, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetFragmentLightivSGIX(GLenum light, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetFragmentLightivSGIX);
+      _gldTraceU32(light);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetFragmentLightivSGIX(light, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetFragmentMaterialfvSGIX(GLenum face, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetFragmentMaterialfvSGIX);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetFragmentMaterialfvSGIX(face, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetFragmentMaterialivSGIX(GLenum face, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetFragmentMaterialivSGIX);
+      _gldTraceU32(face);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetFragmentMaterialivSGIX(face, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LightEnviSGIX(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LightEnviSGIX);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LightEnviSGIX(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexWeightfEXT(GLfloat weight)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexWeightfEXT);
+      _gldTraceF32(weight);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexWeightfEXT(weight);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexWeightfvEXT(const GLfloat *weight)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexWeightfvEXT);
+      _gldTraceIn(weight, 1 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexWeightfvEXT(weight);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexWeightPointerEXT(GLsizei size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexWeightPointerEXT);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexWeightPointerEXT(size, type, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FlushVertexArrayRangeNV(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FlushVertexArrayRangeNV);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FlushVertexArrayRangeNV();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexArrayRangeNV(GLsizei length, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexArrayRangeNV);
+      _gldTraceUnsupported();
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexArrayRangeNV(length, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CombinerParameterfvNV(GLenum pname, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CombinerParameterfvNV);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CombinerParameterfvNV(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CombinerParameterfNV(GLenum pname, GLfloat param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CombinerParameterfNV);
+      _gldTraceU32(pname);
+      _gldTraceF32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CombinerParameterfNV(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CombinerParameterivNV(GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CombinerParameterivNV);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CombinerParameterivNV(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CombinerParameteriNV(GLenum pname, GLint param)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CombinerParameteriNV);
+      _gldTraceU32(pname);
+      _gldTraceS32(param);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CombinerParameteriNV(pname, param);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CombinerInputNV(GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CombinerInputNV);
+      _gldTraceU32(stage);
+      _gldTraceU32(portion);
+      _gldTraceU32(variable);
+      _gldTraceU32(input);
+      _gldTraceU32(mapping);
+      _gldTraceU32(componentUsage);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CombinerInputNV(stage, portion, variable, input, mapping, componentUsage);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CombinerOutputNV(GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CombinerOutputNV);
+      _gldTraceU32(stage);
+      _gldTraceU32(portion);
+      _gldTraceU32(abOutput);
+      _gldTraceU32(cdOutput);
+      _gldTraceU32(sumOutput);
+      _gldTraceU32(scale);
+      _gldTraceU32(bias);
+      _gldTraceU32(abDotProduct);
+      _gldTraceU32(cdDotProduct);
+      _gldTraceU32(muxSum);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CombinerOutputNV(stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FinalCombinerInputNV(GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FinalCombinerInputNV);
+      _gldTraceU32(variable);
+      _gldTraceU32(input);
+      _gldTraceU32(mapping);
+      _gldTraceU32(componentUsage);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FinalCombinerInputNV(variable, input, mapping, componentUsage);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetCombinerInputParameterfvNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetCombinerInputParameterfvNV);
+      _gldTraceU32(stage);
+      _gldTraceU32(portion);
+      _gldTraceU32(variable);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetCombinerInputParameterfvNV(stage, portion, variable, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetCombinerInputParameterivNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetCombinerInputParameterivNV);
+      _gldTraceU32(stage);
+      _gldTraceU32(portion);
+      _gldTraceU32(variable);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetCombinerInputParameterivNV(stage, portion, variable, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetCombinerOutputParameterfvNV(GLenum stage, GLenum portion, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetCombinerOutputParameterfvNV);
+      _gldTraceU32(stage);
+      _gldTraceU32(portion);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetCombinerOutputParameterfvNV(stage, portion, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetCombinerOutputParameterivNV(GLenum stage, GLenum portion, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetCombinerOutputParameterivNV);
+      _gldTraceU32(stage);
+      _gldTraceU32(portion);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetCombinerOutputParameterivNV(stage, portion, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetFinalCombinerInputParameterfvNV(GLenum variable, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetFinalCombinerInputParameterfvNV);
+      _gldTraceU32(variable);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetFinalCombinerInputParameterfvNV(variable, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetFinalCombinerInputParameterivNV(GLenum variable, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetFinalCombinerInputParameterivNV);
+      _gldTraceU32(variable);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetFinalCombinerInputParameterivNV(variable, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ResizeBuffersMESA(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ResizeBuffersMESA);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ResizeBuffersMESA();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos2dMESA(GLdouble x, GLdouble y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos2dMESA);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos2dMESA(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos2dvMESA(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos2dvMESA);
+      _gldTraceIn(v, 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos2dvMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos2fMESA(GLfloat x, GLfloat y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos2fMESA);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos2fMESA(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos2fvMESA(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos2fvMESA);
+      _gldTraceIn(v, 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos2fvMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos2iMESA(GLint x, GLint y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos2iMESA);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos2iMESA(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos2ivMESA(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos2ivMESA);
+      _gldTraceIn(v, 2 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos2ivMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos2sMESA(GLshort x, GLshort y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos2sMESA);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos2sMESA(x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos2svMESA(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos2svMESA);
+      _gldTraceIn(v, 2 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos2svMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos3dMESA(GLdouble x, GLdouble y, GLdouble z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos3dMESA);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos3dMESA(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos3dvMESA(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos3dvMESA);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos3dvMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos3fMESA(GLfloat x, GLfloat y, GLfloat z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos3fMESA);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos3fMESA(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos3fvMESA(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos3fvMESA);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos3fvMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos3iMESA(GLint x, GLint y, GLint z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos3iMESA);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos3iMESA(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos3ivMESA(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos3ivMESA);
+      _gldTraceIn(v, 3 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos3ivMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos3sMESA(GLshort x, GLshort y, GLshort z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos3sMESA);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos3sMESA(x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos3svMESA(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos3svMESA);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos3svMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos4dMESA(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos4dMESA);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceF64(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos4dMESA(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos4dvMESA(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos4dvMESA);
+      _gldTraceIn(v, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos4dvMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos4fMESA(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos4fMESA);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceF32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos4fMESA(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos4fvMESA(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos4fvMESA);
+      _gldTraceIn(v, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos4fvMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos4iMESA(GLint x, GLint y, GLint z, GLint w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos4iMESA);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceS32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos4iMESA(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos4ivMESA(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos4ivMESA);
+      _gldTraceIn(v, 4 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos4ivMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos4sMESA(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos4sMESA);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceS32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos4sMESA(x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_WindowPos4svMESA(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_WindowPos4svMESA);
+      _gldTraceIn(v, 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->WindowPos4svMESA(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_BlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BlendFuncSeparateEXT);
+      _gldTraceU32(sfactorRGB);
+      _gldTraceU32(dfactorRGB);
+      _gldTraceU32(sfactorAlpha);
+      _gldTraceU32(dfactorAlpha);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BlendFuncSeparateEXT(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_IndexMaterialEXT(GLenum face, GLenum mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IndexMaterialEXT);
+      _gldTraceU32(face);
+      _gldTraceU32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->IndexMaterialEXT(face, mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_IndexFuncEXT(GLenum func, GLclampf ref)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IndexFuncEXT);
+      _gldTraceU32(func);
+      _gldTraceF32(ref);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->IndexFuncEXT(func, ref);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_LockArraysEXT(GLint first, GLsizei count)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LockArraysEXT);
+      _gldTraceS32(first);
+      _gldTraceS32(count);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LockArraysEXT(first, count);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_UnlockArraysEXT(void)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_UnlockArraysEXT);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->UnlockArraysEXT();
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CullParameterdvEXT(GLenum pname, GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CullParameterdvEXT);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CullParameterdvEXT(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CullParameterfvEXT(GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CullParameterfvEXT);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CullParameterfvEXT(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_HintPGI(GLenum target, GLint mode)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_HintPGI);
+      _gldTraceU32(target);
+      _gldTraceS32(mode);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->HintPGI(target, mode);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FogCoordfEXT(GLfloat coord)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FogCoordfEXT);
+      _gldTraceF32(coord);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FogCoordfEXT(coord);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FogCoordfvEXT(const GLfloat *coord)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FogCoordfvEXT);
+      _gldTraceIn(coord, 1 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FogCoordfvEXT(coord);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FogCoorddEXT(GLdouble coord)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FogCoorddEXT);
+      _gldTraceF64(coord);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FogCoorddEXT(coord);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FogCoorddvEXT(const GLdouble *coord)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FogCoorddvEXT);
+      _gldTraceIn(coord, 1 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FogCoorddvEXT(coord);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FogCoordPointerEXT(GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FogCoordPointerEXT);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FogCoordPointerEXT(type, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTableEXT(GLenum target, GLenum format, GLenum type, GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTableEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(format);
+      _gldTraceU32(type);
+      _gldTraceOut(data, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTableEXT(target, format, type, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTableParameterivEXT(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTableParameterivEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTableParameterivEXT(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetColorTableParameterfvEXT(GLenum target, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetColorTableParameterfvEXT);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetColorTableParameterfvEXT(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TbufferMask3DFX(GLuint mask)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TbufferMask3DFX);
+      _gldTraceU32(mask);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TbufferMask3DFX(mask);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CompressedTexImage3DARB);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceS32(depth);
+      _gldTraceS32(border);
+      _gldTraceS32(imageSize);
+      _gldTraceIn(data, imageSize);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CompressedTexImage3DARB(target, level, internalformat, width, height, depth, border, imageSize, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CompressedTexImage2DARB);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceS32(border);
+      _gldTraceS32(imageSize);
+      _gldTraceIn(data, imageSize);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CompressedTexImage2DARB(target, level, internalformat, width, height, border, imageSize, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CompressedTexImage1DARB);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceU32(internalformat);
+      _gldTraceS32(width);
+      _gldTraceS32(border);
+      _gldTraceS32(imageSize);
+      _gldTraceIn(data, imageSize);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CompressedTexImage1DARB(target, level, internalformat, width, border, imageSize, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CompressedTexSubImage3DARB);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(yoffset);
+      _gldTraceS32(zoffset);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceS32(depth);
+      _gldTraceU32(format);
+      _gldTraceS32(imageSize);
+      _gldTraceIn(data, imageSize);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CompressedTexSubImage3DARB(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CompressedTexSubImage2DARB);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(yoffset);
+      _gldTraceS32(width);
+      _gldTraceS32(height);
+      _gldTraceU32(format);
+      _gldTraceS32(imageSize);
+      _gldTraceIn(data, imageSize);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CompressedTexSubImage2DARB(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_CompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_CompressedTexSubImage1DARB);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceS32(xoffset);
+      _gldTraceS32(width);
+      _gldTraceU32(format);
+      _gldTraceS32(imageSize);
+      _gldTraceIn(data, imageSize);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->CompressedTexSubImage1DARB(target, level, xoffset, width, format, imageSize, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetCompressedTexImageARB(GLenum target, GLint level, GLvoid *img)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetCompressedTexImageARB);
+      _gldTraceU32(target);
+      _gldTraceS32(level);
+      _gldTraceOut(img, _gldTraceCompressedImageSize(target, level));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetCompressedTexImageARB(target, level, img);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3bEXT(GLbyte red, GLbyte green, GLbyte blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3bEXT);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3bEXT(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3bvEXT(const GLbyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3bvEXT);
+      _gldTraceIn(v, 3 * sizeof(GLbyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3bvEXT(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3dEXT(GLdouble red, GLdouble green, GLdouble blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3dEXT);
+      _gldTraceF64(red);
+      _gldTraceF64(green);
+      _gldTraceF64(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3dEXT(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3dvEXT(const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3dvEXT);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3dvEXT(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3fEXT(GLfloat red, GLfloat green, GLfloat blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3fEXT);
+      _gldTraceF32(red);
+      _gldTraceF32(green);
+      _gldTraceF32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3fEXT(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3fvEXT(const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3fvEXT);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3fvEXT(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3iEXT(GLint red, GLint green, GLint blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3iEXT);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3iEXT(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3ivEXT(const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3ivEXT);
+      _gldTraceIn(v, 3 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3ivEXT(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3sEXT(GLshort red, GLshort green, GLshort blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3sEXT);
+      _gldTraceS32(red);
+      _gldTraceS32(green);
+      _gldTraceS32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3sEXT(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3svEXT(const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3svEXT);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3svEXT(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3ubEXT(GLubyte red, GLubyte green, GLubyte blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3ubEXT);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3ubEXT(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3ubvEXT(const GLubyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3ubvEXT);
+      _gldTraceIn(v, 3 * sizeof(GLubyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3ubvEXT(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3uiEXT(GLuint red, GLuint green, GLuint blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3uiEXT);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3uiEXT(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3uivEXT(const GLuint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3uivEXT);
+      _gldTraceIn(v, 3 * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3uivEXT(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3usEXT(GLushort red, GLushort green, GLushort blue)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3usEXT);
+      _gldTraceU32(red);
+      _gldTraceU32(green);
+      _gldTraceU32(blue);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3usEXT(red, green, blue);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColor3usvEXT(const GLushort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColor3usvEXT);
+      _gldTraceIn(v, 3 * sizeof(GLushort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColor3usvEXT(v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SecondaryColorPointerEXT(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SecondaryColorPointerEXT);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SecondaryColorPointerEXT(size, type, stride, pointer);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_AreProgramsResidentNV(GLsizei n, const GLuint *ids, GLboolean *residences)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_AreProgramsResidentNV);
+      _gldTraceS32(n);
+      _gldTraceIn(ids, n * sizeof(GLuint));
+      _gldTraceOut(residences, n * sizeof(GLboolean));
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->AreProgramsResidentNV(n, ids, residences);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_BindProgramNV(GLenum target, GLuint id)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BindProgramNV);
+      _gldTraceU32(target);
+      _gldTraceU32(id);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BindProgramNV(target, id);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DeleteProgramsNV(GLsizei n, const GLuint *ids)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DeleteProgramsNV);
+      _gldTraceS32(n);
+      _gldTraceIn(ids, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DeleteProgramsNV(n, ids);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ExecuteProgramNV(GLenum target, GLuint id, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ExecuteProgramNV);
+      _gldTraceU32(target);
+      _gldTraceU32(id);
+      _gldTraceIn(params, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ExecuteProgramNV(target, id, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GenProgramsNV(GLsizei n, GLuint *ids)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GenProgramsNV);
+      _gldTraceS32(n);
+      _gldTraceOut(ids, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GenProgramsNV(n, ids);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramParameterdvNV(GLenum target, GLuint index, GLenum pname, GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramParameterdvNV);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramParameterdvNV(target, index, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramParameterfvNV);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramParameterfvNV(target, index, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramivNV(GLuint id, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramivNV);
+      _gldTraceU32(id);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramivNV(id, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramStringNV(GLuint id, GLenum pname, GLubyte *program)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramStringNV);
+      _gldTraceU32(id);
+      _gldTraceU32(pname);
+      _gldTraceOut(program, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramStringNV(id, pname, program);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetTrackMatrixivNV(GLenum target, GLuint address, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetTrackMatrixivNV);
+      _gldTraceU32(target);
+      _gldTraceU32(address);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetTrackMatrixivNV(target, address, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetVertexAttribdvNV(GLuint index, GLenum pname, GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetVertexAttribdvNV);
+      _gldTraceU32(index);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetVertexAttribdvNV(index, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetVertexAttribfvNV(GLuint index, GLenum pname, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetVertexAttribfvNV);
+      _gldTraceU32(index);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetVertexAttribfvNV(index, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetVertexAttribivNV(GLuint index, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetVertexAttribivNV);
+      _gldTraceU32(index);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetVertexAttribivNV(index, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetVertexAttribPointervNV(GLuint index, GLenum pname, GLvoid **pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetVertexAttribPointervNV);
+      _gldTraceU32(index);
+      _gldTraceU32(pname);
+      _gldTraceOut(pointer, 16 * sizeof(GLvoid *));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetVertexAttribPointervNV(index, pname, pointer);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_IsProgramNV(GLuint id)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IsProgramNV);
+      _gldTraceU32(id);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->IsProgramNV(id);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_LoadProgramNV(GLenum target, GLuint id, GLsizei len, const GLubyte *program)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_LoadProgramNV);
+      _gldTraceU32(target);
+      _gldTraceU32(id);
+      _gldTraceS32(len);
+      _gldTraceIn(program, len);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->LoadProgramNV(target, id, len, program);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramParameter4dNV(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramParameter4dNV);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceF64(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramParameter4dNV(target, index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramParameter4dvNV(GLenum target, GLuint index, const GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramParameter4dvNV);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceIn(params, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramParameter4dvNV(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramParameter4fNV(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramParameter4fNV);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceF32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramParameter4fNV(target, index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramParameter4fvNV(GLenum target, GLuint index, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramParameter4fvNV);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceIn(params, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramParameter4fvNV(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramParameters4dvNV(GLenum target, GLuint index, GLuint num, const GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramParameters4dvNV);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceU32(num);
+      _gldTraceIn(params, num * 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramParameters4dvNV(target, index, num, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramParameters4fvNV(GLenum target, GLuint index, GLuint num, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramParameters4fvNV);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceU32(num);
+      _gldTraceIn(params, num * 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramParameters4fvNV(target, index, num, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_RequestResidentProgramsNV(GLsizei n, const GLuint *ids)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_RequestResidentProgramsNV);
+      _gldTraceS32(n);
+      _gldTraceIn(ids, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->RequestResidentProgramsNV(n, ids);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_TrackMatrixNV(GLenum target, GLuint address, GLenum matrix, GLenum transform)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TrackMatrixNV);
+      _gldTraceU32(target);
+      _gldTraceU32(address);
+      _gldTraceU32(matrix);
+      _gldTraceU32(transform);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->TrackMatrixNV(target, address, matrix, transform);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribPointerNV(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribPointerNV);
+      _gldTraceU32(index);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribPointerNV(index, size, type, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib1dNV(GLuint index, GLdouble x)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib1dNV);
+      _gldTraceU32(index);
+      _gldTraceF64(x);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib1dNV(index, x);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib1dvNV(GLuint index, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib1dvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 1 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib1dvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib1fNV(GLuint index, GLfloat x)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib1fNV);
+      _gldTraceU32(index);
+      _gldTraceF32(x);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib1fNV(index, x);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib1fvNV(GLuint index, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib1fvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 1 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib1fvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib1sNV(GLuint index, GLshort x)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib1sNV);
+      _gldTraceU32(index);
+      _gldTraceS32(x);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib1sNV(index, x);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib1svNV(GLuint index, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib1svNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 1 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib1svNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib2dNV(GLuint index, GLdouble x, GLdouble y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib2dNV);
+      _gldTraceU32(index);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib2dNV(index, x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib2dvNV(GLuint index, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib2dvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib2dvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib2fNV(GLuint index, GLfloat x, GLfloat y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib2fNV);
+      _gldTraceU32(index);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib2fNV(index, x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib2fvNV(GLuint index, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib2fvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib2fvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib2sNV(GLuint index, GLshort x, GLshort y)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib2sNV);
+      _gldTraceU32(index);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib2sNV(index, x, y);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib2svNV(GLuint index, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib2svNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 2 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib2svNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib3dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib3dNV);
+      _gldTraceU32(index);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib3dNV(index, x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib3dvNV(GLuint index, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib3dvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib3dvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib3fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib3fNV);
+      _gldTraceU32(index);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib3fNV(index, x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib3fvNV(GLuint index, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib3fvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib3fvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib3sNV(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib3sNV);
+      _gldTraceU32(index);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib3sNV(index, x, y, z);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib3svNV(GLuint index, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib3svNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib3svNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4dNV);
+      _gldTraceU32(index);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceF64(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4dNV(index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4dvNV(GLuint index, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4dvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4dvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4fNV);
+      _gldTraceU32(index);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceF32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4fNV(index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4fvNV(GLuint index, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4fvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4fvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4sNV(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4sNV);
+      _gldTraceU32(index);
+      _gldTraceS32(x);
+      _gldTraceS32(y);
+      _gldTraceS32(z);
+      _gldTraceS32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4sNV(index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4svNV(GLuint index, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4svNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4svNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4ubNV(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4ubNV);
+      _gldTraceU32(index);
+      _gldTraceU32(x);
+      _gldTraceU32(y);
+      _gldTraceU32(z);
+      _gldTraceU32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4ubNV(index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4ubvNV(GLuint index, const GLubyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4ubvNV);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLubyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4ubvNV(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs1dvNV(GLuint index, GLsizei n, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs1dvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 1 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs1dvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs1fvNV(GLuint index, GLsizei n, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs1fvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 1 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs1fvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs1svNV(GLuint index, GLsizei n, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs1svNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 1 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs1svNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs2dvNV(GLuint index, GLsizei n, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs2dvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 2 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs2dvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs2fvNV(GLuint index, GLsizei n, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs2fvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 2 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs2fvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs2svNV(GLuint index, GLsizei n, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs2svNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 2 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs2svNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs3dvNV(GLuint index, GLsizei n, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs3dvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 3 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs3dvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs3fvNV(GLuint index, GLsizei n, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs3fvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 3 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs3fvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs3svNV(GLuint index, GLsizei n, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs3svNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 3 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs3svNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs4dvNV(GLuint index, GLsizei n, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs4dvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs4dvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs4fvNV(GLuint index, GLsizei n, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs4fvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs4fvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs4svNV(GLuint index, GLsizei n, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs4svNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs4svNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribs4ubvNV(GLuint index, GLsizei n, const GLubyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribs4ubvNV);
+      _gldTraceU32(index);
+      _gldTraceS32(n);
+      _gldTraceIn(v, n * 4 * sizeof(GLubyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribs4ubvNV(index, n, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PointParameteriNV(GLenum pname, GLint params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PointParameteriNV);
+      _gldTraceU32(pname);
+      _gldTraceS32(params);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PointParameteriNV(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_PointParameterivNV(GLenum pname, const GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_PointParameterivNV);
+      _gldTraceU32(pname);
+      _gldTraceIn(params, _gldTraceParamCount(pname) * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->PointParameterivNV(pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiDrawArraysEXT(GLenum mode, GLint *first, GLsizei *count, GLsizei primcount)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceMultiDrawArrays(mode, first, count, primcount);
+   }
+   _GLD_TRACE_REAL->MultiDrawArraysEXT(mode, first, count, primcount);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiDrawElementsEXT(GLenum mode, const GLsizei *count, GLenum type, const GLvoid **indices, GLsizei primcount)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceMultiDrawElements(mode, count, type, indices, primcount);
+   }
+   _GLD_TRACE_REAL->MultiDrawElementsEXT(mode, count, type, indices, primcount);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ActiveStencilFaceEXT(GLenum face)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ActiveStencilFaceEXT);
+      _gldTraceU32(face);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ActiveStencilFaceEXT(face);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DeleteFencesNV(GLsizei n, const GLuint *fences)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DeleteFencesNV);
+      _gldTraceS32(n);
+      _gldTraceIn(fences, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DeleteFencesNV(n, fences);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GenFencesNV(GLsizei n, GLuint *fences)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GenFencesNV);
+      _gldTraceS32(n);
+      _gldTraceOut(fences, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GenFencesNV(n, fences);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_IsFenceNV(GLuint fence)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IsFenceNV);
+      _gldTraceU32(fence);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->IsFenceNV(fence);
+   _gldTraceExit();
+   return ret;
+}
+
+static GLboolean GLAPIENTRY _gldTrace_TestFenceNV(GLuint fence)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_TestFenceNV);
+      _gldTraceU32(fence);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->TestFenceNV(fence);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_GetFenceivNV(GLuint fence, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetFenceivNV);
+      _gldTraceU32(fence);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetFenceivNV(fence, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_FinishFenceNV(GLuint fence)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_FinishFenceNV);
+      _gldTraceU32(fence);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->FinishFenceNV(fence);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_SetFenceNV(GLuint fence, GLenum condition)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_SetFenceNV);
+      _gldTraceU32(fence);
+      _gldTraceU32(condition);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->SetFenceNV(fence, condition);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4bvARB(GLuint index, const GLbyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4bvARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLbyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4bvARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4ivARB(GLuint index, const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4ivARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4ivARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4ubvARB(GLuint index, const GLubyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4ubvARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLubyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4ubvARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4usvARB(GLuint index, const GLushort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4usvARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLushort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4usvARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4uivARB(GLuint index, const GLuint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4uivARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4uivARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4NbvARB(GLuint index, const GLbyte *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4NbvARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLbyte));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4NbvARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4NsvARB(GLuint index, const GLshort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4NsvARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLshort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4NsvARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4NivARB(GLuint index, const GLint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4NivARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4NivARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4NusvARB(GLuint index, const GLushort *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4NusvARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLushort));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4NusvARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttrib4NuivARB(GLuint index, const GLuint *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttrib4NuivARB);
+      _gldTraceU32(index);
+      _gldTraceIn(v, 4 * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttrib4NuivARB(index, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_VertexAttribPointerARB(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_VertexAttribPointerARB);
+      _gldTraceU32(index);
+      _gldTraceS32(size);
+      _gldTraceU32(type);
+      _gldTraceU32(normalized);
+      _gldTraceS32(stride);
+      _gldTraceArrayPointer(pointer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->VertexAttribPointerARB(index, size, type, normalized, stride, pointer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EnableVertexAttribArrayARB(GLuint index)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EnableVertexAttribArrayARB);
+      _gldTraceU32(index);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EnableVertexAttribArrayARB(index);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DisableVertexAttribArrayARB(GLuint index)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DisableVertexAttribArrayARB);
+      _gldTraceU32(index);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DisableVertexAttribArrayARB(index);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramStringARB(GLenum target, GLenum format, GLsizei len, const GLvoid *string)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramStringARB);
+      _gldTraceU32(target);
+      _gldTraceU32(format);
+      _gldTraceS32(len);
+      _gldTraceIn(string, len);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramStringARB(target, format, len, string);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramEnvParameter4dARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceF64(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramEnvParameter4dARB(target, index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramEnvParameter4dvARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceIn(params, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramEnvParameter4dvARB(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramEnvParameter4fARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceF32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramEnvParameter4fARB(target, index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramEnvParameter4fvARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceIn(params, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramEnvParameter4fvARB(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramLocalParameter4dARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceF64(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramLocalParameter4dARB(target, index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramLocalParameter4dvARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceIn(params, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramLocalParameter4dvARB(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramLocalParameter4fARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceF32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramLocalParameter4fARB(target, index, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramLocalParameter4fvARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceIn(params, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramLocalParameter4fvARB(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramEnvParameterdvARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceOut(params, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramEnvParameterdvARB(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramEnvParameterfvARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramEnvParameterfvARB(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramLocalParameterdvARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceOut(params, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramLocalParameterdvARB(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramLocalParameterfvARB);
+      _gldTraceU32(target);
+      _gldTraceU32(index);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramLocalParameterfvARB(target, index, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramivARB(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramivARB);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramivARB(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramStringARB(GLenum target, GLenum pname, GLvoid *string)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramStringARB);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(string, 0);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramStringARB(target, pname, string);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramNamedParameter4fNV(GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramNamedParameter4fNV);
+      _gldTraceU32(id);
+      _gldTraceS32(len);
+      _gldTraceIn(name, len);
+      _gldTraceF32(x);
+      _gldTraceF32(y);
+      _gldTraceF32(z);
+      _gldTraceF32(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramNamedParameter4fNV(id, len, name, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramNamedParameter4dNV(GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramNamedParameter4dNV);
+      _gldTraceU32(id);
+      _gldTraceS32(len);
+      _gldTraceIn(name, len);
+      _gldTraceF64(x);
+      _gldTraceF64(y);
+      _gldTraceF64(z);
+      _gldTraceF64(w);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramNamedParameter4dNV(id, len, name, x, y, z, w);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramNamedParameter4fvNV(GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramNamedParameter4fvNV);
+      _gldTraceU32(id);
+      _gldTraceS32(len);
+      _gldTraceIn(name, 4 * sizeof(GLubyte));
+      _gldTraceIn(v, 4 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramNamedParameter4fvNV(id, len, name, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_ProgramNamedParameter4dvNV(GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_ProgramNamedParameter4dvNV);
+      _gldTraceU32(id);
+      _gldTraceS32(len);
+      _gldTraceIn(name, 4 * sizeof(GLubyte));
+      _gldTraceIn(v, 4 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->ProgramNamedParameter4dvNV(id, len, name, v);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramNamedParameterfvNV(GLuint id, GLsizei len, const GLubyte *name, GLfloat *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramNamedParameterfvNV);
+      _gldTraceU32(id);
+      _gldTraceS32(len);
+      _gldTraceIn(name, len);
+      _gldTraceOut(params, 16 * sizeof(GLfloat));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramNamedParameterfvNV(id, len, name, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetProgramNamedParameterdvNV(GLuint id, GLsizei len, const GLubyte *name, GLdouble *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetProgramNamedParameterdvNV);
+      _gldTraceU32(id);
+      _gldTraceS32(len);
+      _gldTraceIn(name, len);
+      _gldTraceOut(params, 16 * sizeof(GLdouble));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetProgramNamedParameterdvNV(id, len, name, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_BindBufferARB(GLenum target, GLuint buffer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BindBufferARB);
+      _gldTraceU32(target);
+      _gldTraceU32(buffer);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BindBufferARB(target, buffer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_BufferDataARB(GLenum target, GLsizeiptrARB size, const GLvoid *data, GLenum usage)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BufferDataARB);
+      _gldTraceU32(target);
+      _gldTraceS64(size);
+      _gldTraceIn(data, size);
+      _gldTraceU32(usage);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BufferDataARB(target, size, data, usage);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_BufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const GLvoid *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BufferSubDataARB);
+      _gldTraceU32(target);
+      _gldTraceS64(offset);
+      _gldTraceS64(size);
+      _gldTraceIn(data, size);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BufferSubDataARB(target, offset, size, data);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DeleteBuffersARB(GLsizei n, const GLuint *buffer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DeleteBuffersARB);
+      _gldTraceS32(n);
+      _gldTraceIn(buffer, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DeleteBuffersARB(n, buffer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GenBuffersARB(GLsizei n, GLuint *buffer)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GenBuffersARB);
+      _gldTraceS32(n);
+      _gldTraceOut(buffer, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GenBuffersARB(n, buffer);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetBufferParameterivARB(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetBufferParameterivARB);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetBufferParameterivARB(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetBufferPointervARB(GLenum target, GLenum pname, GLvoid **params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetBufferPointervARB);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLvoid *));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetBufferPointervARB(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, void *data)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetBufferSubDataARB);
+      _gldTraceU32(target);
+      _gldTraceS64(offset);
+      _gldTraceS64(size);
+      _gldTraceOut(data, size);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetBufferSubDataARB(target, offset, size, data);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_IsBufferARB(GLuint buffer)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IsBufferARB);
+      _gldTraceU32(buffer);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->IsBufferARB(buffer);
+   _gldTraceExit();
+   return ret;
+}
+
+static void * GLAPIENTRY _gldTrace_MapBufferARB(GLenum target, GLenum access)
+{
+   void * ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MapBufferARB);
+      _gldTraceU32(target);
+      _gldTraceU32(access);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->MapBufferARB(target, access);
+   _gldTraceExit();
+   return ret;
+}
+
+static GLboolean GLAPIENTRY _gldTrace_UnmapBufferARB(GLenum target)
+{
+   GLboolean ret;
+   GLboolean bWrite = GL_FALSE;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      bWrite = _gldTraceMappedForWrite(target);
+      _gldTraceBeginOp(_gloffset_UnmapBufferARB);
+      _gldTraceU32(target);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->UnmapBufferARB(target);
+   if (bTrace)
+      if (bWrite) _gldTraceBufferContents(target);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_DepthBoundsEXT(GLclampd zmin, GLclampd zmax)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DepthBoundsEXT);
+      _gldTraceF64(zmin);
+      _gldTraceF64(zmax);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DepthBoundsEXT(zmin, zmax);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GenQueriesARB(GLsizei n, GLuint *ids)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GenQueriesARB);
+      _gldTraceS32(n);
+      _gldTraceOut(ids, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GenQueriesARB(n, ids);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_DeleteQueriesARB(GLsizei n, const GLuint *ids)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_DeleteQueriesARB);
+      _gldTraceS32(n);
+      _gldTraceIn(ids, n * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->DeleteQueriesARB(n, ids);
+   _gldTraceExit();
+}
+
+static GLboolean GLAPIENTRY _gldTrace_IsQueryARB(GLuint id)
+{
+   GLboolean ret;
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_IsQueryARB);
+      _gldTraceU32(id);
+      _gldTraceEndOp();
+   }
+   ret = _GLD_TRACE_REAL->IsQueryARB(id);
+   _gldTraceExit();
+   return ret;
+}
+
+static void GLAPIENTRY _gldTrace_BeginQueryARB(GLenum target, GLuint id)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_BeginQueryARB);
+      _gldTraceU32(target);
+      _gldTraceU32(id);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->BeginQueryARB(target, id);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_EndQueryARB(GLenum target)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_EndQueryARB);
+      _gldTraceU32(target);
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->EndQueryARB(target);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetQueryivARB(GLenum target, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetQueryivARB);
+      _gldTraceU32(target);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetQueryivARB(target, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetQueryObjectivARB(GLuint id, GLenum pname, GLint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetQueryObjectivARB);
+      _gldTraceU32(id);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetQueryObjectivARB(id, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_GetQueryObjectuivARB(GLuint id, GLenum pname, GLuint *params)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_GetQueryObjectuivARB);
+      _gldTraceU32(id);
+      _gldTraceU32(pname);
+      _gldTraceOut(params, 16 * sizeof(GLuint));
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->GetQueryObjectuivARB(id, pname, params);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiModeDrawArraysIBM(const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiModeDrawArraysIBM);
+      _gldTraceUnsupported();
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiModeDrawArraysIBM(mode, first, count, primcount, modestride);
+   _gldTraceExit();
+}
+
+static void GLAPIENTRY _gldTrace_MultiModeDrawElementsIBM(const GLenum *mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, GLint modestride)
+{
+   GLboolean bTrace = _gldTraceEnter();
+   if (bTrace) {
+      _gldTraceBeginOp(_gloffset_MultiModeDrawElementsIBM);
+      _gldTraceUnsupported();
+      _gldTraceEndOp();
+   }
+   _GLD_TRACE_REAL->MultiModeDrawElementsIBM(mode, count, type, indices, primcount, modestride);
+   _gldTraceExit();
+}
+
+static void _gldTraceInitTable(struct _glapi_table *t)
+{
+   t->NewList = _gldTrace_NewList;
+   t->EndList = _gldTrace_EndList;
+   t->CallList = _gldTrace_CallList;
+   t->CallLists = _gldTrace_CallLists;
+   t->DeleteLists = _gldTrace_DeleteLists;
+   t->GenLists = _gldTrace_GenLists;
+   t->ListBase = _gldTrace_ListBase;
+   t->Begin = _gldTrace_Begin;
+   t->Bitmap = _gldTrace_Bitmap;
+   t->Color3b = _gldTrace_Color3b;
+   t->Color3bv = _gldTrace_Color3bv;
+   t->Color3d = _gldTrace_Color3d;
+   t->Color3dv = _gldTrace_Color3dv;
+   t->Color3f = _gldTrace_Color3f;
+   t->Color3fv = _gldTrace_Color3fv;
+   t->Color3i = _gldTrace_Color3i;
+   t->Color3iv = _gldTrace_Color3iv;
+   t->Color3s = _gldTrace_Color3s;
+   t->Color3sv = _gldTrace_Color3sv;
+   t->Color3ub = _gldTrace_Color3ub;
+   t->Color3ubv = _gldTrace_Color3ubv;
+   t->Color3ui = _gldTrace_Color3ui;
+   t->Color3uiv = _gldTrace_Color3uiv;
+   t->Color3us = _gldTrace_Color3us;
+   t->Color3usv = _gldTrace_Color3usv;
+   t->Color4b = _gldTrace_Color4b;
+   t->Color4bv = _gldTrace_Color4bv;
+   t->Color4d = _gldTrace_Color4d;
+   t->Color4dv = _gldTrace_Color4dv;
+   t->Color4f = _gldTrace_Color4f;
+   t->Color4fv = _gldTrace_Color4fv;
+   t->Color4i = _gldTrace_Color4i;
+   t->Color4iv = _gldTrace_Color4iv;
+   t->Color4s = _gldTrace_Color4s;
+   t->Color4sv = _gldTrace_Color4sv;
+   t->Color4ub = _gldTrace_Color4ub;
+   t->Color4ubv = _gldTrace_Color4ubv;
+   t->Color4ui = _gldTrace_Color4ui;
+   t->Color4uiv = _gldTrace_Color4uiv;
+   t->Color4us = _gldTrace_Color4us;
+   t->Color4usv = _gldTrace_Color4usv;
+   t->EdgeFlag = _gldTrace_EdgeFlag;
+   t->EdgeFlagv = _gldTrace_EdgeFlagv;
+   t->End = _gldTrace_End;
+   t->Indexd = _gldTrace_Indexd;
+   t->Indexdv = _gldTrace_Indexdv;
+   t->Indexf = _gldTrace_Indexf;
+   t->Indexfv = _gldTrace_Indexfv;
+   t->Indexi = _gldTrace_Indexi;
+   t->Indexiv = _gldTrace_Indexiv;
+   t->Indexs = _gldTrace_Indexs;
+   t->Indexsv = _gldTrace_Indexsv;
+   t->Normal3b = _gldTrace_Normal3b;
+   t->Normal3bv = _gldTrace_Normal3bv;
+   t->Normal3d = _gldTrace_Normal3d;
+   t->Normal3dv = _gldTrace_Normal3dv;
+   t->Normal3f = _gldTrace_Normal3f;
+   t->Normal3fv = _gldTrace_Normal3fv;
+   t->Normal3i = _gldTrace_Normal3i;
+   t->Normal3iv = _gldTrace_Normal3iv;
+   t->Normal3s = _gldTrace_Normal3s;
+   t->Normal3sv = _gldTrace_Normal3sv;
+   t->RasterPos2d = _gldTrace_RasterPos2d;
+   t->RasterPos2dv = _gldTrace_RasterPos2dv;
+   t->RasterPos2f = _gldTrace_RasterPos2f;
+   t->RasterPos2fv = _gldTrace_RasterPos2fv;
+   t->RasterPos2i = _gldTrace_RasterPos2i;
+   t->RasterPos2iv = _gldTrace_RasterPos2iv;
+   t->RasterPos2s = _gldTrace_RasterPos2s;
+   t->RasterPos2sv = _gldTrace_RasterPos2sv;
+   t->RasterPos3d = _gldTrace_RasterPos3d;
+   t->RasterPos3dv = _gldTrace_RasterPos3dv;
+   t->RasterPos3f = _gldTrace_RasterPos3f;
+   t->RasterPos3fv = _gldTrace_RasterPos3fv;
+   t->RasterPos3i = _gldTrace_RasterPos3i;
+   t->RasterPos3iv = _gldTrace_RasterPos3iv;
+   t->RasterPos3s = _gldTrace_RasterPos3s;
+   t->RasterPos3sv = _gldTrace_RasterPos3sv;
+   t->RasterPos4d = _gldTrace_RasterPos4d;
+   t->RasterPos4dv = _gldTrace_RasterPos4dv;
+   t->RasterPos4f = _gldTrace_RasterPos4f;
+   t->RasterPos4fv = _gldTrace_RasterPos4fv;
+   t->RasterPos4i = _gldTrace_RasterPos4i;
+   t->RasterPos4iv = _gldTrace_RasterPos4iv;
+   t->RasterPos4s = _gldTrace_RasterPos4s;
+   t->RasterPos4sv = _gldTrace_RasterPos4sv;
+   t->Rectd = _gldTrace_Rectd;
+   t->Rectdv = _gldTrace_Rectdv;
+   t->Rectf = _gldTrace_Rectf;
+   t->Rectfv = _gldTrace_Rectfv;
+   t->Recti = _gldTrace_Recti;
+   t->Rectiv = _gldTrace_Rectiv;
+   t->Rects = _gldTrace_Rects;
+   t->Rectsv = _gldTrace_Rectsv;
+   t->TexCoord1d = _gldTrace_TexCoord1d;
+   t->TexCoord1dv = _gldTrace_TexCoord1dv;
+   t->TexCoord1f = _gldTrace_TexCoord1f;
+   t->TexCoord1fv = _gldTrace_TexCoord1fv;
+   t->TexCoord1i = _gldTrace_TexCoord1i;
+   t->TexCoord1iv = _gldTrace_TexCoord1iv;
+   t->TexCoord1s = _gldTrace_TexCoord1s;
+   t->TexCoord1sv = _gldTrace_TexCoord1sv;
+   t->TexCoord2d = _gldTrace_TexCoord2d;
+   t->TexCoord2dv = _gldTrace_TexCoord2dv;
+   t->TexCoord2f = _gldTrace_TexCoord2f;
+   t->TexCoord2fv = _gldTrace_TexCoord2fv;
+   t->TexCoord2i = _gldTrace_TexCoord2i;
+   t->TexCoord2iv = _gldTrace_TexCoord2iv;
+   t->TexCoord2s = _gldTrace_TexCoord2s;
+   t->TexCoord2sv = _gldTrace_TexCoord2sv;
+   t->TexCoord3d = _gldTrace_TexCoord3d;
+   t->TexCoord3dv = _gldTrace_TexCoord3dv;
+   t->TexCoord3f = _gldTrace_TexCoord3f;
+   t->TexCoord3fv = _gldTrace_TexCoord3fv;
+   t->TexCoord3i = _gldTrace_TexCoord3i;
+   t->TexCoord3iv = _gldTrace_TexCoord3iv;
+   t->TexCoord3s = _gldTrace_TexCoord3s;
+   t->TexCoord3sv = _gldTrace_TexCoord3sv;
+   t->TexCoord4d = _gldTrace_TexCoord4d;
+   t->TexCoord4dv = _gldTrace_TexCoord4dv;
+   t->TexCoord4f = _gldTrace_TexCoord4f;
+   t->TexCoord4fv = _gldTrace_TexCoord4fv;
+   t->TexCoord4i = _gldTrace_TexCoord4i;
+   t->TexCoord4iv = _gldTrace_TexCoord4iv;
+   t->TexCoord4s = _gldTrace_TexCoord4s;
+   t->TexCoord4sv = _gldTrace_TexCoord4sv;
+   t->Vertex2d = _gldTrace_Vertex2d;
+   t->Vertex2dv = _gldTrace_Vertex2dv;
+   t->Vertex2f = _gldTrace_Vertex2f;
+   t->Vertex2fv = _gldTrace_Vertex2fv;
+   t->Vertex2i = _gldTrace_Vertex2i;
+   t->Vertex2iv = _gldTrace_Vertex2iv;
+   t->Vertex2s = _gldTrace_Vertex2s;
+   t->Vertex2sv = _gldTrace_Vertex2sv;
+   t->Vertex3d = _gldTrace_Vertex3d;
+   t->Vertex3dv = _gldTrace_Vertex3dv;
+   t->Vertex3f = _gldTrace_Vertex3f;
+   t->Vertex3fv = _gldTrace_Vertex3fv;
+   t->Vertex3i = _gldTrace_Vertex3i;
+   t->Vertex3iv = _gldTrace_Vertex3iv;
+   t->Vertex3s = _gldTrace_Vertex3s;
+   t->Vertex3sv = _gldTrace_Vertex3sv;
+   t->Vertex4d = _gldTrace_Vertex4d;
+   t->Vertex4dv = _gldTrace_Vertex4dv;
+   t->Vertex4f = _gldTrace_Vertex4f;
+   t->Vertex4fv = _gldTrace_Vertex4fv;
+   t->Vertex4i = _gldTrace_Vertex4i;
+   t->Vertex4iv = _gldTrace_Vertex4iv;
+   t->Vertex4s = _gldTrace_Vertex4s;
+   t->Vertex4sv = _gldTrace_Vertex4sv;
+   t->ClipPlane = _gldTrace_ClipPlane;
+   t->ColorMaterial = _gldTrace_ColorMaterial;
+   t->CullFace = _gldTrace_CullFace;
+   t->Fogf = _gldTrace_Fogf;
+   t->Fogfv = _gldTrace_Fogfv;
+   t->Fogi = _gldTrace_Fogi;
+   t->Fogiv = _gldTrace_Fogiv;
+   t->FrontFace = _gldTrace_FrontFace;
+   t->Hint = _gldTrace_Hint;
+   t->Lightf = _gldTrace_Lightf;
+   t->Lightfv = _gldTrace_Lightfv;
+   t->Lighti = _gldTrace_Lighti;
+   t->Lightiv = _gldTrace_Lightiv;
+   t->LightModelf = _gldTrace_LightModelf;
+   t->LightModelfv = _gldTrace_LightModelfv;
+   t->LightModeli = _gldTrace_LightModeli;
+   t->LightModeliv = _gldTrace_LightModeliv;
+   t->LineStipple = _gldTrace_LineStipple;
+   t->LineWidth = _gldTrace_LineWidth;
+   t->Materialf = _gldTrace_Materialf;
+   t->Materialfv = _gldTrace_Materialfv;
+   t->Materiali = _gldTrace_Materiali;
+   t->Materialiv = _gldTrace_Materialiv;
+   t->PointSize = _gldTrace_PointSize;
+   t->PolygonMode = _gldTrace_PolygonMode;
+   t->PolygonStipple = _gldTrace_PolygonStipple;
+   t->Scissor = _gldTrace_Scissor;
+   t->ShadeModel = _gldTrace_ShadeModel;
+   t->TexParameterf = _gldTrace_TexParameterf;
+   t->TexParameterfv = _gldTrace_TexParameterfv;
+   t->TexParameteri = _gldTrace_TexParameteri;
+   t->TexParameteriv = _gldTrace_TexParameteriv;
+   t->TexImage1D = _gldTrace_TexImage1D;
+   t->TexImage2D = _gldTrace_TexImage2D;
+   t->TexEnvf = _gldTrace_TexEnvf;
+   t->TexEnvfv = _gldTrace_TexEnvfv;
+   t->TexEnvi = _gldTrace_TexEnvi;
+   t->TexEnviv = _gldTrace_TexEnviv;
+   t->TexGend = _gldTrace_TexGend;
+   t->TexGendv = _gldTrace_TexGendv;
+   t->TexGenf = _gldTrace_TexGenf;
+   t->TexGenfv = _gldTrace_TexGenfv;
+   t->TexGeni = _gldTrace_TexGeni;
+   t->TexGeniv = _gldTrace_TexGeniv;
+   t->FeedbackBuffer = _gldTrace_FeedbackBuffer;
+   t->SelectBuffer = _gldTrace_SelectBuffer;
+   t->RenderMode = _gldTrace_RenderMode;
+   t->InitNames = _gldTrace_InitNames;
+   t->LoadName = _gldTrace_LoadName;
+   t->PassThrough = _gldTrace_PassThrough;
+   t->PopName = _gldTrace_PopName;
+   t->PushName = _gldTrace_PushName;
+   t->DrawBuffer = _gldTrace_DrawBuffer;
+   t->Clear = _gldTrace_Clear;
+   t->ClearAccum = _gldTrace_ClearAccum;
+   t->ClearIndex = _gldTrace_ClearIndex;
+   t->ClearColor = _gldTrace_ClearColor;
+   t->ClearStencil = _gldTrace_ClearStencil;
+   t->ClearDepth = _gldTrace_ClearDepth;
+   t->StencilMask = _gldTrace_StencilMask;
+   t->ColorMask = _gldTrace_ColorMask;
+   t->DepthMask = _gldTrace_DepthMask;
+   t->IndexMask = _gldTrace_IndexMask;
+   t->Accum = _gldTrace_Accum;
+   t->Disable = _gldTrace_Disable;
+   t->Enable = _gldTrace_Enable;
+   t->Finish = _gldTrace_Finish;
+   t->Flush = _gldTrace_Flush;
+   t->PopAttrib = _gldTrace_PopAttrib;
+   t->PushAttrib = _gldTrace_PushAttrib;
+   t->Map1d = _gldTrace_Map1d;
+   t->Map1f = _gldTrace_Map1f;
+   t->Map2d = _gldTrace_Map2d;
+   t->Map2f = _gldTrace_Map2f;
+   t->MapGrid1d = _gldTrace_MapGrid1d;
+   t->MapGrid1f = _gldTrace_MapGrid1f;
+   t->MapGrid2d = _gldTrace_MapGrid2d;
+   t->MapGrid2f = _gldTrace_MapGrid2f;
+   t->EvalCoord1d = _gldTrace_EvalCoord1d;
+   t->EvalCoord1dv = _gldTrace_EvalCoord1dv;
+   t->EvalCoord1f = _gldTrace_EvalCoord1f;
+   t->EvalCoord1fv = _gldTrace_EvalCoord1fv;
+   t->EvalCoord2d = _gldTrace_EvalCoord2d;
+   t->EvalCoord2dv = _gldTrace_EvalCoord2dv;
+   t->EvalCoord2f = _gldTrace_EvalCoord2f;
+   t->EvalCoord2fv = _gldTrace_EvalCoord2fv;
+   t->EvalMesh1 = _gldTrace_EvalMesh1;
+   t->EvalPoint1 = _gldTrace_EvalPoint1;
+   t->EvalMesh2 = _gldTrace_EvalMesh2;
+   t->EvalPoint2 = _gldTrace_EvalPoint2;
+   t->AlphaFunc = _gldTrace_AlphaFunc;
+   t->BlendFunc = _gldTrace_BlendFunc;
+   t->LogicOp = _gldTrace_LogicOp;
+   t->StencilFunc = _gldTrace_StencilFunc;
+   t->StencilOp = _gldTrace_StencilOp;
+   t->DepthFunc = _gldTrace_DepthFunc;
+   t->PixelZoom = _gldTrace_PixelZoom;
+   t->PixelTransferf = _gldTrace_PixelTransferf;
+   t->PixelTransferi = _gldTrace_PixelTransferi;
+   t->PixelStoref = _gldTrace_PixelStoref;
+   t->PixelStorei = _gldTrace_PixelStorei;
+   t->PixelMapfv = _gldTrace_PixelMapfv;
+   t->PixelMapuiv = _gldTrace_PixelMapuiv;
+   t->PixelMapusv = _gldTrace_PixelMapusv;
+   t->ReadBuffer = _gldTrace_ReadBuffer;
+   t->CopyPixels = _gldTrace_CopyPixels;
+   t->ReadPixels = _gldTrace_ReadPixels;
+   t->DrawPixels = _gldTrace_DrawPixels;
+   t->GetBooleanv = _gldTrace_GetBooleanv;
+   t->GetClipPlane = _gldTrace_GetClipPlane;
+   t->GetDoublev = _gldTrace_GetDoublev;
+   t->GetError = _gldTrace_GetError;
+   t->GetFloatv = _gldTrace_GetFloatv;
+   t->GetIntegerv = _gldTrace_GetIntegerv;
+   t->GetLightfv = _gldTrace_GetLightfv;
+   t->GetLightiv = _gldTrace_GetLightiv;
+   t->GetMapdv = _gldTrace_GetMapdv;
+   t->GetMapfv = _gldTrace_GetMapfv;
+   t->GetMapiv = _gldTrace_GetMapiv;
+   t->GetMaterialfv = _gldTrace_GetMaterialfv;
+   t->GetMaterialiv = _gldTrace_GetMaterialiv;
+   t->GetPixelMapfv = _gldTrace_GetPixelMapfv;
+   t->GetPixelMapuiv = _gldTrace_GetPixelMapuiv;
+   t->GetPixelMapusv = _gldTrace_GetPixelMapusv;
+   t->GetPolygonStipple = _gldTrace_GetPolygonStipple;
+   t->GetString = _gldTrace_GetString;
+   t->GetTexEnvfv = _gldTrace_GetTexEnvfv;
+   t->GetTexEnviv = _gldTrace_GetTexEnviv;
+   t->GetTexGendv = _gldTrace_GetTexGendv;
+   t->GetTexGenfv = _gldTrace_GetTexGenfv;
+   t->GetTexGeniv = _gldTrace_GetTexGeniv;
+   t->GetTexImage = _gldTrace_GetTexImage;
+   t->GetTexParameterfv = _gldTrace_GetTexParameterfv;
+   t->GetTexParameteriv = _gldTrace_GetTexParameteriv;
+   t->GetTexLevelParameterfv = _gldTrace_GetTexLevelParameterfv;
+   t->GetTexLevelParameteriv = _gldTrace_GetTexLevelParameteriv;
+   t->IsEnabled = _gldTrace_IsEnabled;
+   t->IsList = _gldTrace_IsList;
+   t->DepthRange = _gldTrace_DepthRange;
+   t->Frustum = _gldTrace_Frustum;
+   t->LoadIdentity = _gldTrace_LoadIdentity;
+   t->LoadMatrixf = _gldTrace_LoadMatrixf;
+   t->LoadMatrixd = _gldTrace_LoadMatrixd;
+   t->MatrixMode = _gldTrace_MatrixMode;
+   t->MultMatrixf = _gldTrace_MultMatrixf;
+   t->MultMatrixd = _gldTrace_MultMatrixd;
+   t->Ortho = _gldTrace_Ortho;
+   t->PopMatrix = _gldTrace_PopMatrix;
+   t->PushMatrix = _gldTrace_PushMatrix;
+   t->Rotated = _gldTrace_Rotated;
+   t->Rotatef = _gldTrace_Rotatef;
+   t->Scaled = _gldTrace_Scaled;
+   t->Scalef = _gldTrace_Scalef;
+   t->Translated = _gldTrace_Translated;
+   t->Translatef = _gldTrace_Translatef;
+   t->Viewport = _gldTrace_Viewport;
+   t->ArrayElement = _gldTrace_ArrayElement;
+   t->BindTexture = _gldTrace_BindTexture;
+   t->ColorPointer = _gldTrace_ColorPointer;
+   t->DisableClientState = _gldTrace_DisableClientState;
+   t->DrawArrays = _gldTrace_DrawArrays;
+   t->DrawElements = _gldTrace_DrawElements;
+   t->EdgeFlagPointer = _gldTrace_EdgeFlagPointer;
+   t->EnableClientState = _gldTrace_EnableClientState;
+   t->IndexPointer = _gldTrace_IndexPointer;
+   t->Indexub = _gldTrace_Indexub;
+   t->Indexubv = _gldTrace_Indexubv;
+   t->InterleavedArrays = _gldTrace_InterleavedArrays;
+   t->NormalPointer = _gldTrace_NormalPointer;
+   t->PolygonOffset = _gldTrace_PolygonOffset;
+   t->TexCoordPointer = _gldTrace_TexCoordPointer;
+   t->VertexPointer = _gldTrace_VertexPointer;
+   t->AreTexturesResident = _gldTrace_AreTexturesResident;
+   t->CopyTexImage1D = _gldTrace_CopyTexImage1D;
+   t->CopyTexImage2D = _gldTrace_CopyTexImage2D;
+   t->CopyTexSubImage1D = _gldTrace_CopyTexSubImage1D;
+   t->CopyTexSubImage2D = _gldTrace_CopyTexSubImage2D;
+   t->DeleteTextures = _gldTrace_DeleteTextures;
+   t->GenTextures = _gldTrace_GenTextures;
+   t->GetPointerv = _gldTrace_GetPointerv;
+   t->IsTexture = _gldTrace_IsTexture;
+   t->PrioritizeTextures = _gldTrace_PrioritizeTextures;
+   t->TexSubImage1D = _gldTrace_TexSubImage1D;
+   t->TexSubImage2D = _gldTrace_TexSubImage2D;
+   t->PopClientAttrib = _gldTrace_PopClientAttrib;
+   t->PushClientAttrib = _gldTrace_PushClientAttrib;
+   t->BlendColor = _gldTrace_BlendColor;
+   t->BlendEquation = _gldTrace_BlendEquation;
+   t->DrawRangeElements = _gldTrace_DrawRangeElements;
+   t->ColorTable = _gldTrace_ColorTable;
+   t->ColorTableParameterfv = _gldTrace_ColorTableParameterfv;
+   t->ColorTableParameteriv = _gldTrace_ColorTableParameteriv;
+   t->CopyColorTable = _gldTrace_CopyColorTable;
+   t->GetColorTable = _gldTrace_GetColorTable;
+   t->GetColorTableParameterfv = _gldTrace_GetColorTableParameterfv;
+   t->GetColorTableParameteriv = _gldTrace_GetColorTableParameteriv;
+   t->ColorSubTable = _gldTrace_ColorSubTable;
+   t->CopyColorSubTable = _gldTrace_CopyColorSubTable;
+   t->ConvolutionFilter1D = _gldTrace_ConvolutionFilter1D;
+   t->ConvolutionFilter2D = _gldTrace_ConvolutionFilter2D;
+   t->ConvolutionParameterf = _gldTrace_ConvolutionParameterf;
+   t->ConvolutionParameterfv = _gldTrace_ConvolutionParameterfv;
+   t->ConvolutionParameteri = _gldTrace_ConvolutionParameteri;
+   t->ConvolutionParameteriv = _gldTrace_ConvolutionParameteriv;
+   t->CopyConvolutionFilter1D = _gldTrace_CopyConvolutionFilter1D;
+   t->CopyConvolutionFilter2D = _gldTrace_CopyConvolutionFilter2D;
+   t->GetConvolutionFilter = _gldTrace_GetConvolutionFilter;
+   t->GetConvolutionParameterfv = _gldTrace_GetConvolutionParameterfv;
+   t->GetConvolutionParameteriv = _gldTrace_GetConvolutionParameteriv;
+   t->GetSeparableFilter = _gldTrace_GetSeparableFilter;
+   t->SeparableFilter2D = _gldTrace_SeparableFilter2D;
+   t->GetHistogram = _gldTrace_GetHistogram;
+   t->GetHistogramParameterfv = _gldTrace_GetHistogramParameterfv;
+   t->GetHistogramParameteriv = _gldTrace_GetHistogramParameteriv;
+   t->GetMinmax = _gldTrace_GetMinmax;
+   t->GetMinmaxParameterfv = _gldTrace_GetMinmaxParameterfv;
+   t->GetMinmaxParameteriv = _gldTrace_GetMinmaxParameteriv;
+   t->Histogram = _gldTrace_Histogram;
+   t->Minmax = _gldTrace_Minmax;
+   t->ResetHistogram = _gldTrace_ResetHistogram;
+   t->ResetMinmax = _gldTrace_ResetMinmax;
+   t->TexImage3D = _gldTrace_TexImage3D;
+   t->TexSubImage3D = _gldTrace_TexSubImage3D;
+   t->CopyTexSubImage3D = _gldTrace_CopyTexSubImage3D;
+   t->ActiveTextureARB = _gldTrace_ActiveTextureARB;
+   t->ClientActiveTextureARB = _gldTrace_ClientActiveTextureARB;
+   t->MultiTexCoord1dARB = _gldTrace_MultiTexCoord1dARB;
+   t->MultiTexCoord1dvARB = _gldTrace_MultiTexCoord1dvARB;
+   t->MultiTexCoord1fARB = _gldTrace_MultiTexCoord1fARB;
+   t->MultiTexCoord1fvARB = _gldTrace_MultiTexCoord1fvARB;
+   t->MultiTexCoord1iARB = _gldTrace_MultiTexCoord1iARB;
+   t->MultiTexCoord1ivARB = _gldTrace_MultiTexCoord1ivARB;
+   t->MultiTexCoord1sARB = _gldTrace_MultiTexCoord1sARB;
+   t->MultiTexCoord1svARB = _gldTrace_MultiTexCoord1svARB;
+   t->MultiTexCoord2dARB = _gldTrace_MultiTexCoord2dARB;
+   t->MultiTexCoord2dvARB = _gldTrace_MultiTexCoord2dvARB;
+   t->MultiTexCoord2fARB = _gldTrace_MultiTexCoord2fARB;
+   t->MultiTexCoord2fvARB = _gldTrace_MultiTexCoord2fvARB;
+   t->MultiTexCoord2iARB = _gldTrace_MultiTexCoord2iARB;
+   t->MultiTexCoord2ivARB = _gldTrace_MultiTexCoord2ivARB;
+   t->MultiTexCoord2sARB = _gldTrace_MultiTexCoord2sARB;
+   t->MultiTexCoord2svARB = _gldTrace_MultiTexCoord2svARB;
+   t->MultiTexCoord3dARB = _gldTrace_MultiTexCoord3dARB;
+   t->MultiTexCoord3dvARB = _gldTrace_MultiTexCoord3dvARB;
+   t->MultiTexCoord3fARB = _gldTrace_MultiTexCoord3fARB;
+   t->MultiTexCoord3fvARB = _gldTrace_MultiTexCoord3fvARB;
+   t->MultiTexCoord3iARB = _gldTrace_MultiTexCoord3iARB;
+   t->MultiTexCoord3ivARB = _gldTrace_MultiTexCoord3ivARB;
+   t->MultiTexCoord3sARB = _gldTrace_MultiTexCoord3sARB;
+   t->MultiTexCoord3svARB = _gldTrace_MultiTexCoord3svARB;
+   t->MultiTexCoord4dARB = _gldTrace_MultiTexCoord4dARB;
+   t->MultiTexCoord4dvARB = _gldTrace_MultiTexCoord4dvARB;
+   t->MultiTexCoord4fARB = _gldTrace_MultiTexCoord4fARB;
+   t->MultiTexCoord4fvARB = _gldTrace_MultiTexCoord4fvARB;
+   t->MultiTexCoord4iARB = _gldTrace_MultiTexCoord4iARB;
+   t->MultiTexCoord4ivARB = _gldTrace_MultiTexCoord4ivARB;
+   t->MultiTexCoord4sARB = _gldTrace_MultiTexCoord4sARB;
+   t->MultiTexCoord4svARB = _gldTrace_MultiTexCoord4svARB;
+   t->LoadTransposeMatrixfARB = _gldTrace_LoadTransposeMatrixfARB;
+   t->LoadTransposeMatrixdARB = _gldTrace_LoadTransposeMatrixdARB;
+   t->MultTransposeMatrixfARB = _gldTrace_MultTransposeMatrixfARB;
+   t->MultTransposeMatrixdARB = _gldTrace_MultTransposeMatrixdARB;
+   t->SampleCoverageARB = _gldTrace_SampleCoverageARB;
+   t->__unused413 = _gldTrace___unused413;
+   t->PolygonOffsetEXT = _gldTrace_PolygonOffsetEXT;
+   t->GetTexFilterFuncSGIS = _gldTrace_GetTexFilterFuncSGIS;
+   t->TexFilterFuncSGIS = _gldTrace_TexFilterFuncSGIS;
+   t->GetHistogramEXT = _gldTrace_GetHistogramEXT;
+   t->GetHistogramParameterfvEXT = _gldTrace_GetHistogramParameterfvEXT;
+   t->GetHistogramParameterivEXT = _gldTrace_GetHistogramParameterivEXT;
+   t->GetMinmaxEXT = _gldTrace_GetMinmaxEXT;
+   t->GetMinmaxParameterfvEXT = _gldTrace_GetMinmaxParameterfvEXT;
+   t->GetMinmaxParameterivEXT = _gldTrace_GetMinmaxParameterivEXT;
+   t->GetConvolutionFilterEXT = _gldTrace_GetConvolutionFilterEXT;
+   t->GetConvolutionParameterfvEXT = _gldTrace_GetConvolutionParameterfvEXT;
+   t->GetConvolutionParameterivEXT = _gldTrace_GetConvolutionParameterivEXT;
+   t->GetSeparableFilterEXT = _gldTrace_GetSeparableFilterEXT;
+   t->GetColorTableSGI = _gldTrace_GetColorTableSGI;
+   t->GetColorTableParameterfvSGI = _gldTrace_GetColorTableParameterfvSGI;
+   t->GetColorTableParameterivSGI = _gldTrace_GetColorTableParameterivSGI;
+   t->PixelTexGenSGIX = _gldTrace_PixelTexGenSGIX;
+   t->PixelTexGenParameteriSGIS = _gldTrace_PixelTexGenParameteriSGIS;
+   t->PixelTexGenParameterivSGIS = _gldTrace_PixelTexGenParameterivSGIS;
+   t->PixelTexGenParameterfSGIS = _gldTrace_PixelTexGenParameterfSGIS;
+   t->PixelTexGenParameterfvSGIS = _gldTrace_PixelTexGenParameterfvSGIS;
+   t->GetPixelTexGenParameterivSGIS = _gldTrace_GetPixelTexGenParameterivSGIS;
+   t->GetPixelTexGenParameterfvSGIS = _gldTrace_GetPixelTexGenParameterfvSGIS;
+   t->TexImage4DSGIS = _gldTrace_TexImage4DSGIS;
+   t->TexSubImage4DSGIS = _gldTrace_TexSubImage4DSGIS;
+   t->AreTexturesResidentEXT = _gldTrace_AreTexturesResidentEXT;
+   t->GenTexturesEXT = _gldTrace_GenTexturesEXT;
+   t->IsTextureEXT = _gldTrace_IsTextureEXT;
+   t->DetailTexFuncSGIS = _gldTrace_DetailTexFuncSGIS;
+   t->GetDetailTexFuncSGIS = _gldTrace_GetDetailTexFuncSGIS;
+   t->SharpenTexFuncSGIS = _gldTrace_SharpenTexFuncSGIS;
+   t->GetSharpenTexFuncSGIS = _gldTrace_GetSharpenTexFuncSGIS;
+   t->SampleMaskSGIS = _gldTrace_SampleMaskSGIS;
+   t->SamplePatternSGIS = _gldTrace_SamplePatternSGIS;
+   t->ColorPointerEXT = _gldTrace_ColorPointerEXT;
+   t->EdgeFlagPointerEXT = _gldTrace_EdgeFlagPointerEXT;
+   t->IndexPointerEXT = _gldTrace_IndexPointerEXT;
+   t->NormalPointerEXT = _gldTrace_NormalPointerEXT;
+   t->TexCoordPointerEXT = _gldTrace_TexCoordPointerEXT;
+   t->VertexPointerEXT = _gldTrace_VertexPointerEXT;
+   t->SpriteParameterfSGIX = _gldTrace_SpriteParameterfSGIX;
+   t->SpriteParameterfvSGIX = _gldTrace_SpriteParameterfvSGIX;
+   t->SpriteParameteriSGIX = _gldTrace_SpriteParameteriSGIX;
+   t->SpriteParameterivSGIX = _gldTrace_SpriteParameterivSGIX;
+   t->PointParameterfEXT = _gldTrace_PointParameterfEXT;
+   t->PointParameterfvEXT = _gldTrace_PointParameterfvEXT;
+   t->GetInstrumentsSGIX = _gldTrace_GetInstrumentsSGIX;
+   t->InstrumentsBufferSGIX = _gldTrace_InstrumentsBufferSGIX;
+   t->PollInstrumentsSGIX = _gldTrace_PollInstrumentsSGIX;
+   t->ReadInstrumentsSGIX = _gldTrace_ReadInstrumentsSGIX;
+   t->StartInstrumentsSGIX = _gldTrace_StartInstrumentsSGIX;
+   t->StopInstrumentsSGIX = _gldTrace_StopInstrumentsSGIX;
+   t->FrameZoomSGIX = _gldTrace_FrameZoomSGIX;
+   t->TagSampleBufferSGIX = _gldTrace_TagSampleBufferSGIX;
+   t->ReferencePlaneSGIX = _gldTrace_ReferencePlaneSGIX;
+   t->FlushRasterSGIX = _gldTrace_FlushRasterSGIX;
+   t->GetListParameterfvSGIX = _gldTrace_GetListParameterfvSGIX;
+   t->GetListParameterivSGIX = _gldTrace_GetListParameterivSGIX;
+   t->ListParameterfSGIX = _gldTrace_ListParameterfSGIX;
+   t->ListParameterfvSGIX = _gldTrace_ListParameterfvSGIX;
+   t->ListParameteriSGIX = _gldTrace_ListParameteriSGIX;
+   t->ListParameterivSGIX = _gldTrace_ListParameterivSGIX;
+   t->FragmentColorMaterialSGIX = _gldTrace_FragmentColorMaterialSGIX;
+   t->FragmentLightfSGIX = _gldTrace_FragmentLightfSGIX;
+   t->FragmentLightfvSGIX = _gldTrace_FragmentLightfvSGIX;
+   t->FragmentLightiSGIX = _gldTrace_FragmentLightiSGIX;
+   t->FragmentLightivSGIX = _gldTrace_FragmentLightivSGIX;
+   t->FragmentLightModelfSGIX = _gldTrace_FragmentLightModelfSGIX;
+   t->FragmentLightModelfvSGIX = _gldTrace_FragmentLightModelfvSGIX;
+   t->FragmentLightModeliSGIX = _gldTrace_FragmentLightModeliSGIX;
+   t->FragmentLightModelivSGIX = _gldTrace_FragmentLightModelivSGIX;
+   t->FragmentMaterialfSGIX = _gldTrace_FragmentMaterialfSGIX;
+   t->FragmentMaterialfvSGIX = _gldTrace_FragmentMaterialfvSGIX;
+   t->FragmentMaterialiSGIX = _gldTrace_FragmentMaterialiSGIX;
+   t->FragmentMaterialivSGIX = _gldTrace_FragmentMaterialivSGIX;
+   t->GetFragmentLightfvSGIX = _gldTrace_GetFragmentLightfvSGIX;
+   t->GetFragmentLightivSGIX = _gldTrace_GetFragmentLightivSGIX;
+   t->GetFragmentMaterialfvSGIX = _gldTrace_GetFragmentMaterialfvSGIX;
+   t->GetFragmentMaterialivSGIX = _gldTrace_GetFragmentMaterialivSGIX;
+   t->LightEnviSGIX = _gldTrace_LightEnviSGIX;
+   t->VertexWeightfEXT = _gldTrace_VertexWeightfEXT;
+   t->VertexWeightfvEXT = _gldTrace_VertexWeightfvEXT;
+   t->VertexWeightPointerEXT = _gldTrace_VertexWeightPointerEXT;
+   t->FlushVertexArrayRangeNV = _gldTrace_FlushVertexArrayRangeNV;
+   t->VertexArrayRangeNV = _gldTrace_VertexArrayRangeNV;
+   t->CombinerParameterfvNV = _gldTrace_CombinerParameterfvNV;
+   t->CombinerParameterfNV = _gldTrace_CombinerParameterfNV;
+   t->CombinerParameterivNV = _gldTrace_CombinerParameterivNV;
+   t->CombinerParameteriNV = _gldTrace_CombinerParameteriNV;
+   t->CombinerInputNV = _gldTrace_CombinerInputNV;
+   t->CombinerOutputNV = _gldTrace_CombinerOutputNV;
+   t->FinalCombinerInputNV = _gldTrace_FinalCombinerInputNV;
+   t->GetCombinerInputParameterfvNV = _gldTrace_GetCombinerInputParameterfvNV;
+   t->GetCombinerInputParameterivNV = _gldTrace_GetCombinerInputParameterivNV;
+   t->GetCombinerOutputParameterfvNV = _gldTrace_GetCombinerOutputParameterfvNV;
+   t->GetCombinerOutputParameterivNV = _gldTrace_GetCombinerOutputParameterivNV;
+   t->GetFinalCombinerInputParameterfvNV = _gldTrace_GetFinalCombinerInputParameterfvNV;
+   t->GetFinalCombinerInputParameterivNV = _gldTrace_GetFinalCombinerInputParameterivNV;
+   t->ResizeBuffersMESA = _gldTrace_ResizeBuffersMESA;
+   t->WindowPos2dMESA = _gldTrace_WindowPos2dMESA;
+   t->WindowPos2dvMESA = _gldTrace_WindowPos2dvMESA;
+   t->WindowPos2fMESA = _gldTrace_WindowPos2fMESA;
+   t->WindowPos2fvMESA = _gldTrace_WindowPos2fvMESA;
+   t->WindowPos2iMESA = _gldTrace_WindowPos2iMESA;
+   t->WindowPos2ivMESA = _gldTrace_WindowPos2ivMESA;
+   t->WindowPos2sMESA = _gldTrace_WindowPos2sMESA;
+   t->WindowPos2svMESA = _gldTrace_WindowPos2svMESA;
+   t->WindowPos3dMESA = _gldTrace_WindowPos3dMESA;
+   t->WindowPos3dvMESA = _gldTrace_WindowPos3dvMESA;
+   t->WindowPos3fMESA = _gldTrace_WindowPos3fMESA;
+   t->WindowPos3fvMESA = _gldTrace_WindowPos3fvMESA;
+   t->WindowPos3iMESA = _gldTrace_WindowPos3iMESA;
+   t->WindowPos3ivMESA = _gldTrace_WindowPos3ivMESA;
+   t->WindowPos3sMESA = _gldTrace_WindowPos3sMESA;
+   t->WindowPos3svMESA = _gldTrace_WindowPos3svMESA;
+   t->WindowPos4dMESA = _gldTrace_WindowPos4dMESA;
+   t->WindowPos4dvMESA = _gldTrace_WindowPos4dvMESA;
+   t->WindowPos4fMESA = _gldTrace_WindowPos4fMESA;
+   t->WindowPos4fvMESA = _gldTrace_WindowPos4fvMESA;
+   t->WindowPos4iMESA = _gldTrace_WindowPos4iMESA;
+   t->WindowPos4ivMESA = _gldTrace_WindowPos4ivMESA;
+   t->WindowPos4sMESA = _gldTrace_WindowPos4sMESA;
+   t->WindowPos4svMESA = _gldTrace_WindowPos4svMESA;
+   t->BlendFuncSeparateEXT = _gldTrace_BlendFuncSeparateEXT;
+   t->IndexMaterialEXT = _gldTrace_IndexMaterialEXT;
+   t->IndexFuncEXT = _gldTrace_IndexFuncEXT;
+   t->LockArraysEXT = _gldTrace_LockArraysEXT;
+   t->UnlockArraysEXT = _gldTrace_UnlockArraysEXT;
+   t->CullParameterdvEXT = _gldTrace_CullParameterdvEXT;
+   t->CullParameterfvEXT = _gldTrace_CullParameterfvEXT;
+   t->HintPGI = _gldTrace_HintPGI;
+   t->FogCoordfEXT = _gldTrace_FogCoordfEXT;
+   t->FogCoordfvEXT = _gldTrace_FogCoordfvEXT;
+   t->FogCoorddEXT = _gldTrace_FogCoorddEXT;
+   t->FogCoorddvEXT = _gldTrace_FogCoorddvEXT;
+   t->FogCoordPointerEXT = _gldTrace_FogCoordPointerEXT;
+   t->GetColorTableEXT = _gldTrace_GetColorTableEXT;
+   t->GetColorTableParameterivEXT = _gldTrace_GetColorTableParameterivEXT;
+   t->GetColorTableParameterfvEXT = _gldTrace_GetColorTableParameterfvEXT;
+   t->TbufferMask3DFX = _gldTrace_TbufferMask3DFX;
+   t->CompressedTexImage3DARB = _gldTrace_CompressedTexImage3DARB;
+   t->CompressedTexImage2DARB = _gldTrace_CompressedTexImage2DARB;
+   t->CompressedTexImage1DARB = _gldTrace_CompressedTexImage1DARB;
+   t->CompressedTexSubImage3DARB = _gldTrace_CompressedTexSubImage3DARB;
+   t->CompressedTexSubImage2DARB = _gldTrace_CompressedTexSubImage2DARB;
+   t->CompressedTexSubImage1DARB = _gldTrace_CompressedTexSubImage1DARB;
+   t->GetCompressedTexImageARB = _gldTrace_GetCompressedTexImageARB;
+   t->SecondaryColor3bEXT = _gldTrace_SecondaryColor3bEXT;
+   t->SecondaryColor3bvEXT = _gldTrace_SecondaryColor3bvEXT;
+   t->SecondaryColor3dEXT = _gldTrace_SecondaryColor3dEXT;
+   t->SecondaryColor3dvEXT = _gldTrace_SecondaryColor3dvEXT;
+   t->SecondaryColor3fEXT = _gldTrace_SecondaryColor3fEXT;
+   t->SecondaryColor3fvEXT = _gldTrace_SecondaryColor3fvEXT;
+   t->SecondaryColor3iEXT = _gldTrace_SecondaryColor3iEXT;
+   t->SecondaryColor3ivEXT = _gldTrace_SecondaryColor3ivEXT;
+   t->SecondaryColor3sEXT = _gldTrace_SecondaryColor3sEXT;
+   t->SecondaryColor3svEXT = _gldTrace_SecondaryColor3svEXT;
+   t->SecondaryColor3ubEXT = _gldTrace_SecondaryColor3ubEXT;
+   t->SecondaryColor3ubvEXT = _gldTrace_SecondaryColor3ubvEXT;
+   t->SecondaryColor3uiEXT = _gldTrace_SecondaryColor3uiEXT;
+   t->SecondaryColor3uivEXT = _gldTrace_SecondaryColor3uivEXT;
+   t->SecondaryColor3usEXT = _gldTrace_SecondaryColor3usEXT;
+   t->SecondaryColor3usvEXT = _gldTrace_SecondaryColor3usvEXT;
+   t->SecondaryColorPointerEXT = _gldTrace_SecondaryColorPointerEXT;
+   t->AreProgramsResidentNV = _gldTrace_AreProgramsResidentNV;
+   t->BindProgramNV = _gldTrace_BindProgramNV;
+   t->DeleteProgramsNV = _gldTrace_DeleteProgramsNV;
+   t->ExecuteProgramNV = _gldTrace_ExecuteProgramNV;
+   t->GenProgramsNV = _gldTrace_GenProgramsNV;
+   t->GetProgramParameterdvNV = _gldTrace_GetProgramParameterdvNV;
+   t->GetProgramParameterfvNV = _gldTrace_GetProgramParameterfvNV;
+   t->GetProgramivNV = _gldTrace_GetProgramivNV;
+   t->GetProgramStringNV = _gldTrace_GetProgramStringNV;
+   t->GetTrackMatrixivNV = _gldTrace_GetTrackMatrixivNV;
+   t->GetVertexAttribdvNV = _gldTrace_GetVertexAttribdvNV;
+   t->GetVertexAttribfvNV = _gldTrace_GetVertexAttribfvNV;
+   t->GetVertexAttribivNV = _gldTrace_GetVertexAttribivNV;
+   t->GetVertexAttribPointervNV = _gldTrace_GetVertexAttribPointervNV;
+   t->IsProgramNV = _gldTrace_IsProgramNV;
+   t->LoadProgramNV = _gldTrace_LoadProgramNV;
+   t->ProgramParameter4dNV = _gldTrace_ProgramParameter4dNV;
+   t->ProgramParameter4dvNV = _gldTrace_ProgramParameter4dvNV;
+   t->ProgramParameter4fNV = _gldTrace_ProgramParameter4fNV;
+   t->ProgramParameter4fvNV = _gldTrace_ProgramParameter4fvNV;
+   t->ProgramParameters4dvNV = _gldTrace_ProgramParameters4dvNV;
+   t->ProgramParameters4fvNV = _gldTrace_ProgramParameters4fvNV;
+   t->RequestResidentProgramsNV = _gldTrace_RequestResidentProgramsNV;
+   t->TrackMatrixNV = _gldTrace_TrackMatrixNV;
+   t->VertexAttribPointerNV = _gldTrace_VertexAttribPointerNV;
+   t->VertexAttrib1dNV = _gldTrace_VertexAttrib1dNV;
+   t->VertexAttrib1dvNV = _gldTrace_VertexAttrib1dvNV;
+   t->VertexAttrib1fNV = _gldTrace_VertexAttrib1fNV;
+   t->VertexAttrib1fvNV = _gldTrace_VertexAttrib1fvNV;
+   t->VertexAttrib1sNV = _gldTrace_VertexAttrib1sNV;
+   t->VertexAttrib1svNV = _gldTrace_VertexAttrib1svNV;
+   t->VertexAttrib2dNV = _gldTrace_VertexAttrib2dNV;
+   t->VertexAttrib2dvNV = _gldTrace_VertexAttrib2dvNV;
+   t->VertexAttrib2fNV = _gldTrace_VertexAttrib2fNV;
+   t->VertexAttrib2fvNV = _gldTrace_VertexAttrib2fvNV;
+   t->VertexAttrib2sNV = _gldTrace_VertexAttrib2sNV;
+   t->VertexAttrib2svNV = _gldTrace_VertexAttrib2svNV;
+   t->VertexAttrib3dNV = _gldTrace_VertexAttrib3dNV;
+   t->VertexAttrib3dvNV = _gldTrace_VertexAttrib3dvNV;
+   t->VertexAttrib3fNV = _gldTrace_VertexAttrib3fNV;
+   t->VertexAttrib3fvNV = _gldTrace_VertexAttrib3fvNV;
+   t->VertexAttrib3sNV = _gldTrace_VertexAttrib3sNV;
+   t->VertexAttrib3svNV = _gldTrace_VertexAttrib3svNV;
+   t->VertexAttrib4dNV = _gldTrace_VertexAttrib4dNV;
+   t->VertexAttrib4dvNV = _gldTrace_VertexAttrib4dvNV;
+   t->VertexAttrib4fNV = _gldTrace_VertexAttrib4fNV;
+   t->VertexAttrib4fvNV = _gldTrace_VertexAttrib4fvNV;
+   t->VertexAttrib4sNV = _gldTrace_VertexAttrib4sNV;
+   t->VertexAttrib4svNV = _gldTrace_VertexAttrib4svNV;
+   t->VertexAttrib4ubNV = _gldTrace_VertexAttrib4ubNV;
+   t->VertexAttrib4ubvNV = _gldTrace_VertexAttrib4ubvNV;
+   t->VertexAttribs1dvNV = _gldTrace_VertexAttribs1dvNV;
+   t->VertexAttribs1fvNV = _gldTrace_VertexAttribs1fvNV;
+   t->VertexAttribs1svNV = _gldTrace_VertexAttribs1svNV;
+   t->VertexAttribs2dvNV = _gldTrace_VertexAttribs2dvNV;
+   t->VertexAttribs2fvNV = _gldTrace_VertexAttribs2fvNV;
+   t->VertexAttribs2svNV = _gldTrace_VertexAttribs2svNV;
+   t->VertexAttribs3dvNV = _gldTrace_VertexAttribs3dvNV;
+   t->VertexAttribs3fvNV = _gldTrace_VertexAttribs3fvNV;
+   t->VertexAttribs3svNV = _gldTrace_VertexAttribs3svNV;
+   t->VertexAttribs4dvNV = _gldTrace_VertexAttribs4dvNV;
+   t->VertexAttribs4fvNV = _gldTrace_VertexAttribs4fvNV;
+   t->VertexAttribs4svNV = _gldTrace_VertexAttribs4svNV;
+   t->VertexAttribs4ubvNV = _gldTrace_VertexAttribs4ubvNV;
+   t->PointParameteriNV = _gldTrace_PointParameteriNV;
+   t->PointParameterivNV = _gldTrace_PointParameterivNV;
+   t->MultiDrawArraysEXT = _gldTrace_MultiDrawArraysEXT;
+   t->MultiDrawElementsEXT = _gldTrace_MultiDrawElementsEXT;
+   t->ActiveStencilFaceEXT = _gldTrace_ActiveStencilFaceEXT;
+   t->DeleteFencesNV = _gldTrace_DeleteFencesNV;
+   t->GenFencesNV = _gldTrace_GenFencesNV;
+   t->IsFenceNV = _gldTrace_IsFenceNV;
+   t->TestFenceNV = _gldTrace_TestFenceNV;
+   t->GetFenceivNV = _gldTrace_GetFenceivNV;
+   t->FinishFenceNV = _gldTrace_FinishFenceNV;
+   t->SetFenceNV = _gldTrace_SetFenceNV;
+   t->VertexAttrib4bvARB = _gldTrace_VertexAttrib4bvARB;
+   t->VertexAttrib4ivARB = _gldTrace_VertexAttrib4ivARB;
+   t->VertexAttrib4ubvARB = _gldTrace_VertexAttrib4ubvARB;
+   t->VertexAttrib4usvARB = _gldTrace_VertexAttrib4usvARB;
+   t->VertexAttrib4uivARB = _gldTrace_VertexAttrib4uivARB;
+   t->VertexAttrib4NbvARB = _gldTrace_VertexAttrib4NbvARB;
+   t->VertexAttrib4NsvARB = _gldTrace_VertexAttrib4NsvARB;
+   t->VertexAttrib4NivARB = _gldTrace_VertexAttrib4NivARB;
+   t->VertexAttrib4NusvARB = _gldTrace_VertexAttrib4NusvARB;
+   t->VertexAttrib4NuivARB = _gldTrace_VertexAttrib4NuivARB;
+   t->VertexAttribPointerARB = _gldTrace_VertexAttribPointerARB;
+   t->EnableVertexAttribArrayARB = _gldTrace_EnableVertexAttribArrayARB;
+   t->DisableVertexAttribArrayARB = _gldTrace_DisableVertexAttribArrayARB;
+   t->ProgramStringARB = _gldTrace_ProgramStringARB;
+   t->ProgramEnvParameter4dARB = _gldTrace_ProgramEnvParameter4dARB;
+   t->ProgramEnvParameter4dvARB = _gldTrace_ProgramEnvParameter4dvARB;
+   t->ProgramEnvParameter4fARB = _gldTrace_ProgramEnvParameter4fARB;
+   t->ProgramEnvParameter4fvARB = _gldTrace_ProgramEnvParameter4fvARB;
+   t->ProgramLocalParameter4dARB = _gldTrace_ProgramLocalParameter4dARB;
+   t->ProgramLocalParameter4dvARB = _gldTrace_ProgramLocalParameter4dvARB;
+   t->ProgramLocalParameter4fARB = _gldTrace_ProgramLocalParameter4fARB;
+   t->ProgramLocalParameter4fvARB = _gldTrace_ProgramLocalParameter4fvARB;
+   t->GetProgramEnvParameterdvARB = _gldTrace_GetProgramEnvParameterdvARB;
+   t->GetProgramEnvParameterfvARB = _gldTrace_GetProgramEnvParameterfvARB;
+   t->GetProgramLocalParameterdvARB = _gldTrace_GetProgramLocalParameterdvARB;
+   t->GetProgramLocalParameterfvARB = _gldTrace_GetProgramLocalParameterfvARB;
+   t->GetProgramivARB = _gldTrace_GetProgramivARB;
+   t->GetProgramStringARB = _gldTrace_GetProgramStringARB;
+   t->ProgramNamedParameter4fNV = _gldTrace_ProgramNamedParameter4fNV;
+   t->ProgramNamedParameter4dNV = _gldTrace_ProgramNamedParameter4dNV;
+   t->ProgramNamedParameter4fvNV = _gldTrace_ProgramNamedParameter4fvNV;
+   t->ProgramNamedParameter4dvNV = _gldTrace_ProgramNamedParameter4dvNV;
+   t->GetProgramNamedParameterfvNV = _gldTrace_GetProgramNamedParameterfvNV;
+   t->GetProgramNamedParameterdvNV = _gldTrace_GetProgramNamedParameterdvNV;
+   t->BindBufferARB = _gldTrace_BindBufferARB;
+   t->BufferDataARB = _gldTrace_BufferDataARB;
+   t->BufferSubDataARB = _gldTrace_BufferSubDataARB;
+   t->DeleteBuffersARB = _gldTrace_DeleteBuffersARB;
+   t->GenBuffersARB = _gldTrace_GenBuffersARB;
+   t->GetBufferParameterivARB = _gldTrace_GetBufferParameterivARB;
+   t->GetBufferPointervARB = _gldTrace_GetBufferPointervARB;
+   t->GetBufferSubDataARB = _gldTrace_GetBufferSubDataARB;
+   t->IsBufferARB = _gldTrace_IsBufferARB;
+   t->MapBufferARB = _gldTrace_MapBufferARB;
+   t->UnmapBufferARB = _gldTrace_UnmapBufferARB;
+   t->DepthBoundsEXT = _gldTrace_DepthBoundsEXT;
+   t->GenQueriesARB = _gldTrace_GenQueriesARB;
+   t->DeleteQueriesARB = _gldTrace_DeleteQueriesARB;
+   t->IsQueryARB = _gldTrace_IsQueryARB;
+   t->BeginQueryARB = _gldTrace_BeginQueryARB;
+   t->EndQueryARB = _gldTrace_EndQueryARB;
+   t->GetQueryivARB = _gldTrace_GetQueryivARB;
+   t->GetQueryObjectivARB = _gldTrace_GetQueryObjectivARB;
+   t->GetQueryObjectuivARB = _gldTrace_GetQueryObjectuivARB;
+   t->MultiModeDrawArraysIBM = _gldTrace_MultiModeDrawArraysIBM;
+   t->MultiModeDrawElementsIBM = _gldTrace_MultiModeDrawElementsIBM;
+}
+
+#endif /* GLD_TRACE_CAPTURE */
+
+#ifdef GLD_TRACE_REPLAY
+
+static void _gldReplay_NewList(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, NewList))
+      pReplay->Table.NewList(list, mode);
+}
+
+static void _gldReplay_EndList(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, EndList))
+      pReplay->Table.EndList();
+}
+
+static void _gldReplay_CallList(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CallList))
+      pReplay->Table.CallList(list);
+}
+
+static void _gldReplay_CallLists(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * lists = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CallLists))
+      pReplay->Table.CallLists(n, type, lists);
+}
+
+static void _gldReplay_DeleteLists(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   GLsizei range = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DeleteLists))
+      pReplay->Table.DeleteLists(list, range);
+}
+
+static void _gldReplay_GenLists(GLD_replay *pReplay)
+{
+   GLsizei range = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GenLists))
+      (void) pReplay->Table.GenLists(range);
+}
+
+static void _gldReplay_ListBase(GLD_replay *pReplay)
+{
+   GLuint base = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ListBase))
+      pReplay->Table.ListBase(base);
+}
+
+static void _gldReplay_Begin(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Begin))
+      pReplay->Table.Begin(mode);
+}
+
+static void _gldReplay_Bitmap(GLD_replay *pReplay)
+{
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLfloat xorig = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat yorig = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat xmove = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat ymove = (GLfloat) _gldReplayF32(pReplay);
+   const GLubyte * bitmap = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Bitmap))
+      pReplay->Table.Bitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+
+static void _gldReplay_Color3b(GLD_replay *pReplay)
+{
+   GLbyte red = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte green = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte blue = (GLbyte) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3b))
+      pReplay->Table.Color3b(red, green, blue);
+}
+
+static void _gldReplay_Color3bv(GLD_replay *pReplay)
+{
+   const GLbyte * v = (const GLbyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3bv))
+      pReplay->Table.Color3bv(v);
+}
+
+static void _gldReplay_Color3d(GLD_replay *pReplay)
+{
+   GLdouble red = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble green = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble blue = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3d))
+      pReplay->Table.Color3d(red, green, blue);
+}
+
+static void _gldReplay_Color3dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3dv))
+      pReplay->Table.Color3dv(v);
+}
+
+static void _gldReplay_Color3f(GLD_replay *pReplay)
+{
+   GLfloat red = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat green = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat blue = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3f))
+      pReplay->Table.Color3f(red, green, blue);
+}
+
+static void _gldReplay_Color3fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3fv))
+      pReplay->Table.Color3fv(v);
+}
+
+static void _gldReplay_Color3i(GLD_replay *pReplay)
+{
+   GLint red = (GLint) _gldReplayS32(pReplay);
+   GLint green = (GLint) _gldReplayS32(pReplay);
+   GLint blue = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3i))
+      pReplay->Table.Color3i(red, green, blue);
+}
+
+static void _gldReplay_Color3iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3iv))
+      pReplay->Table.Color3iv(v);
+}
+
+static void _gldReplay_Color3s(GLD_replay *pReplay)
+{
+   GLshort red = (GLshort) _gldReplayS32(pReplay);
+   GLshort green = (GLshort) _gldReplayS32(pReplay);
+   GLshort blue = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3s))
+      pReplay->Table.Color3s(red, green, blue);
+}
+
+static void _gldReplay_Color3sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3sv))
+      pReplay->Table.Color3sv(v);
+}
+
+static void _gldReplay_Color3ub(GLD_replay *pReplay)
+{
+   GLubyte red = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte green = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte blue = (GLubyte) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3ub))
+      pReplay->Table.Color3ub(red, green, blue);
+}
+
+static void _gldReplay_Color3ubv(GLD_replay *pReplay)
+{
+   const GLubyte * v = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3ubv))
+      pReplay->Table.Color3ubv(v);
+}
+
+static void _gldReplay_Color3ui(GLD_replay *pReplay)
+{
+   GLuint red = (GLuint) _gldReplayU32(pReplay);
+   GLuint green = (GLuint) _gldReplayU32(pReplay);
+   GLuint blue = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3ui))
+      pReplay->Table.Color3ui(red, green, blue);
+}
+
+static void _gldReplay_Color3uiv(GLD_replay *pReplay)
+{
+   const GLuint * v = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3uiv))
+      pReplay->Table.Color3uiv(v);
+}
+
+static void _gldReplay_Color3us(GLD_replay *pReplay)
+{
+   GLushort red = (GLushort) _gldReplayU32(pReplay);
+   GLushort green = (GLushort) _gldReplayU32(pReplay);
+   GLushort blue = (GLushort) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3us))
+      pReplay->Table.Color3us(red, green, blue);
+}
+
+static void _gldReplay_Color3usv(GLD_replay *pReplay)
+{
+   const GLushort * v = (const GLushort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color3usv))
+      pReplay->Table.Color3usv(v);
+}
+
+static void _gldReplay_Color4b(GLD_replay *pReplay)
+{
+   GLbyte red = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte green = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte blue = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte alpha = (GLbyte) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4b))
+      pReplay->Table.Color4b(red, green, blue, alpha);
+}
+
+static void _gldReplay_Color4bv(GLD_replay *pReplay)
+{
+   const GLbyte * v = (const GLbyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4bv))
+      pReplay->Table.Color4bv(v);
+}
+
+static void _gldReplay_Color4d(GLD_replay *pReplay)
+{
+   GLdouble red = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble green = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble blue = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble alpha = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4d))
+      pReplay->Table.Color4d(red, green, blue, alpha);
+}
+
+static void _gldReplay_Color4dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4dv))
+      pReplay->Table.Color4dv(v);
+}
+
+static void _gldReplay_Color4f(GLD_replay *pReplay)
+{
+   GLfloat red = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat green = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat blue = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat alpha = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4f))
+      pReplay->Table.Color4f(red, green, blue, alpha);
+}
+
+static void _gldReplay_Color4fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4fv))
+      pReplay->Table.Color4fv(v);
+}
+
+static void _gldReplay_Color4i(GLD_replay *pReplay)
+{
+   GLint red = (GLint) _gldReplayS32(pReplay);
+   GLint green = (GLint) _gldReplayS32(pReplay);
+   GLint blue = (GLint) _gldReplayS32(pReplay);
+   GLint alpha = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4i))
+      pReplay->Table.Color4i(red, green, blue, alpha);
+}
+
+static void _gldReplay_Color4iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4iv))
+      pReplay->Table.Color4iv(v);
+}
+
+static void _gldReplay_Color4s(GLD_replay *pReplay)
+{
+   GLshort red = (GLshort) _gldReplayS32(pReplay);
+   GLshort green = (GLshort) _gldReplayS32(pReplay);
+   GLshort blue = (GLshort) _gldReplayS32(pReplay);
+   GLshort alpha = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4s))
+      pReplay->Table.Color4s(red, green, blue, alpha);
+}
+
+static void _gldReplay_Color4sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4sv))
+      pReplay->Table.Color4sv(v);
+}
+
+static void _gldReplay_Color4ub(GLD_replay *pReplay)
+{
+   GLubyte red = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte green = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte blue = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte alpha = (GLubyte) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4ub))
+      pReplay->Table.Color4ub(red, green, blue, alpha);
+}
+
+static void _gldReplay_Color4ubv(GLD_replay *pReplay)
+{
+   const GLubyte * v = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4ubv))
+      pReplay->Table.Color4ubv(v);
+}
+
+static void _gldReplay_Color4ui(GLD_replay *pReplay)
+{
+   GLuint red = (GLuint) _gldReplayU32(pReplay);
+   GLuint green = (GLuint) _gldReplayU32(pReplay);
+   GLuint blue = (GLuint) _gldReplayU32(pReplay);
+   GLuint alpha = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4ui))
+      pReplay->Table.Color4ui(red, green, blue, alpha);
+}
+
+static void _gldReplay_Color4uiv(GLD_replay *pReplay)
+{
+   const GLuint * v = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4uiv))
+      pReplay->Table.Color4uiv(v);
+}
+
+static void _gldReplay_Color4us(GLD_replay *pReplay)
+{
+   GLushort red = (GLushort) _gldReplayU32(pReplay);
+   GLushort green = (GLushort) _gldReplayU32(pReplay);
+   GLushort blue = (GLushort) _gldReplayU32(pReplay);
+   GLushort alpha = (GLushort) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4us))
+      pReplay->Table.Color4us(red, green, blue, alpha);
+}
+
+static void _gldReplay_Color4usv(GLD_replay *pReplay)
+{
+   const GLushort * v = (const GLushort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Color4usv))
+      pReplay->Table.Color4usv(v);
+}
+
+static void _gldReplay_EdgeFlag(GLD_replay *pReplay)
+{
+   GLboolean flag = (GLboolean) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EdgeFlag))
+      pReplay->Table.EdgeFlag(flag);
+}
+
+static void _gldReplay_EdgeFlagv(GLD_replay *pReplay)
+{
+   const GLboolean * flag = (const GLboolean *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EdgeFlagv))
+      pReplay->Table.EdgeFlagv(flag);
+}
+
+static void _gldReplay_End(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, End))
+      pReplay->Table.End();
+}
+
+static void _gldReplay_Indexd(GLD_replay *pReplay)
+{
+   GLdouble c = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexd))
+      pReplay->Table.Indexd(c);
+}
+
+static void _gldReplay_Indexdv(GLD_replay *pReplay)
+{
+   const GLdouble * c = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexdv))
+      pReplay->Table.Indexdv(c);
+}
+
+static void _gldReplay_Indexf(GLD_replay *pReplay)
+{
+   GLfloat c = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexf))
+      pReplay->Table.Indexf(c);
+}
+
+static void _gldReplay_Indexfv(GLD_replay *pReplay)
+{
+   const GLfloat * c = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexfv))
+      pReplay->Table.Indexfv(c);
+}
+
+static void _gldReplay_Indexi(GLD_replay *pReplay)
+{
+   GLint c = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexi))
+      pReplay->Table.Indexi(c);
+}
+
+static void _gldReplay_Indexiv(GLD_replay *pReplay)
+{
+   const GLint * c = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexiv))
+      pReplay->Table.Indexiv(c);
+}
+
+static void _gldReplay_Indexs(GLD_replay *pReplay)
+{
+   GLshort c = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexs))
+      pReplay->Table.Indexs(c);
+}
+
+static void _gldReplay_Indexsv(GLD_replay *pReplay)
+{
+   const GLshort * c = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexsv))
+      pReplay->Table.Indexsv(c);
+}
+
+static void _gldReplay_Normal3b(GLD_replay *pReplay)
+{
+   GLbyte nx = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte ny = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte nz = (GLbyte) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3b))
+      pReplay->Table.Normal3b(nx, ny, nz);
+}
+
+static void _gldReplay_Normal3bv(GLD_replay *pReplay)
+{
+   const GLbyte * v = (const GLbyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3bv))
+      pReplay->Table.Normal3bv(v);
+}
+
+static void _gldReplay_Normal3d(GLD_replay *pReplay)
+{
+   GLdouble nx = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble ny = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble nz = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3d))
+      pReplay->Table.Normal3d(nx, ny, nz);
+}
+
+static void _gldReplay_Normal3dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3dv))
+      pReplay->Table.Normal3dv(v);
+}
+
+static void _gldReplay_Normal3f(GLD_replay *pReplay)
+{
+   GLfloat nx = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat ny = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat nz = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3f))
+      pReplay->Table.Normal3f(nx, ny, nz);
+}
+
+static void _gldReplay_Normal3fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3fv))
+      pReplay->Table.Normal3fv(v);
+}
+
+static void _gldReplay_Normal3i(GLD_replay *pReplay)
+{
+   GLint nx = (GLint) _gldReplayS32(pReplay);
+   GLint ny = (GLint) _gldReplayS32(pReplay);
+   GLint nz = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3i))
+      pReplay->Table.Normal3i(nx, ny, nz);
+}
+
+static void _gldReplay_Normal3iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3iv))
+      pReplay->Table.Normal3iv(v);
+}
+
+static void _gldReplay_Normal3s(GLD_replay *pReplay)
+{
+   GLshort nx = (GLshort) _gldReplayS32(pReplay);
+   GLshort ny = (GLshort) _gldReplayS32(pReplay);
+   GLshort nz = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3s))
+      pReplay->Table.Normal3s(nx, ny, nz);
+}
+
+static void _gldReplay_Normal3sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Normal3sv))
+      pReplay->Table.Normal3sv(v);
+}
+
+static void _gldReplay_RasterPos2d(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos2d))
+      pReplay->Table.RasterPos2d(x, y);
+}
+
+static void _gldReplay_RasterPos2dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos2dv))
+      pReplay->Table.RasterPos2dv(v);
+}
+
+static void _gldReplay_RasterPos2f(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos2f))
+      pReplay->Table.RasterPos2f(x, y);
+}
+
+static void _gldReplay_RasterPos2fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos2fv))
+      pReplay->Table.RasterPos2fv(v);
+}
+
+static void _gldReplay_RasterPos2i(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos2i))
+      pReplay->Table.RasterPos2i(x, y);
+}
+
+static void _gldReplay_RasterPos2iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos2iv))
+      pReplay->Table.RasterPos2iv(v);
+}
+
+static void _gldReplay_RasterPos2s(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos2s))
+      pReplay->Table.RasterPos2s(x, y);
+}
+
+static void _gldReplay_RasterPos2sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos2sv))
+      pReplay->Table.RasterPos2sv(v);
+}
+
+static void _gldReplay_RasterPos3d(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos3d))
+      pReplay->Table.RasterPos3d(x, y, z);
+}
+
+static void _gldReplay_RasterPos3dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos3dv))
+      pReplay->Table.RasterPos3dv(v);
+}
+
+static void _gldReplay_RasterPos3f(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos3f))
+      pReplay->Table.RasterPos3f(x, y, z);
+}
+
+static void _gldReplay_RasterPos3fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos3fv))
+      pReplay->Table.RasterPos3fv(v);
+}
+
+static void _gldReplay_RasterPos3i(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLint z = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos3i))
+      pReplay->Table.RasterPos3i(x, y, z);
+}
+
+static void _gldReplay_RasterPos3iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos3iv))
+      pReplay->Table.RasterPos3iv(v);
+}
+
+static void _gldReplay_RasterPos3s(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   GLshort z = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos3s))
+      pReplay->Table.RasterPos3s(x, y, z);
+}
+
+static void _gldReplay_RasterPos3sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos3sv))
+      pReplay->Table.RasterPos3sv(v);
+}
+
+static void _gldReplay_RasterPos4d(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble w = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos4d))
+      pReplay->Table.RasterPos4d(x, y, z, w);
+}
+
+static void _gldReplay_RasterPos4dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos4dv))
+      pReplay->Table.RasterPos4dv(v);
+}
+
+static void _gldReplay_RasterPos4f(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat w = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos4f))
+      pReplay->Table.RasterPos4f(x, y, z, w);
+}
+
+static void _gldReplay_RasterPos4fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos4fv))
+      pReplay->Table.RasterPos4fv(v);
+}
+
+static void _gldReplay_RasterPos4i(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLint z = (GLint) _gldReplayS32(pReplay);
+   GLint w = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos4i))
+      pReplay->Table.RasterPos4i(x, y, z, w);
+}
+
+static void _gldReplay_RasterPos4iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos4iv))
+      pReplay->Table.RasterPos4iv(v);
+}
+
+static void _gldReplay_RasterPos4s(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   GLshort z = (GLshort) _gldReplayS32(pReplay);
+   GLshort w = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos4s))
+      pReplay->Table.RasterPos4s(x, y, z, w);
+}
+
+static void _gldReplay_RasterPos4sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RasterPos4sv))
+      pReplay->Table.RasterPos4sv(v);
+}
+
+static void _gldReplay_Rectd(GLD_replay *pReplay)
+{
+   GLdouble x1 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y1 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble x2 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y2 = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rectd))
+      pReplay->Table.Rectd(x1, y1, x2, y2);
+}
+
+static void _gldReplay_Rectdv(GLD_replay *pReplay)
+{
+   const GLdouble * v1 = (const GLdouble *) _gldReplayPtr(pReplay);
+   const GLdouble * v2 = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rectdv))
+      pReplay->Table.Rectdv(v1, v2);
+}
+
+static void _gldReplay_Rectf(GLD_replay *pReplay)
+{
+   GLfloat x1 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y1 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat x2 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y2 = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rectf))
+      pReplay->Table.Rectf(x1, y1, x2, y2);
+}
+
+static void _gldReplay_Rectfv(GLD_replay *pReplay)
+{
+   const GLfloat * v1 = (const GLfloat *) _gldReplayPtr(pReplay);
+   const GLfloat * v2 = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rectfv))
+      pReplay->Table.Rectfv(v1, v2);
+}
+
+static void _gldReplay_Recti(GLD_replay *pReplay)
+{
+   GLint x1 = (GLint) _gldReplayS32(pReplay);
+   GLint y1 = (GLint) _gldReplayS32(pReplay);
+   GLint x2 = (GLint) _gldReplayS32(pReplay);
+   GLint y2 = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Recti))
+      pReplay->Table.Recti(x1, y1, x2, y2);
+}
+
+static void _gldReplay_Rectiv(GLD_replay *pReplay)
+{
+   const GLint * v1 = (const GLint *) _gldReplayPtr(pReplay);
+   const GLint * v2 = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rectiv))
+      pReplay->Table.Rectiv(v1, v2);
+}
+
+static void _gldReplay_Rects(GLD_replay *pReplay)
+{
+   GLshort x1 = (GLshort) _gldReplayS32(pReplay);
+   GLshort y1 = (GLshort) _gldReplayS32(pReplay);
+   GLshort x2 = (GLshort) _gldReplayS32(pReplay);
+   GLshort y2 = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rects))
+      pReplay->Table.Rects(x1, y1, x2, y2);
+}
+
+static void _gldReplay_Rectsv(GLD_replay *pReplay)
+{
+   const GLshort * v1 = (const GLshort *) _gldReplayPtr(pReplay);
+   const GLshort * v2 = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rectsv))
+      pReplay->Table.Rectsv(v1, v2);
+}
+
+static void _gldReplay_TexCoord1d(GLD_replay *pReplay)
+{
+   GLdouble s = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord1d))
+      pReplay->Table.TexCoord1d(s);
+}
+
+static void _gldReplay_TexCoord1dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord1dv))
+      pReplay->Table.TexCoord1dv(v);
+}
+
+static void _gldReplay_TexCoord1f(GLD_replay *pReplay)
+{
+   GLfloat s = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord1f))
+      pReplay->Table.TexCoord1f(s);
+}
+
+static void _gldReplay_TexCoord1fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord1fv))
+      pReplay->Table.TexCoord1fv(v);
+}
+
+static void _gldReplay_TexCoord1i(GLD_replay *pReplay)
+{
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord1i))
+      pReplay->Table.TexCoord1i(s);
+}
+
+static void _gldReplay_TexCoord1iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord1iv))
+      pReplay->Table.TexCoord1iv(v);
+}
+
+static void _gldReplay_TexCoord1s(GLD_replay *pReplay)
+{
+   GLshort s = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord1s))
+      pReplay->Table.TexCoord1s(s);
+}
+
+static void _gldReplay_TexCoord1sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord1sv))
+      pReplay->Table.TexCoord1sv(v);
+}
+
+static void _gldReplay_TexCoord2d(GLD_replay *pReplay)
+{
+   GLdouble s = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble t = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord2d))
+      pReplay->Table.TexCoord2d(s, t);
+}
+
+static void _gldReplay_TexCoord2dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord2dv))
+      pReplay->Table.TexCoord2dv(v);
+}
+
+static void _gldReplay_TexCoord2f(GLD_replay *pReplay)
+{
+   GLfloat s = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat t = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord2f))
+      pReplay->Table.TexCoord2f(s, t);
+}
+
+static void _gldReplay_TexCoord2fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord2fv))
+      pReplay->Table.TexCoord2fv(v);
+}
+
+static void _gldReplay_TexCoord2i(GLD_replay *pReplay)
+{
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   GLint t = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord2i))
+      pReplay->Table.TexCoord2i(s, t);
+}
+
+static void _gldReplay_TexCoord2iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord2iv))
+      pReplay->Table.TexCoord2iv(v);
+}
+
+static void _gldReplay_TexCoord2s(GLD_replay *pReplay)
+{
+   GLshort s = (GLshort) _gldReplayS32(pReplay);
+   GLshort t = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord2s))
+      pReplay->Table.TexCoord2s(s, t);
+}
+
+static void _gldReplay_TexCoord2sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord2sv))
+      pReplay->Table.TexCoord2sv(v);
+}
+
+static void _gldReplay_TexCoord3d(GLD_replay *pReplay)
+{
+   GLdouble s = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble t = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble r = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord3d))
+      pReplay->Table.TexCoord3d(s, t, r);
+}
+
+static void _gldReplay_TexCoord3dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord3dv))
+      pReplay->Table.TexCoord3dv(v);
+}
+
+static void _gldReplay_TexCoord3f(GLD_replay *pReplay)
+{
+   GLfloat s = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat t = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat r = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord3f))
+      pReplay->Table.TexCoord3f(s, t, r);
+}
+
+static void _gldReplay_TexCoord3fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord3fv))
+      pReplay->Table.TexCoord3fv(v);
+}
+
+static void _gldReplay_TexCoord3i(GLD_replay *pReplay)
+{
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   GLint t = (GLint) _gldReplayS32(pReplay);
+   GLint r = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord3i))
+      pReplay->Table.TexCoord3i(s, t, r);
+}
+
+static void _gldReplay_TexCoord3iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord3iv))
+      pReplay->Table.TexCoord3iv(v);
+}
+
+static void _gldReplay_TexCoord3s(GLD_replay *pReplay)
+{
+   GLshort s = (GLshort) _gldReplayS32(pReplay);
+   GLshort t = (GLshort) _gldReplayS32(pReplay);
+   GLshort r = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord3s))
+      pReplay->Table.TexCoord3s(s, t, r);
+}
+
+static void _gldReplay_TexCoord3sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord3sv))
+      pReplay->Table.TexCoord3sv(v);
+}
+
+static void _gldReplay_TexCoord4d(GLD_replay *pReplay)
+{
+   GLdouble s = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble t = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble r = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble q = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord4d))
+      pReplay->Table.TexCoord4d(s, t, r, q);
+}
+
+static void _gldReplay_TexCoord4dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord4dv))
+      pReplay->Table.TexCoord4dv(v);
+}
+
+static void _gldReplay_TexCoord4f(GLD_replay *pReplay)
+{
+   GLfloat s = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat t = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat r = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat q = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord4f))
+      pReplay->Table.TexCoord4f(s, t, r, q);
+}
+
+static void _gldReplay_TexCoord4fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord4fv))
+      pReplay->Table.TexCoord4fv(v);
+}
+
+static void _gldReplay_TexCoord4i(GLD_replay *pReplay)
+{
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   GLint t = (GLint) _gldReplayS32(pReplay);
+   GLint r = (GLint) _gldReplayS32(pReplay);
+   GLint q = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord4i))
+      pReplay->Table.TexCoord4i(s, t, r, q);
+}
+
+static void _gldReplay_TexCoord4iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord4iv))
+      pReplay->Table.TexCoord4iv(v);
+}
+
+static void _gldReplay_TexCoord4s(GLD_replay *pReplay)
+{
+   GLshort s = (GLshort) _gldReplayS32(pReplay);
+   GLshort t = (GLshort) _gldReplayS32(pReplay);
+   GLshort r = (GLshort) _gldReplayS32(pReplay);
+   GLshort q = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord4s))
+      pReplay->Table.TexCoord4s(s, t, r, q);
+}
+
+static void _gldReplay_TexCoord4sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoord4sv))
+      pReplay->Table.TexCoord4sv(v);
+}
+
+static void _gldReplay_Vertex2d(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex2d))
+      pReplay->Table.Vertex2d(x, y);
+}
+
+static void _gldReplay_Vertex2dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex2dv))
+      pReplay->Table.Vertex2dv(v);
+}
+
+static void _gldReplay_Vertex2f(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex2f))
+      pReplay->Table.Vertex2f(x, y);
+}
+
+static void _gldReplay_Vertex2fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex2fv))
+      pReplay->Table.Vertex2fv(v);
+}
+
+static void _gldReplay_Vertex2i(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex2i))
+      pReplay->Table.Vertex2i(x, y);
+}
+
+static void _gldReplay_Vertex2iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex2iv))
+      pReplay->Table.Vertex2iv(v);
+}
+
+static void _gldReplay_Vertex2s(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex2s))
+      pReplay->Table.Vertex2s(x, y);
+}
+
+static void _gldReplay_Vertex2sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex2sv))
+      pReplay->Table.Vertex2sv(v);
+}
+
+static void _gldReplay_Vertex3d(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex3d))
+      pReplay->Table.Vertex3d(x, y, z);
+}
+
+static void _gldReplay_Vertex3dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex3dv))
+      pReplay->Table.Vertex3dv(v);
+}
+
+static void _gldReplay_Vertex3f(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex3f))
+      pReplay->Table.Vertex3f(x, y, z);
+}
+
+static void _gldReplay_Vertex3fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex3fv))
+      pReplay->Table.Vertex3fv(v);
+}
+
+static void _gldReplay_Vertex3i(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLint z = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex3i))
+      pReplay->Table.Vertex3i(x, y, z);
+}
+
+static void _gldReplay_Vertex3iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex3iv))
+      pReplay->Table.Vertex3iv(v);
+}
+
+static void _gldReplay_Vertex3s(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   GLshort z = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex3s))
+      pReplay->Table.Vertex3s(x, y, z);
+}
+
+static void _gldReplay_Vertex3sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex3sv))
+      pReplay->Table.Vertex3sv(v);
+}
+
+static void _gldReplay_Vertex4d(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble w = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex4d))
+      pReplay->Table.Vertex4d(x, y, z, w);
+}
+
+static void _gldReplay_Vertex4dv(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex4dv))
+      pReplay->Table.Vertex4dv(v);
+}
+
+static void _gldReplay_Vertex4f(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat w = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex4f))
+      pReplay->Table.Vertex4f(x, y, z, w);
+}
+
+static void _gldReplay_Vertex4fv(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex4fv))
+      pReplay->Table.Vertex4fv(v);
+}
+
+static void _gldReplay_Vertex4i(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLint z = (GLint) _gldReplayS32(pReplay);
+   GLint w = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex4i))
+      pReplay->Table.Vertex4i(x, y, z, w);
+}
+
+static void _gldReplay_Vertex4iv(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex4iv))
+      pReplay->Table.Vertex4iv(v);
+}
+
+static void _gldReplay_Vertex4s(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   GLshort z = (GLshort) _gldReplayS32(pReplay);
+   GLshort w = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex4s))
+      pReplay->Table.Vertex4s(x, y, z, w);
+}
+
+static void _gldReplay_Vertex4sv(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Vertex4sv))
+      pReplay->Table.Vertex4sv(v);
+}
+
+static void _gldReplay_ClipPlane(GLD_replay *pReplay)
+{
+   GLenum plane = (GLenum) _gldReplayU32(pReplay);
+   const GLdouble * equation = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ClipPlane))
+      pReplay->Table.ClipPlane(plane, equation);
+}
+
+static void _gldReplay_ColorMaterial(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ColorMaterial))
+      pReplay->Table.ColorMaterial(face, mode);
+}
+
+static void _gldReplay_CullFace(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CullFace))
+      pReplay->Table.CullFace(mode);
+}
+
+static void _gldReplay_Fogf(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Fogf))
+      pReplay->Table.Fogf(pname, param);
+}
+
+static void _gldReplay_Fogfv(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Fogfv))
+      pReplay->Table.Fogfv(pname, params);
+}
+
+static void _gldReplay_Fogi(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Fogi))
+      pReplay->Table.Fogi(pname, param);
+}
+
+static void _gldReplay_Fogiv(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Fogiv))
+      pReplay->Table.Fogiv(pname, params);
+}
+
+static void _gldReplay_FrontFace(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FrontFace))
+      pReplay->Table.FrontFace(mode);
+}
+
+static void _gldReplay_Hint(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Hint))
+      pReplay->Table.Hint(target, mode);
+}
+
+static void _gldReplay_Lightf(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Lightf))
+      pReplay->Table.Lightf(light, pname, param);
+}
+
+static void _gldReplay_Lightfv(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Lightfv))
+      pReplay->Table.Lightfv(light, pname, params);
+}
+
+static void _gldReplay_Lighti(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Lighti))
+      pReplay->Table.Lighti(light, pname, param);
+}
+
+static void _gldReplay_Lightiv(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Lightiv))
+      pReplay->Table.Lightiv(light, pname, params);
+}
+
+static void _gldReplay_LightModelf(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LightModelf))
+      pReplay->Table.LightModelf(pname, param);
+}
+
+static void _gldReplay_LightModelfv(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LightModelfv))
+      pReplay->Table.LightModelfv(pname, params);
+}
+
+static void _gldReplay_LightModeli(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LightModeli))
+      pReplay->Table.LightModeli(pname, param);
+}
+
+static void _gldReplay_LightModeliv(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LightModeliv))
+      pReplay->Table.LightModeliv(pname, params);
+}
+
+static void _gldReplay_LineStipple(GLD_replay *pReplay)
+{
+   GLint factor = (GLint) _gldReplayS32(pReplay);
+   GLushort pattern = (GLushort) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LineStipple))
+      pReplay->Table.LineStipple(factor, pattern);
+}
+
+static void _gldReplay_LineWidth(GLD_replay *pReplay)
+{
+   GLfloat width = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LineWidth))
+      pReplay->Table.LineWidth(width);
+}
+
+static void _gldReplay_Materialf(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Materialf))
+      pReplay->Table.Materialf(face, pname, param);
+}
+
+static void _gldReplay_Materialfv(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Materialfv))
+      pReplay->Table.Materialfv(face, pname, params);
+}
+
+static void _gldReplay_Materiali(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Materiali))
+      pReplay->Table.Materiali(face, pname, param);
+}
+
+static void _gldReplay_Materialiv(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Materialiv))
+      pReplay->Table.Materialiv(face, pname, params);
+}
+
+static void _gldReplay_PointSize(GLD_replay *pReplay)
+{
+   GLfloat size = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PointSize))
+      pReplay->Table.PointSize(size);
+}
+
+static void _gldReplay_PolygonMode(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PolygonMode))
+      pReplay->Table.PolygonMode(face, mode);
+}
+
+static void _gldReplay_PolygonStipple(GLD_replay *pReplay)
+{
+   const GLubyte * mask = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PolygonStipple))
+      pReplay->Table.PolygonStipple(mask);
+}
+
+static void _gldReplay_Scissor(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Scissor))
+      pReplay->Table.Scissor(x, y, width, height);
+}
+
+static void _gldReplay_ShadeModel(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ShadeModel))
+      pReplay->Table.ShadeModel(mode);
+}
+
+static void _gldReplay_TexParameterf(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexParameterf))
+      pReplay->Table.TexParameterf(target, pname, param);
+}
+
+static void _gldReplay_TexParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexParameterfv))
+      pReplay->Table.TexParameterfv(target, pname, params);
+}
+
+static void _gldReplay_TexParameteri(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexParameteri))
+      pReplay->Table.TexParameteri(target, pname, param);
+}
+
+static void _gldReplay_TexParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexParameteriv))
+      pReplay->Table.TexParameteriv(target, pname, params);
+}
+
+static void _gldReplay_TexImage1D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint internalformat = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLint border = (GLint) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * pixels = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexImage1D))
+      pReplay->Table.TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void _gldReplay_TexImage2D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint internalformat = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLint border = (GLint) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * pixels = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexImage2D))
+      pReplay->Table.TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void _gldReplay_TexEnvf(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexEnvf))
+      pReplay->Table.TexEnvf(target, pname, param);
+}
+
+static void _gldReplay_TexEnvfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexEnvfv))
+      pReplay->Table.TexEnvfv(target, pname, params);
+}
+
+static void _gldReplay_TexEnvi(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexEnvi))
+      pReplay->Table.TexEnvi(target, pname, param);
+}
+
+static void _gldReplay_TexEnviv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexEnviv))
+      pReplay->Table.TexEnviv(target, pname, params);
+}
+
+static void _gldReplay_TexGend(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLdouble param = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexGend))
+      pReplay->Table.TexGend(coord, pname, param);
+}
+
+static void _gldReplay_TexGendv(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLdouble * params = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexGendv))
+      pReplay->Table.TexGendv(coord, pname, params);
+}
+
+static void _gldReplay_TexGenf(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexGenf))
+      pReplay->Table.TexGenf(coord, pname, param);
+}
+
+static void _gldReplay_TexGenfv(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexGenfv))
+      pReplay->Table.TexGenfv(coord, pname, params);
+}
+
+static void _gldReplay_TexGeni(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexGeni))
+      pReplay->Table.TexGeni(coord, pname, param);
+}
+
+static void _gldReplay_TexGeniv(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexGeniv))
+      pReplay->Table.TexGeniv(coord, pname, params);
+}
+
+static void _gldReplay_FeedbackBuffer(GLD_replay *pReplay)
+{
+   GLsizei size = (GLsizei) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * buffer = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FeedbackBuffer))
+      pReplay->Table.FeedbackBuffer(size, type, buffer);
+}
+
+static void _gldReplay_SelectBuffer(GLD_replay *pReplay)
+{
+   GLsizei size = (GLsizei) _gldReplayS32(pReplay);
+   GLuint * buffer = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SelectBuffer))
+      pReplay->Table.SelectBuffer(size, buffer);
+}
+
+static void _gldReplay_RenderMode(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RenderMode))
+      (void) pReplay->Table.RenderMode(mode);
+}
+
+static void _gldReplay_InitNames(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, InitNames))
+      pReplay->Table.InitNames();
+}
+
+static void _gldReplay_LoadName(GLD_replay *pReplay)
+{
+   GLuint name = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LoadName))
+      pReplay->Table.LoadName(name);
+}
+
+static void _gldReplay_PassThrough(GLD_replay *pReplay)
+{
+   GLfloat token = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PassThrough))
+      pReplay->Table.PassThrough(token);
+}
+
+static void _gldReplay_PopName(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, PopName))
+      pReplay->Table.PopName();
+}
+
+static void _gldReplay_PushName(GLD_replay *pReplay)
+{
+   GLuint name = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PushName))
+      pReplay->Table.PushName(name);
+}
+
+static void _gldReplay_DrawBuffer(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DrawBuffer))
+      pReplay->Table.DrawBuffer(mode);
+}
+
+static void _gldReplay_Clear(GLD_replay *pReplay)
+{
+   GLbitfield mask = (GLbitfield) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Clear))
+      pReplay->Table.Clear(mask);
+}
+
+static void _gldReplay_ClearAccum(GLD_replay *pReplay)
+{
+   GLfloat red = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat green = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat blue = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat alpha = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ClearAccum))
+      pReplay->Table.ClearAccum(red, green, blue, alpha);
+}
+
+static void _gldReplay_ClearIndex(GLD_replay *pReplay)
+{
+   GLfloat c = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ClearIndex))
+      pReplay->Table.ClearIndex(c);
+}
+
+static void _gldReplay_ClearColor(GLD_replay *pReplay)
+{
+   GLclampf red = (GLclampf) _gldReplayF32(pReplay);
+   GLclampf green = (GLclampf) _gldReplayF32(pReplay);
+   GLclampf blue = (GLclampf) _gldReplayF32(pReplay);
+   GLclampf alpha = (GLclampf) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ClearColor))
+      pReplay->Table.ClearColor(red, green, blue, alpha);
+}
+
+static void _gldReplay_ClearStencil(GLD_replay *pReplay)
+{
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ClearStencil))
+      pReplay->Table.ClearStencil(s);
+}
+
+static void _gldReplay_ClearDepth(GLD_replay *pReplay)
+{
+   GLclampd depth = (GLclampd) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ClearDepth))
+      pReplay->Table.ClearDepth(depth);
+}
+
+static void _gldReplay_StencilMask(GLD_replay *pReplay)
+{
+   GLuint mask = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, StencilMask))
+      pReplay->Table.StencilMask(mask);
+}
+
+static void _gldReplay_ColorMask(GLD_replay *pReplay)
+{
+   GLboolean red = (GLboolean) _gldReplayU32(pReplay);
+   GLboolean green = (GLboolean) _gldReplayU32(pReplay);
+   GLboolean blue = (GLboolean) _gldReplayU32(pReplay);
+   GLboolean alpha = (GLboolean) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ColorMask))
+      pReplay->Table.ColorMask(red, green, blue, alpha);
+}
+
+static void _gldReplay_DepthMask(GLD_replay *pReplay)
+{
+   GLboolean flag = (GLboolean) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DepthMask))
+      pReplay->Table.DepthMask(flag);
+}
+
+static void _gldReplay_IndexMask(GLD_replay *pReplay)
+{
+   GLuint mask = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IndexMask))
+      pReplay->Table.IndexMask(mask);
+}
+
+static void _gldReplay_Accum(GLD_replay *pReplay)
+{
+   GLenum op = (GLenum) _gldReplayU32(pReplay);
+   GLfloat value = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Accum))
+      pReplay->Table.Accum(op, value);
+}
+
+static void _gldReplay_Disable(GLD_replay *pReplay)
+{
+   GLenum cap = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Disable))
+      pReplay->Table.Disable(cap);
+}
+
+static void _gldReplay_Enable(GLD_replay *pReplay)
+{
+   GLenum cap = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Enable))
+      pReplay->Table.Enable(cap);
+}
+
+static void _gldReplay_Finish(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, Finish))
+      pReplay->Table.Finish();
+}
+
+static void _gldReplay_Flush(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, Flush))
+      pReplay->Table.Flush();
+}
+
+static void _gldReplay_PopAttrib(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, PopAttrib))
+      pReplay->Table.PopAttrib();
+}
+
+static void _gldReplay_PushAttrib(GLD_replay *pReplay)
+{
+   GLbitfield mask = (GLbitfield) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PushAttrib))
+      pReplay->Table.PushAttrib(mask);
+}
+
+static void _gldReplay_Map1d(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLdouble u1 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble u2 = (GLdouble) _gldReplayF64(pReplay);
+   GLint stride = (GLint) _gldReplayS32(pReplay);
+   GLint order = (GLint) _gldReplayS32(pReplay);
+   const GLdouble * points = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Map1d))
+      pReplay->Table.Map1d(target, u1, u2, stride, order, points);
+}
+
+static void _gldReplay_Map1f(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLfloat u1 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat u2 = (GLfloat) _gldReplayF32(pReplay);
+   GLint stride = (GLint) _gldReplayS32(pReplay);
+   GLint order = (GLint) _gldReplayS32(pReplay);
+   const GLfloat * points = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Map1f))
+      pReplay->Table.Map1f(target, u1, u2, stride, order, points);
+}
+
+static void _gldReplay_Map2d(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLdouble u1 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble u2 = (GLdouble) _gldReplayF64(pReplay);
+   GLint ustride = (GLint) _gldReplayS32(pReplay);
+   GLint uorder = (GLint) _gldReplayS32(pReplay);
+   GLdouble v1 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble v2 = (GLdouble) _gldReplayF64(pReplay);
+   GLint vstride = (GLint) _gldReplayS32(pReplay);
+   GLint vorder = (GLint) _gldReplayS32(pReplay);
+   const GLdouble * points = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Map2d))
+      pReplay->Table.Map2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void _gldReplay_Map2f(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLfloat u1 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat u2 = (GLfloat) _gldReplayF32(pReplay);
+   GLint ustride = (GLint) _gldReplayS32(pReplay);
+   GLint uorder = (GLint) _gldReplayS32(pReplay);
+   GLfloat v1 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat v2 = (GLfloat) _gldReplayF32(pReplay);
+   GLint vstride = (GLint) _gldReplayS32(pReplay);
+   GLint vorder = (GLint) _gldReplayS32(pReplay);
+   const GLfloat * points = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Map2f))
+      pReplay->Table.Map2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void _gldReplay_MapGrid1d(GLD_replay *pReplay)
+{
+   GLint un = (GLint) _gldReplayS32(pReplay);
+   GLdouble u1 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble u2 = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MapGrid1d))
+      pReplay->Table.MapGrid1d(un, u1, u2);
+}
+
+static void _gldReplay_MapGrid1f(GLD_replay *pReplay)
+{
+   GLint un = (GLint) _gldReplayS32(pReplay);
+   GLfloat u1 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat u2 = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MapGrid1f))
+      pReplay->Table.MapGrid1f(un, u1, u2);
+}
+
+static void _gldReplay_MapGrid2d(GLD_replay *pReplay)
+{
+   GLint un = (GLint) _gldReplayS32(pReplay);
+   GLdouble u1 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble u2 = (GLdouble) _gldReplayF64(pReplay);
+   GLint vn = (GLint) _gldReplayS32(pReplay);
+   GLdouble v1 = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble v2 = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MapGrid2d))
+      pReplay->Table.MapGrid2d(un, u1, u2, vn, v1, v2);
+}
+
+static void _gldReplay_MapGrid2f(GLD_replay *pReplay)
+{
+   GLint un = (GLint) _gldReplayS32(pReplay);
+   GLfloat u1 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat u2 = (GLfloat) _gldReplayF32(pReplay);
+   GLint vn = (GLint) _gldReplayS32(pReplay);
+   GLfloat v1 = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat v2 = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MapGrid2f))
+      pReplay->Table.MapGrid2f(un, u1, u2, vn, v1, v2);
+}
+
+static void _gldReplay_EvalCoord1d(GLD_replay *pReplay)
+{
+   GLdouble u = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalCoord1d))
+      pReplay->Table.EvalCoord1d(u);
+}
+
+static void _gldReplay_EvalCoord1dv(GLD_replay *pReplay)
+{
+   const GLdouble * u = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalCoord1dv))
+      pReplay->Table.EvalCoord1dv(u);
+}
+
+static void _gldReplay_EvalCoord1f(GLD_replay *pReplay)
+{
+   GLfloat u = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalCoord1f))
+      pReplay->Table.EvalCoord1f(u);
+}
+
+static void _gldReplay_EvalCoord1fv(GLD_replay *pReplay)
+{
+   const GLfloat * u = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalCoord1fv))
+      pReplay->Table.EvalCoord1fv(u);
+}
+
+static void _gldReplay_EvalCoord2d(GLD_replay *pReplay)
+{
+   GLdouble u = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble v = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalCoord2d))
+      pReplay->Table.EvalCoord2d(u, v);
+}
+
+static void _gldReplay_EvalCoord2dv(GLD_replay *pReplay)
+{
+   const GLdouble * u = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalCoord2dv))
+      pReplay->Table.EvalCoord2dv(u);
+}
+
+static void _gldReplay_EvalCoord2f(GLD_replay *pReplay)
+{
+   GLfloat u = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat v = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalCoord2f))
+      pReplay->Table.EvalCoord2f(u, v);
+}
+
+static void _gldReplay_EvalCoord2fv(GLD_replay *pReplay)
+{
+   const GLfloat * u = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalCoord2fv))
+      pReplay->Table.EvalCoord2fv(u);
+}
+
+static void _gldReplay_EvalMesh1(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   GLint i1 = (GLint) _gldReplayS32(pReplay);
+   GLint i2 = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalMesh1))
+      pReplay->Table.EvalMesh1(mode, i1, i2);
+}
+
+static void _gldReplay_EvalPoint1(GLD_replay *pReplay)
+{
+   GLint i = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalPoint1))
+      pReplay->Table.EvalPoint1(i);
+}
+
+static void _gldReplay_EvalMesh2(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   GLint i1 = (GLint) _gldReplayS32(pReplay);
+   GLint i2 = (GLint) _gldReplayS32(pReplay);
+   GLint j1 = (GLint) _gldReplayS32(pReplay);
+   GLint j2 = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalMesh2))
+      pReplay->Table.EvalMesh2(mode, i1, i2, j1, j2);
+}
+
+static void _gldReplay_EvalPoint2(GLD_replay *pReplay)
+{
+   GLint i = (GLint) _gldReplayS32(pReplay);
+   GLint j = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EvalPoint2))
+      pReplay->Table.EvalPoint2(i, j);
+}
+
+static void _gldReplay_AlphaFunc(GLD_replay *pReplay)
+{
+   GLenum func = (GLenum) _gldReplayU32(pReplay);
+   GLclampf ref = (GLclampf) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, AlphaFunc))
+      pReplay->Table.AlphaFunc(func, ref);
+}
+
+static void _gldReplay_BlendFunc(GLD_replay *pReplay)
+{
+   GLenum sfactor = (GLenum) _gldReplayU32(pReplay);
+   GLenum dfactor = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BlendFunc))
+      pReplay->Table.BlendFunc(sfactor, dfactor);
+}
+
+static void _gldReplay_LogicOp(GLD_replay *pReplay)
+{
+   GLenum opcode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LogicOp))
+      pReplay->Table.LogicOp(opcode);
+}
+
+static void _gldReplay_StencilFunc(GLD_replay *pReplay)
+{
+   GLenum func = (GLenum) _gldReplayU32(pReplay);
+   GLint ref = (GLint) _gldReplayS32(pReplay);
+   GLuint mask = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, StencilFunc))
+      pReplay->Table.StencilFunc(func, ref, mask);
+}
+
+static void _gldReplay_StencilOp(GLD_replay *pReplay)
+{
+   GLenum fail = (GLenum) _gldReplayU32(pReplay);
+   GLenum zfail = (GLenum) _gldReplayU32(pReplay);
+   GLenum zpass = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, StencilOp))
+      pReplay->Table.StencilOp(fail, zfail, zpass);
+}
+
+static void _gldReplay_DepthFunc(GLD_replay *pReplay)
+{
+   GLenum func = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DepthFunc))
+      pReplay->Table.DepthFunc(func);
+}
+
+static void _gldReplay_PixelZoom(GLD_replay *pReplay)
+{
+   GLfloat xfactor = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat yfactor = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelZoom))
+      pReplay->Table.PixelZoom(xfactor, yfactor);
+}
+
+static void _gldReplay_PixelTransferf(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelTransferf))
+      pReplay->Table.PixelTransferf(pname, param);
+}
+
+static void _gldReplay_PixelTransferi(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelTransferi))
+      pReplay->Table.PixelTransferi(pname, param);
+}
+
+static void _gldReplay_PixelStoref(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelStoref))
+      pReplay->Table.PixelStoref(pname, param);
+}
+
+static void _gldReplay_PixelStorei(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelStorei))
+      pReplay->Table.PixelStorei(pname, param);
+}
+
+static void _gldReplay_PixelMapfv(GLD_replay *pReplay)
+{
+   GLenum map = (GLenum) _gldReplayU32(pReplay);
+   GLsizei mapsize = (GLsizei) _gldReplayS32(pReplay);
+   const GLfloat * values = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelMapfv))
+      pReplay->Table.PixelMapfv(map, mapsize, values);
+}
+
+static void _gldReplay_PixelMapuiv(GLD_replay *pReplay)
+{
+   GLenum map = (GLenum) _gldReplayU32(pReplay);
+   GLsizei mapsize = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * values = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelMapuiv))
+      pReplay->Table.PixelMapuiv(map, mapsize, values);
+}
+
+static void _gldReplay_PixelMapusv(GLD_replay *pReplay)
+{
+   GLenum map = (GLenum) _gldReplayU32(pReplay);
+   GLsizei mapsize = (GLsizei) _gldReplayS32(pReplay);
+   const GLushort * values = (const GLushort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelMapusv))
+      pReplay->Table.PixelMapusv(map, mapsize, values);
+}
+
+static void _gldReplay_ReadBuffer(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ReadBuffer))
+      pReplay->Table.ReadBuffer(mode);
+}
+
+static void _gldReplay_CopyPixels(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyPixels))
+      pReplay->Table.CopyPixels(x, y, width, height, type);
+}
+
+static void _gldReplay_ReadPixels(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * pixels = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ReadPixels))
+      pReplay->Table.ReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static void _gldReplay_DrawPixels(GLD_replay *pReplay)
+{
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * pixels = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DrawPixels))
+      pReplay->Table.DrawPixels(width, height, format, type, pixels);
+}
+
+static void _gldReplay_GetBooleanv(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLboolean * params = (GLboolean *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetBooleanv))
+      pReplay->Table.GetBooleanv(pname, params);
+}
+
+static void _gldReplay_GetClipPlane(GLD_replay *pReplay)
+{
+   GLenum plane = (GLenum) _gldReplayU32(pReplay);
+   GLdouble * equation = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetClipPlane))
+      pReplay->Table.GetClipPlane(plane, equation);
+}
+
+static void _gldReplay_GetDoublev(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLdouble * params = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetDoublev))
+      pReplay->Table.GetDoublev(pname, params);
+}
+
+static void _gldReplay_GetError(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, GetError))
+      (void) pReplay->Table.GetError();
+}
+
+static void _gldReplay_GetFloatv(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetFloatv))
+      pReplay->Table.GetFloatv(pname, params);
+}
+
+static void _gldReplay_GetIntegerv(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetIntegerv))
+      pReplay->Table.GetIntegerv(pname, params);
+}
+
+static void _gldReplay_GetLightfv(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetLightfv))
+      pReplay->Table.GetLightfv(light, pname, params);
+}
+
+static void _gldReplay_GetLightiv(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetLightiv))
+      pReplay->Table.GetLightiv(light, pname, params);
+}
+
+static void _gldReplay_GetMapdv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum query = (GLenum) _gldReplayU32(pReplay);
+   GLdouble * v = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMapdv))
+      pReplay->Table.GetMapdv(target, query, v);
+}
+
+static void _gldReplay_GetMapfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum query = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * v = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMapfv))
+      pReplay->Table.GetMapfv(target, query, v);
+}
+
+static void _gldReplay_GetMapiv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum query = (GLenum) _gldReplayU32(pReplay);
+   GLint * v = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMapiv))
+      pReplay->Table.GetMapiv(target, query, v);
+}
+
+static void _gldReplay_GetMaterialfv(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMaterialfv))
+      pReplay->Table.GetMaterialfv(face, pname, params);
+}
+
+static void _gldReplay_GetMaterialiv(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMaterialiv))
+      pReplay->Table.GetMaterialiv(face, pname, params);
+}
+
+static void _gldReplay_GetPixelMapfv(GLD_replay *pReplay)
+{
+   GLenum map = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * values = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetPixelMapfv))
+      pReplay->Table.GetPixelMapfv(map, values);
+}
+
+static void _gldReplay_GetPixelMapuiv(GLD_replay *pReplay)
+{
+   GLenum map = (GLenum) _gldReplayU32(pReplay);
+   GLuint * values = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetPixelMapuiv))
+      pReplay->Table.GetPixelMapuiv(map, values);
+}
+
+static void _gldReplay_GetPixelMapusv(GLD_replay *pReplay)
+{
+   GLenum map = (GLenum) _gldReplayU32(pReplay);
+   GLushort * values = (GLushort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetPixelMapusv))
+      pReplay->Table.GetPixelMapusv(map, values);
+}
+
+static void _gldReplay_GetPolygonStipple(GLD_replay *pReplay)
+{
+   GLubyte * mask = (GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetPolygonStipple))
+      pReplay->Table.GetPolygonStipple(mask);
+}
+
+static void _gldReplay_GetString(GLD_replay *pReplay)
+{
+   GLenum name = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetString))
+      (void) pReplay->Table.GetString(name);
+}
+
+static void _gldReplay_GetTexEnvfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexEnvfv))
+      pReplay->Table.GetTexEnvfv(target, pname, params);
+}
+
+static void _gldReplay_GetTexEnviv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexEnviv))
+      pReplay->Table.GetTexEnviv(target, pname, params);
+}
+
+static void _gldReplay_GetTexGendv(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLdouble * params = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexGendv))
+      pReplay->Table.GetTexGendv(coord, pname, params);
+}
+
+static void _gldReplay_GetTexGenfv(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexGenfv))
+      pReplay->Table.GetTexGenfv(coord, pname, params);
+}
+
+static void _gldReplay_GetTexGeniv(GLD_replay *pReplay)
+{
+   GLenum coord = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexGeniv))
+      pReplay->Table.GetTexGeniv(coord, pname, params);
+}
+
+static void _gldReplay_GetTexImage(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * pixels = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexImage))
+      pReplay->Table.GetTexImage(target, level, format, type, pixels);
+}
+
+static void _gldReplay_GetTexParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexParameterfv))
+      pReplay->Table.GetTexParameterfv(target, pname, params);
+}
+
+static void _gldReplay_GetTexParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexParameteriv))
+      pReplay->Table.GetTexParameteriv(target, pname, params);
+}
+
+static void _gldReplay_GetTexLevelParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexLevelParameterfv))
+      pReplay->Table.GetTexLevelParameterfv(target, level, pname, params);
+}
+
+static void _gldReplay_GetTexLevelParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexLevelParameteriv))
+      pReplay->Table.GetTexLevelParameteriv(target, level, pname, params);
+}
+
+static void _gldReplay_IsEnabled(GLD_replay *pReplay)
+{
+   GLenum cap = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IsEnabled))
+      (void) pReplay->Table.IsEnabled(cap);
+}
+
+static void _gldReplay_IsList(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IsList))
+      (void) pReplay->Table.IsList(list);
+}
+
+static void _gldReplay_DepthRange(GLD_replay *pReplay)
+{
+   GLclampd zNear = (GLclampd) _gldReplayF64(pReplay);
+   GLclampd zFar = (GLclampd) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DepthRange))
+      pReplay->Table.DepthRange(zNear, zFar);
+}
+
+static void _gldReplay_Frustum(GLD_replay *pReplay)
+{
+   GLdouble left = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble right = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble bottom = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble top = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble zNear = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble zFar = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Frustum))
+      pReplay->Table.Frustum(left, right, bottom, top, zNear, zFar);
+}
+
+static void _gldReplay_LoadIdentity(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, LoadIdentity))
+      pReplay->Table.LoadIdentity();
+}
+
+static void _gldReplay_LoadMatrixf(GLD_replay *pReplay)
+{
+   const GLfloat * m = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LoadMatrixf))
+      pReplay->Table.LoadMatrixf(m);
+}
+
+static void _gldReplay_LoadMatrixd(GLD_replay *pReplay)
+{
+   const GLdouble * m = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LoadMatrixd))
+      pReplay->Table.LoadMatrixd(m);
+}
+
+static void _gldReplay_MatrixMode(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MatrixMode))
+      pReplay->Table.MatrixMode(mode);
+}
+
+static void _gldReplay_MultMatrixf(GLD_replay *pReplay)
+{
+   const GLfloat * m = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultMatrixf))
+      pReplay->Table.MultMatrixf(m);
+}
+
+static void _gldReplay_MultMatrixd(GLD_replay *pReplay)
+{
+   const GLdouble * m = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultMatrixd))
+      pReplay->Table.MultMatrixd(m);
+}
+
+static void _gldReplay_Ortho(GLD_replay *pReplay)
+{
+   GLdouble left = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble right = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble bottom = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble top = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble zNear = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble zFar = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Ortho))
+      pReplay->Table.Ortho(left, right, bottom, top, zNear, zFar);
+}
+
+static void _gldReplay_PopMatrix(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, PopMatrix))
+      pReplay->Table.PopMatrix();
+}
+
+static void _gldReplay_PushMatrix(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, PushMatrix))
+      pReplay->Table.PushMatrix();
+}
+
+static void _gldReplay_Rotated(GLD_replay *pReplay)
+{
+   GLdouble angle = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rotated))
+      pReplay->Table.Rotated(angle, x, y, z);
+}
+
+static void _gldReplay_Rotatef(GLD_replay *pReplay)
+{
+   GLfloat angle = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Rotatef))
+      pReplay->Table.Rotatef(angle, x, y, z);
+}
+
+static void _gldReplay_Scaled(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Scaled))
+      pReplay->Table.Scaled(x, y, z);
+}
+
+static void _gldReplay_Scalef(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Scalef))
+      pReplay->Table.Scalef(x, y, z);
+}
+
+static void _gldReplay_Translated(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Translated))
+      pReplay->Table.Translated(x, y, z);
+}
+
+static void _gldReplay_Translatef(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Translatef))
+      pReplay->Table.Translatef(x, y, z);
+}
+
+static void _gldReplay_Viewport(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Viewport))
+      pReplay->Table.Viewport(x, y, width, height);
+}
+
+static void _gldReplay_ArrayElement(GLD_replay *pReplay)
+{
+   GLint i = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ArrayElement))
+      pReplay->Table.ArrayElement(i);
+}
+
+static void _gldReplay_BindTexture(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint texture = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BindTexture))
+      pReplay->Table.BindTexture(target, texture);
+}
+
+static void _gldReplay_ColorPointer(GLD_replay *pReplay)
+{
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ColorPointer))
+      pReplay->Table.ColorPointer(size, type, stride, pointer);
+}
+
+static void _gldReplay_DisableClientState(GLD_replay *pReplay)
+{
+   GLenum array = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DisableClientState))
+      pReplay->Table.DisableClientState(array);
+}
+
+static void _gldReplay_DrawArrays(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   GLint first = (GLint) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DrawArrays))
+      pReplay->Table.DrawArrays(mode, first, count);
+}
+
+static void _gldReplay_DrawElements(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * indices = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DrawElements))
+      pReplay->Table.DrawElements(mode, count, type, indices);
+}
+
+static void _gldReplay_EdgeFlagPointer(GLD_replay *pReplay)
+{
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EdgeFlagPointer))
+      pReplay->Table.EdgeFlagPointer(stride, pointer);
+}
+
+static void _gldReplay_EnableClientState(GLD_replay *pReplay)
+{
+   GLenum array = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EnableClientState))
+      pReplay->Table.EnableClientState(array);
+}
+
+static void _gldReplay_IndexPointer(GLD_replay *pReplay)
+{
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IndexPointer))
+      pReplay->Table.IndexPointer(type, stride, pointer);
+}
+
+static void _gldReplay_Indexub(GLD_replay *pReplay)
+{
+   GLubyte c = (GLubyte) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexub))
+      pReplay->Table.Indexub(c);
+}
+
+static void _gldReplay_Indexubv(GLD_replay *pReplay)
+{
+   const GLubyte * c = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Indexubv))
+      pReplay->Table.Indexubv(c);
+}
+
+static void _gldReplay_InterleavedArrays(GLD_replay *pReplay)
+{
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, InterleavedArrays))
+      pReplay->Table.InterleavedArrays(format, stride, pointer);
+}
+
+static void _gldReplay_NormalPointer(GLD_replay *pReplay)
+{
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, NormalPointer))
+      pReplay->Table.NormalPointer(type, stride, pointer);
+}
+
+static void _gldReplay_PolygonOffset(GLD_replay *pReplay)
+{
+   GLfloat factor = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat units = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PolygonOffset))
+      pReplay->Table.PolygonOffset(factor, units);
+}
+
+static void _gldReplay_TexCoordPointer(GLD_replay *pReplay)
+{
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoordPointer))
+      pReplay->Table.TexCoordPointer(size, type, stride, pointer);
+}
+
+static void _gldReplay_VertexPointer(GLD_replay *pReplay)
+{
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexPointer))
+      pReplay->Table.VertexPointer(size, type, stride, pointer);
+}
+
+static void _gldReplay_AreTexturesResident(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * textures = (const GLuint *) _gldReplayPtr(pReplay);
+   GLboolean * residences = (GLboolean *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, AreTexturesResident))
+      (void) pReplay->Table.AreTexturesResident(n, textures, residences);
+}
+
+static void _gldReplay_CopyTexImage1D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLint border = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyTexImage1D))
+      pReplay->Table.CopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+static void _gldReplay_CopyTexImage2D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLint border = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyTexImage2D))
+      pReplay->Table.CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+static void _gldReplay_CopyTexSubImage1D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyTexSubImage1D))
+      pReplay->Table.CopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+static void _gldReplay_CopyTexSubImage2D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLint yoffset = (GLint) _gldReplayS32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyTexSubImage2D))
+      pReplay->Table.CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void _gldReplay_DeleteTextures(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * textures = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DeleteTextures))
+      pReplay->Table.DeleteTextures(n, textures);
+}
+
+static void _gldReplay_GenTextures(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   GLuint * textures = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GenTextures))
+      pReplay->Table.GenTextures(n, textures);
+}
+
+static void _gldReplay_GetPointerv(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLvoid ** params = (GLvoid **) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetPointerv))
+      pReplay->Table.GetPointerv(pname, params);
+}
+
+static void _gldReplay_IsTexture(GLD_replay *pReplay)
+{
+   GLuint texture = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IsTexture))
+      (void) pReplay->Table.IsTexture(texture);
+}
+
+static void _gldReplay_PrioritizeTextures(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * textures = (const GLuint *) _gldReplayPtr(pReplay);
+   const GLclampf * priorities = (const GLclampf *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PrioritizeTextures))
+      pReplay->Table.PrioritizeTextures(n, textures, priorities);
+}
+
+static void _gldReplay_TexSubImage1D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * pixels = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexSubImage1D))
+      pReplay->Table.TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+static void _gldReplay_TexSubImage2D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLint yoffset = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * pixels = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexSubImage2D))
+      pReplay->Table.TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void _gldReplay_PopClientAttrib(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, PopClientAttrib))
+      pReplay->Table.PopClientAttrib();
+}
+
+static void _gldReplay_PushClientAttrib(GLD_replay *pReplay)
+{
+   GLbitfield mask = (GLbitfield) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PushClientAttrib))
+      pReplay->Table.PushClientAttrib(mask);
+}
+
+static void _gldReplay_BlendColor(GLD_replay *pReplay)
+{
+   GLclampf red = (GLclampf) _gldReplayF32(pReplay);
+   GLclampf green = (GLclampf) _gldReplayF32(pReplay);
+   GLclampf blue = (GLclampf) _gldReplayF32(pReplay);
+   GLclampf alpha = (GLclampf) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BlendColor))
+      pReplay->Table.BlendColor(red, green, blue, alpha);
+}
+
+static void _gldReplay_BlendEquation(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BlendEquation))
+      pReplay->Table.BlendEquation(mode);
+}
+
+static void _gldReplay_DrawRangeElements(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   GLuint start = (GLuint) _gldReplayU32(pReplay);
+   GLuint end = (GLuint) _gldReplayU32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * indices = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DrawRangeElements))
+      pReplay->Table.DrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static void _gldReplay_ColorTable(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * table = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ColorTable))
+      pReplay->Table.ColorTable(target, internalformat, width, format, type, table);
+}
+
+static void _gldReplay_ColorTableParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ColorTableParameterfv))
+      pReplay->Table.ColorTableParameterfv(target, pname, params);
+}
+
+static void _gldReplay_ColorTableParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ColorTableParameteriv))
+      pReplay->Table.ColorTableParameteriv(target, pname, params);
+}
+
+static void _gldReplay_CopyColorTable(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyColorTable))
+      pReplay->Table.CopyColorTable(target, internalformat, x, y, width);
+}
+
+static void _gldReplay_GetColorTable(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * table = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTable))
+      pReplay->Table.GetColorTable(target, format, type, table);
+}
+
+static void _gldReplay_GetColorTableParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTableParameterfv))
+      pReplay->Table.GetColorTableParameterfv(target, pname, params);
+}
+
+static void _gldReplay_GetColorTableParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTableParameteriv))
+      pReplay->Table.GetColorTableParameteriv(target, pname, params);
+}
+
+static void _gldReplay_ColorSubTable(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLsizei start = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ColorSubTable))
+      pReplay->Table.ColorSubTable(target, start, count, format, type, data);
+}
+
+static void _gldReplay_CopyColorSubTable(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLsizei start = (GLsizei) _gldReplayS32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyColorSubTable))
+      pReplay->Table.CopyColorSubTable(target, start, x, y, width);
+}
+
+static void _gldReplay_ConvolutionFilter1D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * image = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ConvolutionFilter1D))
+      pReplay->Table.ConvolutionFilter1D(target, internalformat, width, format, type, image);
+}
+
+static void _gldReplay_ConvolutionFilter2D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * image = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ConvolutionFilter2D))
+      pReplay->Table.ConvolutionFilter2D(target, internalformat, width, height, format, type, image);
+}
+
+static void _gldReplay_ConvolutionParameterf(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat params = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ConvolutionParameterf))
+      pReplay->Table.ConvolutionParameterf(target, pname, params);
+}
+
+static void _gldReplay_ConvolutionParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ConvolutionParameterfv))
+      pReplay->Table.ConvolutionParameterfv(target, pname, params);
+}
+
+static void _gldReplay_ConvolutionParameteri(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint params = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ConvolutionParameteri))
+      pReplay->Table.ConvolutionParameteri(target, pname, params);
+}
+
+static void _gldReplay_ConvolutionParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ConvolutionParameteriv))
+      pReplay->Table.ConvolutionParameteriv(target, pname, params);
+}
+
+static void _gldReplay_CopyConvolutionFilter1D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyConvolutionFilter1D))
+      pReplay->Table.CopyConvolutionFilter1D(target, internalformat, x, y, width);
+}
+
+static void _gldReplay_CopyConvolutionFilter2D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyConvolutionFilter2D))
+      pReplay->Table.CopyConvolutionFilter2D(target, internalformat, x, y, width, height);
+}
+
+static void _gldReplay_GetConvolutionFilter(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * image = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetConvolutionFilter))
+      pReplay->Table.GetConvolutionFilter(target, format, type, image);
+}
+
+static void _gldReplay_GetConvolutionParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetConvolutionParameterfv))
+      pReplay->Table.GetConvolutionParameterfv(target, pname, params);
+}
+
+static void _gldReplay_GetConvolutionParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetConvolutionParameteriv))
+      pReplay->Table.GetConvolutionParameteriv(target, pname, params);
+}
+
+static void _gldReplay_GetSeparableFilter(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * row = (GLvoid *) _gldReplayPtr(pReplay);
+   GLvoid * column = (GLvoid *) _gldReplayPtr(pReplay);
+   GLvoid * span = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetSeparableFilter))
+      pReplay->Table.GetSeparableFilter(target, format, type, row, column, span);
+}
+
+static void _gldReplay_SeparableFilter2D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * row = (const GLvoid *) _gldReplayPtr(pReplay);
+   const GLvoid * column = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SeparableFilter2D))
+      pReplay->Table.SeparableFilter2D(target, internalformat, width, height, format, type, row, column);
+}
+
+static void _gldReplay_GetHistogram(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLboolean reset = (GLboolean) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * values = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetHistogram))
+      pReplay->Table.GetHistogram(target, reset, format, type, values);
+}
+
+static void _gldReplay_GetHistogramParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetHistogramParameterfv))
+      pReplay->Table.GetHistogramParameterfv(target, pname, params);
+}
+
+static void _gldReplay_GetHistogramParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetHistogramParameteriv))
+      pReplay->Table.GetHistogramParameteriv(target, pname, params);
+}
+
+static void _gldReplay_GetMinmax(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLboolean reset = (GLboolean) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * values = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMinmax))
+      pReplay->Table.GetMinmax(target, reset, format, type, values);
+}
+
+static void _gldReplay_GetMinmaxParameterfv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMinmaxParameterfv))
+      pReplay->Table.GetMinmaxParameterfv(target, pname, params);
+}
+
+static void _gldReplay_GetMinmaxParameteriv(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMinmaxParameteriv))
+      pReplay->Table.GetMinmaxParameteriv(target, pname, params);
+}
+
+static void _gldReplay_Histogram(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLboolean sink = (GLboolean) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Histogram))
+      pReplay->Table.Histogram(target, width, internalformat, sink);
+}
+
+static void _gldReplay_Minmax(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLboolean sink = (GLboolean) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, Minmax))
+      pReplay->Table.Minmax(target, internalformat, sink);
+}
+
+static void _gldReplay_ResetHistogram(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ResetHistogram))
+      pReplay->Table.ResetHistogram(target);
+}
+
+static void _gldReplay_ResetMinmax(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ResetMinmax))
+      pReplay->Table.ResetMinmax(target);
+}
+
+static void _gldReplay_TexImage3D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint internalformat = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei depth = (GLsizei) _gldReplayS32(pReplay);
+   GLint border = (GLint) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * pixels = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexImage3D))
+      pReplay->Table.TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void _gldReplay_TexSubImage3D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLint yoffset = (GLint) _gldReplayS32(pReplay);
+   GLint zoffset = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei depth = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   const GLvoid * pixels = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexSubImage3D))
+      pReplay->Table.TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void _gldReplay_CopyTexSubImage3D(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLint yoffset = (GLint) _gldReplayS32(pReplay);
+   GLint zoffset = (GLint) _gldReplayS32(pReplay);
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CopyTexSubImage3D))
+      pReplay->Table.CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void _gldReplay_ActiveTextureARB(GLD_replay *pReplay)
+{
+   GLenum texture = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ActiveTextureARB))
+      pReplay->Table.ActiveTextureARB(texture);
+}
+
+static void _gldReplay_ClientActiveTextureARB(GLD_replay *pReplay)
+{
+   GLenum texture = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ClientActiveTextureARB))
+      pReplay->Table.ClientActiveTextureARB(texture);
+}
+
+static void _gldReplay_MultiTexCoord1dARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLdouble s = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord1dARB))
+      pReplay->Table.MultiTexCoord1dARB(target, s);
+}
+
+static void _gldReplay_MultiTexCoord1dvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord1dvARB))
+      pReplay->Table.MultiTexCoord1dvARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord1fARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLfloat s = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord1fARB))
+      pReplay->Table.MultiTexCoord1fARB(target, s);
+}
+
+static void _gldReplay_MultiTexCoord1fvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord1fvARB))
+      pReplay->Table.MultiTexCoord1fvARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord1iARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord1iARB))
+      pReplay->Table.MultiTexCoord1iARB(target, s);
+}
+
+static void _gldReplay_MultiTexCoord1ivARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord1ivARB))
+      pReplay->Table.MultiTexCoord1ivARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord1sARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLshort s = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord1sARB))
+      pReplay->Table.MultiTexCoord1sARB(target, s);
+}
+
+static void _gldReplay_MultiTexCoord1svARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord1svARB))
+      pReplay->Table.MultiTexCoord1svARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord2dARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLdouble s = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble t = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord2dARB))
+      pReplay->Table.MultiTexCoord2dARB(target, s, t);
+}
+
+static void _gldReplay_MultiTexCoord2dvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord2dvARB))
+      pReplay->Table.MultiTexCoord2dvARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord2fARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLfloat s = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat t = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord2fARB))
+      pReplay->Table.MultiTexCoord2fARB(target, s, t);
+}
+
+static void _gldReplay_MultiTexCoord2fvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord2fvARB))
+      pReplay->Table.MultiTexCoord2fvARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord2iARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   GLint t = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord2iARB))
+      pReplay->Table.MultiTexCoord2iARB(target, s, t);
+}
+
+static void _gldReplay_MultiTexCoord2ivARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord2ivARB))
+      pReplay->Table.MultiTexCoord2ivARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord2sARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLshort s = (GLshort) _gldReplayS32(pReplay);
+   GLshort t = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord2sARB))
+      pReplay->Table.MultiTexCoord2sARB(target, s, t);
+}
+
+static void _gldReplay_MultiTexCoord2svARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord2svARB))
+      pReplay->Table.MultiTexCoord2svARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord3dARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLdouble s = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble t = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble r = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord3dARB))
+      pReplay->Table.MultiTexCoord3dARB(target, s, t, r);
+}
+
+static void _gldReplay_MultiTexCoord3dvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord3dvARB))
+      pReplay->Table.MultiTexCoord3dvARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord3fARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLfloat s = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat t = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat r = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord3fARB))
+      pReplay->Table.MultiTexCoord3fARB(target, s, t, r);
+}
+
+static void _gldReplay_MultiTexCoord3fvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord3fvARB))
+      pReplay->Table.MultiTexCoord3fvARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord3iARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   GLint t = (GLint) _gldReplayS32(pReplay);
+   GLint r = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord3iARB))
+      pReplay->Table.MultiTexCoord3iARB(target, s, t, r);
+}
+
+static void _gldReplay_MultiTexCoord3ivARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord3ivARB))
+      pReplay->Table.MultiTexCoord3ivARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord3sARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLshort s = (GLshort) _gldReplayS32(pReplay);
+   GLshort t = (GLshort) _gldReplayS32(pReplay);
+   GLshort r = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord3sARB))
+      pReplay->Table.MultiTexCoord3sARB(target, s, t, r);
+}
+
+static void _gldReplay_MultiTexCoord3svARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord3svARB))
+      pReplay->Table.MultiTexCoord3svARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord4dARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLdouble s = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble t = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble r = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble q = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord4dARB))
+      pReplay->Table.MultiTexCoord4dARB(target, s, t, r, q);
+}
+
+static void _gldReplay_MultiTexCoord4dvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord4dvARB))
+      pReplay->Table.MultiTexCoord4dvARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord4fARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLfloat s = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat t = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat r = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat q = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord4fARB))
+      pReplay->Table.MultiTexCoord4fARB(target, s, t, r, q);
+}
+
+static void _gldReplay_MultiTexCoord4fvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord4fvARB))
+      pReplay->Table.MultiTexCoord4fvARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord4iARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint s = (GLint) _gldReplayS32(pReplay);
+   GLint t = (GLint) _gldReplayS32(pReplay);
+   GLint r = (GLint) _gldReplayS32(pReplay);
+   GLint q = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord4iARB))
+      pReplay->Table.MultiTexCoord4iARB(target, s, t, r, q);
+}
+
+static void _gldReplay_MultiTexCoord4ivARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord4ivARB))
+      pReplay->Table.MultiTexCoord4ivARB(target, v);
+}
+
+static void _gldReplay_MultiTexCoord4sARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLshort s = (GLshort) _gldReplayS32(pReplay);
+   GLshort t = (GLshort) _gldReplayS32(pReplay);
+   GLshort r = (GLshort) _gldReplayS32(pReplay);
+   GLshort q = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord4sARB))
+      pReplay->Table.MultiTexCoord4sARB(target, s, t, r, q);
+}
+
+static void _gldReplay_MultiTexCoord4svARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultiTexCoord4svARB))
+      pReplay->Table.MultiTexCoord4svARB(target, v);
+}
+
+static void _gldReplay_LoadTransposeMatrixfARB(GLD_replay *pReplay)
+{
+   const GLfloat * m = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LoadTransposeMatrixfARB))
+      pReplay->Table.LoadTransposeMatrixfARB(m);
+}
+
+static void _gldReplay_LoadTransposeMatrixdARB(GLD_replay *pReplay)
+{
+   const GLdouble * m = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LoadTransposeMatrixdARB))
+      pReplay->Table.LoadTransposeMatrixdARB(m);
+}
+
+static void _gldReplay_MultTransposeMatrixfARB(GLD_replay *pReplay)
+{
+   const GLfloat * m = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultTransposeMatrixfARB))
+      pReplay->Table.MultTransposeMatrixfARB(m);
+}
+
+static void _gldReplay_MultTransposeMatrixdARB(GLD_replay *pReplay)
+{
+   const GLdouble * m = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MultTransposeMatrixdARB))
+      pReplay->Table.MultTransposeMatrixdARB(m);
+}
+
+static void _gldReplay_SampleCoverageARB(GLD_replay *pReplay)
+{
+   GLclampf value = (GLclampf) _gldReplayF32(pReplay);
+   GLboolean invert = (GLboolean) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SampleCoverageARB))
+      pReplay->Table.SampleCoverageARB(value, invert);
+}
+
+static void _gldReplay___unused413(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, __unused413))
+      pReplay->Table.__unused413();
+}
+
+static void _gldReplay_PolygonOffsetEXT(GLD_replay *pReplay)
+{
+   GLfloat factor = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat bias = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PolygonOffsetEXT))
+      pReplay->Table.PolygonOffsetEXT(factor, bias);
+}
+
+static void _gldReplay_GetTexFilterFuncSGIS(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum filter = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * weights = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTexFilterFuncSGIS))
+      pReplay->Table.GetTexFilterFuncSGIS(target, filter, weights);
+}
+
+static void _gldReplay_TexFilterFuncSGIS(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum filter = (GLenum) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLfloat * weights = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexFilterFuncSGIS))
+      pReplay->Table.TexFilterFuncSGIS(target, filter, n, weights);
+}
+
+static void _gldReplay_GetHistogramEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLboolean reset = (GLboolean) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * values = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetHistogramEXT))
+      pReplay->Table.GetHistogramEXT(target, reset, format, type, values);
+}
+
+static void _gldReplay_GetHistogramParameterfvEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetHistogramParameterfvEXT))
+      pReplay->Table.GetHistogramParameterfvEXT(target, pname, params);
+}
+
+static void _gldReplay_GetHistogramParameterivEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetHistogramParameterivEXT))
+      pReplay->Table.GetHistogramParameterivEXT(target, pname, params);
+}
+
+static void _gldReplay_GetMinmaxEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLboolean reset = (GLboolean) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * values = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMinmaxEXT))
+      pReplay->Table.GetMinmaxEXT(target, reset, format, type, values);
+}
+
+static void _gldReplay_GetMinmaxParameterfvEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMinmaxParameterfvEXT))
+      pReplay->Table.GetMinmaxParameterfvEXT(target, pname, params);
+}
+
+static void _gldReplay_GetMinmaxParameterivEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetMinmaxParameterivEXT))
+      pReplay->Table.GetMinmaxParameterivEXT(target, pname, params);
+}
+
+static void _gldReplay_GetConvolutionFilterEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * image = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetConvolutionFilterEXT))
+      pReplay->Table.GetConvolutionFilterEXT(target, format, type, image);
+}
+
+static void _gldReplay_GetConvolutionParameterfvEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetConvolutionParameterfvEXT))
+      pReplay->Table.GetConvolutionParameterfvEXT(target, pname, params);
+}
+
+static void _gldReplay_GetConvolutionParameterivEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetConvolutionParameterivEXT))
+      pReplay->Table.GetConvolutionParameterivEXT(target, pname, params);
+}
+
+static void _gldReplay_GetSeparableFilterEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * row = (GLvoid *) _gldReplayPtr(pReplay);
+   GLvoid * column = (GLvoid *) _gldReplayPtr(pReplay);
+   GLvoid * span = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetSeparableFilterEXT))
+      pReplay->Table.GetSeparableFilterEXT(target, format, type, row, column, span);
+}
+
+static void _gldReplay_GetColorTableSGI(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * table = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTableSGI))
+      pReplay->Table.GetColorTableSGI(target, format, type, table);
+}
+
+static void _gldReplay_GetColorTableParameterfvSGI(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTableParameterfvSGI))
+      pReplay->Table.GetColorTableParameterfvSGI(target, pname, params);
+}
+
+static void _gldReplay_GetColorTableParameterivSGI(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTableParameterivSGI))
+      pReplay->Table.GetColorTableParameterivSGI(target, pname, params);
+}
+
+static void _gldReplay_PixelTexGenSGIX(GLD_replay *pReplay)
+{
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelTexGenSGIX))
+      pReplay->Table.PixelTexGenSGIX(mode);
+}
+
+static void _gldReplay_PixelTexGenParameteriSGIS(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelTexGenParameteriSGIS))
+      pReplay->Table.PixelTexGenParameteriSGIS(pname, param);
+}
+
+static void _gldReplay_PixelTexGenParameterivSGIS(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelTexGenParameterivSGIS))
+      pReplay->Table.PixelTexGenParameterivSGIS(pname, params);
+}
+
+static void _gldReplay_PixelTexGenParameterfSGIS(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelTexGenParameterfSGIS))
+      pReplay->Table.PixelTexGenParameterfSGIS(pname, param);
+}
+
+static void _gldReplay_PixelTexGenParameterfvSGIS(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PixelTexGenParameterfvSGIS))
+      pReplay->Table.PixelTexGenParameterfvSGIS(pname, params);
+}
+
+static void _gldReplay_GetPixelTexGenParameterivSGIS(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetPixelTexGenParameterivSGIS))
+      pReplay->Table.GetPixelTexGenParameterivSGIS(pname, params);
+}
+
+static void _gldReplay_GetPixelTexGenParameterfvSGIS(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetPixelTexGenParameterfvSGIS))
+      pReplay->Table.GetPixelTexGenParameterfvSGIS(pname, params);
+}
+
+static void _gldReplay_TexImage4DSGIS(GLD_replay *pReplay)
+{
+   pReplay->bSkip = GL_TRUE;
+}
+
+static void _gldReplay_TexSubImage4DSGIS(GLD_replay *pReplay)
+{
+   pReplay->bSkip = GL_TRUE;
+}
+
+static void _gldReplay_AreTexturesResidentEXT(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * textures = (const GLuint *) _gldReplayPtr(pReplay);
+   GLboolean * residences = (GLboolean *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, AreTexturesResidentEXT))
+      (void) pReplay->Table.AreTexturesResidentEXT(n, textures, residences);
+}
+
+static void _gldReplay_GenTexturesEXT(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   GLuint * textures = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GenTexturesEXT))
+      pReplay->Table.GenTexturesEXT(n, textures);
+}
+
+static void _gldReplay_IsTextureEXT(GLD_replay *pReplay)
+{
+   GLuint texture = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IsTextureEXT))
+      (void) pReplay->Table.IsTextureEXT(texture);
+}
+
+static void _gldReplay_DetailTexFuncSGIS(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLfloat * points = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DetailTexFuncSGIS))
+      pReplay->Table.DetailTexFuncSGIS(target, n, points);
+}
+
+static void _gldReplay_GetDetailTexFuncSGIS(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * points = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetDetailTexFuncSGIS))
+      pReplay->Table.GetDetailTexFuncSGIS(target, points);
+}
+
+static void _gldReplay_SharpenTexFuncSGIS(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLfloat * points = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SharpenTexFuncSGIS))
+      pReplay->Table.SharpenTexFuncSGIS(target, n, points);
+}
+
+static void _gldReplay_GetSharpenTexFuncSGIS(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * points = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetSharpenTexFuncSGIS))
+      pReplay->Table.GetSharpenTexFuncSGIS(target, points);
+}
+
+static void _gldReplay_SampleMaskSGIS(GLD_replay *pReplay)
+{
+   GLclampf value = (GLclampf) _gldReplayF32(pReplay);
+   GLboolean invert = (GLboolean) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SampleMaskSGIS))
+      pReplay->Table.SampleMaskSGIS(value, invert);
+}
+
+static void _gldReplay_SamplePatternSGIS(GLD_replay *pReplay)
+{
+   GLenum pattern = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SamplePatternSGIS))
+      pReplay->Table.SamplePatternSGIS(pattern);
+}
+
+static void _gldReplay_ColorPointerEXT(GLD_replay *pReplay)
+{
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ColorPointerEXT))
+      pReplay->Table.ColorPointerEXT(size, type, stride, count, pointer);
+}
+
+static void _gldReplay_EdgeFlagPointerEXT(GLD_replay *pReplay)
+{
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   const GLboolean * pointer = (const GLboolean *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EdgeFlagPointerEXT))
+      pReplay->Table.EdgeFlagPointerEXT(stride, count, pointer);
+}
+
+static void _gldReplay_IndexPointerEXT(GLD_replay *pReplay)
+{
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IndexPointerEXT))
+      pReplay->Table.IndexPointerEXT(type, stride, count, pointer);
+}
+
+static void _gldReplay_NormalPointerEXT(GLD_replay *pReplay)
+{
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, NormalPointerEXT))
+      pReplay->Table.NormalPointerEXT(type, stride, count, pointer);
+}
+
+static void _gldReplay_TexCoordPointerEXT(GLD_replay *pReplay)
+{
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TexCoordPointerEXT))
+      pReplay->Table.TexCoordPointerEXT(size, type, stride, count, pointer);
+}
+
+static void _gldReplay_VertexPointerEXT(GLD_replay *pReplay)
+{
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexPointerEXT))
+      pReplay->Table.VertexPointerEXT(size, type, stride, count, pointer);
+}
+
+static void _gldReplay_SpriteParameterfSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SpriteParameterfSGIX))
+      pReplay->Table.SpriteParameterfSGIX(pname, param);
+}
+
+static void _gldReplay_SpriteParameterfvSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SpriteParameterfvSGIX))
+      pReplay->Table.SpriteParameterfvSGIX(pname, params);
+}
+
+static void _gldReplay_SpriteParameteriSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SpriteParameteriSGIX))
+      pReplay->Table.SpriteParameteriSGIX(pname, param);
+}
+
+static void _gldReplay_SpriteParameterivSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SpriteParameterivSGIX))
+      pReplay->Table.SpriteParameterivSGIX(pname, params);
+}
+
+static void _gldReplay_PointParameterfEXT(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PointParameterfEXT))
+      pReplay->Table.PointParameterfEXT(pname, param);
+}
+
+static void _gldReplay_PointParameterfvEXT(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PointParameterfvEXT))
+      pReplay->Table.PointParameterfvEXT(pname, params);
+}
+
+static void _gldReplay_GetInstrumentsSGIX(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, GetInstrumentsSGIX))
+      (void) pReplay->Table.GetInstrumentsSGIX();
+}
+
+static void _gldReplay_InstrumentsBufferSGIX(GLD_replay *pReplay)
+{
+   GLsizei size = (GLsizei) _gldReplayS32(pReplay);
+   GLint * buffer = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, InstrumentsBufferSGIX))
+      pReplay->Table.InstrumentsBufferSGIX(size, buffer);
+}
+
+static void _gldReplay_PollInstrumentsSGIX(GLD_replay *pReplay)
+{
+   GLint * marker_p = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PollInstrumentsSGIX))
+      (void) pReplay->Table.PollInstrumentsSGIX(marker_p);
+}
+
+static void _gldReplay_ReadInstrumentsSGIX(GLD_replay *pReplay)
+{
+   GLint marker = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ReadInstrumentsSGIX))
+      pReplay->Table.ReadInstrumentsSGIX(marker);
+}
+
+static void _gldReplay_StartInstrumentsSGIX(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, StartInstrumentsSGIX))
+      pReplay->Table.StartInstrumentsSGIX();
+}
+
+static void _gldReplay_StopInstrumentsSGIX(GLD_replay *pReplay)
+{
+   GLint marker = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, StopInstrumentsSGIX))
+      pReplay->Table.StopInstrumentsSGIX(marker);
+}
+
+static void _gldReplay_FrameZoomSGIX(GLD_replay *pReplay)
+{
+   GLint factor = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FrameZoomSGIX))
+      pReplay->Table.FrameZoomSGIX(factor);
+}
+
+static void _gldReplay_TagSampleBufferSGIX(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, TagSampleBufferSGIX))
+      pReplay->Table.TagSampleBufferSGIX();
+}
+
+static void _gldReplay_ReferencePlaneSGIX(GLD_replay *pReplay)
+{
+   const GLdouble * equation = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ReferencePlaneSGIX))
+      pReplay->Table.ReferencePlaneSGIX(equation);
+}
+
+static void _gldReplay_FlushRasterSGIX(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, FlushRasterSGIX))
+      pReplay->Table.FlushRasterSGIX();
+}
+
+static void _gldReplay_GetListParameterfvSGIX(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetListParameterfvSGIX))
+      pReplay->Table.GetListParameterfvSGIX(list, pname, params);
+}
+
+static void _gldReplay_GetListParameterivSGIX(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetListParameterivSGIX))
+      pReplay->Table.GetListParameterivSGIX(list, pname, params);
+}
+
+static void _gldReplay_ListParameterfSGIX(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ListParameterfSGIX))
+      pReplay->Table.ListParameterfSGIX(list, pname, param);
+}
+
+static void _gldReplay_ListParameterfvSGIX(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ListParameterfvSGIX))
+      pReplay->Table.ListParameterfvSGIX(list, pname, params);
+}
+
+static void _gldReplay_ListParameteriSGIX(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ListParameteriSGIX))
+      pReplay->Table.ListParameteriSGIX(list, pname, param);
+}
+
+static void _gldReplay_ListParameterivSGIX(GLD_replay *pReplay)
+{
+   GLuint list = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ListParameterivSGIX))
+      pReplay->Table.ListParameterivSGIX(list, pname, params);
+}
+
+static void _gldReplay_FragmentColorMaterialSGIX(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentColorMaterialSGIX))
+      pReplay->Table.FragmentColorMaterialSGIX(face, mode);
+}
+
+static void _gldReplay_FragmentLightfSGIX(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentLightfSGIX))
+      pReplay->Table.FragmentLightfSGIX(light, pname, param);
+}
+
+static void _gldReplay_FragmentLightfvSGIX(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentLightfvSGIX))
+      pReplay->Table.FragmentLightfvSGIX(light, pname, params);
+}
+
+static void _gldReplay_FragmentLightiSGIX(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentLightiSGIX))
+      pReplay->Table.FragmentLightiSGIX(light, pname, param);
+}
+
+static void _gldReplay_FragmentLightivSGIX(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentLightivSGIX))
+      pReplay->Table.FragmentLightivSGIX(light, pname, params);
+}
+
+static void _gldReplay_FragmentLightModelfSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentLightModelfSGIX))
+      pReplay->Table.FragmentLightModelfSGIX(pname, param);
+}
+
+static void _gldReplay_FragmentLightModelfvSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentLightModelfvSGIX))
+      pReplay->Table.FragmentLightModelfvSGIX(pname, params);
+}
+
+static void _gldReplay_FragmentLightModeliSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentLightModeliSGIX))
+      pReplay->Table.FragmentLightModeliSGIX(pname, param);
+}
+
+static void _gldReplay_FragmentLightModelivSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentLightModelivSGIX))
+      pReplay->Table.FragmentLightModelivSGIX(pname, params);
+}
+
+static void _gldReplay_FragmentMaterialfSGIX(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentMaterialfSGIX))
+      pReplay->Table.FragmentMaterialfSGIX(face, pname, param);
+}
+
+static void _gldReplay_FragmentMaterialfvSGIX(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentMaterialfvSGIX))
+      pReplay->Table.FragmentMaterialfvSGIX(face, pname, params);
+}
+
+static void _gldReplay_FragmentMaterialiSGIX(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentMaterialiSGIX))
+      pReplay->Table.FragmentMaterialiSGIX(face, pname, param);
+}
+
+static void _gldReplay_FragmentMaterialivSGIX(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FragmentMaterialivSGIX))
+      pReplay->Table.FragmentMaterialivSGIX(face, pname, params);
+}
+
+static void _gldReplay_GetFragmentLightfvSGIX(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetFragmentLightfvSGIX))
+      pReplay->Table.GetFragmentLightfvSGIX(light, pname, params);
+}
+
+static void _gldReplay_GetFragmentLightivSGIX(GLD_replay *pReplay)
+{
+   GLenum light = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetFragmentLightivSGIX))
+      pReplay->Table.GetFragmentLightivSGIX(light, pname, params);
+}
+
+static void _gldReplay_GetFragmentMaterialfvSGIX(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetFragmentMaterialfvSGIX))
+      pReplay->Table.GetFragmentMaterialfvSGIX(face, pname, params);
+}
+
+static void _gldReplay_GetFragmentMaterialivSGIX(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetFragmentMaterialivSGIX))
+      pReplay->Table.GetFragmentMaterialivSGIX(face, pname, params);
+}
+
+static void _gldReplay_LightEnviSGIX(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LightEnviSGIX))
+      pReplay->Table.LightEnviSGIX(pname, param);
+}
+
+static void _gldReplay_VertexWeightfEXT(GLD_replay *pReplay)
+{
+   GLfloat weight = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexWeightfEXT))
+      pReplay->Table.VertexWeightfEXT(weight);
+}
+
+static void _gldReplay_VertexWeightfvEXT(GLD_replay *pReplay)
+{
+   const GLfloat * weight = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexWeightfvEXT))
+      pReplay->Table.VertexWeightfvEXT(weight);
+}
+
+static void _gldReplay_VertexWeightPointerEXT(GLD_replay *pReplay)
+{
+   GLsizei size = (GLsizei) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexWeightPointerEXT))
+      pReplay->Table.VertexWeightPointerEXT(size, type, stride, pointer);
+}
+
+static void _gldReplay_FlushVertexArrayRangeNV(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, FlushVertexArrayRangeNV))
+      pReplay->Table.FlushVertexArrayRangeNV();
+}
+
+static void _gldReplay_VertexArrayRangeNV(GLD_replay *pReplay)
+{
+   pReplay->bSkip = GL_TRUE;
+}
+
+static void _gldReplay_CombinerParameterfvNV(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CombinerParameterfvNV))
+      pReplay->Table.CombinerParameterfvNV(pname, params);
+}
+
+static void _gldReplay_CombinerParameterfNV(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat param = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CombinerParameterfNV))
+      pReplay->Table.CombinerParameterfNV(pname, param);
+}
+
+static void _gldReplay_CombinerParameterivNV(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CombinerParameterivNV))
+      pReplay->Table.CombinerParameterivNV(pname, params);
+}
+
+static void _gldReplay_CombinerParameteriNV(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint param = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CombinerParameteriNV))
+      pReplay->Table.CombinerParameteriNV(pname, param);
+}
+
+static void _gldReplay_CombinerInputNV(GLD_replay *pReplay)
+{
+   GLenum stage = (GLenum) _gldReplayU32(pReplay);
+   GLenum portion = (GLenum) _gldReplayU32(pReplay);
+   GLenum variable = (GLenum) _gldReplayU32(pReplay);
+   GLenum input = (GLenum) _gldReplayU32(pReplay);
+   GLenum mapping = (GLenum) _gldReplayU32(pReplay);
+   GLenum componentUsage = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CombinerInputNV))
+      pReplay->Table.CombinerInputNV(stage, portion, variable, input, mapping, componentUsage);
+}
+
+static void _gldReplay_CombinerOutputNV(GLD_replay *pReplay)
+{
+   GLenum stage = (GLenum) _gldReplayU32(pReplay);
+   GLenum portion = (GLenum) _gldReplayU32(pReplay);
+   GLenum abOutput = (GLenum) _gldReplayU32(pReplay);
+   GLenum cdOutput = (GLenum) _gldReplayU32(pReplay);
+   GLenum sumOutput = (GLenum) _gldReplayU32(pReplay);
+   GLenum scale = (GLenum) _gldReplayU32(pReplay);
+   GLenum bias = (GLenum) _gldReplayU32(pReplay);
+   GLboolean abDotProduct = (GLboolean) _gldReplayU32(pReplay);
+   GLboolean cdDotProduct = (GLboolean) _gldReplayU32(pReplay);
+   GLboolean muxSum = (GLboolean) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CombinerOutputNV))
+      pReplay->Table.CombinerOutputNV(stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum);
+}
+
+static void _gldReplay_FinalCombinerInputNV(GLD_replay *pReplay)
+{
+   GLenum variable = (GLenum) _gldReplayU32(pReplay);
+   GLenum input = (GLenum) _gldReplayU32(pReplay);
+   GLenum mapping = (GLenum) _gldReplayU32(pReplay);
+   GLenum componentUsage = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FinalCombinerInputNV))
+      pReplay->Table.FinalCombinerInputNV(variable, input, mapping, componentUsage);
+}
+
+static void _gldReplay_GetCombinerInputParameterfvNV(GLD_replay *pReplay)
+{
+   GLenum stage = (GLenum) _gldReplayU32(pReplay);
+   GLenum portion = (GLenum) _gldReplayU32(pReplay);
+   GLenum variable = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetCombinerInputParameterfvNV))
+      pReplay->Table.GetCombinerInputParameterfvNV(stage, portion, variable, pname, params);
+}
+
+static void _gldReplay_GetCombinerInputParameterivNV(GLD_replay *pReplay)
+{
+   GLenum stage = (GLenum) _gldReplayU32(pReplay);
+   GLenum portion = (GLenum) _gldReplayU32(pReplay);
+   GLenum variable = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetCombinerInputParameterivNV))
+      pReplay->Table.GetCombinerInputParameterivNV(stage, portion, variable, pname, params);
+}
+
+static void _gldReplay_GetCombinerOutputParameterfvNV(GLD_replay *pReplay)
+{
+   GLenum stage = (GLenum) _gldReplayU32(pReplay);
+   GLenum portion = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetCombinerOutputParameterfvNV))
+      pReplay->Table.GetCombinerOutputParameterfvNV(stage, portion, pname, params);
+}
+
+static void _gldReplay_GetCombinerOutputParameterivNV(GLD_replay *pReplay)
+{
+   GLenum stage = (GLenum) _gldReplayU32(pReplay);
+   GLenum portion = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetCombinerOutputParameterivNV))
+      pReplay->Table.GetCombinerOutputParameterivNV(stage, portion, pname, params);
+}
+
+static void _gldReplay_GetFinalCombinerInputParameterfvNV(GLD_replay *pReplay)
+{
+   GLenum variable = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetFinalCombinerInputParameterfvNV))
+      pReplay->Table.GetFinalCombinerInputParameterfvNV(variable, pname, params);
+}
+
+static void _gldReplay_GetFinalCombinerInputParameterivNV(GLD_replay *pReplay)
+{
+   GLenum variable = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetFinalCombinerInputParameterivNV))
+      pReplay->Table.GetFinalCombinerInputParameterivNV(variable, pname, params);
+}
+
+static void _gldReplay_ResizeBuffersMESA(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, ResizeBuffersMESA))
+      pReplay->Table.ResizeBuffersMESA();
+}
+
+static void _gldReplay_WindowPos2dMESA(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos2dMESA))
+      pReplay->Table.WindowPos2dMESA(x, y);
+}
+
+static void _gldReplay_WindowPos2dvMESA(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos2dvMESA))
+      pReplay->Table.WindowPos2dvMESA(v);
+}
+
+static void _gldReplay_WindowPos2fMESA(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos2fMESA))
+      pReplay->Table.WindowPos2fMESA(x, y);
+}
+
+static void _gldReplay_WindowPos2fvMESA(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos2fvMESA))
+      pReplay->Table.WindowPos2fvMESA(v);
+}
+
+static void _gldReplay_WindowPos2iMESA(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos2iMESA))
+      pReplay->Table.WindowPos2iMESA(x, y);
+}
+
+static void _gldReplay_WindowPos2ivMESA(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos2ivMESA))
+      pReplay->Table.WindowPos2ivMESA(v);
+}
+
+static void _gldReplay_WindowPos2sMESA(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos2sMESA))
+      pReplay->Table.WindowPos2sMESA(x, y);
+}
+
+static void _gldReplay_WindowPos2svMESA(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos2svMESA))
+      pReplay->Table.WindowPos2svMESA(v);
+}
+
+static void _gldReplay_WindowPos3dMESA(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos3dMESA))
+      pReplay->Table.WindowPos3dMESA(x, y, z);
+}
+
+static void _gldReplay_WindowPos3dvMESA(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos3dvMESA))
+      pReplay->Table.WindowPos3dvMESA(v);
+}
+
+static void _gldReplay_WindowPos3fMESA(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos3fMESA))
+      pReplay->Table.WindowPos3fMESA(x, y, z);
+}
+
+static void _gldReplay_WindowPos3fvMESA(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos3fvMESA))
+      pReplay->Table.WindowPos3fvMESA(v);
+}
+
+static void _gldReplay_WindowPos3iMESA(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLint z = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos3iMESA))
+      pReplay->Table.WindowPos3iMESA(x, y, z);
+}
+
+static void _gldReplay_WindowPos3ivMESA(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos3ivMESA))
+      pReplay->Table.WindowPos3ivMESA(v);
+}
+
+static void _gldReplay_WindowPos3sMESA(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   GLshort z = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos3sMESA))
+      pReplay->Table.WindowPos3sMESA(x, y, z);
+}
+
+static void _gldReplay_WindowPos3svMESA(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos3svMESA))
+      pReplay->Table.WindowPos3svMESA(v);
+}
+
+static void _gldReplay_WindowPos4dMESA(GLD_replay *pReplay)
+{
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble w = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos4dMESA))
+      pReplay->Table.WindowPos4dMESA(x, y, z, w);
+}
+
+static void _gldReplay_WindowPos4dvMESA(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos4dvMESA))
+      pReplay->Table.WindowPos4dvMESA(v);
+}
+
+static void _gldReplay_WindowPos4fMESA(GLD_replay *pReplay)
+{
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat w = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos4fMESA))
+      pReplay->Table.WindowPos4fMESA(x, y, z, w);
+}
+
+static void _gldReplay_WindowPos4fvMESA(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos4fvMESA))
+      pReplay->Table.WindowPos4fvMESA(v);
+}
+
+static void _gldReplay_WindowPos4iMESA(GLD_replay *pReplay)
+{
+   GLint x = (GLint) _gldReplayS32(pReplay);
+   GLint y = (GLint) _gldReplayS32(pReplay);
+   GLint z = (GLint) _gldReplayS32(pReplay);
+   GLint w = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos4iMESA))
+      pReplay->Table.WindowPos4iMESA(x, y, z, w);
+}
+
+static void _gldReplay_WindowPos4ivMESA(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos4ivMESA))
+      pReplay->Table.WindowPos4ivMESA(v);
+}
+
+static void _gldReplay_WindowPos4sMESA(GLD_replay *pReplay)
+{
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   GLshort z = (GLshort) _gldReplayS32(pReplay);
+   GLshort w = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos4sMESA))
+      pReplay->Table.WindowPos4sMESA(x, y, z, w);
+}
+
+static void _gldReplay_WindowPos4svMESA(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, WindowPos4svMESA))
+      pReplay->Table.WindowPos4svMESA(v);
+}
+
+static void _gldReplay_BlendFuncSeparateEXT(GLD_replay *pReplay)
+{
+   GLenum sfactorRGB = (GLenum) _gldReplayU32(pReplay);
+   GLenum dfactorRGB = (GLenum) _gldReplayU32(pReplay);
+   GLenum sfactorAlpha = (GLenum) _gldReplayU32(pReplay);
+   GLenum dfactorAlpha = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BlendFuncSeparateEXT))
+      pReplay->Table.BlendFuncSeparateEXT(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void _gldReplay_IndexMaterialEXT(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   GLenum mode = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IndexMaterialEXT))
+      pReplay->Table.IndexMaterialEXT(face, mode);
+}
+
+static void _gldReplay_IndexFuncEXT(GLD_replay *pReplay)
+{
+   GLenum func = (GLenum) _gldReplayU32(pReplay);
+   GLclampf ref = (GLclampf) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IndexFuncEXT))
+      pReplay->Table.IndexFuncEXT(func, ref);
+}
+
+static void _gldReplay_LockArraysEXT(GLD_replay *pReplay)
+{
+   GLint first = (GLint) _gldReplayS32(pReplay);
+   GLsizei count = (GLsizei) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LockArraysEXT))
+      pReplay->Table.LockArraysEXT(first, count);
+}
+
+static void _gldReplay_UnlockArraysEXT(GLD_replay *pReplay)
+{
+   if (_GLD_REPLAY_OK(pReplay, UnlockArraysEXT))
+      pReplay->Table.UnlockArraysEXT();
+}
+
+static void _gldReplay_CullParameterdvEXT(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLdouble * params = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CullParameterdvEXT))
+      pReplay->Table.CullParameterdvEXT(pname, params);
+}
+
+static void _gldReplay_CullParameterfvEXT(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CullParameterfvEXT))
+      pReplay->Table.CullParameterfvEXT(pname, params);
+}
+
+static void _gldReplay_HintPGI(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint mode = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, HintPGI))
+      pReplay->Table.HintPGI(target, mode);
+}
+
+static void _gldReplay_FogCoordfEXT(GLD_replay *pReplay)
+{
+   GLfloat coord = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FogCoordfEXT))
+      pReplay->Table.FogCoordfEXT(coord);
+}
+
+static void _gldReplay_FogCoordfvEXT(GLD_replay *pReplay)
+{
+   const GLfloat * coord = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FogCoordfvEXT))
+      pReplay->Table.FogCoordfvEXT(coord);
+}
+
+static void _gldReplay_FogCoorddEXT(GLD_replay *pReplay)
+{
+   GLdouble coord = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FogCoorddEXT))
+      pReplay->Table.FogCoorddEXT(coord);
+}
+
+static void _gldReplay_FogCoorddvEXT(GLD_replay *pReplay)
+{
+   const GLdouble * coord = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FogCoorddvEXT))
+      pReplay->Table.FogCoorddvEXT(coord);
+}
+
+static void _gldReplay_FogCoordPointerEXT(GLD_replay *pReplay)
+{
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FogCoordPointerEXT))
+      pReplay->Table.FogCoordPointerEXT(type, stride, pointer);
+}
+
+static void _gldReplay_GetColorTableEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * data = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTableEXT))
+      pReplay->Table.GetColorTableEXT(target, format, type, data);
+}
+
+static void _gldReplay_GetColorTableParameterivEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTableParameterivEXT))
+      pReplay->Table.GetColorTableParameterivEXT(target, pname, params);
+}
+
+static void _gldReplay_GetColorTableParameterfvEXT(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetColorTableParameterfvEXT))
+      pReplay->Table.GetColorTableParameterfvEXT(target, pname, params);
+}
+
+static void _gldReplay_TbufferMask3DFX(GLD_replay *pReplay)
+{
+   GLuint mask = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TbufferMask3DFX))
+      pReplay->Table.TbufferMask3DFX(mask);
+}
+
+static void _gldReplay_CompressedTexImage3DARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei depth = (GLsizei) _gldReplayS32(pReplay);
+   GLint border = (GLint) _gldReplayS32(pReplay);
+   GLsizei imageSize = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CompressedTexImage3DARB))
+      pReplay->Table.CompressedTexImage3DARB(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void _gldReplay_CompressedTexImage2DARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLint border = (GLint) _gldReplayS32(pReplay);
+   GLsizei imageSize = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CompressedTexImage2DARB))
+      pReplay->Table.CompressedTexImage2DARB(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void _gldReplay_CompressedTexImage1DARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLenum internalformat = (GLenum) _gldReplayU32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLint border = (GLint) _gldReplayS32(pReplay);
+   GLsizei imageSize = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CompressedTexImage1DARB))
+      pReplay->Table.CompressedTexImage1DARB(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void _gldReplay_CompressedTexSubImage3DARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLint yoffset = (GLint) _gldReplayS32(pReplay);
+   GLint zoffset = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei depth = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLsizei imageSize = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CompressedTexSubImage3DARB))
+      pReplay->Table.CompressedTexSubImage3DARB(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void _gldReplay_CompressedTexSubImage2DARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLint yoffset = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLsizei height = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLsizei imageSize = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CompressedTexSubImage2DARB))
+      pReplay->Table.CompressedTexSubImage2DARB(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void _gldReplay_CompressedTexSubImage1DARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLint xoffset = (GLint) _gldReplayS32(pReplay);
+   GLsizei width = (GLsizei) _gldReplayS32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLsizei imageSize = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, CompressedTexSubImage1DARB))
+      pReplay->Table.CompressedTexSubImage1DARB(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void _gldReplay_GetCompressedTexImageARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLint level = (GLint) _gldReplayS32(pReplay);
+   GLvoid * img = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetCompressedTexImageARB))
+      pReplay->Table.GetCompressedTexImageARB(target, level, img);
+}
+
+static void _gldReplay_SecondaryColor3bEXT(GLD_replay *pReplay)
+{
+   GLbyte red = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte green = (GLbyte) _gldReplayS32(pReplay);
+   GLbyte blue = (GLbyte) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3bEXT))
+      pReplay->Table.SecondaryColor3bEXT(red, green, blue);
+}
+
+static void _gldReplay_SecondaryColor3bvEXT(GLD_replay *pReplay)
+{
+   const GLbyte * v = (const GLbyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3bvEXT))
+      pReplay->Table.SecondaryColor3bvEXT(v);
+}
+
+static void _gldReplay_SecondaryColor3dEXT(GLD_replay *pReplay)
+{
+   GLdouble red = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble green = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble blue = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3dEXT))
+      pReplay->Table.SecondaryColor3dEXT(red, green, blue);
+}
+
+static void _gldReplay_SecondaryColor3dvEXT(GLD_replay *pReplay)
+{
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3dvEXT))
+      pReplay->Table.SecondaryColor3dvEXT(v);
+}
+
+static void _gldReplay_SecondaryColor3fEXT(GLD_replay *pReplay)
+{
+   GLfloat red = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat green = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat blue = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3fEXT))
+      pReplay->Table.SecondaryColor3fEXT(red, green, blue);
+}
+
+static void _gldReplay_SecondaryColor3fvEXT(GLD_replay *pReplay)
+{
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3fvEXT))
+      pReplay->Table.SecondaryColor3fvEXT(v);
+}
+
+static void _gldReplay_SecondaryColor3iEXT(GLD_replay *pReplay)
+{
+   GLint red = (GLint) _gldReplayS32(pReplay);
+   GLint green = (GLint) _gldReplayS32(pReplay);
+   GLint blue = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3iEXT))
+      pReplay->Table.SecondaryColor3iEXT(red, green, blue);
+}
+
+static void _gldReplay_SecondaryColor3ivEXT(GLD_replay *pReplay)
+{
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3ivEXT))
+      pReplay->Table.SecondaryColor3ivEXT(v);
+}
+
+static void _gldReplay_SecondaryColor3sEXT(GLD_replay *pReplay)
+{
+   GLshort red = (GLshort) _gldReplayS32(pReplay);
+   GLshort green = (GLshort) _gldReplayS32(pReplay);
+   GLshort blue = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3sEXT))
+      pReplay->Table.SecondaryColor3sEXT(red, green, blue);
+}
+
+static void _gldReplay_SecondaryColor3svEXT(GLD_replay *pReplay)
+{
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3svEXT))
+      pReplay->Table.SecondaryColor3svEXT(v);
+}
+
+static void _gldReplay_SecondaryColor3ubEXT(GLD_replay *pReplay)
+{
+   GLubyte red = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte green = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte blue = (GLubyte) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3ubEXT))
+      pReplay->Table.SecondaryColor3ubEXT(red, green, blue);
+}
+
+static void _gldReplay_SecondaryColor3ubvEXT(GLD_replay *pReplay)
+{
+   const GLubyte * v = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3ubvEXT))
+      pReplay->Table.SecondaryColor3ubvEXT(v);
+}
+
+static void _gldReplay_SecondaryColor3uiEXT(GLD_replay *pReplay)
+{
+   GLuint red = (GLuint) _gldReplayU32(pReplay);
+   GLuint green = (GLuint) _gldReplayU32(pReplay);
+   GLuint blue = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3uiEXT))
+      pReplay->Table.SecondaryColor3uiEXT(red, green, blue);
+}
+
+static void _gldReplay_SecondaryColor3uivEXT(GLD_replay *pReplay)
+{
+   const GLuint * v = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3uivEXT))
+      pReplay->Table.SecondaryColor3uivEXT(v);
+}
+
+static void _gldReplay_SecondaryColor3usEXT(GLD_replay *pReplay)
+{
+   GLushort red = (GLushort) _gldReplayU32(pReplay);
+   GLushort green = (GLushort) _gldReplayU32(pReplay);
+   GLushort blue = (GLushort) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3usEXT))
+      pReplay->Table.SecondaryColor3usEXT(red, green, blue);
+}
+
+static void _gldReplay_SecondaryColor3usvEXT(GLD_replay *pReplay)
+{
+   const GLushort * v = (const GLushort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColor3usvEXT))
+      pReplay->Table.SecondaryColor3usvEXT(v);
+}
+
+static void _gldReplay_SecondaryColorPointerEXT(GLD_replay *pReplay)
+{
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SecondaryColorPointerEXT))
+      pReplay->Table.SecondaryColorPointerEXT(size, type, stride, pointer);
+}
+
+static void _gldReplay_AreProgramsResidentNV(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * ids = (const GLuint *) _gldReplayPtr(pReplay);
+   GLboolean * residences = (GLboolean *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, AreProgramsResidentNV))
+      (void) pReplay->Table.AreProgramsResidentNV(n, ids, residences);
+}
+
+static void _gldReplay_BindProgramNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BindProgramNV))
+      pReplay->Table.BindProgramNV(target, id);
+}
+
+static void _gldReplay_DeleteProgramsNV(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * ids = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DeleteProgramsNV))
+      pReplay->Table.DeleteProgramsNV(n, ids);
+}
+
+static void _gldReplay_ExecuteProgramNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ExecuteProgramNV))
+      pReplay->Table.ExecuteProgramNV(target, id, params);
+}
+
+static void _gldReplay_GenProgramsNV(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   GLuint * ids = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GenProgramsNV))
+      pReplay->Table.GenProgramsNV(n, ids);
+}
+
+static void _gldReplay_GetProgramParameterdvNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLdouble * params = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramParameterdvNV))
+      pReplay->Table.GetProgramParameterdvNV(target, index, pname, params);
+}
+
+static void _gldReplay_GetProgramParameterfvNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramParameterfvNV))
+      pReplay->Table.GetProgramParameterfvNV(target, index, pname, params);
+}
+
+static void _gldReplay_GetProgramivNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramivNV))
+      pReplay->Table.GetProgramivNV(id, pname, params);
+}
+
+static void _gldReplay_GetProgramStringNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLubyte * program = (GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramStringNV))
+      pReplay->Table.GetProgramStringNV(id, pname, program);
+}
+
+static void _gldReplay_GetTrackMatrixivNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint address = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetTrackMatrixivNV))
+      pReplay->Table.GetTrackMatrixivNV(target, address, pname, params);
+}
+
+static void _gldReplay_GetVertexAttribdvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLdouble * params = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetVertexAttribdvNV))
+      pReplay->Table.GetVertexAttribdvNV(index, pname, params);
+}
+
+static void _gldReplay_GetVertexAttribfvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetVertexAttribfvNV))
+      pReplay->Table.GetVertexAttribfvNV(index, pname, params);
+}
+
+static void _gldReplay_GetVertexAttribivNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetVertexAttribivNV))
+      pReplay->Table.GetVertexAttribivNV(index, pname, params);
+}
+
+static void _gldReplay_GetVertexAttribPointervNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLvoid ** pointer = (GLvoid **) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetVertexAttribPointervNV))
+      pReplay->Table.GetVertexAttribPointervNV(index, pname, pointer);
+}
+
+static void _gldReplay_IsProgramNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IsProgramNV))
+      (void) pReplay->Table.IsProgramNV(id);
+}
+
+static void _gldReplay_LoadProgramNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLsizei len = (GLsizei) _gldReplayS32(pReplay);
+   const GLubyte * program = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, LoadProgramNV))
+      pReplay->Table.LoadProgramNV(target, id, len, program);
+}
+
+static void _gldReplay_ProgramParameter4dNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble w = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramParameter4dNV))
+      pReplay->Table.ProgramParameter4dNV(target, index, x, y, z, w);
+}
+
+static void _gldReplay_ProgramParameter4dvNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLdouble * params = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramParameter4dvNV))
+      pReplay->Table.ProgramParameter4dvNV(target, index, params);
+}
+
+static void _gldReplay_ProgramParameter4fNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat w = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramParameter4fNV))
+      pReplay->Table.ProgramParameter4fNV(target, index, x, y, z, w);
+}
+
+static void _gldReplay_ProgramParameter4fvNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramParameter4fvNV))
+      pReplay->Table.ProgramParameter4fvNV(target, index, params);
+}
+
+static void _gldReplay_ProgramParameters4dvNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLuint num = (GLuint) _gldReplayU32(pReplay);
+   const GLdouble * params = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramParameters4dvNV))
+      pReplay->Table.ProgramParameters4dvNV(target, index, num, params);
+}
+
+static void _gldReplay_ProgramParameters4fvNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLuint num = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramParameters4fvNV))
+      pReplay->Table.ProgramParameters4fvNV(target, index, num, params);
+}
+
+static void _gldReplay_RequestResidentProgramsNV(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * ids = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, RequestResidentProgramsNV))
+      pReplay->Table.RequestResidentProgramsNV(n, ids);
+}
+
+static void _gldReplay_TrackMatrixNV(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint address = (GLuint) _gldReplayU32(pReplay);
+   GLenum matrix = (GLenum) _gldReplayU32(pReplay);
+   GLenum transform = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TrackMatrixNV))
+      pReplay->Table.TrackMatrixNV(target, address, matrix, transform);
+}
+
+static void _gldReplay_VertexAttribPointerNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribPointerNV))
+      pReplay->Table.VertexAttribPointerNV(index, size, type, stride, pointer);
+}
+
+static void _gldReplay_VertexAttrib1dNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib1dNV))
+      pReplay->Table.VertexAttrib1dNV(index, x);
+}
+
+static void _gldReplay_VertexAttrib1dvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib1dvNV))
+      pReplay->Table.VertexAttrib1dvNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib1fNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib1fNV))
+      pReplay->Table.VertexAttrib1fNV(index, x);
+}
+
+static void _gldReplay_VertexAttrib1fvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib1fvNV))
+      pReplay->Table.VertexAttrib1fvNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib1sNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib1sNV))
+      pReplay->Table.VertexAttrib1sNV(index, x);
+}
+
+static void _gldReplay_VertexAttrib1svNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib1svNV))
+      pReplay->Table.VertexAttrib1svNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib2dNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib2dNV))
+      pReplay->Table.VertexAttrib2dNV(index, x, y);
+}
+
+static void _gldReplay_VertexAttrib2dvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib2dvNV))
+      pReplay->Table.VertexAttrib2dvNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib2fNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib2fNV))
+      pReplay->Table.VertexAttrib2fNV(index, x, y);
+}
+
+static void _gldReplay_VertexAttrib2fvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib2fvNV))
+      pReplay->Table.VertexAttrib2fvNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib2sNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib2sNV))
+      pReplay->Table.VertexAttrib2sNV(index, x, y);
+}
+
+static void _gldReplay_VertexAttrib2svNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib2svNV))
+      pReplay->Table.VertexAttrib2svNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib3dNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib3dNV))
+      pReplay->Table.VertexAttrib3dNV(index, x, y, z);
+}
+
+static void _gldReplay_VertexAttrib3dvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib3dvNV))
+      pReplay->Table.VertexAttrib3dvNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib3fNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib3fNV))
+      pReplay->Table.VertexAttrib3fNV(index, x, y, z);
+}
+
+static void _gldReplay_VertexAttrib3fvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib3fvNV))
+      pReplay->Table.VertexAttrib3fvNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib3sNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   GLshort z = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib3sNV))
+      pReplay->Table.VertexAttrib3sNV(index, x, y, z);
+}
+
+static void _gldReplay_VertexAttrib3svNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib3svNV))
+      pReplay->Table.VertexAttrib3svNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib4dNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble w = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4dNV))
+      pReplay->Table.VertexAttrib4dNV(index, x, y, z, w);
+}
+
+static void _gldReplay_VertexAttrib4dvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4dvNV))
+      pReplay->Table.VertexAttrib4dvNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib4fNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat w = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4fNV))
+      pReplay->Table.VertexAttrib4fNV(index, x, y, z, w);
+}
+
+static void _gldReplay_VertexAttrib4fvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4fvNV))
+      pReplay->Table.VertexAttrib4fvNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib4sNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLshort x = (GLshort) _gldReplayS32(pReplay);
+   GLshort y = (GLshort) _gldReplayS32(pReplay);
+   GLshort z = (GLshort) _gldReplayS32(pReplay);
+   GLshort w = (GLshort) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4sNV))
+      pReplay->Table.VertexAttrib4sNV(index, x, y, z, w);
+}
+
+static void _gldReplay_VertexAttrib4svNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4svNV))
+      pReplay->Table.VertexAttrib4svNV(index, v);
+}
+
+static void _gldReplay_VertexAttrib4ubNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLubyte x = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte y = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte z = (GLubyte) _gldReplayU32(pReplay);
+   GLubyte w = (GLubyte) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4ubNV))
+      pReplay->Table.VertexAttrib4ubNV(index, x, y, z, w);
+}
+
+static void _gldReplay_VertexAttrib4ubvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLubyte * v = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4ubvNV))
+      pReplay->Table.VertexAttrib4ubvNV(index, v);
+}
+
+static void _gldReplay_VertexAttribs1dvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs1dvNV))
+      pReplay->Table.VertexAttribs1dvNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs1fvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs1fvNV))
+      pReplay->Table.VertexAttribs1fvNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs1svNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs1svNV))
+      pReplay->Table.VertexAttribs1svNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs2dvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs2dvNV))
+      pReplay->Table.VertexAttribs2dvNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs2fvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs2fvNV))
+      pReplay->Table.VertexAttribs2fvNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs2svNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs2svNV))
+      pReplay->Table.VertexAttribs2svNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs3dvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs3dvNV))
+      pReplay->Table.VertexAttribs3dvNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs3fvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs3fvNV))
+      pReplay->Table.VertexAttribs3fvNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs3svNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs3svNV))
+      pReplay->Table.VertexAttribs3svNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs4dvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs4dvNV))
+      pReplay->Table.VertexAttribs4dvNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs4fvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs4fvNV))
+      pReplay->Table.VertexAttribs4fvNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs4svNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs4svNV))
+      pReplay->Table.VertexAttribs4svNV(index, n, v);
+}
+
+static void _gldReplay_VertexAttribs4ubvNV(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLubyte * v = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribs4ubvNV))
+      pReplay->Table.VertexAttribs4ubvNV(index, n, v);
+}
+
+static void _gldReplay_PointParameteriNV(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint params = (GLint) _gldReplayS32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PointParameteriNV))
+      pReplay->Table.PointParameteriNV(pname, params);
+}
+
+static void _gldReplay_PointParameterivNV(GLD_replay *pReplay)
+{
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   const GLint * params = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, PointParameterivNV))
+      pReplay->Table.PointParameterivNV(pname, params);
+}
+
+static void _gldReplay_MultiDrawArraysEXT(GLD_replay *pReplay)
+{
+   pReplay->bSkip = GL_TRUE;
+}
+
+static void _gldReplay_MultiDrawElementsEXT(GLD_replay *pReplay)
+{
+   pReplay->bSkip = GL_TRUE;
+}
+
+static void _gldReplay_ActiveStencilFaceEXT(GLD_replay *pReplay)
+{
+   GLenum face = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ActiveStencilFaceEXT))
+      pReplay->Table.ActiveStencilFaceEXT(face);
+}
+
+static void _gldReplay_DeleteFencesNV(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * fences = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DeleteFencesNV))
+      pReplay->Table.DeleteFencesNV(n, fences);
+}
+
+static void _gldReplay_GenFencesNV(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   GLuint * fences = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GenFencesNV))
+      pReplay->Table.GenFencesNV(n, fences);
+}
+
+static void _gldReplay_IsFenceNV(GLD_replay *pReplay)
+{
+   GLuint fence = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IsFenceNV))
+      (void) pReplay->Table.IsFenceNV(fence);
+}
+
+static void _gldReplay_TestFenceNV(GLD_replay *pReplay)
+{
+   GLuint fence = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, TestFenceNV))
+      (void) pReplay->Table.TestFenceNV(fence);
+}
+
+static void _gldReplay_GetFenceivNV(GLD_replay *pReplay)
+{
+   GLuint fence = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetFenceivNV))
+      pReplay->Table.GetFenceivNV(fence, pname, params);
+}
+
+static void _gldReplay_FinishFenceNV(GLD_replay *pReplay)
+{
+   GLuint fence = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, FinishFenceNV))
+      pReplay->Table.FinishFenceNV(fence);
+}
+
+static void _gldReplay_SetFenceNV(GLD_replay *pReplay)
+{
+   GLuint fence = (GLuint) _gldReplayU32(pReplay);
+   GLenum condition = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, SetFenceNV))
+      pReplay->Table.SetFenceNV(fence, condition);
+}
+
+static void _gldReplay_VertexAttrib4bvARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLbyte * v = (const GLbyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4bvARB))
+      pReplay->Table.VertexAttrib4bvARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4ivARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4ivARB))
+      pReplay->Table.VertexAttrib4ivARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4ubvARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLubyte * v = (const GLubyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4ubvARB))
+      pReplay->Table.VertexAttrib4ubvARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4usvARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLushort * v = (const GLushort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4usvARB))
+      pReplay->Table.VertexAttrib4usvARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4uivARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLuint * v = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4uivARB))
+      pReplay->Table.VertexAttrib4uivARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4NbvARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLbyte * v = (const GLbyte *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4NbvARB))
+      pReplay->Table.VertexAttrib4NbvARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4NsvARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLshort * v = (const GLshort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4NsvARB))
+      pReplay->Table.VertexAttrib4NsvARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4NivARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLint * v = (const GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4NivARB))
+      pReplay->Table.VertexAttrib4NivARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4NusvARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLushort * v = (const GLushort *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4NusvARB))
+      pReplay->Table.VertexAttrib4NusvARB(index, v);
+}
+
+static void _gldReplay_VertexAttrib4NuivARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLuint * v = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttrib4NuivARB))
+      pReplay->Table.VertexAttrib4NuivARB(index, v);
+}
+
+static void _gldReplay_VertexAttribPointerARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLint size = (GLint) _gldReplayS32(pReplay);
+   GLenum type = (GLenum) _gldReplayU32(pReplay);
+   GLboolean normalized = (GLboolean) _gldReplayU32(pReplay);
+   GLsizei stride = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * pointer = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, VertexAttribPointerARB))
+      pReplay->Table.VertexAttribPointerARB(index, size, type, normalized, stride, pointer);
+}
+
+static void _gldReplay_EnableVertexAttribArrayARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EnableVertexAttribArrayARB))
+      pReplay->Table.EnableVertexAttribArrayARB(index);
+}
+
+static void _gldReplay_DisableVertexAttribArrayARB(GLD_replay *pReplay)
+{
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DisableVertexAttribArrayARB))
+      pReplay->Table.DisableVertexAttribArrayARB(index);
+}
+
+static void _gldReplay_ProgramStringARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum format = (GLenum) _gldReplayU32(pReplay);
+   GLsizei len = (GLsizei) _gldReplayS32(pReplay);
+   const GLvoid * string = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramStringARB))
+      pReplay->Table.ProgramStringARB(target, format, len, string);
+}
+
+static void _gldReplay_ProgramEnvParameter4dARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble w = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramEnvParameter4dARB))
+      pReplay->Table.ProgramEnvParameter4dARB(target, index, x, y, z, w);
+}
+
+static void _gldReplay_ProgramEnvParameter4dvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLdouble * params = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramEnvParameter4dvARB))
+      pReplay->Table.ProgramEnvParameter4dvARB(target, index, params);
+}
+
+static void _gldReplay_ProgramEnvParameter4fARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat w = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramEnvParameter4fARB))
+      pReplay->Table.ProgramEnvParameter4fARB(target, index, x, y, z, w);
+}
+
+static void _gldReplay_ProgramEnvParameter4fvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramEnvParameter4fvARB))
+      pReplay->Table.ProgramEnvParameter4fvARB(target, index, params);
+}
+
+static void _gldReplay_ProgramLocalParameter4dARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble w = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramLocalParameter4dARB))
+      pReplay->Table.ProgramLocalParameter4dARB(target, index, x, y, z, w);
+}
+
+static void _gldReplay_ProgramLocalParameter4dvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLdouble * params = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramLocalParameter4dvARB))
+      pReplay->Table.ProgramLocalParameter4dvARB(target, index, params);
+}
+
+static void _gldReplay_ProgramLocalParameter4fARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat w = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramLocalParameter4fARB))
+      pReplay->Table.ProgramLocalParameter4fARB(target, index, x, y, z, w);
+}
+
+static void _gldReplay_ProgramLocalParameter4fvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   const GLfloat * params = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramLocalParameter4fvARB))
+      pReplay->Table.ProgramLocalParameter4fvARB(target, index, params);
+}
+
+static void _gldReplay_GetProgramEnvParameterdvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble * params = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramEnvParameterdvARB))
+      pReplay->Table.GetProgramEnvParameterdvARB(target, index, params);
+}
+
+static void _gldReplay_GetProgramEnvParameterfvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramEnvParameterfvARB))
+      pReplay->Table.GetProgramEnvParameterfvARB(target, index, params);
+}
+
+static void _gldReplay_GetProgramLocalParameterdvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLdouble * params = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramLocalParameterdvARB))
+      pReplay->Table.GetProgramLocalParameterdvARB(target, index, params);
+}
+
+static void _gldReplay_GetProgramLocalParameterfvARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint index = (GLuint) _gldReplayU32(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramLocalParameterfvARB))
+      pReplay->Table.GetProgramLocalParameterfvARB(target, index, params);
+}
+
+static void _gldReplay_GetProgramivARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramivARB))
+      pReplay->Table.GetProgramivARB(target, pname, params);
+}
+
+static void _gldReplay_GetProgramStringARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLvoid * string = (GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramStringARB))
+      pReplay->Table.GetProgramStringARB(target, pname, string);
+}
+
+static void _gldReplay_ProgramNamedParameter4fNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLsizei len = (GLsizei) _gldReplayS32(pReplay);
+   const GLubyte * name = (const GLubyte *) _gldReplayPtr(pReplay);
+   GLfloat x = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat y = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat z = (GLfloat) _gldReplayF32(pReplay);
+   GLfloat w = (GLfloat) _gldReplayF32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramNamedParameter4fNV))
+      pReplay->Table.ProgramNamedParameter4fNV(id, len, name, x, y, z, w);
+}
+
+static void _gldReplay_ProgramNamedParameter4dNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLsizei len = (GLsizei) _gldReplayS32(pReplay);
+   const GLubyte * name = (const GLubyte *) _gldReplayPtr(pReplay);
+   GLdouble x = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble y = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble z = (GLdouble) _gldReplayF64(pReplay);
+   GLdouble w = (GLdouble) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramNamedParameter4dNV))
+      pReplay->Table.ProgramNamedParameter4dNV(id, len, name, x, y, z, w);
+}
+
+static void _gldReplay_ProgramNamedParameter4fvNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLsizei len = (GLsizei) _gldReplayS32(pReplay);
+   const GLubyte * name = (const GLubyte *) _gldReplayPtr(pReplay);
+   const GLfloat * v = (const GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramNamedParameter4fvNV))
+      pReplay->Table.ProgramNamedParameter4fvNV(id, len, name, v);
+}
+
+static void _gldReplay_ProgramNamedParameter4dvNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLsizei len = (GLsizei) _gldReplayS32(pReplay);
+   const GLubyte * name = (const GLubyte *) _gldReplayPtr(pReplay);
+   const GLdouble * v = (const GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, ProgramNamedParameter4dvNV))
+      pReplay->Table.ProgramNamedParameter4dvNV(id, len, name, v);
+}
+
+static void _gldReplay_GetProgramNamedParameterfvNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLsizei len = (GLsizei) _gldReplayS32(pReplay);
+   const GLubyte * name = (const GLubyte *) _gldReplayPtr(pReplay);
+   GLfloat * params = (GLfloat *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramNamedParameterfvNV))
+      pReplay->Table.GetProgramNamedParameterfvNV(id, len, name, params);
+}
+
+static void _gldReplay_GetProgramNamedParameterdvNV(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLsizei len = (GLsizei) _gldReplayS32(pReplay);
+   const GLubyte * name = (const GLubyte *) _gldReplayPtr(pReplay);
+   GLdouble * params = (GLdouble *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetProgramNamedParameterdvNV))
+      pReplay->Table.GetProgramNamedParameterdvNV(id, len, name, params);
+}
+
+static void _gldReplay_BindBufferARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint buffer = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BindBufferARB))
+      pReplay->Table.BindBufferARB(target, buffer);
+}
+
+static void _gldReplay_BufferDataARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLsizeiptrARB size = (GLsizeiptrARB) _gldReplayS64(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   GLenum usage = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BufferDataARB))
+      pReplay->Table.BufferDataARB(target, size, data, usage);
+}
+
+static void _gldReplay_BufferSubDataARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLintptrARB offset = (GLintptrARB) _gldReplayS64(pReplay);
+   GLsizeiptrARB size = (GLsizeiptrARB) _gldReplayS64(pReplay);
+   const GLvoid * data = (const GLvoid *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BufferSubDataARB))
+      pReplay->Table.BufferSubDataARB(target, offset, size, data);
+}
+
+static void _gldReplay_DeleteBuffersARB(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * buffer = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DeleteBuffersARB))
+      pReplay->Table.DeleteBuffersARB(n, buffer);
+}
+
+static void _gldReplay_GenBuffersARB(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   GLuint * buffer = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GenBuffersARB))
+      pReplay->Table.GenBuffersARB(n, buffer);
+}
+
+static void _gldReplay_GetBufferParameterivARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetBufferParameterivARB))
+      pReplay->Table.GetBufferParameterivARB(target, pname, params);
+}
+
+static void _gldReplay_GetBufferPointervARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLvoid ** params = (GLvoid **) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetBufferPointervARB))
+      pReplay->Table.GetBufferPointervARB(target, pname, params);
+}
+
+static void _gldReplay_GetBufferSubDataARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLintptrARB offset = (GLintptrARB) _gldReplayS64(pReplay);
+   GLsizeiptrARB size = (GLsizeiptrARB) _gldReplayS64(pReplay);
+   void * data = (void *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetBufferSubDataARB))
+      pReplay->Table.GetBufferSubDataARB(target, offset, size, data);
+}
+
+static void _gldReplay_IsBufferARB(GLD_replay *pReplay)
+{
+   GLuint buffer = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IsBufferARB))
+      (void) pReplay->Table.IsBufferARB(buffer);
+}
+
+static void _gldReplay_MapBufferARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum access = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, MapBufferARB))
+      (void) pReplay->Table.MapBufferARB(target, access);
+}
+
+static void _gldReplay_UnmapBufferARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, UnmapBufferARB))
+      (void) pReplay->Table.UnmapBufferARB(target);
+}
+
+static void _gldReplay_DepthBoundsEXT(GLD_replay *pReplay)
+{
+   GLclampd zmin = (GLclampd) _gldReplayF64(pReplay);
+   GLclampd zmax = (GLclampd) _gldReplayF64(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DepthBoundsEXT))
+      pReplay->Table.DepthBoundsEXT(zmin, zmax);
+}
+
+static void _gldReplay_GenQueriesARB(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   GLuint * ids = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GenQueriesARB))
+      pReplay->Table.GenQueriesARB(n, ids);
+}
+
+static void _gldReplay_DeleteQueriesARB(GLD_replay *pReplay)
+{
+   GLsizei n = (GLsizei) _gldReplayS32(pReplay);
+   const GLuint * ids = (const GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, DeleteQueriesARB))
+      pReplay->Table.DeleteQueriesARB(n, ids);
+}
+
+static void _gldReplay_IsQueryARB(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, IsQueryARB))
+      (void) pReplay->Table.IsQueryARB(id);
+}
+
+static void _gldReplay_BeginQueryARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, BeginQueryARB))
+      pReplay->Table.BeginQueryARB(target, id);
+}
+
+static void _gldReplay_EndQueryARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, EndQueryARB))
+      pReplay->Table.EndQueryARB(target);
+}
+
+static void _gldReplay_GetQueryivARB(GLD_replay *pReplay)
+{
+   GLenum target = (GLenum) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetQueryivARB))
+      pReplay->Table.GetQueryivARB(target, pname, params);
+}
+
+static void _gldReplay_GetQueryObjectivARB(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLint * params = (GLint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetQueryObjectivARB))
+      pReplay->Table.GetQueryObjectivARB(id, pname, params);
+}
+
+static void _gldReplay_GetQueryObjectuivARB(GLD_replay *pReplay)
+{
+   GLuint id = (GLuint) _gldReplayU32(pReplay);
+   GLenum pname = (GLenum) _gldReplayU32(pReplay);
+   GLuint * params = (GLuint *) _gldReplayPtr(pReplay);
+   if (_GLD_REPLAY_OK(pReplay, GetQueryObjectuivARB))
+      pReplay->Table.GetQueryObjectuivARB(id, pname, params);
+}
+
+static void _gldReplay_MultiModeDrawArraysIBM(GLD_replay *pReplay)
+{
+   pReplay->bSkip = GL_TRUE;
+}
+
+static void _gldReplay_MultiModeDrawElementsIBM(GLD_replay *pReplay)
+{
+   pReplay->bSkip = GL_TRUE;
+}
+
+static void (*const _gldReplayFuncs[GLD_TRACE_SLOTS])(GLD_replay *pReplay) = {
+   _gldReplay_NewList,
+   _gldReplay_EndList,
+   _gldReplay_CallList,
+   _gldReplay_CallLists,
+   _gldReplay_DeleteLists,
+   _gldReplay_GenLists,
+   _gldReplay_ListBase,
+   _gldReplay_Begin,
+   _gldReplay_Bitmap,
+   _gldReplay_Color3b,
+   _gldReplay_Color3bv,
+   _gldReplay_Color3d,
+   _gldReplay_Color3dv,
+   _gldReplay_Color3f,
+   _gldReplay_Color3fv,
+   _gldReplay_Color3i,
+   _gldReplay_Color3iv,
+   _gldReplay_Color3s,
+   _gldReplay_Color3sv,
+   _gldReplay_Color3ub,
+   _gldReplay_Color3ubv,
+   _gldReplay_Color3ui,
+   _gldReplay_Color3uiv,
+   _gldReplay_Color3us,
+   _gldReplay_Color3usv,
+   _gldReplay_Color4b,
+   _gldReplay_Color4bv,
+   _gldReplay_Color4d,
+   _gldReplay_Color4dv,
+   _gldReplay_Color4f,
+   _gldReplay_Color4fv,
+   _gldReplay_Color4i,
+   _gldReplay_Color4iv,
+   _gldReplay_Color4s,
+   _gldReplay_Color4sv,
+   _gldReplay_Color4ub,
+   _gldReplay_Color4ubv,
+   _gldReplay_Color4ui,
+   _gldReplay_Color4uiv,
+   _gldReplay_Color4us,
+   _gldReplay_Color4usv,
+   _gldReplay_EdgeFlag,
+   _gldReplay_EdgeFlagv,
+   _gldReplay_End,
+   _gldReplay_Indexd,
+   _gldReplay_Indexdv,
+   _gldReplay_Indexf,
+   _gldReplay_Indexfv,
+   _gldReplay_Indexi,
+   _gldReplay_Indexiv,
+   _gldReplay_Indexs,
+   _gldReplay_Indexsv,
+   _gldReplay_Normal3b,
+   _gldReplay_Normal3bv,
+   _gldReplay_Normal3d,
+   _gldReplay_Normal3dv,
+   _gldReplay_Normal3f,
+   _gldReplay_Normal3fv,
+   _gldReplay_Normal3i,
+   _gldReplay_Normal3iv,
+   _gldReplay_Normal3s,
+   _gldReplay_Normal3sv,
+   _gldReplay_RasterPos2d,
+   _gldReplay_RasterPos2dv,
+   _gldReplay_RasterPos2f,
+   _gldReplay_RasterPos2fv,
+   _gldReplay_RasterPos2i,
+   _gldReplay_RasterPos2iv,
+   _gldReplay_RasterPos2s,
+   _gldReplay_RasterPos2sv,
+   _gldReplay_RasterPos3d,
+   _gldReplay_RasterPos3dv,
+   _gldReplay_RasterPos3f,
+   _gldReplay_RasterPos3fv,
+   _gldReplay_RasterPos3i,
+   _gldReplay_RasterPos3iv,
+   _gldReplay_RasterPos3s,
+   _gldReplay_RasterPos3sv,
+   _gldReplay_RasterPos4d,
+   _gldReplay_RasterPos4dv,
+   _gldReplay_RasterPos4f,
+   _gldReplay_RasterPos4fv,
+   _gldReplay_RasterPos4i,
+   _gldReplay_RasterPos4iv,
+   _gldReplay_RasterPos4s,
+   _gldReplay_RasterPos4sv,
+   _gldReplay_Rectd,
+   _gldReplay_Rectdv,
+   _gldReplay_Rectf,
+   _gldReplay_Rectfv,
+   _gldReplay_Recti,
+   _gldReplay_Rectiv,
+   _gldReplay_Rects,
+   _gldReplay_Rectsv,
+   _gldReplay_TexCoord1d,
+   _gldReplay_TexCoord1dv,
+   _gldReplay_TexCoord1f,
+   _gldReplay_TexCoord1fv,
+   _gldReplay_TexCoord1i,
+   _gldReplay_TexCoord1iv,
+   _gldReplay_TexCoord1s,
+   _gldReplay_TexCoord1sv,
+   _gldReplay_TexCoord2d,
+   _gldReplay_TexCoord2dv,
+   _gldReplay_TexCoord2f,
+   _gldReplay_TexCoord2fv,
+   _gldReplay_TexCoord2i,
+   _gldReplay_TexCoord2iv,
+   _gldReplay_TexCoord2s,
+   _gldReplay_TexCoord2sv,
+   _gldReplay_TexCoord3d,
+   _gldReplay_TexCoord3dv,
+   _gldReplay_TexCoord3f,
+   _gldReplay_TexCoord3fv,
+   _gldReplay_TexCoord3i,
+   _gldReplay_TexCoord3iv,
+   _gldReplay_TexCoord3s,
+   _gldReplay_TexCoord3sv,
+   _gldReplay_TexCoord4d,
+   _gldReplay_TexCoord4dv,
+   _gldReplay_TexCoord4f,
+   _gldReplay_TexCoord4fv,
+   _gldReplay_TexCoord4i,
+   _gldReplay_TexCoord4iv,
+   _gldReplay_TexCoord4s,
+   _gldReplay_TexCoord4sv,
+   _gldReplay_Vertex2d,
+   _gldReplay_Vertex2dv,
+   _gldReplay_Vertex2f,
+   _gldReplay_Vertex2fv,
+   _gldReplay_Vertex2i,
+   _gldReplay_Vertex2iv,
+   _gldReplay_Vertex2s,
+   _gldReplay_Vertex2sv,
+   _gldReplay_Vertex3d,
+   _gldReplay_Vertex3dv,
+   _gldReplay_Vertex3f,
+   _gldReplay_Vertex3fv,
+   _gldReplay_Vertex3i,
+   _gldReplay_Vertex3iv,
+   _gldReplay_Vertex3s,
+   _gldReplay_Vertex3sv,
+   _gldReplay_Vertex4d,
+   _gldReplay_Vertex4dv,
+   _gldReplay_Vertex4f,
+   _gldReplay_Vertex4fv,
+   _gldReplay_Vertex4i,
+   _gldReplay_Vertex4iv,
+   _gldReplay_Vertex4s,
+   _gldReplay_Vertex4sv,
+   _gldReplay_ClipPlane,
+   _gldReplay_ColorMaterial,
+   _gldReplay_CullFace,
+   _gldReplay_Fogf,
+   _gldReplay_Fogfv,
+   _gldReplay_Fogi,
+   _gldReplay_Fogiv,
+   _gldReplay_FrontFace,
+   _gldReplay_Hint,
+   _gldReplay_Lightf,
+   _gldReplay_Lightfv,
+   _gldReplay_Lighti,
+   _gldReplay_Lightiv,
+   _gldReplay_LightModelf,
+   _gldReplay_LightModelfv,
+   _gldReplay_LightModeli,
+   _gldReplay_LightModeliv,
+   _gldReplay_LineStipple,
+   _gldReplay_LineWidth,
+   _gldReplay_Materialf,
+   _gldReplay_Materialfv,
+   _gldReplay_Materiali,
+   _gldReplay_Materialiv,
+   _gldReplay_PointSize,
+   _gldReplay_PolygonMode,
+   _gldReplay_PolygonStipple,
+   _gldReplay_Scissor,
+   _gldReplay_ShadeModel,
+   _gldReplay_TexParameterf,
+   _gldReplay_TexParameterfv,
+   _gldReplay_TexParameteri,
+   _gldReplay_TexParameteriv,
+   _gldReplay_TexImage1D,
+   _gldReplay_TexImage2D,
+   _gldReplay_TexEnvf,
+   _gldReplay_TexEnvfv,
+   _gldReplay_TexEnvi,
+   _gldReplay_TexEnviv,
+   _gldReplay_TexGend,
+   _gldReplay_TexGendv,
+   _gldReplay_TexGenf,
+   _gldReplay_TexGenfv,
+   _gldReplay_TexGeni,
+   _gldReplay_TexGeniv,
+   _gldReplay_FeedbackBuffer,
+   _gldReplay_SelectBuffer,
+   _gldReplay_RenderMode,
+   _gldReplay_InitNames,
+   _gldReplay_LoadName,
+   _gldReplay_PassThrough,
+   _gldReplay_PopName,
+   _gldReplay_PushName,
+   _gldReplay_DrawBuffer,
+   _gldReplay_Clear,
+   _gldReplay_ClearAccum,
+   _gldReplay_ClearIndex,
+   _gldReplay_ClearColor,
+   _gldReplay_ClearStencil,
+   _gldReplay_ClearDepth,
+   _gldReplay_StencilMask,
+   _gldReplay_ColorMask,
+   _gldReplay_DepthMask,
+   _gldReplay_IndexMask,
+   _gldReplay_Accum,
+   _gldReplay_Disable,
+   _gldReplay_Enable,
+   _gldReplay_Finish,
+   _gldReplay_Flush,
+   _gldReplay_PopAttrib,
+   _gldReplay_PushAttrib,
+   _gldReplay_Map1d,
+   _gldReplay_Map1f,
+   _gldReplay_Map2d,
+   _gldReplay_Map2f,
+   _gldReplay_MapGrid1d,
+   _gldReplay_MapGrid1f,
+   _gldReplay_MapGrid2d,
+   _gldReplay_MapGrid2f,
+   _gldReplay_EvalCoord1d,
+   _gldReplay_EvalCoord1dv,
+   _gldReplay_EvalCoord1f,
+   _gldReplay_EvalCoord1fv,
+   _gldReplay_EvalCoord2d,
+   _gldReplay_EvalCoord2dv,
+   _gldReplay_EvalCoord2f,
+   _gldReplay_EvalCoord2fv,
+   _gldReplay_EvalMesh1,
+   _gldReplay_EvalPoint1,
+   _gldReplay_EvalMesh2,
+   _gldReplay_EvalPoint2,
+   _gldReplay_AlphaFunc,
+   _gldReplay_BlendFunc,
+   _gldReplay_LogicOp,
+   _gldReplay_StencilFunc,
+   _gldReplay_StencilOp,
+   _gldReplay_DepthFunc,
+   _gldReplay_PixelZoom,
+   _gldReplay_PixelTransferf,
+   _gldReplay_PixelTransferi,
+   _gldReplay_PixelStoref,
+   _gldReplay_PixelStorei,
+   _gldReplay_PixelMapfv,
+   _gldReplay_PixelMapuiv,
+   _gldReplay_PixelMapusv,
+   _gldReplay_ReadBuffer,
+   _gldReplay_CopyPixels,
+   _gldReplay_ReadPixels,
+   _gldReplay_DrawPixels,
+   _gldReplay_GetBooleanv,
+   _gldReplay_GetClipPlane,
+   _gldReplay_GetDoublev,
+   _gldReplay_GetError,
+   _gldReplay_GetFloatv,
+   _gldReplay_GetIntegerv,
+   _gldReplay_GetLightfv,
+   _gldReplay_GetLightiv,
+   _gldReplay_GetMapdv,
+   _gldReplay_GetMapfv,
+   _gldReplay_GetMapiv,
+   _gldReplay_GetMaterialfv,
+   _gldReplay_GetMaterialiv,
+   _gldReplay_GetPixelMapfv,
+   _gldReplay_GetPixelMapuiv,
+   _gldReplay_GetPixelMapusv,
+   _gldReplay_GetPolygonStipple,
+   _gldReplay_GetString,
+   _gldReplay_GetTexEnvfv,
+   _gldReplay_GetTexEnviv,
+   _gldReplay_GetTexGendv,
+   _gldReplay_GetTexGenfv,
+   _gldReplay_GetTexGeniv,
+   _gldReplay_GetTexImage,
+   _gldReplay_GetTexParameterfv,
+   _gldReplay_GetTexParameteriv,
+   _gldReplay_GetTexLevelParameterfv,
+   _gldReplay_GetTexLevelParameteriv,
+   _gldReplay_IsEnabled,
+   _gldReplay_IsList,
+   _gldReplay_DepthRange,
+   _gldReplay_Frustum,
+   _gldReplay_LoadIdentity,
+   _gldReplay_LoadMatrixf,
+   _gldReplay_LoadMatrixd,
+   _gldReplay_MatrixMode,
+   _gldReplay_MultMatrixf,
+   _gldReplay_MultMatrixd,
+   _gldReplay_Ortho,
+   _gldReplay_PopMatrix,
+   _gldReplay_PushMatrix,
+   _gldReplay_Rotated,
+   _gldReplay_Rotatef,
+   _gldReplay_Scaled,
+   _gldReplay_Scalef,
+   _gldReplay_Translated,
+   _gldReplay_Translatef,
+   _gldReplay_Viewport,
+   _gldReplay_ArrayElement,
+   _gldReplay_BindTexture,
+   _gldReplay_ColorPointer,
+   _gldReplay_DisableClientState,
+   _gldReplay_DrawArrays,
+   _gldReplay_DrawElements,
+   _gldReplay_EdgeFlagPointer,
+   _gldReplay_EnableClientState,
+   _gldReplay_IndexPointer,
+   _gldReplay_Indexub,
+   _gldReplay_Indexubv,
+   _gldReplay_InterleavedArrays,
+   _gldReplay_NormalPointer,
+   _gldReplay_PolygonOffset,
+   _gldReplay_TexCoordPointer,
+   _gldReplay_VertexPointer,
+   _gldReplay_AreTexturesResident,
+   _gldReplay_CopyTexImage1D,
+   _gldReplay_CopyTexImage2D,
+   _gldReplay_CopyTexSubImage1D,
+   _gldReplay_CopyTexSubImage2D,
+   _gldReplay_DeleteTextures,
+   _gldReplay_GenTextures,
+   _gldReplay_GetPointerv,
+   _gldReplay_IsTexture,
+   _gldReplay_PrioritizeTextures,
+   _gldReplay_TexSubImage1D,
+   _gldReplay_TexSubImage2D,
+   _gldReplay_PopClientAttrib,
+   _gldReplay_PushClientAttrib,
+   _gldReplay_BlendColor,
+   _gldReplay_BlendEquation,
+   _gldReplay_DrawRangeElements,
+   _gldReplay_ColorTable,
+   _gldReplay_ColorTableParameterfv,
+   _gldReplay_ColorTableParameteriv,
+   _gldReplay_CopyColorTable,
+   _gldReplay_GetColorTable,
+   _gldReplay_GetColorTableParameterfv,
+   _gldReplay_GetColorTableParameteriv,
+   _gldReplay_ColorSubTable,
+   _gldReplay_CopyColorSubTable,
+   _gldReplay_ConvolutionFilter1D,
+   _gldReplay_ConvolutionFilter2D,
+   _gldReplay_ConvolutionParameterf,
+   _gldReplay_ConvolutionParameterfv,
+   _gldReplay_ConvolutionParameteri,
+   _gldReplay_ConvolutionParameteriv,
+   _gldReplay_CopyConvolutionFilter1D,
+   _gldReplay_CopyConvolutionFilter2D,
+   _gldReplay_GetConvolutionFilter,
+   _gldReplay_GetConvolutionParameterfv,
+   _gldReplay_GetConvolutionParameteriv,
+   _gldReplay_GetSeparableFilter,
+   _gldReplay_SeparableFilter2D,
+   _gldReplay_GetHistogram,
+   _gldReplay_GetHistogramParameterfv,
+   _gldReplay_GetHistogramParameteriv,
+   _gldReplay_GetMinmax,
+   _gldReplay_GetMinmaxParameterfv,
+   _gldReplay_GetMinmaxParameteriv,
+   _gldReplay_Histogram,
+   _gldReplay_Minmax,
+   _gldReplay_ResetHistogram,
+   _gldReplay_ResetMinmax,
+   _gldReplay_TexImage3D,
+   _gldReplay_TexSubImage3D,
+   _gldReplay_CopyTexSubImage3D,
+   _gldReplay_ActiveTextureARB,
+   _gldReplay_ClientActiveTextureARB,
+   _gldReplay_MultiTexCoord1dARB,
+   _gldReplay_MultiTexCoord1dvARB,
+   _gldReplay_MultiTexCoord1fARB,
+   _gldReplay_MultiTexCoord1fvARB,
+   _gldReplay_MultiTexCoord1iARB,
+   _gldReplay_MultiTexCoord1ivARB,
+   _gldReplay_MultiTexCoord1sARB,
+   _gldReplay_MultiTexCoord1svARB,
+   _gldReplay_MultiTexCoord2dARB,
+   _gldReplay_MultiTexCoord2dvARB,
+   _gldReplay_MultiTexCoord2fARB,
+   _gldReplay_MultiTexCoord2fvARB,
+   _gldReplay_MultiTexCoord2iARB,
+   _gldReplay_MultiTexCoord2ivARB,
+   _gldReplay_MultiTexCoord2sARB,
+   _gldReplay_MultiTexCoord2svARB,
+   _gldReplay_MultiTexCoord3dARB,
+   _gldReplay_MultiTexCoord3dvARB,
+   _gldReplay_MultiTexCoord3fARB,
+   _gldReplay_MultiTexCoord3fvARB,
+   _gldReplay_MultiTexCoord3iARB,
+   _gldReplay_MultiTexCoord3ivARB,
+   _gldReplay_MultiTexCoord3sARB,
+   _gldReplay_MultiTexCoord3svARB,
+   _gldReplay_MultiTexCoord4dARB,
+   _gldReplay_MultiTexCoord4dvARB,
+   _gldReplay_MultiTexCoord4fARB,
+   _gldReplay_MultiTexCoord4fvARB,
+   _gldReplay_MultiTexCoord4iARB,
+   _gldReplay_MultiTexCoord4ivARB,
+   _gldReplay_MultiTexCoord4sARB,
+   _gldReplay_MultiTexCoord4svARB,
+   _gldReplay_LoadTransposeMatrixfARB,
+   _gldReplay_LoadTransposeMatrixdARB,
+   _gldReplay_MultTransposeMatrixfARB,
+   _gldReplay_MultTransposeMatrixdARB,
+   _gldReplay_SampleCoverageARB,
+   _gldReplay___unused413,
+   _gldReplay_PolygonOffsetEXT,
+   _gldReplay_GetTexFilterFuncSGIS,
+   _gldReplay_TexFilterFuncSGIS,
+   _gldReplay_GetHistogramEXT,
+   _gldReplay_GetHistogramParameterfvEXT,
+   _gldReplay_GetHistogramParameterivEXT,
+   _gldReplay_GetMinmaxEXT,
+   _gldReplay_GetMinmaxParameterfvEXT,
+   _gldReplay_GetMinmaxParameterivEXT,
+   _gldReplay_GetConvolutionFilterEXT,
+   _gldReplay_GetConvolutionParameterfvEXT,
+   _gldReplay_GetConvolutionParameterivEXT,
+   _gldReplay_GetSeparableFilterEXT,
+   _gldReplay_GetColorTableSGI,
+   _gldReplay_GetColorTableParameterfvSGI,
+   _gldReplay_GetColorTableParameterivSGI,
+   _gldReplay_PixelTexGenSGIX,
+   _gldReplay_PixelTexGenParameteriSGIS,
+   _gldReplay_PixelTexGenParameterivSGIS,
+   _gldReplay_PixelTexGenParameterfSGIS,
+   _gldReplay_PixelTexGenParameterfvSGIS,
+   _gldReplay_GetPixelTexGenParameterivSGIS,
+   _gldReplay_GetPixelTexGenParameterfvSGIS,
+   _gldReplay_TexImage4DSGIS,
+   _gldReplay_TexSubImage4DSGIS,
+   _gldReplay_AreTexturesResidentEXT,
+   _gldReplay_GenTexturesEXT,
+   _gldReplay_IsTextureEXT,
+   _gldReplay_DetailTexFuncSGIS,
+   _gldReplay_GetDetailTexFuncSGIS,
+   _gldReplay_SharpenTexFuncSGIS,
+   _gldReplay_GetSharpenTexFuncSGIS,
+   _gldReplay_SampleMaskSGIS,
+   _gldReplay_SamplePatternSGIS,
+   _gldReplay_ColorPointerEXT,
+   _gldReplay_EdgeFlagPointerEXT,
+   _gldReplay_IndexPointerEXT,
+   _gldReplay_NormalPointerEXT,
+   _gldReplay_TexCoordPointerEXT,
+   _gldReplay_VertexPointerEXT,
+   _gldReplay_SpriteParameterfSGIX,
+   _gldReplay_SpriteParameterfvSGIX,
+   _gldReplay_SpriteParameteriSGIX,
+   _gldReplay_SpriteParameterivSGIX,
+   _gldReplay_PointParameterfEXT,
+   _gldReplay_PointParameterfvEXT,
+   _gldReplay_GetInstrumentsSGIX,
+   _gldReplay_InstrumentsBufferSGIX,
+   _gldReplay_PollInstrumentsSGIX,
+   _gldReplay_ReadInstrumentsSGIX,
+   _gldReplay_StartInstrumentsSGIX,
+   _gldReplay_StopInstrumentsSGIX,
+   _gldReplay_FrameZoomSGIX,
+   _gldReplay_TagSampleBufferSGIX,
+   _gldReplay_ReferencePlaneSGIX,
+   _gldReplay_FlushRasterSGIX,
+   _gldReplay_GetListParameterfvSGIX,
+   _gldReplay_GetListParameterivSGIX,
+   _gldReplay_ListParameterfSGIX,
+   _gldReplay_ListParameterfvSGIX,
+   _gldReplay_ListParameteriSGIX,
+   _gldReplay_ListParameterivSGIX,
+   _gldReplay_FragmentColorMaterialSGIX,
+   _gldReplay_FragmentLightfSGIX,
+   _gldReplay_FragmentLightfvSGIX,
+   _gldReplay_FragmentLightiSGIX,
+   _gldReplay_FragmentLightivSGIX,
+   _gldReplay_FragmentLightModelfSGIX,
+   _gldReplay_FragmentLightModelfvSGIX,
+   _gldReplay_FragmentLightModeliSGIX,
+   _gldReplay_FragmentLightModelivSGIX,
+   _gldReplay_FragmentMaterialfSGIX,
+   _gldReplay_FragmentMaterialfvSGIX,
+   _gldReplay_FragmentMaterialiSGIX,
+   _gldReplay_FragmentMaterialivSGIX,
+   _gldReplay_GetFragmentLightfvSGIX,
+   _gldReplay_GetFragmentLightivSGIX,
+   _gldReplay_GetFragmentMaterialfvSGIX,
+   _gldReplay_GetFragmentMaterialivSGIX,
+   _gldReplay_LightEnviSGIX,
+   _gldReplay_VertexWeightfEXT,
+   _gldReplay_VertexWeightfvEXT,
+   _gldReplay_VertexWeightPointerEXT,
+   _gldReplay_FlushVertexArrayRangeNV,
+   _gldReplay_VertexArrayRangeNV,
+   _gldReplay_CombinerParameterfvNV,
+   _gldReplay_CombinerParameterfNV,
+   _gldReplay_CombinerParameterivNV,
+   _gldReplay_CombinerParameteriNV,
+   _gldReplay_CombinerInputNV,
+   _gldReplay_CombinerOutputNV,
+   _gldReplay_FinalCombinerInputNV,
+   _gldReplay_GetCombinerInputParameterfvNV,
+   _gldReplay_GetCombinerInputParameterivNV,
+   _gldReplay_GetCombinerOutputParameterfvNV,
+   _gldReplay_GetCombinerOutputParameterivNV,
+   _gldReplay_GetFinalCombinerInputParameterfvNV,
+   _gldReplay_GetFinalCombinerInputParameterivNV,
+   _gldReplay_ResizeBuffersMESA,
+   _gldReplay_WindowPos2dMESA,
+   _gldReplay_WindowPos2dvMESA,
+   _gldReplay_WindowPos2fMESA,
+   _gldReplay_WindowPos2fvMESA,
+   _gldReplay_WindowPos2iMESA,
+   _gldReplay_WindowPos2ivMESA,
+   _gldReplay_WindowPos2sMESA,
+   _gldReplay_WindowPos2svMESA,
+   _gldReplay_WindowPos3dMESA,
+   _gldReplay_WindowPos3dvMESA,
+   _gldReplay_WindowPos3fMESA,
+   _gldReplay_WindowPos3fvMESA,
+   _gldReplay_WindowPos3iMESA,
+   _gldReplay_WindowPos3ivMESA,
+   _gldReplay_WindowPos3sMESA,
+   _gldReplay_WindowPos3svMESA,
+   _gldReplay_WindowPos4dMESA,
+   _gldReplay_WindowPos4dvMESA,
+   _gldReplay_WindowPos4fMESA,
+   _gldReplay_WindowPos4fvMESA,
+   _gldReplay_WindowPos4iMESA,
+   _gldReplay_WindowPos4ivMESA,
+   _gldReplay_WindowPos4sMESA,
+   _gldReplay_WindowPos4svMESA,
+   _gldReplay_BlendFuncSeparateEXT,
+   _gldReplay_IndexMaterialEXT,
+   _gldReplay_IndexFuncEXT,
+   _gldReplay_LockArraysEXT,
+   _gldReplay_UnlockArraysEXT,
+   _gldReplay_CullParameterdvEXT,
+   _gldReplay_CullParameterfvEXT,
+   _gldReplay_HintPGI,
+   _gldReplay_FogCoordfEXT,
+   _gldReplay_FogCoordfvEXT,
+   _gldReplay_FogCoorddEXT,
+   _gldReplay_FogCoorddvEXT,
+   _gldReplay_FogCoordPointerEXT,
+   _gldReplay_GetColorTableEXT,
+   _gldReplay_GetColorTableParameterivEXT,
+   _gldReplay_GetColorTableParameterfvEXT,
+   _gldReplay_TbufferMask3DFX,
+   _gldReplay_CompressedTexImage3DARB,
+   _gldReplay_CompressedTexImage2DARB,
+   _gldReplay_CompressedTexImage1DARB,
+   _gldReplay_CompressedTexSubImage3DARB,
+   _gldReplay_CompressedTexSubImage2DARB,
+   _gldReplay_CompressedTexSubImage1DARB,
+   _gldReplay_GetCompressedTexImageARB,
+   _gldReplay_SecondaryColor3bEXT,
+   _gldReplay_SecondaryColor3bvEXT,
+   _gldReplay_SecondaryColor3dEXT,
+   _gldReplay_SecondaryColor3dvEXT,
+   _gldReplay_SecondaryColor3fEXT,
+   _gldReplay_SecondaryColor3fvEXT,
+   _gldReplay_SecondaryColor3iEXT,
+   _gldReplay_SecondaryColor3ivEXT,
+   _gldReplay_SecondaryColor3sEXT,
+   _gldReplay_SecondaryColor3svEXT,
+   _gldReplay_SecondaryColor3ubEXT,
+   _gldReplay_SecondaryColor3ubvEXT,
+   _gldReplay_SecondaryColor3uiEXT,
+   _gldReplay_SecondaryColor3uivEXT,
+   _gldReplay_SecondaryColor3usEXT,
+   _gldReplay_SecondaryColor3usvEXT,
+   _gldReplay_SecondaryColorPointerEXT,
+   _gldReplay_AreProgramsResidentNV,
+   _gldReplay_BindProgramNV,
+   _gldReplay_DeleteProgramsNV,
+   _gldReplay_ExecuteProgramNV,
+   _gldReplay_GenProgramsNV,
+   _gldReplay_GetProgramParameterdvNV,
+   _gldReplay_GetProgramParameterfvNV,
+   _gldReplay_GetProgramivNV,
+   _gldReplay_GetProgramStringNV,
+   _gldReplay_GetTrackMatrixivNV,
+   _gldReplay_GetVertexAttribdvNV,
+   _gldReplay_GetVertexAttribfvNV,
+   _gldReplay_GetVertexAttribivNV,
+   _gldReplay_GetVertexAttribPointervNV,
+   _gldReplay_IsProgramNV,
+   _gldReplay_LoadProgramNV,
+   _gldReplay_ProgramParameter4dNV,
+   _gldReplay_ProgramParameter4dvNV,
+   _gldReplay_ProgramParameter4fNV,
+   _gldReplay_ProgramParameter4fvNV,
+   _gldReplay_ProgramParameters4dvNV,
+   _gldReplay_ProgramParameters4fvNV,
+   _gldReplay_RequestResidentProgramsNV,
+   _gldReplay_TrackMatrixNV,
+   _gldReplay_VertexAttribPointerNV,
+   _gldReplay_VertexAttrib1dNV,
+   _gldReplay_VertexAttrib1dvNV,
+   _gldReplay_VertexAttrib1fNV,
+   _gldReplay_VertexAttrib1fvNV,
+   _gldReplay_VertexAttrib1sNV,
+   _gldReplay_VertexAttrib1svNV,
+   _gldReplay_VertexAttrib2dNV,
+   _gldReplay_VertexAttrib2dvNV,
+   _gldReplay_VertexAttrib2fNV,
+   _gldReplay_VertexAttrib2fvNV,
+   _gldReplay_VertexAttrib2sNV,
+   _gldReplay_VertexAttrib2svNV,
+   _gldReplay_VertexAttrib3dNV,
+   _gldReplay_VertexAttrib3dvNV,
+   _gldReplay_VertexAttrib3fNV,
+   _gldReplay_VertexAttrib3fvNV,
+   _gldReplay_VertexAttrib3sNV,
+   _gldReplay_VertexAttrib3svNV,
+   _gldReplay_VertexAttrib4dNV,
+   _gldReplay_VertexAttrib4dvNV,
+   _gldReplay_VertexAttrib4fNV,
+   _gldReplay_VertexAttrib4fvNV,
+   _gldReplay_VertexAttrib4sNV,
+   _gldReplay_VertexAttrib4svNV,
+   _gldReplay_VertexAttrib4ubNV,
+   _gldReplay_VertexAttrib4ubvNV,
+   _gldReplay_VertexAttribs1dvNV,
+   _gldReplay_VertexAttribs1fvNV,
+   _gldReplay_VertexAttribs1svNV,
+   _gldReplay_VertexAttribs2dvNV,
+   _gldReplay_VertexAttribs2fvNV,
+   _gldReplay_VertexAttribs2svNV,
+   _gldReplay_VertexAttribs3dvNV,
+   _gldReplay_VertexAttribs3fvNV,
+   _gldReplay_VertexAttribs3svNV,
+   _gldReplay_VertexAttribs4dvNV,
+   _gldReplay_VertexAttribs4fvNV,
+   _gldReplay_VertexAttribs4svNV,
+   _gldReplay_VertexAttribs4ubvNV,
+   _gldReplay_PointParameteriNV,
+   _gldReplay_PointParameterivNV,
+   _gldReplay_MultiDrawArraysEXT,
+   _gldReplay_MultiDrawElementsEXT,
+   _gldReplay_ActiveStencilFaceEXT,
+   _gldReplay_DeleteFencesNV,
+   _gldReplay_GenFencesNV,
+   _gldReplay_IsFenceNV,
+   _gldReplay_TestFenceNV,
+   _gldReplay_GetFenceivNV,
+   _gldReplay_FinishFenceNV,
+   _gldReplay_SetFenceNV,
+   _gldReplay_VertexAttrib4bvARB,
+   _gldReplay_VertexAttrib4ivARB,
+   _gldReplay_VertexAttrib4ubvARB,
+   _gldReplay_VertexAttrib4usvARB,
+   _gldReplay_VertexAttrib4uivARB,
+   _gldReplay_VertexAttrib4NbvARB,
+   _gldReplay_VertexAttrib4NsvARB,
+   _gldReplay_VertexAttrib4NivARB,
+   _gldReplay_VertexAttrib4NusvARB,
+   _gldReplay_VertexAttrib4NuivARB,
+   _gldReplay_VertexAttribPointerARB,
+   _gldReplay_EnableVertexAttribArrayARB,
+   _gldReplay_DisableVertexAttribArrayARB,
+   _gldReplay_ProgramStringARB,
+   _gldReplay_ProgramEnvParameter4dARB,
+   _gldReplay_ProgramEnvParameter4dvARB,
+   _gldReplay_ProgramEnvParameter4fARB,
+   _gldReplay_ProgramEnvParameter4fvARB,
+   _gldReplay_ProgramLocalParameter4dARB,
+   _gldReplay_ProgramLocalParameter4dvARB,
+   _gldReplay_ProgramLocalParameter4fARB,
+   _gldReplay_ProgramLocalParameter4fvARB,
+   _gldReplay_GetProgramEnvParameterdvARB,
+   _gldReplay_GetProgramEnvParameterfvARB,
+   _gldReplay_GetProgramLocalParameterdvARB,
+   _gldReplay_GetProgramLocalParameterfvARB,
+   _gldReplay_GetProgramivARB,
+   _gldReplay_GetProgramStringARB,
+   _gldReplay_ProgramNamedParameter4fNV,
+   _gldReplay_ProgramNamedParameter4dNV,
+   _gldReplay_ProgramNamedParameter4fvNV,
+   _gldReplay_ProgramNamedParameter4dvNV,
+   _gldReplay_GetProgramNamedParameterfvNV,
+   _gldReplay_GetProgramNamedParameterdvNV,
+   _gldReplay_BindBufferARB,
+   _gldReplay_BufferDataARB,
+   _gldReplay_BufferSubDataARB,
+   _gldReplay_DeleteBuffersARB,
+   _gldReplay_GenBuffersARB,
+   _gldReplay_GetBufferParameterivARB,
+   _gldReplay_GetBufferPointervARB,
+   _gldReplay_GetBufferSubDataARB,
+   _gldReplay_IsBufferARB,
+   _gldReplay_MapBufferARB,
+   _gldReplay_UnmapBufferARB,
+   _gldReplay_DepthBoundsEXT,
+   _gldReplay_GenQueriesARB,
+   _gldReplay_DeleteQueriesARB,
+   _gldReplay_IsQueryARB,
+   _gldReplay_BeginQueryARB,
+   _gldReplay_EndQueryARB,
+   _gldReplay_GetQueryivARB,
+   _gldReplay_GetQueryObjectivARB,
+   _gldReplay_GetQueryObjectuivARB,
+   _gldReplay_MultiModeDrawArraysIBM,
+   _gldReplay_MultiModeDrawElementsIBM,
+};
+
+static const char *const _gldTraceNames[GLD_TRACE_SLOTS] = {
+   "glNewList",
+   "glEndList",
+   "glCallList",
+   "glCallLists",
+   "glDeleteLists",
+   "glGenLists",
+   "glListBase",
+   "glBegin",
+   "glBitmap",
+   "glColor3b",
+   "glColor3bv",
+   "glColor3d",
+   "glColor3dv",
+   "glColor3f",
+   "glColor3fv",
+   "glColor3i",
+   "glColor3iv",
+   "glColor3s",
+   "glColor3sv",
+   "glColor3ub",
+   "glColor3ubv",
+   "glColor3ui",
+   "glColor3uiv",
+   "glColor3us",
+   "glColor3usv",
+   "glColor4b",
+   "glColor4bv",
+   "glColor4d",
+   "glColor4dv",
+   "glColor4f",
+   "glColor4fv",
+   "glColor4i",
+   "glColor4iv",
+   "glColor4s",
+   "glColor4sv",
+   "glColor4ub",
+   "glColor4ubv",
+   "glColor4ui",
+   "glColor4uiv",
+   "glColor4us",
+   "glColor4usv",
+   "glEdgeFlag",
+   "glEdgeFlagv",
+   "glEnd",
+   "glIndexd",
+   "glIndexdv",
+   "glIndexf",
+   "glIndexfv",
+   "glIndexi",
+   "glIndexiv",
+   "glIndexs",
+   "glIndexsv",
+   "glNormal3b",
+   "glNormal3bv",
+   "glNormal3d",
+   "glNormal3dv",
+   "glNormal3f",
+   "glNormal3fv",
+   "glNormal3i",
+   "glNormal3iv",
+   "glNormal3s",
+   "glNormal3sv",
+   "glRasterPos2d",
+   "glRasterPos2dv",
+   "glRasterPos2f",
+   "glRasterPos2fv",
+   "glRasterPos2i",
+   "glRasterPos2iv",
+   "glRasterPos2s",
+   "glRasterPos2sv",
+   "glRasterPos3d",
+   "glRasterPos3dv",
+   "glRasterPos3f",
+   "glRasterPos3fv",
+   "glRasterPos3i",
+   "glRasterPos3iv",
+   "glRasterPos3s",
+   "glRasterPos3sv",
+   "glRasterPos4d",
+   "glRasterPos4dv",
+   "glRasterPos4f",
+   "glRasterPos4fv",
+   "glRasterPos4i",
+   "glRasterPos4iv",
+   "glRasterPos4s",
+   "glRasterPos4sv",
+   "glRectd",
+   "glRectdv",
+   "glRectf",
+   "glRectfv",
+   "glRecti",
+   "glRectiv",
+   "glRects",
+   "glRectsv",
+   "glTexCoord1d",
+   "glTexCoord1dv",
+   "glTexCoord1f",
+   "glTexCoord1fv",
+   "glTexCoord1i",
+   "glTexCoord1iv",
+   "glTexCoord1s",
+   "glTexCoord1sv",
+   "glTexCoord2d",
+   "glTexCoord2dv",
+   "glTexCoord2f",
+   "glTexCoord2fv",
+   "glTexCoord2i",
+   "glTexCoord2iv",
+   "glTexCoord2s",
+   "glTexCoord2sv",
+   "glTexCoord3d",
+   "glTexCoord3dv",
+   "glTexCoord3f",
+   "glTexCoord3fv",
+   "glTexCoord3i",
+   "glTexCoord3iv",
+   "glTexCoord3s",
+   "glTexCoord3sv",
+   "glTexCoord4d",
+   "glTexCoord4dv",
+   "glTexCoord4f",
+   "glTexCoord4fv",
+   "glTexCoord4i",
+   "glTexCoord4iv",
+   "glTexCoord4s",
+   "glTexCoord4sv",
+   "glVertex2d",
+   "glVertex2dv",
+   "glVertex2f",
+   "glVertex2fv",
+   "glVertex2i",
+   "glVertex2iv",
+   "glVertex2s",
+   "glVertex2sv",
+   "glVertex3d",
+   "glVertex3dv",
+   "glVertex3f",
+   "glVertex3fv",
+   "glVertex3i",
+   "glVertex3iv",
+   "glVertex3s",
+   "glVertex3sv",
+   "glVertex4d",
+   "glVertex4dv",
+   "glVertex4f",
+   "glVertex4fv",
+   "glVertex4i",
+   "glVertex4iv",
+   "glVertex4s",
+   "glVertex4sv",
+   "glClipPlane",
+   "glColorMaterial",
+   "glCullFace",
+   "glFogf",
+   "glFogfv",
+   "glFogi",
+   "glFogiv",
+   "glFrontFace",
+   "glHint",
+   "glLightf",
+   "glLightfv",
+   "glLighti",
+   "glLightiv",
+   "glLightModelf",
+   "glLightModelfv",
+   "glLightModeli",
+   "glLightModeliv",
+   "glLineStipple",
+   "glLineWidth",
+   "glMaterialf",
+   "glMaterialfv",
+   "glMateriali",
+   "glMaterialiv",
+   "glPointSize",
+   "glPolygonMode",
+   "glPolygonStipple",
+   "glScissor",
+   "glShadeModel",
+   "glTexParameterf",
+   "glTexParameterfv",
+   "glTexParameteri",
+   "glTexParameteriv",
+   "glTexImage1D",
+   "glTexImage2D",
+   "glTexEnvf",
+   "glTexEnvfv",
+   "glTexEnvi",
+   "glTexEnviv",
+   "glTexGend",
+   "glTexGendv",
+   "glTexGenf",
+   "glTexGenfv",
+   "glTexGeni",
+   "glTexGeniv",
+   "glFeedbackBuffer",
+   "glSelectBuffer",
+   "glRenderMode",
+   "glInitNames",
+   "glLoadName",
+   "glPassThrough",
+   "glPopName",
+   "glPushName",
+   "glDrawBuffer",
+   "glClear",
+   "glClearAccum",
+   "glClearIndex",
+   "glClearColor",
+   "glClearStencil",
+   "glClearDepth",
+   "glStencilMask",
+   "glColorMask",
+   "glDepthMask",
+   "glIndexMask",
+   "glAccum",
+   "glDisable",
+   "glEnable",
+   "glFinish",
+   "glFlush",
+   "glPopAttrib",
+   "glPushAttrib",
+   "glMap1d",
+   "glMap1f",
+   "glMap2d",
+   "glMap2f",
+   "glMapGrid1d",
+   "glMapGrid1f",
+   "glMapGrid2d",
+   "glMapGrid2f",
+   "glEvalCoord1d",
+   "glEvalCoord1dv",
+   "glEvalCoord1f",
+   "glEvalCoord1fv",
+   "glEvalCoord2d",
+   "glEvalCoord2dv",
+   "glEvalCoord2f",
+   "glEvalCoord2fv",
+   "glEvalMesh1",
+   "glEvalPoint1",
+   "glEvalMesh2",
+   "glEvalPoint2",
+   "glAlphaFunc",
+   "glBlendFunc",
+   "glLogicOp",
+   "glStencilFunc",
+   "glStencilOp",
+   "glDepthFunc",
+   "glPixelZoom",
+   "glPixelTransferf",
+   "glPixelTransferi",
+   "glPixelStoref",
+   "glPixelStorei",
+   "glPixelMapfv",
+   "glPixelMapuiv",
+   "glPixelMapusv",
+   "glReadBuffer",
+   "glCopyPixels",
+   "glReadPixels",
+   "glDrawPixels",
+   "glGetBooleanv",
+   "glGetClipPlane",
+   "glGetDoublev",
+   "glGetError",
+   "glGetFloatv",
+   "glGetIntegerv",
+   "glGetLightfv",
+   "glGetLightiv",
+   "glGetMapdv",
+   "glGetMapfv",
+   "glGetMapiv",
+   "glGetMaterialfv",
+   "glGetMaterialiv",
+   "glGetPixelMapfv",
+   "glGetPixelMapuiv",
+   "glGetPixelMapusv",
+   "glGetPolygonStipple",
+   "glGetString",
+   "glGetTexEnvfv",
+   "glGetTexEnviv",
+   "glGetTexGendv",
+   "glGetTexGenfv",
+   "glGetTexGeniv",
+   "glGetTexImage",
+   "glGetTexParameterfv",
+   "glGetTexParameteriv",
+   "glGetTexLevelParameterfv",
+   "glGetTexLevelParameteriv",
+   "glIsEnabled",
+   "glIsList",
+   "glDepthRange",
+   "glFrustum",
+   "glLoadIdentity",
+   "glLoadMatrixf",
+   "glLoadMatrixd",
+   "glMatrixMode",
+   "glMultMatrixf",
+   "glMultMatrixd",
+   "glOrtho",
+   "glPopMatrix",
+   "glPushMatrix",
+   "glRotated",
+   "glRotatef",
+   "glScaled",
+   "glScalef",
+   "glTranslated",
+   "glTranslatef",
+   "glViewport",
+   "glArrayElement",
+   "glBindTexture",
+   "glColorPointer",
+   "glDisableClientState",
+   "glDrawArrays",
+   "glDrawElements",
+   "glEdgeFlagPointer",
+   "glEnableClientState",
+   "glIndexPointer",
+   "glIndexub",
+   "glIndexubv",
+   "glInterleavedArrays",
+   "glNormalPointer",
+   "glPolygonOffset",
+   "glTexCoordPointer",
+   "glVertexPointer",
+   "glAreTexturesResident",
+   "glCopyTexImage1D",
+   "glCopyTexImage2D",
+   "glCopyTexSubImage1D",
+   "glCopyTexSubImage2D",
+   "glDeleteTextures",
+   "glGenTextures",
+   "glGetPointerv",
+   "glIsTexture",
+   "glPrioritizeTextures",
+   "glTexSubImage1D",
+   "glTexSubImage2D",
+   "glPopClientAttrib",
+   "glPushClientAttrib",
+   "glBlendColor",
+   "glBlendEquation",
+   "glDrawRangeElements",
+   "glColorTable",
+   "glColorTableParameterfv",
+   "glColorTableParameteriv",
+   "glCopyColorTable",
+   "glGetColorTable",
+   "glGetColorTableParameterfv",
+   "glGetColorTableParameteriv",
+   "glColorSubTable",
+   "glCopyColorSubTable",
+   "glConvolutionFilter1D",
+   "glConvolutionFilter2D",
+   "glConvolutionParameterf",
+   "glConvolutionParameterfv",
+   "glConvolutionParameteri",
+   "glConvolutionParameteriv",
+   "glCopyConvolutionFilter1D",
+   "glCopyConvolutionFilter2D",
+   "glGetConvolutionFilter",
+   "glGetConvolutionParameterfv",
+   "glGetConvolutionParameteriv",
+   "glGetSeparableFilter",
+   "glSeparableFilter2D",
+   "glGetHistogram",
+   "glGetHistogramParameterfv",
+   "glGetHistogramParameteriv",
+   "glGetMinmax",
+   "glGetMinmaxParameterfv",
+   "glGetMinmaxParameteriv",
+   "glHistogram",
+   "glMinmax",
+   "glResetHistogram",
+   "glResetMinmax",
+   "glTexImage3D",
+   "glTexSubImage3D",
+   "glCopyTexSubImage3D",
+   "glActiveTextureARB",
+   "glClientActiveTextureARB",
+   "glMultiTexCoord1dARB",
+   "glMultiTexCoord1dvARB",
+   "glMultiTexCoord1fARB",
+   "glMultiTexCoord1fvARB",
+   "glMultiTexCoord1iARB",
+   "glMultiTexCoord1ivARB",
+   "glMultiTexCoord1sARB",
+   "glMultiTexCoord1svARB",
+   "glMultiTexCoord2dARB",
+   "glMultiTexCoord2dvARB",
+   "glMultiTexCoord2fARB",
+   "glMultiTexCoord2fvARB",
+   "glMultiTexCoord2iARB",
+   "glMultiTexCoord2ivARB",
+   "glMultiTexCoord2sARB",
+   "glMultiTexCoord2svARB",
+   "glMultiTexCoord3dARB",
+   "glMultiTexCoord3dvARB",
+   "glMultiTexCoord3fARB",
+   "glMultiTexCoord3fvARB",
+   "glMultiTexCoord3iARB",
+   "glMultiTexCoord3ivARB",
+   "glMultiTexCoord3sARB",
+   "glMultiTexCoord3svARB",
+   "glMultiTexCoord4dARB",
+   "glMultiTexCoord4dvARB",
+   "glMultiTexCoord4fARB",
+   "glMultiTexCoord4fvARB",
+   "glMultiTexCoord4iARB",
+   "glMultiTexCoord4ivARB",
+   "glMultiTexCoord4sARB",
+   "glMultiTexCoord4svARB",
+   "glLoadTransposeMatrixfARB",
+   "glLoadTransposeMatrixdARB",
+   "glMultTransposeMatrixfARB",
+   "glMultTransposeMatrixdARB",
+   "glSampleCoverageARB",
+   "gl__unused413",
+   "glPolygonOffsetEXT",
+   "glGetTexFilterFuncSGIS",
+   "glTexFilterFuncSGIS",
+   "glGetHistogramEXT",
+   "glGetHistogramParameterfvEXT",
+   "glGetHistogramParameterivEXT",
+   "glGetMinmaxEXT",
+   "glGetMinmaxParameterfvEXT",
+   "glGetMinmaxParameterivEXT",
+   "glGetConvolutionFilterEXT",
+   "glGetConvolutionParameterfvEXT",
+   "glGetConvolutionParameterivEXT",
+   "glGetSeparableFilterEXT",
+   "glGetColorTableSGI",
+   "glGetColorTableParameterfvSGI",
+   "glGetColorTableParameterivSGI",
+   "glPixelTexGenSGIX",
+   "glPixelTexGenParameteriSGIS",
+   "glPixelTexGenParameterivSGIS",
+   "glPixelTexGenParameterfSGIS",
+   "glPixelTexGenParameterfvSGIS",
+   "glGetPixelTexGenParameterivSGIS",
+   "glGetPixelTexGenParameterfvSGIS",
+   "glTexImage4DSGIS",
+   "glTexSubImage4DSGIS",
+   "glAreTexturesResidentEXT",
+   "glGenTexturesEXT",
+   "glIsTextureEXT",
+   "glDetailTexFuncSGIS",
+   "glGetDetailTexFuncSGIS",
+   "glSharpenTexFuncSGIS",
+   "glGetSharpenTexFuncSGIS",
+   "glSampleMaskSGIS",
+   "glSamplePatternSGIS",
+   "glColorPointerEXT",
+   "glEdgeFlagPointerEXT",
+   "glIndexPointerEXT",
+   "glNormalPointerEXT",
+   "glTexCoordPointerEXT",
+   "glVertexPointerEXT",
+   "glSpriteParameterfSGIX",
+   "glSpriteParameterfvSGIX",
+   "glSpriteParameteriSGIX",
+   "glSpriteParameterivSGIX",
+   "glPointParameterfEXT",
+   "glPointParameterfvEXT",
+   "glGetInstrumentsSGIX",
+   "glInstrumentsBufferSGIX",
+   "glPollInstrumentsSGIX",
+   "glReadInstrumentsSGIX",
+   "glStartInstrumentsSGIX",
+   "glStopInstrumentsSGIX",
+   "glFrameZoomSGIX",
+   "glTagSampleBufferSGIX",
+   "glReferencePlaneSGIX",
+   "glFlushRasterSGIX",
+   "glGetListParameterfvSGIX",
+   "glGetListParameterivSGIX",
+   "glListParameterfSGIX",
+   "glListParameterfvSGIX",
+   "glListParameteriSGIX",
+   "glListParameterivSGIX",
+   "glFragmentColorMaterialSGIX",
+   "glFragmentLightfSGIX",
+   "glFragmentLightfvSGIX",
+   "glFragmentLightiSGIX",
+   "glFragmentLightivSGIX",
+   "glFragmentLightModelfSGIX",
+   "glFragmentLightModelfvSGIX",
+   "glFragmentLightModeliSGIX",
+   "glFragmentLightModelivSGIX",
+   "glFragmentMaterialfSGIX",
+   "glFragmentMaterialfvSGIX",
+   "glFragmentMaterialiSGIX",
+   "glFragmentMaterialivSGIX",
+   "glGetFragmentLightfvSGIX",
+   "glGetFragmentLightivSGIX",
+   "glGetFragmentMaterialfvSGIX",
+   "glGetFragmentMaterialivSGIX",
+   "glLightEnviSGIX",
+   "glVertexWeightfEXT",
+   "glVertexWeightfvEXT",
+   "glVertexWeightPointerEXT",
+   "glFlushVertexArrayRangeNV",
+   "glVertexArrayRangeNV",
+   "glCombinerParameterfvNV",
+   "glCombinerParameterfNV",
+   "glCombinerParameterivNV",
+   "glCombinerParameteriNV",
+   "glCombinerInputNV",
+   "glCombinerOutputNV",
+   "glFinalCombinerInputNV",
+   "glGetCombinerInputParameterfvNV",
+   "glGetCombinerInputParameterivNV",
+   "glGetCombinerOutputParameterfvNV",
+   "glGetCombinerOutputParameterivNV",
+   "glGetFinalCombinerInputParameterfvNV",
+   "glGetFinalCombinerInputParameterivNV",
+   "glResizeBuffersMESA",
+   "glWindowPos2dMESA",
+   "glWindowPos2dvMESA",
+   "glWindowPos2fMESA",
+   "glWindowPos2fvMESA",
+   "glWindowPos2iMESA",
+   "glWindowPos2ivMESA",
+   "glWindowPos2sMESA",
+   "glWindowPos2svMESA",
+   "glWindowPos3dMESA",
+   "glWindowPos3dvMESA",
+   "glWindowPos3fMESA",
+   "glWindowPos3fvMESA",
+   "glWindowPos3iMESA",
+   "glWindowPos3ivMESA",
+   "glWindowPos3sMESA",
+   "glWindowPos3svMESA",
+   "glWindowPos4dMESA",
+   "glWindowPos4dvMESA",
+   "glWindowPos4fMESA",
+   "glWindowPos4fvMESA",
+   "glWindowPos4iMESA",
+   "glWindowPos4ivMESA",
+   "glWindowPos4sMESA",
+   "glWindowPos4svMESA",
+   "glBlendFuncSeparateEXT",
+   "glIndexMaterialEXT",
+   "glIndexFuncEXT",
+   "glLockArraysEXT",
+   "glUnlockArraysEXT",
+   "glCullParameterdvEXT",
+   "glCullParameterfvEXT",
+   "glHintPGI",
+   "glFogCoordfEXT",
+   "glFogCoordfvEXT",
+   "glFogCoorddEXT",
+   "glFogCoorddvEXT",
+   "glFogCoordPointerEXT",
+   "glGetColorTableEXT",
+   "glGetColorTableParameterivEXT",
+   "glGetColorTableParameterfvEXT",
+   "glTbufferMask3DFX",
+   "glCompressedTexImage3DARB",
+   "glCompressedTexImage2DARB",
+   "glCompressedTexImage1DARB",
+   "glCompressedTexSubImage3DARB",
+   "glCompressedTexSubImage2DARB",
+   "glCompressedTexSubImage1DARB",
+   "glGetCompressedTexImageARB",
+   "glSecondaryColor3bEXT",
+   "glSecondaryColor3bvEXT",
+   "glSecondaryColor3dEXT",
+   "glSecondaryColor3dvEXT",
+   "glSecondaryColor3fEXT",
+   "glSecondaryColor3fvEXT",
+   "glSecondaryColor3iEXT",
+   "glSecondaryColor3ivEXT",
+   "glSecondaryColor3sEXT",
+   "glSecondaryColor3svEXT",
+   "glSecondaryColor3ubEXT",
+   "glSecondaryColor3ubvEXT",
+   "glSecondaryColor3uiEXT",
+   "glSecondaryColor3uivEXT",
+   "glSecondaryColor3usEXT",
+   "glSecondaryColor3usvEXT",
+   "glSecondaryColorPointerEXT",
+   "glAreProgramsResidentNV",
+   "glBindProgramNV",
+   "glDeleteProgramsNV",
+   "glExecuteProgramNV",
+   "glGenProgramsNV",
+   "glGetProgramParameterdvNV",
+   "glGetProgramParameterfvNV",
+   "glGetProgramivNV",
+   "glGetProgramStringNV",
+   "glGetTrackMatrixivNV",
+   "glGetVertexAttribdvNV",
+   "glGetVertexAttribfvNV",
+   "glGetVertexAttribivNV",
+   "glGetVertexAttribPointervNV",
+   "glIsProgramNV",
+   "glLoadProgramNV",
+   "glProgramParameter4dNV",
+   "glProgramParameter4dvNV",
+   "glProgramParameter4fNV",
+   "glProgramParameter4fvNV",
+   "glProgramParameters4dvNV",
+   "glProgramParameters4fvNV",
+   "glRequestResidentProgramsNV",
+   "glTrackMatrixNV",
+   "glVertexAttribPointerNV",
+   "glVertexAttrib1dNV",
+   "glVertexAttrib1dvNV",
+   "glVertexAttrib1fNV",
+   "glVertexAttrib1fvNV",
+   "glVertexAttrib1sNV",
+   "glVertexAttrib1svNV",
+   "glVertexAttrib2dNV",
+   "glVertexAttrib2dvNV",
+   "glVertexAttrib2fNV",
+   "glVertexAttrib2fvNV",
+   "glVertexAttrib2sNV",
+   "glVertexAttrib2svNV",
+   "glVertexAttrib3dNV",
+   "glVertexAttrib3dvNV",
+   "glVertexAttrib3fNV",
+   "glVertexAttrib3fvNV",
+   "glVertexAttrib3sNV",
+   "glVertexAttrib3svNV",
+   "glVertexAttrib4dNV",
+   "glVertexAttrib4dvNV",
+   "glVertexAttrib4fNV",
+   "glVertexAttrib4fvNV",
+   "glVertexAttrib4sNV",
+   "glVertexAttrib4svNV",
+   "glVertexAttrib4ubNV",
+   "glVertexAttrib4ubvNV",
+   "glVertexAttribs1dvNV",
+   "glVertexAttribs1fvNV",
+   "glVertexAttribs1svNV",
+   "glVertexAttribs2dvNV",
+   "glVertexAttribs2fvNV",
+   "glVertexAttribs2svNV",
+   "glVertexAttribs3dvNV",
+   "glVertexAttribs3fvNV",
+   "glVertexAttribs3svNV",
+   "glVertexAttribs4dvNV",
+   "glVertexAttribs4fvNV",
+   "glVertexAttribs4svNV",
+   "glVertexAttribs4ubvNV",
+   "glPointParameteriNV",
+   "glPointParameterivNV",
+   "glMultiDrawArraysEXT",
+   "glMultiDrawElementsEXT",
+   "glActiveStencilFaceEXT",
+   "glDeleteFencesNV",
+   "glGenFencesNV",
+   "glIsFenceNV",
+   "glTestFenceNV",
+   "glGetFenceivNV",
+   "glFinishFenceNV",
+   "glSetFenceNV",
+   "glVertexAttrib4bvARB",
+   "glVertexAttrib4ivARB",
+   "glVertexAttrib4ubvARB",
+   "glVertexAttrib4usvARB",
+   "glVertexAttrib4uivARB",
+   "glVertexAttrib4NbvARB",
+   "glVertexAttrib4NsvARB",
+   "glVertexAttrib4NivARB",
+   "glVertexAttrib4NusvARB",
+   "glVertexAttrib4NuivARB",
+   "glVertexAttribPointerARB",
+   "glEnableVertexAttribArrayARB",
+   "glDisableVertexAttribArrayARB",
+   "glProgramStringARB",
+   "glProgramEnvParameter4dARB",
+   "glProgramEnvParameter4dvARB",
+   "glProgramEnvParameter4fARB",
+   "glProgramEnvParameter4fvARB",
+   "glProgramLocalParameter4dARB",
+   "glProgramLocalParameter4dvARB",
+   "glProgramLocalParameter4fARB",
+   "glProgramLocalParameter4fvARB",
+   "glGetProgramEnvParameterdvARB",
+   "glGetProgramEnvParameterfvARB",
+   "glGetProgramLocalParameterdvARB",
+   "glGetProgramLocalParameterfvARB",
+   "glGetProgramivARB",
+   "glGetProgramStringARB",
+   "glProgramNamedParameter4fNV",
+   "glProgramNamedParameter4dNV",
+   "glProgramNamedParameter4fvNV",
+   "glProgramNamedParameter4dvNV",
+   "glGetProgramNamedParameterfvNV",
+   "glGetProgramNamedParameterdvNV",
+   "glBindBufferARB",
+   "glBufferDataARB",
+   "glBufferSubDataARB",
+   "glDeleteBuffersARB",
+   "glGenBuffersARB",
+   "glGetBufferParameterivARB",
+   "glGetBufferPointervARB",
+   "glGetBufferSubDataARB",
+   "glIsBufferARB",
+   "glMapBufferARB",
+   "glUnmapBufferARB",
+   "glDepthBoundsEXT",
+   "glGenQueriesARB",
+   "glDeleteQueriesARB",
+   "glIsQueryARB",
+   "glBeginQueryARB",
+   "glEndQueryARB",
+   "glGetQueryivARB",
+   "glGetQueryObjectivARB",
+   "glGetQueryObjectuivARB",
+   "glMultiModeDrawArraysIBM",
+   "glMultiModeDrawElementsIBM",
+};
+
+#endif /* GLD_TRACE_REPLAY */
@@ -46,7 +46,7 @@
 #define WIN32_LEAN_AND_MEAN
 
 #include <windows.h>
-#include <GL\gl.h>
+#include <GL/gl.h>
 
 #include "gld_context.h"
 #include "gld_globals.h"
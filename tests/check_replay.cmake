@@ -0,0 +1,19 @@
+# Runs gldreplay on a trace and fails unless every frame and call replayed.
+#
+# cmake -DREPLAY=<gldreplay> -DTRACE=<gldtrace.bin> -DFRAMES=<n> -P check_replay.cmake
+
+execute_process(COMMAND ${REPLAY} ${TRACE}
+	RESULT_VARIABLE result
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE output)
+message("${output}")
+
+if(NOT result EQUAL 0)
+	message(FATAL_ERROR "gldreplay returned ${result}")
+endif()
+if(NOT output MATCHES " ${FRAMES} frames, [0-9]+ calls \\(0 skipped, 0 missing from the backend\\)")
+	message(FATAL_ERROR "Expected ${FRAMES} frames with no skipped or missing calls")
+endif()
+if(NOT output MATCHES "ms/frame")
+	message(FATAL_ERROR "No timing reported")
+endif()
@@ -0,0 +1,43 @@
+# Runs texutil_bench with and without the SSE2 row kernels, fails unless
+# both produce the same texels, and reports the speedup.
+#
+# cmake -DBENCH=<texutil_bench> -P compare_texutil.cmake
+
+execute_process(COMMAND ${BENCH} RESULT_VARIABLE sse2_result OUTPUT_VARIABLE sse2)
+execute_process(COMMAND ${CMAKE_COMMAND} -E env MESA_NO_ASM=1 ${BENCH}
+	RESULT_VARIABLE c_result OUTPUT_VARIABLE c)
+
+if(NOT sse2_result EQUAL 0 OR NOT c_result EQUAL 0)
+	message(FATAL_ERROR "texutil_bench failed\n${sse2}\n${c}")
+endif()
+if(NOT sse2 MATCHES "SSE2 row kernels on" OR NOT c MATCHES "SSE2 row kernels off")
+	message(FATAL_ERROR "MESA_NO_ASM did not switch the SSE2 row kernels off\n${sse2}\n${c}")
+endif()
+
+string(REGEX MATCHALL "[^\n]+ Mtexel/s[^\n]+" sse2_lines "${sse2}")
+string(REGEX MATCHALL "[^\n]+ Mtexel/s[^\n]+" c_lines "${c}")
+list(LENGTH sse2_lines count)
+math(EXPR last "${count} - 1")
+set(report "Mtexel/s\ttemplate\tSSE2")
+set(failed FALSE)
+foreach(i RANGE ${last})
+	list(GET sse2_lines ${i} s)
+	list(GET c_lines ${i} t)
+	string(REGEX MATCH "^([^ ]+) +([^ ]+) +([0-9.]+) Mtexel/s +hash ([0-9a-f]+)" _ "${s}")
+	set(name "${CMAKE_MATCH_1} ${CMAKE_MATCH_2}")
+	set(s_rate ${CMAKE_MATCH_3})
+	set(s_hash ${CMAKE_MATCH_4})
+	string(REGEX MATCH "^([^ ]+) +([^ ]+) +([0-9.]+) Mtexel/s +hash ([0-9a-f]+)" _ "${t}")
+	set(t_rate ${CMAKE_MATCH_3})
+	set(t_hash ${CMAKE_MATCH_4})
+	string(APPEND report "\n${name}\t${t_rate}\t${s_rate}")
+	if(NOT s_hash STREQUAL t_hash)
+		string(APPEND report "\tMISMATCH")
+		set(failed TRUE)
+	endif()
+endforeach()
+message("${report}")
+
+if(failed)
+	message(FATAL_ERROR "The SSE2 row kernels and the template loops disagree")
+endif()
@@ -0,0 +1,237 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Headless capture test. Renders a few frames through the driver and the
+*               stand-in device with trace capture on, and checks what the device saw.
+*
+*********************************************************************************/
+
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <GL/gl.h>
+
+#include "gld_headless.h"
+#include "gld_test_window.h"
+
+// ***********************************************************************
+
+#define GLD_CAPTURE_FRAMES		8
+#define GLD_CAPTURE_WIDTH		320
+#define GLD_CAPTURE_HEIGHT		240
+#define GLD_CAPTURE_TEXSIZE		64
+
+// ***********************************************************************
+
+static GLuint _gldCaptureTexture(void)
+{
+	// A checker board, then a sub-image over one corner
+	static GLubyte	Texels[GLD_CAPTURE_TEXSIZE * GLD_CAPTURE_TEXSIZE * 4];
+	GLuint			uTex;
+	int				x, y;
+
+	for (y=0; y<GLD_CAPTURE_TEXSIZE; y++) {
+		for (x=0; x<GLD_CAPTURE_TEXSIZE; x++) {
+			GLubyte	c = ((x ^ y) & 8) ? 255 : 32;
+			Texels[(y * GLD_CAPTURE_TEXSIZE + x) * 4 + 0] = c;
+			Texels[(y * GLD_CAPTURE_TEXSIZE + x) * 4 + 1] = (GLubyte)(x * 4);
+			Texels[(y * GLD_CAPTURE_TEXSIZE + x) * 4 + 2] = (GLubyte)(y * 4);
+			Texels[(y * GLD_CAPTURE_TEXSIZE + x) * 4 + 3] = 255;
+		}
+	}
+	glGenTextures(1, &uTex);
+	glBindTexture(GL_TEXTURE_2D, uTex);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, GLD_CAPTURE_TEXSIZE, GLD_CAPTURE_TEXSIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, Texels);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 16, 16, GL_RGBA, GL_UNSIGNED_BYTE, Texels + GLD_CAPTURE_TEXSIZE * 4 * 8);
+	return uTex;
+}
+
+// ***********************************************************************
+
+static GLuint _gldCaptureList(void)
+{
+	// A lit fan, compiled once and called every frame
+	GLuint	uList = glGenLists(1);
+	int		i;
+
+	glNewList(uList, GL_COMPILE);
+	glBegin(GL_TRIANGLE_FAN);
+	glNormal3f(0.0f, 0.0f, 1.0f);
+	glVertex3f(0.0f, 0.0f, 0.0f);
+	for (i=0; i<=8; i++) {
+		float	a = i * 3.14159265f / 4.0f;
+		glColor3f(0.5f + 0.5f * (float)(i & 1), 0.25f, 1.0f - 0.1f * i);
+		glVertex3f((float)cos(a) * 0.3f, (float)sin(a) * 0.3f, 0.0f);
+	}
+	glEnd();
+	glEndList();
+	return uList;
+}
+
+// ***********************************************************************
+
+static void _gldCaptureFrame(
+	int iFrame,
+	GLuint uTex,
+	GLuint uList)
+{
+	static const GLfloat	Quad[] = {
+		-0.9f, -0.9f, 0.0f,		-0.5f, -0.9f, 0.0f,		-0.5f, -0.5f, 0.0f,		-0.9f, -0.5f, 0.0f,
+	};
+	static const GLubyte	QuadIndices[] = {0, 1, 2, 0, 2, 3};
+	static const GLfloat	LightPos[] = {0.0f, 0.0f, 1.0f, 0.0f};
+	float					t = iFrame * 0.1f;
+	int						i;
+
+	glClearColor(0.1f, 0.1f, 0.2f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	glOrtho(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	glMatrixMode(GL_MODELVIEW);
+	glLoadIdentity();
+	glEnable(GL_DEPTH_TEST);
+
+	// Immediate mode, one of each primitive
+	glBegin(GL_TRIANGLES);
+	glColor3f(1.0f, 0.0f, 0.0f);	glVertex2f(-0.9f + t * 0.1f, 0.5f);
+	glColor3f(0.0f, 1.0f, 0.0f);	glVertex2f(-0.6f, 0.5f);
+	glColor3f(0.0f, 0.0f, 1.0f);	glVertex2f(-0.75f, 0.9f);
+	glEnd();
+	glBegin(GL_QUADS);
+	glColor3f(1.0f, 1.0f, 0.0f);
+	glVertex2f(-0.4f, 0.5f);	glVertex2f(-0.1f, 0.5f);	glVertex2f(-0.1f, 0.9f);	glVertex2f(-0.4f, 0.9f);
+	glEnd();
+	glBegin(GL_TRIANGLE_STRIP);
+	for (i=0; i<6; i++) {
+		glColor3f(0.2f * i, 1.0f, 0.5f);
+		glVertex2f(0.0f + 0.1f * (i / 2), 0.5f + 0.3f * (i & 1));
+	}
+	glEnd();
+	glBegin(GL_LINES);
+	glColor3f(1.0f, 1.0f, 1.0f);
+	glVertex2f(0.4f, 0.5f);		glVertex2f(0.9f, 0.9f);
+	glVertex2f(0.4f, 0.9f);		glVertex2f(0.9f, 0.5f);
+	glEnd();
+	glBegin(GL_POLYGON);
+	glColor3f(0.0f, 1.0f, 1.0f);
+	for (i=0; i<5; i++)
+		glVertex2f(0.65f + 0.2f * (float)cos(i * 1.2566f + t), 0.0f + 0.2f * (float)sin(i * 1.2566f + t));
+	glEnd();
+
+	// Textured and fogged
+	glEnable(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, uTex);
+	glEnable(GL_FOG);
+	glFogi(GL_FOG_MODE, GL_LINEAR);
+	glBegin(GL_QUADS);
+	glColor3f(1.0f, 1.0f, 1.0f);
+	glTexCoord2f(0.0f, 0.0f);	glVertex3f(-0.4f, -0.4f, 0.5f);
+	glTexCoord2f(1.0f, 0.0f);	glVertex3f(0.2f, -0.4f, 0.5f);
+	glTexCoord2f(1.0f, 1.0f);	glVertex3f(0.2f, 0.2f, -0.5f);
+	glTexCoord2f(0.0f, 1.0f);	glVertex3f(-0.4f, 0.2f, -0.5f);
+	glEnd();
+	glDisable(GL_FOG);
+	glDisable(GL_TEXTURE_2D);
+
+	// A lit display list
+	glEnable(GL_LIGHTING);
+	glEnable(GL_LIGHT0);
+	glEnable(GL_COLOR_MATERIAL);
+	glLightfv(GL_LIGHT0, GL_POSITION, LightPos);
+	glPushMatrix();
+	glTranslatef(0.6f, -0.6f, 0.0f);
+	glRotatef(t * 45.0f, 0.0f, 0.0f, 1.0f);
+	glCallList(uList);
+	glPopMatrix();
+	glDisable(GL_LIGHTING);
+
+	// Vertex arrays
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glVertexPointer(3, GL_FLOAT, 0, Quad);
+	glColor3f(0.5f, 0.5f, 0.5f);
+	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, QuadIndices);
+	glDrawArrays(GL_LINE_LOOP, 0, 4);
+	glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+// ***********************************************************************
+
+int main(
+	int argc,
+	char *argv[])
+{
+	GLD_testWindow		w;
+	GLD_hlStats			Stats;
+	GLuint				uTex, uList;
+	int					i, iErrors = 0;
+
+	if (!gldTestCreateWindow(&w, "gldcapture", GLD_CAPTURE_WIDTH, GLD_CAPTURE_HEIGHT)) {
+		gldTestDestroyWindow(&w);
+		return 1;
+	}
+	gldHeadlessResetStats();
+
+	uTex	= _gldCaptureTexture();
+	uList	= _gldCaptureList();
+	for (i=0; i<GLD_CAPTURE_FRAMES; i++) {
+		_gldCaptureFrame(i, uTex, uList);
+		wglSwapBuffers(w.hDC);
+	}
+	glDeleteLists(uList, 1);
+	glDeleteTextures(1, &uTex);
+	if (glGetError() != GL_NO_ERROR) {
+		printf("GL error raised\n");
+		iErrors++;
+	}
+
+	gldTestDestroyWindow(&w);
+
+	// What the device saw, teardown included, has to be a valid frame sequence
+	gldHeadlessGetStats(&Stats);
+	gldHeadlessPrintStats(stdout);
+	if (Stats.dwErrors) {
+		printf("%u calls the debug runtime would reject\n", Stats.dwErrors);
+		iErrors++;
+	}
+	if (Stats.dwPresents != GLD_CAPTURE_FRAMES) {
+		printf("%u presents for %u frames\n", Stats.dwPresents, GLD_CAPTURE_FRAMES);
+		iErrors++;
+	}
+	if (Stats.dwDraws < GLD_CAPTURE_FRAMES) {
+		printf("Only %u draws\n", Stats.dwDraws);
+		iErrors++;
+	}
+
+	printf("%u frames captured, %s\n", GLD_CAPTURE_FRAMES, iErrors ? "FAILED" : "passed");
+	return iErrors ? 1 : 0;
+}
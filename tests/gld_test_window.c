@@ -0,0 +1,100 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Window and GL context for the headless driver tests.
+*
+*********************************************************************************/
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gld_test_window.h"
+
+// ***********************************************************************
+
+BOOL gldTestCreateWindow(
+	GLD_testWindow *w,
+	const char *pszName,
+	int iWidth,
+	int iHeight)
+{
+	PIXELFORMATDESCRIPTOR	pfd;
+	WNDCLASS				wc;
+	int						iPF;
+
+	memset(w, 0, sizeof(*w));
+	memset(&wc, 0, sizeof(wc));
+	wc.style			= CS_OWNDC;
+	wc.lpfnWndProc		= DefWindowProc;
+	wc.hInstance		= GetModuleHandle(NULL);
+	wc.lpszClassName	= pszName;
+	RegisterClass(&wc);
+	w->hWnd = CreateWindow(pszName, pszName, WS_OVERLAPPEDWINDOW | WS_VISIBLE,
+		CW_USEDEFAULT, CW_USEDEFAULT, iWidth, iHeight, NULL, NULL, wc.hInstance, NULL);
+	if (!w->hWnd)
+		return FALSE;
+	w->hDC = GetDC(w->hWnd);
+
+	memset(&pfd, 0, sizeof(pfd));
+	pfd.nSize		= sizeof(pfd);
+	pfd.nVersion	= 1;
+	pfd.dwFlags		= PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER;
+	pfd.iPixelType	= PFD_TYPE_RGBA;
+	pfd.cColorBits	= 32;
+	pfd.cDepthBits	= 24;
+	pfd.cStencilBits= 8;
+	iPF = wglChoosePixelFormat(w->hDC, &pfd);
+	if (!iPF || !wglSetPixelFormat(w->hDC, iPF, &pfd)) {
+		printf("No suitable pixel format\n");
+		return FALSE;
+	}
+	w->hRC = wglCreateContext(w->hDC);
+	if (!w->hRC || !wglMakeCurrent(w->hDC, w->hRC)) {
+		printf("Unable to create a GL context\n");
+		return FALSE;
+	}
+	return TRUE;
+}
+
+// ***********************************************************************
+
+void gldTestDestroyWindow(
+	GLD_testWindow *w)
+{
+	if (w->hRC) {
+		wglMakeCurrent(NULL, NULL);
+		wglDeleteContext(w->hRC);
+	}
+	if (w->hDC)
+		ReleaseDC(w->hWnd, w->hDC);
+	if (w->hWnd)
+		DestroyWindow(w->hWnd);
+	memset(w, 0, sizeof(*w));
+}
@@ -0,0 +1,53 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Window and GL context for the headless driver tests.
+*
+*********************************************************************************/
+
+#ifndef __GLD_TEST_WINDOW_H
+#define __GLD_TEST_WINDOW_H
+
+#include <windows.h>
+
+/*---------------------- Macros and type definitions ----------------------*/
+
+// A window with a current GL context, made the way an app would
+typedef struct {
+	HWND					hWnd;
+	HDC						hDC;
+	HGLRC					hRC;
+} GLD_testWindow;
+
+/*------------------------- Function Prototypes ---------------------------*/
+
+BOOL	gldTestCreateWindow(GLD_testWindow *w, const char *pszName, int iWidth, int iHeight);
+void	gldTestDestroyWindow(GLD_testWindow *w);
+
+#endif
@@ -0,0 +1,248 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Byte-level check of the dynamic vertex and index buffers. Draws each GL
+*               primitive type and checks the indices and vertex bytes the stand-in device
+*               was given for it.
+*
+*********************************************************************************/
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+#include <GL/gl.h>
+
+#include "gld_headless.h"
+#include "gld_test_window.h"
+
+// ***********************************************************************
+
+#define GLD_VTX_MAX_VERTS		8
+#define GLD_VTX_MAX_INDICES		24
+#define GLD_VTX_STRIDE			20		// Position and diffuse, the compact format with no normal or texcoords
+
+// A GL primitive, and the vertices the driver's index list must reference
+// in order. Vertex k is at a known position with a known colour.
+typedef struct {
+	const char			*pszName;
+	GLenum				Mode;
+	BOOL				bArrays;		// Drawn with glDrawElements rather than glBegin/glEnd
+	int					nVerts;
+	D3DPRIMITIVETYPE	D3DType;
+	int					Expect[GLD_VTX_MAX_INDICES + 1];	// -1 terminated
+} GLD_vtxCase;
+
+static const GLD_vtxCase gldVtxCases[] = {
+	{ "GL_POINTS",			GL_POINTS,			FALSE,	3,	D3DPT_POINTLIST,
+		{ 0, 1, 2, -1 } },
+	// Flatshaded lines take their colour from the first D3D vertex
+	{ "GL_LINES",			GL_LINES,			FALSE,	4,	D3DPT_LINELIST,
+		{ 1, 0,  3, 2, -1 } },
+	{ "GL_LINE_STRIP",		GL_LINE_STRIP,		FALSE,	4,	D3DPT_LINELIST,
+		{ 1, 0,  2, 1,  3, 2, -1 } },
+	{ "GL_LINE_LOOP",		GL_LINE_LOOP,		FALSE,	4,	D3DPT_LINELIST,
+		{ 1, 0,  2, 1,  3, 2,  3, 0, -1 } },
+	// Flatshaded triangles take their colour from the first D3D vertex
+	{ "GL_TRIANGLES",		GL_TRIANGLES,		FALSE,	6,	D3DPT_TRIANGLELIST,
+		{ 2, 0, 1,  5, 3, 4, -1 } },
+	{ "GL_TRIANGLE_STRIP",	GL_TRIANGLE_STRIP,	FALSE,	5,	D3DPT_TRIANGLELIST,
+		{ 2, 0, 1,  3, 2, 1,  4, 2, 3, -1 } },
+	{ "GL_TRIANGLE_FAN",	GL_TRIANGLE_FAN,	FALSE,	5,	D3DPT_TRIANGLELIST,
+		{ 2, 0, 1,  3, 0, 2,  4, 0, 3, -1 } },
+	{ "GL_QUADS",			GL_QUADS,			FALSE,	8,	D3DPT_TRIANGLELIST,
+		{ 3, 0, 1,  3, 1, 2,  7, 4, 5,  7, 5, 6, -1 } },
+	{ "GL_QUAD_STRIP",		GL_QUAD_STRIP,		FALSE,	6,	D3DPT_TRIANGLELIST,
+		{ 3, 2, 0,  3, 0, 1,  5, 4, 2,  5, 2, 3, -1 } },
+	// The polygon's colour comes from its first vertex, as GL flatshading wants
+	{ "GL_POLYGON",			GL_POLYGON,			FALSE,	5,	D3DPT_TRIANGLELIST,
+		{ 0, 1, 2,  0, 2, 3,  0, 3, 4, -1 } },
+	// Elements {3,1,0, 2,3,0}, reordered like GL_TRIANGLES then looked up
+	{ "glDrawElements",		GL_TRIANGLES,		TRUE,	4,	D3DPT_TRIANGLELIST,
+		{ 0, 3, 1,  0, 2, 3, -1 } },
+};
+
+#define GLD_VTX_CASES			(sizeof(gldVtxCases) / sizeof(gldVtxCases[0]))
+
+static const GLubyte gldVtxElements[] = { 3, 1, 0, 2, 3, 0 };
+
+// ***********************************************************************
+
+static void _gldVtxVertex(
+	int iCase,
+	int k,
+	GLfloat *pPos,
+	GLfloat *pColour)
+{
+	// Exactly representable, so the VB holds these bits unchanged
+	pPos[0]		= -0.5f + 0.125f * k;
+	pPos[1]		= -0.5f + 0.0625f * iCase;
+	pPos[2]		= 0.0f;
+	pPos[3]		= 1.0f;
+	pColour[0]	= (GLfloat)(k & 1);
+	pColour[1]	= (GLfloat)((k >> 1) & 1);
+	pColour[2]	= (GLfloat)((k >> 2) & 1);
+	pColour[3]	= 1.0f;
+}
+
+// ***********************************************************************
+
+static void _gldVtxDraw(
+	int iCase,
+	const GLD_vtxCase *c)
+{
+	GLfloat	Pos[GLD_VTX_MAX_VERTS][4];
+	GLfloat	Colour[GLD_VTX_MAX_VERTS][4];
+	int		k;
+
+	for (k=0; k<c->nVerts; k++)
+		_gldVtxVertex(iCase, k, Pos[k], Colour[k]);
+
+	if (c->bArrays) {
+		glEnableClientState(GL_VERTEX_ARRAY);
+		glEnableClientState(GL_COLOR_ARRAY);
+		glVertexPointer(4, GL_FLOAT, 0, Pos);
+		glColorPointer(4, GL_FLOAT, 0, Colour);
+		glDrawElements(c->Mode, sizeof(gldVtxElements), GL_UNSIGNED_BYTE, gldVtxElements);
+		glDisableClientState(GL_COLOR_ARRAY);
+		glDisableClientState(GL_VERTEX_ARRAY);
+	} else {
+		glBegin(c->Mode);
+		for (k=0; k<c->nVerts; k++) {
+			glColor4fv(Colour[k]);
+			glVertex4fv(Pos[k]);
+		}
+		glEnd();
+	}
+	// The driver batches primitives until something flushes them
+	glFinish();
+}
+
+// ***********************************************************************
+
+static int _gldVtxCheck(
+	int iCase,
+	const GLD_vtxCase *c)
+{
+	GLD_hlDraw		Draw;
+	const BYTE		*pVB, *pIB;
+	UINT			uVBSize, uIBSize, nIndices, i, v;
+	GLfloat			Pos[4], Colour[4];
+	D3DCOLOR		Diffuse;
+	WORD			wIndex;
+
+	if (!gldHeadlessGetLastDraw(&Draw)) {
+		printf("FAIL %s: nothing drawn\n", c->pszName);
+		return 1;
+	}
+	if (!Draw.bIndexed || Draw.bUP || !Draw.pIB || !Draw.pVB) {
+		printf("FAIL %s: not an indexed draw from the dynamic buffers\n", c->pszName);
+		return 1;
+	}
+	if (Draw.Type != c->D3DType || Draw.Stride != GLD_VTX_STRIDE) {
+		printf("FAIL %s: primitive type %d, stride %u\n", c->pszName, Draw.Type, Draw.Stride);
+		return 1;
+	}
+	for (nIndices=0; c->Expect[nIndices] >= 0; nIndices++)
+		;
+	v = (c->D3DType == D3DPT_TRIANGLELIST) ? 3 : (c->D3DType == D3DPT_LINELIST) ? 2 : 1;
+	if (Draw.PrimitiveCount * v != nIndices) {
+		printf("FAIL %s: %u primitives, expected %u\n", c->pszName, Draw.PrimitiveCount, nIndices / v);
+		return 1;
+	}
+
+	pVB = gldHeadlessVertexData(Draw.pVB, &uVBSize);
+	pIB = gldHeadlessIndexData(Draw.pIB, &uIBSize);
+	for (i=0; i<nIndices; i++) {
+		// Each index has to name the expected vertex, and the VB has to hold
+		// exactly that vertex's bytes
+		if ((Draw.Start + i + 1) * sizeof(WORD) > uIBSize) {
+			printf("FAIL %s: index %u is past the end of the IB\n", c->pszName, i);
+			return 1;
+		}
+		memcpy(&wIndex, pIB + (Draw.Start + i) * sizeof(WORD), sizeof(WORD));
+		if (wIndex < Draw.MinIndex || wIndex >= Draw.MinIndex + Draw.NumVertices) {
+			printf("FAIL %s: index %u is %u, outside [%u, %u)\n", c->pszName, i, wIndex,
+				Draw.MinIndex, Draw.MinIndex + Draw.NumVertices);
+			return 1;
+		}
+		v = Draw.Offset + (Draw.BaseVertexIndex + wIndex) * Draw.Stride;
+		if (v + Draw.Stride > uVBSize) {
+			printf("FAIL %s: vertex %u is past the end of the VB\n", c->pszName, wIndex);
+			return 1;
+		}
+		_gldVtxVertex(iCase, c->Expect[i], Pos, Colour);
+		Diffuse = D3DCOLOR_ARGB((int)(Colour[3] * 255), (int)(Colour[0] * 255),
+			(int)(Colour[1] * 255), (int)(Colour[2] * 255));
+		if (memcmp(pVB + v, Pos, sizeof(Pos)) || memcmp(pVB + v + sizeof(Pos), &Diffuse, sizeof(Diffuse))) {
+			printf("FAIL %s: index %u does not reference GL vertex %d\n", c->pszName, i, c->Expect[i]);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// ***********************************************************************
+
+int main(
+	int argc,
+	char *argv[])
+{
+	GLD_testWindow	w;
+	GLD_hlStats		Stats;
+	int				i, iFailures = 0;
+
+	if (!gldTestCreateWindow(&w, "gldvertex", 320, 240)) {
+		gldTestDestroyWindow(&w);
+		return 1;
+	}
+
+	// Identity transforms and flat shading: positions and colours go to
+	// the VB as they were given
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	glMatrixMode(GL_MODELVIEW);
+	glLoadIdentity();
+	glShadeModel(GL_FLAT);
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	for (i=0; i<(int)GLD_VTX_CASES; i++) {
+		_gldVtxDraw(i, &gldVtxCases[i]);
+		iFailures += _gldVtxCheck(i, &gldVtxCases[i]);
+	}
+	wglSwapBuffers(w.hDC);
+	gldTestDestroyWindow(&w);
+
+	gldHeadlessGetStats(&Stats);
+	if (Stats.dwErrors) {
+		printf("FAIL %u calls the debug runtime would reject\n", Stats.dwErrors);
+		iFailures++;
+	}
+	printf("%u primitives checked, %d failed\n", (unsigned)GLD_VTX_CASES, iFailures);
+	return iFailures ? 1 : 0;
+}
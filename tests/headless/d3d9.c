@@ -0,0 +1,2915 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  The stand-in Direct3D 9 object and device. State is stored and checked
+*               the way the debug runtime checks it, draws are validated against the
+*               bound buffers, and every call is counted for the tests.
+*
+*********************************************************************************/
+
+#include <windows.h>
+#include <d3d9.h>
+
+#include "gld_hl_d3d9.h"
+
+// ***********************************************************************
+
+#define GLD_HL_SCREEN_WIDTH		1024
+#define GLD_HL_SCREEN_HEIGHT	768
+#define GLD_HL_TEXTURE_MEMORY	(256 * 1024 * 1024)
+
+// Count a call in the statistics
+#define _GLD_HL_COUNT(m)		gldHLStats.dwCalls[GLD_HL_SLOT(m)]++
+
+typedef struct {
+	IDirect3D9Vtbl			*lpVtbl;
+	LONG					lRefs;
+} GLD_hlD3D;
+
+static IDirect3D9Vtbl			hlD3DVtbl;
+static IDirect3DDevice9Vtbl		hlDeviceVtbl;
+static BOOL						bHLDeviceVtblsReady = FALSE;
+
+static const char *szHLMethodNames[] = {
+	"QueryInterface", "AddRef", "Release", "TestCooperativeLevel",
+	"GetAvailableTextureMem", "EvictManagedResources", "GetDirect3D", "GetDeviceCaps",
+	"GetDisplayMode", "GetCreationParameters", "SetCursorProperties", "SetCursorPosition",
+	"ShowCursor", "CreateAdditionalSwapChain", "GetSwapChain", "GetNumberOfSwapChains",
+	"Reset", "Present", "GetBackBuffer", "GetRasterStatus",
+	"SetDialogBoxMode", "SetGammaRamp", "GetGammaRamp", "CreateTexture",
+	"CreateVolumeTexture", "CreateCubeTexture", "CreateVertexBuffer", "CreateIndexBuffer",
+	"CreateRenderTarget", "CreateDepthStencilSurface", "UpdateSurface", "UpdateTexture",
+	"GetRenderTargetData", "GetFrontBufferData", "StretchRect", "ColorFill",
+	"CreateOffscreenPlainSurface", "SetRenderTarget", "GetRenderTarget", "SetDepthStencilSurface",
+	"GetDepthStencilSurface", "BeginScene", "EndScene", "Clear",
+	"SetTransform", "GetTransform", "MultiplyTransform", "SetViewport",
+	"GetViewport", "SetMaterial", "GetMaterial", "SetLight",
+	"GetLight", "LightEnable", "GetLightEnable", "SetClipPlane",
+	"GetClipPlane", "SetRenderState", "GetRenderState", "CreateStateBlock",
+	"BeginStateBlock", "EndStateBlock", "SetClipStatus", "GetClipStatus",
+	"GetTexture", "SetTexture", "GetTextureStageState", "SetTextureStageState",
+	"GetSamplerState", "SetSamplerState", "ValidateDevice", "SetPaletteEntries",
+	"GetPaletteEntries", "SetCurrentTexturePalette", "GetCurrentTexturePalette", "SetScissorRect",
+	"GetScissorRect", "SetSoftwareVertexProcessing", "GetSoftwareVertexProcessing", "SetNPatchMode",
+	"GetNPatchMode", "DrawPrimitive", "DrawIndexedPrimitive", "DrawPrimitiveUP",
+	"DrawIndexedPrimitiveUP", "ProcessVertices", "CreateVertexDeclaration", "SetVertexDeclaration",
+	"GetVertexDeclaration", "SetFVF", "GetFVF", "CreateVertexShader",
+	"SetVertexShader", "GetVertexShader", "SetVertexShaderConstantF", "GetVertexShaderConstantF",
+	"SetVertexShaderConstantI", "GetVertexShaderConstantI", "SetVertexShaderConstantB", "GetVertexShaderConstantB",
+	"SetStreamSource", "GetStreamSource", "SetStreamSourceFreq", "GetStreamSourceFreq",
+	"SetIndices", "GetIndices", "CreatePixelShader", "SetPixelShader",
+	"GetPixelShader", "SetPixelShaderConstantF", "GetPixelShaderConstantF", "SetPixelShaderConstantI",
+	"GetPixelShaderConstantI", "SetPixelShaderConstantB", "GetPixelShaderConstantB", "DrawRectPatch",
+	"DrawTriPatch", "DeletePatch", "CreateQuery"
+};
+
+static void _gldHLInitDeviceVtbls(void);
+
+// ***********************************************************************
+// Adapter
+// ***********************************************************************
+
+static const D3DDISPLAYMODE hlModes[] = {
+	{640,	480,	60,	D3DFMT_X8R8G8B8},
+	{800,	600,	60,	D3DFMT_X8R8G8B8},
+	{GLD_HL_SCREEN_WIDTH,	GLD_HL_SCREEN_HEIGHT,	60,	D3DFMT_X8R8G8B8},
+};
+
+#define GLD_HL_MODES	(sizeof(hlModes) / sizeof(hlModes[0]))
+
+// ***********************************************************************
+
+static BOOL _gldHLIsDepthFormat(
+	D3DFORMAT Format)
+{
+	switch (Format) {
+	case D3DFMT_D16_LOCKABLE:
+	case D3DFMT_D32:
+	case D3DFMT_D15S1:
+	case D3DFMT_D24S8:
+	case D3DFMT_D24X8:
+	case D3DFMT_D24X4S4:
+	case D3DFMT_D16:
+	case D3DFMT_D32F_LOCKABLE:
+	case D3DFMT_D24FS8:
+		return TRUE;
+	default:
+		return FALSE;
+	}
+}
+
+// ***********************************************************************
+
+static void _gldHLGetCaps(
+	D3DDEVTYPE DeviceType,
+	D3DCAPS9 *pCaps)
+{
+	// A shader model 3.0 part with generous limits
+	ZeroMemory(pCaps, sizeof(*pCaps));
+	pCaps->DeviceType				= DeviceType;
+	pCaps->Caps2					= D3DCAPS2_DYNAMICTEXTURES | D3DCAPS2_CANAUTOGENMIPMAP;
+	pCaps->PresentationIntervals	= D3DPRESENT_INTERVAL_ONE | D3DPRESENT_INTERVAL_IMMEDIATE;
+	pCaps->DevCaps					= D3DDEVCAPS_HWTRANSFORMANDLIGHT | D3DDEVCAPS_PUREDEVICE;
+	pCaps->RasterCaps				= D3DPRASTERCAPS_SCISSORTEST;
+	pCaps->TextureCaps				= D3DPTEXTURECAPS_MIPMAP | D3DPTEXTURECAPS_CUBEMAP;
+	pCaps->MaxTextureWidth			= 4096;
+	pCaps->MaxTextureHeight			= 4096;
+	pCaps->MaxVolumeExtent			= 256;
+	pCaps->MaxTextureRepeat			= 8192;
+	pCaps->MaxTextureAspectRatio	= 4096;
+	pCaps->MaxAnisotropy			= 16;
+	pCaps->MaxVertexW				= 1e10f;
+	pCaps->MaxTextureBlendStages	= GLD_HL_MAX_STAGES;
+	pCaps->MaxSimultaneousTextures	= GLD_HL_MAX_STAGES;
+	pCaps->MaxActiveLights			= GLD_HL_MAX_LIGHTS;
+	pCaps->MaxUserClipPlanes		= GLD_HL_MAX_CLIPPLANES;
+	pCaps->MaxVertexBlendMatrices	= 4;
+	pCaps->MaxVertexBlendMatrixIndex = 255;
+	pCaps->MaxPointSize				= 64.0f;
+	pCaps->MaxPrimitiveCount		= 0xFFFFF;
+	pCaps->MaxVertexIndex			= 0xFFFFFF;
+	pCaps->MaxStreams				= GLD_HL_MAX_STREAMS;
+	pCaps->MaxStreamStride			= 255;
+	pCaps->VertexShaderVersion		= D3DVS_VERSION(3,0);
+	pCaps->MaxVertexShaderConst		= GLD_HL_VS_CONSTANTS_F;
+	pCaps->PixelShaderVersion		= D3DPS_VERSION(3,0);
+	pCaps->PixelShader1xMaxValue	= 65504.0f;
+	pCaps->NumSimultaneousRTs		= GLD_HL_MAX_RENDERTARGETS;
+	pCaps->NumberOfAdaptersInGroup	= 1;
+	pCaps->MaxVShaderInstructionsExecuted	= 65535;
+	pCaps->MaxPShaderInstructionsExecuted	= 65535;
+	pCaps->MaxVertexShader30InstructionSlots	= 512;
+	pCaps->MaxPixelShader30InstructionSlots		= 512;
+}
+
+// ***********************************************************************
+// IDirect3D9
+// ***********************************************************************
+
+IDirect3D9* WINAPI Direct3DCreate9(
+	UINT SDKVersion)
+{
+	GLD_hlD3D	*pD3D;
+
+	if (SDKVersion != D3D_SDK_VERSION)
+		return NULL;
+	if (!bHLDeviceVtblsReady)
+		_gldHLInitDeviceVtbls();
+
+	pD3D = calloc(1, sizeof(GLD_hlD3D));
+	if (!pD3D)
+		return NULL;
+	pD3D->lpVtbl	= &hlD3DVtbl;
+	pD3D->lRefs		= 1;
+	return (IDirect3D9*)pD3D;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DQueryInterface(
+	GLD_hlD3D *This,
+	REFIID riid,
+	void **ppvObj)
+{
+	if (!IsEqualIID(riid, &IID_IUnknown)) {
+		*ppvObj = NULL;
+		return E_NOINTERFACE;
+	}
+	This->lRefs++;
+	*ppvObj = This;
+	return S_OK;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLD3DAddRef(
+	GLD_hlD3D *This)
+{
+	return ++This->lRefs;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLD3DRelease(
+	GLD_hlD3D *This)
+{
+	LONG	lRefs = --This->lRefs;
+
+	if (lRefs == 0)
+		free(This);
+	return lRefs;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DRegisterSoftwareDevice(
+	GLD_hlD3D *This,
+	void *pInitializeFunction)
+{
+	return D3DERR_INVALIDCALL;
+}
+
+static UINT STDMETHODCALLTYPE _gldHLD3DGetAdapterCount(
+	GLD_hlD3D *This)
+{
+	return 1;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DGetAdapterIdentifier(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	DWORD Flags,
+	D3DADAPTER_IDENTIFIER9 *pIdentifier)
+{
+	if (Adapter != D3DADAPTER_DEFAULT)
+		return D3DERR_INVALIDCALL;
+	ZeroMemory(pIdentifier, sizeof(*pIdentifier));
+	lstrcpyn(pIdentifier->Driver, "gldheadless", sizeof(pIdentifier->Driver));
+	lstrcpyn(pIdentifier->Description, "GLDirect headless Direct3D 9 device", sizeof(pIdentifier->Description));
+	lstrcpyn(pIdentifier->DeviceName, "\\\\.\\DISPLAY1", sizeof(pIdentifier->DeviceName));
+	return D3D_OK;
+}
+
+static UINT STDMETHODCALLTYPE _gldHLD3DGetAdapterModeCount(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DFORMAT Format)
+{
+	return (Adapter == D3DADAPTER_DEFAULT && Format == D3DFMT_X8R8G8B8) ? GLD_HL_MODES : 0;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DEnumAdapterModes(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DFORMAT Format,
+	UINT Mode,
+	D3DDISPLAYMODE *pMode)
+{
+	if (Adapter != D3DADAPTER_DEFAULT || Format != D3DFMT_X8R8G8B8 || Mode >= GLD_HL_MODES)
+		return D3DERR_INVALIDCALL;
+	*pMode = hlModes[Mode];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DGetAdapterDisplayMode(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DDISPLAYMODE *pMode)
+{
+	if (Adapter != D3DADAPTER_DEFAULT)
+		return D3DERR_INVALIDCALL;
+	*pMode = hlModes[GLD_HL_MODES-1];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DCheckDeviceType(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DDEVTYPE DevType,
+	D3DFORMAT AdapterFormat,
+	D3DFORMAT BackBufferFormat,
+	BOOL bWindowed)
+{
+	if (Adapter != D3DADAPTER_DEFAULT)
+		return D3DERR_INVALIDCALL;
+	switch (BackBufferFormat) {
+	case D3DFMT_UNKNOWN:
+		return bWindowed ? D3D_OK : D3DERR_NOTAVAILABLE;
+	case D3DFMT_X8R8G8B8:
+	case D3DFMT_A8R8G8B8:
+	case D3DFMT_R5G6B5:
+	case D3DFMT_X1R5G5B5:
+		return D3D_OK;
+	default:
+		return D3DERR_NOTAVAILABLE;
+	}
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DCheckDeviceFormat(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DDEVTYPE DeviceType,
+	D3DFORMAT AdapterFormat,
+	DWORD Usage,
+	D3DRESOURCETYPE RType,
+	D3DFORMAT CheckFormat)
+{
+	if (Adapter != D3DADAPTER_DEFAULT)
+		return D3DERR_INVALIDCALL;
+	if (!gldHLFormatBits(CheckFormat))
+		return D3DERR_NOTAVAILABLE;
+	if ((Usage & D3DUSAGE_DEPTHSTENCIL) && !_gldHLIsDepthFormat(CheckFormat))
+		return D3DERR_NOTAVAILABLE;
+	if ((Usage & D3DUSAGE_RENDERTARGET) && (_gldHLIsDepthFormat(CheckFormat) || gldHLFormatIsDXT(CheckFormat)))
+		return D3DERR_NOTAVAILABLE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DCheckDeviceMultiSampleType(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DDEVTYPE DeviceType,
+	D3DFORMAT SurfaceFormat,
+	BOOL Windowed,
+	D3DMULTISAMPLE_TYPE MultiSampleType,
+	DWORD *pQualityLevels)
+{
+	// Nothing is rasterised, so there is nothing to multisample
+	if (pQualityLevels)
+		*pQualityLevels = 1;
+	return (MultiSampleType == D3DMULTISAMPLE_NONE) ? D3D_OK : D3DERR_NOTAVAILABLE;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DCheckDepthStencilMatch(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DDEVTYPE DeviceType,
+	D3DFORMAT AdapterFormat,
+	D3DFORMAT RenderTargetFormat,
+	D3DFORMAT DepthStencilFormat)
+{
+	return _gldHLIsDepthFormat(DepthStencilFormat) ? D3D_OK : D3DERR_NOTAVAILABLE;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DCheckDeviceFormatConversion(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DDEVTYPE DeviceType,
+	D3DFORMAT SourceFormat,
+	D3DFORMAT TargetFormat)
+{
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DGetDeviceCaps(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DDEVTYPE DeviceType,
+	D3DCAPS9 *pCaps)
+{
+	if (Adapter != D3DADAPTER_DEFAULT)
+		return D3DERR_INVALIDCALL;
+	_gldHLGetCaps(DeviceType, pCaps);
+	return D3D_OK;
+}
+
+static HMONITOR STDMETHODCALLTYPE _gldHLD3DGetAdapterMonitor(
+	GLD_hlD3D *This,
+	UINT Adapter)
+{
+	return NULL;
+}
+
+// ***********************************************************************
+// Device creation
+// ***********************************************************************
+
+static void _gldHLDefaultState(
+	GLD_hlDevice *pDev)
+{
+	// The documented defaults, for the states the driver reads back
+	float	fOne = 1.0f;
+	DWORD	i;
+
+	ZeroMemory(pDev->RenderStates, sizeof(pDev->RenderStates));
+	pDev->RenderStates[D3DRS_ZENABLE]			= pDev->pp.EnableAutoDepthStencil;
+	pDev->RenderStates[D3DRS_FILLMODE]			= 3;	// D3DFILL_SOLID
+	pDev->RenderStates[D3DRS_SHADEMODE]			= 2;	// D3DSHADE_GOURAUD
+	pDev->RenderStates[D3DRS_ZWRITEENABLE]		= TRUE;
+	pDev->RenderStates[D3DRS_LASTPIXEL]			= TRUE;
+	pDev->RenderStates[D3DRS_SRCBLEND]			= 2;	// D3DBLEND_ONE
+	pDev->RenderStates[D3DRS_DESTBLEND]			= 1;	// D3DBLEND_ZERO
+	pDev->RenderStates[D3DRS_CULLMODE]			= 3;	// D3DCULL_CCW
+	pDev->RenderStates[D3DRS_ZFUNC]				= 4;	// D3DCMP_LESSEQUAL
+	pDev->RenderStates[D3DRS_ALPHAFUNC]			= 8;	// D3DCMP_ALWAYS
+	pDev->RenderStates[D3DRS_FOGEND]			= *(DWORD*)&fOne;
+	pDev->RenderStates[D3DRS_FOGDENSITY]		= *(DWORD*)&fOne;
+	pDev->RenderStates[D3DRS_STENCILFAIL]		= 1;	// D3DSTENCILOP_KEEP
+	pDev->RenderStates[D3DRS_STENCILZFAIL]		= 1;
+	pDev->RenderStates[D3DRS_STENCILPASS]		= 1;
+	pDev->RenderStates[D3DRS_STENCILFUNC]		= 8;
+	pDev->RenderStates[D3DRS_STENCILMASK]		= 0xFFFFFFFF;
+	pDev->RenderStates[D3DRS_STENCILWRITEMASK]	= 0xFFFFFFFF;
+	pDev->RenderStates[D3DRS_TEXTUREFACTOR]		= 0xFFFFFFFF;
+	pDev->RenderStates[D3DRS_CLIPPING]			= TRUE;
+	pDev->RenderStates[D3DRS_LIGHTING]			= TRUE;
+	pDev->RenderStates[D3DRS_COLORVERTEX]		= TRUE;
+	pDev->RenderStates[D3DRS_LOCALVIEWER]		= TRUE;
+	pDev->RenderStates[D3DRS_DIFFUSEMATERIALSOURCE]	= 1;	// D3DMCS_COLOR1
+	pDev->RenderStates[D3DRS_SPECULARMATERIALSOURCE] = 2;	// D3DMCS_COLOR2
+	pDev->RenderStates[D3DRS_POINTSIZE]			= *(DWORD*)&fOne;
+	pDev->RenderStates[D3DRS_POINTSIZE_MIN]		= *(DWORD*)&fOne;
+	pDev->RenderStates[D3DRS_POINTSCALE_A]		= *(DWORD*)&fOne;
+	pDev->RenderStates[D3DRS_MULTISAMPLEANTIALIAS]	= TRUE;
+	pDev->RenderStates[D3DRS_MULTISAMPLEMASK]	= 0xFFFFFFFF;
+	pDev->RenderStates[D3DRS_COLORWRITEENABLE]	= 0x0000000F;
+	pDev->RenderStates[D3DRS_COLORWRITEENABLE1]	= 0x0000000F;
+	pDev->RenderStates[D3DRS_COLORWRITEENABLE2]	= 0x0000000F;
+	pDev->RenderStates[D3DRS_COLORWRITEENABLE3]	= 0x0000000F;
+	pDev->RenderStates[D3DRS_BLENDOP]			= 1;	// D3DBLENDOP_ADD
+	pDev->RenderStates[D3DRS_BLENDOPALPHA]		= 1;
+	pDev->RenderStates[D3DRS_SRCBLENDALPHA]		= 2;
+	pDev->RenderStates[D3DRS_DESTBLENDALPHA]	= 1;
+	pDev->RenderStates[D3DRS_CCW_STENCILFAIL]	= 1;
+	pDev->RenderStates[D3DRS_CCW_STENCILZFAIL]	= 1;
+	pDev->RenderStates[D3DRS_CCW_STENCILPASS]	= 1;
+	pDev->RenderStates[D3DRS_CCW_STENCILFUNC]	= 8;
+	pDev->RenderStates[D3DRS_BLENDFACTOR]		= 0xFFFFFFFF;
+
+	ZeroMemory(pDev->StageStates, sizeof(pDev->StageStates));
+	for (i=0; i<GLD_HL_MAX_STAGES; i++) {
+		pDev->StageStates[i][D3DTSS_COLOROP]		= i ? D3DTOP_DISABLE : D3DTOP_MODULATE;
+		pDev->StageStates[i][D3DTSS_COLORARG1]		= D3DTA_TEXTURE;
+		pDev->StageStates[i][D3DTSS_COLORARG2]		= D3DTA_CURRENT;
+		pDev->StageStates[i][D3DTSS_ALPHAOP]		= i ? D3DTOP_DISABLE : D3DTOP_SELECTARG1;
+		pDev->StageStates[i][D3DTSS_ALPHAARG1]		= D3DTA_TEXTURE;
+		pDev->StageStates[i][D3DTSS_ALPHAARG2]		= D3DTA_CURRENT;
+		pDev->StageStates[i][D3DTSS_TEXCOORDINDEX]	= i;
+		pDev->StageStates[i][D3DTSS_COLORARG0]		= D3DTA_CURRENT;
+		pDev->StageStates[i][D3DTSS_ALPHAARG0]		= D3DTA_CURRENT;
+		pDev->StageStates[i][D3DTSS_RESULTARG]		= D3DTA_CURRENT;
+	}
+
+	ZeroMemory(pDev->SamplerStates, sizeof(pDev->SamplerStates));
+	for (i=0; i<GLD_HL_MAX_SAMPLERS; i++) {
+		pDev->SamplerStates[i][D3DSAMP_ADDRESSU]		= 1;	// D3DTADDRESS_WRAP
+		pDev->SamplerStates[i][D3DSAMP_ADDRESSV]		= 1;
+		pDev->SamplerStates[i][D3DSAMP_ADDRESSW]		= 1;
+		pDev->SamplerStates[i][D3DSAMP_MAGFILTER]		= D3DTEXF_POINT;
+		pDev->SamplerStates[i][D3DSAMP_MINFILTER]		= D3DTEXF_POINT;
+		pDev->SamplerStates[i][D3DSAMP_MIPFILTER]		= D3DTEXF_NONE;
+		pDev->SamplerStates[i][D3DSAMP_MAXANISOTROPY]	= 1;
+	}
+
+	for (i=0; i<GLD_HL_MAX_TRANSFORMS; i++) {
+		ZeroMemory(&pDev->Transforms[i], sizeof(D3DMATRIX));
+		pDev->Transforms[i]._11 = pDev->Transforms[i]._22 = 1.0f;
+		pDev->Transforms[i]._33 = pDev->Transforms[i]._44 = 1.0f;
+	}
+	for (i=0; i<GLD_HL_MAX_STREAMS; i++)
+		pDev->Streams[i].Freq = 1;
+
+	pDev->Viewport.X		= 0;
+	pDev->Viewport.Y		= 0;
+	pDev->Viewport.Width	= pDev->pp.BackBufferWidth;
+	pDev->Viewport.Height	= pDev->pp.BackBufferHeight;
+	pDev->Viewport.MinZ		= 0.0f;
+	pDev->Viewport.MaxZ		= 1.0f;
+	SetRect(&pDev->rcScissor, 0, 0, pDev->pp.BackBufferWidth, pDev->pp.BackBufferHeight);
+	pDev->bSoftwareVP = (pDev->Params.BehaviorFlags & D3DCREATE_SOFTWARE_VERTEXPROCESSING) ? TRUE : FALSE;
+}
+
+// ***********************************************************************
+
+static void _gldHLUnbindAll(
+	GLD_hlDevice *pDev)
+{
+	DWORD	i;
+
+	for (i=0; i<GLD_HL_MAX_RENDERTARGETS; i++)
+		gldHLBind(&pDev->pRenderTargets[i], NULL);
+	gldHLBind(&pDev->pDepthStencil, NULL);
+	for (i=0; i<GLD_HL_MAX_SAMPLERS; i++)
+		gldHLBind(&pDev->pTextures[i], NULL);
+	for (i=0; i<GLD_HL_MAX_STREAMS; i++)
+		gldHLBind(&pDev->Streams[i].pVB, NULL);
+	gldHLBind(&pDev->pIndices, NULL);
+	gldHLBind(&pDev->pDecl, NULL);
+	gldHLBind(&pDev->pVS, NULL);
+	gldHLBind(&pDev->pPS, NULL);
+	ZeroMemory(pDev->Streams, sizeof(pDev->Streams));
+	pDev->dwFVF = 0;
+}
+
+// ***********************************************************************
+
+static HRESULT _gldHLCreateSwapChainSurfaces(
+	GLD_hlDevice *pDev,
+	D3DPRESENT_PARAMETERS *pp)
+{
+	RECT	rc;
+	HWND	hWnd;
+
+	// Windowed devices take their size from the window
+	if (pp->Windowed) {
+		hWnd = pp->hDeviceWindow ? pp->hDeviceWindow : pDev->Params.hFocusWindow;
+		GetClientRect(hWnd, &rc);
+		if (!pp->BackBufferWidth)
+			pp->BackBufferWidth = max(rc.right - rc.left, 1);
+		if (!pp->BackBufferHeight)
+			pp->BackBufferHeight = max(rc.bottom - rc.top, 1);
+		if (pp->BackBufferFormat == D3DFMT_UNKNOWN)
+			pp->BackBufferFormat = hlModes[GLD_HL_MODES-1].Format;
+	}
+	if (!pp->BackBufferCount)
+		pp->BackBufferCount = 1;
+	if (pp->MultiSampleType != D3DMULTISAMPLE_NONE) {
+		gldHLError("CreateDevice: multisampling is not supported");
+		return D3DERR_NOTAVAILABLE;
+	}
+
+	pDev->pBackBuffer = gldHLCreateSurface(pDev, pp->BackBufferWidth, pp->BackBufferHeight,
+		pp->BackBufferFormat, D3DUSAGE_RENDERTARGET, D3DPOOL_DEFAULT, NULL);
+	if (!pDev->pBackBuffer) {
+		gldHLError("CreateDevice: %ux%u back buffer of format %u",
+			pp->BackBufferWidth, pp->BackBufferHeight, pp->BackBufferFormat);
+		return D3DERR_INVALIDCALL;
+	}
+	if (pp->EnableAutoDepthStencil) {
+		if (!_gldHLIsDepthFormat(pp->AutoDepthStencilFormat)) {
+			gldHLError("CreateDevice: depth format %u", pp->AutoDepthStencilFormat);
+			return D3DERR_INVALIDCALL;
+		}
+		pDev->pAutoDepth = gldHLCreateSurface(pDev, pp->BackBufferWidth, pp->BackBufferHeight,
+			pp->AutoDepthStencilFormat, D3DUSAGE_DEPTHSTENCIL, D3DPOOL_DEFAULT, NULL);
+		if (!pDev->pAutoDepth)
+			return E_OUTOFMEMORY;
+	}
+
+	pDev->pp = *pp;
+	gldHLBind(&pDev->pRenderTargets[0], pDev->pBackBuffer);
+	gldHLBind(&pDev->pDepthStencil, pDev->pAutoDepth);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static void _gldHLReleaseSwapChainSurfaces(
+	GLD_hlDevice *pDev)
+{
+	if (pDev->pBackBuffer)
+		gldHLRelease(pDev->pBackBuffer);
+	if (pDev->pAutoDepth)
+		gldHLRelease(pDev->pAutoDepth);
+	pDev->pBackBuffer	= NULL;
+	pDev->pAutoDepth	= NULL;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLD3DCreateDevice(
+	GLD_hlD3D *This,
+	UINT Adapter,
+	D3DDEVTYPE DeviceType,
+	HWND hFocusWindow,
+	DWORD BehaviorFlags,
+	D3DPRESENT_PARAMETERS *pPresentationParameters,
+	IDirect3DDevice9 **ppReturnedDeviceInterface)
+{
+	GLD_hlDevice	*pDev;
+	HRESULT			hr;
+
+	*ppReturnedDeviceInterface = NULL;
+	if (Adapter != D3DADAPTER_DEFAULT || !pPresentationParameters)
+		return D3DERR_INVALIDCALL;
+	if (!(BehaviorFlags & (D3DCREATE_SOFTWARE_VERTEXPROCESSING | D3DCREATE_HARDWARE_VERTEXPROCESSING | D3DCREATE_MIXED_VERTEXPROCESSING))) {
+		gldHLError("CreateDevice: no vertex processing flag");
+		return D3DERR_INVALIDCALL;
+	}
+
+	pDev = calloc(1, sizeof(GLD_hlDevice));
+	if (!pDev)
+		return E_OUTOFMEMORY;
+	pDev->lpVtbl					= &hlDeviceVtbl;
+	pDev->lRefs						= 1;
+	pDev->pD3D						= (IDirect3D9*)This;
+	pDev->Params.AdapterOrdinal		= Adapter;
+	pDev->Params.DeviceType			= DeviceType;
+	pDev->Params.hFocusWindow		= hFocusWindow;
+	pDev->Params.BehaviorFlags		= BehaviorFlags;
+	gldHLInitSwapChain(pDev);
+
+	hr = _gldHLCreateSwapChainSurfaces(pDev, pPresentationParameters);
+	if (FAILED(hr)) {
+		_gldHLUnbindAll(pDev);
+		_gldHLReleaseSwapChainSurfaces(pDev);
+		free(pDev);
+		return hr;
+	}
+	_gldHLDefaultState(pDev);
+
+	This->lRefs++;
+	*ppReturnedDeviceInterface = (IDirect3DDevice9*)pDev;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Device: general
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevQueryInterface(
+	GLD_hlDevice *This,
+	REFIID riid,
+	void **ppvObj)
+{
+	_GLD_HL_COUNT(QueryInterface);
+	if (!IsEqualIID(riid, &IID_IUnknown)) {
+		*ppvObj = NULL;
+		return E_NOINTERFACE;
+	}
+	This->lRefs++;
+	*ppvObj = This;
+	return S_OK;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLDevAddRef(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(AddRef);
+	return ++This->lRefs;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLDevRelease(
+	GLD_hlDevice *This)
+{
+	LONG	lRefs;
+
+	_GLD_HL_COUNT(Release);
+	lRefs = --This->lRefs;
+	if (lRefs == 0) {
+		if (This->bInScene)
+			gldHLWarning("Release: device destroyed inside BeginScene/EndScene");
+		_gldHLUnbindAll(This);
+		_gldHLReleaseSwapChainSurfaces(This);
+		IDirect3D9_Release(This->pD3D);
+		free(This);
+	}
+	return lRefs;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevTestCooperativeLevel(
+	GLD_hlDevice *This)
+{
+	// The device is never lost
+	_GLD_HL_COUNT(TestCooperativeLevel);
+	return D3D_OK;
+}
+
+static UINT STDMETHODCALLTYPE _gldHLDevGetAvailableTextureMem(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(GetAvailableTextureMem);
+	return GLD_HL_TEXTURE_MEMORY;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevEvictManagedResources(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(EvictManagedResources);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetDirect3D(
+	GLD_hlDevice *This,
+	IDirect3D9 **ppD3D9)
+{
+	_GLD_HL_COUNT(GetDirect3D);
+	IDirect3D9_AddRef(This->pD3D);
+	*ppD3D9 = This->pD3D;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetDeviceCaps(
+	GLD_hlDevice *This,
+	D3DCAPS9 *pCaps)
+{
+	_GLD_HL_COUNT(GetDeviceCaps);
+	_gldHLGetCaps(This->Params.DeviceType, pCaps);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetDisplayMode(
+	GLD_hlDevice *This,
+	UINT iSwapChain,
+	D3DDISPLAYMODE *pMode)
+{
+	_GLD_HL_COUNT(GetDisplayMode);
+	if (iSwapChain)
+		return D3DERR_INVALIDCALL;
+	*pMode = hlModes[GLD_HL_MODES-1];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetCreationParameters(
+	GLD_hlDevice *This,
+	D3DDEVICE_CREATION_PARAMETERS *pParameters)
+{
+	_GLD_HL_COUNT(GetCreationParameters);
+	*pParameters = This->Params;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetCursorProperties(
+	GLD_hlDevice *This,
+	UINT XHotSpot,
+	UINT YHotSpot,
+	IDirect3DSurface9 *pCursorBitmap)
+{
+	_GLD_HL_COUNT(SetCursorProperties);
+	return D3D_OK;
+}
+
+static void STDMETHODCALLTYPE _gldHLDevSetCursorPosition(
+	GLD_hlDevice *This,
+	int X,
+	int Y,
+	DWORD Flags)
+{
+	_GLD_HL_COUNT(SetCursorPosition);
+}
+
+static BOOL STDMETHODCALLTYPE _gldHLDevShowCursor(
+	GLD_hlDevice *This,
+	BOOL bShow)
+{
+	_GLD_HL_COUNT(ShowCursor);
+	return FALSE;
+}
+
+// ***********************************************************************
+// Device: swap chain
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateAdditionalSwapChain(
+	GLD_hlDevice *This,
+	D3DPRESENT_PARAMETERS *pPresentationParameters,
+	IDirect3DSwapChain9 **pSwapChain)
+{
+	_GLD_HL_COUNT(CreateAdditionalSwapChain);
+	*pSwapChain = NULL;
+	return D3DERR_NOTAVAILABLE;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetSwapChain(
+	GLD_hlDevice *This,
+	UINT iSwapChain,
+	IDirect3DSwapChain9 **pSwapChain)
+{
+	_GLD_HL_COUNT(GetSwapChain);
+	if (iSwapChain) {
+		*pSwapChain = NULL;
+		return D3DERR_INVALIDCALL;
+	}
+	This->lRefs++;
+	*pSwapChain = (IDirect3DSwapChain9*)&This->SwapChain;
+	return D3D_OK;
+}
+
+static UINT STDMETHODCALLTYPE _gldHLDevGetNumberOfSwapChains(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(GetNumberOfSwapChains);
+	return 1;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevReset(
+	GLD_hlDevice *This,
+	D3DPRESENT_PARAMETERS *pPresentationParameters)
+{
+	HRESULT	hr;
+
+	_GLD_HL_COUNT(Reset);
+	if (This->bInScene)
+		gldHLError("Reset: inside BeginScene/EndScene");
+
+	// Reset releases the swap chain and returns every state to its default
+	_gldHLUnbindAll(This);
+	_gldHLReleaseSwapChainSurfaces(This);
+	hr = _gldHLCreateSwapChainSurfaces(This, pPresentationParameters);
+	if (FAILED(hr))
+		return hr;
+	_gldHLDefaultState(This);
+	This->bInScene = FALSE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevPresent(
+	GLD_hlDevice *This,
+	const RECT *pSourceRect,
+	const RECT *pDestRect,
+	HWND hDestWindowOverride,
+	const RGNDATA *pDirtyRegion)
+{
+	_GLD_HL_COUNT(Present);
+	if (This->bInScene)
+		gldHLError("Present: inside BeginScene/EndScene");
+	if ((pSourceRect || pDestRect) && This->pp.SwapEffect != D3DSWAPEFFECT_COPY)
+		gldHLError("Present: rectangles need D3DSWAPEFFECT_COPY");
+	gldHLStats.dwPresents++;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetBackBuffer(
+	GLD_hlDevice *This,
+	UINT iSwapChain,
+	UINT iBackBuffer,
+	D3DBACKBUFFER_TYPE Type,
+	IDirect3DSurface9 **ppBackBuffer)
+{
+	// Every back buffer is the same surface; nothing is displayed
+	_GLD_HL_COUNT(GetBackBuffer);
+	if (iSwapChain || iBackBuffer >= This->pp.BackBufferCount) {
+		*ppBackBuffer = NULL;
+		return D3DERR_INVALIDCALL;
+	}
+	gldHLAddRef(This->pBackBuffer);
+	*ppBackBuffer = (IDirect3DSurface9*)This->pBackBuffer;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetRasterStatus(
+	GLD_hlDevice *This,
+	UINT iSwapChain,
+	D3DRASTER_STATUS *pRasterStatus)
+{
+	_GLD_HL_COUNT(GetRasterStatus);
+	pRasterStatus->InVBlank	= FALSE;
+	pRasterStatus->ScanLine	= 0;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetDialogBoxMode(
+	GLD_hlDevice *This,
+	BOOL bEnableDialogs)
+{
+	_GLD_HL_COUNT(SetDialogBoxMode);
+	return D3D_OK;
+}
+
+static void STDMETHODCALLTYPE _gldHLDevSetGammaRamp(
+	GLD_hlDevice *This,
+	UINT iSwapChain,
+	DWORD Flags,
+	const D3DGAMMARAMP *pRamp)
+{
+	_GLD_HL_COUNT(SetGammaRamp);
+	This->Gamma = *pRamp;
+}
+
+static void STDMETHODCALLTYPE _gldHLDevGetGammaRamp(
+	GLD_hlDevice *This,
+	UINT iSwapChain,
+	D3DGAMMARAMP *pRamp)
+{
+	_GLD_HL_COUNT(GetGammaRamp);
+	*pRamp = This->Gamma;
+}
+
+// ***********************************************************************
+// Device: resource creation
+// ***********************************************************************
+
+static BOOL _gldHLCheckShared(
+	const char *pszMethod,
+	HANDLE *pSharedHandle)
+{
+	if (pSharedHandle) {
+		gldHLError("%s: shared handles need Windows Vista", pszMethod);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateTexture(
+	GLD_hlDevice *This,
+	UINT Width,
+	UINT Height,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DTexture9 **ppTexture,
+	HANDLE *pSharedHandle)
+{
+	_GLD_HL_COUNT(CreateTexture);
+	if (!_gldHLCheckShared("CreateTexture", pSharedHandle))
+		return D3DERR_INVALIDCALL;
+	return gldHLCreateTexture(This, Width, Height, Levels, Usage, Format, Pool, FALSE, (GLD_hlTexture**)ppTexture);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateVolumeTexture(
+	GLD_hlDevice *This,
+	UINT Width,
+	UINT Height,
+	UINT Depth,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DVolumeTexture9 **ppVolumeTexture,
+	HANDLE *pSharedHandle)
+{
+	_GLD_HL_COUNT(CreateVolumeTexture);
+	if (!_gldHLCheckShared("CreateVolumeTexture", pSharedHandle))
+		return D3DERR_INVALIDCALL;
+	return gldHLCreateVolumeTexture(This, Width, Height, Depth, Levels, Usage, Format, Pool, (GLD_hlVolumeTexture**)ppVolumeTexture);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateCubeTexture(
+	GLD_hlDevice *This,
+	UINT EdgeLength,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DCubeTexture9 **ppCubeTexture,
+	HANDLE *pSharedHandle)
+{
+	_GLD_HL_COUNT(CreateCubeTexture);
+	if (!_gldHLCheckShared("CreateCubeTexture", pSharedHandle))
+		return D3DERR_INVALIDCALL;
+	return gldHLCreateTexture(This, EdgeLength, EdgeLength, Levels, Usage, Format, Pool, TRUE, (GLD_hlTexture**)ppCubeTexture);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateVertexBuffer(
+	GLD_hlDevice *This,
+	UINT Length,
+	DWORD Usage,
+	DWORD FVF,
+	D3DPOOL Pool,
+	IDirect3DVertexBuffer9 **ppVertexBuffer,
+	HANDLE *pSharedHandle)
+{
+	_GLD_HL_COUNT(CreateVertexBuffer);
+	if (!_gldHLCheckShared("CreateVertexBuffer", pSharedHandle))
+		return D3DERR_INVALIDCALL;
+	return gldHLCreateBuffer(This, GLD_HL_VERTEXBUFFER, Length, Usage, D3DFMT_VERTEXDATA, FVF, Pool, (GLD_hlBuffer**)ppVertexBuffer);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateIndexBuffer(
+	GLD_hlDevice *This,
+	UINT Length,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DIndexBuffer9 **ppIndexBuffer,
+	HANDLE *pSharedHandle)
+{
+	_GLD_HL_COUNT(CreateIndexBuffer);
+	if (!_gldHLCheckShared("CreateIndexBuffer", pSharedHandle))
+		return D3DERR_INVALIDCALL;
+	if (Format != D3DFMT_INDEX16 && Format != D3DFMT_INDEX32) {
+		gldHLError("CreateIndexBuffer: format %u", Format);
+		return D3DERR_INVALIDCALL;
+	}
+	return gldHLCreateBuffer(This, GLD_HL_INDEXBUFFER, Length, Usage, Format, 0, Pool, (GLD_hlBuffer**)ppIndexBuffer);
+}
+
+static HRESULT _gldHLNewSurface(
+	GLD_hlDevice *This,
+	const char *pszMethod,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	DWORD Usage,
+	D3DPOOL Pool,
+	D3DMULTISAMPLE_TYPE MultiSample,
+	IDirect3DSurface9 **ppSurface,
+	HANDLE *pSharedHandle)
+{
+	*ppSurface = NULL;
+	if (!_gldHLCheckShared(pszMethod, pSharedHandle))
+		return D3DERR_INVALIDCALL;
+	if (MultiSample != D3DMULTISAMPLE_NONE) {
+		gldHLError("%s: multisampling is not supported", pszMethod);
+		return D3DERR_NOTAVAILABLE;
+	}
+	if ((Usage & D3DUSAGE_DEPTHSTENCIL) && !_gldHLIsDepthFormat(Format)) {
+		gldHLError("%s: format %u is not a depth format", pszMethod, Format);
+		return D3DERR_INVALIDCALL;
+	}
+	*ppSurface = (IDirect3DSurface9*)gldHLCreateSurface(This, Width, Height, Format, Usage, Pool, NULL);
+	if (!*ppSurface) {
+		gldHLError("%s: %ux%u format %u", pszMethod, Width, Height, Format);
+		return D3DERR_INVALIDCALL;
+	}
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateRenderTarget(
+	GLD_hlDevice *This,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	D3DMULTISAMPLE_TYPE MultiSample,
+	DWORD MultisampleQuality,
+	BOOL Lockable,
+	IDirect3DSurface9 **ppSurface,
+	HANDLE *pSharedHandle)
+{
+	_GLD_HL_COUNT(CreateRenderTarget);
+	return _gldHLNewSurface(This, "CreateRenderTarget", Width, Height, Format,
+		D3DUSAGE_RENDERTARGET, D3DPOOL_DEFAULT, MultiSample, ppSurface, pSharedHandle);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateDepthStencilSurface(
+	GLD_hlDevice *This,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	D3DMULTISAMPLE_TYPE MultiSample,
+	DWORD MultisampleQuality,
+	BOOL Discard,
+	IDirect3DSurface9 **ppSurface,
+	HANDLE *pSharedHandle)
+{
+	_GLD_HL_COUNT(CreateDepthStencilSurface);
+	return _gldHLNewSurface(This, "CreateDepthStencilSurface", Width, Height, Format,
+		D3DUSAGE_DEPTHSTENCIL, D3DPOOL_DEFAULT, MultiSample, ppSurface, pSharedHandle);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateOffscreenPlainSurface(
+	GLD_hlDevice *This,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	IDirect3DSurface9 **ppSurface,
+	HANDLE *pSharedHandle)
+{
+	_GLD_HL_COUNT(CreateOffscreenPlainSurface);
+	if (Pool == D3DPOOL_MANAGED) {
+		*ppSurface = NULL;
+		gldHLError("CreateOffscreenPlainSurface: D3DPOOL_MANAGED");
+		return D3DERR_INVALIDCALL;
+	}
+	return _gldHLNewSurface(This, "CreateOffscreenPlainSurface", Width, Height, Format,
+		0, Pool, D3DMULTISAMPLE_NONE, ppSurface, pSharedHandle);
+}
+
+// ***********************************************************************
+// Device: copies
+// ***********************************************************************
+
+static BOOL _gldHLCheckRect(
+	const char *pszMethod,
+	GLD_hlSurface *pSurface,
+	const RECT *pRect,
+	RECT *pOut)
+{
+	if (!pRect) {
+		SetRect(pOut, 0, 0, pSurface->Desc.Width, pSurface->Desc.Height);
+		return TRUE;
+	}
+	*pOut = *pRect;
+	if (pOut->left < 0 || pOut->top < 0 || pOut->left >= pOut->right || pOut->top >= pOut->bottom ||
+		pOut->right > (LONG)pSurface->Desc.Width || pOut->bottom > (LONG)pSurface->Desc.Height)
+	{
+		gldHLError("%s: rectangle (%d,%d)-(%d,%d) outside %ux%u surface", pszMethod,
+			pOut->left, pOut->top, pOut->right, pOut->bottom, pSurface->Desc.Width, pSurface->Desc.Height);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+// ***********************************************************************
+
+static void _gldHLCopyRect(
+	GLD_hlSurface *pDst,
+	LONG x,
+	LONG y,
+	GLD_hlSurface *pSrc,
+	const RECT *pRect)
+{
+	// Same format; DXT rectangles are copied whole blocks at a time
+	UINT	nBlock = gldHLFormatIsDXT(pSrc->Desc.Format) ? 4 : 1;
+	UINT	nRowBytes, nRows, i;
+
+	nRows = (pRect->bottom - pRect->top + nBlock - 1) / nBlock;
+	nRowBytes = (UINT)(gldHLSurfaceRow(pSrc, pRect->right + nBlock - 1, pRect->top) - gldHLSurfaceRow(pSrc, pRect->left, pRect->top));
+	for (i=0; i<nRows; i++)
+		memcpy(gldHLSurfaceRow(pDst, x, y + i * nBlock), gldHLSurfaceRow(pSrc, pRect->left, pRect->top + i * nBlock), nRowBytes);
+}
+
+// ***********************************************************************
+
+static void _gldHLFill(
+	GLD_hlSurface *pSurface,
+	const RECT *pRect,
+	DWORD dwValue,
+	DWORD dwMask)
+{
+	// Bits outside dwMask are left alone
+	UINT	nBits = gldHLFormatBits(pSurface->Desc.Format);
+	LONG	x, y;
+	BYTE	*pRow;
+
+	for (y=pRect->top; y<pRect->bottom; y++) {
+		pRow = gldHLSurfaceRow(pSurface, pRect->left, y);
+		for (x=pRect->left; x<pRect->right; x++) {
+			switch (nBits) {
+			case 8:
+				*pRow = (BYTE)((*pRow & ~dwMask) | (dwValue & dwMask));
+				pRow += 1;
+				break;
+			case 16:
+				*(WORD*)pRow = (WORD)((*(WORD*)pRow & ~dwMask) | (dwValue & dwMask));
+				pRow += 2;
+				break;
+			case 32:
+				*(DWORD*)pRow = (*(DWORD*)pRow & ~dwMask) | (dwValue & dwMask);
+				pRow += 4;
+				break;
+			default:
+				// Formats nobody clears
+				return;
+			}
+		}
+	}
+}
+
+// ***********************************************************************
+
+static DWORD _gldHLPackColor(
+	D3DFORMAT Format,
+	D3DCOLOR Color)
+{
+	DWORD	a = (Color >> 24) & 0xFF;
+	DWORD	r = (Color >> 16) & 0xFF;
+	DWORD	g = (Color >> 8) & 0xFF;
+	DWORD	b = Color & 0xFF;
+
+	switch (Format) {
+	case D3DFMT_R5G6B5:
+		return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+	case D3DFMT_X1R5G5B5:
+	case D3DFMT_A1R5G5B5:
+		return ((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+	case D3DFMT_A4R4G4B4:
+	case D3DFMT_X4R4G4B4:
+		return ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);
+	case D3DFMT_A8B8G8R8:
+	case D3DFMT_X8B8G8R8:
+		return (a << 24) | (b << 16) | (g << 8) | r;
+	case D3DFMT_A8:
+		return a;
+	case D3DFMT_L8:
+		return r;
+	default:
+		return Color;
+	}
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevUpdateSurface(
+	GLD_hlDevice *This,
+	IDirect3DSurface9 *pSourceSurface,
+	const RECT *pSourceRect,
+	IDirect3DSurface9 *pDestinationSurface,
+	const POINT *pDestPoint)
+{
+	GLD_hlSurface	*pSrc = (GLD_hlSurface*)pSourceSurface;
+	GLD_hlSurface	*pDst = (GLD_hlSurface*)pDestinationSurface;
+	RECT			rc, rcDst;
+
+	_GLD_HL_COUNT(UpdateSurface);
+	if (pSrc->Desc.Pool != D3DPOOL_SYSTEMMEM || pDst->Desc.Pool != D3DPOOL_DEFAULT) {
+		gldHLError("UpdateSurface: copies from D3DPOOL_SYSTEMMEM to D3DPOOL_DEFAULT only");
+		return D3DERR_INVALIDCALL;
+	}
+	if (pSrc->Desc.Format != pDst->Desc.Format) {
+		gldHLError("UpdateSurface: formats differ");
+		return D3DERR_INVALIDCALL;
+	}
+	if (pSrc->bLocked || pDst->bLocked) {
+		gldHLError("UpdateSurface: surface is locked");
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLCheckRect("UpdateSurface", pSrc, pSourceRect, &rc))
+		return D3DERR_INVALIDCALL;
+	SetRect(&rcDst, 0, 0, rc.right - rc.left, rc.bottom - rc.top);
+	if (pDestPoint)
+		OffsetRect(&rcDst, pDestPoint->x, pDestPoint->y);
+	if (!_gldHLCheckRect("UpdateSurface", pDst, &rcDst, &rcDst))
+		return D3DERR_INVALIDCALL;
+	_gldHLCopyRect(pDst, rcDst.left, rcDst.top, pSrc, &rc);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevUpdateTexture(
+	GLD_hlDevice *This,
+	IDirect3DBaseTexture9 *pSourceTexture,
+	IDirect3DBaseTexture9 *pDestinationTexture)
+{
+	GLD_hlSurface	*pSrc, *pDst;
+	UINT			nSrcLevels, nDstLevels, nSrcFaces, nDstFaces, nSkip, f, i;
+
+	_GLD_HL_COUNT(UpdateTexture);
+	nSrcLevels = gldHLTextureLevels(pSourceTexture, &nSrcFaces);
+	nDstLevels = gldHLTextureLevels(pDestinationTexture, &nDstFaces);
+	if (!nSrcLevels || nSrcFaces != nDstFaces) {
+		gldHLError("UpdateTexture: texture types differ");
+		return D3DERR_INVALIDCALL;
+	}
+	pSrc = gldHLTextureSurface(pSourceTexture, 0, 0);
+	pDst = gldHLTextureSurface(pDestinationTexture, 0, 0);
+	if (pSrc->Desc.Pool != D3DPOOL_SYSTEMMEM || pDst->Desc.Pool != D3DPOOL_DEFAULT || pSrc->Desc.Format != pDst->Desc.Format) {
+		gldHLError("UpdateTexture: copies from D3DPOOL_SYSTEMMEM to D3DPOOL_DEFAULT of one format only");
+		return D3DERR_INVALIDCALL;
+	}
+
+	// The source may have extra levels above the destination's top level
+	for (nSkip=0; nSkip<nSrcLevels; nSkip++) {
+		pSrc = gldHLTextureSurface(pSourceTexture, 0, nSkip);
+		if (pSrc->Desc.Width == pDst->Desc.Width && pSrc->Desc.Height == pDst->Desc.Height)
+			break;
+	}
+	if (nSkip == nSrcLevels || nSrcLevels - nSkip < nDstLevels) {
+		gldHLError("UpdateTexture: levels don't match");
+		return D3DERR_INVALIDCALL;
+	}
+	for (f=0; f<nDstFaces; f++) {
+		for (i=0; i<nDstLevels; i++) {
+			pSrc = gldHLTextureSurface(pSourceTexture, f, i + nSkip);
+			pDst = gldHLTextureSurface(pDestinationTexture, f, i);
+			memcpy(pDst->pBits, pSrc->pBits, pSrc->Pitch * pSrc->Rows);
+		}
+	}
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetRenderTargetData(
+	GLD_hlDevice *This,
+	IDirect3DSurface9 *pRenderTarget,
+	IDirect3DSurface9 *pDestSurface)
+{
+	GLD_hlSurface	*pSrc = (GLD_hlSurface*)pRenderTarget;
+	GLD_hlSurface	*pDst = (GLD_hlSurface*)pDestSurface;
+
+	_GLD_HL_COUNT(GetRenderTargetData);
+	if (!(pSrc->Desc.Usage & D3DUSAGE_RENDERTARGET) || pDst->Desc.Pool != D3DPOOL_SYSTEMMEM) {
+		gldHLError("GetRenderTargetData: copies from a render target to D3DPOOL_SYSTEMMEM only");
+		return D3DERR_INVALIDCALL;
+	}
+	if (pSrc->Desc.Format != pDst->Desc.Format || pSrc->Desc.Width != pDst->Desc.Width || pSrc->Desc.Height != pDst->Desc.Height) {
+		gldHLError("GetRenderTargetData: %ux%u format %u into %ux%u format %u",
+			pSrc->Desc.Width, pSrc->Desc.Height, pSrc->Desc.Format,
+			pDst->Desc.Width, pDst->Desc.Height, pDst->Desc.Format);
+		return D3DERR_INVALIDCALL;
+	}
+	if (pDst->bLocked) {
+		gldHLError("GetRenderTargetData: surface is locked");
+		return D3DERR_INVALIDCALL;
+	}
+	memcpy(pDst->pBits, pSrc->pBits, pSrc->Pitch * pSrc->Rows);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetFrontBufferData(
+	GLD_hlDevice *This,
+	UINT iSwapChain,
+	IDirect3DSurface9 *pDestSurface)
+{
+	GLD_hlSurface	*pDst = (GLD_hlSurface*)pDestSurface;
+
+	_GLD_HL_COUNT(GetFrontBufferData);
+	if (pDst->Desc.Format != D3DFMT_A8R8G8B8 || pDst->Desc.Pool != D3DPOOL_SYSTEMMEM) {
+		gldHLError("GetFrontBufferData: needs a D3DFMT_A8R8G8B8 surface in D3DPOOL_SYSTEMMEM");
+		return D3DERR_INVALIDCALL;
+	}
+	// There is no screen
+	ZeroMemory(pDst->pBits, pDst->Pitch * pDst->Rows);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevStretchRect(
+	GLD_hlDevice *This,
+	IDirect3DSurface9 *pSourceSurface,
+	const RECT *pSourceRect,
+	IDirect3DSurface9 *pDestSurface,
+	const RECT *pDestRect,
+	D3DTEXTUREFILTERTYPE Filter)
+{
+	GLD_hlSurface	*pSrc = (GLD_hlSurface*)pSourceSurface;
+	GLD_hlSurface	*pDst = (GLD_hlSurface*)pDestSurface;
+	RECT			rcSrc, rcDst;
+	UINT			nBytes;
+	LONG			x, y, sx, sy;
+
+	_GLD_HL_COUNT(StretchRect);
+	if (pSrc->Desc.Pool != D3DPOOL_DEFAULT || pDst->Desc.Pool != D3DPOOL_DEFAULT) {
+		gldHLError("StretchRect: surfaces must be in D3DPOOL_DEFAULT");
+		return D3DERR_INVALIDCALL;
+	}
+	if (!(pDst->Desc.Usage & D3DUSAGE_RENDERTARGET)) {
+		gldHLError("StretchRect: destination is not a render target");
+		return D3DERR_INVALIDCALL;
+	}
+	if (This->bInScene && _gldHLIsDepthFormat(pSrc->Desc.Format)) {
+		gldHLError("StretchRect: depth copy inside BeginScene/EndScene");
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLCheckRect("StretchRect", pSrc, pSourceRect, &rcSrc) ||
+		!_gldHLCheckRect("StretchRect", pDst, pDestRect, &rcDst))
+	{
+		return D3DERR_INVALIDCALL;
+	}
+
+	// Point sampled; conversions between formats are not modelled
+	if (pSrc->Desc.Format != pDst->Desc.Format || gldHLFormatIsDXT(pSrc->Desc.Format))
+		return D3D_OK;
+	nBytes = gldHLFormatBits(pSrc->Desc.Format) / 8;
+	for (y=rcDst.top; y<rcDst.bottom; y++) {
+		sy = rcSrc.top + (y - rcDst.top) * (rcSrc.bottom - rcSrc.top) / (rcDst.bottom - rcDst.top);
+		for (x=rcDst.left; x<rcDst.right; x++) {
+			sx = rcSrc.left + (x - rcDst.left) * (rcSrc.right - rcSrc.left) / (rcDst.right - rcDst.left);
+			memcpy(gldHLSurfaceRow(pDst, x, y), gldHLSurfaceRow(pSrc, sx, sy), nBytes);
+		}
+	}
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevColorFill(
+	GLD_hlDevice *This,
+	IDirect3DSurface9 *pSurface,
+	const RECT *pRect,
+	D3DCOLOR color)
+{
+	GLD_hlSurface	*pSurf = (GLD_hlSurface*)pSurface;
+	RECT			rc;
+
+	_GLD_HL_COUNT(ColorFill);
+	if (pSurf->Desc.Pool != D3DPOOL_DEFAULT) {
+		gldHLError("ColorFill: surface must be in D3DPOOL_DEFAULT");
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLCheckRect("ColorFill", pSurf, pRect, &rc))
+		return D3DERR_INVALIDCALL;
+	_gldHLFill(pSurf, &rc, _gldHLPackColor(pSurf->Desc.Format, color), 0xFFFFFFFF);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Device: targets and scenes
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetRenderTarget(
+	GLD_hlDevice *This,
+	DWORD RenderTargetIndex,
+	IDirect3DSurface9 *pRenderTarget)
+{
+	GLD_hlSurface	*pRT = (GLD_hlSurface*)pRenderTarget;
+
+	_GLD_HL_COUNT(SetRenderTarget);
+	if (RenderTargetIndex >= GLD_HL_MAX_RENDERTARGETS || (!RenderTargetIndex && !pRT)) {
+		gldHLError("SetRenderTarget: index %u", RenderTargetIndex);
+		return D3DERR_INVALIDCALL;
+	}
+	if (pRT && !(pRT->Desc.Usage & D3DUSAGE_RENDERTARGET)) {
+		gldHLError("SetRenderTarget: surface without D3DUSAGE_RENDERTARGET");
+		return D3DERR_INVALIDCALL;
+	}
+	gldHLBind(&This->pRenderTargets[RenderTargetIndex], pRT);
+
+	// The viewport and scissor follow the first target
+	if (!RenderTargetIndex) {
+		This->Viewport.X		= 0;
+		This->Viewport.Y		= 0;
+		This->Viewport.Width	= pRT->Desc.Width;
+		This->Viewport.Height	= pRT->Desc.Height;
+		This->Viewport.MinZ		= 0.0f;
+		This->Viewport.MaxZ		= 1.0f;
+		SetRect(&This->rcScissor, 0, 0, pRT->Desc.Width, pRT->Desc.Height);
+	}
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetRenderTarget(
+	GLD_hlDevice *This,
+	DWORD RenderTargetIndex,
+	IDirect3DSurface9 **ppRenderTarget)
+{
+	_GLD_HL_COUNT(GetRenderTarget);
+	*ppRenderTarget = NULL;
+	if (RenderTargetIndex >= GLD_HL_MAX_RENDERTARGETS)
+		return D3DERR_INVALIDCALL;
+	if (!This->pRenderTargets[RenderTargetIndex])
+		return D3DERR_NOTFOUND;
+	gldHLAddRef(This->pRenderTargets[RenderTargetIndex]);
+	*ppRenderTarget = This->pRenderTargets[RenderTargetIndex];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetDepthStencilSurface(
+	GLD_hlDevice *This,
+	IDirect3DSurface9 *pNewZStencil)
+{
+	GLD_hlSurface	*pZ = (GLD_hlSurface*)pNewZStencil;
+
+	_GLD_HL_COUNT(SetDepthStencilSurface);
+	if (pZ && !(pZ->Desc.Usage & D3DUSAGE_DEPTHSTENCIL)) {
+		gldHLError("SetDepthStencilSurface: surface without D3DUSAGE_DEPTHSTENCIL");
+		return D3DERR_INVALIDCALL;
+	}
+	gldHLBind(&This->pDepthStencil, pZ);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetDepthStencilSurface(
+	GLD_hlDevice *This,
+	IDirect3DSurface9 **ppZStencilSurface)
+{
+	_GLD_HL_COUNT(GetDepthStencilSurface);
+	*ppZStencilSurface = This->pDepthStencil;
+	if (!This->pDepthStencil)
+		return D3DERR_NOTFOUND;
+	gldHLAddRef(This->pDepthStencil);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevBeginScene(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(BeginScene);
+	if (This->bInScene) {
+		gldHLError("BeginScene: already inside BeginScene/EndScene");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bInScene = TRUE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevEndScene(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(EndScene);
+	if (!This->bInScene) {
+		gldHLError("EndScene: without BeginScene");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bInScene = FALSE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevClear(
+	GLD_hlDevice *This,
+	DWORD Count,
+	const D3DRECT *pRects,
+	DWORD Flags,
+	D3DCOLOR Color,
+	float Z,
+	DWORD Stencil)
+{
+	GLD_hlSurface	*pRT = (GLD_hlSurface*)This->pRenderTargets[0];
+	GLD_hlSurface	*pZ = (GLD_hlSurface*)This->pDepthStencil;
+	RECT			rcView, rc;
+	DWORD			dwDepth = 0, dwMask = 0, i;
+	BOOL			bStencil;
+
+	_GLD_HL_COUNT(Clear);
+	if ((Count && !pRects) || (!Count && pRects)) {
+		gldHLError("Clear: %u rectangles at %p", Count, pRects);
+		return D3DERR_INVALIDCALL;
+	}
+	if ((Flags & (D3DCLEAR_ZBUFFER | D3DCLEAR_STENCIL)) && !pZ) {
+		gldHLError("Clear: depth or stencil without a depth buffer");
+		return D3DERR_INVALIDCALL;
+	}
+	bStencil = pZ && (pZ->Desc.Format == D3DFMT_D24S8 || pZ->Desc.Format == D3DFMT_D24FS8 ||
+		pZ->Desc.Format == D3DFMT_D24X4S4 || pZ->Desc.Format == D3DFMT_D15S1);
+	if ((Flags & D3DCLEAR_STENCIL) && !bStencil) {
+		gldHLError("Clear: stencil on a depth buffer without stencil");
+		return D3DERR_INVALIDCALL;
+	}
+
+	// The viewport, and the scissor rectangle if it is enabled, limit a clear
+	SetRect(&rcView, This->Viewport.X, This->Viewport.Y,
+		This->Viewport.X + This->Viewport.Width, This->Viewport.Y + This->Viewport.Height);
+	if (This->RenderStates[D3DRS_SCISSORTESTENABLE])
+		IntersectRect(&rcView, &rcView, &This->rcScissor);
+
+	if (pZ) {
+		switch (pZ->Desc.Format) {
+		case D3DFMT_D16:
+		case D3DFMT_D16_LOCKABLE:
+			dwDepth = (DWORD)(Z * 0xFFFF);
+			dwMask	= (Flags & D3DCLEAR_ZBUFFER) ? 0xFFFF : 0;
+			break;
+		case D3DFMT_D15S1:
+			dwDepth = ((DWORD)(Z * 0x7FFF) << 1) | (Stencil & 1);
+			dwMask	= ((Flags & D3DCLEAR_ZBUFFER) ? 0xFFFE : 0) | ((Flags & D3DCLEAR_STENCIL) ? 1 : 0);
+			break;
+		case D3DFMT_D32:
+			dwDepth = (DWORD)(Z * 4294967295.0);
+			dwMask	= (Flags & D3DCLEAR_ZBUFFER) ? 0xFFFFFFFF : 0;
+			break;
+		case D3DFMT_D32F_LOCKABLE:
+			dwDepth = *(DWORD*)&Z;
+			dwMask	= (Flags & D3DCLEAR_ZBUFFER) ? 0xFFFFFFFF : 0;
+			break;
+		default:
+			// 24 bits of depth over 8 of stencil
+			dwDepth = ((DWORD)(Z * 0xFFFFFF) << 8) | (Stencil & 0xFF);
+			dwMask	= ((Flags & D3DCLEAR_ZBUFFER) ? 0xFFFFFF00 : 0) | ((Flags & D3DCLEAR_STENCIL) ? 0xFF : 0);
+			break;
+		}
+	}
+
+	for (i=0; i<max(Count, 1); i++) {
+		rc = rcView;
+		if (Count) {
+			RECT	rcClear;
+			SetRect(&rcClear, pRects[i].x1, pRects[i].y1, pRects[i].x2, pRects[i].y2);
+			if (!IntersectRect(&rc, &rc, &rcClear))
+				continue;
+		}
+		if ((Flags & D3DCLEAR_TARGET) && pRT) {
+			RECT	rcRT;
+			SetRect(&rcRT, 0, 0, pRT->Desc.Width, pRT->Desc.Height);
+			if (IntersectRect(&rcRT, &rcRT, &rc))
+				_gldHLFill(pRT, &rcRT, _gldHLPackColor(pRT->Desc.Format, Color), 0xFFFFFFFF);
+		}
+		if (dwMask) {
+			RECT	rcZ;
+			SetRect(&rcZ, 0, 0, pZ->Desc.Width, pZ->Desc.Height);
+			if (IntersectRect(&rcZ, &rcZ, &rc))
+				_gldHLFill(pZ, &rcZ, dwDepth, dwMask);
+		}
+	}
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Device: fixed function state
+// ***********************************************************************
+
+static void _gldHLMultiply(
+	D3DMATRIX *pOut,
+	const D3DMATRIX *pA,
+	const D3DMATRIX *pB)
+{
+	D3DMATRIX	m;
+	int			i, j, k;
+
+	for (i=0; i<4; i++) {
+		for (j=0; j<4; j++) {
+			m.m[i][j] = 0.0f;
+			for (k=0; k<4; k++)
+				m.m[i][j] += pA->m[i][k] * pB->m[k][j];
+		}
+	}
+	*pOut = m;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetTransform(
+	GLD_hlDevice *This,
+	D3DTRANSFORMSTATETYPE State,
+	const D3DMATRIX *pMatrix)
+{
+	_GLD_HL_COUNT(SetTransform);
+	if ((DWORD)State >= GLD_HL_MAX_TRANSFORMS || !pMatrix) {
+		gldHLError("SetTransform: state %u", State);
+		return D3DERR_INVALIDCALL;
+	}
+	This->Transforms[State] = *pMatrix;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetTransform(
+	GLD_hlDevice *This,
+	D3DTRANSFORMSTATETYPE State,
+	D3DMATRIX *pMatrix)
+{
+	_GLD_HL_COUNT(GetTransform);
+	if ((DWORD)State >= GLD_HL_MAX_TRANSFORMS)
+		return D3DERR_INVALIDCALL;
+	*pMatrix = This->Transforms[State];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevMultiplyTransform(
+	GLD_hlDevice *This,
+	D3DTRANSFORMSTATETYPE State,
+	const D3DMATRIX *pMatrix)
+{
+	_GLD_HL_COUNT(MultiplyTransform);
+	if ((DWORD)State >= GLD_HL_MAX_TRANSFORMS)
+		return D3DERR_INVALIDCALL;
+	_gldHLMultiply(&This->Transforms[State], pMatrix, &This->Transforms[State]);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetViewport(
+	GLD_hlDevice *This,
+	const D3DVIEWPORT9 *pViewport)
+{
+	GLD_hlSurface	*pRT = (GLD_hlSurface*)This->pRenderTargets[0];
+
+	_GLD_HL_COUNT(SetViewport);
+	if (pViewport->X + pViewport->Width > pRT->Desc.Width || pViewport->Y + pViewport->Height > pRT->Desc.Height ||
+		pViewport->MinZ < 0.0f || pViewport->MaxZ > 1.0f)
+	{
+		gldHLError("SetViewport: (%u,%u) %ux%u outside %ux%u target", pViewport->X, pViewport->Y,
+			pViewport->Width, pViewport->Height, pRT->Desc.Width, pRT->Desc.Height);
+		return D3DERR_INVALIDCALL;
+	}
+	This->Viewport = *pViewport;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetViewport(
+	GLD_hlDevice *This,
+	D3DVIEWPORT9 *pViewport)
+{
+	_GLD_HL_COUNT(GetViewport);
+	*pViewport = This->Viewport;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetMaterial(
+	GLD_hlDevice *This,
+	const D3DMATERIAL9 *pMaterial)
+{
+	_GLD_HL_COUNT(SetMaterial);
+	This->Material = *pMaterial;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetMaterial(
+	GLD_hlDevice *This,
+	D3DMATERIAL9 *pMaterial)
+{
+	_GLD_HL_COUNT(GetMaterial);
+	*pMaterial = This->Material;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetLight(
+	GLD_hlDevice *This,
+	DWORD Index,
+	const D3DLIGHT9 *pLight)
+{
+	_GLD_HL_COUNT(SetLight);
+	if (Index >= GLD_HL_MAX_LIGHTS) {
+		gldHLError("SetLight: index %u", Index);
+		return D3DERR_INVALIDCALL;
+	}
+	This->Lights[Index] = *pLight;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetLight(
+	GLD_hlDevice *This,
+	DWORD Index,
+	D3DLIGHT9 *pLight)
+{
+	_GLD_HL_COUNT(GetLight);
+	if (Index >= GLD_HL_MAX_LIGHTS)
+		return D3DERR_INVALIDCALL;
+	*pLight = This->Lights[Index];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevLightEnable(
+	GLD_hlDevice *This,
+	DWORD Index,
+	BOOL Enable)
+{
+	_GLD_HL_COUNT(LightEnable);
+	if (Index >= GLD_HL_MAX_LIGHTS) {
+		gldHLError("LightEnable: index %u", Index);
+		return D3DERR_INVALIDCALL;
+	}
+	This->bLightEnable[Index] = Enable ? TRUE : FALSE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetLightEnable(
+	GLD_hlDevice *This,
+	DWORD Index,
+	BOOL *pEnable)
+{
+	_GLD_HL_COUNT(GetLightEnable);
+	if (Index >= GLD_HL_MAX_LIGHTS)
+		return D3DERR_INVALIDCALL;
+	*pEnable = This->bLightEnable[Index];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetClipPlane(
+	GLD_hlDevice *This,
+	DWORD Index,
+	const float *pPlane)
+{
+	_GLD_HL_COUNT(SetClipPlane);
+	if (Index >= GLD_HL_MAX_CLIPPLANES) {
+		gldHLError("SetClipPlane: index %u", Index);
+		return D3DERR_INVALIDCALL;
+	}
+	memcpy(This->ClipPlanes[Index], pPlane, sizeof(This->ClipPlanes[Index]));
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetClipPlane(
+	GLD_hlDevice *This,
+	DWORD Index,
+	float *pPlane)
+{
+	_GLD_HL_COUNT(GetClipPlane);
+	if (Index >= GLD_HL_MAX_CLIPPLANES)
+		return D3DERR_INVALIDCALL;
+	memcpy(pPlane, This->ClipPlanes[Index], sizeof(This->ClipPlanes[Index]));
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetRenderState(
+	GLD_hlDevice *This,
+	D3DRENDERSTATETYPE State,
+	DWORD Value)
+{
+	_GLD_HL_COUNT(SetRenderState);
+	if ((DWORD)State >= 256) {
+		gldHLError("SetRenderState: state %u", State);
+		return D3DERR_INVALIDCALL;
+	}
+	This->RenderStates[State] = Value;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetRenderState(
+	GLD_hlDevice *This,
+	D3DRENDERSTATETYPE State,
+	DWORD *pValue)
+{
+	_GLD_HL_COUNT(GetRenderState);
+	if ((DWORD)State >= 256)
+		return D3DERR_INVALIDCALL;
+	*pValue = This->RenderStates[State];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateStateBlock(
+	GLD_hlDevice *This,
+	D3DSTATEBLOCKTYPE Type,
+	IDirect3DStateBlock9 **ppSB)
+{
+	_GLD_HL_COUNT(CreateStateBlock);
+	return gldHLCreateStateBlock(This, Type, (GLD_hlStateBlock**)ppSB);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevBeginStateBlock(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(BeginStateBlock);
+	if (This->bRecording) {
+		gldHLError("BeginStateBlock: already recording");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bRecording = TRUE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevEndStateBlock(
+	GLD_hlDevice *This,
+	IDirect3DStateBlock9 **ppSB)
+{
+	_GLD_HL_COUNT(EndStateBlock);
+	if (!This->bRecording) {
+		*ppSB = NULL;
+		gldHLError("EndStateBlock: without BeginStateBlock");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bRecording = FALSE;
+	return gldHLCreateStateBlock(This, D3DSBT_ALL, (GLD_hlStateBlock**)ppSB);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetClipStatus(
+	GLD_hlDevice *This,
+	const D3DCLIPSTATUS9 *pClipStatus)
+{
+	_GLD_HL_COUNT(SetClipStatus);
+	This->ClipStatus = *pClipStatus;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetClipStatus(
+	GLD_hlDevice *This,
+	D3DCLIPSTATUS9 *pClipStatus)
+{
+	_GLD_HL_COUNT(GetClipStatus);
+	*pClipStatus = This->ClipStatus;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Device: textures and samplers
+// ***********************************************************************
+
+int gldHLSampler(
+	DWORD Sampler)
+{
+	// Pixel samplers, then the displacement map and vertex samplers
+	if (Sampler < 16)
+		return Sampler;
+	if (Sampler >= 256 && Sampler <= 260)
+		return Sampler - 256 + 16;
+	return -1;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetTexture(
+	GLD_hlDevice *This,
+	DWORD Stage,
+	IDirect3DBaseTexture9 **ppTexture)
+{
+	int		s = gldHLSampler(Stage);
+
+	_GLD_HL_COUNT(GetTexture);
+	*ppTexture = NULL;
+	if (s < 0)
+		return D3DERR_INVALIDCALL;
+	*ppTexture = This->pTextures[s];
+	if (*ppTexture)
+		gldHLAddRef(*ppTexture);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetTexture(
+	GLD_hlDevice *This,
+	DWORD Stage,
+	IDirect3DBaseTexture9 *pTexture)
+{
+	int		s = gldHLSampler(Stage);
+
+	_GLD_HL_COUNT(SetTexture);
+	if (s < 0) {
+		gldHLError("SetTexture: sampler %u", Stage);
+		return D3DERR_INVALIDCALL;
+	}
+	if (pTexture && ((GLD_hlObject*)pTexture)->Kind != GLD_HL_TEXTURE &&
+		((GLD_hlObject*)pTexture)->Kind != GLD_HL_CUBETEXTURE && ((GLD_hlObject*)pTexture)->Kind != GLD_HL_VOLUMETEXTURE)
+	{
+		gldHLError("SetTexture: object is not a texture");
+		return D3DERR_INVALIDCALL;
+	}
+	gldHLBind(&This->pTextures[s], pTexture);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetTextureStageState(
+	GLD_hlDevice *This,
+	DWORD Stage,
+	D3DTEXTURESTAGESTATETYPE Type,
+	DWORD *pValue)
+{
+	_GLD_HL_COUNT(GetTextureStageState);
+	if (Stage >= GLD_HL_MAX_STAGES || (DWORD)Type >= 33)
+		return D3DERR_INVALIDCALL;
+	*pValue = This->StageStates[Stage][Type];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetTextureStageState(
+	GLD_hlDevice *This,
+	DWORD Stage,
+	D3DTEXTURESTAGESTATETYPE Type,
+	DWORD Value)
+{
+	_GLD_HL_COUNT(SetTextureStageState);
+	if (Stage >= GLD_HL_MAX_STAGES || (DWORD)Type >= 33) {
+		gldHLError("SetTextureStageState: stage %u state %u", Stage, Type);
+		return D3DERR_INVALIDCALL;
+	}
+	This->StageStates[Stage][Type] = Value;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetSamplerState(
+	GLD_hlDevice *This,
+	DWORD Sampler,
+	D3DSAMPLERSTATETYPE Type,
+	DWORD *pValue)
+{
+	int		s = gldHLSampler(Sampler);
+
+	_GLD_HL_COUNT(GetSamplerState);
+	if (s < 0 || (DWORD)Type >= 14)
+		return D3DERR_INVALIDCALL;
+	*pValue = This->SamplerStates[s][Type];
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetSamplerState(
+	GLD_hlDevice *This,
+	DWORD Sampler,
+	D3DSAMPLERSTATETYPE Type,
+	DWORD Value)
+{
+	int		s = gldHLSampler(Sampler);
+
+	_GLD_HL_COUNT(SetSamplerState);
+	if (s < 0 || (DWORD)Type >= 14) {
+		gldHLError("SetSamplerState: sampler %u state %u", Sampler, Type);
+		return D3DERR_INVALIDCALL;
+	}
+	This->SamplerStates[s][Type] = Value;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevValidateDevice(
+	GLD_hlDevice *This,
+	DWORD *pNumPasses)
+{
+	_GLD_HL_COUNT(ValidateDevice);
+	*pNumPasses = 1;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetPaletteEntries(
+	GLD_hlDevice *This,
+	UINT PaletteNumber,
+	const PALETTEENTRY *pEntries)
+{
+	_GLD_HL_COUNT(SetPaletteEntries);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetPaletteEntries(
+	GLD_hlDevice *This,
+	UINT PaletteNumber,
+	PALETTEENTRY *pEntries)
+{
+	_GLD_HL_COUNT(GetPaletteEntries);
+	ZeroMemory(pEntries, 256 * sizeof(PALETTEENTRY));
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetCurrentTexturePalette(
+	GLD_hlDevice *This,
+	UINT PaletteNumber)
+{
+	_GLD_HL_COUNT(SetCurrentTexturePalette);
+	This->uPalette = PaletteNumber;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetCurrentTexturePalette(
+	GLD_hlDevice *This,
+	UINT *PaletteNumber)
+{
+	_GLD_HL_COUNT(GetCurrentTexturePalette);
+	*PaletteNumber = This->uPalette;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetScissorRect(
+	GLD_hlDevice *This,
+	const RECT *pRect)
+{
+	_GLD_HL_COUNT(SetScissorRect);
+	if (pRect->left > pRect->right || pRect->top > pRect->bottom) {
+		gldHLError("SetScissorRect: (%d,%d)-(%d,%d)", pRect->left, pRect->top, pRect->right, pRect->bottom);
+		return D3DERR_INVALIDCALL;
+	}
+	This->rcScissor = *pRect;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetScissorRect(
+	GLD_hlDevice *This,
+	RECT *pRect)
+{
+	_GLD_HL_COUNT(GetScissorRect);
+	*pRect = This->rcScissor;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetSoftwareVertexProcessing(
+	GLD_hlDevice *This,
+	BOOL bSoftware)
+{
+	_GLD_HL_COUNT(SetSoftwareVertexProcessing);
+	if (!(This->Params.BehaviorFlags & D3DCREATE_MIXED_VERTEXPROCESSING) &&
+		bSoftware != ((This->Params.BehaviorFlags & D3DCREATE_SOFTWARE_VERTEXPROCESSING) != 0))
+	{
+		gldHLError("SetSoftwareVertexProcessing: needs D3DCREATE_MIXED_VERTEXPROCESSING");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bSoftwareVP = bSoftware;
+	return D3D_OK;
+}
+
+static BOOL STDMETHODCALLTYPE _gldHLDevGetSoftwareVertexProcessing(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(GetSoftwareVertexProcessing);
+	return This->bSoftwareVP;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetNPatchMode(
+	GLD_hlDevice *This,
+	float nSegments)
+{
+	_GLD_HL_COUNT(SetNPatchMode);
+	This->fNPatchSegments = nSegments;
+	return D3D_OK;
+}
+
+static float STDMETHODCALLTYPE _gldHLDevGetNPatchMode(
+	GLD_hlDevice *This)
+{
+	_GLD_HL_COUNT(GetNPatchMode);
+	return This->fNPatchSegments;
+}
+
+// ***********************************************************************
+// Device: drawing
+// ***********************************************************************
+
+static UINT _gldHLPrimVerts(
+	D3DPRIMITIVETYPE Type,
+	UINT PrimitiveCount)
+{
+	switch (Type) {
+	case D3DPT_POINTLIST:		return PrimitiveCount;
+	case D3DPT_LINELIST:		return PrimitiveCount * 2;
+	case D3DPT_LINESTRIP:		return PrimitiveCount + 1;
+	case D3DPT_TRIANGLELIST:	return PrimitiveCount * 3;
+	case D3DPT_TRIANGLESTRIP:
+	case D3DPT_TRIANGLEFAN:		return PrimitiveCount + 2;
+	default:					return 0;
+	}
+}
+
+// ***********************************************************************
+
+static UINT _gldHLDeclTypeSize(
+	BYTE Type)
+{
+	switch (Type) {
+	case D3DDECLTYPE_FLOAT1:	return 4;
+	case D3DDECLTYPE_FLOAT2:	return 8;
+	case D3DDECLTYPE_FLOAT3:	return 12;
+	case D3DDECLTYPE_FLOAT4:	return 16;
+	case D3DDECLTYPE_SHORT4:
+	case D3DDECLTYPE_SHORT4N:
+	case D3DDECLTYPE_USHORT4N:
+	case D3DDECLTYPE_FLOAT16_4:	return 8;
+	default:					return 4;
+	}
+}
+
+static UINT _gldHLFVFSize(
+	DWORD FVF)
+{
+	static const UINT	nTexSize[4] = {8, 12, 16, 4};
+	UINT				nSize = 0, nTex, i;
+
+	switch (FVF & D3DFVF_POSITION_MASK) {
+	case D3DFVF_XYZ:	nSize = 12;	break;
+	case D3DFVF_XYZRHW:
+	case D3DFVF_XYZW:	nSize = 16;	break;
+	default:			nSize = 12 + ((((FVF & D3DFVF_POSITION_MASK) - 4) / 2) * 4);	break;
+	}
+	if (FVF & D3DFVF_NORMAL)	nSize += 12;
+	if (FVF & D3DFVF_PSIZE)		nSize += 4;
+	if (FVF & D3DFVF_DIFFUSE)	nSize += 4;
+	if (FVF & D3DFVF_SPECULAR)	nSize += 4;
+	nTex = (FVF & D3DFVF_TEXCOUNT_MASK) >> D3DFVF_TEXCOUNT_SHIFT;
+	for (i=0; i<nTex; i++)
+		nSize += nTexSize[(FVF >> (16 + i * 2)) & 3];
+	return nSize;
+}
+
+// ***********************************************************************
+
+static BOOL _gldHLCheckInput(
+	GLD_hlDevice *This,
+	const char *pszMethod,
+	UINT UPStride)
+{
+	// The vertex layout has to fit in the strides of the streams it reads
+	GLD_hlDeclaration	*pDecl = (GLD_hlDeclaration*)This->pDecl;
+	UINT				i, nStride;
+
+	if (!This->bInScene) {
+		gldHLError("%s: outside BeginScene/EndScene", pszMethod);
+		return FALSE;
+	}
+	if (!pDecl && !This->dwFVF) {
+		gldHLError("%s: no vertex declaration or FVF", pszMethod);
+		return FALSE;
+	}
+	if (!pDecl) {
+		nStride = UPStride ? UPStride : This->Streams[0].Stride;
+		if (_gldHLFVFSize(This->dwFVF) > nStride) {
+			gldHLError("%s: FVF 0x%x needs %u bytes, stride is %u", pszMethod, This->dwFVF, _gldHLFVFSize(This->dwFVF), nStride);
+			return FALSE;
+		}
+		return TRUE;
+	}
+	for (i=0; i+1<pDecl->nElements; i++) {
+		const D3DVERTEXELEMENT9	*e = &pDecl->pElements[i];
+
+		if (UPStride && e->Stream) {
+			gldHLError("%s: declaration reads stream %u", pszMethod, e->Stream);
+			return FALSE;
+		}
+		nStride = UPStride ? UPStride : This->Streams[e->Stream].Stride;
+		if (!UPStride && !This->Streams[e->Stream].pVB) {
+			gldHLError("%s: no vertex buffer on stream %u", pszMethod, e->Stream);
+			return FALSE;
+		}
+		if (e->Offset + _gldHLDeclTypeSize(e->Type) > nStride) {
+			gldHLError("%s: element at offset %u overruns stride %u of stream %u", pszMethod, e->Offset, nStride, e->Stream);
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+// ***********************************************************************
+
+static BOOL _gldHLCheckStreams(
+	GLD_hlDevice *This,
+	const char *pszMethod,
+	INT First,
+	UINT nVerts)
+{
+	// Every stream read must hold the vertices the draw references
+	GLD_hlBuffer	*pVB;
+	UINT			i, nEnd;
+
+	for (i=0; i<GLD_HL_MAX_STREAMS; i++) {
+		pVB = (GLD_hlBuffer*)This->Streams[i].pVB;
+		if (!pVB)
+			continue;
+		if (i && !This->pDecl)
+			break;
+		if (First < 0) {
+			gldHLError("%s: negative first vertex %d", pszMethod, First);
+			return FALSE;
+		}
+		if (pVB->bLocked) {
+			gldHLError("%s: vertex buffer on stream %u is locked", pszMethod, i);
+			return FALSE;
+		}
+		nEnd = This->Streams[i].Offset + (First + nVerts) * This->Streams[i].Stride;
+		if (nEnd > pVB->Size) {
+			gldHLError("%s: vertices %d..%u of stream %u end at byte %u of %u",
+				pszMethod, First, First + nVerts - 1, i, nEnd, pVB->Size);
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+// ***********************************************************************
+
+static void _gldHLRecordDraw(
+	GLD_hlDevice *This,
+	D3DPRIMITIVETYPE Type,
+	BOOL bIndexed,
+	BOOL bUP,
+	INT BaseVertexIndex,
+	UINT MinIndex,
+	UINT NumVertices,
+	UINT Start,
+	UINT PrimitiveCount)
+{
+	gldHLStats.dwDraws++;
+	gldHLStats.dwPrims		+= PrimitiveCount;
+	gldHLStats.dwVertices	+= NumVertices;
+
+	gldHLLastDraw.Type				= Type;
+	gldHLLastDraw.bIndexed			= bIndexed;
+	gldHLLastDraw.bUP				= bUP;
+	gldHLLastDraw.BaseVertexIndex	= BaseVertexIndex;
+	gldHLLastDraw.MinIndex			= MinIndex;
+	gldHLLastDraw.NumVertices		= NumVertices;
+	gldHLLastDraw.Start				= Start;
+	gldHLLastDraw.PrimitiveCount	= PrimitiveCount;
+	gldHLLastDraw.pVB				= bUP ? NULL : This->Streams[0].pVB;
+	gldHLLastDraw.Offset			= bUP ? 0 : This->Streams[0].Offset;
+	gldHLLastDraw.Stride			= This->Streams[0].Stride;
+	gldHLLastDraw.pIB				= (bIndexed && !bUP) ? This->pIndices : NULL;
+	gldHLLastDraw.FVF				= This->dwFVF;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevDrawPrimitive(
+	GLD_hlDevice *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT StartVertex,
+	UINT PrimitiveCount)
+{
+	UINT	nVerts = _gldHLPrimVerts(PrimitiveType, PrimitiveCount);
+
+	_GLD_HL_COUNT(DrawPrimitive);
+	if (!nVerts || !PrimitiveCount) {
+		gldHLError("DrawPrimitive: %u primitives of type %u", PrimitiveCount, PrimitiveType);
+		return D3DERR_INVALIDCALL;
+	}
+	if (!This->Streams[0].pVB) {
+		gldHLError("DrawPrimitive: no vertex buffer on stream 0");
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLCheckInput(This, "DrawPrimitive", 0) ||
+		!_gldHLCheckStreams(This, "DrawPrimitive", StartVertex, nVerts))
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	_gldHLRecordDraw(This, PrimitiveType, FALSE, FALSE, 0, StartVertex, nVerts, StartVertex, PrimitiveCount);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static BOOL _gldHLCheckIndices(
+	const char *pszMethod,
+	const BYTE *pIndices,
+	BOOL b32,
+	UINT nIndices,
+	UINT MinIndex,
+	UINT NumVertices)
+{
+	// Indices must lie in the range the draw declared
+	UINT	i, n;
+
+	for (i=0; i<nIndices; i++) {
+		n = b32 ? ((const DWORD*)pIndices)[i] : ((const WORD*)pIndices)[i];
+		if (n < MinIndex || n >= MinIndex + NumVertices) {
+			gldHLError("%s: index %u is %u, outside %u..%u", pszMethod, i, n, MinIndex, MinIndex + NumVertices - 1);
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevDrawIndexedPrimitive(
+	GLD_hlDevice *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	INT BaseVertexIndex,
+	UINT MinVertexIndex,
+	UINT NumVertices,
+	UINT startIndex,
+	UINT primCount)
+{
+	GLD_hlBuffer	*pIB = (GLD_hlBuffer*)This->pIndices;
+	UINT			nIndices = _gldHLPrimVerts(PrimitiveType, primCount);
+	UINT			nIndexSize;
+
+	_GLD_HL_COUNT(DrawIndexedPrimitive);
+	if (!nIndices || !primCount || !NumVertices) {
+		gldHLError("DrawIndexedPrimitive: %u primitives of type %u over %u vertices", primCount, PrimitiveType, NumVertices);
+		return D3DERR_INVALIDCALL;
+	}
+	if (!pIB || !This->Streams[0].pVB) {
+		gldHLError("DrawIndexedPrimitive: no %s", pIB ? "vertex buffer on stream 0" : "index buffer");
+		return D3DERR_INVALIDCALL;
+	}
+	if (pIB->bLocked) {
+		gldHLError("DrawIndexedPrimitive: index buffer is locked");
+		return D3DERR_INVALIDCALL;
+	}
+	nIndexSize = (pIB->Format == D3DFMT_INDEX32) ? 4 : 2;
+	if ((startIndex + nIndices) * nIndexSize > pIB->Size) {
+		gldHLError("DrawIndexedPrimitive: indices %u..%u overrun %u byte index buffer", startIndex, startIndex + nIndices - 1, pIB->Size);
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLCheckInput(This, "DrawIndexedPrimitive", 0) ||
+		!_gldHLCheckIndices("DrawIndexedPrimitive", pIB->pData + startIndex * nIndexSize, nIndexSize == 4, nIndices, MinVertexIndex, NumVertices) ||
+		!_gldHLCheckStreams(This, "DrawIndexedPrimitive", BaseVertexIndex + (INT)MinVertexIndex, NumVertices))
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	_gldHLRecordDraw(This, PrimitiveType, TRUE, FALSE, BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevDrawPrimitiveUP(
+	GLD_hlDevice *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT PrimitiveCount,
+	const void *pVertexStreamZeroData,
+	UINT VertexStreamZeroStride)
+{
+	UINT	nVerts = _gldHLPrimVerts(PrimitiveType, PrimitiveCount);
+
+	_GLD_HL_COUNT(DrawPrimitiveUP);
+	if (!nVerts || !PrimitiveCount || !pVertexStreamZeroData || !VertexStreamZeroStride) {
+		gldHLError("DrawPrimitiveUP: %u primitives of type %u, stride %u", PrimitiveCount, PrimitiveType, VertexStreamZeroStride);
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLCheckInput(This, "DrawPrimitiveUP", VertexStreamZeroStride))
+		return D3DERR_INVALIDCALL;
+
+	// As the runtime does, stream 0 is left unset afterwards
+	gldHLBind(&This->Streams[0].pVB, NULL);
+	This->Streams[0].Offset = 0;
+	This->Streams[0].Stride = VertexStreamZeroStride;
+	gldHLStats.qwUPBytes += nVerts * VertexStreamZeroStride;
+	_gldHLRecordDraw(This, PrimitiveType, FALSE, TRUE, 0, 0, nVerts, 0, PrimitiveCount);
+	This->Streams[0].Stride = 0;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevDrawIndexedPrimitiveUP(
+	GLD_hlDevice *This,
+	D3DPRIMITIVETYPE PrimitiveType,
+	UINT MinVertexIndex,
+	UINT NumVertices,
+	UINT PrimitiveCount,
+	const void *pIndexData,
+	D3DFORMAT IndexDataFormat,
+	const void *pVertexStreamZeroData,
+	UINT VertexStreamZeroStride)
+{
+	UINT	nIndices = _gldHLPrimVerts(PrimitiveType, PrimitiveCount);
+	UINT	nIndexSize = (IndexDataFormat == D3DFMT_INDEX32) ? 4 : 2;
+
+	_GLD_HL_COUNT(DrawIndexedPrimitiveUP);
+	if (!nIndices || !PrimitiveCount || !NumVertices || !pIndexData || !pVertexStreamZeroData || !VertexStreamZeroStride ||
+		(IndexDataFormat != D3DFMT_INDEX16 && IndexDataFormat != D3DFMT_INDEX32))
+	{
+		gldHLError("DrawIndexedPrimitiveUP: %u primitives of type %u, stride %u", PrimitiveCount, PrimitiveType, VertexStreamZeroStride);
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLCheckInput(This, "DrawIndexedPrimitiveUP", VertexStreamZeroStride) ||
+		!_gldHLCheckIndices("DrawIndexedPrimitiveUP", pIndexData, nIndexSize == 4, nIndices, MinVertexIndex, NumVertices))
+	{
+		return D3DERR_INVALIDCALL;
+	}
+
+	// Stream 0 and the indices are left unset afterwards
+	gldHLBind(&This->Streams[0].pVB, NULL);
+	gldHLBind(&This->pIndices, NULL);
+	This->Streams[0].Offset = 0;
+	This->Streams[0].Stride = VertexStreamZeroStride;
+	gldHLStats.qwUPBytes += (MinVertexIndex + NumVertices) * VertexStreamZeroStride + nIndices * nIndexSize;
+	_gldHLRecordDraw(This, PrimitiveType, TRUE, TRUE, 0, MinVertexIndex, NumVertices, 0, PrimitiveCount);
+	This->Streams[0].Stride = 0;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevProcessVertices(
+	GLD_hlDevice *This,
+	UINT SrcStartIndex,
+	UINT DestIndex,
+	UINT VertexCount,
+	IDirect3DVertexBuffer9 *pDestBuffer,
+	IDirect3DVertexDeclaration9 *pVertexDecl,
+	DWORD Flags)
+{
+	// Nothing is transformed
+	_GLD_HL_COUNT(ProcessVertices);
+	if (!This->bSoftwareVP) {
+		gldHLError("ProcessVertices: needs software vertex processing");
+		return D3DERR_INVALIDCALL;
+	}
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Device: vertex input and shaders
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateVertexDeclaration(
+	GLD_hlDevice *This,
+	const D3DVERTEXELEMENT9 *pVertexElements,
+	IDirect3DVertexDeclaration9 **ppDecl)
+{
+	_GLD_HL_COUNT(CreateVertexDeclaration);
+	return gldHLCreateDeclaration(This, pVertexElements, (GLD_hlDeclaration**)ppDecl);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetVertexDeclaration(
+	GLD_hlDevice *This,
+	IDirect3DVertexDeclaration9 *pDecl)
+{
+	_GLD_HL_COUNT(SetVertexDeclaration);
+	gldHLBind(&This->pDecl, pDecl);
+	This->dwFVF = 0;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetVertexDeclaration(
+	GLD_hlDevice *This,
+	IDirect3DVertexDeclaration9 **ppDecl)
+{
+	_GLD_HL_COUNT(GetVertexDeclaration);
+	*ppDecl = This->pDecl;
+	if (*ppDecl)
+		gldHLAddRef(*ppDecl);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetFVF(
+	GLD_hlDevice *This,
+	DWORD FVF)
+{
+	// An FVF replaces the declaration
+	_GLD_HL_COUNT(SetFVF);
+	if (FVF)
+		gldHLBind(&This->pDecl, NULL);
+	This->dwFVF = FVF;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetFVF(
+	GLD_hlDevice *This,
+	DWORD *pFVF)
+{
+	_GLD_HL_COUNT(GetFVF);
+	*pFVF = This->dwFVF;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateVertexShader(
+	GLD_hlDevice *This,
+	const DWORD *pFunction,
+	IDirect3DVertexShader9 **ppShader)
+{
+	_GLD_HL_COUNT(CreateVertexShader);
+	return gldHLCreateShader(This, GLD_HL_VERTEXSHADER, pFunction, (GLD_hlShader**)ppShader);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetVertexShader(
+	GLD_hlDevice *This,
+	IDirect3DVertexShader9 *pShader)
+{
+	_GLD_HL_COUNT(SetVertexShader);
+	gldHLBind(&This->pVS, pShader);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetVertexShader(
+	GLD_hlDevice *This,
+	IDirect3DVertexShader9 **ppShader)
+{
+	_GLD_HL_COUNT(GetVertexShader);
+	*ppShader = This->pVS;
+	if (*ppShader)
+		gldHLAddRef(*ppShader);
+	return D3D_OK;
+}
+
+// Shader constants are checked against the register file
+#define _GLD_HL_CONSTANTS(Method, Regs, nRegs, nComps, Type)			\
+static HRESULT STDMETHODCALLTYPE _gldHLDevSet##Method(					\
+	GLD_hlDevice *This,													\
+	UINT StartRegister,													\
+	const Type *pConstantData,											\
+	UINT Count)															\
+{																		\
+	_GLD_HL_COUNT(Set##Method);											\
+	if (StartRegister + Count > nRegs) {								\
+		gldHLError("Set" #Method ": registers %u..%u", StartRegister, StartRegister + Count - 1);	\
+		return D3DERR_INVALIDCALL;										\
+	}																	\
+	memcpy(&This->Regs[StartRegister], pConstantData, Count * nComps * sizeof(Type));	\
+	return D3D_OK;														\
+}																		\
+static HRESULT STDMETHODCALLTYPE _gldHLDevGet##Method(					\
+	GLD_hlDevice *This,													\
+	UINT StartRegister,													\
+	Type *pConstantData,												\
+	UINT Count)															\
+{																		\
+	_GLD_HL_COUNT(Get##Method);											\
+	if (StartRegister + Count > nRegs)									\
+		return D3DERR_INVALIDCALL;										\
+	memcpy(pConstantData, &This->Regs[StartRegister], Count * nComps * sizeof(Type));	\
+	return D3D_OK;														\
+}
+
+_GLD_HL_CONSTANTS(VertexShaderConstantF, VSConstF, GLD_HL_VS_CONSTANTS_F, 4, float)
+_GLD_HL_CONSTANTS(VertexShaderConstantI, VSConstI, GLD_HL_CONSTANTS_IB, 4, int)
+_GLD_HL_CONSTANTS(VertexShaderConstantB, VSConstB, GLD_HL_CONSTANTS_IB, 1, BOOL)
+_GLD_HL_CONSTANTS(PixelShaderConstantF, PSConstF, GLD_HL_PS_CONSTANTS_F, 4, float)
+_GLD_HL_CONSTANTS(PixelShaderConstantI, PSConstI, GLD_HL_CONSTANTS_IB, 4, int)
+_GLD_HL_CONSTANTS(PixelShaderConstantB, PSConstB, GLD_HL_CONSTANTS_IB, 1, BOOL)
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetStreamSource(
+	GLD_hlDevice *This,
+	UINT StreamNumber,
+	IDirect3DVertexBuffer9 *pStreamData,
+	UINT OffsetInBytes,
+	UINT Stride)
+{
+	_GLD_HL_COUNT(SetStreamSource);
+	if (StreamNumber >= GLD_HL_MAX_STREAMS) {
+		gldHLError("SetStreamSource: stream %u", StreamNumber);
+		return D3DERR_INVALIDCALL;
+	}
+	if (OffsetInBytes & 3) {
+		gldHLError("SetStreamSource: offset %u is not DWORD aligned", OffsetInBytes);
+		return D3DERR_INVALIDCALL;
+	}
+	gldHLBind(&This->Streams[StreamNumber].pVB, pStreamData);
+	This->Streams[StreamNumber].Offset	= OffsetInBytes;
+	This->Streams[StreamNumber].Stride	= Stride;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetStreamSource(
+	GLD_hlDevice *This,
+	UINT StreamNumber,
+	IDirect3DVertexBuffer9 **ppStreamData,
+	UINT *pOffsetInBytes,
+	UINT *pStride)
+{
+	_GLD_HL_COUNT(GetStreamSource);
+	if (StreamNumber >= GLD_HL_MAX_STREAMS)
+		return D3DERR_INVALIDCALL;
+	*ppStreamData	= This->Streams[StreamNumber].pVB;
+	*pOffsetInBytes	= This->Streams[StreamNumber].Offset;
+	*pStride		= This->Streams[StreamNumber].Stride;
+	if (*ppStreamData)
+		gldHLAddRef(*ppStreamData);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetStreamSourceFreq(
+	GLD_hlDevice *This,
+	UINT StreamNumber,
+	UINT Setting)
+{
+	_GLD_HL_COUNT(SetStreamSourceFreq);
+	if (StreamNumber >= GLD_HL_MAX_STREAMS)
+		return D3DERR_INVALIDCALL;
+	This->Streams[StreamNumber].Freq = Setting;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetStreamSourceFreq(
+	GLD_hlDevice *This,
+	UINT StreamNumber,
+	UINT *pSetting)
+{
+	_GLD_HL_COUNT(GetStreamSourceFreq);
+	if (StreamNumber >= GLD_HL_MAX_STREAMS)
+		return D3DERR_INVALIDCALL;
+	*pSetting = This->Streams[StreamNumber].Freq;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetIndices(
+	GLD_hlDevice *This,
+	IDirect3DIndexBuffer9 *pIndexData)
+{
+	_GLD_HL_COUNT(SetIndices);
+	gldHLBind(&This->pIndices, pIndexData);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetIndices(
+	GLD_hlDevice *This,
+	IDirect3DIndexBuffer9 **ppIndexData)
+{
+	_GLD_HL_COUNT(GetIndices);
+	*ppIndexData = This->pIndices;
+	if (*ppIndexData)
+		gldHLAddRef(*ppIndexData);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreatePixelShader(
+	GLD_hlDevice *This,
+	const DWORD *pFunction,
+	IDirect3DPixelShader9 **ppShader)
+{
+	_GLD_HL_COUNT(CreatePixelShader);
+	return gldHLCreateShader(This, GLD_HL_PIXELSHADER, pFunction, (GLD_hlShader**)ppShader);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevSetPixelShader(
+	GLD_hlDevice *This,
+	IDirect3DPixelShader9 *pShader)
+{
+	_GLD_HL_COUNT(SetPixelShader);
+	gldHLBind(&This->pPS, pShader);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevGetPixelShader(
+	GLD_hlDevice *This,
+	IDirect3DPixelShader9 **ppShader)
+{
+	_GLD_HL_COUNT(GetPixelShader);
+	*ppShader = This->pPS;
+	if (*ppShader)
+		gldHLAddRef(*ppShader);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Device: patches and queries
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevDrawRectPatch(
+	GLD_hlDevice *This,
+	UINT Handle,
+	const float *pNumSegs,
+	const D3DRECTPATCH_INFO *pRectPatchInfo)
+{
+	// No patch caps are reported
+	_GLD_HL_COUNT(DrawRectPatch);
+	gldHLError("DrawRectPatch: not supported");
+	return D3DERR_INVALIDCALL;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevDrawTriPatch(
+	GLD_hlDevice *This,
+	UINT Handle,
+	const float *pNumSegs,
+	const D3DTRIPATCH_INFO *pTriPatchInfo)
+{
+	_GLD_HL_COUNT(DrawTriPatch);
+	gldHLError("DrawTriPatch: not supported");
+	return D3DERR_INVALIDCALL;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevDeletePatch(
+	GLD_hlDevice *This,
+	UINT Handle)
+{
+	_GLD_HL_COUNT(DeletePatch);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDevCreateQuery(
+	GLD_hlDevice *This,
+	D3DQUERYTYPE Type,
+	IDirect3DQuery9 **ppQuery)
+{
+	_GLD_HL_COUNT(CreateQuery);
+	return gldHLCreateQuery(This, Type, (GLD_hlQuery**)ppQuery);
+}
+
+// ***********************************************************************
+// Statistics
+// ***********************************************************************
+
+void gldHeadlessGetStats(
+	GLD_hlStats *pStats)
+{
+	*pStats = gldHLStats;
+}
+
+// ***********************************************************************
+
+void gldHeadlessResetStats(
+	void)
+{
+	// The live count describes objects, not calls, and is kept
+	DWORD	dwLive = gldHLStats.dwLiveResources;
+
+	ZeroMemory(&gldHLStats, sizeof(gldHLStats));
+	gldHLStats.dwLiveResources = dwLive;
+}
+
+// ***********************************************************************
+
+const char* gldHeadlessMethodName(
+	DWORD dwSlot)
+{
+	if (dwSlot >= sizeof(szHLMethodNames) / sizeof(szHLMethodNames[0]))
+		return "?";
+	return szHLMethodNames[dwSlot];
+}
+
+// ***********************************************************************
+
+BOOL gldHeadlessGetLastDraw(
+	GLD_hlDraw *pDraw)
+{
+	*pDraw = gldHLLastDraw;
+	return gldHLStats.dwDraws != 0;
+}
+
+// ***********************************************************************
+
+void gldHeadlessPrintStats(
+	FILE *fp)
+{
+	DWORD	i;
+
+	fprintf(fp, "Direct3D 9 stand-in device\n");
+	fprintf(fp, "  Presents           : %u\n", gldHLStats.dwPresents);
+	fprintf(fp, "  Draws              : %u (%u primitives, %u vertices)\n",
+		gldHLStats.dwDraws, gldHLStats.dwPrims, gldHLStats.dwVertices);
+	fprintf(fp, "  VB locks           : %u (%llu bytes)\n", gldHLStats.dwVBLocks, (unsigned long long)gldHLStats.qwVBLockBytes);
+	fprintf(fp, "  IB locks           : %u (%llu bytes)\n", gldHLStats.dwIBLocks, (unsigned long long)gldHLStats.qwIBLockBytes);
+	fprintf(fp, "  Surface locks      : %u (%llu bytes)\n", gldHLStats.dwSurfaceLocks, (unsigned long long)gldHLStats.qwSurfaceLockBytes);
+	fprintf(fp, "  Volume locks       : %u\n", gldHLStats.dwVolumeLocks);
+	fprintf(fp, "  Lock flags         : %u discard, %u no-overwrite, %u read-only\n",
+		gldHLStats.dwDiscards, gldHLStats.dwNoOverwrites, gldHLStats.dwReadOnly);
+	fprintf(fp, "  Bytes by pointer   : %llu\n", (unsigned long long)gldHLStats.qwUPBytes);
+	fprintf(fp, "  Resources          : %u created, %u live\n", gldHLStats.dwCreates, gldHLStats.dwLiveResources);
+	fprintf(fp, "  Errors             : %u\n", gldHLStats.dwErrors);
+	fprintf(fp, "  Calls\n");
+	for (i=0; i<GLD_HL_DEVICE_SLOTS; i++) {
+		if (gldHLStats.dwCalls[i])
+			fprintf(fp, "    %-30s: %u\n", gldHeadlessMethodName(i), gldHLStats.dwCalls[i]);
+	}
+}
+
+// ***********************************************************************
+
+static void __attribute__((destructor)) _gldHLExit(void)
+{
+	// Runs after the DLL has been detached, so the live count is final
+	if (getenv("GLD_HEADLESS_STATS"))
+		gldHeadlessPrintStats(stdout);
+}
+
+// ***********************************************************************
+// PIX markers
+// ***********************************************************************
+
+int WINAPI D3DPERF_BeginEvent(
+	D3DCOLOR col,
+	LPCWSTR wszName)
+{
+	return 0;
+}
+
+int WINAPI D3DPERF_EndEvent(void)
+{
+	return 0;
+}
+
+void WINAPI D3DPERF_SetMarker(
+	D3DCOLOR col,
+	LPCWSTR wszName)
+{
+}
+
+// ***********************************************************************
+// Vtables
+// ***********************************************************************
+
+#define _GLD_HL_D3D(m)		d->m = (void*)_gldHLD3D##m
+#define _GLD_HL_DEV(m)		v->m = (void*)_gldHLDev##m
+
+static void _gldHLInitDeviceVtbls(void)
+{
+	IDirect3D9Vtbl			*d = &hlD3DVtbl;
+	IDirect3DDevice9Vtbl	*v = &hlDeviceVtbl;
+
+	_GLD_HL_D3D(QueryInterface);
+	_GLD_HL_D3D(AddRef);
+	_GLD_HL_D3D(Release);
+	_GLD_HL_D3D(RegisterSoftwareDevice);
+	_GLD_HL_D3D(GetAdapterCount);
+	_GLD_HL_D3D(GetAdapterIdentifier);
+	_GLD_HL_D3D(GetAdapterModeCount);
+	_GLD_HL_D3D(EnumAdapterModes);
+	_GLD_HL_D3D(GetAdapterDisplayMode);
+	_GLD_HL_D3D(CheckDeviceType);
+	_GLD_HL_D3D(CheckDeviceFormat);
+	_GLD_HL_D3D(CheckDeviceMultiSampleType);
+	_GLD_HL_D3D(CheckDepthStencilMatch);
+	_GLD_HL_D3D(CheckDeviceFormatConversion);
+	_GLD_HL_D3D(GetDeviceCaps);
+	_GLD_HL_D3D(GetAdapterMonitor);
+	_GLD_HL_D3D(CreateDevice);
+
+	_GLD_HL_DEV(QueryInterface);
+	_GLD_HL_DEV(AddRef);
+	_GLD_HL_DEV(Release);
+	_GLD_HL_DEV(TestCooperativeLevel);
+	_GLD_HL_DEV(GetAvailableTextureMem);
+	_GLD_HL_DEV(EvictManagedResources);
+	_GLD_HL_DEV(GetDirect3D);
+	_GLD_HL_DEV(GetDeviceCaps);
+	_GLD_HL_DEV(GetDisplayMode);
+	_GLD_HL_DEV(GetCreationParameters);
+	_GLD_HL_DEV(SetCursorProperties);
+	_GLD_HL_DEV(SetCursorPosition);
+	_GLD_HL_DEV(ShowCursor);
+	_GLD_HL_DEV(CreateAdditionalSwapChain);
+	_GLD_HL_DEV(GetSwapChain);
+	_GLD_HL_DEV(GetNumberOfSwapChains);
+	_GLD_HL_DEV(Reset);
+	_GLD_HL_DEV(Present);
+	_GLD_HL_DEV(GetBackBuffer);
+	_GLD_HL_DEV(GetRasterStatus);
+	_GLD_HL_DEV(SetDialogBoxMode);
+	_GLD_HL_DEV(SetGammaRamp);
+	_GLD_HL_DEV(GetGammaRamp);
+	_GLD_HL_DEV(CreateTexture);
+	_GLD_HL_DEV(CreateVolumeTexture);
+	_GLD_HL_DEV(CreateCubeTexture);
+	_GLD_HL_DEV(CreateVertexBuffer);
+	_GLD_HL_DEV(CreateIndexBuffer);
+	_GLD_HL_DEV(CreateRenderTarget);
+	_GLD_HL_DEV(CreateDepthStencilSurface);
+	_GLD_HL_DEV(UpdateSurface);
+	_GLD_HL_DEV(UpdateTexture);
+	_GLD_HL_DEV(GetRenderTargetData);
+	_GLD_HL_DEV(GetFrontBufferData);
+	_GLD_HL_DEV(StretchRect);
+	_GLD_HL_DEV(ColorFill);
+	_GLD_HL_DEV(CreateOffscreenPlainSurface);
+	_GLD_HL_DEV(SetRenderTarget);
+	_GLD_HL_DEV(GetRenderTarget);
+	_GLD_HL_DEV(SetDepthStencilSurface);
+	_GLD_HL_DEV(GetDepthStencilSurface);
+	_GLD_HL_DEV(BeginScene);
+	_GLD_HL_DEV(EndScene);
+	_GLD_HL_DEV(Clear);
+	_GLD_HL_DEV(SetTransform);
+	_GLD_HL_DEV(GetTransform);
+	_GLD_HL_DEV(MultiplyTransform);
+	_GLD_HL_DEV(SetViewport);
+	_GLD_HL_DEV(GetViewport);
+	_GLD_HL_DEV(SetMaterial);
+	_GLD_HL_DEV(GetMaterial);
+	_GLD_HL_DEV(SetLight);
+	_GLD_HL_DEV(GetLight);
+	_GLD_HL_DEV(LightEnable);
+	_GLD_HL_DEV(GetLightEnable);
+	_GLD_HL_DEV(SetClipPlane);
+	_GLD_HL_DEV(GetClipPlane);
+	_GLD_HL_DEV(SetRenderState);
+	_GLD_HL_DEV(GetRenderState);
+	_GLD_HL_DEV(CreateStateBlock);
+	_GLD_HL_DEV(BeginStateBlock);
+	_GLD_HL_DEV(EndStateBlock);
+	_GLD_HL_DEV(SetClipStatus);
+	_GLD_HL_DEV(GetClipStatus);
+	_GLD_HL_DEV(GetTexture);
+	_GLD_HL_DEV(SetTexture);
+	_GLD_HL_DEV(GetTextureStageState);
+	_GLD_HL_DEV(SetTextureStageState);
+	_GLD_HL_DEV(GetSamplerState);
+	_GLD_HL_DEV(SetSamplerState);
+	_GLD_HL_DEV(ValidateDevice);
+	_GLD_HL_DEV(SetPaletteEntries);
+	_GLD_HL_DEV(GetPaletteEntries);
+	_GLD_HL_DEV(SetCurrentTexturePalette);
+	_GLD_HL_DEV(GetCurrentTexturePalette);
+	_GLD_HL_DEV(SetScissorRect);
+	_GLD_HL_DEV(GetScissorRect);
+	_GLD_HL_DEV(SetSoftwareVertexProcessing);
+	_GLD_HL_DEV(GetSoftwareVertexProcessing);
+	_GLD_HL_DEV(SetNPatchMode);
+	_GLD_HL_DEV(GetNPatchMode);
+	_GLD_HL_DEV(DrawPrimitive);
+	_GLD_HL_DEV(DrawIndexedPrimitive);
+	_GLD_HL_DEV(DrawPrimitiveUP);
+	_GLD_HL_DEV(DrawIndexedPrimitiveUP);
+	_GLD_HL_DEV(ProcessVertices);
+	_GLD_HL_DEV(CreateVertexDeclaration);
+	_GLD_HL_DEV(SetVertexDeclaration);
+	_GLD_HL_DEV(GetVertexDeclaration);
+	_GLD_HL_DEV(SetFVF);
+	_GLD_HL_DEV(GetFVF);
+	_GLD_HL_DEV(CreateVertexShader);
+	_GLD_HL_DEV(SetVertexShader);
+	_GLD_HL_DEV(GetVertexShader);
+	_GLD_HL_DEV(SetVertexShaderConstantF);
+	_GLD_HL_DEV(GetVertexShaderConstantF);
+	_GLD_HL_DEV(SetVertexShaderConstantI);
+	_GLD_HL_DEV(GetVertexShaderConstantI);
+	_GLD_HL_DEV(SetVertexShaderConstantB);
+	_GLD_HL_DEV(GetVertexShaderConstantB);
+	_GLD_HL_DEV(SetStreamSource);
+	_GLD_HL_DEV(GetStreamSource);
+	_GLD_HL_DEV(SetStreamSourceFreq);
+	_GLD_HL_DEV(GetStreamSourceFreq);
+	_GLD_HL_DEV(SetIndices);
+	_GLD_HL_DEV(GetIndices);
+	_GLD_HL_DEV(CreatePixelShader);
+	_GLD_HL_DEV(SetPixelShader);
+	_GLD_HL_DEV(GetPixelShader);
+	_GLD_HL_DEV(SetPixelShaderConstantF);
+	_GLD_HL_DEV(GetPixelShaderConstantF);
+	_GLD_HL_DEV(SetPixelShaderConstantI);
+	_GLD_HL_DEV(GetPixelShaderConstantI);
+	_GLD_HL_DEV(SetPixelShaderConstantB);
+	_GLD_HL_DEV(GetPixelShaderConstantB);
+	_GLD_HL_DEV(DrawRectPatch);
+	_GLD_HL_DEV(DrawTriPatch);
+	_GLD_HL_DEV(DeletePatch);
+	_GLD_HL_DEV(CreateQuery);
+
+	bHLDeviceVtblsReady = TRUE;
+}
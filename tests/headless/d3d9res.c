@@ -0,0 +1,1652 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Resources of the stand-in Direct3D 9 device: surfaces, textures,
+*               vertex and index buffers, declarations, shaders, queries and state
+*               blocks. Locks are checked the way the debug runtime checks them and
+*               counted in the shared statistics.
+*
+*********************************************************************************/
+
+#include <windows.h>
+#include <d3d9.h>
+
+#include "gld_hl_d3d9.h"
+
+// ***********************************************************************
+
+GLD_hlStats					gldHLStats;
+GLD_hlDraw					gldHLLastDraw;
+
+static IDirect3DSurface9Vtbl			hlSurfaceVtbl;
+static IDirect3DTexture9Vtbl			hlTextureVtbl;
+static IDirect3DCubeTexture9Vtbl		hlCubeTextureVtbl;
+static IDirect3DVolumeTexture9Vtbl		hlVolumeTextureVtbl;
+static IDirect3DVertexBuffer9Vtbl		hlVertexBufferVtbl;
+static IDirect3DIndexBuffer9Vtbl		hlIndexBufferVtbl;
+static IDirect3DVertexDeclaration9Vtbl	hlDeclarationVtbl;
+static IDirect3DVertexShader9Vtbl		hlVertexShaderVtbl;
+static IDirect3DPixelShader9Vtbl		hlPixelShaderVtbl;
+static IDirect3DQuery9Vtbl				hlQueryVtbl;
+static IDirect3DStateBlock9Vtbl			hlStateBlockVtbl;
+static IDirect3DSwapChain9Vtbl			hlSwapChainVtbl;
+static BOOL								bHLVtblsReady = FALSE;
+
+static void _gldHLInitVtbls(void);
+
+// ***********************************************************************
+// Validation
+// ***********************************************************************
+
+void gldHLError(
+	const char *pszFormat,
+	...)
+{
+	// What the debug runtime would have complained about
+	va_list	args;
+
+	gldHLStats.dwErrors++;
+	fputs("d3d9: ", stderr);
+	va_start(args, pszFormat);
+	vfprintf(stderr, pszFormat, args);
+	va_end(args);
+	fputc('\n', stderr);
+}
+
+// ***********************************************************************
+
+void gldHLWarning(
+	const char *pszFormat,
+	...)
+{
+	// Tolerated by the runtime, but worth knowing about
+	va_list	args;
+
+	fputs("d3d9: warning: ", stderr);
+	va_start(args, pszFormat);
+	vfprintf(stderr, pszFormat, args);
+	va_end(args);
+	fputc('\n', stderr);
+}
+
+// ***********************************************************************
+// Objects
+// ***********************************************************************
+
+static void* _gldHLNewObject(
+	GLD_hlDevice *pDevice,
+	GLD_hlKind Kind,
+	size_t nSize)
+{
+	GLD_hlObject	*pObj;
+
+	if (!bHLVtblsReady)
+		_gldHLInitVtbls();
+
+	pObj = calloc(1, nSize);
+	if (!pObj)
+		return NULL;
+	pObj->lRefs		= 1;
+	pObj->Kind		= Kind;
+	pObj->pDevice	= pDevice;
+	switch (Kind) {
+	case GLD_HL_SURFACE:		pObj->lpVtbl = &hlSurfaceVtbl;			break;
+	case GLD_HL_TEXTURE:		pObj->lpVtbl = &hlTextureVtbl;			break;
+	case GLD_HL_CUBETEXTURE:	pObj->lpVtbl = &hlCubeTextureVtbl;		break;
+	case GLD_HL_VOLUMETEXTURE:	pObj->lpVtbl = &hlVolumeTextureVtbl;	break;
+	case GLD_HL_VERTEXBUFFER:	pObj->lpVtbl = &hlVertexBufferVtbl;		break;
+	case GLD_HL_INDEXBUFFER:	pObj->lpVtbl = &hlIndexBufferVtbl;		break;
+	case GLD_HL_DECLARATION:	pObj->lpVtbl = &hlDeclarationVtbl;		break;
+	case GLD_HL_VERTEXSHADER:	pObj->lpVtbl = &hlVertexShaderVtbl;		break;
+	case GLD_HL_PIXELSHADER:	pObj->lpVtbl = &hlPixelShaderVtbl;		break;
+	case GLD_HL_QUERY:			pObj->lpVtbl = &hlQueryVtbl;			break;
+	case GLD_HL_STATEBLOCK:		pObj->lpVtbl = &hlStateBlockVtbl;		break;
+	case GLD_HL_SWAPCHAIN:		pObj->lpVtbl = &hlSwapChainVtbl;		break;
+	}
+	gldHLStats.dwCreates++;
+	gldHLStats.dwLiveResources++;
+	return pObj;
+}
+
+// ***********************************************************************
+
+static void _gldHLFreeSurface(
+	GLD_hlSurface *pSurface)
+{
+	free(pSurface->pBits);
+}
+
+static void _gldHLDestroy(
+	GLD_hlObject *pObj)
+{
+	GLD_hlPrivate		*pPriv, *pNext;
+	GLD_hlTexture		*pTex;
+	GLD_hlVolumeTexture	*pVol;
+	UINT				i;
+
+	switch (pObj->Kind) {
+	case GLD_HL_SURFACE:
+		_gldHLFreeSurface((GLD_hlSurface*)pObj);
+		break;
+	case GLD_HL_TEXTURE:
+	case GLD_HL_CUBETEXTURE:
+		pTex = (GLD_hlTexture*)pObj;
+		for (i=0; i<pTex->nLevels * pTex->nFaces; i++) {
+			if (pTex->ppSurfaces[i]) {
+				_gldHLFreeSurface(pTex->ppSurfaces[i]);
+				free(pTex->ppSurfaces[i]);
+				gldHLStats.dwLiveResources--;
+			}
+		}
+		free(pTex->ppSurfaces);
+		break;
+	case GLD_HL_VOLUMETEXTURE:
+		pVol = (GLD_hlVolumeTexture*)pObj;
+		for (i=0; i<pVol->nLevels; i++)
+			free(pVol->pVolumes[i].pBits);
+		free(pVol->pVolumes);
+		break;
+	case GLD_HL_VERTEXBUFFER:
+	case GLD_HL_INDEXBUFFER:
+		free(((GLD_hlBuffer*)pObj)->pData);
+		break;
+	case GLD_HL_DECLARATION:
+		free(((GLD_hlDeclaration*)pObj)->pElements);
+		break;
+	case GLD_HL_VERTEXSHADER:
+	case GLD_HL_PIXELSHADER:
+		free(((GLD_hlShader*)pObj)->pFunction);
+		break;
+	default:
+		break;
+	}
+
+	for (pPriv = pObj->pPrivate; pPriv; pPriv = pNext) {
+		pNext = pPriv->pNext;
+		free(pPriv);
+	}
+	gldHLStats.dwLiveResources--;
+	free(pObj);
+}
+
+// ***********************************************************************
+
+ULONG gldHLAddRef(
+	void *pObject)
+{
+	GLD_hlObject	*pObj = (GLD_hlObject*)pObject;
+
+	// Levels share the count of their texture
+	if (pObj->pContainer)
+		return gldHLAddRef(pObj->pContainer);
+	return ++pObj->lRefs;
+}
+
+ULONG gldHLRelease(
+	void *pObject)
+{
+	GLD_hlObject	*pObj = (GLD_hlObject*)pObject;
+	LONG			lRefs;
+
+	if (pObj->pContainer)
+		return gldHLRelease(pObj->pContainer);
+	lRefs = --pObj->lRefs;
+	if (lRefs == 0)
+		_gldHLDestroy(pObj);
+	if (lRefs < 0)
+		gldHLError("Release of an object that has already been destroyed");
+	return lRefs;
+}
+
+// ***********************************************************************
+
+void gldHLBind(
+	void *ppSlot,
+	void *pObject)
+{
+	// Bound objects hold a reference, as the runtime's do
+	void	**pp = (void**)ppSlot;
+
+	if (*pp == pObject)
+		return;
+	if (pObject)
+		gldHLAddRef(pObject);
+	if (*pp)
+		gldHLRelease(*pp);
+	*pp = pObject;
+}
+
+// ***********************************************************************
+// Methods common to every object
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLQueryInterface(
+	GLD_hlObject *This,
+	REFIID riid,
+	void **ppvObj)
+{
+	if (!IsEqualIID(riid, &IID_IUnknown)) {
+		*ppvObj = NULL;
+		return E_NOINTERFACE;
+	}
+	gldHLAddRef(This);
+	*ppvObj = This;
+	return S_OK;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLAddRef(
+	GLD_hlObject *This)
+{
+	return gldHLAddRef(This);
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLRelease(
+	GLD_hlObject *This)
+{
+	return gldHLRelease(This);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLGetDevice(
+	GLD_hlObject *This,
+	IDirect3DDevice9 **ppDevice)
+{
+	*ppDevice = (IDirect3DDevice9*)This->pDevice;
+	IDirect3DDevice9_AddRef(*ppDevice);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static GLD_hlPrivate** _gldHLFindPrivate(
+	GLD_hlObject *pObj,
+	REFGUID refguid)
+{
+	GLD_hlPrivate	**ppPriv;
+
+	for (ppPriv = &pObj->pPrivate; *ppPriv; ppPriv = &(*ppPriv)->pNext)
+		if (IsEqualGUID(&(*ppPriv)->Guid, refguid))
+			break;
+	return ppPriv;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLFreePrivateData(
+	GLD_hlObject *This,
+	REFGUID refguid)
+{
+	GLD_hlPrivate	**ppPriv = _gldHLFindPrivate(This, refguid);
+	GLD_hlPrivate	*pPriv = *ppPriv;
+
+	if (!pPriv)
+		return D3DERR_NOTFOUND;
+	*ppPriv = pPriv->pNext;
+	free(pPriv);
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSetPrivateData(
+	GLD_hlObject *This,
+	REFGUID refguid,
+	const void *pData,
+	DWORD SizeOfData,
+	DWORD Flags)
+{
+	GLD_hlPrivate	*pPriv;
+
+	// D3DSPD_IUNKNOWN isn't used by the driver
+	if (Flags) {
+		gldHLError("SetPrivateData: flags 0x%x not supported", Flags);
+		return D3DERR_INVALIDCALL;
+	}
+	_gldHLFreePrivateData(This, refguid);
+	pPriv = malloc(sizeof(GLD_hlPrivate) + SizeOfData);
+	if (!pPriv)
+		return E_OUTOFMEMORY;
+	pPriv->Guid		= *refguid;
+	pPriv->dwSize	= SizeOfData;
+	pPriv->pNext	= This->pPrivate;
+	memcpy(pPriv + 1, pData, SizeOfData);
+	This->pPrivate	= pPriv;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLGetPrivateData(
+	GLD_hlObject *This,
+	REFGUID refguid,
+	void *pData,
+	DWORD *pSizeOfData)
+{
+	GLD_hlPrivate	*pPriv = *_gldHLFindPrivate(This, refguid);
+
+	if (!pPriv)
+		return D3DERR_NOTFOUND;
+	if (!pData) {
+		*pSizeOfData = pPriv->dwSize;
+		return D3D_OK;
+	}
+	if (*pSizeOfData < pPriv->dwSize) {
+		*pSizeOfData = pPriv->dwSize;
+		return D3DERR_MOREDATA;
+	}
+	*pSizeOfData = pPriv->dwSize;
+	memcpy(pData, pPriv + 1, pPriv->dwSize);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static DWORD STDMETHODCALLTYPE _gldHLSetPriority(
+	GLD_hlObject *This,
+	DWORD PriorityNew)
+{
+	DWORD	dwOld = This->dwPriority;
+
+	This->dwPriority = PriorityNew;
+	return dwOld;
+}
+
+static DWORD STDMETHODCALLTYPE _gldHLGetPriority(
+	GLD_hlObject *This)
+{
+	return This->dwPriority;
+}
+
+static void STDMETHODCALLTYPE _gldHLPreLoad(
+	GLD_hlObject *This)
+{
+}
+
+static D3DRESOURCETYPE STDMETHODCALLTYPE _gldHLGetType(
+	GLD_hlObject *This)
+{
+	switch (This->Kind) {
+	case GLD_HL_SURFACE:		return D3DRTYPE_SURFACE;
+	case GLD_HL_TEXTURE:		return D3DRTYPE_TEXTURE;
+	case GLD_HL_CUBETEXTURE:	return D3DRTYPE_CUBETEXTURE;
+	case GLD_HL_VOLUMETEXTURE:	return D3DRTYPE_VOLUMETEXTURE;
+	case GLD_HL_VERTEXBUFFER:	return D3DRTYPE_VERTEXBUFFER;
+	case GLD_HL_INDEXBUFFER:	return D3DRTYPE_INDEXBUFFER;
+	default:					return 0;
+	}
+}
+
+// ***********************************************************************
+// Formats
+// ***********************************************************************
+
+UINT gldHLFormatBits(
+	D3DFORMAT Format)
+{
+	// Bits per pixel, or zero if the device doesn't support the format
+	switch (Format) {
+	case D3DFMT_A32B32G32R32F:
+		return 128;
+	case D3DFMT_A16B16G16R16:
+	case D3DFMT_A16B16G16R16F:
+	case D3DFMT_G32R32F:
+		return 64;
+	case D3DFMT_A8R8G8B8:
+	case D3DFMT_X8R8G8B8:
+	case D3DFMT_A8B8G8R8:
+	case D3DFMT_X8B8G8R8:
+	case D3DFMT_A2B10G10R10:
+	case D3DFMT_A2R10G10B10:
+	case D3DFMT_G16R16:
+	case D3DFMT_G16R16F:
+	case D3DFMT_R32F:
+	case D3DFMT_X8L8V8U8:
+	case D3DFMT_Q8W8V8U8:
+	case D3DFMT_V16U16:
+	case D3DFMT_D32:
+	case D3DFMT_D24S8:
+	case D3DFMT_D24X8:
+	case D3DFMT_D24X4S4:
+	case D3DFMT_D32F_LOCKABLE:
+	case D3DFMT_D24FS8:
+	case D3DFMT_INDEX32:
+		return 32;
+	case D3DFMT_R8G8B8:
+		return 24;
+	case D3DFMT_R5G6B5:
+	case D3DFMT_X1R5G5B5:
+	case D3DFMT_A1R5G5B5:
+	case D3DFMT_A4R4G4B4:
+	case D3DFMT_X4R4G4B4:
+	case D3DFMT_A8R3G3B2:
+	case D3DFMT_A8L8:
+	case D3DFMT_A8P8:
+	case D3DFMT_V8U8:
+	case D3DFMT_L6V5U5:
+	case D3DFMT_L16:
+	case D3DFMT_R16F:
+	case D3DFMT_D16:
+	case D3DFMT_D16_LOCKABLE:
+	case D3DFMT_D15S1:
+	case D3DFMT_INDEX16:
+	case D3DFMT_UYVY:
+	case D3DFMT_YUY2:
+		return 16;
+	case D3DFMT_R3G3B2:
+	case D3DFMT_A8:
+	case D3DFMT_P8:
+	case D3DFMT_L8:
+	case D3DFMT_A4L4:
+	case D3DFMT_DXT2:
+	case D3DFMT_DXT3:
+	case D3DFMT_DXT4:
+	case D3DFMT_DXT5:
+		return 8;
+	case D3DFMT_DXT1:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+BOOL gldHLFormatIsDXT(
+	D3DFORMAT Format)
+{
+	return (Format == D3DFMT_DXT1) || (Format == D3DFMT_DXT2) || (Format == D3DFMT_DXT3) ||
+		(Format == D3DFMT_DXT4) || (Format == D3DFMT_DXT5);
+}
+
+// ***********************************************************************
+
+static void _gldHLLayout(
+	D3DFORMAT Format,
+	UINT Width,
+	UINT Height,
+	UINT *pPitch,
+	UINT *pRows)
+{
+	// Rows are padded to 16 bytes, so that code which assumes
+	// Pitch == Width * BytesPerPixel is caught
+	UINT	nBits = gldHLFormatBits(Format);
+
+	if (gldHLFormatIsDXT(Format)) {
+		*pPitch	= ((Width + 3) / 4) * nBits * 2;
+		*pRows	= (Height + 3) / 4;
+	} else {
+		*pPitch	= (((Width * nBits + 7) / 8) + 15) & ~15;
+		*pRows	= Height;
+	}
+}
+
+// ***********************************************************************
+
+static void _gldHLCountLock(
+	DWORD Flags,
+	ULONGLONG *pqwBytes,
+	UINT nBytes)
+{
+	*pqwBytes += nBytes;
+	if (Flags & D3DLOCK_DISCARD)
+		gldHLStats.dwDiscards++;
+	if (Flags & D3DLOCK_NOOVERWRITE)
+		gldHLStats.dwNoOverwrites++;
+	if (Flags & D3DLOCK_READONLY)
+		gldHLStats.dwReadOnly++;
+}
+
+// ***********************************************************************
+// Surfaces
+// ***********************************************************************
+
+GLD_hlSurface* gldHLCreateSurface(
+	GLD_hlDevice *pDevice,
+	UINT Width,
+	UINT Height,
+	D3DFORMAT Format,
+	DWORD Usage,
+	D3DPOOL Pool,
+	GLD_hlObject *pContainer)
+{
+	GLD_hlSurface	*pSurface;
+
+	if (!Width || !Height || !gldHLFormatBits(Format))
+		return NULL;
+
+	pSurface = _gldHLNewObject(pDevice, GLD_HL_SURFACE, sizeof(GLD_hlSurface));
+	if (!pSurface)
+		return NULL;
+	pSurface->Obj.pContainer	= pContainer;
+	pSurface->Desc.Format		= Format;
+	pSurface->Desc.Type			= D3DRTYPE_SURFACE;
+	pSurface->Desc.Usage		= Usage;
+	pSurface->Desc.Pool			= Pool;
+	pSurface->Desc.Width		= Width;
+	pSurface->Desc.Height		= Height;
+	_gldHLLayout(Format, Width, Height, &pSurface->Pitch, &pSurface->Rows);
+	pSurface->pBits = calloc(pSurface->Rows, pSurface->Pitch);
+	if (!pSurface->pBits) {
+		_gldHLDestroy(&pSurface->Obj);
+		return NULL;
+	}
+	// Levels are counted with their texture
+	if (pContainer) {
+		gldHLStats.dwCreates--;
+	}
+	return pSurface;
+}
+
+// ***********************************************************************
+
+BYTE* gldHLSurfaceRow(
+	GLD_hlSurface *pSurface,
+	UINT x,
+	UINT y)
+{
+	UINT	nBits = gldHLFormatBits(pSurface->Desc.Format);
+
+	if (gldHLFormatIsDXT(pSurface->Desc.Format))
+		return pSurface->pBits + (y / 4) * pSurface->Pitch + (x / 4) * nBits * 2;
+	return pSurface->pBits + y * pSurface->Pitch + x * nBits / 8;
+}
+
+// ***********************************************************************
+
+static BOOL _gldHLLockable(
+	GLD_hlSurface *pSurface)
+{
+	// Default pool textures can only be locked if they are dynamic
+	GLD_hlTexture	*pTex = (GLD_hlTexture*)pSurface->Obj.pContainer;
+
+	if (pTex && pSurface->Desc.Pool == D3DPOOL_DEFAULT)
+		return (pTex->Usage & D3DUSAGE_DYNAMIC) != 0;
+	return TRUE;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLSurfaceLockRect(
+	GLD_hlSurface *This,
+	D3DLOCKED_RECT *pLockedRect,
+	const RECT *pRect,
+	DWORD Flags)
+{
+	RECT	rc;
+	UINT	nBits = gldHLFormatBits(This->Desc.Format);
+	UINT	nBytes;
+
+	if (This->bLocked) {
+		gldHLError("LockRect: surface is already locked");
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLLockable(This)) {
+		gldHLError("LockRect: default pool texture without D3DUSAGE_DYNAMIC");
+		return D3DERR_INVALIDCALL;
+	}
+	if (pRect) {
+		rc = *pRect;
+		if (rc.left < 0 || rc.top < 0 || rc.right > (LONG)This->Desc.Width || rc.bottom > (LONG)This->Desc.Height ||
+			rc.left >= rc.right || rc.top >= rc.bottom)
+		{
+			gldHLError("LockRect: rectangle (%d,%d)-(%d,%d) outside %ux%u surface",
+				rc.left, rc.top, rc.right, rc.bottom, This->Desc.Width, This->Desc.Height);
+			return D3DERR_INVALIDCALL;
+		}
+		if (gldHLFormatIsDXT(This->Desc.Format) && ((rc.left | rc.top) & 3)) {
+			gldHLError("LockRect: DXT rectangle not on a block boundary");
+			return D3DERR_INVALIDCALL;
+		}
+	} else {
+		SetRect(&rc, 0, 0, This->Desc.Width, This->Desc.Height);
+	}
+	if ((Flags & D3DLOCK_DISCARD) && !(This->Desc.Usage & D3DUSAGE_DYNAMIC) && !This->Obj.pContainer) {
+		gldHLError("LockRect: D3DLOCK_DISCARD on a surface that isn't dynamic");
+	}
+
+	if (gldHLFormatIsDXT(This->Desc.Format))
+		nBytes = ((rc.right - rc.left + 3) / 4) * nBits * 2 * ((rc.bottom - rc.top + 3) / 4);
+	else
+		nBytes = (rc.right - rc.left) * nBits / 8 * (rc.bottom - rc.top);
+	gldHLStats.dwSurfaceLocks++;
+	_gldHLCountLock(Flags, &gldHLStats.qwSurfaceLockBytes, nBytes);
+
+	This->bLocked			= TRUE;
+	pLockedRect->Pitch		= This->Pitch;
+	pLockedRect->pBits		= gldHLSurfaceRow(This, rc.left, rc.top);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLSurfaceUnlockRect(
+	GLD_hlSurface *This)
+{
+	if (!This->bLocked) {
+		gldHLError("UnlockRect: surface isn't locked");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bLocked = FALSE;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLSurfaceGetDesc(
+	GLD_hlSurface *This,
+	D3DSURFACE_DESC *pDesc)
+{
+	*pDesc = This->Desc;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSurfaceGetContainer(
+	GLD_hlSurface *This,
+	REFIID riid,
+	void **ppContainer)
+{
+	if (!This->Obj.pContainer) {
+		*ppContainer = NULL;
+		return E_NOINTERFACE;
+	}
+	gldHLAddRef(This->Obj.pContainer);
+	*ppContainer = This->Obj.pContainer;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSurfaceGetDC(
+	GLD_hlSurface *This,
+	HDC *phdc)
+{
+	// No GDI
+	return D3DERR_INVALIDCALL;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSurfaceReleaseDC(
+	GLD_hlSurface *This,
+	HDC hdc)
+{
+	return D3DERR_INVALIDCALL;
+}
+
+// ***********************************************************************
+// Textures and cube maps
+// ***********************************************************************
+
+HRESULT gldHLCreateTexture(
+	GLD_hlDevice *pDevice,
+	UINT Width,
+	UINT Height,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	BOOL bCube,
+	GLD_hlTexture **ppTexture)
+{
+	GLD_hlTexture	*pTex;
+	UINT			nMax, w, h, i, f;
+
+	*ppTexture = NULL;
+	if (!Width || !Height || !gldHLFormatBits(Format)) {
+		gldHLError("CreateTexture: %ux%u format %u", Width, Height, Format);
+		return D3DERR_INVALIDCALL;
+	}
+	if ((Usage & D3DUSAGE_DYNAMIC) && Pool == D3DPOOL_MANAGED) {
+		gldHLError("CreateTexture: D3DUSAGE_DYNAMIC in D3DPOOL_MANAGED");
+		return D3DERR_INVALIDCALL;
+	}
+
+	for (nMax = 1, w = Width, h = Height; w > 1 || h > 1; nMax++) {
+		w = max(w / 2, 1);
+		h = max(h / 2, 1);
+	}
+	if (Usage & D3DUSAGE_AUTOGENMIPMAP)
+		Levels = 1;
+	else if (!Levels || Levels > nMax)
+		Levels = nMax;
+
+	pTex = _gldHLNewObject(pDevice, bCube ? GLD_HL_CUBETEXTURE : GLD_HL_TEXTURE, sizeof(GLD_hlTexture));
+	if (!pTex)
+		return E_OUTOFMEMORY;
+	pTex->nLevels		= Levels;
+	pTex->nFaces		= bCube ? 6 : 1;
+	pTex->Usage			= Usage;
+	pTex->AutoGenFilter	= D3DTEXF_LINEAR;
+	pTex->ppSurfaces	= calloc(pTex->nLevels * pTex->nFaces, sizeof(GLD_hlSurface*));
+	if (!pTex->ppSurfaces) {
+		_gldHLDestroy(&pTex->Obj);
+		return E_OUTOFMEMORY;
+	}
+	for (f=0; f<pTex->nFaces; f++) {
+		for (i=0, w=Width, h=Height; i<Levels; i++) {
+			pTex->ppSurfaces[f * Levels + i] = gldHLCreateSurface(pDevice, w, h, Format, Usage, Pool, &pTex->Obj);
+			if (!pTex->ppSurfaces[f * Levels + i]) {
+				_gldHLDestroy(&pTex->Obj);
+				return E_OUTOFMEMORY;
+			}
+			w = max(w / 2, 1);
+			h = max(h / 2, 1);
+		}
+	}
+
+	*ppTexture = pTex;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+UINT gldHLTextureLevels(
+	IDirect3DBaseTexture9 *pTexture,
+	UINT *pFaces)
+{
+	GLD_hlTexture	*pTex = (GLD_hlTexture*)pTexture;
+
+	if (pTex->Obj.Kind != GLD_HL_TEXTURE && pTex->Obj.Kind != GLD_HL_CUBETEXTURE) {
+		*pFaces = 0;
+		return 0;
+	}
+	*pFaces = pTex->nFaces;
+	return pTex->nLevels;
+}
+
+GLD_hlSurface* gldHLTextureSurface(
+	IDirect3DBaseTexture9 *pTexture,
+	UINT Face,
+	UINT Level)
+{
+	GLD_hlTexture	*pTex = (GLD_hlTexture*)pTexture;
+
+	if (pTex->Obj.Kind != GLD_HL_TEXTURE && pTex->Obj.Kind != GLD_HL_CUBETEXTURE)
+		return NULL;
+	if (Face >= pTex->nFaces || Level >= pTex->nLevels)
+		return NULL;
+	return pTex->ppSurfaces[Face * pTex->nLevels + Level];
+}
+
+// ***********************************************************************
+
+static DWORD STDMETHODCALLTYPE _gldHLTexSetLOD(
+	GLD_hlTexture *This,
+	DWORD LODNew)
+{
+	DWORD	dwOld = This->dwLOD;
+
+	This->dwLOD = min(LODNew, This->nLevels - 1);
+	return dwOld;
+}
+
+static DWORD STDMETHODCALLTYPE _gldHLTexGetLOD(
+	GLD_hlTexture *This)
+{
+	return This->dwLOD;
+}
+
+static DWORD STDMETHODCALLTYPE _gldHLTexGetLevelCount(
+	GLD_hlTexture *This)
+{
+	return This->nLevels;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLTexSetAutoGenFilterType(
+	GLD_hlTexture *This,
+	D3DTEXTUREFILTERTYPE FilterType)
+{
+	This->AutoGenFilter = FilterType;
+	return D3D_OK;
+}
+
+static D3DTEXTUREFILTERTYPE STDMETHODCALLTYPE _gldHLTexGetAutoGenFilterType(
+	GLD_hlTexture *This)
+{
+	return This->AutoGenFilter;
+}
+
+static void STDMETHODCALLTYPE _gldHLTexGenerateMipSubLevels(
+	GLD_hlTexture *This)
+{
+	// Sub-levels aren't kept for D3DUSAGE_AUTOGENMIPMAP textures
+}
+
+// ***********************************************************************
+
+static HRESULT _gldHLTexLevel(
+	GLD_hlTexture *This,
+	UINT Face,
+	UINT Level,
+	GLD_hlSurface **ppSurface)
+{
+	*ppSurface = gldHLTextureSurface((IDirect3DBaseTexture9*)This, Face, Level);
+	if (!*ppSurface) {
+		gldHLError("Texture level %u of face %u doesn't exist (%u levels)", Level, Face, This->nLevels);
+		return D3DERR_INVALIDCALL;
+	}
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLTexGetLevelDesc(
+	GLD_hlTexture *This,
+	UINT Level,
+	D3DSURFACE_DESC *pDesc)
+{
+	GLD_hlSurface	*pSurface;
+
+	if (FAILED(_gldHLTexLevel(This, 0, Level, &pSurface)))
+		return D3DERR_INVALIDCALL;
+	*pDesc = pSurface->Desc;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLTexGetSurfaceLevel(
+	GLD_hlTexture *This,
+	UINT Level,
+	IDirect3DSurface9 **ppSurfaceLevel)
+{
+	GLD_hlSurface	*pSurface;
+
+	*ppSurfaceLevel = NULL;
+	if (FAILED(_gldHLTexLevel(This, 0, Level, &pSurface)))
+		return D3DERR_INVALIDCALL;
+	gldHLAddRef(pSurface);
+	*ppSurfaceLevel = (IDirect3DSurface9*)pSurface;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLTexLockRect(
+	GLD_hlTexture *This,
+	UINT Level,
+	D3DLOCKED_RECT *pLockedRect,
+	const RECT *pRect,
+	DWORD Flags)
+{
+	GLD_hlSurface	*pSurface;
+
+	if (FAILED(_gldHLTexLevel(This, 0, Level, &pSurface)))
+		return D3DERR_INVALIDCALL;
+	if ((Flags & D3DLOCK_DISCARD) && !(This->Usage & D3DUSAGE_DYNAMIC))
+		gldHLError("LockRect: D3DLOCK_DISCARD on a texture that isn't dynamic");
+	return _gldHLSurfaceLockRect(pSurface, pLockedRect, pRect, Flags);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLTexUnlockRect(
+	GLD_hlTexture *This,
+	UINT Level)
+{
+	GLD_hlSurface	*pSurface;
+
+	if (FAILED(_gldHLTexLevel(This, 0, Level, &pSurface)))
+		return D3DERR_INVALIDCALL;
+	return _gldHLSurfaceUnlockRect(pSurface);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLTexAddDirtyRect(
+	GLD_hlTexture *This,
+	const RECT *pDirtyRect)
+{
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLCubeGetCubeMapSurface(
+	GLD_hlTexture *This,
+	D3DCUBEMAP_FACES FaceType,
+	UINT Level,
+	IDirect3DSurface9 **ppCubeMapSurface)
+{
+	GLD_hlSurface	*pSurface;
+
+	*ppCubeMapSurface = NULL;
+	if (FAILED(_gldHLTexLevel(This, FaceType, Level, &pSurface)))
+		return D3DERR_INVALIDCALL;
+	gldHLAddRef(pSurface);
+	*ppCubeMapSurface = (IDirect3DSurface9*)pSurface;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLCubeLockRect(
+	GLD_hlTexture *This,
+	D3DCUBEMAP_FACES FaceType,
+	UINT Level,
+	D3DLOCKED_RECT *pLockedRect,
+	const RECT *pRect,
+	DWORD Flags)
+{
+	GLD_hlSurface	*pSurface;
+
+	if (FAILED(_gldHLTexLevel(This, FaceType, Level, &pSurface)))
+		return D3DERR_INVALIDCALL;
+	return _gldHLSurfaceLockRect(pSurface, pLockedRect, pRect, Flags);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLCubeUnlockRect(
+	GLD_hlTexture *This,
+	D3DCUBEMAP_FACES FaceType,
+	UINT Level)
+{
+	GLD_hlSurface	*pSurface;
+
+	if (FAILED(_gldHLTexLevel(This, FaceType, Level, &pSurface)))
+		return D3DERR_INVALIDCALL;
+	return _gldHLSurfaceUnlockRect(pSurface);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLCubeAddDirtyRect(
+	GLD_hlTexture *This,
+	D3DCUBEMAP_FACES FaceType,
+	const RECT *pDirtyRect)
+{
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Volume textures
+// ***********************************************************************
+
+HRESULT gldHLCreateVolumeTexture(
+	GLD_hlDevice *pDevice,
+	UINT Width,
+	UINT Height,
+	UINT Depth,
+	UINT Levels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	GLD_hlVolumeTexture **ppTexture)
+{
+	GLD_hlVolumeTexture	*pTex;
+	GLD_hlVolume		*pVol;
+	UINT				nMax, w, h, d, i, nRows;
+
+	*ppTexture = NULL;
+	if (!Width || !Height || !Depth || !gldHLFormatBits(Format)) {
+		gldHLError("CreateVolumeTexture: %ux%ux%u format %u", Width, Height, Depth, Format);
+		return D3DERR_INVALIDCALL;
+	}
+	for (nMax = 1, w = Width, h = Height, d = Depth; w > 1 || h > 1 || d > 1; nMax++) {
+		w = max(w / 2, 1);
+		h = max(h / 2, 1);
+		d = max(d / 2, 1);
+	}
+	if (!Levels || Levels > nMax)
+		Levels = nMax;
+
+	pTex = _gldHLNewObject(pDevice, GLD_HL_VOLUMETEXTURE, sizeof(GLD_hlVolumeTexture));
+	if (!pTex)
+		return E_OUTOFMEMORY;
+	pTex->nLevels		= Levels;
+	pTex->AutoGenFilter	= D3DTEXF_LINEAR;
+	pTex->pVolumes		= calloc(Levels, sizeof(GLD_hlVolume));
+	if (!pTex->pVolumes) {
+		_gldHLDestroy(&pTex->Obj);
+		return E_OUTOFMEMORY;
+	}
+	for (i=0, w=Width, h=Height, d=Depth; i<Levels; i++) {
+		pVol = &pTex->pVolumes[i];
+		pVol->Desc.Format	= Format;
+		pVol->Desc.Type		= D3DRTYPE_VOLUME;
+		pVol->Desc.Usage	= Usage;
+		pVol->Desc.Pool		= Pool;
+		pVol->Desc.Width	= w;
+		pVol->Desc.Height	= h;
+		pVol->Desc.Depth	= d;
+		_gldHLLayout(Format, w, h, &pVol->RowPitch, &nRows);
+		pVol->SlicePitch	= pVol->RowPitch * nRows;
+		pVol->pBits			= calloc(d, pVol->SlicePitch);
+		if (!pVol->pBits) {
+			_gldHLDestroy(&pTex->Obj);
+			return E_OUTOFMEMORY;
+		}
+		w = max(w / 2, 1);
+		h = max(h / 2, 1);
+		d = max(d / 2, 1);
+	}
+
+	*ppTexture = pTex;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLVolGetLevelDesc(
+	GLD_hlVolumeTexture *This,
+	UINT Level,
+	D3DVOLUME_DESC *pDesc)
+{
+	if (Level >= This->nLevels)
+		return D3DERR_INVALIDCALL;
+	*pDesc = This->pVolumes[Level].Desc;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLVolGetVolumeLevel(
+	GLD_hlVolumeTexture *This,
+	UINT Level,
+	void **ppVolumeLevel)
+{
+	// IDirect3DVolume9 isn't provided
+	*ppVolumeLevel = NULL;
+	return E_NOTIMPL;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLVolLockBox(
+	GLD_hlVolumeTexture *This,
+	UINT Level,
+	D3DLOCKED_BOX *pLockedVolume,
+	const D3DBOX *pBox,
+	DWORD Flags)
+{
+	GLD_hlVolume	*pVol;
+	UINT			nBits;
+	D3DBOX			box;
+
+	if (Level >= This->nLevels) {
+		gldHLError("LockBox: level %u doesn't exist", Level);
+		return D3DERR_INVALIDCALL;
+	}
+	pVol = &This->pVolumes[Level];
+	if (pVol->bLocked) {
+		gldHLError("LockBox: level %u is already locked", Level);
+		return D3DERR_INVALIDCALL;
+	}
+	if (pBox) {
+		box = *pBox;
+		if (box.Right > pVol->Desc.Width || box.Bottom > pVol->Desc.Height || box.Back > pVol->Desc.Depth ||
+			box.Left >= box.Right || box.Top >= box.Bottom || box.Front >= box.Back)
+		{
+			gldHLError("LockBox: box outside the volume");
+			return D3DERR_INVALIDCALL;
+		}
+	} else {
+		box.Left	= box.Top = box.Front = 0;
+		box.Right	= pVol->Desc.Width;
+		box.Bottom	= pVol->Desc.Height;
+		box.Back	= pVol->Desc.Depth;
+	}
+
+	nBits = gldHLFormatBits(pVol->Desc.Format);
+	gldHLStats.dwVolumeLocks++;
+	_gldHLCountLock(Flags, &gldHLStats.qwSurfaceLockBytes,
+		(box.Right - box.Left) * nBits / 8 * (box.Bottom - box.Top) * (box.Back - box.Front));
+
+	pVol->bLocked				= TRUE;
+	pLockedVolume->RowPitch		= pVol->RowPitch;
+	pLockedVolume->SlicePitch	= pVol->SlicePitch;
+	pLockedVolume->pBits		= pVol->pBits + box.Front * pVol->SlicePitch + box.Top * pVol->RowPitch + box.Left * nBits / 8;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLVolUnlockBox(
+	GLD_hlVolumeTexture *This,
+	UINT Level)
+{
+	if (Level >= This->nLevels || !This->pVolumes[Level].bLocked) {
+		gldHLError("UnlockBox: level %u isn't locked", Level);
+		return D3DERR_INVALIDCALL;
+	}
+	This->pVolumes[Level].bLocked = FALSE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLVolAddDirtyBox(
+	GLD_hlVolumeTexture *This,
+	const D3DBOX *pDirtyBox)
+{
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Vertex and index buffers
+// ***********************************************************************
+
+HRESULT gldHLCreateBuffer(
+	GLD_hlDevice *pDevice,
+	GLD_hlKind Kind,
+	UINT Length,
+	DWORD Usage,
+	D3DFORMAT Format,
+	DWORD FVF,
+	D3DPOOL Pool,
+	GLD_hlBuffer **ppBuffer)
+{
+	GLD_hlBuffer	*pBuf;
+
+	*ppBuffer = NULL;
+	if (!Length) {
+		gldHLError("Create%sBuffer: zero length", (Kind == GLD_HL_VERTEXBUFFER) ? "Vertex" : "Index");
+		return D3DERR_INVALIDCALL;
+	}
+	if ((Usage & D3DUSAGE_DYNAMIC) && Pool == D3DPOOL_MANAGED) {
+		gldHLError("Create%sBuffer: D3DUSAGE_DYNAMIC in D3DPOOL_MANAGED", (Kind == GLD_HL_VERTEXBUFFER) ? "Vertex" : "Index");
+		return D3DERR_INVALIDCALL;
+	}
+
+	pBuf = _gldHLNewObject(pDevice, Kind, sizeof(GLD_hlBuffer));
+	if (!pBuf)
+		return E_OUTOFMEMORY;
+	pBuf->Format	= Format;
+	pBuf->Usage		= Usage;
+	pBuf->Pool		= Pool;
+	pBuf->Size		= Length;
+	pBuf->FVF		= FVF;
+	pBuf->pData		= malloc(Length);
+	if (!pBuf->pData) {
+		_gldHLDestroy(&pBuf->Obj);
+		return E_OUTOFMEMORY;
+	}
+	// Never-written contents are garbage, as they would be in video memory
+	memset(pBuf->pData, GLD_HL_DISCARD_FILL, Length);
+
+	*ppBuffer = pBuf;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static HRESULT STDMETHODCALLTYPE _gldHLBufferLock(
+	GLD_hlBuffer *This,
+	UINT OffsetToLock,
+	UINT SizeToLock,
+	void **ppbData,
+	DWORD Flags)
+{
+	const char	*pszKind = (This->Obj.Kind == GLD_HL_VERTEXBUFFER) ? "VB" : "IB";
+
+	*ppbData = NULL;
+	if (This->bLocked) {
+		gldHLError("%s Lock: already locked", pszKind);
+		return D3DERR_INVALIDCALL;
+	}
+	if (!SizeToLock && !OffsetToLock)
+		SizeToLock = This->Size;
+	if (OffsetToLock + SizeToLock > This->Size || (!SizeToLock && OffsetToLock >= This->Size)) {
+		gldHLError("%s Lock: %u bytes at %u overrun the %u byte buffer", pszKind, SizeToLock, OffsetToLock, This->Size);
+		return D3DERR_INVALIDCALL;
+	}
+	if (!SizeToLock)
+		SizeToLock = This->Size - OffsetToLock;
+	if ((Flags & (D3DLOCK_DISCARD | D3DLOCK_NOOVERWRITE)) && !(This->Usage & D3DUSAGE_DYNAMIC))
+		gldHLError("%s Lock: D3DLOCK_DISCARD or D3DLOCK_NOOVERWRITE on a buffer that isn't dynamic", pszKind);
+	if ((Flags & D3DLOCK_DISCARD) && (Flags & D3DLOCK_NOOVERWRITE))
+		gldHLError("%s Lock: both D3DLOCK_DISCARD and D3DLOCK_NOOVERWRITE", pszKind);
+	if ((Flags & D3DLOCK_READONLY) && (This->Usage & D3DUSAGE_WRITEONLY))
+		gldHLError("%s Lock: D3DLOCK_READONLY on a D3DUSAGE_WRITEONLY buffer", pszKind);
+
+	// Discarded contents are gone; make sure nothing reads them back
+	if ((Flags & D3DLOCK_DISCARD) && (This->Usage & D3DUSAGE_DYNAMIC))
+		memset(This->pData, GLD_HL_DISCARD_FILL, This->Size);
+
+	if (This->Obj.Kind == GLD_HL_VERTEXBUFFER) {
+		gldHLStats.dwVBLocks++;
+		_gldHLCountLock(Flags, &gldHLStats.qwVBLockBytes, SizeToLock);
+	} else {
+		gldHLStats.dwIBLocks++;
+		_gldHLCountLock(Flags, &gldHLStats.qwIBLockBytes, SizeToLock);
+	}
+
+	This->bLocked	= TRUE;
+	*ppbData		= This->pData + OffsetToLock;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLBufferUnlock(
+	GLD_hlBuffer *This)
+{
+	if (!This->bLocked) {
+		gldHLError("%s Unlock: not locked", (This->Obj.Kind == GLD_HL_VERTEXBUFFER) ? "VB" : "IB");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bLocked = FALSE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLVBGetDesc(
+	GLD_hlBuffer *This,
+	D3DVERTEXBUFFER_DESC *pDesc)
+{
+	pDesc->Format	= D3DFMT_VERTEXDATA;
+	pDesc->Type		= D3DRTYPE_VERTEXBUFFER;
+	pDesc->Usage	= This->Usage;
+	pDesc->Pool		= This->Pool;
+	pDesc->Size		= This->Size;
+	pDesc->FVF		= This->FVF;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLIBGetDesc(
+	GLD_hlBuffer *This,
+	D3DINDEXBUFFER_DESC *pDesc)
+{
+	pDesc->Format	= This->Format;
+	pDesc->Type		= D3DRTYPE_INDEXBUFFER;
+	pDesc->Usage	= This->Usage;
+	pDesc->Pool		= This->Pool;
+	pDesc->Size		= This->Size;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+const BYTE* gldHeadlessVertexData(
+	IDirect3DVertexBuffer9 *pVB,
+	UINT *pSize)
+{
+	GLD_hlBuffer	*pBuf = (GLD_hlBuffer*)pVB;
+
+	if (!pBuf || pBuf->Obj.Kind != GLD_HL_VERTEXBUFFER)
+		return NULL;
+	if (pSize)
+		*pSize = pBuf->Size;
+	return pBuf->pData;
+}
+
+const BYTE* gldHeadlessIndexData(
+	IDirect3DIndexBuffer9 *pIB,
+	UINT *pSize)
+{
+	GLD_hlBuffer	*pBuf = (GLD_hlBuffer*)pIB;
+
+	if (!pBuf || pBuf->Obj.Kind != GLD_HL_INDEXBUFFER)
+		return NULL;
+	if (pSize)
+		*pSize = pBuf->Size;
+	return pBuf->pData;
+}
+
+// ***********************************************************************
+// Declarations and shaders
+// ***********************************************************************
+
+HRESULT gldHLCreateDeclaration(
+	GLD_hlDevice *pDevice,
+	const D3DVERTEXELEMENT9 *pElements,
+	GLD_hlDeclaration **ppDecl)
+{
+	GLD_hlDeclaration	*pDecl;
+	UINT				n;
+
+	*ppDecl = NULL;
+	for (n = 0; pElements[n].Stream != 0xFF; n++) {
+		if (n >= 64 || pElements[n].Stream >= GLD_HL_MAX_STREAMS) {
+			gldHLError("CreateVertexDeclaration: bad element %u", n);
+			return D3DERR_INVALIDCALL;
+		}
+	}
+	n++;
+
+	pDecl = _gldHLNewObject(pDevice, GLD_HL_DECLARATION, sizeof(GLD_hlDeclaration));
+	if (!pDecl)
+		return E_OUTOFMEMORY;
+	pDecl->nElements = n;
+	pDecl->pElements = malloc(n * sizeof(D3DVERTEXELEMENT9));
+	memcpy(pDecl->pElements, pElements, n * sizeof(D3DVERTEXELEMENT9));
+
+	*ppDecl = pDecl;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLDeclGetDeclaration(
+	GLD_hlDeclaration *This,
+	D3DVERTEXELEMENT9 *pElement,
+	UINT *pNumElements)
+{
+	if (pElement)
+		memcpy(pElement, This->pElements, This->nElements * sizeof(D3DVERTEXELEMENT9));
+	*pNumElements = This->nElements;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+HRESULT gldHLCreateShader(
+	GLD_hlDevice *pDevice,
+	GLD_hlKind Kind,
+	const DWORD *pFunction,
+	GLD_hlShader **ppShader)
+{
+	GLD_hlShader	*pShader;
+	UINT			n;
+
+	*ppShader = NULL;
+	if (!pFunction) {
+		gldHLError("Create%sShader: no function", (Kind == GLD_HL_VERTEXSHADER) ? "Vertex" : "Pixel");
+		return D3DERR_INVALIDCALL;
+	}
+	// Up to and including the end token
+	for (n = 0; pFunction[n] != 0x0000FFFF; n++)
+		;
+	n++;
+
+	pShader = _gldHLNewObject(pDevice, Kind, sizeof(GLD_hlShader));
+	if (!pShader)
+		return E_OUTOFMEMORY;
+	pShader->dwSize		= n * sizeof(DWORD);
+	pShader->pFunction	= malloc(pShader->dwSize);
+	memcpy(pShader->pFunction, pFunction, pShader->dwSize);
+
+	*ppShader = pShader;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLShaderGetFunction(
+	GLD_hlShader *This,
+	void *pData,
+	UINT *pSizeOfData)
+{
+	if (pData) {
+		if (*pSizeOfData < This->dwSize)
+			return D3DERR_INVALIDCALL;
+		memcpy(pData, This->pFunction, This->dwSize);
+	}
+	*pSizeOfData = This->dwSize;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Queries. Everything has finished by the time it's asked.
+// ***********************************************************************
+
+HRESULT gldHLCreateQuery(
+	GLD_hlDevice *pDevice,
+	D3DQUERYTYPE Type,
+	GLD_hlQuery **ppQuery)
+{
+	GLD_hlQuery	*pQuery;
+
+	if (Type != D3DQUERYTYPE_EVENT && Type != D3DQUERYTYPE_OCCLUSION)
+		return D3DERR_NOTAVAILABLE;
+	// A NULL ppQuery asks whether the type is supported
+	if (!ppQuery)
+		return D3D_OK;
+
+	pQuery = _gldHLNewObject(pDevice, GLD_HL_QUERY, sizeof(GLD_hlQuery));
+	if (!pQuery)
+		return E_OUTOFMEMORY;
+	pQuery->Type = Type;
+	*ppQuery = pQuery;
+	return D3D_OK;
+}
+
+static D3DQUERYTYPE STDMETHODCALLTYPE _gldHLQueryGetType(
+	GLD_hlQuery *This)
+{
+	return This->Type;
+}
+
+static DWORD STDMETHODCALLTYPE _gldHLQueryGetDataSize(
+	GLD_hlQuery *This)
+{
+	return (This->Type == D3DQUERYTYPE_EVENT) ? sizeof(BOOL) : sizeof(DWORD);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLQueryIssue(
+	GLD_hlQuery *This,
+	DWORD dwIssueFlags)
+{
+	if (dwIssueFlags & D3DISSUE_END)
+		This->bIssued = TRUE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLQueryGetData(
+	GLD_hlQuery *This,
+	void *pData,
+	DWORD dwSize,
+	DWORD dwGetDataFlags)
+{
+	if (!This->bIssued) {
+		gldHLError("Query GetData before Issue(D3DISSUE_END)");
+		return D3DERR_INVALIDCALL;
+	}
+	if (pData && dwSize) {
+		if (This->Type == D3DQUERYTYPE_EVENT)
+			*(BOOL*)pData = TRUE;
+		else
+			*(DWORD*)pData = 0; // Nothing is rasterised
+	}
+	return S_OK;
+}
+
+// ***********************************************************************
+// State blocks. Nothing is rendered, so recording state isn't needed.
+// ***********************************************************************
+
+HRESULT gldHLCreateStateBlock(
+	GLD_hlDevice *pDevice,
+	D3DSTATEBLOCKTYPE Type,
+	GLD_hlStateBlock **ppSB)
+{
+	*ppSB = _gldHLNewObject(pDevice, GLD_HL_STATEBLOCK, sizeof(GLD_hlStateBlock));
+	if (!*ppSB)
+		return E_OUTOFMEMORY;
+	(*ppSB)->Type = Type;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLStateBlockCapture(
+	GLD_hlStateBlock *This)
+{
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLStateBlockApply(
+	GLD_hlStateBlock *This)
+{
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// The implicit swap chain. It is part of the device and shares its count.
+// ***********************************************************************
+
+void gldHLInitSwapChain(
+	GLD_hlDevice *pDevice)
+{
+	if (!bHLVtblsReady)
+		_gldHLInitVtbls();
+	pDevice->SwapChain.Obj.lpVtbl	= &hlSwapChainVtbl;
+	pDevice->SwapChain.Obj.Kind		= GLD_HL_SWAPCHAIN;
+	pDevice->SwapChain.Obj.pDevice	= pDevice;
+}
+
+#define _GLD_HL_SC_DEVICE(This)		((IDirect3DDevice9*)(This)->Obj.pDevice)
+
+static ULONG STDMETHODCALLTYPE _gldHLSwapChainAddRef(
+	GLD_hlSwapChain *This)
+{
+	return IDirect3DDevice9_AddRef(_GLD_HL_SC_DEVICE(This));
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLSwapChainRelease(
+	GLD_hlSwapChain *This)
+{
+	return IDirect3DDevice9_Release(_GLD_HL_SC_DEVICE(This));
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSwapChainPresent(
+	GLD_hlSwapChain *This,
+	const RECT *pSourceRect,
+	const RECT *pDestRect,
+	HWND hDestWindowOverride,
+	const RGNDATA *pDirtyRegion,
+	DWORD dwFlags)
+{
+	return IDirect3DDevice9_Present(_GLD_HL_SC_DEVICE(This), pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSwapChainGetFrontBufferData(
+	GLD_hlSwapChain *This,
+	IDirect3DSurface9 *pDestSurface)
+{
+	return IDirect3DDevice9_GetFrontBufferData(_GLD_HL_SC_DEVICE(This), 0, pDestSurface);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSwapChainGetBackBuffer(
+	GLD_hlSwapChain *This,
+	UINT iBackBuffer,
+	D3DBACKBUFFER_TYPE Type,
+	IDirect3DSurface9 **ppBackBuffer)
+{
+	return IDirect3DDevice9_GetBackBuffer(_GLD_HL_SC_DEVICE(This), 0, iBackBuffer, Type, ppBackBuffer);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSwapChainGetRasterStatus(
+	GLD_hlSwapChain *This,
+	D3DRASTER_STATUS *pRasterStatus)
+{
+	return IDirect3DDevice9_GetRasterStatus(_GLD_HL_SC_DEVICE(This), 0, pRasterStatus);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSwapChainGetDisplayMode(
+	GLD_hlSwapChain *This,
+	D3DDISPLAYMODE *pMode)
+{
+	return IDirect3DDevice9_GetDisplayMode(_GLD_HL_SC_DEVICE(This), 0, pMode);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLSwapChainGetPresentParameters(
+	GLD_hlSwapChain *This,
+	D3DPRESENT_PARAMETERS *pPresentationParameters)
+{
+	*pPresentationParameters = This->Obj.pDevice->pp;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Vtables
+// ***********************************************************************
+
+#define _GLD_HL_UNKNOWN(v)								\
+	(v)->QueryInterface		= (void*)_gldHLQueryInterface;	\
+	(v)->AddRef				= (void*)_gldHLAddRef;			\
+	(v)->Release			= (void*)_gldHLRelease
+
+#define _GLD_HL_RESOURCE(v)								\
+	_GLD_HL_UNKNOWN(v);									\
+	(v)->GetDevice			= (void*)_gldHLGetDevice;		\
+	(v)->SetPrivateData		= (void*)_gldHLSetPrivateData;	\
+	(v)->GetPrivateData		= (void*)_gldHLGetPrivateData;	\
+	(v)->FreePrivateData	= (void*)_gldHLFreePrivateData;	\
+	(v)->SetPriority		= (void*)_gldHLSetPriority;		\
+	(v)->GetPriority		= (void*)_gldHLGetPriority;		\
+	(v)->PreLoad			= (void*)_gldHLPreLoad;			\
+	(v)->GetType			= (void*)_gldHLGetType
+
+#define _GLD_HL_BASETEXTURE(v)									\
+	_GLD_HL_RESOURCE(v);										\
+	(v)->SetLOD					= (void*)_gldHLTexSetLOD;				\
+	(v)->GetLOD					= (void*)_gldHLTexGetLOD;				\
+	(v)->GetLevelCount			= (void*)_gldHLTexGetLevelCount;		\
+	(v)->SetAutoGenFilterType	= (void*)_gldHLTexSetAutoGenFilterType;	\
+	(v)->GetAutoGenFilterType	= (void*)_gldHLTexGetAutoGenFilterType;	\
+	(v)->GenerateMipSubLevels	= (void*)_gldHLTexGenerateMipSubLevels
+
+static void _gldHLInitVtbls(void)
+{
+	// Volume textures share the level count and LOD layout of textures
+	IDirect3DSurface9Vtbl			*s	= &hlSurfaceVtbl;
+	IDirect3DTexture9Vtbl			*t	= &hlTextureVtbl;
+	IDirect3DCubeTexture9Vtbl		*c	= &hlCubeTextureVtbl;
+	IDirect3DVolumeTexture9Vtbl		*vt	= &hlVolumeTextureVtbl;
+	IDirect3DVertexBuffer9Vtbl		*vb	= &hlVertexBufferVtbl;
+	IDirect3DIndexBuffer9Vtbl		*ib	= &hlIndexBufferVtbl;
+	IDirect3DVertexDeclaration9Vtbl	*d	= &hlDeclarationVtbl;
+	IDirect3DVertexShader9Vtbl		*vs	= &hlVertexShaderVtbl;
+	IDirect3DPixelShader9Vtbl		*ps	= &hlPixelShaderVtbl;
+	IDirect3DQuery9Vtbl				*q	= &hlQueryVtbl;
+	IDirect3DStateBlock9Vtbl		*sb	= &hlStateBlockVtbl;
+	IDirect3DSwapChain9Vtbl			*sc	= &hlSwapChainVtbl;
+
+	_GLD_HL_RESOURCE(s);
+	s->GetContainer			= (void*)_gldHLSurfaceGetContainer;
+	s->GetDesc				= (void*)_gldHLSurfaceGetDesc;
+	s->LockRect				= (void*)_gldHLSurfaceLockRect;
+	s->UnlockRect			= (void*)_gldHLSurfaceUnlockRect;
+	s->GetDC				= (void*)_gldHLSurfaceGetDC;
+	s->ReleaseDC			= (void*)_gldHLSurfaceReleaseDC;
+
+	_GLD_HL_BASETEXTURE(t);
+	t->GetLevelDesc			= (void*)_gldHLTexGetLevelDesc;
+	t->GetSurfaceLevel		= (void*)_gldHLTexGetSurfaceLevel;
+	t->LockRect				= (void*)_gldHLTexLockRect;
+	t->UnlockRect			= (void*)_gldHLTexUnlockRect;
+	t->AddDirtyRect			= (void*)_gldHLTexAddDirtyRect;
+
+	_GLD_HL_BASETEXTURE(c);
+	c->GetLevelDesc			= (void*)_gldHLTexGetLevelDesc;
+	c->GetCubeMapSurface	= (void*)_gldHLCubeGetCubeMapSurface;
+	c->LockRect				= (void*)_gldHLCubeLockRect;
+	c->UnlockRect			= (void*)_gldHLCubeUnlockRect;
+	c->AddDirtyRect			= (void*)_gldHLCubeAddDirtyRect;
+
+	_GLD_HL_BASETEXTURE(vt);
+	vt->GetLevelDesc		= (void*)_gldHLVolGetLevelDesc;
+	vt->GetVolumeLevel		= (void*)_gldHLVolGetVolumeLevel;
+	vt->LockBox				= (void*)_gldHLVolLockBox;
+	vt->UnlockBox			= (void*)_gldHLVolUnlockBox;
+	vt->AddDirtyBox			= (void*)_gldHLVolAddDirtyBox;
+
+	_GLD_HL_RESOURCE(vb);
+	vb->Lock				= (void*)_gldHLBufferLock;
+	vb->Unlock				= (void*)_gldHLBufferUnlock;
+	vb->GetDesc				= (void*)_gldHLVBGetDesc;
+
+	_GLD_HL_RESOURCE(ib);
+	ib->Lock				= (void*)_gldHLBufferLock;
+	ib->Unlock				= (void*)_gldHLBufferUnlock;
+	ib->GetDesc				= (void*)_gldHLIBGetDesc;
+
+	_GLD_HL_UNKNOWN(d);
+	d->GetDevice			= (void*)_gldHLGetDevice;
+	d->GetDeclaration		= (void*)_gldHLDeclGetDeclaration;
+
+	_GLD_HL_UNKNOWN(vs);
+	vs->GetDevice			= (void*)_gldHLGetDevice;
+	vs->GetFunction			= (void*)_gldHLShaderGetFunction;
+
+	_GLD_HL_UNKNOWN(ps);
+	ps->GetDevice			= (void*)_gldHLGetDevice;
+	ps->GetFunction			= (void*)_gldHLShaderGetFunction;
+
+	_GLD_HL_UNKNOWN(q);
+	q->GetDevice			= (void*)_gldHLGetDevice;
+	q->GetType				= (void*)_gldHLQueryGetType;
+	q->GetDataSize			= (void*)_gldHLQueryGetDataSize;
+	q->Issue				= (void*)_gldHLQueryIssue;
+	q->GetData				= (void*)_gldHLQueryGetData;
+
+	_GLD_HL_UNKNOWN(sb);
+	sb->GetDevice			= (void*)_gldHLGetDevice;
+	sb->Capture				= (void*)_gldHLStateBlockCapture;
+	sb->Apply				= (void*)_gldHLStateBlockApply;
+
+	_GLD_HL_UNKNOWN(sc);
+	sc->AddRef				= (void*)_gldHLSwapChainAddRef;
+	sc->Release				= (void*)_gldHLSwapChainRelease;
+	sc->Present				= (void*)_gldHLSwapChainPresent;
+	sc->GetFrontBufferData	= (void*)_gldHLSwapChainGetFrontBufferData;
+	sc->GetBackBuffer		= (void*)_gldHLSwapChainGetBackBuffer;
+	sc->GetRasterStatus		= (void*)_gldHLSwapChainGetRasterStatus;
+	sc->GetDisplayMode		= (void*)_gldHLSwapChainGetDisplayMode;
+	sc->GetDevice			= (void*)_gldHLGetDevice;
+	sc->GetPresentParameters = (void*)_gldHLSwapChainGetPresentParameters;
+
+	bHLVtblsReady = TRUE;
+}
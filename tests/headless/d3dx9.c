@@ -0,0 +1,1403 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  The parts of D3DX the driver uses, for the headless build: matrices,
+*               surface loading and conversion, mipmap filtering, texture files, and
+*               an effect framework that checks how effects are driven but compiles
+*               nothing.
+*
+*********************************************************************************/
+
+#include <ctype.h>
+#include <windows.h>
+#include <d3d9.h>
+#include <d3dx9.h>
+
+#include "gld_hl_d3d9.h"
+
+// ***********************************************************************
+
+#define GLD_HL_DRIVER_LEVEL		900
+#define GLD_HL_FILE_MAGIC		0x20534444	// "DDS "
+#define GLD_HL_DDPF_FOURCC		0x00000004
+#define GLD_HL_DDSCAPS2_CUBEMAP	0x0000FE00
+
+// {79AAB587-6DBC-4FA7-82DE-37FA1781C5CE}
+const GUID IID_ID3DXEffectStateManager = {
+	0x79aab587, 0x6dbc, 0x4fa7, { 0x82, 0xde, 0x37, 0xfa, 0x17, 0x81, 0xc5, 0xce }
+};
+
+// A run of pixels in memory, in a surface or in the caller's buffer
+typedef struct {
+	BYTE					*pBits;
+	UINT					Pitch;
+	D3DFORMAT				Format;
+	UINT					Width;
+	UINT					Height;
+} GLD_hlImage;
+
+// Header of the texture files; laid out as a DDS file with the
+// Direct3D format as its FourCC, the way D3DX writes float formats
+typedef struct {
+	DWORD					dwMagic;
+	DWORD					dwSize;			// 124
+	DWORD					dwFlags;
+	DWORD					dwHeight;
+	DWORD					dwWidth;
+	DWORD					dwPitchOrLinearSize;
+	DWORD					dwDepth;
+	DWORD					dwMipMapCount;
+	DWORD					dwReserved1[11];
+	DWORD					dwPFSize;		// 32
+	DWORD					dwPFFlags;
+	DWORD					dwFourCC;
+	DWORD					dwPFReserved[5];
+	DWORD					dwCaps;
+	DWORD					dwCaps2;
+	DWORD					dwReserved2[3];
+} GLD_hlFileHeader;
+
+typedef struct {
+	ID3DXBufferVtbl			*lpVtbl;
+	LONG					lRefs;
+	DWORD					dwSize;
+	BYTE					*pData;
+} GLD_hlXBuffer;
+
+typedef struct {
+	ID3DXEffectPoolVtbl		*lpVtbl;
+	LONG					lRefs;
+} GLD_hlEffectPool;
+
+typedef struct {
+	ID3DXEffectCompilerVtbl	*lpVtbl;
+	LONG					lRefs;
+	char					*pszText;
+	UINT					nLength;
+} GLD_hlEffectCompiler;
+
+// Only the names an effect declares are valid handles; nothing is
+// compiled, so passes set no state of their own
+typedef struct {
+	ID3DXEffectVtbl			*lpVtbl;
+	LONG					lRefs;
+	IDirect3DDevice9		*pDevice;
+	ID3DXEffectPool			*pPool;
+	ID3DXEffectStateManager	*pManager;
+	char					*pszText;
+	char					**ppNames;		// Handles handed out
+	UINT					nNames;
+	D3DXHANDLE				hTechnique;
+	BOOL					bInBegin;
+	BOOL					bInPass;
+} GLD_hlEffect;
+
+static ID3DXBufferVtbl			hlXBufferVtbl;
+static ID3DXEffectPoolVtbl		hlEffectPoolVtbl;
+static ID3DXEffectCompilerVtbl	hlEffectCompilerVtbl;
+static ID3DXEffectVtbl			hlEffectVtbl;
+static BOOL						bHLXVtblsReady = FALSE;
+
+static void _gldHLInitXVtbls(void);
+
+// ***********************************************************************
+// Matrices
+// ***********************************************************************
+
+D3DXMATRIX* WINAPI D3DXMatrixIdentity(
+	D3DXMATRIX *pOut)
+{
+	ZeroMemory(pOut, sizeof(*pOut));
+	pOut->_11 = pOut->_22 = pOut->_33 = pOut->_44 = 1.0f;
+	return pOut;
+}
+
+// ***********************************************************************
+
+D3DXMATRIX* WINAPI D3DXMatrixMultiply(
+	D3DXMATRIX *pOut,
+	const D3DXMATRIX *pM1,
+	const D3DXMATRIX *pM2)
+{
+	// pOut may be either input
+	D3DXMATRIX	m;
+	int			i, j;
+
+	for (i=0; i<4; i++) {
+		for (j=0; j<4; j++) {
+			m.m[i][j] = pM1->m[i][0] * pM2->m[0][j] + pM1->m[i][1] * pM2->m[1][j] +
+						pM1->m[i][2] * pM2->m[2][j] + pM1->m[i][3] * pM2->m[3][j];
+		}
+	}
+	*pOut = m;
+	return pOut;
+}
+
+// ***********************************************************************
+
+UINT WINAPI D3DXGetDriverLevel(
+	LPDIRECT3DDEVICE9 pDevice)
+{
+	return GLD_HL_DRIVER_LEVEL;
+}
+
+// ***********************************************************************
+// Pixel conversion
+// ***********************************************************************
+
+static DWORD _gldHLExpand(
+	DWORD v,
+	UINT nBits)
+{
+	// Replicate the top bits so that all ones stays all ones
+	if (!nBits)
+		return 0;
+	v = v << (8 - nBits);
+	return v | (v >> nBits);
+}
+
+// ***********************************************************************
+
+static DWORD _gldHLDecodeDXTColor(
+	const BYTE *pBlock,
+	UINT u,
+	BOOL bDXT1)
+{
+	WORD	c0 = pBlock[0] | (pBlock[1] << 8);
+	WORD	c1 = pBlock[2] | (pBlock[3] << 8);
+	DWORD	dwIdx = (pBlock[4] | (pBlock[5] << 8) | (pBlock[6] << 16) | ((DWORD)pBlock[7] << 24)) >> (u * 2) & 3;
+	DWORD	r0 = _gldHLExpand(c0 >> 11, 5), g0 = _gldHLExpand((c0 >> 5) & 0x3F, 6), b0 = _gldHLExpand(c0 & 0x1F, 5);
+	DWORD	r1 = _gldHLExpand(c1 >> 11, 5), g1 = _gldHLExpand((c1 >> 5) & 0x3F, 6), b1 = _gldHLExpand(c1 & 0x1F, 5);
+
+	switch (dwIdx) {
+	case 0:
+		return 0xFF000000 | (r0 << 16) | (g0 << 8) | b0;
+	case 1:
+		return 0xFF000000 | (r1 << 16) | (g1 << 8) | b1;
+	case 2:
+		if (bDXT1 && c0 <= c1)
+			return 0xFF000000 | (((r0 + r1) / 2) << 16) | (((g0 + g1) / 2) << 8) | ((b0 + b1) / 2);
+		return 0xFF000000 | (((2 * r0 + r1) / 3) << 16) | (((2 * g0 + g1) / 3) << 8) | ((2 * b0 + b1) / 3);
+	default:
+		if (bDXT1 && c0 <= c1)
+			return 0;
+		return 0xFF000000 | (((r0 + 2 * r1) / 3) << 16) | (((g0 + 2 * g1) / 3) << 8) | ((b0 + 2 * b1) / 3);
+	}
+}
+
+// ***********************************************************************
+
+static DWORD _gldHLDecodeDXT(
+	const GLD_hlImage *pImg,
+	UINT x,
+	UINT y)
+{
+	const BYTE	*pBlock;
+	UINT		u = (y & 3) * 4 + (x & 3);
+	DWORD		dwColor, a, a0, a1, dwIdx;
+	ULONGLONG	qwBits;
+	int			i;
+
+	if (pImg->Format == D3DFMT_DXT1) {
+		pBlock = pImg->pBits + (y / 4) * pImg->Pitch + (x / 4) * 8;
+		return _gldHLDecodeDXTColor(pBlock, u, TRUE);
+	}
+	pBlock	= pImg->pBits + (y / 4) * pImg->Pitch + (x / 4) * 16;
+	dwColor	= _gldHLDecodeDXTColor(pBlock + 8, u, FALSE) & 0x00FFFFFF;
+	if (pImg->Format == D3DFMT_DXT2 || pImg->Format == D3DFMT_DXT3) {
+		a = (pBlock[u / 2] >> ((u & 1) * 4)) & 0xF;
+		return (_gldHLExpand(a, 4) << 24) | dwColor;
+	}
+
+	// DXT4/5: two endpoints and 48 bits of 3 bit indices
+	a0 = pBlock[0];
+	a1 = pBlock[1];
+	for (qwBits=0, i=7; i>=2; i--)
+		qwBits = (qwBits << 8) | pBlock[i];
+	dwIdx = (DWORD)(qwBits >> (u * 3)) & 7;
+	if (dwIdx == 0)
+		a = a0;
+	else if (dwIdx == 1)
+		a = a1;
+	else if (a0 > a1)
+		a = ((8 - dwIdx) * a0 + (dwIdx - 1) * a1) / 7;
+	else if (dwIdx < 6)
+		a = ((6 - dwIdx) * a0 + (dwIdx - 1) * a1) / 5;
+	else
+		a = (dwIdx == 6) ? 0 : 255;
+	return (a << 24) | dwColor;
+}
+
+// ***********************************************************************
+
+static DWORD _gldHLReadPixel(
+	const GLD_hlImage *pImg,
+	UINT x,
+	UINT y)
+{
+	// Returns A8R8G8B8
+	const BYTE	*p;
+	DWORD		v;
+
+	if (gldHLFormatIsDXT(pImg->Format))
+		return _gldHLDecodeDXT(pImg, x, y);
+
+	p = pImg->pBits + y * pImg->Pitch + x * (gldHLFormatBits(pImg->Format) / 8);
+	switch (pImg->Format) {
+	case D3DFMT_A8R8G8B8:
+		return *(const DWORD*)p;
+	case D3DFMT_X8R8G8B8:
+		return *(const DWORD*)p | 0xFF000000;
+	case D3DFMT_A8B8G8R8:
+		v = *(const DWORD*)p;
+		return (v & 0xFF00FF00) | ((v >> 16) & 0xFF) | ((v & 0xFF) << 16);
+	case D3DFMT_X8B8G8R8:
+		v = *(const DWORD*)p;
+		return 0xFF000000 | (v & 0x0000FF00) | ((v >> 16) & 0xFF) | ((v & 0xFF) << 16);
+	case D3DFMT_R8G8B8:
+		return 0xFF000000 | (p[2] << 16) | (p[1] << 8) | p[0];
+	case D3DFMT_R5G6B5:
+		v = *(const WORD*)p;
+		return 0xFF000000 | (_gldHLExpand(v >> 11, 5) << 16) | (_gldHLExpand((v >> 5) & 0x3F, 6) << 8) | _gldHLExpand(v & 0x1F, 5);
+	case D3DFMT_X1R5G5B5:
+	case D3DFMT_A1R5G5B5:
+		v = *(const WORD*)p;
+		return ((pImg->Format == D3DFMT_X1R5G5B5 || (v & 0x8000)) ? 0xFF000000 : 0) |
+			(_gldHLExpand((v >> 10) & 0x1F, 5) << 16) | (_gldHLExpand((v >> 5) & 0x1F, 5) << 8) | _gldHLExpand(v & 0x1F, 5);
+	case D3DFMT_A4R4G4B4:
+	case D3DFMT_X4R4G4B4:
+		v = *(const WORD*)p;
+		return ((pImg->Format == D3DFMT_X4R4G4B4) ? 0xFF000000 : (_gldHLExpand(v >> 12, 4) << 24)) |
+			(_gldHLExpand((v >> 8) & 0xF, 4) << 16) | (_gldHLExpand((v >> 4) & 0xF, 4) << 8) | _gldHLExpand(v & 0xF, 4);
+	case D3DFMT_A8:
+		return (DWORD)p[0] << 24;
+	case D3DFMT_L8:
+		return 0xFF000000 | (p[0] << 16) | (p[0] << 8) | p[0];
+	case D3DFMT_A8L8:
+		return ((DWORD)p[1] << 24) | (p[0] << 16) | (p[0] << 8) | p[0];
+	case D3DFMT_A4L4:
+		v = _gldHLExpand(p[0] & 0xF, 4);
+		return (_gldHLExpand(p[0] >> 4, 4) << 24) | (v << 16) | (v << 8) | v;
+	default:
+		// Formats the driver doesn't convert
+		return 0;
+	}
+}
+
+// ***********************************************************************
+
+static void _gldHLWritePixel(
+	const GLD_hlImage *pImg,
+	UINT x,
+	UINT y,
+	DWORD c)
+{
+	BYTE	*p = pImg->pBits + y * pImg->Pitch + x * (gldHLFormatBits(pImg->Format) / 8);
+	DWORD	a = c >> 24, r = (c >> 16) & 0xFF, g = (c >> 8) & 0xFF, b = c & 0xFF;
+	DWORD	l = (r * 77 + g * 150 + b * 29) >> 8;
+
+	switch (pImg->Format) {
+	case D3DFMT_A8R8G8B8:
+	case D3DFMT_X8R8G8B8:
+		*(DWORD*)p = c;
+		break;
+	case D3DFMT_A8B8G8R8:
+	case D3DFMT_X8B8G8R8:
+		*(DWORD*)p = (a << 24) | (b << 16) | (g << 8) | r;
+		break;
+	case D3DFMT_R8G8B8:
+		p[0] = (BYTE)b;
+		p[1] = (BYTE)g;
+		p[2] = (BYTE)r;
+		break;
+	case D3DFMT_R5G6B5:
+		*(WORD*)p = (WORD)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+		break;
+	case D3DFMT_X1R5G5B5:
+	case D3DFMT_A1R5G5B5:
+		*(WORD*)p = (WORD)(((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3));
+		break;
+	case D3DFMT_A4R4G4B4:
+	case D3DFMT_X4R4G4B4:
+		*(WORD*)p = (WORD)(((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4));
+		break;
+	case D3DFMT_A8:
+		p[0] = (BYTE)a;
+		break;
+	case D3DFMT_L8:
+		p[0] = (BYTE)l;
+		break;
+	case D3DFMT_A8L8:
+		p[0] = (BYTE)l;
+		p[1] = (BYTE)a;
+		break;
+	case D3DFMT_A4L4:
+		p[0] = (BYTE)(((a >> 4) << 4) | (l >> 4));
+		break;
+	default:
+		break;
+	}
+}
+
+// ***********************************************************************
+
+static void _gldHLEncodeDXTBlock(
+	BYTE *pBlock,
+	D3DFORMAT Format,
+	const DWORD *pTexels)
+{
+	// Endpoints at the darkest and brightest texels; good enough to
+	// keep test images recognisable, not to look at
+	DWORD	dwMin = 0, dwMax = 0, dwLumMin = 0xFFFFFFFF, dwLumMax = 0, dwLum, dwIdx = 0;
+	DWORD	aMin = 255, aMax = 0, a;
+	WORD	c0, c1, t;
+	BYTE	*pColor = (Format == D3DFMT_DXT1) ? pBlock : pBlock + 8;
+	int		i;
+
+	for (i=0; i<16; i++) {
+		dwLum = ((pTexels[i] >> 16) & 0xFF) * 77 + ((pTexels[i] >> 8) & 0xFF) * 150 + (pTexels[i] & 0xFF) * 29;
+		if (dwLum < dwLumMin) { dwLumMin = dwLum; dwMin = pTexels[i]; }
+		if (dwLum >= dwLumMax) { dwLumMax = dwLum; dwMax = pTexels[i]; }
+		a = pTexels[i] >> 24;
+		aMin = min(aMin, a);
+		aMax = max(aMax, a);
+	}
+	c0 = (WORD)((((dwMax >> 16) & 0xF8) << 8) | (((dwMax >> 8) & 0xFC) << 3) | ((dwMax & 0xF8) >> 3));
+	c1 = (WORD)((((dwMin >> 16) & 0xF8) << 8) | (((dwMin >> 8) & 0xFC) << 3) | ((dwMin & 0xF8) >> 3));
+	if (c0 < c1) {
+		t = c0; c0 = c1; c1 = t;
+	}
+	for (i=0; i<16; i++) {
+		dwLum = ((pTexels[i] >> 16) & 0xFF) * 77 + ((pTexels[i] >> 8) & 0xFF) * 150 + (pTexels[i] & 0xFF) * 29;
+		// Nearer the bright end picks colour 0
+		if (c0 != c1 && dwLum * 2 < dwLumMin + dwLumMax)
+			dwIdx |= 1 << (i * 2);
+	}
+	pColor[0] = (BYTE)c0;
+	pColor[1] = (BYTE)(c0 >> 8);
+	pColor[2] = (BYTE)c1;
+	pColor[3] = (BYTE)(c1 >> 8);
+	pColor[4] = (BYTE)dwIdx;
+	pColor[5] = (BYTE)(dwIdx >> 8);
+	pColor[6] = (BYTE)(dwIdx >> 16);
+	pColor[7] = (BYTE)(dwIdx >> 24);
+
+	if (Format == D3DFMT_DXT2 || Format == D3DFMT_DXT3) {
+		for (i=0; i<8; i++)
+			pBlock[i] = (BYTE)((pTexels[i*2] >> 28) | ((pTexels[i*2+1] >> 28) << 4));
+	} else if (Format == D3DFMT_DXT4 || Format == D3DFMT_DXT5) {
+		// Two endpoints; every texel takes the nearer one
+		ULONGLONG	qwIdx = 0;
+		pBlock[0] = (BYTE)aMax;
+		pBlock[1] = (BYTE)aMin;
+		for (i=0; i<16; i++) {
+			if ((pTexels[i] >> 24) * 2 < aMin + aMax)
+				qwIdx |= (ULONGLONG)1 << (i * 3);
+		}
+		for (i=0; i<6; i++)
+			pBlock[2 + i] = (BYTE)(qwIdx >> (i * 8));
+	}
+}
+
+// ***********************************************************************
+
+static HRESULT _gldHLConvert(
+	const GLD_hlImage *pDst,
+	const RECT *pDstRect,
+	const GLD_hlImage *pSrc,
+	const RECT *pSrcRect)
+{
+	// Point sampled, whatever filter was asked for
+	UINT	dw = pDstRect->right - pDstRect->left;
+	UINT	dh = pDstRect->bottom - pDstRect->top;
+	UINT	sw = pSrcRect->right - pSrcRect->left;
+	UINT	sh = pSrcRect->bottom - pSrcRect->top;
+	UINT	x, y, i, nRowBytes;
+	DWORD	*pTemp, Block[16];
+
+	// Same format, same size: a straight copy
+	if (pDst->Format == pSrc->Format && dw == sw && dh == sh &&
+		(!gldHLFormatIsDXT(pSrc->Format) || !((pDstRect->left | pDstRect->top | pSrcRect->left | pSrcRect->top) & 3)))
+	{
+		UINT	nBits = gldHLFormatBits(pSrc->Format);
+		if (gldHLFormatIsDXT(pSrc->Format)) {
+			nRowBytes = ((sw + 3) / 4) * nBits * 2;
+			for (y=0; y<sh; y+=4) {
+				memcpy(pDst->pBits + ((pDstRect->top + y) / 4) * pDst->Pitch + (pDstRect->left / 4) * nBits * 2,
+					pSrc->pBits + ((pSrcRect->top + y) / 4) * pSrc->Pitch + (pSrcRect->left / 4) * nBits * 2, nRowBytes);
+			}
+		} else {
+			nRowBytes = sw * nBits / 8;
+			for (y=0; y<sh; y++) {
+				memcpy(pDst->pBits + (pDstRect->top + y) * pDst->Pitch + pDstRect->left * nBits / 8,
+					pSrc->pBits + (pSrcRect->top + y) * pSrc->Pitch + pSrcRect->left * nBits / 8, nRowBytes);
+			}
+		}
+		return D3D_OK;
+	}
+
+	pTemp = malloc(dw * dh * sizeof(DWORD));
+	if (!pTemp)
+		return E_OUTOFMEMORY;
+	for (y=0; y<dh; y++) {
+		for (x=0; x<dw; x++)
+			pTemp[y * dw + x] = _gldHLReadPixel(pSrc, pSrcRect->left + x * sw / dw, pSrcRect->top + y * sh / dh);
+	}
+
+	if (!gldHLFormatIsDXT(pDst->Format)) {
+		for (y=0; y<dh; y++) {
+			for (x=0; x<dw; x++)
+				_gldHLWritePixel(pDst, pDstRect->left + x, pDstRect->top + y, pTemp[y * dw + x]);
+		}
+	} else {
+		// Whole blocks; edge texels repeat to fill them
+		UINT	nBlockBytes = gldHLFormatBits(pDst->Format) * 2;
+		for (y=0; y<dh; y+=4) {
+			for (x=0; x<dw; x+=4) {
+				for (i=0; i<16; i++)
+					Block[i] = pTemp[min(y + i / 4, dh - 1) * dw + min(x + (i & 3), dw - 1)];
+				_gldHLEncodeDXTBlock(pDst->pBits + ((pDstRect->top + y) / 4) * pDst->Pitch + ((pDstRect->left + x) / 4) * nBlockBytes,
+					pDst->Format, Block);
+			}
+		}
+	}
+	free(pTemp);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static BOOL _gldHLSurfaceImage(
+	const char *pszFunc,
+	IDirect3DSurface9 *pSurface,
+	const RECT *pRect,
+	GLD_hlImage *pImg,
+	RECT *pOut)
+{
+	GLD_hlSurface	*pSurf = (GLD_hlSurface*)pSurface;
+
+	if (!pSurf) {
+		gldHLError("%s: no surface", pszFunc);
+		return FALSE;
+	}
+	if (pSurf->bLocked) {
+		gldHLError("%s: surface is locked", pszFunc);
+		return FALSE;
+	}
+	pImg->pBits		= pSurf->pBits;
+	pImg->Pitch		= pSurf->Pitch;
+	pImg->Format	= pSurf->Desc.Format;
+	pImg->Width		= pSurf->Desc.Width;
+	pImg->Height	= pSurf->Desc.Height;
+	if (pRect)
+		*pOut = *pRect;
+	else
+		SetRect(pOut, 0, 0, pImg->Width, pImg->Height);
+	if (pOut->left < 0 || pOut->top < 0 || pOut->left >= pOut->right || pOut->top >= pOut->bottom ||
+		pOut->right > (LONG)pImg->Width || pOut->bottom > (LONG)pImg->Height)
+	{
+		gldHLError("%s: rectangle (%d,%d)-(%d,%d) outside %ux%u surface", pszFunc,
+			pOut->left, pOut->top, pOut->right, pOut->bottom, pImg->Width, pImg->Height);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+// ***********************************************************************
+// Surface and texture loading
+// ***********************************************************************
+
+HRESULT WINAPI D3DXLoadSurfaceFromMemory(
+	LPDIRECT3DSURFACE9 pDestSurface,
+	const PALETTEENTRY *pDestPalette,
+	const RECT *pDestRect,
+	LPCVOID pSrcMemory,
+	D3DFORMAT SrcFormat,
+	UINT SrcPitch,
+	const PALETTEENTRY *pSrcPalette,
+	const RECT *pSrcRect,
+	DWORD Filter,
+	D3DCOLOR ColorKey)
+{
+	GLD_hlImage	Dst, Src;
+	RECT		rcDst;
+
+	if (!pSrcMemory || !pSrcRect || !gldHLFormatBits(SrcFormat)) {
+		gldHLError("D3DXLoadSurfaceFromMemory: source %p, format %u", pSrcMemory, SrcFormat);
+		return D3DERR_INVALIDCALL;
+	}
+	if (!_gldHLSurfaceImage("D3DXLoadSurfaceFromMemory", pDestSurface, pDestRect, &Dst, &rcDst))
+		return D3DERR_INVALIDCALL;
+
+	// The source rectangle addresses pSrcMemory directly
+	Src.pBits	= (BYTE*)pSrcMemory;
+	Src.Pitch	= SrcPitch;
+	Src.Format	= SrcFormat;
+	Src.Width	= pSrcRect->right;
+	Src.Height	= pSrcRect->bottom;
+	return _gldHLConvert(&Dst, &rcDst, &Src, pSrcRect);
+}
+
+// ***********************************************************************
+
+HRESULT WINAPI D3DXLoadSurfaceFromSurface(
+	LPDIRECT3DSURFACE9 pDestSurface,
+	const PALETTEENTRY *pDestPalette,
+	const RECT *pDestRect,
+	LPDIRECT3DSURFACE9 pSrcSurface,
+	const PALETTEENTRY *pSrcPalette,
+	const RECT *pSrcRect,
+	DWORD Filter,
+	D3DCOLOR ColorKey)
+{
+	GLD_hlImage	Dst, Src;
+	RECT		rcDst, rcSrc;
+
+	if (!_gldHLSurfaceImage("D3DXLoadSurfaceFromSurface", pDestSurface, pDestRect, &Dst, &rcDst) ||
+		!_gldHLSurfaceImage("D3DXLoadSurfaceFromSurface", pSrcSurface, pSrcRect, &Src, &rcSrc))
+	{
+		return D3DERR_INVALIDCALL;
+	}
+	return _gldHLConvert(&Dst, &rcDst, &Src, &rcSrc);
+}
+
+// ***********************************************************************
+
+HRESULT WINAPI D3DXFilterTexture(
+	LPDIRECT3DBASETEXTURE9 pBaseTexture,
+	const PALETTEENTRY *pPalette,
+	UINT SrcLevel,
+	DWORD Filter)
+{
+	// A 2x2 box filter down the chain, whatever filter was asked for
+	GLD_hlSurface	*pSrc, *pDst;
+	GLD_hlImage		Src, Dst;
+	UINT			nLevels, nFaces, f, i, x, y, sx, sy, k;
+	DWORD			c, Acc[4];
+	DWORD			*pTemp;
+	RECT			rc;
+
+	nLevels = gldHLTextureLevels(pBaseTexture, &nFaces);
+	if (!nLevels) {
+		gldHLError("D3DXFilterTexture: not a 2D or cube texture");
+		return D3DERR_INVALIDCALL;
+	}
+	if (SrcLevel == D3DX_DEFAULT)
+		SrcLevel = 0;
+	if (SrcLevel >= nLevels)
+		return D3DERR_INVALIDCALL;
+
+	for (f=0; f<nFaces; f++) {
+		for (i=SrcLevel+1; i<nLevels; i++) {
+			pSrc = gldHLTextureSurface(pBaseTexture, f, i - 1);
+			pDst = gldHLTextureSurface(pBaseTexture, f, i);
+			if (pSrc->bLocked || pDst->bLocked) {
+				gldHLError("D3DXFilterTexture: level %u is locked", pSrc->bLocked ? i - 1 : i);
+				return D3DERR_INVALIDCALL;
+			}
+			Src.pBits = pSrc->pBits; Src.Pitch = pSrc->Pitch; Src.Format = pSrc->Desc.Format;
+			Src.Width = pSrc->Desc.Width; Src.Height = pSrc->Desc.Height;
+			Dst.pBits = pDst->pBits; Dst.Pitch = pDst->Pitch; Dst.Format = pDst->Desc.Format;
+			Dst.Width = pDst->Desc.Width; Dst.Height = pDst->Desc.Height;
+
+			// Filter into A8R8G8B8, then convert into the level
+			pTemp = malloc(Dst.Width * Dst.Height * sizeof(DWORD));
+			if (!pTemp)
+				return E_OUTOFMEMORY;
+			for (y=0; y<Dst.Height; y++) {
+				for (x=0; x<Dst.Width; x++) {
+					Acc[0] = Acc[1] = Acc[2] = Acc[3] = 0;
+					for (k=0; k<4; k++) {
+						sx = min(x * 2 + (k & 1), Src.Width - 1);
+						sy = min(y * 2 + (k >> 1), Src.Height - 1);
+						c = _gldHLReadPixel(&Src, sx, sy);
+						Acc[0] += c >> 24;
+						Acc[1] += (c >> 16) & 0xFF;
+						Acc[2] += (c >> 8) & 0xFF;
+						Acc[3] += c & 0xFF;
+					}
+					pTemp[y * Dst.Width + x] = (((Acc[0] + 2) / 4) << 24) | (((Acc[1] + 2) / 4) << 16) |
+						(((Acc[2] + 2) / 4) << 8) | ((Acc[3] + 2) / 4);
+				}
+			}
+			Src.pBits	= (BYTE*)pTemp;
+			Src.Pitch	= Dst.Width * sizeof(DWORD);
+			Src.Format	= D3DFMT_A8R8G8B8;
+			Src.Width	= Dst.Width;
+			Src.Height	= Dst.Height;
+			SetRect(&rc, 0, 0, Dst.Width, Dst.Height);
+			_gldHLConvert(&Dst, &rc, &Src, &rc);
+			free(pTemp);
+		}
+	}
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static UINT _gldHLPow2(
+	UINT n)
+{
+	UINT	p = 1;
+
+	while (p < n)
+		p <<= 1;
+	return p;
+}
+
+// ***********************************************************************
+
+HRESULT WINAPI D3DXCreateTexture(
+	LPDIRECT3DDEVICE9 pDevice,
+	UINT Width,
+	UINT Height,
+	UINT MipLevels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	LPDIRECT3DTEXTURE9 *ppTexture)
+{
+	// Sizes are rounded up to what the device takes, as D3DX does
+	if (Width == D3DX_DEFAULT || !Width)
+		Width = 256;
+	if (Height == D3DX_DEFAULT || !Height)
+		Height = 256;
+	Width	= min(_gldHLPow2(Width), 4096);
+	Height	= min(_gldHLPow2(Height), 4096);
+	if (MipLevels == D3DX_DEFAULT)
+		MipLevels = 0;
+	if (gldHLFormatIsDXT(Format)) {
+		Width	= max(Width, 4);
+		Height	= max(Height, 4);
+	}
+	return IDirect3DDevice9_CreateTexture(pDevice, Width, Height, MipLevels, Usage, Format, Pool, ppTexture, NULL);
+}
+
+// ***********************************************************************
+
+static UINT _gldHLLevelBytes(
+	const GLD_hlSurface *pSurf)
+{
+	// Bytes of a level with its rows packed
+	UINT	nBits = gldHLFormatBits(pSurf->Desc.Format);
+
+	if (gldHLFormatIsDXT(pSurf->Desc.Format))
+		return ((pSurf->Desc.Width + 3) / 4) * nBits * 2 * pSurf->Rows;
+	return pSurf->Desc.Width * nBits / 8 * pSurf->Rows;
+}
+
+// ***********************************************************************
+
+static BOOL _gldHLWriteLevel(
+	FILE *fp,
+	const GLD_hlSurface *pSurf,
+	BOOL bRead)
+{
+	UINT	nRowBytes = _gldHLLevelBytes(pSurf) / pSurf->Rows;
+	UINT	y;
+
+	for (y=0; y<pSurf->Rows; y++) {
+		if (bRead) {
+			if (fread(pSurf->pBits + y * pSurf->Pitch, nRowBytes, 1, fp) != 1)
+				return FALSE;
+		} else {
+			if (fwrite(pSurf->pBits + y * pSurf->Pitch, nRowBytes, 1, fp) != 1)
+				return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+// ***********************************************************************
+
+static HRESULT _gldHLSaveLevels(
+	LPCSTR pDestFile,
+	IDirect3DBaseTexture9 *pTexture,
+	GLD_hlSurface *pSurface)
+{
+	GLD_hlFileHeader	Header;
+	GLD_hlSurface		*pTop;
+	UINT				nLevels = 1, nFaces = 1, f, i;
+	FILE				*fp;
+
+	if (pTexture) {
+		nLevels = gldHLTextureLevels(pTexture, &nFaces);
+		if (!nLevels) {
+			gldHLError("D3DXSaveTextureToFile: volume textures are not supported");
+			return D3DERR_INVALIDCALL;
+		}
+		pTop = gldHLTextureSurface(pTexture, 0, 0);
+	} else {
+		pTop = pSurface;
+	}
+
+	ZeroMemory(&Header, sizeof(Header));
+	Header.dwMagic				= GLD_HL_FILE_MAGIC;
+	Header.dwSize				= sizeof(Header) - sizeof(DWORD);
+	Header.dwFlags				= 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000;	// CAPS, HEIGHT, WIDTH, PIXELFORMAT, MIPMAPCOUNT
+	Header.dwHeight				= pTop->Desc.Height;
+	Header.dwWidth				= pTop->Desc.Width;
+	Header.dwPitchOrLinearSize	= _gldHLLevelBytes(pTop);
+	Header.dwMipMapCount		= nLevels;
+	Header.dwPFSize				= 32;
+	Header.dwPFFlags			= GLD_HL_DDPF_FOURCC;
+	Header.dwFourCC				= pTop->Desc.Format;
+	Header.dwCaps				= 0x1000;		// DDSCAPS_TEXTURE
+	Header.dwCaps2				= (nFaces == 6) ? GLD_HL_DDSCAPS2_CUBEMAP : 0;
+
+	fp = gldHeadlessFopen(pDestFile, "wb");
+	if (!fp)
+		return D3DERR_INVALIDCALL;
+	if (fwrite(&Header, sizeof(Header), 1, fp) != 1) {
+		fclose(fp);
+		return D3DERR_INVALIDCALL;
+	}
+	for (f=0; f<nFaces; f++) {
+		for (i=0; i<nLevels; i++) {
+			if (!_gldHLWriteLevel(fp, pTexture ? gldHLTextureSurface(pTexture, f, i) : pSurface, FALSE)) {
+				fclose(fp);
+				return D3DERR_INVALIDCALL;
+			}
+		}
+	}
+	fclose(fp);
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+HRESULT WINAPI D3DXSaveTextureToFile(
+	LPCSTR pDestFile,
+	D3DXIMAGE_FILEFORMAT DestFormat,
+	LPDIRECT3DBASETEXTURE9 pSrcTexture,
+	const PALETTEENTRY *pSrcPalette)
+{
+	// Every file format is written the same way
+	return _gldHLSaveLevels(pDestFile, pSrcTexture, NULL);
+}
+
+// ***********************************************************************
+
+HRESULT WINAPI D3DXSaveSurfaceToFile(
+	LPCSTR pDestFile,
+	D3DXIMAGE_FILEFORMAT DestFormat,
+	LPDIRECT3DSURFACE9 pSrcSurface,
+	const PALETTEENTRY *pSrcPalette,
+	const RECT *pSrcRect)
+{
+	return _gldHLSaveLevels(pDestFile, NULL, (GLD_hlSurface*)pSrcSurface);
+}
+
+// ***********************************************************************
+
+HRESULT WINAPI D3DXCreateTextureFromFileEx(
+	LPDIRECT3DDEVICE9 pDevice,
+	LPCSTR pSrcFile,
+	UINT Width,
+	UINT Height,
+	UINT MipLevels,
+	DWORD Usage,
+	D3DFORMAT Format,
+	D3DPOOL Pool,
+	DWORD Filter,
+	DWORD MipFilter,
+	D3DCOLOR ColorKey,
+	D3DXIMAGE_INFO *pSrcInfo,
+	PALETTEENTRY *pPalette,
+	LPDIRECT3DTEXTURE9 *ppTexture)
+{
+	// Reads back what D3DXSaveTextureToFile() wrote, at its own size
+	// and format; anything else is resized by the caller's request
+	GLD_hlFileHeader	Header;
+	IDirect3DTexture9	*pTex = NULL;
+	UINT				nLevels, i;
+	FILE				*fp;
+	HRESULT				hr;
+
+	*ppTexture = NULL;
+	fp = gldHeadlessFopen(pSrcFile, "rb");
+	if (!fp)
+		return D3DERR_NOTFOUND;
+	if (fread(&Header, sizeof(Header), 1, fp) != 1 || Header.dwMagic != GLD_HL_FILE_MAGIC ||
+		!(Header.dwPFFlags & GLD_HL_DDPF_FOURCC) || (Header.dwCaps2 & GLD_HL_DDSCAPS2_CUBEMAP))
+	{
+		fclose(fp);
+		return D3DXERR_INVALIDDATA;
+	}
+	if ((Width != D3DX_FROM_FILE && Width != Header.dwWidth) ||
+		(Height != D3DX_FROM_FILE && Height != Header.dwHeight) ||
+		(Format != D3DFMT_FROM_FILE && Format != D3DFMT_UNKNOWN && Format != (D3DFORMAT)Header.dwFourCC))
+	{
+		fclose(fp);
+		gldHLError("D3DXCreateTextureFromFileEx: resizing and conversion are not supported");
+		return D3DERR_NOTAVAILABLE;
+	}
+
+	nLevels = (MipLevels == D3DX_FROM_FILE) ? Header.dwMipMapCount : MipLevels;
+	hr = IDirect3DDevice9_CreateTexture(pDevice, Header.dwWidth, Header.dwHeight, nLevels,
+		Usage, (D3DFORMAT)Header.dwFourCC, Pool, &pTex, NULL);
+	if (FAILED(hr)) {
+		fclose(fp);
+		return hr;
+	}
+	nLevels = min(IDirect3DTexture9_GetLevelCount(pTex), Header.dwMipMapCount);
+	for (i=0; i<nLevels; i++) {
+		if (!_gldHLWriteLevel(fp, gldHLTextureSurface((IDirect3DBaseTexture9*)pTex, 0, i), TRUE)) {
+			fclose(fp);
+			IDirect3DTexture9_Release(pTex);
+			return D3DXERR_INVALIDDATA;
+		}
+	}
+	fclose(fp);
+
+	if (pSrcInfo) {
+		pSrcInfo->Width				= Header.dwWidth;
+		pSrcInfo->Height			= Header.dwHeight;
+		pSrcInfo->Depth				= 1;
+		pSrcInfo->MipLevels			= Header.dwMipMapCount;
+		pSrcInfo->Format			= (D3DFORMAT)Header.dwFourCC;
+		pSrcInfo->ResourceType		= D3DRTYPE_TEXTURE;
+		pSrcInfo->ImageFileFormat	= D3DXIFF_DDS;
+	}
+	*ppTexture = pTex;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// ID3DXBuffer
+// ***********************************************************************
+
+static HRESULT _gldHLCreateXBuffer(
+	const void *pData,
+	DWORD dwSize,
+	ID3DXBuffer **ppBuffer)
+{
+	GLD_hlXBuffer	*pBuf;
+
+	*ppBuffer = NULL;
+	pBuf = calloc(1, sizeof(GLD_hlXBuffer) + dwSize);
+	if (!pBuf)
+		return E_OUTOFMEMORY;
+	pBuf->lpVtbl	= &hlXBufferVtbl;
+	pBuf->lRefs		= 1;
+	pBuf->dwSize	= dwSize;
+	pBuf->pData		= (BYTE*)(pBuf + 1);
+	memcpy(pBuf->pData, pData, dwSize);
+	*ppBuffer = (ID3DXBuffer*)pBuf;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXQueryInterface(
+	void *This,
+	REFIID riid,
+	void **ppvObj)
+{
+	// Shared by every D3DX object; they all start with lpVtbl and lRefs
+	if (!IsEqualIID(riid, &IID_IUnknown)) {
+		*ppvObj = NULL;
+		return E_NOINTERFACE;
+	}
+	((GLD_hlXBuffer*)This)->lRefs++;
+	*ppvObj = This;
+	return S_OK;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLXAddRef(
+	void *This)
+{
+	return ++((GLD_hlXBuffer*)This)->lRefs;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLXBufferRelease(
+	GLD_hlXBuffer *This)
+{
+	LONG	lRefs = --This->lRefs;
+
+	if (lRefs == 0)
+		free(This);
+	return lRefs;
+}
+
+static LPVOID STDMETHODCALLTYPE _gldHLXBufferGetBufferPointer(
+	GLD_hlXBuffer *This)
+{
+	return This->pData;
+}
+
+static DWORD STDMETHODCALLTYPE _gldHLXBufferGetBufferSize(
+	GLD_hlXBuffer *This)
+{
+	return This->dwSize;
+}
+
+// ***********************************************************************
+// Effect pool and compiler
+// ***********************************************************************
+
+HRESULT WINAPI D3DXCreateEffectPool(
+	LPD3DXEFFECTPOOL *ppPool)
+{
+	GLD_hlEffectPool	*pPool;
+
+	if (!bHLXVtblsReady)
+		_gldHLInitXVtbls();
+	*ppPool = NULL;
+	pPool = calloc(1, sizeof(GLD_hlEffectPool));
+	if (!pPool)
+		return E_OUTOFMEMORY;
+	pPool->lpVtbl	= &hlEffectPoolVtbl;
+	pPool->lRefs	= 1;
+	*ppPool = (ID3DXEffectPool*)pPool;
+	return D3D_OK;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLXPoolRelease(
+	GLD_hlEffectPool *This)
+{
+	LONG	lRefs = --This->lRefs;
+
+	if (lRefs == 0)
+		free(This);
+	return lRefs;
+}
+
+// ***********************************************************************
+
+static HRESULT _gldHLCheckEffectText(
+	const char *pszText,
+	LPD3DXBUFFER *ppErrors)
+{
+	// An effect without a technique can't be used
+	static const char	szError[] = "error X3501: no technique found";
+
+	if (ppErrors)
+		*ppErrors = NULL;
+	if (strstr(pszText, "technique"))
+		return D3D_OK;
+	if (ppErrors)
+		_gldHLCreateXBuffer(szError, sizeof(szError), ppErrors);
+	return D3DXERR_INVALIDDATA;
+}
+
+HRESULT WINAPI D3DXCreateEffectCompiler(
+	LPCSTR pSrcData,
+	UINT SrcDataLen,
+	const D3DXMACRO *pDefines,
+	LPD3DXINCLUDE pInclude,
+	DWORD Flags,
+	LPD3DXEFFECTCOMPILER *ppCompiler,
+	LPD3DXBUFFER *ppParseErrors)
+{
+	GLD_hlEffectCompiler	*pComp;
+	HRESULT					hr;
+
+	if (!bHLXVtblsReady)
+		_gldHLInitXVtbls();
+	*ppCompiler = NULL;
+	if (!pSrcData)
+		return D3DERR_INVALIDCALL;
+	pComp = calloc(1, sizeof(GLD_hlEffectCompiler) + SrcDataLen + 1);
+	if (!pComp)
+		return E_OUTOFMEMORY;
+	pComp->lpVtbl	= &hlEffectCompilerVtbl;
+	pComp->lRefs	= 1;
+	pComp->pszText	= (char*)(pComp + 1);
+	pComp->nLength	= SrcDataLen;
+	memcpy(pComp->pszText, pSrcData, SrcDataLen);
+
+	hr = _gldHLCheckEffectText(pComp->pszText, ppParseErrors);
+	if (FAILED(hr)) {
+		free(pComp);
+		return hr;
+	}
+	*ppCompiler = (ID3DXEffectCompiler*)pComp;
+	return D3D_OK;
+}
+
+static ULONG STDMETHODCALLTYPE _gldHLXCompilerRelease(
+	GLD_hlEffectCompiler *This)
+{
+	LONG	lRefs = --This->lRefs;
+
+	if (lRefs == 0)
+		free(This);
+	return lRefs;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXCompilerCompileEffect(
+	GLD_hlEffectCompiler *This,
+	DWORD Flags,
+	LPD3DXBUFFER *ppEffect,
+	LPD3DXBUFFER *ppErrorMsgs)
+{
+	// The "binary" is the text, which D3DXCreateEffect() takes as well
+	if (ppErrorMsgs)
+		*ppErrorMsgs = NULL;
+	return _gldHLCreateXBuffer(This->pszText, This->nLength + 1, ppEffect);
+}
+
+// ***********************************************************************
+// ID3DXEffect
+// ***********************************************************************
+
+HRESULT WINAPI D3DXCreateEffect(
+	LPDIRECT3DDEVICE9 pDevice,
+	LPCVOID pSrcData,
+	UINT SrcDataLen,
+	const D3DXMACRO *pDefines,
+	LPD3DXINCLUDE pInclude,
+	DWORD Flags,
+	LPD3DXEFFECTPOOL pPool,
+	LPD3DXEFFECT *ppEffect,
+	LPD3DXBUFFER *ppCompilationErrors)
+{
+	GLD_hlEffect	*pEffect;
+	HRESULT			hr;
+
+	if (!bHLXVtblsReady)
+		_gldHLInitXVtbls();
+	*ppEffect = NULL;
+	if (!pDevice || !pSrcData) {
+		gldHLError("D3DXCreateEffect: no device or data");
+		return D3DERR_INVALIDCALL;
+	}
+	pEffect = calloc(1, sizeof(GLD_hlEffect) + SrcDataLen + 1);
+	if (!pEffect)
+		return E_OUTOFMEMORY;
+	pEffect->pszText = (char*)(pEffect + 1);
+	memcpy(pEffect->pszText, pSrcData, SrcDataLen);
+	hr = _gldHLCheckEffectText(pEffect->pszText, ppCompilationErrors);
+	if (FAILED(hr)) {
+		free(pEffect);
+		return hr;
+	}
+
+	pEffect->lpVtbl		= &hlEffectVtbl;
+	pEffect->lRefs		= 1;
+	pEffect->pDevice	= pDevice;
+	pEffect->pPool		= pPool;
+	IDirect3DDevice9_AddRef(pDevice);
+	if (pPool)
+		ID3DXEffectPool_AddRef(pPool);
+	*ppEffect = (ID3DXEffect*)pEffect;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+
+static D3DXHANDLE _gldHLEffectFind(
+	GLD_hlEffect *This,
+	const char *pszName)
+{
+	// A name is found if the effect text has it as a whole word
+	const char	*p = This->pszText;
+	size_t		nLen = strlen(pszName);
+	char		**ppNames;
+	UINT		i;
+
+	for (i=0; i<This->nNames; i++) {
+		if (!strcmp(This->ppNames[i], pszName))
+			return This->ppNames[i];
+	}
+	for (;;) {
+		p = strstr(p, pszName);
+		if (!p)
+			return NULL;
+		if ((p == This->pszText || !(isalnum((BYTE)p[-1]) || p[-1] == '_')) &&
+			!(isalnum((BYTE)p[nLen]) || p[nLen] == '_'))
+		{
+			break;
+		}
+		p += nLen;
+	}
+
+	ppNames = realloc(This->ppNames, (This->nNames + 1) * sizeof(char*));
+	if (!ppNames)
+		return NULL;
+	This->ppNames = ppNames;
+	This->ppNames[This->nNames] = strdup(pszName);
+	return This->ppNames[This->nNames++];
+}
+
+static BOOL _gldHLEffectHandle(
+	GLD_hlEffect *This,
+	const char *pszMethod,
+	D3DXHANDLE hParameter)
+{
+	UINT	i;
+
+	for (i=0; i<This->nNames; i++) {
+		if (This->ppNames[i] == hParameter)
+			return TRUE;
+	}
+	gldHLError("ID3DXEffect::%s: handle %p is not a parameter", pszMethod, hParameter);
+	return FALSE;
+}
+
+// ***********************************************************************
+
+static ULONG STDMETHODCALLTYPE _gldHLXEffectRelease(
+	GLD_hlEffect *This)
+{
+	LONG	lRefs = --This->lRefs;
+	UINT	i;
+
+	if (lRefs == 0) {
+		if (This->bInBegin)
+			gldHLWarning("ID3DXEffect::Release: inside Begin/End");
+		if (This->pManager)
+			ID3DXEffectStateManager_Release(This->pManager);
+		if (This->pPool)
+			ID3DXEffectPool_Release(This->pPool);
+		IDirect3DDevice9_Release(This->pDevice);
+		for (i=0; i<This->nNames; i++)
+			free(This->ppNames[i]);
+		free(This->ppNames);
+		free(This);
+	}
+	return lRefs;
+}
+
+static D3DXHANDLE STDMETHODCALLTYPE _gldHLXEffectGetParameterByName(
+	GLD_hlEffect *This,
+	D3DXHANDLE hParameter,
+	LPCSTR pName)
+{
+	// Struct members are not looked up
+	if (hParameter)
+		return NULL;
+	return _gldHLEffectFind(This, pName);
+}
+
+static D3DXHANDLE STDMETHODCALLTYPE _gldHLXEffectGetParameterElement(
+	GLD_hlEffect *This,
+	D3DXHANDLE hParameter,
+	UINT Index)
+{
+	char	szName[256];
+
+	if (!hParameter || strlen(hParameter) > sizeof(szName) - 16)
+		return NULL;
+	sprintf(szName, "%s[%u]", hParameter, Index);
+	return _gldHLEffectFind(This, szName);
+}
+
+static D3DXHANDLE STDMETHODCALLTYPE _gldHLXEffectGetTechniqueByName(
+	GLD_hlEffect *This,
+	LPCSTR pName)
+{
+	return _gldHLEffectFind(This, pName);
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectSetValue(
+	GLD_hlEffect *This,
+	D3DXHANDLE hParameter,
+	LPCVOID pData,
+	UINT Bytes)
+{
+	if (!_gldHLEffectHandle(This, "SetValue", hParameter) || !pData)
+		return D3DERR_INVALIDCALL;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectSetFloat(
+	GLD_hlEffect *This,
+	D3DXHANDLE hParameter,
+	FLOAT f)
+{
+	return _gldHLEffectHandle(This, "SetFloat", hParameter) ? D3D_OK : D3DERR_INVALIDCALL;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectSetVector(
+	GLD_hlEffect *This,
+	D3DXHANDLE hParameter,
+	const D3DXVECTOR4 *pVector)
+{
+	return _gldHLEffectHandle(This, "SetVector", hParameter) ? D3D_OK : D3DERR_INVALIDCALL;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectSetMatrix(
+	GLD_hlEffect *This,
+	D3DXHANDLE hParameter,
+	const D3DXMATRIX *pMatrix)
+{
+	return _gldHLEffectHandle(This, "SetMatrix", hParameter) ? D3D_OK : D3DERR_INVALIDCALL;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectSetTexture(
+	GLD_hlEffect *This,
+	D3DXHANDLE hParameter,
+	LPDIRECT3DBASETEXTURE9 pTexture)
+{
+	return _gldHLEffectHandle(This, "SetTexture", hParameter) ? D3D_OK : D3DERR_INVALIDCALL;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectSetTechnique(
+	GLD_hlEffect *This,
+	D3DXHANDLE hTechnique)
+{
+	if (!_gldHLEffectHandle(This, "SetTechnique", hTechnique))
+		return D3DERR_INVALIDCALL;
+	This->hTechnique = hTechnique;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectBegin(
+	GLD_hlEffect *This,
+	UINT *pPasses,
+	DWORD Flags)
+{
+	if (This->bInBegin) {
+		gldHLError("ID3DXEffect::Begin: already inside Begin/End");
+		return D3DERR_INVALIDCALL;
+	}
+	if (!This->hTechnique) {
+		gldHLError("ID3DXEffect::Begin: no technique set");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bInBegin = TRUE;
+	if (pPasses)
+		*pPasses = 1;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectBeginPass(
+	GLD_hlEffect *This,
+	UINT Pass)
+{
+	if (!This->bInBegin || This->bInPass || Pass) {
+		gldHLError("ID3DXEffect::BeginPass: pass %u", Pass);
+		return D3DERR_INVALIDCALL;
+	}
+	This->bInPass = TRUE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectCommitChanges(
+	GLD_hlEffect *This)
+{
+	if (!This->bInPass) {
+		gldHLError("ID3DXEffect::CommitChanges: outside BeginPass/EndPass");
+		return D3DERR_INVALIDCALL;
+	}
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectEndPass(
+	GLD_hlEffect *This)
+{
+	if (!This->bInPass) {
+		gldHLError("ID3DXEffect::EndPass: without BeginPass");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bInPass = FALSE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectEnd(
+	GLD_hlEffect *This)
+{
+	if (!This->bInBegin || This->bInPass) {
+		gldHLError("ID3DXEffect::End: %s", This->bInPass ? "inside BeginPass/EndPass" : "without Begin");
+		return D3DERR_INVALIDCALL;
+	}
+	This->bInBegin = FALSE;
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectOnLostDevice(
+	GLD_hlEffect *This)
+{
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectOnResetDevice(
+	GLD_hlEffect *This)
+{
+	return D3D_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE _gldHLXEffectSetStateManager(
+	GLD_hlEffect *This,
+	LPD3DXEFFECTSTATEMANAGER pManager)
+{
+	if (pManager)
+		ID3DXEffectStateManager_AddRef(pManager);
+	if (This->pManager)
+		ID3DXEffectStateManager_Release(This->pManager);
+	This->pManager = pManager;
+	return D3D_OK;
+}
+
+// ***********************************************************************
+// Vtables
+// ***********************************************************************
+
+#define _GLD_HL_X(v, m, f)		(v)->m = (void*)f
+
+static void _gldHLInitXVtbls(void)
+{
+	_GLD_HL_X(&hlXBufferVtbl, QueryInterface,	_gldHLXQueryInterface);
+	_GLD_HL_X(&hlXBufferVtbl, AddRef,			_gldHLXAddRef);
+	_GLD_HL_X(&hlXBufferVtbl, Release,			_gldHLXBufferRelease);
+	_GLD_HL_X(&hlXBufferVtbl, GetBufferPointer,	_gldHLXBufferGetBufferPointer);
+	_GLD_HL_X(&hlXBufferVtbl, GetBufferSize,	_gldHLXBufferGetBufferSize);
+
+	_GLD_HL_X(&hlEffectPoolVtbl, QueryInterface,	_gldHLXQueryInterface);
+	_GLD_HL_X(&hlEffectPoolVtbl, AddRef,			_gldHLXAddRef);
+	_GLD_HL_X(&hlEffectPoolVtbl, Release,			_gldHLXPoolRelease);
+
+	_GLD_HL_X(&hlEffectCompilerVtbl, QueryInterface,	_gldHLXQueryInterface);
+	_GLD_HL_X(&hlEffectCompilerVtbl, AddRef,			_gldHLXAddRef);
+	_GLD_HL_X(&hlEffectCompilerVtbl, Release,			_gldHLXCompilerRelease);
+	_GLD_HL_X(&hlEffectCompilerVtbl, CompileEffect,		_gldHLXCompilerCompileEffect);
+
+	_GLD_HL_X(&hlEffectVtbl, QueryInterface,		_gldHLXQueryInterface);
+	_GLD_HL_X(&hlEffectVtbl, AddRef,				_gldHLXAddRef);
+	_GLD_HL_X(&hlEffectVtbl, Release,				_gldHLXEffectRelease);
+	_GLD_HL_X(&hlEffectVtbl, GetParameterByName,	_gldHLXEffectGetParameterByName);
+	_GLD_HL_X(&hlEffectVtbl, GetParameterElement,	_gldHLXEffectGetParameterElement);
+	_GLD_HL_X(&hlEffectVtbl, GetTechniqueByName,	_gldHLXEffectGetTechniqueByName);
+	_GLD_HL_X(&hlEffectVtbl, SetValue,				_gldHLXEffectSetValue);
+	_GLD_HL_X(&hlEffectVtbl, SetFloat,				_gldHLXEffectSetFloat);
+	_GLD_HL_X(&hlEffectVtbl, SetVector,				_gldHLXEffectSetVector);
+	_GLD_HL_X(&hlEffectVtbl, SetMatrix,				_gldHLXEffectSetMatrix);
+	_GLD_HL_X(&hlEffectVtbl, SetTexture,			_gldHLXEffectSetTexture);
+	_GLD_HL_X(&hlEffectVtbl, SetTechnique,			_gldHLXEffectSetTechnique);
+	_GLD_HL_X(&hlEffectVtbl, Begin,					_gldHLXEffectBegin);
+	_GLD_HL_X(&hlEffectVtbl, BeginPass,				_gldHLXEffectBeginPass);
+	_GLD_HL_X(&hlEffectVtbl, CommitChanges,			_gldHLXEffectCommitChanges);
+	_GLD_HL_X(&hlEffectVtbl, EndPass,				_gldHLXEffectEndPass);
+	_GLD_HL_X(&hlEffectVtbl, End,					_gldHLXEffectEnd);
+	_GLD_HL_X(&hlEffectVtbl, OnLostDevice,			_gldHLXEffectOnLostDevice);
+	_GLD_HL_X(&hlEffectVtbl, OnResetDevice,			_gldHLXEffectOnResetDevice);
+	_GLD_HL_X(&hlEffectVtbl, SetStateManager,		_gldHLXEffectSetStateManager);
+
+	bHLXVtblsReady = TRUE;
+}
@@ -0,0 +1,108 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Test access to the stand-in Direct3D 9 device: the calls, bytes and
+*               lock patterns it recorded, and the most recent draw.
+*
+*********************************************************************************/
+
+#ifndef __GLD_HEADLESS_H
+#define __GLD_HEADLESS_H
+
+#include <windows.h>
+#include <d3d9.h>
+
+/*---------------------- Macros and type definitions ----------------------*/
+
+#define GLD_HL_DEVICE_SLOTS		(sizeof(IDirect3DDevice9Vtbl) / sizeof(void*))
+
+// Slot of a device method in the vtable, to index GLD_hlStats.dwCalls
+#define GLD_HL_SLOT(m)			(offsetof(IDirect3DDevice9Vtbl, m) / sizeof(void*))
+
+// What the stand-in device saw, totalled over every device in the process
+typedef struct {
+	DWORD		dwCalls[GLD_HL_DEVICE_SLOTS];	// Device calls by vtable slot
+	DWORD		dwPresents;
+	DWORD		dwDraws;						// Draw*Primitive*
+	DWORD		dwPrims;
+	DWORD		dwVertices;						// Vertices the draws referenced
+	DWORD		dwVBLocks;
+	DWORD		dwIBLocks;
+	DWORD		dwSurfaceLocks;					// Texture levels and surfaces
+	DWORD		dwVolumeLocks;
+	DWORD		dwDiscards;						// Locks with D3DLOCK_DISCARD
+	DWORD		dwNoOverwrites;					// Locks with D3DLOCK_NOOVERWRITE
+	DWORD		dwReadOnly;						// Locks with D3DLOCK_READONLY
+	ULONGLONG	qwVBLockBytes;					// Bytes spanned by the locked ranges
+	ULONGLONG	qwIBLockBytes;
+	ULONGLONG	qwSurfaceLockBytes;
+	ULONGLONG	qwUPBytes;						// Vertex and index bytes passed by pointer
+	DWORD		dwCreates;						// Resources created
+	DWORD		dwLiveResources;				// Created and not yet released
+	DWORD		dwErrors;						// Calls the debug runtime would reject
+} GLD_hlStats;
+
+// The most recent draw
+typedef struct {
+	D3DPRIMITIVETYPE		Type;
+	BOOL					bIndexed;
+	BOOL					bUP;
+	INT						BaseVertexIndex;
+	UINT					MinIndex;
+	UINT					NumVertices;
+	UINT					Start;				// StartVertex, or StartIndex if indexed
+	UINT					PrimitiveCount;
+	IDirect3DVertexBuffer9	*pVB;				// Stream 0
+	UINT					Offset;
+	UINT					Stride;
+	IDirect3DIndexBuffer9	*pIB;
+	DWORD					FVF;
+} GLD_hlDraw;
+
+/*------------------------- Function Prototypes ---------------------------*/
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+void		gldHeadlessGetStats(GLD_hlStats *pStats);
+void		gldHeadlessResetStats(void);
+void		gldHeadlessPrintStats(FILE *fp);
+const char*	gldHeadlessMethodName(DWORD dwSlot);
+BOOL		gldHeadlessGetLastDraw(GLD_hlDraw *pDraw);
+
+// Contents of a buffer, read without a lock so the counts don't change
+const BYTE*	gldHeadlessVertexData(IDirect3DVertexBuffer9 *pVB, UINT *pSize);
+const BYTE*	gldHeadlessIndexData(IDirect3DIndexBuffer9 *pIB, UINT *pSize);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,250 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Internal state of the stand-in Direct3D 9 runtime, shared between the
+*               device and the resources it creates.
+*
+*********************************************************************************/
+
+#ifndef __GLD_HL_D3D9_H
+#define __GLD_HL_D3D9_H
+
+#include "gld_headless.h"
+
+/*---------------------- Macros and type definitions ----------------------*/
+
+#define GLD_HL_MAX_STREAMS			16
+#define GLD_HL_MAX_SAMPLERS			21		// 16 pixel, displacement map, 4 vertex
+#define GLD_HL_MAX_STAGES			8
+#define GLD_HL_MAX_LIGHTS			8
+#define GLD_HL_MAX_CLIPPLANES		6
+#define GLD_HL_MAX_RENDERTARGETS	4
+#define GLD_HL_MAX_TRANSFORMS		512
+#define GLD_HL_VS_CONSTANTS_F		256
+#define GLD_HL_PS_CONSTANTS_F		224
+#define GLD_HL_CONSTANTS_IB			16
+#define GLD_HL_DISCARD_FILL			0xCD	// Discarded buffer contents
+
+// Objects the runtime hands out
+typedef enum {
+	GLD_HL_SURFACE,
+	GLD_HL_TEXTURE,
+	GLD_HL_CUBETEXTURE,
+	GLD_HL_VOLUMETEXTURE,
+	GLD_HL_VERTEXBUFFER,
+	GLD_HL_INDEXBUFFER,
+	GLD_HL_DECLARATION,
+	GLD_HL_VERTEXSHADER,
+	GLD_HL_PIXELSHADER,
+	GLD_HL_QUERY,
+	GLD_HL_STATEBLOCK,
+	GLD_HL_SWAPCHAIN
+} GLD_hlKind;
+
+typedef struct _GLD_hlDevice	GLD_hlDevice;
+typedef struct _GLD_hlPrivate	GLD_hlPrivate;
+typedef struct _GLD_hlObject	GLD_hlObject;
+
+struct _GLD_hlPrivate {
+	GUID					Guid;
+	DWORD					dwSize;
+	GLD_hlPrivate			*pNext;
+	// Data follows
+};
+
+// Common head of every object. The vtable pointer must come first.
+struct _GLD_hlObject {
+	void					*lpVtbl;
+	LONG					lRefs;
+	GLD_hlKind				Kind;
+	GLD_hlDevice			*pDevice;
+	GLD_hlObject			*pContainer;	// Texture of a level; it holds the references
+	DWORD					dwPriority;
+	GLD_hlPrivate			*pPrivate;
+};
+
+typedef struct {
+	GLD_hlObject			Obj;
+	D3DSURFACE_DESC			Desc;
+	UINT					Pitch;
+	UINT					Rows;			// Rows of pixels, or of blocks for DXTn
+	BYTE					*pBits;
+	BOOL					bLocked;
+} GLD_hlSurface;
+
+typedef struct {
+	GLD_hlObject			Obj;
+	UINT					nLevels;
+	UINT					nFaces;			// 6 for a cube map
+	DWORD					dwLOD;
+	DWORD					Usage;
+	D3DTEXTUREFILTERTYPE	AutoGenFilter;
+	GLD_hlSurface			**ppSurfaces;	// [face * nLevels + level]
+} GLD_hlTexture;
+
+typedef struct {
+	D3DVOLUME_DESC			Desc;
+	UINT					RowPitch;
+	UINT					SlicePitch;
+	BYTE					*pBits;
+	BOOL					bLocked;
+} GLD_hlVolume;
+
+typedef struct {
+	GLD_hlObject			Obj;
+	UINT					nLevels;
+	DWORD					dwLOD;
+	D3DTEXTUREFILTERTYPE	AutoGenFilter;
+	GLD_hlVolume			*pVolumes;
+} GLD_hlVolumeTexture;
+
+// Vertex and index buffers
+typedef struct {
+	GLD_hlObject			Obj;
+	D3DFORMAT				Format;			// D3DFMT_VERTEXDATA, or the index format
+	DWORD					Usage;
+	D3DPOOL					Pool;
+	UINT					Size;
+	DWORD					FVF;
+	BYTE					*pData;
+	BOOL					bLocked;
+} GLD_hlBuffer;
+
+typedef struct {
+	GLD_hlObject			Obj;
+	D3DVERTEXELEMENT9		*pElements;		// Including D3DDECL_END()
+	UINT					nElements;
+} GLD_hlDeclaration;
+
+typedef struct {
+	GLD_hlObject			Obj;
+	DWORD					*pFunction;
+	UINT					dwSize;
+} GLD_hlShader;
+
+typedef struct {
+	GLD_hlObject			Obj;
+	D3DQUERYTYPE			Type;
+	BOOL					bIssued;
+} GLD_hlQuery;
+
+typedef struct {
+	GLD_hlObject			Obj;
+	D3DSTATEBLOCKTYPE		Type;
+} GLD_hlStateBlock;
+
+typedef struct {
+	GLD_hlObject			Obj;
+} GLD_hlSwapChain;
+
+typedef struct {
+	IDirect3DVertexBuffer9	*pVB;
+	UINT					Offset;
+	UINT					Stride;
+	UINT					Freq;
+} GLD_hlStream;
+
+struct _GLD_hlDevice {
+	IDirect3DDevice9Vtbl	*lpVtbl;
+	LONG					lRefs;
+	IDirect3D9				*pD3D;
+	D3DDEVICE_CREATION_PARAMETERS	Params;
+	D3DPRESENT_PARAMETERS	pp;
+	GLD_hlSwapChain			SwapChain;
+	GLD_hlSurface			*pBackBuffer;
+	GLD_hlSurface			*pAutoDepth;
+	BOOL					bInScene;
+	BOOL					bRecording;		// Between BeginStateBlock and EndStateBlock
+
+	// State; bound objects hold a reference
+	IDirect3DSurface9		*pRenderTargets[GLD_HL_MAX_RENDERTARGETS];
+	IDirect3DSurface9		*pDepthStencil;
+	DWORD					RenderStates[256];
+	DWORD					StageStates[GLD_HL_MAX_STAGES][33];
+	DWORD					SamplerStates[GLD_HL_MAX_SAMPLERS][14];
+	IDirect3DBaseTexture9	*pTextures[GLD_HL_MAX_SAMPLERS];
+	D3DMATRIX				Transforms[GLD_HL_MAX_TRANSFORMS];
+	D3DVIEWPORT9			Viewport;
+	D3DMATERIAL9			Material;
+	D3DLIGHT9				Lights[GLD_HL_MAX_LIGHTS];
+	BOOL					bLightEnable[GLD_HL_MAX_LIGHTS];
+	float					ClipPlanes[GLD_HL_MAX_CLIPPLANES][4];
+	D3DCLIPSTATUS9			ClipStatus;
+	RECT					rcScissor;
+	BOOL					bSoftwareVP;
+	float					fNPatchSegments;
+	UINT					uPalette;
+	D3DGAMMARAMP			Gamma;
+	GLD_hlStream			Streams[GLD_HL_MAX_STREAMS];
+	IDirect3DIndexBuffer9	*pIndices;
+	IDirect3DVertexDeclaration9	*pDecl;
+	DWORD					dwFVF;
+	IDirect3DVertexShader9	*pVS;
+	IDirect3DPixelShader9	*pPS;
+	float					VSConstF[GLD_HL_VS_CONSTANTS_F][4];
+	int						VSConstI[GLD_HL_CONSTANTS_IB][4];
+	BOOL					VSConstB[GLD_HL_CONSTANTS_IB];
+	float					PSConstF[GLD_HL_PS_CONSTANTS_F][4];
+	int						PSConstI[GLD_HL_CONSTANTS_IB][4];
+	BOOL					PSConstB[GLD_HL_CONSTANTS_IB];
+};
+
+/*--------------------------- Shared variables ----------------------------*/
+
+extern GLD_hlStats			gldHLStats;
+extern GLD_hlDraw			gldHLLastDraw;
+
+/*------------------------- Function Prototypes ---------------------------*/
+
+void			gldHLError(const char *pszFormat, ...);
+void			gldHLWarning(const char *pszFormat, ...);
+ULONG			gldHLAddRef(void *pObject);
+ULONG			gldHLRelease(void *pObject);
+void			gldHLBind(void *ppSlot, void *pObject);
+
+UINT			gldHLFormatBits(D3DFORMAT Format);
+BOOL			gldHLFormatIsDXT(D3DFORMAT Format);
+GLD_hlSurface*	gldHLCreateSurface(GLD_hlDevice *pDevice, UINT Width, UINT Height, D3DFORMAT Format, DWORD Usage, D3DPOOL Pool, GLD_hlObject *pContainer);
+BYTE*			gldHLSurfaceRow(GLD_hlSurface *pSurface, UINT x, UINT y);
+
+HRESULT			gldHLCreateTexture(GLD_hlDevice *pDevice, UINT Width, UINT Height, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, BOOL bCube, GLD_hlTexture **ppTexture);
+HRESULT			gldHLCreateVolumeTexture(GLD_hlDevice *pDevice, UINT Width, UINT Height, UINT Depth, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, GLD_hlVolumeTexture **ppTexture);
+HRESULT			gldHLCreateBuffer(GLD_hlDevice *pDevice, GLD_hlKind Kind, UINT Length, DWORD Usage, D3DFORMAT Format, DWORD FVF, D3DPOOL Pool, GLD_hlBuffer **ppBuffer);
+HRESULT			gldHLCreateDeclaration(GLD_hlDevice *pDevice, const D3DVERTEXELEMENT9 *pElements, GLD_hlDeclaration **ppDecl);
+HRESULT			gldHLCreateShader(GLD_hlDevice *pDevice, GLD_hlKind Kind, const DWORD *pFunction, GLD_hlShader **ppShader);
+HRESULT			gldHLCreateQuery(GLD_hlDevice *pDevice, D3DQUERYTYPE Type, GLD_hlQuery **ppQuery);
+HRESULT			gldHLCreateStateBlock(GLD_hlDevice *pDevice, D3DSTATEBLOCKTYPE Type, GLD_hlStateBlock **ppSB);
+void			gldHLInitSwapChain(GLD_hlDevice *pDevice);
+
+// Surfaces of a texture level, for the copies the device does
+GLD_hlSurface*	gldHLTextureSurface(IDirect3DBaseTexture9 *pTexture, UINT Face, UINT Level);
+UINT			gldHLTextureLevels(IDirect3DBaseTexture9 *pTexture, UINT *pFaces);
+int				gldHLSampler(DWORD Sampler);
+
+#endif
@@ -0,0 +1,1753 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Direct3D 9 declarations for the headless build. The interfaces keep
+*               the method order of the SDK headers; tests/headless/d3d9.c implements
+*               them with a software device that records what the driver does.
+*
+*********************************************************************************/
+
+#ifndef __GLD_HEADLESS_D3D9_H
+#define __GLD_HEADLESS_D3D9_H
+
+#include <windows.h>
+
+/*---------------------- Macros and type definitions ----------------------*/
+
+#define D3D_SDK_VERSION			32
+
+#define D3D_OK					S_OK
+#define _FACD3D					0x876
+#define MAKE_D3DHRESULT(code)	MAKE_HRESULT(1, _FACD3D, code)
+#define MAKE_D3DSTATUS(code)	MAKE_HRESULT(0, _FACD3D, code)
+#define D3DERR_WRONGTEXTUREFORMAT		MAKE_D3DHRESULT(2072)
+#define D3DERR_UNSUPPORTEDCOLOROPERATION	MAKE_D3DHRESULT(2073)
+#define D3DERR_TOOMANYOPERATIONS		MAKE_D3DHRESULT(2077)
+#define D3DERR_CONFLICTINGRENDERSTATE	MAKE_D3DHRESULT(2081)
+#define D3DERR_DRIVERINTERNALERROR		MAKE_D3DHRESULT(2087)
+#define D3DERR_NOTFOUND					MAKE_D3DHRESULT(2150)
+#define D3DERR_MOREDATA					MAKE_D3DHRESULT(2151)
+#define D3DERR_DEVICELOST				MAKE_D3DHRESULT(2152)
+#define D3DERR_DEVICENOTRESET			MAKE_D3DHRESULT(2153)
+#define D3DERR_NOTAVAILABLE				MAKE_D3DHRESULT(2154)
+#define D3DERR_OUTOFVIDEOMEMORY			MAKE_D3DHRESULT(380)
+#define D3DERR_INVALIDDEVICE			MAKE_D3DHRESULT(2155)
+#define D3DERR_INVALIDCALL				MAKE_D3DHRESULT(2156)
+#define D3DERR_WASSTILLDRAWING			MAKE_D3DHRESULT(540)
+#define D3DOK_NOAUTOGEN					MAKE_D3DSTATUS(2159)
+
+typedef DWORD					D3DCOLOR;
+
+#define D3DCOLOR_ARGB(a,r,g,b)	((D3DCOLOR)((((a)&0xff)<<24)|(((r)&0xff)<<16)|(((g)&0xff)<<8)|((b)&0xff)))
+#define D3DCOLOR_RGBA(r,g,b,a)	D3DCOLOR_ARGB(a,r,g,b)
+#define D3DCOLOR_XRGB(r,g,b)	D3DCOLOR_ARGB(0xff,r,g,b)
+#define D3DCOLOR_COLORVALUE(r,g,b,a) \
+	D3DCOLOR_RGBA((DWORD)((r)*255.f),(DWORD)((g)*255.f),(DWORD)((b)*255.f),(DWORD)((a)*255.f))
+
+#define MAKEFOURCC(ch0, ch1, ch2, ch3) \
+	((DWORD)(BYTE)(ch0) | ((DWORD)(BYTE)(ch1) << 8) | ((DWORD)(BYTE)(ch2) << 16) | ((DWORD)(BYTE)(ch3) << 24))
+
+typedef struct _D3DVECTOR {
+	float					x;
+	float					y;
+	float					z;
+} D3DVECTOR;
+
+typedef struct _D3DCOLORVALUE {
+	float					r;
+	float					g;
+	float					b;
+	float					a;
+} D3DCOLORVALUE;
+
+typedef struct _D3DRECT {
+	LONG					x1;
+	LONG					y1;
+	LONG					x2;
+	LONG					y2;
+} D3DRECT;
+
+typedef struct _D3DMATRIX {
+	union {
+		struct {
+			float			_11, _12, _13, _14;
+			float			_21, _22, _23, _24;
+			float			_31, _32, _33, _34;
+			float			_41, _42, _43, _44;
+		};
+		float				m[4][4];
+	};
+} D3DMATRIX;
+
+typedef struct _D3DVIEWPORT9 {
+	DWORD					X;
+	DWORD					Y;
+	DWORD					Width;
+	DWORD					Height;
+	float					MinZ;
+	float					MaxZ;
+} D3DVIEWPORT9;
+
+typedef struct _D3DCLIPSTATUS9 {
+	DWORD					ClipUnion;
+	DWORD					ClipIntersection;
+} D3DCLIPSTATUS9;
+
+typedef struct _D3DMATERIAL9 {
+	D3DCOLORVALUE			Diffuse;
+	D3DCOLORVALUE			Ambient;
+	D3DCOLORVALUE			Specular;
+	D3DCOLORVALUE			Emissive;
+	float					Power;
+} D3DMATERIAL9;
+
+typedef enum _D3DLIGHTTYPE {
+	D3DLIGHT_POINT			= 1,
+	D3DLIGHT_SPOT			= 2,
+	D3DLIGHT_DIRECTIONAL	= 3,
+	D3DLIGHT_FORCE_DWORD	= 0x7fffffff
+} D3DLIGHTTYPE;
+
+typedef struct _D3DLIGHT9 {
+	D3DLIGHTTYPE			Type;
+	D3DCOLORVALUE			Diffuse;
+	D3DCOLORVALUE			Specular;
+	D3DCOLORVALUE			Ambient;
+	D3DVECTOR				Position;
+	D3DVECTOR				Direction;
+	float					Range;
+	float					Falloff;
+	float					Attenuation0;
+	float					Attenuation1;
+	float					Attenuation2;
+	float					Theta;
+	float					Phi;
+} D3DLIGHT9;
+
+#define D3DCLEAR_TARGET			0x00000001l
+#define D3DCLEAR_ZBUFFER		0x00000002l
+#define D3DCLEAR_STENCIL		0x00000004l
+
+typedef enum _D3DSHADEMODE {
+	D3DSHADE_FLAT			= 1,
+	D3DSHADE_GOURAUD		= 2,
+	D3DSHADE_PHONG			= 3,
+	D3DSHADE_FORCE_DWORD	= 0x7fffffff
+} D3DSHADEMODE;
+
+typedef enum _D3DFILLMODE {
+	D3DFILL_POINT			= 1,
+	D3DFILL_WIREFRAME		= 2,
+	D3DFILL_SOLID			= 3,
+	D3DFILL_FORCE_DWORD		= 0x7fffffff
+} D3DFILLMODE;
+
+typedef enum _D3DBLEND {
+	D3DBLEND_ZERO				= 1,
+	D3DBLEND_ONE				= 2,
+	D3DBLEND_SRCCOLOR			= 3,
+	D3DBLEND_INVSRCCOLOR		= 4,
+	D3DBLEND_SRCALPHA			= 5,
+	D3DBLEND_INVSRCALPHA		= 6,
+	D3DBLEND_DESTALPHA			= 7,
+	D3DBLEND_INVDESTALPHA		= 8,
+	D3DBLEND_DESTCOLOR			= 9,
+	D3DBLEND_INVDESTCOLOR		= 10,
+	D3DBLEND_SRCALPHASAT		= 11,
+	D3DBLEND_BOTHSRCALPHA		= 12,
+	D3DBLEND_BOTHINVSRCALPHA	= 13,
+	D3DBLEND_BLENDFACTOR		= 14,
+	D3DBLEND_INVBLENDFACTOR		= 15,
+	D3DBLEND_FORCE_DWORD		= 0x7fffffff
+} D3DBLEND;
+
+typedef enum _D3DTEXTUREADDRESS {
+	D3DTADDRESS_WRAP		= 1,
+	D3DTADDRESS_MIRROR		= 2,
+	D3DTADDRESS_CLAMP		= 3,
+	D3DTADDRESS_BORDER		= 4,
+	D3DTADDRESS_MIRRORONCE	= 5,
+	D3DTADDRESS_FORCE_DWORD	= 0x7fffffff
+} D3DTEXTUREADDRESS;
+
+typedef enum _D3DCULL {
+	D3DCULL_NONE			= 1,
+	D3DCULL_CW				= 2,
+	D3DCULL_CCW				= 3,
+	D3DCULL_FORCE_DWORD		= 0x7fffffff
+} D3DCULL;
+
+typedef enum _D3DCMPFUNC {
+	D3DCMP_NEVER			= 1,
+	D3DCMP_LESS				= 2,
+	D3DCMP_EQUAL			= 3,
+	D3DCMP_LESSEQUAL		= 4,
+	D3DCMP_GREATER			= 5,
+	D3DCMP_NOTEQUAL			= 6,
+	D3DCMP_GREATEREQUAL		= 7,
+	D3DCMP_ALWAYS			= 8,
+	D3DCMP_FORCE_DWORD		= 0x7fffffff
+} D3DCMPFUNC;
+
+typedef enum _D3DSTENCILOP {
+	D3DSTENCILOP_KEEP		= 1,
+	D3DSTENCILOP_ZERO		= 2,
+	D3DSTENCILOP_REPLACE	= 3,
+	D3DSTENCILOP_INCRSAT	= 4,
+	D3DSTENCILOP_DECRSAT	= 5,
+	D3DSTENCILOP_INVERT		= 6,
+	D3DSTENCILOP_INCR		= 7,
+	D3DSTENCILOP_DECR		= 8,
+	D3DSTENCILOP_FORCE_DWORD = 0x7fffffff
+} D3DSTENCILOP;
+
+typedef enum _D3DZBUFFERTYPE {
+	D3DZB_FALSE				= 0,
+	D3DZB_TRUE				= 1,
+	D3DZB_USEW				= 2,
+	D3DZB_FORCE_DWORD		= 0x7fffffff
+} D3DZBUFFERTYPE;
+
+typedef enum _D3DPRIMITIVETYPE {
+	D3DPT_POINTLIST			= 1,
+	D3DPT_LINELIST			= 2,
+	D3DPT_LINESTRIP			= 3,
+	D3DPT_TRIANGLELIST		= 4,
+	D3DPT_TRIANGLESTRIP		= 5,
+	D3DPT_TRIANGLEFAN		= 6,
+	D3DPT_FORCE_DWORD		= 0x7fffffff
+} D3DPRIMITIVETYPE;
+
+typedef enum _D3DTRANSFORMSTATETYPE {
+	D3DTS_VIEW				= 2,
+	D3DTS_PROJECTION		= 3,
+	D3DTS_TEXTURE0			= 16,
+	D3DTS_TEXTURE1			= 17,
+	D3DTS_TEXTURE2			= 18,
+	D3DTS_TEXTURE3			= 19,
+	D3DTS_TEXTURE4			= 20,
+	D3DTS_TEXTURE5			= 21,
+	D3DTS_TEXTURE6			= 22,
+	D3DTS_TEXTURE7			= 23,
+	D3DTS_FORCE_DWORD		= 0x7fffffff
+} D3DTRANSFORMSTATETYPE;
+
+#define D3DTS_WORLDMATRIX(index)	(D3DTRANSFORMSTATETYPE)(index + 256)
+#define D3DTS_WORLD					D3DTS_WORLDMATRIX(0)
+
+typedef enum _D3DRENDERSTATETYPE {
+	D3DRS_ZENABLE					= 7,
+	D3DRS_FILLMODE					= 8,
+	D3DRS_SHADEMODE					= 9,
+	D3DRS_ZWRITEENABLE				= 14,
+	D3DRS_ALPHATESTENABLE			= 15,
+	D3DRS_LASTPIXEL					= 16,
+	D3DRS_SRCBLEND					= 19,
+	D3DRS_DESTBLEND					= 20,
+	D3DRS_CULLMODE					= 22,
+	D3DRS_ZFUNC						= 23,
+	D3DRS_ALPHAREF					= 24,
+	D3DRS_ALPHAFUNC					= 25,
+	D3DRS_DITHERENABLE				= 26,
+	D3DRS_ALPHABLENDENABLE			= 27,
+	D3DRS_FOGENABLE					= 28,
+	D3DRS_SPECULARENABLE			= 29,
+	D3DRS_FOGCOLOR					= 34,
+	D3DRS_FOGTABLEMODE				= 35,
+	D3DRS_FOGSTART					= 36,
+	D3DRS_FOGEND					= 37,
+	D3DRS_FOGDENSITY				= 38,
+	D3DRS_RANGEFOGENABLE			= 48,
+	D3DRS_STENCILENABLE				= 52,
+	D3DRS_STENCILFAIL				= 53,
+	D3DRS_STENCILZFAIL				= 54,
+	D3DRS_STENCILPASS				= 55,
+	D3DRS_STENCILFUNC				= 56,
+	D3DRS_STENCILREF				= 57,
+	D3DRS_STENCILMASK				= 58,
+	D3DRS_STENCILWRITEMASK			= 59,
+	D3DRS_TEXTUREFACTOR				= 60,
+	D3DRS_WRAP0						= 128,
+	D3DRS_CLIPPING					= 136,
+	D3DRS_LIGHTING					= 137,
+	D3DRS_AMBIENT					= 139,
+	D3DRS_FOGVERTEXMODE				= 140,
+	D3DRS_COLORVERTEX				= 141,
+	D3DRS_LOCALVIEWER				= 142,
+	D3DRS_NORMALIZENORMALS			= 143,
+	D3DRS_DIFFUSEMATERIALSOURCE		= 145,
+	D3DRS_SPECULARMATERIALSOURCE	= 146,
+	D3DRS_AMBIENTMATERIALSOURCE		= 147,
+	D3DRS_EMISSIVEMATERIALSOURCE	= 148,
+	D3DRS_VERTEXBLEND				= 151,
+	D3DRS_CLIPPLANEENABLE			= 152,
+	D3DRS_POINTSIZE					= 154,
+	D3DRS_POINTSIZE_MIN				= 155,
+	D3DRS_POINTSPRITEENABLE			= 156,
+	D3DRS_POINTSCALEENABLE			= 157,
+	D3DRS_POINTSCALE_A				= 158,
+	D3DRS_POINTSCALE_B				= 159,
+	D3DRS_POINTSCALE_C				= 160,
+	D3DRS_MULTISAMPLEANTIALIAS		= 161,
+	D3DRS_MULTISAMPLEMASK			= 162,
+	D3DRS_PATCHEDGESTYLE			= 163,
+	D3DRS_DEBUGMONITORTOKEN			= 165,
+	D3DRS_POINTSIZE_MAX				= 166,
+	D3DRS_INDEXEDVERTEXBLENDENABLE	= 167,
+	D3DRS_COLORWRITEENABLE			= 168,
+	D3DRS_TWEENFACTOR				= 170,
+	D3DRS_BLENDOP					= 171,
+	D3DRS_POSITIONDEGREE			= 172,
+	D3DRS_NORMALDEGREE				= 173,
+	D3DRS_SCISSORTESTENABLE			= 174,
+	D3DRS_SLOPESCALEDEPTHBIAS		= 175,
+	D3DRS_ANTIALIASEDLINEENABLE		= 176,
+	D3DRS_TWOSIDEDSTENCILMODE		= 185,
+	D3DRS_CCW_STENCILFAIL			= 186,
+	D3DRS_CCW_STENCILZFAIL			= 187,
+	D3DRS_CCW_STENCILPASS			= 188,
+	D3DRS_CCW_STENCILFUNC			= 189,
+	D3DRS_COLORWRITEENABLE1			= 190,
+	D3DRS_COLORWRITEENABLE2			= 191,
+	D3DRS_COLORWRITEENABLE3			= 192,
+	D3DRS_BLENDFACTOR				= 193,
+	D3DRS_SRGBWRITEENABLE			= 194,
+	D3DRS_DEPTHBIAS					= 195,
+	D3DRS_SEPARATEALPHABLENDENABLE	= 206,
+	D3DRS_SRCBLENDALPHA				= 207,
+	D3DRS_DESTBLENDALPHA			= 208,
+	D3DRS_BLENDOPALPHA				= 209,
+	D3DRS_FORCE_DWORD				= 0x7fffffff
+} D3DRENDERSTATETYPE;
+
+#define D3DCOLORWRITEENABLE_RED		(1L<<0)
+#define D3DCOLORWRITEENABLE_GREEN	(1L<<1)
+#define D3DCOLORWRITEENABLE_BLUE	(1L<<2)
+#define D3DCOLORWRITEENABLE_ALPHA	(1L<<3)
+
+typedef enum _D3DTEXTURESTAGESTATETYPE {
+	D3DTSS_COLOROP					= 1,
+	D3DTSS_COLORARG1				= 2,
+	D3DTSS_COLORARG2				= 3,
+	D3DTSS_ALPHAOP					= 4,
+	D3DTSS_ALPHAARG1				= 5,
+	D3DTSS_ALPHAARG2				= 6,
+	D3DTSS_BUMPENVMAT00				= 7,
+	D3DTSS_BUMPENVMAT01				= 8,
+	D3DTSS_BUMPENVMAT10				= 9,
+	D3DTSS_BUMPENVMAT11				= 10,
+	D3DTSS_TEXCOORDINDEX			= 11,
+	D3DTSS_BUMPENVLSCALE			= 22,
+	D3DTSS_BUMPENVLOFFSET			= 23,
+	D3DTSS_TEXTURETRANSFORMFLAGS	= 24,
+	D3DTSS_COLORARG0				= 26,
+	D3DTSS_ALPHAARG0				= 27,
+	D3DTSS_RESULTARG				= 28,
+	D3DTSS_CONSTANT					= 32,
+	D3DTSS_FORCE_DWORD				= 0x7fffffff
+} D3DTEXTURESTAGESTATETYPE;
+
+typedef enum _D3DSAMPLERSTATETYPE {
+	D3DSAMP_ADDRESSU		= 1,
+	D3DSAMP_ADDRESSV		= 2,
+	D3DSAMP_ADDRESSW		= 3,
+	D3DSAMP_BORDERCOLOR		= 4,
+	D3DSAMP_MAGFILTER		= 5,
+	D3DSAMP_MINFILTER		= 6,
+	D3DSAMP_MIPFILTER		= 7,
+	D3DSAMP_MIPMAPLODBIAS	= 8,
+	D3DSAMP_MAXMIPLEVEL		= 9,
+	D3DSAMP_MAXANISOTROPY	= 10,
+	D3DSAMP_SRGBTEXTURE		= 11,
+	D3DSAMP_ELEMENTINDEX	= 12,
+	D3DSAMP_DMAPOFFSET		= 13,
+	D3DSAMP_FORCE_DWORD		= 0x7fffffff
+} D3DSAMPLERSTATETYPE;
+
+#define D3DTA_SELECTMASK		0x0000000f
+#define D3DTA_DIFFUSE			0x00000000
+#define D3DTA_CURRENT			0x00000001
+#define D3DTA_TEXTURE			0x00000002
+#define D3DTA_TFACTOR			0x00000003
+#define D3DTA_SPECULAR			0x00000004
+#define D3DTA_TEMP				0x00000005
+#define D3DTA_CONSTANT			0x00000006
+#define D3DTA_COMPLEMENT		0x00000010
+#define D3DTA_ALPHAREPLICATE	0x00000020
+
+typedef enum _D3DTEXTUREOP {
+	D3DTOP_DISABLE					= 1,
+	D3DTOP_SELECTARG1				= 2,
+	D3DTOP_SELECTARG2				= 3,
+	D3DTOP_MODULATE					= 4,
+	D3DTOP_MODULATE2X				= 5,
+	D3DTOP_MODULATE4X				= 6,
+	D3DTOP_ADD						= 7,
+	D3DTOP_ADDSIGNED				= 8,
+	D3DTOP_ADDSIGNED2X				= 9,
+	D3DTOP_SUBTRACT					= 10,
+	D3DTOP_ADDSMOOTH				= 11,
+	D3DTOP_BLENDDIFFUSEALPHA		= 12,
+	D3DTOP_BLENDTEXTUREALPHA		= 13,
+	D3DTOP_BLENDFACTORALPHA			= 14,
+	D3DTOP_BLENDTEXTUREALPHAPM		= 15,
+	D3DTOP_BLENDCURRENTALPHA		= 16,
+	D3DTOP_PREMODULATE				= 17,
+	D3DTOP_MODULATEALPHA_ADDCOLOR	= 18,
+	D3DTOP_MODULATECOLOR_ADDALPHA	= 19,
+	D3DTOP_MODULATEINVALPHA_ADDCOLOR = 20,
+	D3DTOP_MODULATEINVCOLOR_ADDALPHA = 21,
+	D3DTOP_BUMPENVMAP				= 22,
+	D3DTOP_BUMPENVMAPLUMINANCE		= 23,
+	D3DTOP_DOTPRODUCT3				= 24,
+	D3DTOP_MULTIPLYADD				= 25,
+	D3DTOP_LERP						= 26,
+	D3DTOP_FORCE_DWORD				= 0x7fffffff
+} D3DTEXTUREOP;
+
+typedef enum _D3DTEXTUREFILTERTYPE {
+	D3DTEXF_NONE			= 0,
+	D3DTEXF_POINT			= 1,
+	D3DTEXF_LINEAR			= 2,
+	D3DTEXF_ANISOTROPIC		= 3,
+	D3DTEXF_PYRAMIDALQUAD	= 6,
+	D3DTEXF_GAUSSIANQUAD	= 7,
+	D3DTEXF_FORCE_DWORD		= 0x7fffffff
+} D3DTEXTUREFILTERTYPE;
+
+// Flexible vertex format bits
+#define D3DFVF_RESERVED0		0x001
+#define D3DFVF_POSITION_MASK	0x400E
+#define D3DFVF_XYZ				0x002
+#define D3DFVF_XYZRHW			0x004
+#define D3DFVF_XYZW				0x4002
+#define D3DFVF_NORMAL			0x010
+#define D3DFVF_PSIZE			0x020
+#define D3DFVF_DIFFUSE			0x040
+#define D3DFVF_SPECULAR			0x080
+#define D3DFVF_TEXCOUNT_MASK	0xf00
+#define D3DFVF_TEXCOUNT_SHIFT	8
+#define D3DFVF_TEX0				0x000
+#define D3DFVF_TEX1				0x100
+#define D3DFVF_TEX2				0x200
+#define D3DFVF_TEX3				0x300
+#define D3DFVF_TEX4				0x400
+
+typedef enum _D3DDECLUSAGE {
+	D3DDECLUSAGE_POSITION		= 0,
+	D3DDECLUSAGE_BLENDWEIGHT	= 1,
+	D3DDECLUSAGE_BLENDINDICES	= 2,
+	D3DDECLUSAGE_NORMAL			= 3,
+	D3DDECLUSAGE_PSIZE			= 4,
+	D3DDECLUSAGE_TEXCOORD		= 5,
+	D3DDECLUSAGE_TANGENT		= 6,
+	D3DDECLUSAGE_BINORMAL		= 7,
+	D3DDECLUSAGE_TESSFACTOR		= 8,
+	D3DDECLUSAGE_POSITIONT		= 9,
+	D3DDECLUSAGE_COLOR			= 10,
+	D3DDECLUSAGE_FOG			= 11,
+	D3DDECLUSAGE_DEPTH			= 12,
+	D3DDECLUSAGE_SAMPLE			= 13
+} D3DDECLUSAGE;
+
+typedef enum _D3DDECLMETHOD {
+	D3DDECLMETHOD_DEFAULT		= 0,
+	D3DDECLMETHOD_PARTIALU		= 1,
+	D3DDECLMETHOD_PARTIALV		= 2,
+	D3DDECLMETHOD_CROSSUV		= 3,
+	D3DDECLMETHOD_UV			= 4,
+	D3DDECLMETHOD_LOOKUP		= 5,
+	D3DDECLMETHOD_LOOKUPPRESAMPLED = 6
+} D3DDECLMETHOD;
+
+typedef enum _D3DDECLTYPE {
+	D3DDECLTYPE_FLOAT1			= 0,
+	D3DDECLTYPE_FLOAT2			= 1,
+	D3DDECLTYPE_FLOAT3			= 2,
+	D3DDECLTYPE_FLOAT4			= 3,
+	D3DDECLTYPE_D3DCOLOR		= 4,
+	D3DDECLTYPE_UBYTE4			= 5,
+	D3DDECLTYPE_SHORT2			= 6,
+	D3DDECLTYPE_SHORT4			= 7,
+	D3DDECLTYPE_UBYTE4N			= 8,
+	D3DDECLTYPE_SHORT2N			= 9,
+	D3DDECLTYPE_SHORT4N			= 10,
+	D3DDECLTYPE_USHORT2N		= 11,
+	D3DDECLTYPE_USHORT4N		= 12,
+	D3DDECLTYPE_UDEC3			= 13,
+	D3DDECLTYPE_DEC3N			= 14,
+	D3DDECLTYPE_FLOAT16_2		= 15,
+	D3DDECLTYPE_FLOAT16_4		= 16,
+	D3DDECLTYPE_UNUSED			= 17
+} D3DDECLTYPE;
+
+typedef struct _D3DVERTEXELEMENT9 {
+	WORD					Stream;
+	WORD					Offset;
+	BYTE					Type;
+	BYTE					Method;
+	BYTE					Usage;
+	BYTE					UsageIndex;
+} D3DVERTEXELEMENT9, *LPD3DVERTEXELEMENT9;
+
+#define D3DDECL_END()			{0xFF, 0, D3DDECLTYPE_UNUSED, 0, 0, 0}
+#define MAXD3DDECLLENGTH		64
+
+// Shader versions
+#define D3DPS_VERSION(_Major,_Minor)	(0xFFFF0000|((_Major)<<8)|(_Minor))
+#define D3DVS_VERSION(_Major,_Minor)	(0xFFFE0000|((_Major)<<8)|(_Minor))
+#define D3DSHADER_VERSION_MAJOR(_Version)	(((_Version)>>8)&0xFF)
+#define D3DSHADER_VERSION_MINOR(_Version)	(((_Version)>>0)&0xFF)
+
+typedef enum _D3DBASISTYPE {
+	D3DBASIS_BEZIER			= 0,
+	D3DBASIS_BSPLINE		= 1,
+	D3DBASIS_CATMULL_ROM	= 2,
+	D3DBASIS_FORCE_DWORD	= 0x7fffffff
+} D3DBASISTYPE;
+
+typedef enum _D3DDEGREETYPE {
+	D3DDEGREE_LINEAR		= 1,
+	D3DDEGREE_QUADRATIC		= 2,
+	D3DDEGREE_CUBIC			= 3,
+	D3DDEGREE_QUINTIC		= 5,
+	D3DDEGREE_FORCE_DWORD	= 0x7fffffff
+} D3DDEGREETYPE;
+
+typedef struct _D3DRECTPATCH_INFO {
+	UINT					StartVertexOffsetWidth;
+	UINT					StartVertexOffsetHeight;
+	UINT					Width;
+	UINT					Height;
+	UINT					Stride;
+	D3DBASISTYPE			Basis;
+	D3DDEGREETYPE			Degree;
+} D3DRECTPATCH_INFO;
+
+typedef struct _D3DTRIPATCH_INFO {
+	UINT					StartVertexOffset;
+	UINT					NumVertices;
+	D3DBASISTYPE			Basis;
+	D3DDEGREETYPE			Degree;
+} D3DTRIPATCH_INFO;
+
+#define MAX_DEVICE_IDENTIFIER_STRING	512
+
+typedef struct _D3DADAPTER_IDENTIFIER9 {
+	char					Driver[MAX_DEVICE_IDENTIFIER_STRING];
+	char					Description[MAX_DEVICE_IDENTIFIER_STRING];
+	char					DeviceName[32];
+	LARGE_INTEGER			DriverVersion;
+	DWORD					VendorId;
+	DWORD					DeviceId;
+	DWORD					SubSysId;
+	DWORD					Revision;
+	GUID					DeviceIdentifier;
+	DWORD					WHQLLevel;
+} D3DADAPTER_IDENTIFIER9;
+
+typedef struct _D3DRASTER_STATUS {
+	BOOL					InVBlank;
+	UINT					ScanLine;
+} D3DRASTER_STATUS;
+
+typedef enum _D3DDEBUGMONITORTOKENS {
+	D3DDMT_ENABLE			= 0,
+	D3DDMT_DISABLE			= 1,
+	D3DDMT_FORCE_DWORD		= 0x7fffffff
+} D3DDEBUGMONITORTOKENS;
+
+typedef enum _D3DMULTISAMPLE_TYPE {
+	D3DMULTISAMPLE_NONE			= 0,
+	D3DMULTISAMPLE_NONMASKABLE	= 1,
+	D3DMULTISAMPLE_2_SAMPLES	= 2,
+	D3DMULTISAMPLE_4_SAMPLES	= 4,
+	D3DMULTISAMPLE_FORCE_DWORD	= 0x7fffffff
+} D3DMULTISAMPLE_TYPE;
+
+typedef enum _D3DFORMAT {
+	D3DFMT_UNKNOWN			= 0,
+	D3DFMT_R8G8B8			= 20,
+	D3DFMT_A8R8G8B8			= 21,
+	D3DFMT_X8R8G8B8			= 22,
+	D3DFMT_R5G6B5			= 23,
+	D3DFMT_X1R5G5B5			= 24,
+	D3DFMT_A1R5G5B5			= 25,
+	D3DFMT_A4R4G4B4			= 26,
+	D3DFMT_R3G3B2			= 27,
+	D3DFMT_A8				= 28,
+	D3DFMT_A8R3G3B2			= 29,
+	D3DFMT_X4R4G4B4			= 30,
+	D3DFMT_A2B10G10R10		= 31,
+	D3DFMT_A8B8G8R8			= 32,
+	D3DFMT_X8B8G8R8			= 33,
+	D3DFMT_G16R16			= 34,
+	D3DFMT_A2R10G10B10		= 35,
+	D3DFMT_A16B16G16R16		= 36,
+	D3DFMT_A8P8				= 40,
+	D3DFMT_P8				= 41,
+	D3DFMT_L8				= 50,
+	D3DFMT_A8L8				= 51,
+	D3DFMT_A4L4				= 52,
+	D3DFMT_V8U8				= 60,
+	D3DFMT_L6V5U5			= 61,
+	D3DFMT_X8L8V8U8			= 62,
+	D3DFMT_Q8W8V8U8			= 63,
+	D3DFMT_V16U16			= 64,
+	D3DFMT_A2W10V10U10		= 67,
+	D3DFMT_UYVY				= MAKEFOURCC('U', 'Y', 'V', 'Y'),
+	D3DFMT_YUY2				= MAKEFOURCC('Y', 'U', 'Y', '2'),
+	D3DFMT_DXT1				= MAKEFOURCC('D', 'X', 'T', '1'),
+	D3DFMT_DXT2				= MAKEFOURCC('D', 'X', 'T', '2'),
+	D3DFMT_DXT3				= MAKEFOURCC('D', 'X', 'T', '3'),
+	D3DFMT_DXT4				= MAKEFOURCC('D', 'X', 'T', '4'),
+	D3DFMT_DXT5				= MAKEFOURCC('D', 'X', 'T', '5'),
+	D3DFMT_D16_LOCKABLE		= 70,
+	D3DFMT_D32				= 71,
+	D3DFMT_D15S1			= 73,
+	D3DFMT_D24S8			= 75,
+	D3DFMT_D24X8			= 77,
+	D3DFMT_D24X4S4			= 79,
+	D3DFMT_D16				= 80,
+	D3DFMT_D32F_LOCKABLE	= 82,
+	D3DFMT_D24FS8			= 83,
+	D3DFMT_L16				= 81,
+	D3DFMT_VERTEXDATA		= 100,
+	D3DFMT_INDEX16			= 101,
+	D3DFMT_INDEX32			= 102,
+	D3DFMT_Q16W16V16U16		= 110,
+	D3DFMT_R16F				= 111,
+	D3DFMT_G16R16F			= 112,
+	D3DFMT_A16B16G16R16F	= 113,
+	D3DFMT_R32F				= 114,
+	D3DFMT_G32R32F			= 115,
+	D3DFMT_A32B32G32R32F	= 116,
+	D3DFMT_CxV8U8			= 117,
+	D3DFMT_FORCE_DWORD		= 0x7fffffff
+} D3DFORMAT;
+
+typedef struct _D3DDISPLAYMODE {
+	UINT					Width;
+	UINT					Height;
+	UINT					RefreshRate;
+	D3DFORMAT				Format;
+} D3DDISPLAYMODE;
+
+typedef enum _D3DDEVTYPE {
+	D3DDEVTYPE_HAL			= 1,
+	D3DDEVTYPE_REF			= 2,
+	D3DDEVTYPE_SW			= 3,
+	D3DDEVTYPE_NULLREF		= 4,
+	D3DDEVTYPE_FORCE_DWORD	= 0x7fffffff
+} D3DDEVTYPE;
+
+typedef struct _D3DDEVICE_CREATION_PARAMETERS {
+	UINT					AdapterOrdinal;
+	D3DDEVTYPE				DeviceType;
+	HWND					hFocusWindow;
+	DWORD					BehaviorFlags;
+} D3DDEVICE_CREATION_PARAMETERS;
+
+typedef enum _D3DSWAPEFFECT {
+	D3DSWAPEFFECT_DISCARD	= 1,
+	D3DSWAPEFFECT_FLIP		= 2,
+	D3DSWAPEFFECT_COPY		= 3,
+	D3DSWAPEFFECT_FORCE_DWORD = 0x7fffffff
+} D3DSWAPEFFECT;
+
+typedef enum _D3DPOOL {
+	D3DPOOL_DEFAULT			= 0,
+	D3DPOOL_MANAGED			= 1,
+	D3DPOOL_SYSTEMMEM		= 2,
+	D3DPOOL_SCRATCH			= 3,
+	D3DPOOL_FORCE_DWORD		= 0x7fffffff
+} D3DPOOL;
+
+#define D3DPRESENT_RATE_DEFAULT			0x00000000
+#define D3DPRESENT_RATE_UNLIMITED		0x7fffffff
+
+typedef struct _D3DPRESENT_PARAMETERS_ {
+	UINT					BackBufferWidth;
+	UINT					BackBufferHeight;
+	D3DFORMAT				BackBufferFormat;
+	UINT					BackBufferCount;
+	D3DMULTISAMPLE_TYPE		MultiSampleType;
+	DWORD					MultiSampleQuality;
+	D3DSWAPEFFECT			SwapEffect;
+	HWND					hDeviceWindow;
+	BOOL					Windowed;
+	BOOL					EnableAutoDepthStencil;
+	D3DFORMAT				AutoDepthStencilFormat;
+	DWORD					Flags;
+	UINT					FullScreen_RefreshRateInHz;
+	UINT					PresentationInterval;
+} D3DPRESENT_PARAMETERS;
+
+#define D3DPRESENTFLAG_LOCKABLE_BACKBUFFER	0x00000001
+#define D3DPRESENTFLAG_DISCARD_DEPTHSTENCIL	0x00000002
+
+typedef struct _D3DGAMMARAMP {
+	WORD					red[256];
+	WORD					green[256];
+	WORD					blue[256];
+} D3DGAMMARAMP;
+
+typedef enum _D3DBACKBUFFER_TYPE {
+	D3DBACKBUFFER_TYPE_MONO		= 0,
+	D3DBACKBUFFER_TYPE_LEFT		= 1,
+	D3DBACKBUFFER_TYPE_RIGHT	= 2,
+	D3DBACKBUFFER_TYPE_FORCE_DWORD = 0x7fffffff
+} D3DBACKBUFFER_TYPE;
+
+typedef enum _D3DRESOURCETYPE {
+	D3DRTYPE_SURFACE		= 1,
+	D3DRTYPE_VOLUME			= 2,
+	D3DRTYPE_TEXTURE		= 3,
+	D3DRTYPE_VOLUMETEXTURE	= 4,
+	D3DRTYPE_CUBETEXTURE	= 5,
+	D3DRTYPE_VERTEXBUFFER	= 6,
+	D3DRTYPE_INDEXBUFFER	= 7,
+	D3DRTYPE_FORCE_DWORD	= 0x7fffffff
+} D3DRESOURCETYPE;
+
+#define D3DUSAGE_RENDERTARGET			0x00000001L
+#define D3DUSAGE_DEPTHSTENCIL			0x00000002L
+#define D3DUSAGE_DYNAMIC				0x00000200L
+#define D3DUSAGE_AUTOGENMIPMAP			0x00000400L
+#define D3DUSAGE_DMAP					0x00004000L
+#define D3DUSAGE_WRITEONLY				0x00000008L
+#define D3DUSAGE_SOFTWAREPROCESSING		0x00000010L
+#define D3DUSAGE_DONOTCLIP				0x00000020L
+#define D3DUSAGE_POINTS					0x00000040L
+#define D3DUSAGE_RTPATCHES				0x00000080L
+#define D3DUSAGE_NPATCHES				0x00000100L
+
+typedef enum _D3DCUBEMAP_FACES {
+	D3DCUBEMAP_FACE_POSITIVE_X	= 0,
+	D3DCUBEMAP_FACE_NEGATIVE_X	= 1,
+	D3DCUBEMAP_FACE_POSITIVE_Y	= 2,
+	D3DCUBEMAP_FACE_NEGATIVE_Y	= 3,
+	D3DCUBEMAP_FACE_POSITIVE_Z	= 4,
+	D3DCUBEMAP_FACE_NEGATIVE_Z	= 5,
+	D3DCUBEMAP_FACE_FORCE_DWORD	= 0x7fffffff
+} D3DCUBEMAP_FACES;
+
+#define D3DLOCK_READONLY			0x00000010L
+#define D3DLOCK_DISCARD				0x00002000L
+#define D3DLOCK_NOOVERWRITE			0x00001000L
+#define D3DLOCK_NOSYSLOCK			0x00000800L
+#define D3DLOCK_DONOTWAIT			0x00004000L
+#define D3DLOCK_NO_DIRTY_UPDATE		0x00008000L
+
+typedef struct _D3DVERTEXBUFFER_DESC {
+	D3DFORMAT				Format;
+	D3DRESOURCETYPE			Type;
+	DWORD					Usage;
+	D3DPOOL					Pool;
+	UINT					Size;
+	DWORD					FVF;
+} D3DVERTEXBUFFER_DESC;
+
+typedef struct _D3DINDEXBUFFER_DESC {
+	D3DFORMAT				Format;
+	D3DRESOURCETYPE			Type;
+	DWORD					Usage;
+	D3DPOOL					Pool;
+	UINT					Size;
+} D3DINDEXBUFFER_DESC;
+
+typedef struct _D3DSURFACE_DESC {
+	D3DFORMAT				Format;
+	D3DRESOURCETYPE			Type;
+	DWORD					Usage;
+	D3DPOOL					Pool;
+	D3DMULTISAMPLE_TYPE		MultiSampleType;
+	DWORD					MultiSampleQuality;
+	UINT					Width;
+	UINT					Height;
+} D3DSURFACE_DESC;
+
+typedef struct _D3DVOLUME_DESC {
+	D3DFORMAT				Format;
+	D3DRESOURCETYPE			Type;
+	DWORD					Usage;
+	D3DPOOL					Pool;
+	UINT					Width;
+	UINT					Height;
+	UINT					Depth;
+} D3DVOLUME_DESC;
+
+typedef struct _D3DLOCKED_RECT {
+	INT						Pitch;
+	void					*pBits;
+} D3DLOCKED_RECT;
+
+typedef struct _D3DBOX {
+	UINT					Left;
+	UINT					Top;
+	UINT					Right;
+	UINT					Bottom;
+	UINT					Front;
+	UINT					Back;
+} D3DBOX;
+
+typedef struct _D3DLOCKED_BOX {
+	INT						RowPitch;
+	INT						SlicePitch;
+	void					*pBits;
+} D3DLOCKED_BOX;
+
+typedef enum _D3DSTATEBLOCKTYPE {
+	D3DSBT_ALL				= 1,
+	D3DSBT_PIXELSTATE		= 2,
+	D3DSBT_VERTEXSTATE		= 3,
+	D3DSBT_FORCE_DWORD		= 0x7fffffff
+} D3DSTATEBLOCKTYPE;
+
+typedef enum _D3DQUERYTYPE {
+	D3DQUERYTYPE_VCACHE			= 4,
+	D3DQUERYTYPE_RESOURCEMANAGER = 5,
+	D3DQUERYTYPE_VERTEXSTATS	= 6,
+	D3DQUERYTYPE_EVENT			= 8,
+	D3DQUERYTYPE_OCCLUSION		= 9
+} D3DQUERYTYPE;
+
+#define D3DISSUE_END			(1 << 0)
+#define D3DISSUE_BEGIN			(1 << 1)
+#define D3DGETDATA_FLUSH		(1 << 0)
+
+// Device creation
+#define D3DCREATE_FPU_PRESERVE				0x00000002L
+#define D3DCREATE_MULTITHREADED				0x00000004L
+#define D3DCREATE_PUREDEVICE				0x00000010L
+#define D3DCREATE_SOFTWARE_VERTEXPROCESSING	0x00000020L
+#define D3DCREATE_HARDWARE_VERTEXPROCESSING	0x00000040L
+#define D3DCREATE_MIXED_VERTEXPROCESSING	0x00000080L
+
+#define D3DADAPTER_DEFAULT					0
+#define D3DENUM_WHQL_LEVEL					0x00000002L
+
+#define D3DPRESENT_INTERVAL_DEFAULT			0x00000000L
+#define D3DPRESENT_INTERVAL_ONE				0x00000001L
+#define D3DPRESENT_INTERVAL_TWO				0x00000002L
+#define D3DPRESENT_INTERVAL_IMMEDIATE		0x80000000L
+
+#define D3DSGR_NO_CALIBRATION				0x00000000L
+
+/*--------------------------------- Caps ----------------------------------*/
+
+typedef struct _D3DVSHADERCAPS2_0 {
+	DWORD					Caps;
+	INT						DynamicFlowControlDepth;
+	INT						NumTemps;
+	INT						StaticFlowControlDepth;
+} D3DVSHADERCAPS2_0;
+
+typedef struct _D3DPSHADERCAPS2_0 {
+	DWORD					Caps;
+	INT						DynamicFlowControlDepth;
+	INT						NumTemps;
+	INT						StaticFlowControlDepth;
+	INT						NumInstructionSlots;
+} D3DPSHADERCAPS2_0;
+
+typedef struct _D3DCAPS9 {
+	D3DDEVTYPE				DeviceType;
+	UINT					AdapterOrdinal;
+	DWORD					Caps;
+	DWORD					Caps2;
+	DWORD					Caps3;
+	DWORD					PresentationIntervals;
+	DWORD					CursorCaps;
+	DWORD					DevCaps;
+	DWORD					PrimitiveMiscCaps;
+	DWORD					RasterCaps;
+	DWORD					ZCmpCaps;
+	DWORD					SrcBlendCaps;
+	DWORD					DestBlendCaps;
+	DWORD					AlphaCmpCaps;
+	DWORD					ShadeCaps;
+	DWORD					TextureCaps;
+	DWORD					TextureFilterCaps;
+	DWORD					CubeTextureFilterCaps;
+	DWORD					VolumeTextureFilterCaps;
+	DWORD					TextureAddressCaps;
+	DWORD					VolumeTextureAddressCaps;
+	DWORD					LineCaps;
+	DWORD					MaxTextureWidth;
+	DWORD					MaxTextureHeight;
+	DWORD					MaxVolumeExtent;
+	DWORD					MaxTextureRepeat;
+	DWORD					MaxTextureAspectRatio;
+	DWORD					MaxAnisotropy;
+	float					MaxVertexW;
+	float					GuardBandLeft;
+	float					GuardBandTop;
+	float					GuardBandRight;
+	float					GuardBandBottom;
+	float					ExtentsAdjust;
+	DWORD					StencilCaps;
+	DWORD					FVFCaps;
+	DWORD					TextureOpCaps;
+	DWORD					MaxTextureBlendStages;
+	DWORD					MaxSimultaneousTextures;
+	DWORD					VertexProcessingCaps;
+	DWORD					MaxActiveLights;
+	DWORD					MaxUserClipPlanes;
+	DWORD					MaxVertexBlendMatrices;
+	DWORD					MaxVertexBlendMatrixIndex;
+	float					MaxPointSize;
+	DWORD					MaxPrimitiveCount;
+	DWORD					MaxVertexIndex;
+	DWORD					MaxStreams;
+	DWORD					MaxStreamStride;
+	DWORD					VertexShaderVersion;
+	DWORD					MaxVertexShaderConst;
+	DWORD					PixelShaderVersion;
+	float					PixelShader1xMaxValue;
+	DWORD					DevCaps2;
+	float					MaxNpatchTessellationLevel;
+	DWORD					Reserved5;
+	UINT					MasterAdapterOrdinal;
+	UINT					AdapterOrdinalInGroup;
+	UINT					NumberOfAdaptersInGroup;
+	DWORD					DeclTypes;
+	DWORD					NumSimultaneousRTs;
+	DWORD					StretchRectFilterCaps;
+	D3DVSHADERCAPS2_0		VS20Caps;
+	D3DPSHADERCAPS2_0		PS20Caps;
+	DWORD					VertexTextureFilterCaps;
+	DWORD					MaxVShaderInstructionsExecuted;
+	DWORD					MaxPShaderInstructionsExecuted;
+	DWORD					MaxVertexShader30InstructionSlots;
+	DWORD					MaxPixelShader30InstructionSlots;
+} D3DCAPS9;
+
+#define D3DCAPS2_CANAUTOGENMIPMAP		0x40000000L
+#define D3DCAPS2_DYNAMICTEXTURES		0x20000000L
+#define D3DDEVCAPS_HWTRANSFORMANDLIGHT	0x00010000L
+#define D3DDEVCAPS_PUREDEVICE			0x00100000L
+#define D3DPRASTERCAPS_SCISSORTEST		0x01000000L
+#define D3DPTEXTURECAPS_POW2			0x00000002L
+#define D3DPTEXTURECAPS_SQUAREONLY		0x00000020L
+#define D3DPTEXTURECAPS_MIPMAP			0x00004000L
+#define D3DPTEXTURECAPS_CUBEMAP			0x00000800L
+#define D3DSTENCILCAPS_TWOSIDED			0x00000100L
+
+/*------------------------------ Interfaces -------------------------------*/
+
+typedef struct IDirect3D9						IDirect3D9, *LPDIRECT3D9, *PDIRECT3D9;
+typedef struct IDirect3DDevice9					IDirect3DDevice9, *LPDIRECT3DDEVICE9, *PDIRECT3DDEVICE9;
+typedef struct IDirect3DStateBlock9				IDirect3DStateBlock9, *LPDIRECT3DSTATEBLOCK9, *PDIRECT3DSTATEBLOCK9;
+typedef struct IDirect3DSwapChain9				IDirect3DSwapChain9, *LPDIRECT3DSWAPCHAIN9, *PDIRECT3DSWAPCHAIN9;
+typedef struct IDirect3DResource9				IDirect3DResource9, *LPDIRECT3DRESOURCE9, *PDIRECT3DRESOURCE9;
+typedef struct IDirect3DVertexDeclaration9		IDirect3DVertexDeclaration9, *LPDIRECT3DVERTEXDECLARATION9, *PDIRECT3DVERTEXDECLARATION9;
+typedef struct IDirect3DVertexShader9			IDirect3DVertexShader9, *LPDIRECT3DVERTEXSHADER9, *PDIRECT3DVERTEXSHADER9;
+typedef struct IDirect3DPixelShader9			IDirect3DPixelShader9, *LPDIRECT3DPIXELSHADER9, *PDIRECT3DPIXELSHADER9;
+typedef struct IDirect3DBaseTexture9			IDirect3DBaseTexture9, *LPDIRECT3DBASETEXTURE9, *PDIRECT3DBASETEXTURE9;
+typedef struct IDirect3DTexture9				IDirect3DTexture9, *LPDIRECT3DTEXTURE9, *PDIRECT3DTEXTURE9;
+typedef struct IDirect3DVolumeTexture9			IDirect3DVolumeTexture9, *LPDIRECT3DVOLUMETEXTURE9, *PDIRECT3DVOLUMETEXTURE9;
+typedef struct IDirect3DCubeTexture9			IDirect3DCubeTexture9, *LPDIRECT3DCUBETEXTURE9, *PDIRECT3DCUBETEXTURE9;
+typedef struct IDirect3DVertexBuffer9			IDirect3DVertexBuffer9, *LPDIRECT3DVERTEXBUFFER9, *PDIRECT3DVERTEXBUFFER9;
+typedef struct IDirect3DIndexBuffer9			IDirect3DIndexBuffer9, *LPDIRECT3DINDEXBUFFER9, *PDIRECT3DINDEXBUFFER9;
+typedef struct IDirect3DSurface9				IDirect3DSurface9, *LPDIRECT3DSURFACE9, *PDIRECT3DSURFACE9;
+typedef struct IDirect3DQuery9					IDirect3DQuery9, *LPDIRECT3DQUERY9, *PDIRECT3DQUERY9;
+
+typedef struct IDirect3D9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3D9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3D9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3D9 *This);
+	HRESULT				(STDMETHODCALLTYPE *RegisterSoftwareDevice)(IDirect3D9 *This, void *pInitializeFunction);
+	UINT				(STDMETHODCALLTYPE *GetAdapterCount)(IDirect3D9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetAdapterIdentifier)(IDirect3D9 *This, UINT Adapter, DWORD Flags, D3DADAPTER_IDENTIFIER9 *pIdentifier);
+	UINT				(STDMETHODCALLTYPE *GetAdapterModeCount)(IDirect3D9 *This, UINT Adapter, D3DFORMAT Format);
+	HRESULT				(STDMETHODCALLTYPE *EnumAdapterModes)(IDirect3D9 *This, UINT Adapter, D3DFORMAT Format, UINT Mode, D3DDISPLAYMODE *pMode);
+	HRESULT				(STDMETHODCALLTYPE *GetAdapterDisplayMode)(IDirect3D9 *This, UINT Adapter, D3DDISPLAYMODE *pMode);
+	HRESULT				(STDMETHODCALLTYPE *CheckDeviceType)(IDirect3D9 *This, UINT Adapter, D3DDEVTYPE DevType, D3DFORMAT AdapterFormat, D3DFORMAT BackBufferFormat, BOOL bWindowed);
+	HRESULT				(STDMETHODCALLTYPE *CheckDeviceFormat)(IDirect3D9 *This, UINT Adapter, D3DDEVTYPE DeviceType, D3DFORMAT AdapterFormat, DWORD Usage, D3DRESOURCETYPE RType, D3DFORMAT CheckFormat);
+	HRESULT				(STDMETHODCALLTYPE *CheckDeviceMultiSampleType)(IDirect3D9 *This, UINT Adapter, D3DDEVTYPE DeviceType, D3DFORMAT SurfaceFormat, BOOL Windowed, D3DMULTISAMPLE_TYPE MultiSampleType, DWORD *pQualityLevels);
+	HRESULT				(STDMETHODCALLTYPE *CheckDepthStencilMatch)(IDirect3D9 *This, UINT Adapter, D3DDEVTYPE DeviceType, D3DFORMAT AdapterFormat, D3DFORMAT RenderTargetFormat, D3DFORMAT DepthStencilFormat);
+	HRESULT				(STDMETHODCALLTYPE *CheckDeviceFormatConversion)(IDirect3D9 *This, UINT Adapter, D3DDEVTYPE DeviceType, D3DFORMAT SourceFormat, D3DFORMAT TargetFormat);
+	HRESULT				(STDMETHODCALLTYPE *GetDeviceCaps)(IDirect3D9 *This, UINT Adapter, D3DDEVTYPE DeviceType, D3DCAPS9 *pCaps);
+	HMONITOR			(STDMETHODCALLTYPE *GetAdapterMonitor)(IDirect3D9 *This, UINT Adapter);
+	HRESULT				(STDMETHODCALLTYPE *CreateDevice)(IDirect3D9 *This, UINT Adapter, D3DDEVTYPE DeviceType, HWND hFocusWindow, DWORD BehaviorFlags, D3DPRESENT_PARAMETERS *pPresentationParameters, IDirect3DDevice9 **ppReturnedDeviceInterface);
+} IDirect3D9Vtbl;
+
+struct IDirect3D9 {
+	IDirect3D9Vtbl		*lpVtbl;
+};
+
+#define IDirect3D9_QueryInterface(p,a,b)						(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3D9_AddRef(p)									(p)->lpVtbl->AddRef(p)
+#define IDirect3D9_Release(p)									(p)->lpVtbl->Release(p)
+#define IDirect3D9_RegisterSoftwareDevice(p,a)					(p)->lpVtbl->RegisterSoftwareDevice(p,a)
+#define IDirect3D9_GetAdapterCount(p)							(p)->lpVtbl->GetAdapterCount(p)
+#define IDirect3D9_GetAdapterIdentifier(p,a,b,c)				(p)->lpVtbl->GetAdapterIdentifier(p,a,b,c)
+#define IDirect3D9_GetAdapterModeCount(p,a,b)					(p)->lpVtbl->GetAdapterModeCount(p,a,b)
+#define IDirect3D9_EnumAdapterModes(p,a,b,c,d)					(p)->lpVtbl->EnumAdapterModes(p,a,b,c,d)
+#define IDirect3D9_GetAdapterDisplayMode(p,a,b)					(p)->lpVtbl->GetAdapterDisplayMode(p,a,b)
+#define IDirect3D9_CheckDeviceType(p,a,b,c,d,e)					(p)->lpVtbl->CheckDeviceType(p,a,b,c,d,e)
+#define IDirect3D9_CheckDeviceFormat(p,a,b,c,d,e,f)				(p)->lpVtbl->CheckDeviceFormat(p,a,b,c,d,e,f)
+#define IDirect3D9_CheckDeviceMultiSampleType(p,a,b,c,d,e,f)	(p)->lpVtbl->CheckDeviceMultiSampleType(p,a,b,c,d,e,f)
+#define IDirect3D9_CheckDepthStencilMatch(p,a,b,c,d,e)			(p)->lpVtbl->CheckDepthStencilMatch(p,a,b,c,d,e)
+#define IDirect3D9_CheckDeviceFormatConversion(p,a,b,c,d)		(p)->lpVtbl->CheckDeviceFormatConversion(p,a,b,c,d)
+#define IDirect3D9_GetDeviceCaps(p,a,b,c)						(p)->lpVtbl->GetDeviceCaps(p,a,b,c)
+#define IDirect3D9_GetAdapterMonitor(p,a)						(p)->lpVtbl->GetAdapterMonitor(p,a)
+#define IDirect3D9_CreateDevice(p,a,b,c,d,e,f)					(p)->lpVtbl->CreateDevice(p,a,b,c,d,e,f)
+
+typedef struct IDirect3DDevice9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DDevice9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DDevice9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *TestCooperativeLevel)(IDirect3DDevice9 *This);
+	UINT				(STDMETHODCALLTYPE *GetAvailableTextureMem)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *EvictManagedResources)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDirect3D)(IDirect3DDevice9 *This, IDirect3D9 **ppD3D9);
+	HRESULT				(STDMETHODCALLTYPE *GetDeviceCaps)(IDirect3DDevice9 *This, D3DCAPS9 *pCaps);
+	HRESULT				(STDMETHODCALLTYPE *GetDisplayMode)(IDirect3DDevice9 *This, UINT iSwapChain, D3DDISPLAYMODE *pMode);
+	HRESULT				(STDMETHODCALLTYPE *GetCreationParameters)(IDirect3DDevice9 *This, D3DDEVICE_CREATION_PARAMETERS *pParameters);
+	HRESULT				(STDMETHODCALLTYPE *SetCursorProperties)(IDirect3DDevice9 *This, UINT XHotSpot, UINT YHotSpot, IDirect3DSurface9 *pCursorBitmap);
+	void				(STDMETHODCALLTYPE *SetCursorPosition)(IDirect3DDevice9 *This, int X, int Y, DWORD Flags);
+	BOOL				(STDMETHODCALLTYPE *ShowCursor)(IDirect3DDevice9 *This, BOOL bShow);
+	HRESULT				(STDMETHODCALLTYPE *CreateAdditionalSwapChain)(IDirect3DDevice9 *This, D3DPRESENT_PARAMETERS *pPresentationParameters, IDirect3DSwapChain9 **pSwapChain);
+	HRESULT				(STDMETHODCALLTYPE *GetSwapChain)(IDirect3DDevice9 *This, UINT iSwapChain, IDirect3DSwapChain9 **pSwapChain);
+	UINT				(STDMETHODCALLTYPE *GetNumberOfSwapChains)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *Reset)(IDirect3DDevice9 *This, D3DPRESENT_PARAMETERS *pPresentationParameters);
+	HRESULT				(STDMETHODCALLTYPE *Present)(IDirect3DDevice9 *This, const RECT *pSourceRect, const RECT *pDestRect, HWND hDestWindowOverride, const RGNDATA *pDirtyRegion);
+	HRESULT				(STDMETHODCALLTYPE *GetBackBuffer)(IDirect3DDevice9 *This, UINT iSwapChain, UINT iBackBuffer, D3DBACKBUFFER_TYPE Type, IDirect3DSurface9 **ppBackBuffer);
+	HRESULT				(STDMETHODCALLTYPE *GetRasterStatus)(IDirect3DDevice9 *This, UINT iSwapChain, D3DRASTER_STATUS *pRasterStatus);
+	HRESULT				(STDMETHODCALLTYPE *SetDialogBoxMode)(IDirect3DDevice9 *This, BOOL bEnableDialogs);
+	void				(STDMETHODCALLTYPE *SetGammaRamp)(IDirect3DDevice9 *This, UINT iSwapChain, DWORD Flags, const D3DGAMMARAMP *pRamp);
+	void				(STDMETHODCALLTYPE *GetGammaRamp)(IDirect3DDevice9 *This, UINT iSwapChain, D3DGAMMARAMP *pRamp);
+	HRESULT				(STDMETHODCALLTYPE *CreateTexture)(IDirect3DDevice9 *This, UINT Width, UINT Height, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DTexture9 **ppTexture, HANDLE *pSharedHandle);
+	HRESULT				(STDMETHODCALLTYPE *CreateVolumeTexture)(IDirect3DDevice9 *This, UINT Width, UINT Height, UINT Depth, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DVolumeTexture9 **ppVolumeTexture, HANDLE *pSharedHandle);
+	HRESULT				(STDMETHODCALLTYPE *CreateCubeTexture)(IDirect3DDevice9 *This, UINT EdgeLength, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DCubeTexture9 **ppCubeTexture, HANDLE *pSharedHandle);
+	HRESULT				(STDMETHODCALLTYPE *CreateVertexBuffer)(IDirect3DDevice9 *This, UINT Length, DWORD Usage, DWORD FVF, D3DPOOL Pool, IDirect3DVertexBuffer9 **ppVertexBuffer, HANDLE *pSharedHandle);
+	HRESULT				(STDMETHODCALLTYPE *CreateIndexBuffer)(IDirect3DDevice9 *This, UINT Length, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DIndexBuffer9 **ppIndexBuffer, HANDLE *pSharedHandle);
+	HRESULT				(STDMETHODCALLTYPE *CreateRenderTarget)(IDirect3DDevice9 *This, UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE MultiSample, DWORD MultisampleQuality, BOOL Lockable, IDirect3DSurface9 **ppSurface, HANDLE *pSharedHandle);
+	HRESULT				(STDMETHODCALLTYPE *CreateDepthStencilSurface)(IDirect3DDevice9 *This, UINT Width, UINT Height, D3DFORMAT Format, D3DMULTISAMPLE_TYPE MultiSample, DWORD MultisampleQuality, BOOL Discard, IDirect3DSurface9 **ppSurface, HANDLE *pSharedHandle);
+	HRESULT				(STDMETHODCALLTYPE *UpdateSurface)(IDirect3DDevice9 *This, IDirect3DSurface9 *pSourceSurface, const RECT *pSourceRect, IDirect3DSurface9 *pDestinationSurface, const POINT *pDestPoint);
+	HRESULT				(STDMETHODCALLTYPE *UpdateTexture)(IDirect3DDevice9 *This, IDirect3DBaseTexture9 *pSourceTexture, IDirect3DBaseTexture9 *pDestinationTexture);
+	HRESULT				(STDMETHODCALLTYPE *GetRenderTargetData)(IDirect3DDevice9 *This, IDirect3DSurface9 *pRenderTarget, IDirect3DSurface9 *pDestSurface);
+	HRESULT				(STDMETHODCALLTYPE *GetFrontBufferData)(IDirect3DDevice9 *This, UINT iSwapChain, IDirect3DSurface9 *pDestSurface);
+	HRESULT				(STDMETHODCALLTYPE *StretchRect)(IDirect3DDevice9 *This, IDirect3DSurface9 *pSourceSurface, const RECT *pSourceRect, IDirect3DSurface9 *pDestSurface, const RECT *pDestRect, D3DTEXTUREFILTERTYPE Filter);
+	HRESULT				(STDMETHODCALLTYPE *ColorFill)(IDirect3DDevice9 *This, IDirect3DSurface9 *pSurface, const RECT *pRect, D3DCOLOR color);
+	HRESULT				(STDMETHODCALLTYPE *CreateOffscreenPlainSurface)(IDirect3DDevice9 *This, UINT Width, UINT Height, D3DFORMAT Format, D3DPOOL Pool, IDirect3DSurface9 **ppSurface, HANDLE *pSharedHandle);
+	HRESULT				(STDMETHODCALLTYPE *SetRenderTarget)(IDirect3DDevice9 *This, DWORD RenderTargetIndex, IDirect3DSurface9 *pRenderTarget);
+	HRESULT				(STDMETHODCALLTYPE *GetRenderTarget)(IDirect3DDevice9 *This, DWORD RenderTargetIndex, IDirect3DSurface9 **ppRenderTarget);
+	HRESULT				(STDMETHODCALLTYPE *SetDepthStencilSurface)(IDirect3DDevice9 *This, IDirect3DSurface9 *pNewZStencil);
+	HRESULT				(STDMETHODCALLTYPE *GetDepthStencilSurface)(IDirect3DDevice9 *This, IDirect3DSurface9 **ppZStencilSurface);
+	HRESULT				(STDMETHODCALLTYPE *BeginScene)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *EndScene)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *Clear)(IDirect3DDevice9 *This, DWORD Count, const D3DRECT *pRects, DWORD Flags, D3DCOLOR Color, float Z, DWORD Stencil);
+	HRESULT				(STDMETHODCALLTYPE *SetTransform)(IDirect3DDevice9 *This, D3DTRANSFORMSTATETYPE State, const D3DMATRIX *pMatrix);
+	HRESULT				(STDMETHODCALLTYPE *GetTransform)(IDirect3DDevice9 *This, D3DTRANSFORMSTATETYPE State, D3DMATRIX *pMatrix);
+	HRESULT				(STDMETHODCALLTYPE *MultiplyTransform)(IDirect3DDevice9 *This, D3DTRANSFORMSTATETYPE State, const D3DMATRIX *pMatrix);
+	HRESULT				(STDMETHODCALLTYPE *SetViewport)(IDirect3DDevice9 *This, const D3DVIEWPORT9 *pViewport);
+	HRESULT				(STDMETHODCALLTYPE *GetViewport)(IDirect3DDevice9 *This, D3DVIEWPORT9 *pViewport);
+	HRESULT				(STDMETHODCALLTYPE *SetMaterial)(IDirect3DDevice9 *This, const D3DMATERIAL9 *pMaterial);
+	HRESULT				(STDMETHODCALLTYPE *GetMaterial)(IDirect3DDevice9 *This, D3DMATERIAL9 *pMaterial);
+	HRESULT				(STDMETHODCALLTYPE *SetLight)(IDirect3DDevice9 *This, DWORD Index, const D3DLIGHT9 *pLight);
+	HRESULT				(STDMETHODCALLTYPE *GetLight)(IDirect3DDevice9 *This, DWORD Index, D3DLIGHT9 *pLight);
+	HRESULT				(STDMETHODCALLTYPE *LightEnable)(IDirect3DDevice9 *This, DWORD Index, BOOL Enable);
+	HRESULT				(STDMETHODCALLTYPE *GetLightEnable)(IDirect3DDevice9 *This, DWORD Index, BOOL *pEnable);
+	HRESULT				(STDMETHODCALLTYPE *SetClipPlane)(IDirect3DDevice9 *This, DWORD Index, const float *pPlane);
+	HRESULT				(STDMETHODCALLTYPE *GetClipPlane)(IDirect3DDevice9 *This, DWORD Index, float *pPlane);
+	HRESULT				(STDMETHODCALLTYPE *SetRenderState)(IDirect3DDevice9 *This, D3DRENDERSTATETYPE State, DWORD Value);
+	HRESULT				(STDMETHODCALLTYPE *GetRenderState)(IDirect3DDevice9 *This, D3DRENDERSTATETYPE State, DWORD *pValue);
+	HRESULT				(STDMETHODCALLTYPE *CreateStateBlock)(IDirect3DDevice9 *This, D3DSTATEBLOCKTYPE Type, IDirect3DStateBlock9 **ppSB);
+	HRESULT				(STDMETHODCALLTYPE *BeginStateBlock)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *EndStateBlock)(IDirect3DDevice9 *This, IDirect3DStateBlock9 **ppSB);
+	HRESULT				(STDMETHODCALLTYPE *SetClipStatus)(IDirect3DDevice9 *This, const D3DCLIPSTATUS9 *pClipStatus);
+	HRESULT				(STDMETHODCALLTYPE *GetClipStatus)(IDirect3DDevice9 *This, D3DCLIPSTATUS9 *pClipStatus);
+	HRESULT				(STDMETHODCALLTYPE *GetTexture)(IDirect3DDevice9 *This, DWORD Stage, IDirect3DBaseTexture9 **ppTexture);
+	HRESULT				(STDMETHODCALLTYPE *SetTexture)(IDirect3DDevice9 *This, DWORD Stage, IDirect3DBaseTexture9 *pTexture);
+	HRESULT				(STDMETHODCALLTYPE *GetTextureStageState)(IDirect3DDevice9 *This, DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD *pValue);
+	HRESULT				(STDMETHODCALLTYPE *SetTextureStageState)(IDirect3DDevice9 *This, DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value);
+	HRESULT				(STDMETHODCALLTYPE *GetSamplerState)(IDirect3DDevice9 *This, DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD *pValue);
+	HRESULT				(STDMETHODCALLTYPE *SetSamplerState)(IDirect3DDevice9 *This, DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value);
+	HRESULT				(STDMETHODCALLTYPE *ValidateDevice)(IDirect3DDevice9 *This, DWORD *pNumPasses);
+	HRESULT				(STDMETHODCALLTYPE *SetPaletteEntries)(IDirect3DDevice9 *This, UINT PaletteNumber, const PALETTEENTRY *pEntries);
+	HRESULT				(STDMETHODCALLTYPE *GetPaletteEntries)(IDirect3DDevice9 *This, UINT PaletteNumber, PALETTEENTRY *pEntries);
+	HRESULT				(STDMETHODCALLTYPE *SetCurrentTexturePalette)(IDirect3DDevice9 *This, UINT PaletteNumber);
+	HRESULT				(STDMETHODCALLTYPE *GetCurrentTexturePalette)(IDirect3DDevice9 *This, UINT *PaletteNumber);
+	HRESULT				(STDMETHODCALLTYPE *SetScissorRect)(IDirect3DDevice9 *This, const RECT *pRect);
+	HRESULT				(STDMETHODCALLTYPE *GetScissorRect)(IDirect3DDevice9 *This, RECT *pRect);
+	HRESULT				(STDMETHODCALLTYPE *SetSoftwareVertexProcessing)(IDirect3DDevice9 *This, BOOL bSoftware);
+	BOOL				(STDMETHODCALLTYPE *GetSoftwareVertexProcessing)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *SetNPatchMode)(IDirect3DDevice9 *This, float nSegments);
+	float				(STDMETHODCALLTYPE *GetNPatchMode)(IDirect3DDevice9 *This);
+	HRESULT				(STDMETHODCALLTYPE *DrawPrimitive)(IDirect3DDevice9 *This, D3DPRIMITIVETYPE PrimitiveType, UINT StartVertex, UINT PrimitiveCount);
+	HRESULT				(STDMETHODCALLTYPE *DrawIndexedPrimitive)(IDirect3DDevice9 *This, D3DPRIMITIVETYPE PrimitiveType, INT BaseVertexIndex, UINT MinVertexIndex, UINT NumVertices, UINT startIndex, UINT primCount);
+	HRESULT				(STDMETHODCALLTYPE *DrawPrimitiveUP)(IDirect3DDevice9 *This, D3DPRIMITIVETYPE PrimitiveType, UINT PrimitiveCount, const void *pVertexStreamZeroData, UINT VertexStreamZeroStride);
+	HRESULT				(STDMETHODCALLTYPE *DrawIndexedPrimitiveUP)(IDirect3DDevice9 *This, D3DPRIMITIVETYPE PrimitiveType, UINT MinVertexIndex, UINT NumVertices, UINT PrimitiveCount, const void *pIndexData, D3DFORMAT IndexDataFormat, const void *pVertexStreamZeroData, UINT VertexStreamZeroStride);
+	HRESULT				(STDMETHODCALLTYPE *ProcessVertices)(IDirect3DDevice9 *This, UINT SrcStartIndex, UINT DestIndex, UINT VertexCount, IDirect3DVertexBuffer9 *pDestBuffer, IDirect3DVertexDeclaration9 *pVertexDecl, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *CreateVertexDeclaration)(IDirect3DDevice9 *This, const D3DVERTEXELEMENT9 *pVertexElements, IDirect3DVertexDeclaration9 **ppDecl);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexDeclaration)(IDirect3DDevice9 *This, IDirect3DVertexDeclaration9 *pDecl);
+	HRESULT				(STDMETHODCALLTYPE *GetVertexDeclaration)(IDirect3DDevice9 *This, IDirect3DVertexDeclaration9 **ppDecl);
+	HRESULT				(STDMETHODCALLTYPE *SetFVF)(IDirect3DDevice9 *This, DWORD FVF);
+	HRESULT				(STDMETHODCALLTYPE *GetFVF)(IDirect3DDevice9 *This, DWORD *pFVF);
+	HRESULT				(STDMETHODCALLTYPE *CreateVertexShader)(IDirect3DDevice9 *This, const DWORD *pFunction, IDirect3DVertexShader9 **ppShader);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexShader)(IDirect3DDevice9 *This, IDirect3DVertexShader9 *pShader);
+	HRESULT				(STDMETHODCALLTYPE *GetVertexShader)(IDirect3DDevice9 *This, IDirect3DVertexShader9 **ppShader);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexShaderConstantF)(IDirect3DDevice9 *This, UINT StartRegister, const float *pConstantData, UINT Vector4fCount);
+	HRESULT				(STDMETHODCALLTYPE *GetVertexShaderConstantF)(IDirect3DDevice9 *This, UINT StartRegister, float *pConstantData, UINT Vector4fCount);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexShaderConstantI)(IDirect3DDevice9 *This, UINT StartRegister, const int *pConstantData, UINT Vector4iCount);
+	HRESULT				(STDMETHODCALLTYPE *GetVertexShaderConstantI)(IDirect3DDevice9 *This, UINT StartRegister, int *pConstantData, UINT Vector4iCount);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexShaderConstantB)(IDirect3DDevice9 *This, UINT StartRegister, const BOOL *pConstantData, UINT BoolCount);
+	HRESULT				(STDMETHODCALLTYPE *GetVertexShaderConstantB)(IDirect3DDevice9 *This, UINT StartRegister, BOOL *pConstantData, UINT BoolCount);
+	HRESULT				(STDMETHODCALLTYPE *SetStreamSource)(IDirect3DDevice9 *This, UINT StreamNumber, IDirect3DVertexBuffer9 *pStreamData, UINT OffsetInBytes, UINT Stride);
+	HRESULT				(STDMETHODCALLTYPE *GetStreamSource)(IDirect3DDevice9 *This, UINT StreamNumber, IDirect3DVertexBuffer9 **ppStreamData, UINT *pOffsetInBytes, UINT *pStride);
+	HRESULT				(STDMETHODCALLTYPE *SetStreamSourceFreq)(IDirect3DDevice9 *This, UINT StreamNumber, UINT Setting);
+	HRESULT				(STDMETHODCALLTYPE *GetStreamSourceFreq)(IDirect3DDevice9 *This, UINT StreamNumber, UINT *pSetting);
+	HRESULT				(STDMETHODCALLTYPE *SetIndices)(IDirect3DDevice9 *This, IDirect3DIndexBuffer9 *pIndexData);
+	HRESULT				(STDMETHODCALLTYPE *GetIndices)(IDirect3DDevice9 *This, IDirect3DIndexBuffer9 **ppIndexData);
+	HRESULT				(STDMETHODCALLTYPE *CreatePixelShader)(IDirect3DDevice9 *This, const DWORD *pFunction, IDirect3DPixelShader9 **ppShader);
+	HRESULT				(STDMETHODCALLTYPE *SetPixelShader)(IDirect3DDevice9 *This, IDirect3DPixelShader9 *pShader);
+	HRESULT				(STDMETHODCALLTYPE *GetPixelShader)(IDirect3DDevice9 *This, IDirect3DPixelShader9 **ppShader);
+	HRESULT				(STDMETHODCALLTYPE *SetPixelShaderConstantF)(IDirect3DDevice9 *This, UINT StartRegister, const float *pConstantData, UINT Vector4fCount);
+	HRESULT				(STDMETHODCALLTYPE *GetPixelShaderConstantF)(IDirect3DDevice9 *This, UINT StartRegister, float *pConstantData, UINT Vector4fCount);
+	HRESULT				(STDMETHODCALLTYPE *SetPixelShaderConstantI)(IDirect3DDevice9 *This, UINT StartRegister, const int *pConstantData, UINT Vector4iCount);
+	HRESULT				(STDMETHODCALLTYPE *GetPixelShaderConstantI)(IDirect3DDevice9 *This, UINT StartRegister, int *pConstantData, UINT Vector4iCount);
+	HRESULT				(STDMETHODCALLTYPE *SetPixelShaderConstantB)(IDirect3DDevice9 *This, UINT StartRegister, const BOOL *pConstantData, UINT BoolCount);
+	HRESULT				(STDMETHODCALLTYPE *GetPixelShaderConstantB)(IDirect3DDevice9 *This, UINT StartRegister, BOOL *pConstantData, UINT BoolCount);
+	HRESULT				(STDMETHODCALLTYPE *DrawRectPatch)(IDirect3DDevice9 *This, UINT Handle, const float *pNumSegs, const D3DRECTPATCH_INFO *pRectPatchInfo);
+	HRESULT				(STDMETHODCALLTYPE *DrawTriPatch)(IDirect3DDevice9 *This, UINT Handle, const float *pNumSegs, const D3DTRIPATCH_INFO *pTriPatchInfo);
+	HRESULT				(STDMETHODCALLTYPE *DeletePatch)(IDirect3DDevice9 *This, UINT Handle);
+	HRESULT				(STDMETHODCALLTYPE *CreateQuery)(IDirect3DDevice9 *This, D3DQUERYTYPE Type, IDirect3DQuery9 **ppQuery);
+} IDirect3DDevice9Vtbl;
+
+struct IDirect3DDevice9 {
+	IDirect3DDevice9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DDevice9_QueryInterface(p,a,b)					(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DDevice9_AddRef(p)								(p)->lpVtbl->AddRef(p)
+#define IDirect3DDevice9_Release(p)								(p)->lpVtbl->Release(p)
+#define IDirect3DDevice9_TestCooperativeLevel(p)				(p)->lpVtbl->TestCooperativeLevel(p)
+#define IDirect3DDevice9_GetAvailableTextureMem(p)				(p)->lpVtbl->GetAvailableTextureMem(p)
+#define IDirect3DDevice9_EvictManagedResources(p)				(p)->lpVtbl->EvictManagedResources(p)
+#define IDirect3DDevice9_GetDirect3D(p,a)						(p)->lpVtbl->GetDirect3D(p,a)
+#define IDirect3DDevice9_GetDeviceCaps(p,a)						(p)->lpVtbl->GetDeviceCaps(p,a)
+#define IDirect3DDevice9_GetDisplayMode(p,a,b)					(p)->lpVtbl->GetDisplayMode(p,a,b)
+#define IDirect3DDevice9_GetCreationParameters(p,a)				(p)->lpVtbl->GetCreationParameters(p,a)
+#define IDirect3DDevice9_SetCursorProperties(p,a,b,c)			(p)->lpVtbl->SetCursorProperties(p,a,b,c)
+#define IDirect3DDevice9_SetCursorPosition(p,a,b,c)				(p)->lpVtbl->SetCursorPosition(p,a,b,c)
+#define IDirect3DDevice9_ShowCursor(p,a)						(p)->lpVtbl->ShowCursor(p,a)
+#define IDirect3DDevice9_CreateAdditionalSwapChain(p,a,b)		(p)->lpVtbl->CreateAdditionalSwapChain(p,a,b)
+#define IDirect3DDevice9_GetSwapChain(p,a,b)					(p)->lpVtbl->GetSwapChain(p,a,b)
+#define IDirect3DDevice9_GetNumberOfSwapChains(p)				(p)->lpVtbl->GetNumberOfSwapChains(p)
+#define IDirect3DDevice9_Reset(p,a)								(p)->lpVtbl->Reset(p,a)
+#define IDirect3DDevice9_Present(p,a,b,c,d)						(p)->lpVtbl->Present(p,a,b,c,d)
+#define IDirect3DDevice9_GetBackBuffer(p,a,b,c,d)				(p)->lpVtbl->GetBackBuffer(p,a,b,c,d)
+#define IDirect3DDevice9_GetRasterStatus(p,a,b)					(p)->lpVtbl->GetRasterStatus(p,a,b)
+#define IDirect3DDevice9_SetDialogBoxMode(p,a)					(p)->lpVtbl->SetDialogBoxMode(p,a)
+#define IDirect3DDevice9_SetGammaRamp(p,a,b,c)					(p)->lpVtbl->SetGammaRamp(p,a,b,c)
+#define IDirect3DDevice9_GetGammaRamp(p,a,b)					(p)->lpVtbl->GetGammaRamp(p,a,b)
+#define IDirect3DDevice9_CreateTexture(p,a,b,c,d,e,f,g,h)		(p)->lpVtbl->CreateTexture(p,a,b,c,d,e,f,g,h)
+#define IDirect3DDevice9_CreateVolumeTexture(p,a,b,c,d,e,f,g,h,i)	(p)->lpVtbl->CreateVolumeTexture(p,a,b,c,d,e,f,g,h,i)
+#define IDirect3DDevice9_CreateCubeTexture(p,a,b,c,d,e,f,g)		(p)->lpVtbl->CreateCubeTexture(p,a,b,c,d,e,f,g)
+#define IDirect3DDevice9_CreateVertexBuffer(p,a,b,c,d,e,f)		(p)->lpVtbl->CreateVertexBuffer(p,a,b,c,d,e,f)
+#define IDirect3DDevice9_CreateIndexBuffer(p,a,b,c,d,e,f)		(p)->lpVtbl->CreateIndexBuffer(p,a,b,c,d,e,f)
+#define IDirect3DDevice9_CreateRenderTarget(p,a,b,c,d,e,f,g,h)	(p)->lpVtbl->CreateRenderTarget(p,a,b,c,d,e,f,g,h)
+#define IDirect3DDevice9_CreateDepthStencilSurface(p,a,b,c,d,e,f,g,h)	(p)->lpVtbl->CreateDepthStencilSurface(p,a,b,c,d,e,f,g,h)
+#define IDirect3DDevice9_UpdateSurface(p,a,b,c,d)				(p)->lpVtbl->UpdateSurface(p,a,b,c,d)
+#define IDirect3DDevice9_UpdateTexture(p,a,b)					(p)->lpVtbl->UpdateTexture(p,a,b)
+#define IDirect3DDevice9_GetRenderTargetData(p,a,b)				(p)->lpVtbl->GetRenderTargetData(p,a,b)
+#define IDirect3DDevice9_GetFrontBufferData(p,a,b)				(p)->lpVtbl->GetFrontBufferData(p,a,b)
+#define IDirect3DDevice9_StretchRect(p,a,b,c,d,e)				(p)->lpVtbl->StretchRect(p,a,b,c,d,e)
+#define IDirect3DDevice9_ColorFill(p,a,b,c)						(p)->lpVtbl->ColorFill(p,a,b,c)
+#define IDirect3DDevice9_CreateOffscreenPlainSurface(p,a,b,c,d,e,f)	(p)->lpVtbl->CreateOffscreenPlainSurface(p,a,b,c,d,e,f)
+#define IDirect3DDevice9_SetRenderTarget(p,a,b)					(p)->lpVtbl->SetRenderTarget(p,a,b)
+#define IDirect3DDevice9_GetRenderTarget(p,a,b)					(p)->lpVtbl->GetRenderTarget(p,a,b)
+#define IDirect3DDevice9_SetDepthStencilSurface(p,a)			(p)->lpVtbl->SetDepthStencilSurface(p,a)
+#define IDirect3DDevice9_GetDepthStencilSurface(p,a)			(p)->lpVtbl->GetDepthStencilSurface(p,a)
+#define IDirect3DDevice9_BeginScene(p)							(p)->lpVtbl->BeginScene(p)
+#define IDirect3DDevice9_EndScene(p)							(p)->lpVtbl->EndScene(p)
+#define IDirect3DDevice9_Clear(p,a,b,c,d,e,f)					(p)->lpVtbl->Clear(p,a,b,c,d,e,f)
+#define IDirect3DDevice9_SetTransform(p,a,b)					(p)->lpVtbl->SetTransform(p,a,b)
+#define IDirect3DDevice9_GetTransform(p,a,b)					(p)->lpVtbl->GetTransform(p,a,b)
+#define IDirect3DDevice9_MultiplyTransform(p,a,b)				(p)->lpVtbl->MultiplyTransform(p,a,b)
+#define IDirect3DDevice9_SetViewport(p,a)						(p)->lpVtbl->SetViewport(p,a)
+#define IDirect3DDevice9_GetViewport(p,a)						(p)->lpVtbl->GetViewport(p,a)
+#define IDirect3DDevice9_SetMaterial(p,a)						(p)->lpVtbl->SetMaterial(p,a)
+#define IDirect3DDevice9_GetMaterial(p,a)						(p)->lpVtbl->GetMaterial(p,a)
+#define IDirect3DDevice9_SetLight(p,a,b)						(p)->lpVtbl->SetLight(p,a,b)
+#define IDirect3DDevice9_GetLight(p,a,b)						(p)->lpVtbl->GetLight(p,a,b)
+#define IDirect3DDevice9_LightEnable(p,a,b)						(p)->lpVtbl->LightEnable(p,a,b)
+#define IDirect3DDevice9_GetLightEnable(p,a,b)					(p)->lpVtbl->GetLightEnable(p,a,b)
+#define IDirect3DDevice9_SetClipPlane(p,a,b)					(p)->lpVtbl->SetClipPlane(p,a,b)
+#define IDirect3DDevice9_GetClipPlane(p,a,b)					(p)->lpVtbl->GetClipPlane(p,a,b)
+#define IDirect3DDevice9_SetRenderState(p,a,b)					(p)->lpVtbl->SetRenderState(p,a,b)
+#define IDirect3DDevice9_GetRenderState(p,a,b)					(p)->lpVtbl->GetRenderState(p,a,b)
+#define IDirect3DDevice9_CreateStateBlock(p,a,b)				(p)->lpVtbl->CreateStateBlock(p,a,b)
+#define IDirect3DDevice9_BeginStateBlock(p)						(p)->lpVtbl->BeginStateBlock(p)
+#define IDirect3DDevice9_EndStateBlock(p,a)						(p)->lpVtbl->EndStateBlock(p,a)
+#define IDirect3DDevice9_SetClipStatus(p,a)						(p)->lpVtbl->SetClipStatus(p,a)
+#define IDirect3DDevice9_GetClipStatus(p,a)						(p)->lpVtbl->GetClipStatus(p,a)
+#define IDirect3DDevice9_GetTexture(p,a,b)						(p)->lpVtbl->GetTexture(p,a,b)
+#define IDirect3DDevice9_SetTexture(p,a,b)						(p)->lpVtbl->SetTexture(p,a,b)
+#define IDirect3DDevice9_GetTextureStageState(p,a,b,c)			(p)->lpVtbl->GetTextureStageState(p,a,b,c)
+#define IDirect3DDevice9_SetTextureStageState(p,a,b,c)			(p)->lpVtbl->SetTextureStageState(p,a,b,c)
+#define IDirect3DDevice9_GetSamplerState(p,a,b,c)				(p)->lpVtbl->GetSamplerState(p,a,b,c)
+#define IDirect3DDevice9_SetSamplerState(p,a,b,c)				(p)->lpVtbl->SetSamplerState(p,a,b,c)
+#define IDirect3DDevice9_ValidateDevice(p,a)					(p)->lpVtbl->ValidateDevice(p,a)
+#define IDirect3DDevice9_SetPaletteEntries(p,a,b)				(p)->lpVtbl->SetPaletteEntries(p,a,b)
+#define IDirect3DDevice9_GetPaletteEntries(p,a,b)				(p)->lpVtbl->GetPaletteEntries(p,a,b)
+#define IDirect3DDevice9_SetCurrentTexturePalette(p,a)			(p)->lpVtbl->SetCurrentTexturePalette(p,a)
+#define IDirect3DDevice9_GetCurrentTexturePalette(p,a)			(p)->lpVtbl->GetCurrentTexturePalette(p,a)
+#define IDirect3DDevice9_SetScissorRect(p,a)					(p)->lpVtbl->SetScissorRect(p,a)
+#define IDirect3DDevice9_GetScissorRect(p,a)					(p)->lpVtbl->GetScissorRect(p,a)
+#define IDirect3DDevice9_SetSoftwareVertexProcessing(p,a)		(p)->lpVtbl->SetSoftwareVertexProcessing(p,a)
+#define IDirect3DDevice9_GetSoftwareVertexProcessing(p)			(p)->lpVtbl->GetSoftwareVertexProcessing(p)
+#define IDirect3DDevice9_SetNPatchMode(p,a)						(p)->lpVtbl->SetNPatchMode(p,a)
+#define IDirect3DDevice9_GetNPatchMode(p)						(p)->lpVtbl->GetNPatchMode(p)
+#define IDirect3DDevice9_DrawPrimitive(p,a,b,c)					(p)->lpVtbl->DrawPrimitive(p,a,b,c)
+#define IDirect3DDevice9_DrawIndexedPrimitive(p,a,b,c,d,e,f)	(p)->lpVtbl->DrawIndexedPrimitive(p,a,b,c,d,e,f)
+#define IDirect3DDevice9_DrawPrimitiveUP(p,a,b,c,d)				(p)->lpVtbl->DrawPrimitiveUP(p,a,b,c,d)
+#define IDirect3DDevice9_DrawIndexedPrimitiveUP(p,a,b,c,d,e,f,g,h)	(p)->lpVtbl->DrawIndexedPrimitiveUP(p,a,b,c,d,e,f,g,h)
+#define IDirect3DDevice9_ProcessVertices(p,a,b,c,d,e,f)			(p)->lpVtbl->ProcessVertices(p,a,b,c,d,e,f)
+#define IDirect3DDevice9_CreateVertexDeclaration(p,a,b)			(p)->lpVtbl->CreateVertexDeclaration(p,a,b)
+#define IDirect3DDevice9_SetVertexDeclaration(p,a)				(p)->lpVtbl->SetVertexDeclaration(p,a)
+#define IDirect3DDevice9_GetVertexDeclaration(p,a)				(p)->lpVtbl->GetVertexDeclaration(p,a)
+#define IDirect3DDevice9_SetFVF(p,a)							(p)->lpVtbl->SetFVF(p,a)
+#define IDirect3DDevice9_GetFVF(p,a)							(p)->lpVtbl->GetFVF(p,a)
+#define IDirect3DDevice9_CreateVertexShader(p,a,b)				(p)->lpVtbl->CreateVertexShader(p,a,b)
+#define IDirect3DDevice9_SetVertexShader(p,a)					(p)->lpVtbl->SetVertexShader(p,a)
+#define IDirect3DDevice9_GetVertexShader(p,a)					(p)->lpVtbl->GetVertexShader(p,a)
+#define IDirect3DDevice9_SetVertexShaderConstantF(p,a,b,c)		(p)->lpVtbl->SetVertexShaderConstantF(p,a,b,c)
+#define IDirect3DDevice9_GetVertexShaderConstantF(p,a,b,c)		(p)->lpVtbl->GetVertexShaderConstantF(p,a,b,c)
+#define IDirect3DDevice9_SetVertexShaderConstantI(p,a,b,c)		(p)->lpVtbl->SetVertexShaderConstantI(p,a,b,c)
+#define IDirect3DDevice9_GetVertexShaderConstantI(p,a,b,c)		(p)->lpVtbl->GetVertexShaderConstantI(p,a,b,c)
+#define IDirect3DDevice9_SetVertexShaderConstantB(p,a,b,c)		(p)->lpVtbl->SetVertexShaderConstantB(p,a,b,c)
+#define IDirect3DDevice9_GetVertexShaderConstantB(p,a,b,c)		(p)->lpVtbl->GetVertexShaderConstantB(p,a,b,c)
+#define IDirect3DDevice9_SetStreamSource(p,a,b,c,d)				(p)->lpVtbl->SetStreamSource(p,a,b,c,d)
+#define IDirect3DDevice9_GetStreamSource(p,a,b,c,d)				(p)->lpVtbl->GetStreamSource(p,a,b,c,d)
+#define IDirect3DDevice9_SetStreamSourceFreq(p,a,b)				(p)->lpVtbl->SetStreamSourceFreq(p,a,b)
+#define IDirect3DDevice9_GetStreamSourceFreq(p,a,b)				(p)->lpVtbl->GetStreamSourceFreq(p,a,b)
+#define IDirect3DDevice9_SetIndices(p,a)						(p)->lpVtbl->SetIndices(p,a)
+#define IDirect3DDevice9_GetIndices(p,a)						(p)->lpVtbl->GetIndices(p,a)
+#define IDirect3DDevice9_CreatePixelShader(p,a,b)				(p)->lpVtbl->CreatePixelShader(p,a,b)
+#define IDirect3DDevice9_SetPixelShader(p,a)					(p)->lpVtbl->SetPixelShader(p,a)
+#define IDirect3DDevice9_GetPixelShader(p,a)					(p)->lpVtbl->GetPixelShader(p,a)
+#define IDirect3DDevice9_SetPixelShaderConstantF(p,a,b,c)		(p)->lpVtbl->SetPixelShaderConstantF(p,a,b,c)
+#define IDirect3DDevice9_GetPixelShaderConstantF(p,a,b,c)		(p)->lpVtbl->GetPixelShaderConstantF(p,a,b,c)
+#define IDirect3DDevice9_SetPixelShaderConstantI(p,a,b,c)		(p)->lpVtbl->SetPixelShaderConstantI(p,a,b,c)
+#define IDirect3DDevice9_GetPixelShaderConstantI(p,a,b,c)		(p)->lpVtbl->GetPixelShaderConstantI(p,a,b,c)
+#define IDirect3DDevice9_SetPixelShaderConstantB(p,a,b,c)		(p)->lpVtbl->SetPixelShaderConstantB(p,a,b,c)
+#define IDirect3DDevice9_GetPixelShaderConstantB(p,a,b,c)		(p)->lpVtbl->GetPixelShaderConstantB(p,a,b,c)
+#define IDirect3DDevice9_DrawRectPatch(p,a,b,c)					(p)->lpVtbl->DrawRectPatch(p,a,b,c)
+#define IDirect3DDevice9_DrawTriPatch(p,a,b,c)					(p)->lpVtbl->DrawTriPatch(p,a,b,c)
+#define IDirect3DDevice9_DeletePatch(p,a)						(p)->lpVtbl->DeletePatch(p,a)
+#define IDirect3DDevice9_CreateQuery(p,a,b)						(p)->lpVtbl->CreateQuery(p,a,b)
+
+typedef struct IDirect3DStateBlock9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DStateBlock9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DStateBlock9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DStateBlock9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DStateBlock9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *Capture)(IDirect3DStateBlock9 *This);
+	HRESULT				(STDMETHODCALLTYPE *Apply)(IDirect3DStateBlock9 *This);
+} IDirect3DStateBlock9Vtbl;
+
+struct IDirect3DStateBlock9 {
+	IDirect3DStateBlock9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DStateBlock9_QueryInterface(p,a,b)				(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DStateBlock9_AddRef(p)							(p)->lpVtbl->AddRef(p)
+#define IDirect3DStateBlock9_Release(p)							(p)->lpVtbl->Release(p)
+#define IDirect3DStateBlock9_GetDevice(p,a)						(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DStateBlock9_Capture(p)							(p)->lpVtbl->Capture(p)
+#define IDirect3DStateBlock9_Apply(p)							(p)->lpVtbl->Apply(p)
+
+typedef struct IDirect3DSwapChain9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DSwapChain9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DSwapChain9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DSwapChain9 *This);
+	HRESULT				(STDMETHODCALLTYPE *Present)(IDirect3DSwapChain9 *This, const RECT *pSourceRect, const RECT *pDestRect, HWND hDestWindowOverride, const RGNDATA *pDirtyRegion, DWORD dwFlags);
+	HRESULT				(STDMETHODCALLTYPE *GetFrontBufferData)(IDirect3DSwapChain9 *This, IDirect3DSurface9 *pDestSurface);
+	HRESULT				(STDMETHODCALLTYPE *GetBackBuffer)(IDirect3DSwapChain9 *This, UINT iBackBuffer, D3DBACKBUFFER_TYPE Type, IDirect3DSurface9 **ppBackBuffer);
+	HRESULT				(STDMETHODCALLTYPE *GetRasterStatus)(IDirect3DSwapChain9 *This, D3DRASTER_STATUS *pRasterStatus);
+	HRESULT				(STDMETHODCALLTYPE *GetDisplayMode)(IDirect3DSwapChain9 *This, D3DDISPLAYMODE *pMode);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DSwapChain9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *GetPresentParameters)(IDirect3DSwapChain9 *This, D3DPRESENT_PARAMETERS *pPresentationParameters);
+} IDirect3DSwapChain9Vtbl;
+
+struct IDirect3DSwapChain9 {
+	IDirect3DSwapChain9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DSwapChain9_QueryInterface(p,a,b)				(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DSwapChain9_AddRef(p)							(p)->lpVtbl->AddRef(p)
+#define IDirect3DSwapChain9_Release(p)							(p)->lpVtbl->Release(p)
+#define IDirect3DSwapChain9_Present(p,a,b,c,d,e)				(p)->lpVtbl->Present(p,a,b,c,d,e)
+#define IDirect3DSwapChain9_GetFrontBufferData(p,a)				(p)->lpVtbl->GetFrontBufferData(p,a)
+#define IDirect3DSwapChain9_GetBackBuffer(p,a,b,c)				(p)->lpVtbl->GetBackBuffer(p,a,b,c)
+#define IDirect3DSwapChain9_GetRasterStatus(p,a)				(p)->lpVtbl->GetRasterStatus(p,a)
+#define IDirect3DSwapChain9_GetDisplayMode(p,a)					(p)->lpVtbl->GetDisplayMode(p,a)
+#define IDirect3DSwapChain9_GetDevice(p,a)						(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DSwapChain9_GetPresentParameters(p,a)			(p)->lpVtbl->GetPresentParameters(p,a)
+
+typedef struct IDirect3DResource9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DResource9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DResource9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DResource9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DResource9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *SetPrivateData)(IDirect3DResource9 *This, REFGUID refguid, const void *pData, DWORD SizeOfData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *GetPrivateData)(IDirect3DResource9 *This, REFGUID refguid, void *pData, DWORD *pSizeOfData);
+	HRESULT				(STDMETHODCALLTYPE *FreePrivateData)(IDirect3DResource9 *This, REFGUID refguid);
+	DWORD				(STDMETHODCALLTYPE *SetPriority)(IDirect3DResource9 *This, DWORD PriorityNew);
+	DWORD				(STDMETHODCALLTYPE *GetPriority)(IDirect3DResource9 *This);
+	void				(STDMETHODCALLTYPE *PreLoad)(IDirect3DResource9 *This);
+	D3DRESOURCETYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DResource9 *This);
+} IDirect3DResource9Vtbl;
+
+struct IDirect3DResource9 {
+	IDirect3DResource9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DResource9_QueryInterface(p,a,b)				(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DResource9_AddRef(p)							(p)->lpVtbl->AddRef(p)
+#define IDirect3DResource9_Release(p)							(p)->lpVtbl->Release(p)
+#define IDirect3DResource9_GetDevice(p,a)						(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DResource9_SetPrivateData(p,a,b,c,d)			(p)->lpVtbl->SetPrivateData(p,a,b,c,d)
+#define IDirect3DResource9_GetPrivateData(p,a,b,c)				(p)->lpVtbl->GetPrivateData(p,a,b,c)
+#define IDirect3DResource9_FreePrivateData(p,a)					(p)->lpVtbl->FreePrivateData(p,a)
+#define IDirect3DResource9_SetPriority(p,a)						(p)->lpVtbl->SetPriority(p,a)
+#define IDirect3DResource9_GetPriority(p)						(p)->lpVtbl->GetPriority(p)
+#define IDirect3DResource9_PreLoad(p)							(p)->lpVtbl->PreLoad(p)
+#define IDirect3DResource9_GetType(p)							(p)->lpVtbl->GetType(p)
+
+typedef struct IDirect3DVertexDeclaration9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DVertexDeclaration9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DVertexDeclaration9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DVertexDeclaration9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DVertexDeclaration9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *GetDeclaration)(IDirect3DVertexDeclaration9 *This, D3DVERTEXELEMENT9 *pElement, UINT *pNumElements);
+} IDirect3DVertexDeclaration9Vtbl;
+
+struct IDirect3DVertexDeclaration9 {
+	IDirect3DVertexDeclaration9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DVertexDeclaration9_QueryInterface(p,a,b)		(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DVertexDeclaration9_AddRef(p)					(p)->lpVtbl->AddRef(p)
+#define IDirect3DVertexDeclaration9_Release(p)					(p)->lpVtbl->Release(p)
+#define IDirect3DVertexDeclaration9_GetDevice(p,a)				(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DVertexDeclaration9_GetDeclaration(p,a,b)		(p)->lpVtbl->GetDeclaration(p,a,b)
+
+typedef struct IDirect3DVertexShader9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DVertexShader9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DVertexShader9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DVertexShader9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DVertexShader9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *GetFunction)(IDirect3DVertexShader9 *This, void *pData, UINT *pSizeOfData);
+} IDirect3DVertexShader9Vtbl;
+
+struct IDirect3DVertexShader9 {
+	IDirect3DVertexShader9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DVertexShader9_QueryInterface(p,a,b)			(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DVertexShader9_AddRef(p)						(p)->lpVtbl->AddRef(p)
+#define IDirect3DVertexShader9_Release(p)						(p)->lpVtbl->Release(p)
+#define IDirect3DVertexShader9_GetDevice(p,a)					(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DVertexShader9_GetFunction(p,a,b)				(p)->lpVtbl->GetFunction(p,a,b)
+
+typedef struct IDirect3DPixelShader9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DPixelShader9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DPixelShader9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DPixelShader9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DPixelShader9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *GetFunction)(IDirect3DPixelShader9 *This, void *pData, UINT *pSizeOfData);
+} IDirect3DPixelShader9Vtbl;
+
+struct IDirect3DPixelShader9 {
+	IDirect3DPixelShader9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DPixelShader9_QueryInterface(p,a,b)				(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DPixelShader9_AddRef(p)							(p)->lpVtbl->AddRef(p)
+#define IDirect3DPixelShader9_Release(p)						(p)->lpVtbl->Release(p)
+#define IDirect3DPixelShader9_GetDevice(p,a)					(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DPixelShader9_GetFunction(p,a,b)				(p)->lpVtbl->GetFunction(p,a,b)
+
+typedef struct IDirect3DBaseTexture9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DBaseTexture9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DBaseTexture9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DBaseTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DBaseTexture9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *SetPrivateData)(IDirect3DBaseTexture9 *This, REFGUID refguid, const void *pData, DWORD SizeOfData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *GetPrivateData)(IDirect3DBaseTexture9 *This, REFGUID refguid, void *pData, DWORD *pSizeOfData);
+	HRESULT				(STDMETHODCALLTYPE *FreePrivateData)(IDirect3DBaseTexture9 *This, REFGUID refguid);
+	DWORD				(STDMETHODCALLTYPE *SetPriority)(IDirect3DBaseTexture9 *This, DWORD PriorityNew);
+	DWORD				(STDMETHODCALLTYPE *GetPriority)(IDirect3DBaseTexture9 *This);
+	void				(STDMETHODCALLTYPE *PreLoad)(IDirect3DBaseTexture9 *This);
+	D3DRESOURCETYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DBaseTexture9 *This);
+	DWORD				(STDMETHODCALLTYPE *SetLOD)(IDirect3DBaseTexture9 *This, DWORD LODNew);
+	DWORD				(STDMETHODCALLTYPE *GetLOD)(IDirect3DBaseTexture9 *This);
+	DWORD				(STDMETHODCALLTYPE *GetLevelCount)(IDirect3DBaseTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *SetAutoGenFilterType)(IDirect3DBaseTexture9 *This, D3DTEXTUREFILTERTYPE FilterType);
+	D3DTEXTUREFILTERTYPE	(STDMETHODCALLTYPE *GetAutoGenFilterType)(IDirect3DBaseTexture9 *This);
+	void				(STDMETHODCALLTYPE *GenerateMipSubLevels)(IDirect3DBaseTexture9 *This);
+} IDirect3DBaseTexture9Vtbl;
+
+struct IDirect3DBaseTexture9 {
+	IDirect3DBaseTexture9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DBaseTexture9_QueryInterface(p,a,b)				(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DBaseTexture9_AddRef(p)							(p)->lpVtbl->AddRef(p)
+#define IDirect3DBaseTexture9_Release(p)						(p)->lpVtbl->Release(p)
+#define IDirect3DBaseTexture9_GetDevice(p,a)					(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DBaseTexture9_SetPrivateData(p,a,b,c,d)			(p)->lpVtbl->SetPrivateData(p,a,b,c,d)
+#define IDirect3DBaseTexture9_GetPrivateData(p,a,b,c)			(p)->lpVtbl->GetPrivateData(p,a,b,c)
+#define IDirect3DBaseTexture9_FreePrivateData(p,a)				(p)->lpVtbl->FreePrivateData(p,a)
+#define IDirect3DBaseTexture9_SetPriority(p,a)					(p)->lpVtbl->SetPriority(p,a)
+#define IDirect3DBaseTexture9_GetPriority(p)					(p)->lpVtbl->GetPriority(p)
+#define IDirect3DBaseTexture9_PreLoad(p)						(p)->lpVtbl->PreLoad(p)
+#define IDirect3DBaseTexture9_GetType(p)						(p)->lpVtbl->GetType(p)
+#define IDirect3DBaseTexture9_SetLOD(p,a)						(p)->lpVtbl->SetLOD(p,a)
+#define IDirect3DBaseTexture9_GetLOD(p)							(p)->lpVtbl->GetLOD(p)
+#define IDirect3DBaseTexture9_GetLevelCount(p)					(p)->lpVtbl->GetLevelCount(p)
+#define IDirect3DBaseTexture9_SetAutoGenFilterType(p,a)			(p)->lpVtbl->SetAutoGenFilterType(p,a)
+#define IDirect3DBaseTexture9_GetAutoGenFilterType(p)			(p)->lpVtbl->GetAutoGenFilterType(p)
+#define IDirect3DBaseTexture9_GenerateMipSubLevels(p)			(p)->lpVtbl->GenerateMipSubLevels(p)
+
+typedef struct IDirect3DTexture9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DTexture9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DTexture9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DTexture9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *SetPrivateData)(IDirect3DTexture9 *This, REFGUID refguid, const void *pData, DWORD SizeOfData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *GetPrivateData)(IDirect3DTexture9 *This, REFGUID refguid, void *pData, DWORD *pSizeOfData);
+	HRESULT				(STDMETHODCALLTYPE *FreePrivateData)(IDirect3DTexture9 *This, REFGUID refguid);
+	DWORD				(STDMETHODCALLTYPE *SetPriority)(IDirect3DTexture9 *This, DWORD PriorityNew);
+	DWORD				(STDMETHODCALLTYPE *GetPriority)(IDirect3DTexture9 *This);
+	void				(STDMETHODCALLTYPE *PreLoad)(IDirect3DTexture9 *This);
+	D3DRESOURCETYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DTexture9 *This);
+	DWORD				(STDMETHODCALLTYPE *SetLOD)(IDirect3DTexture9 *This, DWORD LODNew);
+	DWORD				(STDMETHODCALLTYPE *GetLOD)(IDirect3DTexture9 *This);
+	DWORD				(STDMETHODCALLTYPE *GetLevelCount)(IDirect3DTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *SetAutoGenFilterType)(IDirect3DTexture9 *This, D3DTEXTUREFILTERTYPE FilterType);
+	D3DTEXTUREFILTERTYPE	(STDMETHODCALLTYPE *GetAutoGenFilterType)(IDirect3DTexture9 *This);
+	void				(STDMETHODCALLTYPE *GenerateMipSubLevels)(IDirect3DTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetLevelDesc)(IDirect3DTexture9 *This, UINT Level, D3DSURFACE_DESC *pDesc);
+	HRESULT				(STDMETHODCALLTYPE *GetSurfaceLevel)(IDirect3DTexture9 *This, UINT Level, IDirect3DSurface9 **ppSurfaceLevel);
+	HRESULT				(STDMETHODCALLTYPE *LockRect)(IDirect3DTexture9 *This, UINT Level, D3DLOCKED_RECT *pLockedRect, const RECT *pRect, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *UnlockRect)(IDirect3DTexture9 *This, UINT Level);
+	HRESULT				(STDMETHODCALLTYPE *AddDirtyRect)(IDirect3DTexture9 *This, const RECT *pDirtyRect);
+} IDirect3DTexture9Vtbl;
+
+struct IDirect3DTexture9 {
+	IDirect3DTexture9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DTexture9_QueryInterface(p,a,b)					(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DTexture9_AddRef(p)								(p)->lpVtbl->AddRef(p)
+#define IDirect3DTexture9_Release(p)							(p)->lpVtbl->Release(p)
+#define IDirect3DTexture9_GetDevice(p,a)						(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DTexture9_SetPrivateData(p,a,b,c,d)				(p)->lpVtbl->SetPrivateData(p,a,b,c,d)
+#define IDirect3DTexture9_GetPrivateData(p,a,b,c)				(p)->lpVtbl->GetPrivateData(p,a,b,c)
+#define IDirect3DTexture9_FreePrivateData(p,a)					(p)->lpVtbl->FreePrivateData(p,a)
+#define IDirect3DTexture9_SetPriority(p,a)						(p)->lpVtbl->SetPriority(p,a)
+#define IDirect3DTexture9_GetPriority(p)						(p)->lpVtbl->GetPriority(p)
+#define IDirect3DTexture9_PreLoad(p)							(p)->lpVtbl->PreLoad(p)
+#define IDirect3DTexture9_GetType(p)							(p)->lpVtbl->GetType(p)
+#define IDirect3DTexture9_SetLOD(p,a)							(p)->lpVtbl->SetLOD(p,a)
+#define IDirect3DTexture9_GetLOD(p)								(p)->lpVtbl->GetLOD(p)
+#define IDirect3DTexture9_GetLevelCount(p)						(p)->lpVtbl->GetLevelCount(p)
+#define IDirect3DTexture9_SetAutoGenFilterType(p,a)				(p)->lpVtbl->SetAutoGenFilterType(p,a)
+#define IDirect3DTexture9_GetAutoGenFilterType(p)				(p)->lpVtbl->GetAutoGenFilterType(p)
+#define IDirect3DTexture9_GenerateMipSubLevels(p)				(p)->lpVtbl->GenerateMipSubLevels(p)
+#define IDirect3DTexture9_GetLevelDesc(p,a,b)					(p)->lpVtbl->GetLevelDesc(p,a,b)
+#define IDirect3DTexture9_GetSurfaceLevel(p,a,b)				(p)->lpVtbl->GetSurfaceLevel(p,a,b)
+#define IDirect3DTexture9_LockRect(p,a,b,c,d)					(p)->lpVtbl->LockRect(p,a,b,c,d)
+#define IDirect3DTexture9_UnlockRect(p,a)						(p)->lpVtbl->UnlockRect(p,a)
+#define IDirect3DTexture9_AddDirtyRect(p,a)						(p)->lpVtbl->AddDirtyRect(p,a)
+
+typedef struct IDirect3DVolumeTexture9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DVolumeTexture9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DVolumeTexture9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DVolumeTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DVolumeTexture9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *SetPrivateData)(IDirect3DVolumeTexture9 *This, REFGUID refguid, const void *pData, DWORD SizeOfData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *GetPrivateData)(IDirect3DVolumeTexture9 *This, REFGUID refguid, void *pData, DWORD *pSizeOfData);
+	HRESULT				(STDMETHODCALLTYPE *FreePrivateData)(IDirect3DVolumeTexture9 *This, REFGUID refguid);
+	DWORD				(STDMETHODCALLTYPE *SetPriority)(IDirect3DVolumeTexture9 *This, DWORD PriorityNew);
+	DWORD				(STDMETHODCALLTYPE *GetPriority)(IDirect3DVolumeTexture9 *This);
+	void				(STDMETHODCALLTYPE *PreLoad)(IDirect3DVolumeTexture9 *This);
+	D3DRESOURCETYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DVolumeTexture9 *This);
+	DWORD				(STDMETHODCALLTYPE *SetLOD)(IDirect3DVolumeTexture9 *This, DWORD LODNew);
+	DWORD				(STDMETHODCALLTYPE *GetLOD)(IDirect3DVolumeTexture9 *This);
+	DWORD				(STDMETHODCALLTYPE *GetLevelCount)(IDirect3DVolumeTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *SetAutoGenFilterType)(IDirect3DVolumeTexture9 *This, D3DTEXTUREFILTERTYPE FilterType);
+	D3DTEXTUREFILTERTYPE	(STDMETHODCALLTYPE *GetAutoGenFilterType)(IDirect3DVolumeTexture9 *This);
+	void				(STDMETHODCALLTYPE *GenerateMipSubLevels)(IDirect3DVolumeTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetLevelDesc)(IDirect3DVolumeTexture9 *This, UINT Level, D3DVOLUME_DESC *pDesc);
+	HRESULT				(STDMETHODCALLTYPE *GetVolumeLevel)(IDirect3DVolumeTexture9 *This, UINT Level, void **ppVolumeLevel);
+	HRESULT				(STDMETHODCALLTYPE *LockBox)(IDirect3DVolumeTexture9 *This, UINT Level, D3DLOCKED_BOX *pLockedVolume, const D3DBOX *pBox, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *UnlockBox)(IDirect3DVolumeTexture9 *This, UINT Level);
+	HRESULT				(STDMETHODCALLTYPE *AddDirtyBox)(IDirect3DVolumeTexture9 *This, const D3DBOX *pDirtyBox);
+} IDirect3DVolumeTexture9Vtbl;
+
+struct IDirect3DVolumeTexture9 {
+	IDirect3DVolumeTexture9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DVolumeTexture9_QueryInterface(p,a,b)			(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DVolumeTexture9_AddRef(p)						(p)->lpVtbl->AddRef(p)
+#define IDirect3DVolumeTexture9_Release(p)						(p)->lpVtbl->Release(p)
+#define IDirect3DVolumeTexture9_GetDevice(p,a)					(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DVolumeTexture9_SetPrivateData(p,a,b,c,d)		(p)->lpVtbl->SetPrivateData(p,a,b,c,d)
+#define IDirect3DVolumeTexture9_GetPrivateData(p,a,b,c)			(p)->lpVtbl->GetPrivateData(p,a,b,c)
+#define IDirect3DVolumeTexture9_FreePrivateData(p,a)			(p)->lpVtbl->FreePrivateData(p,a)
+#define IDirect3DVolumeTexture9_SetPriority(p,a)				(p)->lpVtbl->SetPriority(p,a)
+#define IDirect3DVolumeTexture9_GetPriority(p)					(p)->lpVtbl->GetPriority(p)
+#define IDirect3DVolumeTexture9_PreLoad(p)						(p)->lpVtbl->PreLoad(p)
+#define IDirect3DVolumeTexture9_GetType(p)						(p)->lpVtbl->GetType(p)
+#define IDirect3DVolumeTexture9_SetLOD(p,a)						(p)->lpVtbl->SetLOD(p,a)
+#define IDirect3DVolumeTexture9_GetLOD(p)						(p)->lpVtbl->GetLOD(p)
+#define IDirect3DVolumeTexture9_GetLevelCount(p)				(p)->lpVtbl->GetLevelCount(p)
+#define IDirect3DVolumeTexture9_SetAutoGenFilterType(p,a)		(p)->lpVtbl->SetAutoGenFilterType(p,a)
+#define IDirect3DVolumeTexture9_GetAutoGenFilterType(p)			(p)->lpVtbl->GetAutoGenFilterType(p)
+#define IDirect3DVolumeTexture9_GenerateMipSubLevels(p)			(p)->lpVtbl->GenerateMipSubLevels(p)
+#define IDirect3DVolumeTexture9_GetLevelDesc(p,a,b)				(p)->lpVtbl->GetLevelDesc(p,a,b)
+#define IDirect3DVolumeTexture9_GetVolumeLevel(p,a,b)			(p)->lpVtbl->GetVolumeLevel(p,a,b)
+#define IDirect3DVolumeTexture9_LockBox(p,a,b,c,d)				(p)->lpVtbl->LockBox(p,a,b,c,d)
+#define IDirect3DVolumeTexture9_UnlockBox(p,a)					(p)->lpVtbl->UnlockBox(p,a)
+#define IDirect3DVolumeTexture9_AddDirtyBox(p,a)				(p)->lpVtbl->AddDirtyBox(p,a)
+
+typedef struct IDirect3DCubeTexture9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DCubeTexture9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DCubeTexture9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DCubeTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DCubeTexture9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *SetPrivateData)(IDirect3DCubeTexture9 *This, REFGUID refguid, const void *pData, DWORD SizeOfData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *GetPrivateData)(IDirect3DCubeTexture9 *This, REFGUID refguid, void *pData, DWORD *pSizeOfData);
+	HRESULT				(STDMETHODCALLTYPE *FreePrivateData)(IDirect3DCubeTexture9 *This, REFGUID refguid);
+	DWORD				(STDMETHODCALLTYPE *SetPriority)(IDirect3DCubeTexture9 *This, DWORD PriorityNew);
+	DWORD				(STDMETHODCALLTYPE *GetPriority)(IDirect3DCubeTexture9 *This);
+	void				(STDMETHODCALLTYPE *PreLoad)(IDirect3DCubeTexture9 *This);
+	D3DRESOURCETYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DCubeTexture9 *This);
+	DWORD				(STDMETHODCALLTYPE *SetLOD)(IDirect3DCubeTexture9 *This, DWORD LODNew);
+	DWORD				(STDMETHODCALLTYPE *GetLOD)(IDirect3DCubeTexture9 *This);
+	DWORD				(STDMETHODCALLTYPE *GetLevelCount)(IDirect3DCubeTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *SetAutoGenFilterType)(IDirect3DCubeTexture9 *This, D3DTEXTUREFILTERTYPE FilterType);
+	D3DTEXTUREFILTERTYPE	(STDMETHODCALLTYPE *GetAutoGenFilterType)(IDirect3DCubeTexture9 *This);
+	void				(STDMETHODCALLTYPE *GenerateMipSubLevels)(IDirect3DCubeTexture9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetLevelDesc)(IDirect3DCubeTexture9 *This, UINT Level, D3DSURFACE_DESC *pDesc);
+	HRESULT				(STDMETHODCALLTYPE *GetCubeMapSurface)(IDirect3DCubeTexture9 *This, D3DCUBEMAP_FACES FaceType, UINT Level, IDirect3DSurface9 **ppCubeMapSurface);
+	HRESULT				(STDMETHODCALLTYPE *LockRect)(IDirect3DCubeTexture9 *This, D3DCUBEMAP_FACES FaceType, UINT Level, D3DLOCKED_RECT *pLockedRect, const RECT *pRect, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *UnlockRect)(IDirect3DCubeTexture9 *This, D3DCUBEMAP_FACES FaceType, UINT Level);
+	HRESULT				(STDMETHODCALLTYPE *AddDirtyRect)(IDirect3DCubeTexture9 *This, D3DCUBEMAP_FACES FaceType, const RECT *pDirtyRect);
+} IDirect3DCubeTexture9Vtbl;
+
+struct IDirect3DCubeTexture9 {
+	IDirect3DCubeTexture9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DCubeTexture9_QueryInterface(p,a,b)				(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DCubeTexture9_AddRef(p)							(p)->lpVtbl->AddRef(p)
+#define IDirect3DCubeTexture9_Release(p)						(p)->lpVtbl->Release(p)
+#define IDirect3DCubeTexture9_GetDevice(p,a)					(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DCubeTexture9_SetPrivateData(p,a,b,c,d)			(p)->lpVtbl->SetPrivateData(p,a,b,c,d)
+#define IDirect3DCubeTexture9_GetPrivateData(p,a,b,c)			(p)->lpVtbl->GetPrivateData(p,a,b,c)
+#define IDirect3DCubeTexture9_FreePrivateData(p,a)				(p)->lpVtbl->FreePrivateData(p,a)
+#define IDirect3DCubeTexture9_SetPriority(p,a)					(p)->lpVtbl->SetPriority(p,a)
+#define IDirect3DCubeTexture9_GetPriority(p)					(p)->lpVtbl->GetPriority(p)
+#define IDirect3DCubeTexture9_PreLoad(p)						(p)->lpVtbl->PreLoad(p)
+#define IDirect3DCubeTexture9_GetType(p)						(p)->lpVtbl->GetType(p)
+#define IDirect3DCubeTexture9_SetLOD(p,a)						(p)->lpVtbl->SetLOD(p,a)
+#define IDirect3DCubeTexture9_GetLOD(p)							(p)->lpVtbl->GetLOD(p)
+#define IDirect3DCubeTexture9_GetLevelCount(p)					(p)->lpVtbl->GetLevelCount(p)
+#define IDirect3DCubeTexture9_SetAutoGenFilterType(p,a)			(p)->lpVtbl->SetAutoGenFilterType(p,a)
+#define IDirect3DCubeTexture9_GetAutoGenFilterType(p)			(p)->lpVtbl->GetAutoGenFilterType(p)
+#define IDirect3DCubeTexture9_GenerateMipSubLevels(p)			(p)->lpVtbl->GenerateMipSubLevels(p)
+#define IDirect3DCubeTexture9_GetLevelDesc(p,a,b)				(p)->lpVtbl->GetLevelDesc(p,a,b)
+#define IDirect3DCubeTexture9_GetCubeMapSurface(p,a,b,c)		(p)->lpVtbl->GetCubeMapSurface(p,a,b,c)
+#define IDirect3DCubeTexture9_LockRect(p,a,b,c,d,e)				(p)->lpVtbl->LockRect(p,a,b,c,d,e)
+#define IDirect3DCubeTexture9_UnlockRect(p,a,b)					(p)->lpVtbl->UnlockRect(p,a,b)
+#define IDirect3DCubeTexture9_AddDirtyRect(p,a,b)				(p)->lpVtbl->AddDirtyRect(p,a,b)
+
+typedef struct IDirect3DVertexBuffer9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DVertexBuffer9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DVertexBuffer9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DVertexBuffer9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DVertexBuffer9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *SetPrivateData)(IDirect3DVertexBuffer9 *This, REFGUID refguid, const void *pData, DWORD SizeOfData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *GetPrivateData)(IDirect3DVertexBuffer9 *This, REFGUID refguid, void *pData, DWORD *pSizeOfData);
+	HRESULT				(STDMETHODCALLTYPE *FreePrivateData)(IDirect3DVertexBuffer9 *This, REFGUID refguid);
+	DWORD				(STDMETHODCALLTYPE *SetPriority)(IDirect3DVertexBuffer9 *This, DWORD PriorityNew);
+	DWORD				(STDMETHODCALLTYPE *GetPriority)(IDirect3DVertexBuffer9 *This);
+	void				(STDMETHODCALLTYPE *PreLoad)(IDirect3DVertexBuffer9 *This);
+	D3DRESOURCETYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DVertexBuffer9 *This);
+	HRESULT				(STDMETHODCALLTYPE *Lock)(IDirect3DVertexBuffer9 *This, UINT OffsetToLock, UINT SizeToLock, void **ppbData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *Unlock)(IDirect3DVertexBuffer9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDesc)(IDirect3DVertexBuffer9 *This, D3DVERTEXBUFFER_DESC *pDesc);
+} IDirect3DVertexBuffer9Vtbl;
+
+struct IDirect3DVertexBuffer9 {
+	IDirect3DVertexBuffer9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DVertexBuffer9_QueryInterface(p,a,b)			(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DVertexBuffer9_AddRef(p)						(p)->lpVtbl->AddRef(p)
+#define IDirect3DVertexBuffer9_Release(p)						(p)->lpVtbl->Release(p)
+#define IDirect3DVertexBuffer9_GetDevice(p,a)					(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DVertexBuffer9_SetPrivateData(p,a,b,c,d)		(p)->lpVtbl->SetPrivateData(p,a,b,c,d)
+#define IDirect3DVertexBuffer9_GetPrivateData(p,a,b,c)			(p)->lpVtbl->GetPrivateData(p,a,b,c)
+#define IDirect3DVertexBuffer9_FreePrivateData(p,a)				(p)->lpVtbl->FreePrivateData(p,a)
+#define IDirect3DVertexBuffer9_SetPriority(p,a)					(p)->lpVtbl->SetPriority(p,a)
+#define IDirect3DVertexBuffer9_GetPriority(p)					(p)->lpVtbl->GetPriority(p)
+#define IDirect3DVertexBuffer9_PreLoad(p)						(p)->lpVtbl->PreLoad(p)
+#define IDirect3DVertexBuffer9_GetType(p)						(p)->lpVtbl->GetType(p)
+#define IDirect3DVertexBuffer9_Lock(p,a,b,c,d)					(p)->lpVtbl->Lock(p,a,b,c,d)
+#define IDirect3DVertexBuffer9_Unlock(p)						(p)->lpVtbl->Unlock(p)
+#define IDirect3DVertexBuffer9_GetDesc(p,a)						(p)->lpVtbl->GetDesc(p,a)
+
+typedef struct IDirect3DIndexBuffer9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DIndexBuffer9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DIndexBuffer9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DIndexBuffer9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DIndexBuffer9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *SetPrivateData)(IDirect3DIndexBuffer9 *This, REFGUID refguid, const void *pData, DWORD SizeOfData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *GetPrivateData)(IDirect3DIndexBuffer9 *This, REFGUID refguid, void *pData, DWORD *pSizeOfData);
+	HRESULT				(STDMETHODCALLTYPE *FreePrivateData)(IDirect3DIndexBuffer9 *This, REFGUID refguid);
+	DWORD				(STDMETHODCALLTYPE *SetPriority)(IDirect3DIndexBuffer9 *This, DWORD PriorityNew);
+	DWORD				(STDMETHODCALLTYPE *GetPriority)(IDirect3DIndexBuffer9 *This);
+	void				(STDMETHODCALLTYPE *PreLoad)(IDirect3DIndexBuffer9 *This);
+	D3DRESOURCETYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DIndexBuffer9 *This);
+	HRESULT				(STDMETHODCALLTYPE *Lock)(IDirect3DIndexBuffer9 *This, UINT OffsetToLock, UINT SizeToLock, void **ppbData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *Unlock)(IDirect3DIndexBuffer9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDesc)(IDirect3DIndexBuffer9 *This, D3DINDEXBUFFER_DESC *pDesc);
+} IDirect3DIndexBuffer9Vtbl;
+
+struct IDirect3DIndexBuffer9 {
+	IDirect3DIndexBuffer9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DIndexBuffer9_QueryInterface(p,a,b)				(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DIndexBuffer9_AddRef(p)							(p)->lpVtbl->AddRef(p)
+#define IDirect3DIndexBuffer9_Release(p)						(p)->lpVtbl->Release(p)
+#define IDirect3DIndexBuffer9_GetDevice(p,a)					(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DIndexBuffer9_SetPrivateData(p,a,b,c,d)			(p)->lpVtbl->SetPrivateData(p,a,b,c,d)
+#define IDirect3DIndexBuffer9_GetPrivateData(p,a,b,c)			(p)->lpVtbl->GetPrivateData(p,a,b,c)
+#define IDirect3DIndexBuffer9_FreePrivateData(p,a)				(p)->lpVtbl->FreePrivateData(p,a)
+#define IDirect3DIndexBuffer9_SetPriority(p,a)					(p)->lpVtbl->SetPriority(p,a)
+#define IDirect3DIndexBuffer9_GetPriority(p)					(p)->lpVtbl->GetPriority(p)
+#define IDirect3DIndexBuffer9_PreLoad(p)						(p)->lpVtbl->PreLoad(p)
+#define IDirect3DIndexBuffer9_GetType(p)						(p)->lpVtbl->GetType(p)
+#define IDirect3DIndexBuffer9_Lock(p,a,b,c,d)					(p)->lpVtbl->Lock(p,a,b,c,d)
+#define IDirect3DIndexBuffer9_Unlock(p)							(p)->lpVtbl->Unlock(p)
+#define IDirect3DIndexBuffer9_GetDesc(p,a)						(p)->lpVtbl->GetDesc(p,a)
+
+typedef struct IDirect3DSurface9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DSurface9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DSurface9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DSurface9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DSurface9 *This, IDirect3DDevice9 **ppDevice);
+	HRESULT				(STDMETHODCALLTYPE *SetPrivateData)(IDirect3DSurface9 *This, REFGUID refguid, const void *pData, DWORD SizeOfData, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *GetPrivateData)(IDirect3DSurface9 *This, REFGUID refguid, void *pData, DWORD *pSizeOfData);
+	HRESULT				(STDMETHODCALLTYPE *FreePrivateData)(IDirect3DSurface9 *This, REFGUID refguid);
+	DWORD				(STDMETHODCALLTYPE *SetPriority)(IDirect3DSurface9 *This, DWORD PriorityNew);
+	DWORD				(STDMETHODCALLTYPE *GetPriority)(IDirect3DSurface9 *This);
+	void				(STDMETHODCALLTYPE *PreLoad)(IDirect3DSurface9 *This);
+	D3DRESOURCETYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DSurface9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetContainer)(IDirect3DSurface9 *This, REFIID riid, void **ppContainer);
+	HRESULT				(STDMETHODCALLTYPE *GetDesc)(IDirect3DSurface9 *This, D3DSURFACE_DESC *pDesc);
+	HRESULT				(STDMETHODCALLTYPE *LockRect)(IDirect3DSurface9 *This, D3DLOCKED_RECT *pLockedRect, const RECT *pRect, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *UnlockRect)(IDirect3DSurface9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDC)(IDirect3DSurface9 *This, HDC *phdc);
+	HRESULT				(STDMETHODCALLTYPE *ReleaseDC)(IDirect3DSurface9 *This, HDC hdc);
+} IDirect3DSurface9Vtbl;
+
+struct IDirect3DSurface9 {
+	IDirect3DSurface9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DSurface9_QueryInterface(p,a,b)					(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DSurface9_AddRef(p)								(p)->lpVtbl->AddRef(p)
+#define IDirect3DSurface9_Release(p)							(p)->lpVtbl->Release(p)
+#define IDirect3DSurface9_GetDevice(p,a)						(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DSurface9_SetPrivateData(p,a,b,c,d)				(p)->lpVtbl->SetPrivateData(p,a,b,c,d)
+#define IDirect3DSurface9_GetPrivateData(p,a,b,c)				(p)->lpVtbl->GetPrivateData(p,a,b,c)
+#define IDirect3DSurface9_FreePrivateData(p,a)					(p)->lpVtbl->FreePrivateData(p,a)
+#define IDirect3DSurface9_SetPriority(p,a)						(p)->lpVtbl->SetPriority(p,a)
+#define IDirect3DSurface9_GetPriority(p)						(p)->lpVtbl->GetPriority(p)
+#define IDirect3DSurface9_PreLoad(p)							(p)->lpVtbl->PreLoad(p)
+#define IDirect3DSurface9_GetType(p)							(p)->lpVtbl->GetType(p)
+#define IDirect3DSurface9_GetContainer(p,a,b)					(p)->lpVtbl->GetContainer(p,a,b)
+#define IDirect3DSurface9_GetDesc(p,a)							(p)->lpVtbl->GetDesc(p,a)
+#define IDirect3DSurface9_LockRect(p,a,b,c)						(p)->lpVtbl->LockRect(p,a,b,c)
+#define IDirect3DSurface9_UnlockRect(p)							(p)->lpVtbl->UnlockRect(p)
+#define IDirect3DSurface9_GetDC(p,a)							(p)->lpVtbl->GetDC(p,a)
+#define IDirect3DSurface9_ReleaseDC(p,a)						(p)->lpVtbl->ReleaseDC(p,a)
+
+typedef struct IDirect3DQuery9Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IDirect3DQuery9 *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IDirect3DQuery9 *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IDirect3DQuery9 *This);
+	HRESULT				(STDMETHODCALLTYPE *GetDevice)(IDirect3DQuery9 *This, IDirect3DDevice9 **ppDevice);
+	D3DQUERYTYPE		(STDMETHODCALLTYPE *GetType)(IDirect3DQuery9 *This);
+	DWORD				(STDMETHODCALLTYPE *GetDataSize)(IDirect3DQuery9 *This);
+	HRESULT				(STDMETHODCALLTYPE *Issue)(IDirect3DQuery9 *This, DWORD dwIssueFlags);
+	HRESULT				(STDMETHODCALLTYPE *GetData)(IDirect3DQuery9 *This, void *pData, DWORD dwSize, DWORD dwGetDataFlags);
+} IDirect3DQuery9Vtbl;
+
+struct IDirect3DQuery9 {
+	IDirect3DQuery9Vtbl	*lpVtbl;
+};
+
+#define IDirect3DQuery9_QueryInterface(p,a,b)					(p)->lpVtbl->QueryInterface(p,a,b)
+#define IDirect3DQuery9_AddRef(p)								(p)->lpVtbl->AddRef(p)
+#define IDirect3DQuery9_Release(p)								(p)->lpVtbl->Release(p)
+#define IDirect3DQuery9_GetDevice(p,a)							(p)->lpVtbl->GetDevice(p,a)
+#define IDirect3DQuery9_GetType(p)								(p)->lpVtbl->GetType(p)
+#define IDirect3DQuery9_GetDataSize(p)							(p)->lpVtbl->GetDataSize(p)
+#define IDirect3DQuery9_Issue(p,a)								(p)->lpVtbl->Issue(p,a)
+#define IDirect3DQuery9_GetData(p,a,b,c)						(p)->lpVtbl->GetData(p,a,b,c)
+
+/*------------------------- Function Prototypes ---------------------------*/
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+IDirect3D9*	WINAPI Direct3DCreate9(UINT SDKVersion);
+int			WINAPI D3DPERF_BeginEvent(D3DCOLOR col, LPCWSTR wszName);
+int			WINAPI D3DPERF_EndEvent(void);
+void		WINAPI D3DPERF_SetMarker(D3DCOLOR col, LPCWSTR wszName);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
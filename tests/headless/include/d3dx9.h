@@ -0,0 +1,263 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  D3DX 9 declarations for the headless build, implemented by
+*               tests/headless/d3dx9.c.
+*
+*********************************************************************************/
+
+#ifndef __GLD_HEADLESS_D3DX9_H
+#define __GLD_HEADLESS_D3DX9_H
+
+#include <d3d9.h>
+
+/*---------------------- Macros and type definitions ----------------------*/
+
+#define D3DX_SDK_VERSION		36
+#define D3DX_DEFAULT			((UINT)-1)
+#define D3DX_DEFAULT_NONPOW2	((UINT)-2)
+#define D3DX_FROM_FILE			((UINT)-3)
+#define D3DFMT_FROM_FILE		((D3DFORMAT)-3)
+
+#define D3DX_FILTER_NONE		(1 << 0)
+#define D3DX_FILTER_POINT		(2 << 0)
+#define D3DX_FILTER_LINEAR		(3 << 0)
+#define D3DX_FILTER_TRIANGLE	(4 << 0)
+#define D3DX_FILTER_BOX			(5 << 0)
+
+#define D3DXERR_INVALIDDATA		MAKE_HRESULT(1, 0x876, 2905)
+
+// Shader and effect compile flags
+#define D3DXSHADER_DEBUG					(1 << 0)
+#define D3DXSHADER_SKIPVALIDATION			(1 << 1)
+#define D3DXSHADER_SKIPOPTIMIZATION			(1 << 2)
+#define D3DXSHADER_PACKMATRIX_ROWMAJOR		(1 << 3)
+#define D3DXSHADER_PACKMATRIX_COLUMNMAJOR	(1 << 4)
+#define D3DXSHADER_PARTIALPRECISION			(1 << 5)
+#define D3DXSHADER_USE_LEGACY_D3DX9_31_DLL	(1 << 16)
+
+// ID3DXEffect::Begin() flags
+#define D3DXFX_DONOTSAVESTATE				(1 << 0)
+#define D3DXFX_DONOTSAVESHADERSTATE			(1 << 1)
+#define D3DXFX_DONOTSAVESAMPLERSTATE		(1 << 2)
+
+typedef LPCSTR					D3DXHANDLE;
+
+typedef struct _D3DXMACRO {
+	LPCSTR					Name;
+	LPCSTR					Definition;
+} D3DXMACRO, *LPD3DXMACRO;
+
+typedef struct ID3DXInclude		ID3DXInclude, *LPD3DXINCLUDE;
+
+typedef struct D3DXVECTOR2 {
+	FLOAT					x;
+	FLOAT					y;
+} D3DXVECTOR2;
+
+typedef struct D3DXVECTOR3 {
+	FLOAT					x;
+	FLOAT					y;
+	FLOAT					z;
+} D3DXVECTOR3;
+
+typedef struct D3DXVECTOR4 {
+	FLOAT					x;
+	FLOAT					y;
+	FLOAT					z;
+	FLOAT					w;
+} D3DXVECTOR4;
+
+typedef D3DMATRIX				D3DXMATRIX, *LPD3DXMATRIX;
+
+//
+// The effect framework is reduced to the methods the driver calls, in
+// the order ID3DXEffect declares them. The helper macros for ID3DXEffect
+// come from gldirect5.h, as with the SDK headers.
+//
+
+/*------------------------------ Interfaces -------------------------------*/
+
+typedef struct ID3DXBuffer						ID3DXBuffer, *LPD3DXBUFFER;
+typedef struct ID3DXEffectStateManager			ID3DXEffectStateManager, *LPD3DXEFFECTSTATEMANAGER;
+typedef struct ID3DXEffectPool					ID3DXEffectPool, *LPD3DXEFFECTPOOL;
+typedef struct ID3DXEffectCompiler				ID3DXEffectCompiler, *LPD3DXEFFECTCOMPILER;
+typedef struct ID3DXEffect						ID3DXEffect, *LPD3DXEFFECT;
+
+typedef struct ID3DXBufferVtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(ID3DXBuffer *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(ID3DXBuffer *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(ID3DXBuffer *This);
+	LPVOID				(STDMETHODCALLTYPE *GetBufferPointer)(ID3DXBuffer *This);
+	DWORD				(STDMETHODCALLTYPE *GetBufferSize)(ID3DXBuffer *This);
+} ID3DXBufferVtbl;
+
+struct ID3DXBuffer {
+	ID3DXBufferVtbl		*lpVtbl;
+};
+
+#define ID3DXBuffer_QueryInterface(p,a,b)						(p)->lpVtbl->QueryInterface(p,a,b)
+#define ID3DXBuffer_AddRef(p)									(p)->lpVtbl->AddRef(p)
+#define ID3DXBuffer_Release(p)									(p)->lpVtbl->Release(p)
+#define ID3DXBuffer_GetBufferPointer(p)							(p)->lpVtbl->GetBufferPointer(p)
+#define ID3DXBuffer_GetBufferSize(p)							(p)->lpVtbl->GetBufferSize(p)
+
+typedef struct ID3DXEffectStateManagerVtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(ID3DXEffectStateManager *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(ID3DXEffectStateManager *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(ID3DXEffectStateManager *This);
+	HRESULT				(STDMETHODCALLTYPE *SetTransform)(ID3DXEffectStateManager *This, D3DTRANSFORMSTATETYPE State, const D3DMATRIX *pMatrix);
+	HRESULT				(STDMETHODCALLTYPE *SetMaterial)(ID3DXEffectStateManager *This, const D3DMATERIAL9 *pMaterial);
+	HRESULT				(STDMETHODCALLTYPE *SetLight)(ID3DXEffectStateManager *This, DWORD Index, const D3DLIGHT9 *pLight);
+	HRESULT				(STDMETHODCALLTYPE *LightEnable)(ID3DXEffectStateManager *This, DWORD Index, BOOL Enable);
+	HRESULT				(STDMETHODCALLTYPE *SetRenderState)(ID3DXEffectStateManager *This, D3DRENDERSTATETYPE State, DWORD Value);
+	HRESULT				(STDMETHODCALLTYPE *SetTexture)(ID3DXEffectStateManager *This, DWORD Stage, LPDIRECT3DBASETEXTURE9 pTexture);
+	HRESULT				(STDMETHODCALLTYPE *SetTextureStageState)(ID3DXEffectStateManager *This, DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value);
+	HRESULT				(STDMETHODCALLTYPE *SetSamplerState)(ID3DXEffectStateManager *This, DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value);
+	HRESULT				(STDMETHODCALLTYPE *SetNPatchMode)(ID3DXEffectStateManager *This, FLOAT NumSegments);
+	HRESULT				(STDMETHODCALLTYPE *SetFVF)(ID3DXEffectStateManager *This, DWORD FVF);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexShader)(ID3DXEffectStateManager *This, LPDIRECT3DVERTEXSHADER9 pShader);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexShaderConstantF)(ID3DXEffectStateManager *This, UINT RegisterIndex, const FLOAT *pConstantData, UINT RegisterCount);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexShaderConstantI)(ID3DXEffectStateManager *This, UINT RegisterIndex, const INT *pConstantData, UINT RegisterCount);
+	HRESULT				(STDMETHODCALLTYPE *SetVertexShaderConstantB)(ID3DXEffectStateManager *This, UINT RegisterIndex, const BOOL *pConstantData, UINT RegisterCount);
+	HRESULT				(STDMETHODCALLTYPE *SetPixelShader)(ID3DXEffectStateManager *This, LPDIRECT3DPIXELSHADER9 pShader);
+	HRESULT				(STDMETHODCALLTYPE *SetPixelShaderConstantF)(ID3DXEffectStateManager *This, UINT RegisterIndex, const FLOAT *pConstantData, UINT RegisterCount);
+	HRESULT				(STDMETHODCALLTYPE *SetPixelShaderConstantI)(ID3DXEffectStateManager *This, UINT RegisterIndex, const INT *pConstantData, UINT RegisterCount);
+	HRESULT				(STDMETHODCALLTYPE *SetPixelShaderConstantB)(ID3DXEffectStateManager *This, UINT RegisterIndex, const BOOL *pConstantData, UINT RegisterCount);
+} ID3DXEffectStateManagerVtbl;
+
+struct ID3DXEffectStateManager {
+	ID3DXEffectStateManagerVtbl	*lpVtbl;
+};
+
+#define ID3DXEffectStateManager_QueryInterface(p,a,b)			(p)->lpVtbl->QueryInterface(p,a,b)
+#define ID3DXEffectStateManager_AddRef(p)						(p)->lpVtbl->AddRef(p)
+#define ID3DXEffectStateManager_Release(p)						(p)->lpVtbl->Release(p)
+#define ID3DXEffectStateManager_SetTransform(p,a,b)				(p)->lpVtbl->SetTransform(p,a,b)
+#define ID3DXEffectStateManager_SetMaterial(p,a)				(p)->lpVtbl->SetMaterial(p,a)
+#define ID3DXEffectStateManager_SetLight(p,a,b)					(p)->lpVtbl->SetLight(p,a,b)
+#define ID3DXEffectStateManager_LightEnable(p,a,b)				(p)->lpVtbl->LightEnable(p,a,b)
+#define ID3DXEffectStateManager_SetRenderState(p,a,b)			(p)->lpVtbl->SetRenderState(p,a,b)
+#define ID3DXEffectStateManager_SetTexture(p,a,b)				(p)->lpVtbl->SetTexture(p,a,b)
+#define ID3DXEffectStateManager_SetTextureStageState(p,a,b,c)	(p)->lpVtbl->SetTextureStageState(p,a,b,c)
+#define ID3DXEffectStateManager_SetSamplerState(p,a,b,c)		(p)->lpVtbl->SetSamplerState(p,a,b,c)
+#define ID3DXEffectStateManager_SetNPatchMode(p,a)				(p)->lpVtbl->SetNPatchMode(p,a)
+#define ID3DXEffectStateManager_SetFVF(p,a)						(p)->lpVtbl->SetFVF(p,a)
+#define ID3DXEffectStateManager_SetVertexShader(p,a)			(p)->lpVtbl->SetVertexShader(p,a)
+#define ID3DXEffectStateManager_SetVertexShaderConstantF(p,a,b,c)	(p)->lpVtbl->SetVertexShaderConstantF(p,a,b,c)
+#define ID3DXEffectStateManager_SetVertexShaderConstantI(p,a,b,c)	(p)->lpVtbl->SetVertexShaderConstantI(p,a,b,c)
+#define ID3DXEffectStateManager_SetVertexShaderConstantB(p,a,b,c)	(p)->lpVtbl->SetVertexShaderConstantB(p,a,b,c)
+#define ID3DXEffectStateManager_SetPixelShader(p,a)				(p)->lpVtbl->SetPixelShader(p,a)
+#define ID3DXEffectStateManager_SetPixelShaderConstantF(p,a,b,c)	(p)->lpVtbl->SetPixelShaderConstantF(p,a,b,c)
+#define ID3DXEffectStateManager_SetPixelShaderConstantI(p,a,b,c)	(p)->lpVtbl->SetPixelShaderConstantI(p,a,b,c)
+#define ID3DXEffectStateManager_SetPixelShaderConstantB(p,a,b,c)	(p)->lpVtbl->SetPixelShaderConstantB(p,a,b,c)
+
+typedef struct ID3DXEffectPoolVtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(ID3DXEffectPool *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(ID3DXEffectPool *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(ID3DXEffectPool *This);
+} ID3DXEffectPoolVtbl;
+
+struct ID3DXEffectPool {
+	ID3DXEffectPoolVtbl	*lpVtbl;
+};
+
+#define ID3DXEffectPool_QueryInterface(p,a,b)					(p)->lpVtbl->QueryInterface(p,a,b)
+#define ID3DXEffectPool_AddRef(p)								(p)->lpVtbl->AddRef(p)
+#define ID3DXEffectPool_Release(p)								(p)->lpVtbl->Release(p)
+
+typedef struct ID3DXEffectCompilerVtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(ID3DXEffectCompiler *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(ID3DXEffectCompiler *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(ID3DXEffectCompiler *This);
+	HRESULT				(STDMETHODCALLTYPE *CompileEffect)(ID3DXEffectCompiler *This, DWORD Flags, LPD3DXBUFFER *ppEffect, LPD3DXBUFFER *ppErrorMsgs);
+} ID3DXEffectCompilerVtbl;
+
+struct ID3DXEffectCompiler {
+	ID3DXEffectCompilerVtbl	*lpVtbl;
+};
+
+#define ID3DXEffectCompiler_QueryInterface(p,a,b)				(p)->lpVtbl->QueryInterface(p,a,b)
+#define ID3DXEffectCompiler_AddRef(p)							(p)->lpVtbl->AddRef(p)
+#define ID3DXEffectCompiler_Release(p)							(p)->lpVtbl->Release(p)
+#define ID3DXEffectCompiler_CompileEffect(p,a,b,c)				(p)->lpVtbl->CompileEffect(p,a,b,c)
+
+typedef struct ID3DXEffectVtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(ID3DXEffect *This, REFIID riid, void **ppvObj);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(ID3DXEffect *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(ID3DXEffect *This);
+	D3DXHANDLE			(STDMETHODCALLTYPE *GetParameterByName)(ID3DXEffect *This, D3DXHANDLE hParameter, LPCSTR pName);
+	D3DXHANDLE			(STDMETHODCALLTYPE *GetParameterElement)(ID3DXEffect *This, D3DXHANDLE hParameter, UINT Index);
+	D3DXHANDLE			(STDMETHODCALLTYPE *GetTechniqueByName)(ID3DXEffect *This, LPCSTR pName);
+	HRESULT				(STDMETHODCALLTYPE *SetValue)(ID3DXEffect *This, D3DXHANDLE hParameter, LPCVOID pData, UINT Bytes);
+	HRESULT				(STDMETHODCALLTYPE *SetFloat)(ID3DXEffect *This, D3DXHANDLE hParameter, FLOAT f);
+	HRESULT				(STDMETHODCALLTYPE *SetVector)(ID3DXEffect *This, D3DXHANDLE hParameter, const D3DXVECTOR4 *pVector);
+	HRESULT				(STDMETHODCALLTYPE *SetMatrix)(ID3DXEffect *This, D3DXHANDLE hParameter, const D3DXMATRIX *pMatrix);
+	HRESULT				(STDMETHODCALLTYPE *SetTexture)(ID3DXEffect *This, D3DXHANDLE hParameter, LPDIRECT3DBASETEXTURE9 pTexture);
+	HRESULT				(STDMETHODCALLTYPE *SetTechnique)(ID3DXEffect *This, D3DXHANDLE hTechnique);
+	HRESULT				(STDMETHODCALLTYPE *Begin)(ID3DXEffect *This, UINT *pPasses, DWORD Flags);
+	HRESULT				(STDMETHODCALLTYPE *BeginPass)(ID3DXEffect *This, UINT Pass);
+	HRESULT				(STDMETHODCALLTYPE *CommitChanges)(ID3DXEffect *This);
+	HRESULT				(STDMETHODCALLTYPE *EndPass)(ID3DXEffect *This);
+	HRESULT				(STDMETHODCALLTYPE *End)(ID3DXEffect *This);
+	HRESULT				(STDMETHODCALLTYPE *OnLostDevice)(ID3DXEffect *This);
+	HRESULT				(STDMETHODCALLTYPE *OnResetDevice)(ID3DXEffect *This);
+	HRESULT				(STDMETHODCALLTYPE *SetStateManager)(ID3DXEffect *This, LPD3DXEFFECTSTATEMANAGER pManager);
+} ID3DXEffectVtbl;
+
+struct ID3DXEffect {
+	ID3DXEffectVtbl		*lpVtbl;
+};
+
+#define ID3DXEffect_SetStateManager(p,a)						(p)->lpVtbl->SetStateManager(p,a)
+
+extern const GUID				IID_ID3DXEffectStateManager;
+
+/*------------------------- Function Prototypes ---------------------------*/
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+UINT		WINAPI D3DXGetDriverLevel(LPDIRECT3DDEVICE9 pDevice);
+
+D3DXMATRIX*	WINAPI D3DXMatrixMultiply(D3DXMATRIX *pOut, const D3DXMATRIX *pM1, const D3DXMATRIX *pM2);
+D3DXMATRIX*	WINAPI D3DXMatrixIdentity(D3DXMATRIX *pOut);
+
+HRESULT		WINAPI D3DXCreateEffectPool(LPD3DXEFFECTPOOL *ppPool);
+HRESULT		WINAPI D3DXCreateEffectCompiler(LPCSTR pSrcData, UINT SrcDataLen, const D3DXMACRO *pDefines, LPD3DXINCLUDE pInclude, DWORD Flags, LPD3DXEFFECTCOMPILER *ppCompiler, LPD3DXBUFFER *ppParseErrors);
+HRESULT		WINAPI D3DXCreateEffect(LPDIRECT3DDEVICE9 pDevice, LPCVOID pSrcData, UINT SrcDataLen, const D3DXMACRO *pDefines, LPD3DXINCLUDE pInclude, DWORD Flags, LPD3DXEFFECTPOOL pPool, LPD3DXEFFECT *ppEffect, LPD3DXBUFFER *ppCompilationErrors);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#include <d3dx9tex.h>
+
+#endif
@@ -0,0 +1,87 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  The DirectDraw definitions GLDirect still uses, for the headless build.
+*
+*********************************************************************************/
+
+#ifndef __GLD_HEADLESS_DDRAW_H
+#define __GLD_HEADLESS_DDRAW_H
+
+#include <windows.h>
+
+/*---------------------- Macros and type definitions ----------------------*/
+
+#define MAX_DDDEVICEID_STRING	512
+
+#define _FACDD					0x876
+#define MAKE_DDHRESULT(code)	MAKE_HRESULT(1, _FACDD, code)
+#define DDERR_CURRENTLYNOTAVAIL	MAKE_DDHRESULT(40)
+
+#define DDSCAPS_SYSTEMMEMORY	0x00000800l
+#define DDSCAPS_VIDEOMEMORY		0x00004000l
+
+typedef struct _DDPIXELFORMAT {
+	DWORD					dwSize;
+	DWORD					dwFlags;
+	DWORD					dwFourCC;
+	DWORD					dwRGBBitCount;
+	DWORD					dwRBitMask;
+	DWORD					dwGBitMask;
+	DWORD					dwBBitMask;
+	DWORD					dwRGBAlphaBitMask;
+} DDPIXELFORMAT, *LPDDPIXELFORMAT;
+
+typedef struct tagDDDEVICEIDENTIFIER {
+	char					szDriver[MAX_DDDEVICEID_STRING];
+	char					szDescription[MAX_DDDEVICEID_STRING];
+	LARGE_INTEGER			liDriverVersion;
+	DWORD					dwVendorId;
+	DWORD					dwDeviceId;
+	DWORD					dwSubSysId;
+	DWORD					dwRevision;
+	GUID					guidDeviceIdentifier;
+} DDDEVICEIDENTIFIER, *LPDDDEVICEIDENTIFIER;
+
+// Only the device identifier is ever asked of DirectDraw, and nothing
+// creates a DirectDraw object in the headless build.
+typedef struct IDirectDraw4		IDirectDraw4, *LPDIRECTDRAW4;
+typedef struct IDirectDrawClipper	IDirectDrawClipper, *LPDIRECTDRAWCLIPPER;
+
+typedef struct IDirectDraw4Vtbl {
+	HRESULT				(STDMETHODCALLTYPE *GetDeviceIdentifier)(IDirectDraw4 *This, LPDDDEVICEIDENTIFIER pDDDI, DWORD dwFlags);
+} IDirectDraw4Vtbl;
+
+struct IDirectDraw4 {
+	IDirectDraw4Vtbl	*lpVtbl;
+};
+
+#define IDirectDraw4_GetDeviceIdentifier(p,a,b)	(p)->lpVtbl->GetDeviceIdentifier(p,a,b)
+
+#endif
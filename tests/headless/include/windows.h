@@ -0,0 +1,857 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Win32 API subset for building GLDirect on Linux, so that the driver
+*               and its test programs can run headless. The functions are implemented
+*               in tests/headless/win32.c.
+*
+*********************************************************************************/
+
+#ifndef __GLD_HEADLESS_WINDOWS_H
+#define __GLD_HEADLESS_WINDOWS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+/*---------------------- Macros and type definitions ----------------------*/
+
+#define WINAPI
+#define APIENTRY
+#define CALLBACK
+#define WINGDIAPI
+#define STDMETHODCALLTYPE
+#define __stdcall
+#define __cdecl
+#define __forceinline			static inline
+#define __int64					long long
+#define FAR
+#define NEAR
+#define CONST					const
+#define IN
+#define OUT
+#define OPTIONAL
+#define VOID					void
+
+// Structured exception handling; nothing is caught
+#define __try					if (1)
+#define __except(x)				else if (0)
+#define EXCEPTION_EXECUTE_HANDLER	1
+
+#ifndef TRUE
+#define TRUE					1
+#define FALSE					0
+#endif
+#define MAX_PATH				260
+#define _MAX_PATH				MAX_PATH
+#define INFINITE				0xFFFFFFFF
+
+#ifndef NOMINMAX
+#ifndef max
+#define max(a,b)				(((a) > (b)) ? (a) : (b))
+#endif
+#ifndef min
+#define min(a,b)				(((a) < (b)) ? (a) : (b))
+#endif
+#endif
+#define __min(a,b)				(((a) < (b)) ? (a) : (b))
+#define __max(a,b)				(((a) > (b)) ? (a) : (b))
+
+typedef unsigned char			BYTE, UCHAR, *PBYTE, *LPBYTE;
+typedef unsigned short			WORD, USHORT, *LPWORD;
+typedef uint32_t				DWORD, *PDWORD, *LPDWORD;
+typedef uint32_t				ULONG, *PULONG;
+typedef int32_t					LONG, *PLONG, *LPLONG;
+typedef int						BOOL, INT, *PBOOL, *LPBOOL;
+typedef unsigned int			UINT;
+typedef short					SHORT;
+typedef char					CHAR, TCHAR;
+typedef unsigned short			WCHAR;
+typedef float					FLOAT;
+typedef int64_t					LONGLONG;
+typedef uint64_t				ULONGLONG, DWORD64;
+typedef intptr_t				INT_PTR, LONG_PTR, LPARAM, LRESULT;
+typedef uintptr_t				UINT_PTR, ULONG_PTR, DWORD_PTR, WPARAM;
+typedef size_t					SIZE_T;
+typedef int32_t					HRESULT;
+typedef DWORD					COLORREF;
+typedef WORD					ATOM;
+typedef void					*PVOID, *LPVOID;
+typedef const void				*LPCVOID;
+typedef char					*LPSTR, *LPTSTR, *PSTR;
+typedef const char				*LPCSTR, *LPCTSTR;
+typedef WCHAR					*LPWSTR;
+typedef const WCHAR				*LPCWSTR;
+
+typedef void					*HANDLE;
+typedef HANDLE					HWND, HDC, HGLRC, HINSTANCE, HMODULE, HFONT, HBITMAP, HGDIOBJ,
+								HKEY, HICON, HCURSOR, HBRUSH, HMENU, HRGN, HHOOK, HPALETTE,
+								HMONITOR, HLOCAL, HGLOBAL;
+typedef HKEY					*PHKEY;
+
+typedef INT_PTR					(*PROC)(void);
+typedef INT_PTR					(*FARPROC)(void);
+typedef LRESULT					(*WNDPROC)(HWND, UINT, WPARAM, LPARAM);
+typedef LRESULT					(*HOOKPROC)(int, WPARAM, LPARAM);
+typedef BOOL					(*WNDENUMPROC)(HWND, LPARAM);
+typedef DWORD					(*LPTHREAD_START_ROUTINE)(LPVOID);
+
+#define LOWORD(l)				((WORD)((DWORD_PTR)(l) & 0xffff))
+#define HIWORD(l)				((WORD)(((DWORD_PTR)(l) >> 16) & 0xffff))
+#define MAKELONG(a,b)			((LONG)(((WORD)(a)) | ((DWORD)((WORD)(b))) << 16))
+#define RGB(r,g,b)				((COLORREF)(((BYTE)(r) | ((WORD)((BYTE)(g)) << 8)) | (((DWORD)(BYTE)(b)) << 16)))
+#define MAKEINTRESOURCE(i)		((LPSTR)((ULONG_PTR)((WORD)(i))))
+
+/*------------------------------- HRESULT ---------------------------------*/
+
+#define S_OK					((HRESULT)0)
+#define S_FALSE					((HRESULT)1)
+#define E_FAIL					((HRESULT)0x80004005)
+#define E_NOTIMPL				((HRESULT)0x80004001)
+#define E_OUTOFMEMORY			((HRESULT)0x8007000E)
+#define E_INVALIDARG			((HRESULT)0x80070057)
+#define E_NOINTERFACE			((HRESULT)0x80004002)
+#define SUCCEEDED(hr)			(((HRESULT)(hr)) >= 0)
+#define FAILED(hr)				(((HRESULT)(hr)) < 0)
+#define MAKE_HRESULT(s,f,c)		((HRESULT)(((unsigned long)(s) << 31) | ((unsigned long)(f) << 16) | ((unsigned long)(c))))
+#define ERROR_SUCCESS			0L
+
+/*--------------------------------- COM -----------------------------------*/
+
+typedef struct _GUID {
+	DWORD					Data1;
+	WORD					Data2;
+	WORD					Data3;
+	BYTE					Data4[8];
+} GUID, IID, CLSID;
+typedef const GUID				*REFGUID, *REFIID, *REFCLSID;
+
+#define DEFINE_GUID(name, l, w1, w2, b1, b2, b3, b4, b5, b6, b7, b8) \
+	static const GUID name = { l, w1, w2, { b1, b2, b3, b4, b5, b6, b7, b8 } }
+#define IsEqualGUID(a, b)		(!memcmp((a), (b), sizeof(GUID)))
+#define IsEqualIID(a, b)		IsEqualGUID(a, b)
+
+typedef struct IUnknown			IUnknown, *LPUNKNOWN;
+
+typedef struct IUnknownVtbl {
+	HRESULT				(STDMETHODCALLTYPE *QueryInterface)(IUnknown *This, REFIID riid, void **ppvObject);
+	ULONG				(STDMETHODCALLTYPE *AddRef)(IUnknown *This);
+	ULONG				(STDMETHODCALLTYPE *Release)(IUnknown *This);
+} IUnknownVtbl;
+
+struct IUnknown {
+	IUnknownVtbl		*lpVtbl;
+};
+
+extern const GUID				IID_IUnknown;
+
+/*------------------------------ Structures -------------------------------*/
+
+typedef struct tagRECT {
+	LONG					left;
+	LONG					top;
+	LONG					right;
+	LONG					bottom;
+} RECT, *PRECT, *LPRECT;
+typedef const RECT				*LPCRECT;
+
+typedef struct tagPOINT {
+	LONG					x;
+	LONG					y;
+} POINT, *PPOINT, *LPPOINT;
+
+typedef struct tagSIZE {
+	LONG					cx;
+	LONG					cy;
+} SIZE, *PSIZE, *LPSIZE;
+
+typedef struct _RGNDATAHEADER {
+	DWORD					dwSize;
+	DWORD					iType;
+	DWORD					nCount;
+	DWORD					nRgnSize;
+	RECT					rcBound;
+} RGNDATAHEADER;
+
+typedef struct _RGNDATA {
+	RGNDATAHEADER			rdh;
+	char					Buffer[1];
+} RGNDATA, *LPRGNDATA;
+
+typedef struct tagMSG {
+	HWND					hwnd;
+	UINT					message;
+	WPARAM					wParam;
+	LPARAM					lParam;
+	DWORD					time;
+	POINT					pt;
+} MSG, *LPMSG;
+
+typedef struct tagWNDCLASS {
+	UINT					style;
+	WNDPROC					lpfnWndProc;
+	int						cbClsExtra;
+	int						cbWndExtra;
+	HINSTANCE				hInstance;
+	HICON					hIcon;
+	HCURSOR					hCursor;
+	HBRUSH					hbrBackground;
+	LPCSTR					lpszMenuName;
+	LPCSTR					lpszClassName;
+} WNDCLASS, WNDCLASSA;
+
+typedef struct tagPAINTSTRUCT {
+	HDC						hdc;
+	BOOL					fErase;
+	RECT					rcPaint;
+	BOOL					fRestore;
+	BOOL					fIncUpdate;
+	BYTE					rgbReserved[32];
+} PAINTSTRUCT, *LPPAINTSTRUCT;
+
+typedef struct tagPALETTEENTRY {
+	BYTE					peRed;
+	BYTE					peGreen;
+	BYTE					peBlue;
+	BYTE					peFlags;
+} PALETTEENTRY, *LPPALETTEENTRY;
+
+typedef struct tagRGBQUAD {
+	BYTE					rgbBlue;
+	BYTE					rgbGreen;
+	BYTE					rgbRed;
+	BYTE					rgbReserved;
+} RGBQUAD;
+
+typedef struct tagBITMAPINFOHEADER {
+	DWORD					biSize;
+	LONG					biWidth;
+	LONG					biHeight;
+	WORD					biPlanes;
+	WORD					biBitCount;
+	DWORD					biCompression;
+	DWORD					biSizeImage;
+	LONG					biXPelsPerMeter;
+	LONG					biYPelsPerMeter;
+	DWORD					biClrUsed;
+	DWORD					biClrImportant;
+} BITMAPINFOHEADER;
+
+typedef struct tagBITMAPINFO {
+	BITMAPINFOHEADER		bmiHeader;
+	RGBQUAD					bmiColors[1];
+} BITMAPINFO, *LPBITMAPINFO;
+
+typedef struct tagPIXELFORMATDESCRIPTOR {
+	WORD					nSize;
+	WORD					nVersion;
+	DWORD					dwFlags;
+	BYTE					iPixelType;
+	BYTE					cColorBits;
+	BYTE					cRedBits;
+	BYTE					cRedShift;
+	BYTE					cGreenBits;
+	BYTE					cGreenShift;
+	BYTE					cBlueBits;
+	BYTE					cBlueShift;
+	BYTE					cAlphaBits;
+	BYTE					cAlphaShift;
+	BYTE					cAccumBits;
+	BYTE					cAccumRedBits;
+	BYTE					cAccumGreenBits;
+	BYTE					cAccumBlueBits;
+	BYTE					cAccumAlphaBits;
+	BYTE					cDepthBits;
+	BYTE					cStencilBits;
+	BYTE					cAuxBuffers;
+	BYTE					iLayerType;
+	BYTE					bReserved;
+	DWORD					dwLayerMask;
+	DWORD					dwVisibleMask;
+	DWORD					dwDamageMask;
+} PIXELFORMATDESCRIPTOR, *PPIXELFORMATDESCRIPTOR, *LPPIXELFORMATDESCRIPTOR;
+
+typedef struct tagLAYERPLANEDESCRIPTOR {
+	WORD					nSize;
+	WORD					nVersion;
+	DWORD					dwFlags;
+	BYTE					iPixelType;
+	BYTE					cColorBits;
+	BYTE					cRedBits;
+	BYTE					cRedShift;
+	BYTE					cGreenBits;
+	BYTE					cGreenShift;
+	BYTE					cBlueBits;
+	BYTE					cBlueShift;
+	BYTE					cAlphaBits;
+	BYTE					cAlphaShift;
+	BYTE					cAccumBits;
+	BYTE					cAccumRedBits;
+	BYTE					cAccumGreenBits;
+	BYTE					cAccumBlueBits;
+	BYTE					cAccumAlphaBits;
+	BYTE					cDepthBits;
+	BYTE					cStencilBits;
+	BYTE					cAuxBuffers;
+	BYTE					iLayerPlane;
+	BYTE					bReserved;
+	COLORREF				crTransparent;
+} LAYERPLANEDESCRIPTOR, *LPLAYERPLANEDESCRIPTOR;
+
+typedef struct _POINTFLOAT {
+	FLOAT					x;
+	FLOAT					y;
+} POINTFLOAT;
+
+typedef struct _GLYPHMETRICSFLOAT {
+	FLOAT					gmfBlackBoxX;
+	FLOAT					gmfBlackBoxY;
+	POINTFLOAT				gmfptGlyphOrigin;
+	FLOAT					gmfCellIncX;
+	FLOAT					gmfCellIncY;
+} GLYPHMETRICSFLOAT, *LPGLYPHMETRICSFLOAT;
+
+typedef struct _WGLSWAP {
+	HDC						hdc;
+	UINT					uiFlags;
+} WGLSWAP;
+
+typedef struct _FIXED {
+	WORD					fract;
+	short					value;
+} FIXED;
+
+typedef struct tagPOINTFX {
+	FIXED					x;
+	FIXED					y;
+} POINTFX;
+
+typedef struct _MAT2 {
+	FIXED					eM11;
+	FIXED					eM12;
+	FIXED					eM21;
+	FIXED					eM22;
+} MAT2;
+
+typedef struct _GLYPHMETRICS {
+	UINT					gmBlackBoxX;
+	UINT					gmBlackBoxY;
+	POINT					gmptGlyphOrigin;
+	short					gmCellIncX;
+	short					gmCellIncY;
+} GLYPHMETRICS, *LPGLYPHMETRICS;
+
+typedef struct tagTTPOLYGONHEADER {
+	DWORD					cb;
+	DWORD					dwType;
+	POINTFX					pfxStart;
+} TTPOLYGONHEADER, *LPTTPOLYGONHEADER;
+
+typedef struct tagTTPOLYCURVE {
+	WORD					wType;
+	WORD					cpfx;
+	POINTFX					apfx[1];
+} TTPOLYCURVE, *LPTTPOLYCURVE;
+
+typedef struct tagTEXTMETRIC {
+	LONG					tmHeight;
+	LONG					tmAscent;
+	LONG					tmDescent;
+	LONG					tmInternalLeading;
+	LONG					tmExternalLeading;
+	LONG					tmAveCharWidth;
+	LONG					tmMaxCharWidth;
+	LONG					tmWeight;
+	LONG					tmOverhang;
+	LONG					tmDigitizedAspectX;
+	LONG					tmDigitizedAspectY;
+	BYTE					tmFirstChar;
+	BYTE					tmLastChar;
+	BYTE					tmDefaultChar;
+	BYTE					tmBreakChar;
+	BYTE					tmItalic;
+	BYTE					tmUnderlined;
+	BYTE					tmStruckOut;
+	BYTE					tmPitchAndFamily;
+	BYTE					tmCharSet;
+} TEXTMETRIC, *LPTEXTMETRIC;
+
+typedef struct tagLOGFONT {
+	LONG					lfHeight;
+	LONG					lfWidth;
+	LONG					lfEscapement;
+	LONG					lfOrientation;
+	LONG					lfWeight;
+	BYTE					lfItalic;
+	BYTE					lfUnderline;
+	BYTE					lfStrikeOut;
+	BYTE					lfCharSet;
+	BYTE					lfOutPrecision;
+	BYTE					lfClipPrecision;
+	BYTE					lfQuality;
+	BYTE					lfPitchAndFamily;
+	CHAR					lfFaceName[32];
+} LOGFONT, *LPLOGFONT;
+
+typedef struct _OUTLINETEXTMETRIC {
+	UINT					otmSize;
+	TEXTMETRIC				otmTextMetrics;
+	BYTE					otmFiller;
+	BYTE					otmPanoseNumber[10];
+	UINT					otmfsSelection;
+	UINT					otmfsType;
+	int						otmsCharSlopeRise;
+	int						otmsCharSlopeRun;
+	int						otmItalicAngle;
+	UINT					otmEMSquare;
+	int						otmAscent;
+	int						otmDescent;
+	UINT					otmLineGap;
+	UINT					otmsCapEmHeight;
+	UINT					otmsXHeight;
+	RECT					otmrcFontBox;
+	int						otmMacAscent;
+	int						otmMacDescent;
+	UINT					otmMacLineGap;
+	UINT					otmusMinimumPPEM;
+	POINT					otmptSubscriptSize;
+	POINT					otmptSubscriptOffset;
+	POINT					otmptSuperscriptSize;
+	POINT					otmptSuperscriptOffset;
+	UINT					otmsStrikeoutSize;
+	int						otmsStrikeoutPosition;
+	int						otmsUnderscoreSize;
+	int						otmsUnderscorePosition;
+	PSTR					otmpFamilyName;			// Offsets from the start of the structure
+	PSTR					otmpFaceName;
+	PSTR					otmpStyleName;
+	PSTR					otmpFullName;
+} OUTLINETEXTMETRIC, *LPOUTLINETEXTMETRIC;
+
+typedef struct _RASTERIZER_STATUS {
+	short					nSize;
+	short					wFlags;
+	short					nLanguageID;
+} RASTERIZER_STATUS, *LPRASTERIZER_STATUS;
+
+typedef struct _SYSTEM_INFO {
+	WORD					wProcessorArchitecture;
+	WORD					wReserved;
+	DWORD					dwPageSize;
+	LPVOID					lpMinimumApplicationAddress;
+	LPVOID					lpMaximumApplicationAddress;
+	DWORD_PTR				dwActiveProcessorMask;
+	DWORD					dwNumberOfProcessors;
+	DWORD					dwProcessorType;
+	DWORD					dwAllocationGranularity;
+	WORD					wProcessorLevel;
+	WORD					wProcessorRevision;
+} SYSTEM_INFO, *LPSYSTEM_INFO;
+
+typedef struct _OSVERSIONINFO {
+	DWORD					dwOSVersionInfoSize;
+	DWORD					dwMajorVersion;
+	DWORD					dwMinorVersion;
+	DWORD					dwBuildNumber;
+	DWORD					dwPlatformId;
+	CHAR					szCSDVersion[128];
+} OSVERSIONINFO, *LPOSVERSIONINFO;
+
+typedef union _LARGE_INTEGER {
+	struct {
+		DWORD				LowPart;
+		LONG				HighPart;
+	};
+	struct {
+		DWORD				LowPart;
+		LONG				HighPart;
+	} u;
+	LONGLONG				QuadPart;
+} LARGE_INTEGER;
+
+typedef struct _FILETIME {
+	DWORD					dwLowDateTime;
+	DWORD					dwHighDateTime;
+} FILETIME;
+
+typedef struct _WIN32_FIND_DATA {
+	DWORD					dwFileAttributes;
+	FILETIME				ftCreationTime;
+	FILETIME				ftLastAccessTime;
+	FILETIME				ftLastWriteTime;
+	DWORD					nFileSizeHigh;
+	DWORD					nFileSizeLow;
+	DWORD					dwReserved0;
+	DWORD					dwReserved1;
+	CHAR					cFileName[MAX_PATH];
+	CHAR					cAlternateFileName[14];
+} WIN32_FIND_DATA, *LPWIN32_FIND_DATA;
+
+typedef struct _SECURITY_ATTRIBUTES {
+	DWORD					nLength;
+	LPVOID					lpSecurityDescriptor;
+	BOOL					bInheritHandle;
+} SECURITY_ATTRIBUTES, *LPSECURITY_ATTRIBUTES;
+
+// A recursive pthread mutex, allocated by InitializeCriticalSection()
+typedef struct _CRITICAL_SECTION {
+	void					*pMutex;
+} CRITICAL_SECTION, *LPCRITICAL_SECTION;
+
+/*------------------------------- Constants -------------------------------*/
+
+#define INVALID_HANDLE_VALUE	((HANDLE)(LONG_PTR)-1)
+#define WAIT_OBJECT_0			0x00000000L
+#define WAIT_TIMEOUT			0x00000102L
+#define WAIT_FAILED				0xFFFFFFFF
+#define TLS_OUT_OF_INDEXES		0xFFFFFFFF
+#define STILL_ACTIVE			0x00000103L
+
+#define DLL_PROCESS_DETACH		0
+#define DLL_PROCESS_ATTACH		1
+#define DLL_THREAD_ATTACH		2
+#define DLL_THREAD_DETACH		3
+
+#define VER_PLATFORM_WIN32s			0
+#define VER_PLATFORM_WIN32_WINDOWS	1
+#define VER_PLATFORM_WIN32_NT		2
+
+#define MB_OK					0x00000000L
+#define MB_ICONSTOP				0x00000010L
+#define MB_ICONEXCLAMATION		0x00000030L
+#define MB_ICONWARNING			0x00000030L
+#define MB_TASKMODAL			0x00002000L
+
+#define HKEY_CURRENT_USER		((HKEY)(ULONG_PTR)0x80000001)
+#define HKEY_LOCAL_MACHINE		((HKEY)(ULONG_PTR)0x80000002)
+#define KEY_READ				0x20019
+#define KEY_WRITE				0x20006
+#define KEY_ALL_ACCESS			0xF003F
+#define REG_SZ					1
+#define REG_DWORD				4
+#define REG_OPTION_NON_VOLATILE	0
+
+#define MOVEFILE_REPLACE_EXISTING	0x00000001
+
+#define WS_OVERLAPPED			0x00000000L
+#define WS_POPUP				0x80000000L
+#define WS_VISIBLE				0x10000000L
+#define WS_CAPTION				0x00C00000L
+#define WS_SYSMENU				0x00080000L
+#define WS_THICKFRAME			0x00040000L
+#define WS_MINIMIZEBOX			0x00020000L
+#define WS_MAXIMIZEBOX			0x00010000L
+#define WS_OVERLAPPEDWINDOW		(WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU | WS_THICKFRAME | WS_MINIMIZEBOX | WS_MAXIMIZEBOX)
+#define WS_EX_TOOLWINDOW		0x00000080L
+#define CS_OWNDC				0x0020
+#define CW_USEDEFAULT			((int)0x80000000)
+#define GWL_WNDPROC				(-4)
+#define SWP_NOSIZE				0x0001
+#define SWP_NOMOVE				0x0002
+#define SWP_NOZORDER			0x0004
+#define SM_CXSCREEN				0
+#define SM_CYSCREEN				1
+#define PM_NOREMOVE				0x0000
+#define PM_REMOVE				0x0001
+#define IDC_ARROW				MAKEINTRESOURCE(32512)
+#define IDI_APPLICATION			MAKEINTRESOURCE(32512)
+
+#define WA_INACTIVE				0
+#define WA_ACTIVE				1
+
+#define WM_DESTROY				0x0002
+#define WM_SIZE					0x0005
+#define WM_ACTIVATE				0x0006
+#define WM_PAINT				0x000F
+#define WM_QUIT					0x0012
+#define WM_ERASEBKGND			0x0014
+#define WM_ACTIVATEAPP			0x001C
+#define WM_KEYDOWN				0x0100
+#define WM_DISPLAYCHANGE		0x007E
+
+#define WH_KEYBOARD				2
+#define HC_ACTION				0
+#define VK_SHIFT				0x10
+#define VK_CONTROL				0x11
+#define VK_F11					0x7A
+
+#define ERROR					0
+#define BLACK_BRUSH				4
+#define SYSTEM_FONT				13
+#define BITSPIXEL				12
+#define TMPF_TRUETYPE			0x04
+#define BI_RGB					0L
+#define DIB_RGB_COLORS			0
+#define GDI_ERROR				(0xFFFFFFFFL)
+#define CLIP_DEFAULT_PRECIS		0
+#define OUT_OUTLINE_PRECIS		8
+#define DEFAULT_QUALITY			0
+#define DT_LEFT					0x00000000
+#define DT_BOTTOM				0x00000008
+#define DT_SINGLELINE			0x00000020
+#define DT_NOCLIP				0x00000100
+#define GGO_BITMAP				1
+#define GGO_NATIVE				2
+#define TT_POLYGON_TYPE			24
+#define TT_PRIM_LINE			1
+#define TT_PRIM_QSPLINE			2
+#define TT_ENABLED				0x0002
+#define WGL_FONT_LINES			0
+#define WGL_FONT_POLYGONS		1
+
+#define PFD_TYPE_RGBA				0
+#define PFD_TYPE_COLORINDEX			1
+#define PFD_MAIN_PLANE				0
+#define PFD_OVERLAY_PLANE			1
+#define PFD_UNDERLAY_PLANE			(-1)
+#define PFD_DOUBLEBUFFER			0x00000001
+#define PFD_STEREO					0x00000002
+#define PFD_DRAW_TO_WINDOW			0x00000004
+#define PFD_DRAW_TO_BITMAP			0x00000008
+#define PFD_SUPPORT_GDI				0x00000010
+#define PFD_SUPPORT_OPENGL			0x00000020
+#define PFD_GENERIC_FORMAT			0x00000040
+#define PFD_NEED_PALETTE			0x00000080
+#define PFD_NEED_SYSTEM_PALETTE		0x00000100
+#define PFD_SWAP_EXCHANGE			0x00000200
+#define PFD_SWAP_COPY				0x00000400
+#define PFD_SWAP_LAYER_BUFFERS		0x00000800
+#define PFD_GENERIC_ACCELERATED		0x00001000
+#define PFD_DOUBLEBUFFER_DONTCARE	0x40000000
+#define PFD_STEREO_DONTCARE			0x80000000
+
+/*------------------------- Function Prototypes ---------------------------*/
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+// Memory and strings
+#define ZeroMemory(p, n)		memset((p), 0, (n))
+#define CopyMemory(d, s, n)		memcpy((d), (s), (n))
+#define FillMemory(p, n, v)		memset((p), (v), (n))
+#define lstrcpy					strcpy
+#define lstrcat					strcat
+#define lstrlen(s)				((int)strlen(s))
+#define lstrcmpi				strcasecmp
+#define wsprintf				sprintf
+#define _snprintf				snprintf
+#define _vsnprintf				vsnprintf
+#define _strnicmp				strncasecmp
+#define _stricmp				strcasecmp
+#define stricmp					strcasecmp
+#define _finite(x)				isfinite(x)
+#define _msize(p)				malloc_usable_size(p)
+char*		_strupr(char *s);
+LPSTR		lstrcpyn(LPSTR lpString1, LPCSTR lpString2, int iMaxLength);
+size_t		malloc_usable_size(void *p);
+void		_exit(int status);
+
+// Files. Paths built by the driver use '\\' separators.
+#define fopen(f, m)			gldHeadlessFopen(f, m)
+FILE*		gldHeadlessFopen(const char *pszFile, const char *pszMode);
+
+HGLOBAL		GlobalAlloc(UINT uFlags, SIZE_T dwBytes);
+HGLOBAL		GlobalFree(HGLOBAL hMem);
+SIZE_T		GlobalSize(HGLOBAL hMem);
+#define GMEM_FIXED				0x0000
+#define GMEM_ZEROINIT			0x0040
+#define GPTR					(GMEM_FIXED | GMEM_ZEROINIT)
+
+// Rectangles
+BOOL		SetRect(LPRECT lprc, int xLeft, int yTop, int xRight, int yBottom);
+BOOL		SetRectEmpty(LPRECT lprc);
+BOOL		CopyRect(LPRECT lprcDst, const RECT *lprcSrc);
+BOOL		OffsetRect(LPRECT lprc, int dx, int dy);
+BOOL		UnionRect(LPRECT lprcDst, const RECT *lprcSrc1, const RECT *lprcSrc2);
+BOOL		IntersectRect(LPRECT lprcDst, const RECT *lprcSrc1, const RECT *lprcSrc2);
+BOOL		EqualRect(const RECT *lprc1, const RECT *lprc2);
+BOOL		IsRectEmpty(const RECT *lprc);
+
+// Threads and synchronisation
+HANDLE		CreateThread(LPSECURITY_ATTRIBUTES lpThreadAttributes, SIZE_T dwStackSize, LPTHREAD_START_ROUTINE lpStartAddress, LPVOID lpParameter, DWORD dwCreationFlags, LPDWORD lpThreadId);
+HANDLE		CreateEvent(LPSECURITY_ATTRIBUTES lpEventAttributes, BOOL bManualReset, BOOL bInitialState, LPCSTR lpName);
+BOOL		SetEvent(HANDLE hEvent);
+BOOL		ResetEvent(HANDLE hEvent);
+BOOL		CloseHandle(HANDLE hObject);
+DWORD		WaitForSingleObject(HANDLE hHandle, DWORD dwMilliseconds);
+DWORD		WaitForMultipleObjects(DWORD nCount, const HANDLE *lpHandles, BOOL bWaitAll, DWORD dwMilliseconds);
+void		Sleep(DWORD dwMilliseconds);
+DWORD		GetCurrentThreadId(void);
+DWORD		GetCurrentProcessId(void);
+void		InitializeCriticalSection(LPCRITICAL_SECTION lpCriticalSection);
+void		DeleteCriticalSection(LPCRITICAL_SECTION lpCriticalSection);
+void		EnterCriticalSection(LPCRITICAL_SECTION lpCriticalSection);
+void		LeaveCriticalSection(LPCRITICAL_SECTION lpCriticalSection);
+DWORD		TlsAlloc(void);
+BOOL		TlsFree(DWORD dwTlsIndex);
+LPVOID		TlsGetValue(DWORD dwTlsIndex);
+BOOL		TlsSetValue(DWORD dwTlsIndex, LPVOID lpTlsValue);
+#define InterlockedIncrement(p)					__sync_add_and_fetch((p), 1)
+#define InterlockedDecrement(p)					__sync_sub_and_fetch((p), 1)
+#define InterlockedExchange(p, v)				__sync_lock_test_and_set((p), (v))
+#define InterlockedExchangeAdd(p, v)			__sync_fetch_and_add((p), (v))
+#define InterlockedCompareExchange(p, v, c)		__sync_val_compare_and_swap((p), (c), (v))
+#define YieldProcessor()						__asm__ __volatile__("pause")
+#define MemoryBarrier()							__sync_synchronize()
+
+// System
+void		GetSystemInfo(LPSYSTEM_INFO lpSystemInfo);
+DWORD		GetVersion(void);
+BOOL		GetVersionEx(LPOSVERSIONINFO lpVersionInfo);
+DWORD		GetTickCount(void);
+BOOL		QueryPerformanceCounter(LARGE_INTEGER *lpPerformanceCount);
+BOOL		QueryPerformanceFrequency(LARGE_INTEGER *lpFrequency);
+BOOL		IsDebuggerPresent(void);
+void		OutputDebugString(LPCSTR lpOutputString);
+int			MessageBox(HWND hWnd, LPCSTR lpText, LPCSTR lpCaption, UINT uType);
+DWORD		GetLastError(void);
+
+// Modules
+HMODULE		LoadLibrary(LPCSTR lpLibFileName);
+BOOL		FreeLibrary(HMODULE hLibModule);
+FARPROC		GetProcAddress(HMODULE hModule, LPCSTR lpProcName);
+HMODULE		GetModuleHandle(LPCSTR lpModuleName);
+DWORD		GetModuleFileName(HMODULE hModule, LPSTR lpFilename, DWORD nSize);
+
+// Files
+DWORD		GetTempPath(DWORD nBufferLength, LPSTR lpBuffer);
+UINT		GetSystemDirectory(LPSTR lpBuffer, UINT uSize);
+BOOL		CreateDirectory(LPCSTR lpPathName, LPSECURITY_ATTRIBUTES lpSecurityAttributes);
+BOOL		DeleteFile(LPCSTR lpFileName);
+BOOL		MoveFileEx(LPCSTR lpExistingFileName, LPCSTR lpNewFileName, DWORD dwFlags);
+HANDLE		FindFirstFile(LPCSTR lpFileName, LPWIN32_FIND_DATA lpFindFileData);
+BOOL		FindNextFile(HANDLE hFindFile, LPWIN32_FIND_DATA lpFindFileData);
+BOOL		FindClose(HANDLE hFindFile);
+UINT		GetPrivateProfileInt(LPCSTR lpAppName, LPCSTR lpKeyName, int nDefault, LPCSTR lpFileName);
+DWORD		GetPrivateProfileString(LPCSTR lpAppName, LPCSTR lpKeyName, LPCSTR lpDefault, LPSTR lpReturnedString, DWORD nSize, LPCSTR lpFileName);
+
+// Registry; there is none, so every key is missing
+LONG		RegOpenKeyEx(HKEY hKey, LPCSTR lpSubKey, DWORD ulOptions, DWORD samDesired, PHKEY phkResult);
+LONG		RegCreateKeyEx(HKEY hKey, LPCSTR lpSubKey, DWORD Reserved, LPSTR lpClass, DWORD dwOptions, DWORD samDesired, LPSECURITY_ATTRIBUTES lpSecurityAttributes, PHKEY phkResult, LPDWORD lpdwDisposition);
+LONG		RegQueryValueEx(HKEY hKey, LPCSTR lpValueName, LPDWORD lpReserved, LPDWORD lpType, LPBYTE lpData, LPDWORD lpcbData);
+LONG		RegSetValueEx(HKEY hKey, LPCSTR lpValueName, DWORD Reserved, DWORD dwType, const BYTE *lpData, DWORD cbData);
+LONG		RegFlushKey(HKEY hKey);
+LONG		RegCloseKey(HKEY hKey);
+
+// Windows. A window is a client rectangle and a window procedure.
+ATOM		RegisterClass(const WNDCLASS *lpWndClass);
+HWND		CreateWindow(LPCSTR lpClassName, LPCSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HMENU hMenu, HINSTANCE hInstance, LPVOID lpParam);
+HWND		CreateWindowEx(DWORD dwExStyle, LPCSTR lpClassName, LPCSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HMENU hMenu, HINSTANCE hInstance, LPVOID lpParam);
+BOOL		DestroyWindow(HWND hWnd);
+BOOL		IsWindow(HWND hWnd);
+BOOL		IsWindowVisible(HWND hWnd);
+BOOL		UpdateWindow(HWND hWnd);
+BOOL		GetClientRect(HWND hWnd, LPRECT lpRect);
+BOOL		AdjustWindowRect(LPRECT lpRect, DWORD dwStyle, BOOL bMenu);
+BOOL		SetWindowPos(HWND hWnd, HWND hWndInsertAfter, int X, int Y, int cx, int cy, UINT uFlags);
+HWND		GetParent(HWND hWnd);
+HWND		GetDesktopWindow(void);
+HWND		GetForegroundWindow(void);
+BOOL		SetForegroundWindow(HWND hWnd);
+LONG		GetWindowLong(HWND hWnd, int nIndex);
+LONG		SetWindowLong(HWND hWnd, int nIndex, LONG dwNewLong);
+LRESULT		CallWindowProc(WNDPROC lpPrevWndFunc, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
+LRESULT		DefWindowProc(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
+BOOL		EnumChildWindows(HWND hWndParent, WNDENUMPROC lpEnumFunc, LPARAM lParam);
+BOOL		InvalidateRect(HWND hWnd, const RECT *lpRect, BOOL bErase);
+BOOL		ValidateRect(HWND hWnd, const RECT *lpRect);
+BOOL		GetUpdateRect(HWND hWnd, LPRECT lpRect, BOOL bErase);
+HDC			BeginPaint(HWND hWnd, LPPAINTSTRUCT lpPaint);
+BOOL		EndPaint(HWND hWnd, const PAINTSTRUCT *lpPaint);
+BOOL		PeekMessage(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax, UINT wRemoveMsg);
+BOOL		TranslateMessage(const MSG *lpMsg);
+LRESULT		DispatchMessage(const MSG *lpMsg);
+int			GetSystemMetrics(int nIndex);
+HCURSOR		LoadCursor(HINSTANCE hInstance, LPCSTR lpCursorName);
+HICON		LoadIcon(HINSTANCE hInstance, LPCSTR lpIconName);
+SHORT		GetKeyState(int nVirtKey);
+HHOOK		SetWindowsHookEx(int idHook, HOOKPROC lpfn, HINSTANCE hmod, DWORD dwThreadId);
+BOOL		UnhookWindowsHookEx(HHOOK hhk);
+LRESULT		CallNextHookEx(HHOOK hhk, int nCode, WPARAM wParam, LPARAM lParam);
+
+// GDI. There is nothing to draw fonts with, so the font calls fail.
+HDC			GetDC(HWND hWnd);
+int			ReleaseDC(HWND hWnd, HDC hDC);
+HWND		WindowFromDC(HDC hDC);
+HDC			CreateCompatibleDC(HDC hdc);
+BOOL		DeleteDC(HDC hdc);
+HGDIOBJ		SelectObject(HDC hdc, HGDIOBJ h);
+BOOL		DeleteObject(HGDIOBJ ho);
+HGDIOBJ		GetStockObject(int i);
+HBITMAP		CreateBitmap(int nWidth, int nHeight, UINT nPlanes, UINT nBitCount, const void *lpBits);
+int			GetDIBits(HDC hdc, HBITMAP hbm, UINT start, UINT cLines, LPVOID lpvBits, LPBITMAPINFO lpbmi, UINT usage);
+int			GetClipBox(HDC hdc, LPRECT lprect);
+COLORREF	SetTextColor(HDC hdc, COLORREF color);
+COLORREF	SetBkColor(HDC hdc, COLORREF color);
+int			DrawText(HDC hdc, LPCSTR lpchText, int cchText, LPRECT lprc, UINT format);
+HFONT		CreateFontIndirect(const LOGFONT *lplf);
+BOOL		GetTextMetrics(HDC hdc, LPTEXTMETRIC lptm);
+UINT		GetOutlineTextMetrics(HDC hdc, UINT cjCopy, LPOUTLINETEXTMETRIC potm);
+BOOL		GetTextExtentPoint32(HDC hdc, LPCSTR lpString, int c, LPSIZE psizl);
+DWORD		GetGlyphOutline(HDC hdc, UINT uChar, UINT fuFormat, LPGLYPHMETRICS lpgm, DWORD cjBuffer, LPVOID pvBuffer, const MAT2 *lpmat2);
+int			ChoosePixelFormat(HDC hdc, const PIXELFORMATDESCRIPTOR *ppfd);
+int			GetDeviceCaps(HDC hdc, int index);
+BOOL		GetRasterizerCaps(LPRASTERIZER_STATUS lprs, UINT cb);
+
+// WGL; GLDirect itself provides these
+int			APIENTRY wglChoosePixelFormat(HDC a, const PIXELFORMATDESCRIPTOR *ppfd);
+BOOL		APIENTRY wglCopyContext(HGLRC a, HGLRC b, UINT c);
+HGLRC		APIENTRY wglCreateContext(HDC a);
+HGLRC		APIENTRY wglCreateLayerContext(HDC a, int b);
+BOOL		APIENTRY wglDeleteContext(HGLRC a);
+BOOL		APIENTRY wglDescribeLayerPlane(HDC hDC, int iPixelFormat, int iLayerPlane, UINT nBytes, LPLAYERPLANEDESCRIPTOR plpd);
+int			APIENTRY wglDescribePixelFormat(HDC a, int b, UINT c, LPPIXELFORMATDESCRIPTOR d);
+HGLRC		APIENTRY wglGetCurrentContext(void);
+HDC			APIENTRY wglGetCurrentDC(void);
+PROC		APIENTRY wglGetDefaultProcAddress(LPCSTR a);
+int			APIENTRY wglGetLayerPaletteEntries(HDC a, int b, int c, int d, COLORREF *e);
+int			APIENTRY wglGetPixelFormat(HDC a);
+PROC		APIENTRY wglGetProcAddress(LPCSTR a);
+BOOL		APIENTRY wglMakeCurrent(HDC a, HGLRC b);
+BOOL		APIENTRY wglRealizeLayerPalette(HDC a, int b, BOOL c);
+int			APIENTRY wglSetLayerPaletteEntries(HDC a, int b, int c, int d, const COLORREF *e);
+BOOL		APIENTRY wglSetPixelFormat(HDC a, int b, const PIXELFORMATDESCRIPTOR *c);
+BOOL		APIENTRY wglShareLists(HGLRC a, HGLRC b);
+BOOL		APIENTRY wglSwapBuffers(HDC a);
+BOOL		APIENTRY wglSwapLayerBuffers(HDC a, UINT b);
+BOOL		APIENTRY wglUseFontBitmapsA(HDC a, DWORD b, DWORD c, DWORD d);
+BOOL		APIENTRY wglUseFontBitmapsW(HDC a, DWORD b, DWORD c, DWORD d);
+BOOL		APIENTRY wglUseFontOutlinesA(HDC a, DWORD b, DWORD c, DWORD d, FLOAT e, FLOAT f, INT g, LPGLYPHMETRICSFLOAT h);
+BOOL		APIENTRY wglUseFontOutlinesW(HDC a, DWORD b, DWORD c, DWORD d, FLOAT e, FLOAT f, INT g, LPGLYPHMETRICSFLOAT h);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1370 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Win32 functions for the headless build. Windows and device contexts
+*               are plain rectangles, events and threads sit on pthreads, and the
+*               executable stands in for opengl32.dll: DllMain() runs at start-up and
+*               exit, and GetProcAddress() looks in its dynamic symbol table.
+*
+*********************************************************************************/
+
+#define _GNU_SOURCE
+#include <windows.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <fnmatch.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#undef fopen
+
+// ***********************************************************************
+
+#define GLD_HL_WINDOW_MAGIC		0x574E444C		// 'LDNW'
+#define GLD_HL_DC_MAGIC			0x4344444C		// 'LDDC'
+#define GLD_HL_MAX_CLASSES		16
+#define GLD_HL_DEFAULT_WIDTH	640
+#define GLD_HL_DEFAULT_HEIGHT	480
+#define GLD_HL_SCREEN_WIDTH		1024
+#define GLD_HL_SCREEN_HEIGHT	768
+
+typedef enum {
+	GLD_HL_EVENT,
+	GLD_HL_THREAD,
+	GLD_HL_FIND
+} GLD_hlHandleType;
+
+typedef struct {
+	GLD_hlHandleType		Type;
+	// Event
+	BOOL					bManualReset;
+	BOOL					bSignalled;
+	// Thread
+	LPTHREAD_START_ROUTINE	lpStartAddress;
+	LPVOID					lpParameter;
+	BOOL					bClosed;		// Handle closed while running
+	// Find
+	DIR						*pDir;
+	char					szPattern[MAX_PATH];
+} GLD_hlHandle;
+
+typedef struct _GLD_hlWindow GLD_hlWindow;
+
+typedef struct {
+	DWORD					dwMagic;
+	GLD_hlWindow			*pWnd;			// NULL for a memory DC
+	HGDIOBJ					hObject;		// Selected object
+} GLD_hlDC;
+
+struct _GLD_hlWindow {
+	DWORD					dwMagic;
+	RECT					rcClient;
+	WNDPROC					lpfnWndProc;
+	BOOL					bVisible;
+	GLD_hlDC				DC;
+};
+
+typedef struct {
+	char					szName[64];
+	WNDPROC					lpfnWndProc;
+} GLD_hlClass;
+
+// Events and threads share one lock, so that a wait on several of them
+// needs no more than one condition variable.
+static pthread_mutex_t		hlLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t		hlSignal = PTHREAD_COND_INITIALIZER;
+
+static GLD_hlClass			hlClasses[GLD_HL_MAX_CLASSES];
+static GLD_hlWindow			hlDesktop = {GLD_HL_WINDOW_MAGIC, {0, 0, GLD_HL_SCREEN_WIDTH, GLD_HL_SCREEN_HEIGHT}, NULL, TRUE};
+static GLD_hlWindow			*pHLForeground = NULL;
+static int					hlStockObject;
+
+const GUID IID_IUnknown = {0x00000000, 0x0000, 0x0000, {0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46}};
+
+int WINAPI DllMain(HINSTANCE hInstance, DWORD fdwReason, PVOID pvReserved);
+
+// ***********************************************************************
+// Process start and exit stand in for loading and unloading the DLL
+// ***********************************************************************
+
+static void _gldHeadlessDetach(void)
+{
+	DllMain(GetModuleHandle(NULL), DLL_PROCESS_DETACH, NULL);
+}
+
+// ***********************************************************************
+
+static void __attribute__((constructor)) _gldHeadlessAttach(void)
+{
+	hlDesktop.DC.dwMagic	= GLD_HL_DC_MAGIC;
+	hlDesktop.DC.pWnd		= &hlDesktop;
+	DllMain(GetModuleHandle(NULL), DLL_PROCESS_ATTACH, NULL);
+	atexit(_gldHeadlessDetach);
+}
+
+// ***********************************************************************
+// Paths
+// ***********************************************************************
+
+static void _gldHeadlessPath(
+	char *pszDst,
+	const char *pszSrc,
+	size_t nSize)
+{
+	// Driver paths are built with '\\' separators
+	size_t	i;
+
+	for (i=0; pszSrc[i] && i < nSize-1; i++)
+		pszDst[i] = (pszSrc[i] == '\\') ? '/' : pszSrc[i];
+	pszDst[i] = '\0';
+}
+
+// ***********************************************************************
+
+FILE* gldHeadlessFopen(
+	const char *pszFile,
+	const char *pszMode)
+{
+	char	szPath[MAX_PATH];
+	char	szMode[8];
+	int		i, j;
+
+	_gldHeadlessPath(szPath, pszFile, sizeof(szPath));
+	// Text mode is the same as binary
+	for (i=j=0; pszMode[i] && j < sizeof(szMode)-1; i++)
+		if (pszMode[i] != 't')
+			szMode[j++] = pszMode[i];
+	szMode[j] = '\0';
+	return fopen(szPath, szMode);
+}
+
+// ***********************************************************************
+
+DWORD GetModuleFileName(
+	HMODULE hModule,
+	LPSTR lpFilename,
+	DWORD nSize)
+{
+	// Everything is linked into the executable, so the DLL lives where it does
+	char	szPath[MAX_PATH];
+	ssize_t	n;
+	DWORD	i;
+
+	n = readlink("/proc/self/exe", szPath, sizeof(szPath)-1);
+	if (n <= 0 || !nSize)
+		return 0;
+	szPath[n] = '\0';
+	for (i=0; szPath[i] && i < nSize-1; i++)
+		lpFilename[i] = (szPath[i] == '/') ? '\\' : szPath[i];
+	lpFilename[i] = '\0';
+	return i;
+}
+
+// ***********************************************************************
+
+DWORD GetTempPath(
+	DWORD nBufferLength,
+	LPSTR lpBuffer)
+{
+	lstrcpyn(lpBuffer, "\\tmp\\", nBufferLength);
+	return strlen(lpBuffer);
+}
+
+// ***********************************************************************
+
+UINT GetSystemDirectory(
+	LPSTR lpBuffer,
+	UINT uSize)
+{
+	lstrcpyn(lpBuffer, "C:\\WINDOWS\\system32", uSize);
+	return strlen(lpBuffer);
+}
+
+// ***********************************************************************
+
+BOOL CreateDirectory(
+	LPCSTR lpPathName,
+	LPSECURITY_ATTRIBUTES lpSecurityAttributes)
+{
+	char	szPath[MAX_PATH];
+
+	_gldHeadlessPath(szPath, lpPathName, sizeof(szPath));
+	return mkdir(szPath, 0777) == 0;
+}
+
+// ***********************************************************************
+
+BOOL DeleteFile(
+	LPCSTR lpFileName)
+{
+	char	szPath[MAX_PATH];
+
+	_gldHeadlessPath(szPath, lpFileName, sizeof(szPath));
+	return unlink(szPath) == 0;
+}
+
+// ***********************************************************************
+
+BOOL MoveFileEx(
+	LPCSTR lpExistingFileName,
+	LPCSTR lpNewFileName,
+	DWORD dwFlags)
+{
+	char	szFrom[MAX_PATH];
+	char	szTo[MAX_PATH];
+	struct stat	st;
+
+	_gldHeadlessPath(szFrom, lpExistingFileName, sizeof(szFrom));
+	_gldHeadlessPath(szTo, lpNewFileName, sizeof(szTo));
+	if (!(dwFlags & MOVEFILE_REPLACE_EXISTING) && stat(szTo, &st) == 0)
+		return FALSE;
+	return rename(szFrom, szTo) == 0;
+}
+
+// ***********************************************************************
+
+static BOOL _gldHeadlessFindNext(
+	GLD_hlHandle *h,
+	LPWIN32_FIND_DATA lpFindFileData)
+{
+	struct dirent	*pEnt;
+
+	while ((pEnt = readdir(h->pDir)) != NULL) {
+		if (fnmatch(h->szPattern, pEnt->d_name, 0) != 0)
+			continue;
+		ZeroMemory(lpFindFileData, sizeof(*lpFindFileData));
+		lstrcpyn(lpFindFileData->cFileName, pEnt->d_name, MAX_PATH);
+		return TRUE;
+	}
+	return FALSE;
+}
+
+// ***********************************************************************
+
+HANDLE FindFirstFile(
+	LPCSTR lpFileName,
+	LPWIN32_FIND_DATA lpFindFileData)
+{
+	char			szPath[MAX_PATH];
+	char			*pSlash;
+	GLD_hlHandle	*h;
+
+	_gldHeadlessPath(szPath, lpFileName, sizeof(szPath));
+	pSlash = strrchr(szPath, '/');
+	if (!pSlash)
+		return INVALID_HANDLE_VALUE;
+	*pSlash = '\0';
+
+	h = calloc(1, sizeof(*h));
+	h->Type = GLD_HL_FIND;
+	lstrcpyn(h->szPattern, pSlash+1, MAX_PATH);
+	h->pDir = opendir(szPath);
+	if (!h->pDir || !_gldHeadlessFindNext(h, lpFindFileData)) {
+		FindClose(h);
+		return INVALID_HANDLE_VALUE;
+	}
+	return h;
+}
+
+// ***********************************************************************
+
+BOOL FindNextFile(
+	HANDLE hFindFile,
+	LPWIN32_FIND_DATA lpFindFileData)
+{
+	return _gldHeadlessFindNext((GLD_hlHandle*)hFindFile, lpFindFileData);
+}
+
+// ***********************************************************************
+
+BOOL FindClose(
+	HANDLE hFindFile)
+{
+	GLD_hlHandle	*h = (GLD_hlHandle*)hFindFile;
+
+	if (h->pDir)
+		closedir(h->pDir);
+	free(h);
+	return TRUE;
+}
+
+// ***********************************************************************
+
+DWORD GetPrivateProfileString(
+	LPCSTR lpAppName,
+	LPCSTR lpKeyName,
+	LPCSTR lpDefault,
+	LPSTR lpReturnedString,
+	DWORD nSize,
+	LPCSTR lpFileName)
+{
+	FILE	*fp;
+	char	szLine[512];
+	char	*p, *pEq, *pEnd;
+	BOOL	bInSection = FALSE;
+
+	lstrcpyn(lpReturnedString, lpDefault ? lpDefault : "", nSize);
+
+	fp = gldHeadlessFopen(lpFileName, "r");
+	if (!fp)
+		return strlen(lpReturnedString);
+
+	while (fgets(szLine, sizeof(szLine), fp)) {
+		for (p = szLine; isspace((unsigned char)*p); p++)
+			;
+		for (pEnd = p + strlen(p); pEnd > p && isspace((unsigned char)pEnd[-1]); pEnd--)
+			;
+		*pEnd = '\0';
+		if (*p == ';' || *p == '\0')
+			continue;
+		if (*p == '[') {
+			pEnd = strchr(p, ']');
+			if (pEnd)
+				*pEnd = '\0';
+			bInSection = !strcasecmp(p+1, lpAppName);
+			continue;
+		}
+		pEq = strchr(p, '=');
+		if (!bInSection || !pEq)
+			continue;
+		for (pEnd = pEq; pEnd > p && isspace((unsigned char)pEnd[-1]); pEnd--)
+			;
+		*pEnd = '\0';
+		if (strcasecmp(p, lpKeyName))
+			continue;
+		for (p = pEq+1; isspace((unsigned char)*p); p++)
+			;
+		lstrcpyn(lpReturnedString, p, nSize);
+		break;
+	}
+	fclose(fp);
+	return strlen(lpReturnedString);
+}
+
+// ***********************************************************************
+
+UINT GetPrivateProfileInt(
+	LPCSTR lpAppName,
+	LPCSTR lpKeyName,
+	int nDefault,
+	LPCSTR lpFileName)
+{
+	char	szValue[64];
+
+	if (!GetPrivateProfileString(lpAppName, lpKeyName, "", szValue, sizeof(szValue), lpFileName))
+		return nDefault;
+	return (UINT)strtol(szValue, NULL, 0);
+}
+
+// ***********************************************************************
+// Registry. There isn't one; callers fall back to their defaults.
+// ***********************************************************************
+
+LONG RegOpenKeyEx(HKEY hKey, LPCSTR lpSubKey, DWORD ulOptions, DWORD samDesired, PHKEY phkResult)
+{
+	return 2; // ERROR_FILE_NOT_FOUND
+}
+
+LONG RegCreateKeyEx(HKEY hKey, LPCSTR lpSubKey, DWORD Reserved, LPSTR lpClass, DWORD dwOptions, DWORD samDesired, LPSECURITY_ATTRIBUTES lpSecurityAttributes, PHKEY phkResult, LPDWORD lpdwDisposition)
+{
+	return 5; // ERROR_ACCESS_DENIED
+}
+
+LONG RegQueryValueEx(HKEY hKey, LPCSTR lpValueName, LPDWORD lpReserved, LPDWORD lpType, LPBYTE lpData, LPDWORD lpcbData)
+{
+	return 2;
+}
+
+LONG RegSetValueEx(HKEY hKey, LPCSTR lpValueName, DWORD Reserved, DWORD dwType, const BYTE *lpData, DWORD cbData)
+{
+	return 5;
+}
+
+LONG RegFlushKey(HKEY hKey)
+{
+	return ERROR_SUCCESS;
+}
+
+LONG RegCloseKey(HKEY hKey)
+{
+	return ERROR_SUCCESS;
+}
+
+// ***********************************************************************
+// Memory and strings
+// ***********************************************************************
+
+char* _strupr(
+	char *s)
+{
+	char	*p;
+
+	for (p = s; *p; p++)
+		*p = toupper((unsigned char)*p);
+	return s;
+}
+
+// ***********************************************************************
+
+LPSTR lstrcpyn(
+	LPSTR lpString1,
+	LPCSTR lpString2,
+	int iMaxLength)
+{
+	if (iMaxLength <= 0)
+		return lpString1;
+	strncpy(lpString1, lpString2, iMaxLength - 1);
+	lpString1[iMaxLength - 1] = '\0';
+	return lpString1;
+}
+
+// ***********************************************************************
+
+HGLOBAL GlobalAlloc(
+	UINT uFlags,
+	SIZE_T dwBytes)
+{
+	return (uFlags & GMEM_ZEROINIT) ? calloc(1, dwBytes) : malloc(dwBytes);
+}
+
+HGLOBAL GlobalFree(
+	HGLOBAL hMem)
+{
+	free(hMem);
+	return NULL;
+}
+
+SIZE_T GlobalSize(
+	HGLOBAL hMem)
+{
+	return malloc_usable_size(hMem);
+}
+
+// ***********************************************************************
+// Rectangles
+// ***********************************************************************
+
+BOOL SetRect(LPRECT lprc, int xLeft, int yTop, int xRight, int yBottom)
+{
+	lprc->left		= xLeft;
+	lprc->top		= yTop;
+	lprc->right		= xRight;
+	lprc->bottom	= yBottom;
+	return TRUE;
+}
+
+BOOL SetRectEmpty(LPRECT lprc)
+{
+	return SetRect(lprc, 0, 0, 0, 0);
+}
+
+BOOL CopyRect(LPRECT lprcDst, const RECT *lprcSrc)
+{
+	*lprcDst = *lprcSrc;
+	return TRUE;
+}
+
+BOOL OffsetRect(LPRECT lprc, int dx, int dy)
+{
+	return SetRect(lprc, lprc->left + dx, lprc->top + dy, lprc->right + dx, lprc->bottom + dy);
+}
+
+BOOL IsRectEmpty(const RECT *lprc)
+{
+	return (lprc->right <= lprc->left) || (lprc->bottom <= lprc->top);
+}
+
+BOOL UnionRect(LPRECT lprcDst, const RECT *lprcSrc1, const RECT *lprcSrc2)
+{
+	if (IsRectEmpty(lprcSrc1))
+		return CopyRect(lprcDst, lprcSrc2) && !IsRectEmpty(lprcSrc2);
+	if (IsRectEmpty(lprcSrc2))
+		return CopyRect(lprcDst, lprcSrc1);
+	SetRect(lprcDst,
+		min(lprcSrc1->left, lprcSrc2->left), min(lprcSrc1->top, lprcSrc2->top),
+		max(lprcSrc1->right, lprcSrc2->right), max(lprcSrc1->bottom, lprcSrc2->bottom));
+	return TRUE;
+}
+
+BOOL IntersectRect(LPRECT lprcDst, const RECT *lprcSrc1, const RECT *lprcSrc2)
+{
+	SetRect(lprcDst,
+		max(lprcSrc1->left, lprcSrc2->left), max(lprcSrc1->top, lprcSrc2->top),
+		min(lprcSrc1->right, lprcSrc2->right), min(lprcSrc1->bottom, lprcSrc2->bottom));
+	if (IsRectEmpty(lprcDst)) {
+		SetRectEmpty(lprcDst);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+BOOL EqualRect(const RECT *lprc1, const RECT *lprc2)
+{
+	return !memcmp(lprc1, lprc2, sizeof(RECT));
+}
+
+// ***********************************************************************
+// Threads and synchronisation
+// ***********************************************************************
+
+static void* _gldHeadlessThread(
+	void *pParam)
+{
+	GLD_hlHandle	*h = (GLD_hlHandle*)pParam;
+
+	h->lpStartAddress(h->lpParameter);
+
+	pthread_mutex_lock(&hlLock);
+	h->bSignalled = TRUE;
+	pthread_cond_broadcast(&hlSignal);
+	if (h->bClosed)
+		free(h);
+	pthread_mutex_unlock(&hlLock);
+	return NULL;
+}
+
+// ***********************************************************************
+
+HANDLE CreateThread(
+	LPSECURITY_ATTRIBUTES lpThreadAttributes,
+	SIZE_T dwStackSize,
+	LPTHREAD_START_ROUTINE lpStartAddress,
+	LPVOID lpParameter,
+	DWORD dwCreationFlags,
+	LPDWORD lpThreadId)
+{
+	GLD_hlHandle	*h;
+	pthread_t		thread;
+
+	h = calloc(1, sizeof(*h));
+	h->Type				= GLD_HL_THREAD;
+	h->bManualReset		= TRUE;
+	h->lpStartAddress	= lpStartAddress;
+	h->lpParameter		= lpParameter;
+	if (pthread_create(&thread, NULL, _gldHeadlessThread, h)) {
+		free(h);
+		return NULL;
+	}
+	pthread_detach(thread);
+	if (lpThreadId)
+		*lpThreadId = 0;
+	return h;
+}
+
+// ***********************************************************************
+
+HANDLE CreateEvent(
+	LPSECURITY_ATTRIBUTES lpEventAttributes,
+	BOOL bManualReset,
+	BOOL bInitialState,
+	LPCSTR lpName)
+{
+	GLD_hlHandle	*h;
+
+	h = calloc(1, sizeof(*h));
+	h->Type			= GLD_HL_EVENT;
+	h->bManualReset	= bManualReset;
+	h->bSignalled	= bInitialState;
+	return h;
+}
+
+// ***********************************************************************
+
+BOOL SetEvent(
+	HANDLE hEvent)
+{
+	pthread_mutex_lock(&hlLock);
+	((GLD_hlHandle*)hEvent)->bSignalled = TRUE;
+	pthread_cond_broadcast(&hlSignal);
+	pthread_mutex_unlock(&hlLock);
+	return TRUE;
+}
+
+// ***********************************************************************
+
+BOOL ResetEvent(
+	HANDLE hEvent)
+{
+	pthread_mutex_lock(&hlLock);
+	((GLD_hlHandle*)hEvent)->bSignalled = FALSE;
+	pthread_mutex_unlock(&hlLock);
+	return TRUE;
+}
+
+// ***********************************************************************
+
+BOOL CloseHandle(
+	HANDLE hObject)
+{
+	GLD_hlHandle	*h = (GLD_hlHandle*)hObject;
+
+	if (!h)
+		return FALSE;
+	pthread_mutex_lock(&hlLock);
+	// A running thread frees its own handle when it returns
+	if (h->Type == GLD_HL_THREAD && !h->bSignalled)
+		h->bClosed = TRUE;
+	else
+		free(h);
+	pthread_mutex_unlock(&hlLock);
+	return TRUE;
+}
+
+// ***********************************************************************
+
+DWORD WaitForMultipleObjects(
+	DWORD nCount,
+	const HANDLE *lpHandles,
+	BOOL bWaitAll,
+	DWORD dwMilliseconds)
+{
+	struct timespec	ts;
+	GLD_hlHandle	*h;
+	DWORD			i, nSignalled, dwFirst;
+	DWORD			dwResult = WAIT_TIMEOUT;
+
+	if (dwMilliseconds != INFINITE) {
+		clock_gettime(CLOCK_REALTIME, &ts);
+		ts.tv_sec	+= dwMilliseconds / 1000;
+		ts.tv_nsec	+= (dwMilliseconds % 1000) * 1000000;
+		if (ts.tv_nsec >= 1000000000) {
+			ts.tv_sec++;
+			ts.tv_nsec -= 1000000000;
+		}
+	}
+
+	pthread_mutex_lock(&hlLock);
+	for (;;) {
+		nSignalled = 0;
+		dwFirst = nCount;
+		for (i=0; i<nCount; i++) {
+			if (((GLD_hlHandle*)lpHandles[i])->bSignalled) {
+				nSignalled++;
+				if (dwFirst == nCount)
+					dwFirst = i;
+			}
+		}
+		if (bWaitAll ? (nSignalled == nCount) : (nSignalled > 0)) {
+			// Auto-reset events are consumed by the wait that sees them
+			for (i=0; i<nCount; i++) {
+				h = (GLD_hlHandle*)lpHandles[i];
+				if ((bWaitAll || i == dwFirst) && !h->bManualReset)
+					h->bSignalled = FALSE;
+			}
+			dwResult = WAIT_OBJECT_0 + (bWaitAll ? 0 : dwFirst);
+			break;
+		}
+		if (dwMilliseconds == INFINITE)
+			pthread_cond_wait(&hlSignal, &hlLock);
+		else if (pthread_cond_timedwait(&hlSignal, &hlLock, &ts) == ETIMEDOUT)
+			break;
+	}
+	pthread_mutex_unlock(&hlLock);
+	return dwResult;
+}
+
+// ***********************************************************************
+
+DWORD WaitForSingleObject(
+	HANDLE hHandle,
+	DWORD dwMilliseconds)
+{
+	return WaitForMultipleObjects(1, &hHandle, FALSE, dwMilliseconds);
+}
+
+// ***********************************************************************
+
+void Sleep(
+	DWORD dwMilliseconds)
+{
+	struct timespec	ts;
+
+	if (!dwMilliseconds) {
+		sched_yield();
+		return;
+	}
+	ts.tv_sec	= dwMilliseconds / 1000;
+	ts.tv_nsec	= (dwMilliseconds % 1000) * 1000000;
+	nanosleep(&ts, NULL);
+}
+
+// ***********************************************************************
+
+DWORD GetCurrentThreadId(void)
+{
+	return (DWORD)syscall(SYS_gettid);
+}
+
+DWORD GetCurrentProcessId(void)
+{
+	return (DWORD)getpid();
+}
+
+// ***********************************************************************
+
+void InitializeCriticalSection(
+	LPCRITICAL_SECTION lpCriticalSection)
+{
+	pthread_mutexattr_t	attr;
+
+	lpCriticalSection->pMutex = malloc(sizeof(pthread_mutex_t));
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init((pthread_mutex_t*)lpCriticalSection->pMutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+}
+
+void DeleteCriticalSection(
+	LPCRITICAL_SECTION lpCriticalSection)
+{
+	if (!lpCriticalSection->pMutex)
+		return;
+	pthread_mutex_destroy((pthread_mutex_t*)lpCriticalSection->pMutex);
+	free(lpCriticalSection->pMutex);
+	lpCriticalSection->pMutex = NULL;
+}
+
+void EnterCriticalSection(
+	LPCRITICAL_SECTION lpCriticalSection)
+{
+	pthread_mutex_lock((pthread_mutex_t*)lpCriticalSection->pMutex);
+}
+
+void LeaveCriticalSection(
+	LPCRITICAL_SECTION lpCriticalSection)
+{
+	pthread_mutex_unlock((pthread_mutex_t*)lpCriticalSection->pMutex);
+}
+
+// ***********************************************************************
+
+DWORD TlsAlloc(void)
+{
+	pthread_key_t	key;
+
+	if (pthread_key_create(&key, NULL))
+		return TLS_OUT_OF_INDEXES;
+	return (DWORD)key;
+}
+
+BOOL TlsFree(DWORD dwTlsIndex)
+{
+	return pthread_key_delete((pthread_key_t)dwTlsIndex) == 0;
+}
+
+LPVOID TlsGetValue(DWORD dwTlsIndex)
+{
+	return pthread_getspecific((pthread_key_t)dwTlsIndex);
+}
+
+BOOL TlsSetValue(DWORD dwTlsIndex, LPVOID lpTlsValue)
+{
+	return pthread_setspecific((pthread_key_t)dwTlsIndex, lpTlsValue) == 0;
+}
+
+// ***********************************************************************
+// System
+// ***********************************************************************
+
+void GetSystemInfo(
+	LPSYSTEM_INFO lpSystemInfo)
+{
+	ZeroMemory(lpSystemInfo, sizeof(*lpSystemInfo));
+	lpSystemInfo->dwPageSize				= sysconf(_SC_PAGESIZE);
+	lpSystemInfo->dwNumberOfProcessors		= sysconf(_SC_NPROCESSORS_ONLN);
+	lpSystemInfo->dwAllocationGranularity	= 65536;
+}
+
+DWORD GetVersion(void)
+{
+	return 0x0A280105;	// XP: 5.1, build 2600
+}
+
+BOOL GetVersionEx(
+	LPOSVERSIONINFO lpVersionInfo)
+{
+	lpVersionInfo->dwMajorVersion	= 5;
+	lpVersionInfo->dwMinorVersion	= 1;
+	lpVersionInfo->dwBuildNumber	= 2600;
+	lpVersionInfo->dwPlatformId		= VER_PLATFORM_WIN32_NT;
+	lpVersionInfo->szCSDVersion[0]	= '\0';
+	return TRUE;
+}
+
+// ***********************************************************************
+
+DWORD GetTickCount(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (DWORD)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+BOOL QueryPerformanceCounter(
+	LARGE_INTEGER *lpPerformanceCount)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	lpPerformanceCount->QuadPart = (LONGLONG)ts.tv_sec * 1000000000 + ts.tv_nsec;
+	return TRUE;
+}
+
+BOOL QueryPerformanceFrequency(
+	LARGE_INTEGER *lpFrequency)
+{
+	lpFrequency->QuadPart = 1000000000;
+	return TRUE;
+}
+
+// ***********************************************************************
+
+BOOL IsDebuggerPresent(void)
+{
+	return FALSE;
+}
+
+void OutputDebugString(
+	LPCSTR lpOutputString)
+{
+	fputs(lpOutputString, stderr);
+}
+
+int MessageBox(
+	HWND hWnd,
+	LPCSTR lpText,
+	LPCSTR lpCaption,
+	UINT uType)
+{
+	fprintf(stderr, "%s: %s\n", lpCaption ? lpCaption : "Error", lpText);
+	return 1; // IDOK
+}
+
+DWORD GetLastError(void)
+{
+	return errno;
+}
+
+// ***********************************************************************
+// Modules. The driver and the application are one executable; the
+// dynamic symbol table stands in for the DLL's exports.
+// ***********************************************************************
+
+HMODULE LoadLibrary(
+	LPCSTR lpLibFileName)
+{
+	return dlopen(NULL, RTLD_NOW);
+}
+
+BOOL FreeLibrary(
+	HMODULE hLibModule)
+{
+	return TRUE;
+}
+
+FARPROC GetProcAddress(
+	HMODULE hModule,
+	LPCSTR lpProcName)
+{
+	return (FARPROC)dlsym(hModule ? hModule : RTLD_DEFAULT, lpProcName);
+}
+
+HMODULE GetModuleHandle(
+	LPCSTR lpModuleName)
+{
+	static int	iModule;
+
+	// Only the executable itself is loaded
+	return lpModuleName ? NULL : (HMODULE)&iModule;
+}
+
+// ***********************************************************************
+// Windows. They are rectangles with a window procedure; there is no
+// message queue.
+// ***********************************************************************
+
+static GLD_hlWindow* _gldHeadlessWindow(
+	HWND hWnd)
+{
+	GLD_hlWindow	*pWnd = (GLD_hlWindow*)hWnd;
+
+	return (pWnd && pWnd->dwMagic == GLD_HL_WINDOW_MAGIC) ? pWnd : NULL;
+}
+
+// ***********************************************************************
+
+ATOM RegisterClass(
+	const WNDCLASS *lpWndClass)
+{
+	int		i;
+
+	for (i=0; i<GLD_HL_MAX_CLASSES; i++) {
+		if (!hlClasses[i].szName[0] || !strcmp(hlClasses[i].szName, lpWndClass->lpszClassName)) {
+			lstrcpyn(hlClasses[i].szName, lpWndClass->lpszClassName, sizeof(hlClasses[i].szName));
+			hlClasses[i].lpfnWndProc = lpWndClass->lpfnWndProc;
+			return (ATOM)(i+1);
+		}
+	}
+	return 0;
+}
+
+// ***********************************************************************
+
+HWND CreateWindowEx(
+	DWORD dwExStyle,
+	LPCSTR lpClassName,
+	LPCSTR lpWindowName,
+	DWORD dwStyle,
+	int X,
+	int Y,
+	int nWidth,
+	int nHeight,
+	HWND hWndParent,
+	HMENU hMenu,
+	HINSTANCE hInstance,
+	LPVOID lpParam)
+{
+	GLD_hlWindow	*pWnd;
+	int				i;
+
+	pWnd = calloc(1, sizeof(*pWnd));
+	pWnd->dwMagic		= GLD_HL_WINDOW_MAGIC;
+	pWnd->bVisible		= (dwStyle & WS_VISIBLE) != 0;
+	pWnd->DC.dwMagic	= GLD_HL_DC_MAGIC;
+	pWnd->DC.pWnd		= pWnd;
+	if (nWidth == CW_USEDEFAULT || nWidth <= 0)
+		nWidth = (nWidth == CW_USEDEFAULT) ? GLD_HL_DEFAULT_WIDTH : 0;
+	if (nHeight == CW_USEDEFAULT || nHeight <= 0)
+		nHeight = (nHeight == CW_USEDEFAULT) ? GLD_HL_DEFAULT_HEIGHT : 0;
+	SetRect(&pWnd->rcClient, 0, 0, nWidth, nHeight);
+
+	for (i=0; i<GLD_HL_MAX_CLASSES; i++)
+		if (!strcmp(hlClasses[i].szName, lpClassName))
+			pWnd->lpfnWndProc = hlClasses[i].lpfnWndProc;
+
+	if (pWnd->bVisible)
+		pHLForeground = pWnd;
+	return (HWND)pWnd;
+}
+
+HWND CreateWindow(LPCSTR lpClassName, LPCSTR lpWindowName, DWORD dwStyle, int X, int Y, int nWidth, int nHeight, HWND hWndParent, HMENU hMenu, HINSTANCE hInstance, LPVOID lpParam)
+{
+	return CreateWindowEx(0, lpClassName, lpWindowName, dwStyle, X, Y, nWidth, nHeight, hWndParent, hMenu, hInstance, lpParam);
+}
+
+// ***********************************************************************
+
+BOOL DestroyWindow(
+	HWND hWnd)
+{
+	GLD_hlWindow	*pWnd = _gldHeadlessWindow(hWnd);
+
+	if (!pWnd || pWnd == &hlDesktop)
+		return FALSE;
+	if (pWnd->lpfnWndProc)
+		pWnd->lpfnWndProc(hWnd, WM_DESTROY, 0, 0);
+	if (pHLForeground == pWnd)
+		pHLForeground = NULL;
+	pWnd->dwMagic = 0;
+	free(pWnd);
+	return TRUE;
+}
+
+// ***********************************************************************
+
+BOOL IsWindow(HWND hWnd)
+{
+	return _gldHeadlessWindow(hWnd) != NULL;
+}
+
+BOOL IsWindowVisible(HWND hWnd)
+{
+	GLD_hlWindow	*pWnd = _gldHeadlessWindow(hWnd);
+
+	return pWnd && pWnd->bVisible;
+}
+
+BOOL UpdateWindow(HWND hWnd)
+{
+	return IsWindow(hWnd);
+}
+
+BOOL GetClientRect(HWND hWnd, LPRECT lpRect)
+{
+	GLD_hlWindow	*pWnd = _gldHeadlessWindow(hWnd);
+
+	if (!pWnd)
+		return FALSE;
+	*lpRect = pWnd->rcClient;
+	return TRUE;
+}
+
+BOOL AdjustWindowRect(LPRECT lpRect, DWORD dwStyle, BOOL bMenu)
+{
+	// No frames
+	return TRUE;
+}
+
+BOOL SetWindowPos(HWND hWnd, HWND hWndInsertAfter, int X, int Y, int cx, int cy, UINT uFlags)
+{
+	GLD_hlWindow	*pWnd = _gldHeadlessWindow(hWnd);
+
+	if (!pWnd)
+		return FALSE;
+	if (!(uFlags & SWP_NOSIZE)) {
+		SetRect(&pWnd->rcClient, 0, 0, cx, cy);
+		if (pWnd->lpfnWndProc)
+			pWnd->lpfnWndProc(hWnd, WM_SIZE, 0, MAKELONG(cx, cy));
+	}
+	return TRUE;
+}
+
+HWND GetParent(HWND hWnd)
+{
+	return NULL;
+}
+
+HWND GetDesktopWindow(void)
+{
+	return (HWND)&hlDesktop;
+}
+
+HWND GetForegroundWindow(void)
+{
+	return (HWND)pHLForeground;
+}
+
+BOOL SetForegroundWindow(HWND hWnd)
+{
+	pHLForeground = _gldHeadlessWindow(hWnd);
+	return pHLForeground != NULL;
+}
+
+// ***********************************************************************
+
+LONG GetWindowLong(
+	HWND hWnd,
+	int nIndex)
+{
+	GLD_hlWindow	*pWnd = _gldHeadlessWindow(hWnd);
+
+	// Window procedures are stored as LONGs, as on 32-bit Windows. The
+	// executables are linked without PIE so that code addresses fit.
+	if (!pWnd || nIndex != GWL_WNDPROC)
+		return 0;
+	return (LONG)(LONG_PTR)pWnd->lpfnWndProc;
+}
+
+LONG SetWindowLong(
+	HWND hWnd,
+	int nIndex,
+	LONG dwNewLong)
+{
+	GLD_hlWindow	*pWnd = _gldHeadlessWindow(hWnd);
+	LONG			lOld;
+
+	if (!pWnd || nIndex != GWL_WNDPROC)
+		return 0;
+	lOld = GetWindowLong(hWnd, nIndex);
+	pWnd->lpfnWndProc = (WNDPROC)(ULONG_PTR)(DWORD)dwNewLong;
+	return lOld;
+}
+
+// ***********************************************************************
+
+LRESULT CallWindowProc(
+	WNDPROC lpPrevWndFunc,
+	HWND hWnd,
+	UINT Msg,
+	WPARAM wParam,
+	LPARAM lParam)
+{
+	return lpPrevWndFunc ? lpPrevWndFunc(hWnd, Msg, wParam, lParam) : 0;
+}
+
+LRESULT DefWindowProc(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
+{
+	return 0;
+}
+
+BOOL EnumChildWindows(HWND hWndParent, WNDENUMPROC lpEnumFunc, LPARAM lParam)
+{
+	return TRUE;
+}
+
+BOOL InvalidateRect(HWND hWnd, const RECT *lpRect, BOOL bErase)
+{
+	return TRUE;
+}
+
+BOOL ValidateRect(HWND hWnd, const RECT *lpRect)
+{
+	return TRUE;
+}
+
+BOOL GetUpdateRect(HWND hWnd, LPRECT lpRect, BOOL bErase)
+{
+	if (lpRect)
+		SetRectEmpty(lpRect);
+	return FALSE;
+}
+
+HDC BeginPaint(HWND hWnd, LPPAINTSTRUCT lpPaint)
+{
+	ZeroMemory(lpPaint, sizeof(*lpPaint));
+	lpPaint->hdc = GetDC(hWnd);
+	GetClientRect(hWnd, &lpPaint->rcPaint);
+	return lpPaint->hdc;
+}
+
+BOOL EndPaint(HWND hWnd, const PAINTSTRUCT *lpPaint)
+{
+	return TRUE;
+}
+
+BOOL PeekMessage(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax, UINT wRemoveMsg)
+{
+	return FALSE;
+}
+
+BOOL TranslateMessage(const MSG *lpMsg)
+{
+	return FALSE;
+}
+
+LRESULT DispatchMessage(const MSG *lpMsg)
+{
+	GLD_hlWindow	*pWnd = _gldHeadlessWindow(lpMsg->hwnd);
+
+	if (!pWnd || !pWnd->lpfnWndProc)
+		return 0;
+	return pWnd->lpfnWndProc(lpMsg->hwnd, lpMsg->message, lpMsg->wParam, lpMsg->lParam);
+}
+
+int GetSystemMetrics(int nIndex)
+{
+	switch (nIndex) {
+	case SM_CXSCREEN:	return GLD_HL_SCREEN_WIDTH;
+	case SM_CYSCREEN:	return GLD_HL_SCREEN_HEIGHT;
+	}
+	return 0;
+}
+
+HCURSOR LoadCursor(HINSTANCE hInstance, LPCSTR lpCursorName)
+{
+	return NULL;
+}
+
+HICON LoadIcon(HINSTANCE hInstance, LPCSTR lpIconName)
+{
+	return NULL;
+}
+
+SHORT GetKeyState(int nVirtKey)
+{
+	return 0;
+}
+
+HHOOK SetWindowsHookEx(int idHook, HOOKPROC lpfn, HINSTANCE hmod, DWORD dwThreadId)
+{
+	// Never called; there is no keyboard
+	return (HHOOK)lpfn;
+}
+
+BOOL UnhookWindowsHookEx(HHOOK hhk)
+{
+	return TRUE;
+}
+
+LRESULT CallNextHookEx(HHOOK hhk, int nCode, WPARAM wParam, LPARAM lParam)
+{
+	return 0;
+}
+
+// ***********************************************************************
+// GDI. Device contexts only tie the GL to a window; there are no fonts
+// and nothing is drawn.
+// ***********************************************************************
+
+HDC GetDC(
+	HWND hWnd)
+{
+	GLD_hlWindow	*pWnd = hWnd ? _gldHeadlessWindow(hWnd) : &hlDesktop;
+
+	return pWnd ? (HDC)&pWnd->DC : NULL;
+}
+
+int ReleaseDC(HWND hWnd, HDC hDC)
+{
+	return 1;
+}
+
+HWND WindowFromDC(
+	HDC hDC)
+{
+	GLD_hlDC	*pDC = (GLD_hlDC*)hDC;
+
+	if (!pDC || pDC->dwMagic != GLD_HL_DC_MAGIC)
+		return NULL;
+	return (HWND)pDC->pWnd;
+}
+
+HDC CreateCompatibleDC(
+	HDC hdc)
+{
+	GLD_hlDC	*pDC;
+
+	pDC = calloc(1, sizeof(*pDC));
+	pDC->dwMagic = GLD_HL_DC_MAGIC;
+	return (HDC)pDC;
+}
+
+BOOL DeleteDC(
+	HDC hdc)
+{
+	GLD_hlDC	*pDC = (GLD_hlDC*)hdc;
+
+	if (!pDC || pDC->pWnd)
+		return FALSE;
+	pDC->dwMagic = 0;
+	free(pDC);
+	return TRUE;
+}
+
+HGDIOBJ SelectObject(
+	HDC hdc,
+	HGDIOBJ h)
+{
+	GLD_hlDC	*pDC = (GLD_hlDC*)hdc;
+	HGDIOBJ		hOld;
+
+	if (!pDC)
+		return NULL;
+	hOld = pDC->hObject;
+	pDC->hObject = h;
+	return hOld;
+}
+
+BOOL DeleteObject(HGDIOBJ ho)
+{
+	return TRUE;
+}
+
+HGDIOBJ GetStockObject(int i)
+{
+	return (HGDIOBJ)&hlStockObject;
+}
+
+HBITMAP CreateBitmap(int nWidth, int nHeight, UINT nPlanes, UINT nBitCount, const void *lpBits)
+{
+	return NULL;
+}
+
+int GetDIBits(HDC hdc, HBITMAP hbm, UINT start, UINT cLines, LPVOID lpvBits, LPBITMAPINFO lpbmi, UINT usage)
+{
+	return 0;
+}
+
+int GetClipBox(HDC hdc, LPRECT lprect)
+{
+	HWND	hWnd = WindowFromDC(hdc);
+
+	if (!hWnd || !GetClientRect(hWnd, lprect))
+		return ERROR;
+	return 2; // SIMPLEREGION
+}
+
+COLORREF SetTextColor(HDC hdc, COLORREF color)
+{
+	return 0;
+}
+
+COLORREF SetBkColor(HDC hdc, COLORREF color)
+{
+	return 0;
+}
+
+int DrawText(HDC hdc, LPCSTR lpchText, int cchText, LPRECT lprc, UINT format)
+{
+	return 0;
+}
+
+HFONT CreateFontIndirect(const LOGFONT *lplf)
+{
+	return NULL;
+}
+
+BOOL GetTextMetrics(HDC hdc, LPTEXTMETRIC lptm)
+{
+	return FALSE;
+}
+
+UINT GetOutlineTextMetrics(HDC hdc, UINT cjCopy, LPOUTLINETEXTMETRIC potm)
+{
+	return 0;
+}
+
+BOOL GetTextExtentPoint32(HDC hdc, LPCSTR lpString, int c, LPSIZE psizl)
+{
+	return FALSE;
+}
+
+DWORD GetGlyphOutline(HDC hdc, UINT uChar, UINT fuFormat, LPGLYPHMETRICS lpgm, DWORD cjBuffer, LPVOID pvBuffer, const MAT2 *lpmat2)
+{
+	return GDI_ERROR;
+}
+
+int ChoosePixelFormat(HDC hdc, const PIXELFORMATDESCRIPTOR *ppfd)
+{
+	return 0;
+}
+
+int GetDeviceCaps(
+	HDC hdc,
+	int index)
+{
+	return (index == BITSPIXEL) ? 32 : 0;
+}
+
+BOOL GetRasterizerCaps(
+	LPRASTERIZER_STATUS lprs,
+	UINT cb)
+{
+	lprs->nSize			= sizeof(*lprs);
+	lprs->wFlags		= 0;
+	lprs->nLanguageID	= 0;
+	return TRUE;
+}
@@ -0,0 +1,322 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Checks the fast pixel span converters in image.c against the general
+*               float path for every format/type pair they cover, and times both.
+*
+*********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "glheader.h"
+#include "colormac.h"
+#include "image.h"
+#include "macros.h"
+#include "mtypes.h"
+
+// ***********************************************************************
+
+#define GLD_SPAN_MAX			256		// Longest span checked and timed
+#define GLD_SPAN_TRIALS			64		// Random spans per check
+#define GLD_SPAN_REPEATS		4000	// Spans per timing
+
+// The (format, type) pairs image.c converts without floats, and the two
+// GL_UNSIGNED_BYTE pairs _mesa_unpack_float_color_span() copies directly
+typedef struct {
+	GLenum			Format;
+	GLenum			Type;
+	const char		*pszName;
+} GLD_spanPair;
+
+static const GLD_spanPair gldSpanPairs[] = {
+	{ GL_RGBA,		GL_UNSIGNED_BYTE,				"RGBA ubyte" },
+	{ GL_BGRA,		GL_UNSIGNED_BYTE,				"BGRA ubyte" },
+	{ GL_BGR,		GL_UNSIGNED_BYTE,				"BGR ubyte" },
+	{ GL_ABGR_EXT,	GL_UNSIGNED_BYTE,				"ABGR ubyte" },
+	{ GL_RGBA,		GL_UNSIGNED_INT_8_8_8_8,		"RGBA 8888" },
+	{ GL_RGBA,		GL_UNSIGNED_INT_8_8_8_8_REV,	"RGBA 8888_REV" },
+	{ GL_BGRA,		GL_UNSIGNED_INT_8_8_8_8,		"BGRA 8888" },
+	{ GL_BGRA,		GL_UNSIGNED_INT_8_8_8_8_REV,	"BGRA 8888_REV" },
+	{ GL_RGB,		GL_UNSIGNED_SHORT_5_6_5,		"RGB 565" },
+	{ GL_RGB,		GL_UNSIGNED_SHORT_5_6_5_REV,	"RGB 565_REV" },
+	{ GL_RGBA,		GL_UNSIGNED_SHORT_4_4_4_4,		"RGBA 4444" },
+	{ GL_RGBA,		GL_UNSIGNED_SHORT_4_4_4_4_REV,	"RGBA 4444_REV" },
+	{ GL_BGRA,		GL_UNSIGNED_SHORT_4_4_4_4,		"BGRA 4444" },
+	{ GL_BGRA,		GL_UNSIGNED_SHORT_4_4_4_4_REV,	"BGRA 4444_REV" },
+	{ GL_RGBA,		GL_UNSIGNED_SHORT_5_5_5_1,		"RGBA 5551" },
+	{ GL_RGBA,		GL_UNSIGNED_SHORT_1_5_5_5_REV,	"RGBA 1555_REV" },
+	{ GL_BGRA,		GL_UNSIGNED_SHORT_5_5_5_1,		"BGRA 5551" },
+	{ GL_BGRA,		GL_UNSIGNED_SHORT_1_5_5_5_REV,	"BGRA 1555_REV" },
+	{ GL_RGBA,		GL_FLOAT,						"RGBA float" },
+	{ GL_RGB,		GL_FLOAT,						"RGB float" },
+};
+
+#define GLD_SPAN_PAIRS			(sizeof(gldSpanPairs) / sizeof(gldSpanPairs[0]))
+
+typedef struct {
+	GLcontext					*ctx;
+	struct gl_pixelstore_attrib	Packing;
+	struct gl_pixelstore_attrib	Swapped;
+	GLuint						uSlowOps;	// Transfer ops that change nothing
+	GLuint						uSeed;
+	int							iFailures;
+} GLD_spanTest;
+
+// ***********************************************************************
+
+static GLuint _gldSpanRandom(
+	GLD_spanTest *t)
+{
+	t->uSeed = t->uSeed * 1664525 + 1013904223;
+	return t->uSeed >> 8;
+}
+
+// ***********************************************************************
+
+static void _gldSpanFillBytes(
+	GLD_spanTest *t,
+	GLubyte *p,
+	GLuint nBytes)
+{
+	GLuint	i;
+
+	for (i=0; i<nBytes; i++)
+		p[i] = (GLubyte)_gldSpanRandom(t);
+}
+
+// ***********************************************************************
+
+static void _gldSpanFillFloats(
+	GLD_spanTest *t,
+	GLfloat *p,
+	GLuint nFloats,
+	GLboolean bOutOfRange)
+{
+	// Mostly exact k/255 values, which sit on the rounding boundaries, and
+	// some outside [0,1] for the clamps
+	GLuint	i, r;
+
+	for (i=0; i<nFloats; i++) {
+		r = _gldSpanRandom(t);
+		if (r & 1)
+			p[i] = (GLfloat)((r >> 1) & 0xff) / 255.0F;
+		else if (bOutOfRange && (r & 2))
+			p[i] = (GLfloat)((r >> 2) & 0xfff) / 1365.0F - 1.0F;
+		else
+			p[i] = (GLfloat)((r >> 2) & 0xffff) / 65535.0F;
+	}
+}
+
+// ***********************************************************************
+
+static void _gldSpanCompare(
+	GLD_spanTest *t,
+	const char *pszWhat,
+	const GLD_spanPair *p,
+	GLuint n,
+	const void *pFast,
+	const void *pSlow,
+	GLuint nBytes)
+{
+	const GLubyte	*a = (const GLubyte *)pFast;
+	const GLubyte	*b = (const GLubyte *)pSlow;
+	GLuint			i;
+
+	if (!memcmp(a, b, nBytes))
+		return;
+	for (i=0; a[i] == b[i]; i++)
+		;
+	printf("FAIL %s %s, %u pixels: byte %u is 0x%02x, expected 0x%02x\n",
+		pszWhat, p->pszName, n, i, a[i], b[i]);
+	t->iFailures++;
+}
+
+// ***********************************************************************
+
+static void _gldSpanCheckPair(
+	GLD_spanTest *t,
+	const GLD_spanPair *p)
+{
+	static GLubyte	Client[GLD_SPAN_MAX * 16];
+	static GLubyte	Fast[GLD_SPAN_MAX * 16], Slow[GLD_SPAN_MAX * 16];
+	static GLchan	Rgba[GLD_SPAN_MAX][4];
+	static GLfloat	Floats[GLD_SPAN_MAX][4];
+	const GLint		iBytes = _mesa_bytes_per_pixel(p->Format, p->Type);
+	GLuint			uTrial, n, nComps, i;
+	GLboolean		bSwap, bClamp;
+
+	for (uTrial=0; uTrial<GLD_SPAN_TRIALS; uTrial++) {
+		// Every length up to a few SSE2 blocks, then random ones
+		n = (uTrial < 40) ? uTrial + 1 : 1 + _gldSpanRandom(t) % GLD_SPAN_MAX;
+		bSwap = (p->Type == GL_UNSIGNED_BYTE) && (uTrial & 1);
+
+		// Client pixels to GLchan, for both destination formats
+		if (p->Type == GL_FLOAT)
+			_gldSpanFillFloats(t, (GLfloat *)Client, n * iBytes / sizeof(GLfloat), GL_TRUE);
+		else
+			_gldSpanFillBytes(t, Client, n * iBytes);
+		for (nComps=3; nComps<=4; nComps++) {
+			const GLenum	dstFormat = (nComps == 4) ? GL_RGBA : GL_RGB;
+			memset(Fast, 0, sizeof(Fast));
+			memset(Slow, 0, sizeof(Slow));
+			_mesa_unpack_chan_color_span(t->ctx, n, dstFormat, (GLchan *)Fast,
+				p->Format, p->Type, Client, bSwap ? &t->Swapped : &t->Packing, 0);
+			_mesa_unpack_chan_color_span(t->ctx, n, dstFormat, (GLchan *)Slow,
+				p->Format, p->Type, Client, bSwap ? &t->Swapped : &t->Packing, t->uSlowOps);
+			_gldSpanCompare(t, nComps == 4 ? "unpack_chan RGBA" : "unpack_chan RGB",
+				p, n, Fast, Slow, n * nComps * sizeof(GLchan));
+		}
+
+		// Client pixels to float, clamped and not
+		for (bClamp=0; bClamp<=1; bClamp++) {
+			memset(Fast, 0, sizeof(Fast));
+			memset(Slow, 0, sizeof(Slow));
+			_mesa_unpack_float_color_span(t->ctx, n, GL_RGBA, (GLfloat *)Fast,
+				p->Format, p->Type, Client, bSwap ? &t->Swapped : &t->Packing, 0, bClamp);
+			_mesa_unpack_float_color_span(t->ctx, n, GL_RGBA, (GLfloat *)Slow,
+				p->Format, p->Type, Client, bSwap ? &t->Swapped : &t->Packing, t->uSlowOps, bClamp);
+			_gldSpanCompare(t, bClamp ? "unpack_float clamped" : "unpack_float",
+				p, n, Fast, Slow, n * 4 * sizeof(GLfloat));
+		}
+
+		// GLchan to client pixels
+		_gldSpanFillBytes(t, (GLubyte *)Rgba, n * 4 * sizeof(GLchan));
+		memset(Fast, 0, sizeof(Fast));
+		memset(Slow, 0, sizeof(Slow));
+		_mesa_pack_rgba_span(t->ctx, n, (CONST GLchan (*)[4])Rgba, p->Format, p->Type,
+			Fast, bSwap ? &t->Swapped : &t->Packing, 0);
+		_mesa_pack_rgba_span(t->ctx, n, (CONST GLchan (*)[4])Rgba, p->Format, p->Type,
+			Slow, bSwap ? &t->Swapped : &t->Packing, t->uSlowOps);
+		_gldSpanCompare(t, "pack_rgba", p, n, Fast, Slow, n * iBytes);
+
+		// The fast pack has to match the float packer it replaces
+		for (i=0; i<n; i++) {
+			Floats[i][RCOMP] = CHAN_TO_FLOAT(Rgba[i][RCOMP]);
+			Floats[i][GCOMP] = CHAN_TO_FLOAT(Rgba[i][GCOMP]);
+			Floats[i][BCOMP] = CHAN_TO_FLOAT(Rgba[i][BCOMP]);
+			Floats[i][ACOMP] = CHAN_TO_FLOAT(Rgba[i][ACOMP]);
+		}
+		memset(Slow, 0, sizeof(Slow));
+		_mesa_pack_float_rgba_span(t->ctx, n, (CONST GLfloat (*)[4])Floats, p->Format, p->Type,
+			Slow, bSwap ? &t->Swapped : &t->Packing, 0);
+		_gldSpanCompare(t, "pack_rgba vs pack_float_rgba", p, n, Fast, Slow, n * iBytes);
+
+		// And the float packer itself, with and without transfer ops
+		_gldSpanFillFloats(t, (GLfloat *)Floats, n * 4, GL_FALSE);
+		memset(Fast, 0, sizeof(Fast));
+		memset(Slow, 0, sizeof(Slow));
+		_mesa_pack_float_rgba_span(t->ctx, n, (CONST GLfloat (*)[4])Floats, p->Format, p->Type,
+			Fast, bSwap ? &t->Swapped : &t->Packing, 0);
+		_mesa_pack_float_rgba_span(t->ctx, n, (CONST GLfloat (*)[4])Floats, p->Format, p->Type,
+			Slow, bSwap ? &t->Swapped : &t->Packing, t->uSlowOps);
+		_gldSpanCompare(t, "pack_float_rgba", p, n, Fast, Slow, n * iBytes);
+	}
+}
+
+// ***********************************************************************
+
+static double _gldSpanTime(
+	GLD_spanTest *t,
+	const GLD_spanPair *p,
+	GLboolean bPack,
+	GLuint uOps)
+{
+	// Megapixels per second through a full-length span
+	static GLubyte	Client[GLD_SPAN_MAX * 16];
+	static GLchan	Rgba[GLD_SPAN_MAX][4];
+	clock_t			tStart, tEnd;
+	GLuint			i;
+
+	if (p->Type == GL_FLOAT)
+		_gldSpanFillFloats(t, (GLfloat *)Client, GLD_SPAN_MAX * 4, GL_FALSE);
+	else
+		_gldSpanFillBytes(t, Client, sizeof(Client));
+	_gldSpanFillBytes(t, (GLubyte *)Rgba, sizeof(Rgba));
+
+	tStart = clock();
+	for (i=0; i<GLD_SPAN_REPEATS; i++) {
+		if (bPack)
+			_mesa_pack_rgba_span(t->ctx, GLD_SPAN_MAX, (CONST GLchan (*)[4])Rgba,
+				p->Format, p->Type, Client, &t->Packing, uOps);
+		else
+			_mesa_unpack_chan_color_span(t->ctx, GLD_SPAN_MAX, GL_RGBA, (GLchan *)Rgba,
+				p->Format, p->Type, Client, &t->Packing, uOps);
+	}
+	tEnd = clock();
+	if (tEnd == tStart)
+		tEnd++;
+	return (double)GLD_SPAN_MAX * GLD_SPAN_REPEATS / 1e6 / ((double)(tEnd - tStart) / CLOCKS_PER_SEC);
+}
+
+// ***********************************************************************
+
+int main(
+	int argc,
+	char *argv[])
+{
+	GLD_spanTest	t;
+	GLuint			i;
+
+	// UBYTE_TO_FLOAT() reads the table the first context would build
+	for (i=0; i<256; i++)
+		_mesa_ubyte_to_float_color_tab[i] = (float)i / 255.0F;
+
+	// The fast paths are taken only without transfer ops; an identity
+	// scale and bias forces the general path without changing a value
+	memset(&t, 0, sizeof(t));
+	t.ctx = (GLcontext *)calloc(1, sizeof(GLcontext));
+	t.ctx->Pixel.RedScale	= 1.0F;
+	t.ctx->Pixel.GreenScale	= 1.0F;
+	t.ctx->Pixel.BlueScale	= 1.0F;
+	t.ctx->Pixel.AlphaScale	= 1.0F;
+	t.uSlowOps				= IMAGE_SCALE_BIAS_BIT;
+	t.Packing.Alignment		= 1;
+	t.Swapped				= t.Packing;
+	t.Swapped.SwapBytes		= GL_TRUE;
+	t.uSeed					= 1;
+
+	for (i=0; i<GLD_SPAN_PAIRS; i++)
+		_gldSpanCheckPair(&t, &gldSpanPairs[i]);
+
+	printf("%-16s %10s %10s %10s %10s  (Mpix/s, %u-pixel spans)\n",
+		"", "unpack", "general", "pack", "general", GLD_SPAN_MAX);
+	for (i=0; i<GLD_SPAN_PAIRS; i++) {
+		const GLD_spanPair	*p = &gldSpanPairs[i];
+		printf("%-16s %10.1f %10.1f %10.1f %10.1f\n", p->pszName,
+			_gldSpanTime(&t, p, GL_FALSE, 0), _gldSpanTime(&t, p, GL_FALSE, t.uSlowOps),
+			_gldSpanTime(&t, p, GL_TRUE, 0), _gldSpanTime(&t, p, GL_TRUE, t.uSlowOps));
+	}
+
+	free(t.ctx);
+	printf("%u format/type pairs, %d mismatches\n", (unsigned)GLD_SPAN_PAIRS, t.iFailures);
+	return t.iFailures ? 1 : 0;
+}
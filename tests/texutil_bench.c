@@ -0,0 +1,196 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Linux (headless test build)
+*
+* Description:  Times the texutil.c RGBA8888 upload conversions. Run once as is and once
+*               with MESA_NO_ASM set to compare the SSE2 row kernels with the template
+*               loops; the hashes of the two runs must match.
+*
+*********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "glheader.h"
+#include "mtypes.h"
+#include "texformat.h"
+#include "texutil.h"
+#include "x86/common_x86_asm.h"
+
+// ***********************************************************************
+
+#define GLD_TEX_SIZE			1024	// Timed uploads are about this size
+#define GLD_TEX_REPEATS			16		// Uploads per timing
+#define GLD_TEX_SWEEP			37		// Widths checked, to cover every row tail
+
+// The GL_RGBA/GL_UNSIGNED_BYTE conversions with SSE2 row kernels
+typedef struct {
+	GLint			MesaFormat;
+	GLuint			uBytes;
+	const char		*pszName;
+} GLD_texFormat;
+
+static const GLD_texFormat gldTexFormats[] = {
+	{ MESA_FORMAT_ARGB8888,	4,	"ARGB8888" },
+	{ MESA_FORMAT_RGB565,	2,	"RGB565" },
+	{ MESA_FORMAT_ARGB4444,	2,	"ARGB4444" },
+	{ MESA_FORMAT_ARGB1555,	2,	"ARGB1555" },
+};
+
+#define GLD_TEX_FORMATS			(sizeof(gldTexFormats) / sizeof(gldTexFormats[0]))
+
+// The texutil_tmp.h variants each upload goes through
+typedef enum {
+	GLD_TEX_PLAIN,			// Whole image, no unpacking
+	GLD_TEX_STRIDE,			// Sub-image of a wider image
+	GLD_TEX_UNPACK,			// Source rows longer than the image
+	GLD_TEX_PATHS
+} GLD_texPath;
+
+static const char *gldTexPathNames[GLD_TEX_PATHS] = { "plain", "stride", "unpack" };
+
+static GLubyte	*pSrc;
+static GLubyte	*pDst;
+
+// ***********************************************************************
+
+static GLboolean _gldTexUpload(
+	const GLD_texFormat *f,
+	GLD_texPath Path,
+	GLint iWidth,
+	GLint iHeight)
+{
+	struct gl_pixelstore_attrib	Unpack;
+	GLint						iDstWidth = iWidth;
+	GLint						x = 0, y = 0;
+
+	memset(&Unpack, 0, sizeof(Unpack));
+	Unpack.Alignment = 1;
+	if (Path == GLD_TEX_STRIDE) {
+		iDstWidth = iWidth + 5;
+		x = 3;
+		y = 1;
+	}
+	else if (Path == GLD_TEX_UNPACK) {
+		Unpack.RowLength = iWidth + 7;
+		Unpack.SkipPixels = 2;
+	}
+	return _mesa_convert_texsubimage2d(f->MesaFormat, x, y, iWidth, iHeight, iDstWidth,
+		GL_RGBA, GL_UNSIGNED_BYTE, &Unpack, pSrc, pDst);
+}
+
+// ***********************************************************************
+
+static GLuint _gldTexHash(
+	GLuint uHash,
+	const GLubyte *p,
+	GLuint nBytes)
+{
+	// FNV-1a
+	GLuint	i;
+
+	for (i=0; i<nBytes; i++)
+		uHash = (uHash ^ p[i]) * 16777619;
+	return uHash;
+}
+
+// ***********************************************************************
+
+static GLuint _gldTexSweep(
+	const GLD_texFormat *f,
+	GLD_texPath Path,
+	GLboolean *pbOK)
+{
+	// Hash of every width's output, including the texels around it, so
+	// runs with and without SSE2 can be compared
+	const GLuint	nBytes = (GLD_TEX_SWEEP + 8) * 4 * f->uBytes;
+	GLuint			uHash = 2166136261;
+	GLint			w;
+
+	for (w=1; w<=GLD_TEX_SWEEP; w++) {
+		memset(pDst, 0xA5, nBytes);
+		if (!_gldTexUpload(f, Path, w, 3))
+			*pbOK = GL_FALSE;
+		uHash = _gldTexHash(uHash, pDst, nBytes);
+	}
+	return uHash;
+}
+
+// ***********************************************************************
+
+static double _gldTexTime(
+	const GLD_texFormat *f,
+	GLD_texPath Path)
+{
+	// Megatexels per second
+	const GLint	iWidth = (Path == GLD_TEX_PLAIN) ? GLD_TEX_SIZE : GLD_TEX_SIZE - 24;
+	clock_t		tStart, tEnd;
+	int			i;
+
+	tStart = clock();
+	for (i=0; i<GLD_TEX_REPEATS; i++)
+		_gldTexUpload(f, Path, iWidth, GLD_TEX_SIZE - 8);
+	tEnd = clock();
+	if (tEnd == tStart)
+		tEnd++;
+	return (double)iWidth * (GLD_TEX_SIZE - 8) * GLD_TEX_REPEATS / 1e6 / ((double)(tEnd - tStart) / CLOCKS_PER_SEC);
+}
+
+// ***********************************************************************
+
+int main(
+	int argc,
+	char *argv[])
+{
+	GLboolean	bOK = GL_TRUE;
+	GLuint		i, j;
+
+	pSrc = (GLubyte *)malloc(GLD_TEX_SIZE * GLD_TEX_SIZE * 4);
+	pDst = (GLubyte *)malloc(GLD_TEX_SIZE * GLD_TEX_SIZE * 4);
+	srand(1);
+	for (i=0; i<GLD_TEX_SIZE * GLD_TEX_SIZE * 4; i++)
+		pSrc[i] = (GLubyte)(rand() >> 4);
+
+	// Set MESA_NO_ASM for the C rows the templates call without SSE2
+	printf("SSE2 row kernels %s\n", _mesa_x86_cpu_has_sse2() ? "on" : "off");
+	for (i=0; i<GLD_TEX_FORMATS; i++) {
+		for (j=0; j<GLD_TEX_PATHS; j++) {
+			const GLuint	uHash = _gldTexSweep(&gldTexFormats[i], (GLD_texPath)j, &bOK);
+			printf("%-9s %-7s %9.1f Mtexel/s  hash %08x\n", gldTexFormats[i].pszName,
+				gldTexPathNames[j], _gldTexTime(&gldTexFormats[i], (GLD_texPath)j), uHash);
+		}
+	}
+
+	free(pSrc);
+	free(pDst);
+	if (!bOK)
+		printf("A conversion was refused\n");
+	return bOK ? 0 : 1;
+}
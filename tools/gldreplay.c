@@ -0,0 +1,612 @@
+/*********************************************************************************
+*
+*  ===============================================================================
+*  |                  GLDirect: Direct3D Device Driver for Mesa.                 |
+*  |                                                                             |
+*  |                Copyright (C) 1997-2007 SciTech Software, Inc.               |
+*  |                                                                             |
+*  |Permission is hereby granted, free of charge, to any person obtaining a copy |
+*  |of this software and associated documentation files (the "Software"), to deal|
+*  |in the Software without restriction, including without limitation the rights |
+*  |to use, copy, modify, merge, publish, distribute, sublicense, and/or sell    |
+*  |copies of the Software, and to permit persons to whom the Software is        |
+*  |furnished to do so, subject to the following conditions:                     |
+*  |                                                                             |
+*  |The above copyright notice and this permission notice shall be included in   |
+*  |all copies or substantial portions of the Software.                          |
+*  |                                                                             |
+*  |THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR   |
+*  |IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,     |
+*  |FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE  |
+*  |AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER       |
+*  |LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,|
+*  |OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN    |
+*  |THE SOFTWARE.                                                                |
+*  ===============================================================================
+*
+* Language:     ANSI C
+* Environment:  Windows 9x/2000/XP
+*
+* Description:  Replays a GL call trace written by GLDirect as fast as the
+*               backend allows and reports the time taken.
+*
+*               gldreplay [-gl <opengl32.dll>] [-frames <n>] <trace file>
+*
+*               Functions are looked up by name in the given OpenGL DLL
+*               (the system one by default), so a trace taken with
+*               GLDirect can be timed against any other implementation.
+*
+*********************************************************************************/
+
+#define STRICT
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <GL/gl.h>
+
+#include "glapitable.h"
+
+#define GLD_TRACE_REPLAY
+#include "gld_trace.h"
+
+// ***********************************************************************
+
+#define GLD_REPLAY_INLINE_BYTES	4096		// Inline data of one call
+
+typedef PROC	(WINAPI *GLD_wglGetProcAddress)(LPCSTR);
+typedef HGLRC	(WINAPI *GLD_wglCreateContext)(HDC);
+typedef BOOL	(WINAPI *GLD_wglMakeCurrent)(HDC, HGLRC);
+typedef BOOL	(WINAPI *GLD_wglDeleteContext)(HGLRC);
+typedef int		(WINAPI *GLD_wglChoosePixelFormat)(HDC, CONST PIXELFORMATDESCRIPTOR*);
+typedef BOOL	(WINAPI *GLD_wglSetPixelFormat)(HDC, int, CONST PIXELFORMATDESCRIPTOR*);
+typedef BOOL	(WINAPI *GLD_wglSwapBuffers)(HDC);
+
+typedef struct {
+	const BYTE				*pCur;			// Next op
+	const BYTE				*pEnd;
+	GLboolean				bSkip;			// Current call can't be made
+	GLboolean				bError;			// Stream is corrupt
+	DWORD					dwSlot;			// Current call
+
+	struct _glapi_table		Table;			// Backend entry points
+
+	BYTE					**ppBlobs;		// Indexed by blob id
+	DWORD					nBlobs;
+
+	double					Inline[GLD_REPLAY_INLINE_BYTES / sizeof(double)];
+	DWORD					dwInlineUsed;
+	BYTE					*pOutput;		// Output of the current call
+	DWORD					dwOutputSize;
+	BYTE					*pPersist[GLD_TRACE_OP_FRAME];	// Feedback and select buffers, by slot
+
+	// Statistics
+	DWORD					dwFrames;
+	DWORD					dwCalls;
+	DWORD					dwSkipped;
+	DWORD					dwMissing;		// Entry points the backend lacks
+} GLD_replay;
+
+typedef struct {
+	HMODULE					hGL;
+	HWND					hWnd;
+	HDC						hDC;
+	HGLRC					hRC;
+	GLD_wglGetProcAddress	wglGetProcAddress;
+	GLD_wglCreateContext	wglCreateContext;
+	GLD_wglMakeCurrent		wglMakeCurrent;
+	GLD_wglDeleteContext	wglDeleteContext;
+	GLD_wglChoosePixelFormat wglChoosePixelFormat;
+	GLD_wglSetPixelFormat	wglSetPixelFormat;
+	GLD_wglSwapBuffers		wglSwapBuffers;
+} GLD_replayWindow;
+
+// ***********************************************************************
+// Stream decoding, used by gld_trace_tmp.h
+// ***********************************************************************
+
+#define _GLD_REPLAY_OK(r, f)	(!(r)->bSkip && (r)->Table.f)
+
+static ULONGLONG _gldReplayVarint(
+	GLD_replay *r)
+{
+	ULONGLONG	v = 0;
+	int			s = 0;
+	BYTE		b;
+
+	do {
+		if (r->pCur >= r->pEnd) {
+			r->bError = GL_TRUE;
+			return 0;
+		}
+		b = *r->pCur++;
+		v |= (ULONGLONG)(b & 0x7f) << s;
+		s += 7;
+	} while ((b & 0x80) && (s < 64));
+	return v;
+}
+
+static __inline GLuint _gldReplayU32(
+	GLD_replay *r)
+{
+	return (GLuint)_gldReplayVarint(r);
+}
+
+static __inline GLint _gldReplayS32(
+	GLD_replay *r)
+{
+	GLuint v = (GLuint)_gldReplayVarint(r);
+	return (GLint)(v >> 1) ^ -(GLint)(v & 1);
+}
+
+static __inline __int64 _gldReplayS64(
+	GLD_replay *r)
+{
+	ULONGLONG v = _gldReplayVarint(r);
+	return (__int64)(v >> 1) ^ -(__int64)(v & 1);
+}
+
+static __inline const BYTE *_gldReplayBytes(
+	GLD_replay *r,
+	DWORD dwBytes)
+{
+	const BYTE *p = r->pCur;
+
+	if ((DWORD)(r->pEnd - r->pCur) < dwBytes) {
+		r->bError = GL_TRUE;
+		return NULL;
+	}
+	r->pCur += dwBytes;
+	return p;
+}
+
+static __inline GLfloat _gldReplayF32(
+	GLD_replay *r)
+{
+	GLfloat		v = 0.0f;
+	const BYTE	*p = _gldReplayBytes(r, 4);
+
+	if (p)
+		memcpy(&v, p, 4);
+	return v;
+}
+
+static __inline GLdouble _gldReplayF64(
+	GLD_replay *r)
+{
+	GLdouble	v = 0.0;
+	const BYTE	*p = _gldReplayBytes(r, 8);
+
+	if (p)
+		memcpy(&v, p, 8);
+	return v;
+}
+
+static BYTE *_gldReplayBlob(
+	GLD_replay *r,
+	DWORD dwId)
+{
+	if (!dwId || (dwId >= r->nBlobs) || !r->ppBlobs[dwId]) {
+		r->bSkip = GL_TRUE;
+		return NULL;
+	}
+	return r->ppBlobs[dwId];
+}
+
+static void *_gldReplayPtr(
+	GLD_replay *r)
+{
+	//
+	// Decodes a pointer argument to memory holding what the application
+	// passed, or to somewhere the backend can write to.
+	//
+
+	const BYTE	*pSrc;
+	BYTE		*p;
+	DWORD		dwSize, dwId;
+
+	switch ((DWORD)_gldReplayVarint(r)) {
+	case GLD_TRACE_PTR_NULL:
+		return NULL;
+
+	case GLD_TRACE_PTR_INLINE:
+		dwSize	= (DWORD)_gldReplayVarint(r);
+		pSrc	= _gldReplayBytes(r, dwSize);
+		if (!pSrc || (r->dwInlineUsed + dwSize > GLD_REPLAY_INLINE_BYTES)) {
+			r->bError = GL_TRUE;
+			return NULL;
+		}
+		// Copied so the backend sees aligned data
+		p = (BYTE*)r->Inline + r->dwInlineUsed;
+		memcpy(p, pSrc, dwSize);
+		r->dwInlineUsed += (dwSize + 15) & ~15;
+		return p;
+
+	case GLD_TRACE_PTR_BLOB:
+		return _gldReplayBlob(r, (DWORD)_gldReplayVarint(r));
+
+	case GLD_TRACE_PTR_OFFSET:
+		return (void*)(size_t)_gldReplayVarint(r);
+
+	case GLD_TRACE_PTR_REBASED:
+		dwId	= (DWORD)_gldReplayVarint(r);
+		dwSize	= (DWORD)_gldReplayVarint(r);
+		p		= _gldReplayBlob(r, dwId);
+		return p ? p - dwSize : NULL;
+
+	case GLD_TRACE_PTR_OUTPUT:
+		dwSize = (DWORD)_gldReplayVarint(r);
+		if (dwSize > r->dwOutputSize) {
+			free(r->pOutput);
+			r->pOutput		= (BYTE*)malloc(dwSize);
+			r->dwOutputSize	= r->pOutput ? dwSize : 0;
+			if (!r->pOutput)
+				r->bSkip = GL_TRUE;
+		}
+		return r->pOutput;
+
+	case GLD_TRACE_PTR_UNSIZED:
+		r->bSkip = GL_TRUE;
+		return NULL;
+
+	case GLD_TRACE_PTR_PERSIST:
+		// The GL keeps writing here after the call; a new call replaces it
+		dwSize = (DWORD)_gldReplayVarint(r);
+		free(r->pPersist[r->dwSlot]);
+		r->pPersist[r->dwSlot] = (BYTE*)calloc(1, dwSize ? dwSize : 1);
+		if (!r->pPersist[r->dwSlot])
+			r->bSkip = GL_TRUE;
+		return r->pPersist[r->dwSlot];
+	}
+
+	r->bError = GL_TRUE;
+	return NULL;
+}
+
+#include "gld_trace_tmp.h"
+
+// ***********************************************************************
+
+static void _gldReplayFreeBlobs(
+	GLD_replay *r)
+{
+	DWORD i;
+
+	for (i=0; i<r->nBlobs; i++)
+		free(r->ppBlobs[i]);
+	free(r->ppBlobs);
+	r->ppBlobs	= NULL;
+	r->nBlobs	= 0;
+}
+
+static void _gldReplayDefineBlob(
+	GLD_replay *r)
+{
+	DWORD		dwId	= (DWORD)_gldReplayVarint(r);
+	DWORD		dwSize	= (DWORD)_gldReplayVarint(r);
+	const BYTE	*pSrc	= _gldReplayBytes(r, dwSize);
+	BYTE		**ppNew;
+	DWORD		n;
+
+	if (!pSrc || !dwId)
+		return;
+	if (dwId >= r->nBlobs) {
+		n = max(dwId + 1, r->nBlobs * 2);
+		ppNew = (BYTE**)realloc(r->ppBlobs, n * sizeof(BYTE*));
+		if (!ppNew) {
+			r->bError = GL_TRUE;
+			return;
+		}
+		memset(ppNew + r->nBlobs, 0, (n - r->nBlobs) * sizeof(BYTE*));
+		r->ppBlobs	= ppNew;
+		r->nBlobs	= n;
+	}
+	free(r->ppBlobs[dwId]);
+	r->ppBlobs[dwId] = (BYTE*)malloc(dwSize ? dwSize : 1);
+	if (r->ppBlobs[dwId])
+		memcpy(r->ppBlobs[dwId], pSrc, dwSize);
+}
+
+// ***********************************************************************
+
+static BYTE *_gldReplayLoad(
+	const char *szFile,
+	DWORD *pdwSize)
+{
+	//
+	// Reads a trace and joins the payloads of its blocks into one op
+	// stream, stopping at the first block that is cut short or fails its
+	// checksum.
+	//
+
+	FILE	*fp;
+	BYTE	*pFile;
+	long	lSize;
+	DWORD	dwIn, dwOut, dwHeader[3];
+	DWORD	dwVersion, dwSlots;
+
+	fp = fopen(szFile, "rb");
+	if (!fp) {
+		printf("Unable to open %s\n", szFile);
+		return NULL;
+	}
+	fseek(fp, 0, SEEK_END);
+	lSize = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	pFile = (BYTE*)malloc(lSize > 0 ? lSize : 1);
+	if (!pFile || (lSize < GLD_TRACE_HEADER_SIZE) || (fread(pFile, lSize, 1, fp) != 1)) {
+		printf("Unable to read %s\n", szFile);
+		fclose(fp);
+		free(pFile);
+		return NULL;
+	}
+	fclose(fp);
+
+	memcpy(&dwVersion, pFile + 8, 4);
+	memcpy(&dwSlots, pFile + 12, 4);
+	if (memcmp(pFile, GLD_TRACE_MAGIC, 8) || (dwVersion != GLD_TRACE_VERSION) || (dwSlots != GLD_TRACE_SLOTS)) {
+		printf("%s is not a trace this replayer understands\n", szFile);
+		free(pFile);
+		return NULL;
+	}
+
+	for (dwIn=GLD_TRACE_HEADER_SIZE, dwOut=0; dwIn + GLD_TRACE_BLOCK_HEADER <= (DWORD)lSize; ) {
+		memcpy(dwHeader, pFile + dwIn, GLD_TRACE_BLOCK_HEADER);
+		if ((dwHeader[0] != GLD_TRACE_BLOCK_MAGIC) ||
+			(dwHeader[1] > (DWORD)lSize - dwIn - GLD_TRACE_BLOCK_HEADER) ||
+			(dwHeader[2] != (DWORD)gldTraceHash(pFile + dwIn + GLD_TRACE_BLOCK_HEADER, dwHeader[1])))
+		{
+			printf("Trace is damaged at byte %u; replaying what comes before\n", dwIn);
+			break;
+		}
+		memmove(pFile + dwOut, pFile + dwIn + GLD_TRACE_BLOCK_HEADER, dwHeader[1]);
+		dwIn	+= GLD_TRACE_BLOCK_HEADER + dwHeader[1];
+		dwOut	+= dwHeader[1];
+	}
+
+	*pdwSize = dwOut;
+	return pFile;
+}
+
+// ***********************************************************************
+
+static void _gldReplayResize(
+	GLD_replayWindow *w,
+	DWORD dwWidth,
+	DWORD dwHeight)
+{
+	RECT rc;
+
+	SetRect(&rc, 0, 0, dwWidth, dwHeight);
+	AdjustWindowRect(&rc, WS_OVERLAPPEDWINDOW, FALSE);
+	SetWindowPos(w->hWnd, NULL, 0, 0, rc.right - rc.left, rc.bottom - rc.top, SWP_NOMOVE | SWP_NOZORDER);
+}
+
+static BOOL _gldReplayCreateWindow(
+	GLD_replayWindow *w,
+	const char *szDLL)
+{
+	PIXELFORMATDESCRIPTOR	pfd;
+	WNDCLASS				wc;
+	int						iPF;
+
+	w->hGL = LoadLibrary(szDLL);
+	if (!w->hGL) {
+		printf("Unable to load %s\n", szDLL);
+		return FALSE;
+	}
+	w->wglGetProcAddress	= (GLD_wglGetProcAddress)GetProcAddress(w->hGL, "wglGetProcAddress");
+	w->wglCreateContext		= (GLD_wglCreateContext)GetProcAddress(w->hGL, "wglCreateContext");
+	w->wglMakeCurrent		= (GLD_wglMakeCurrent)GetProcAddress(w->hGL, "wglMakeCurrent");
+	w->wglDeleteContext		= (GLD_wglDeleteContext)GetProcAddress(w->hGL, "wglDeleteContext");
+	w->wglChoosePixelFormat	= (GLD_wglChoosePixelFormat)GetProcAddress(w->hGL, "wglChoosePixelFormat");
+	w->wglSetPixelFormat	= (GLD_wglSetPixelFormat)GetProcAddress(w->hGL, "wglSetPixelFormat");
+	w->wglSwapBuffers		= (GLD_wglSwapBuffers)GetProcAddress(w->hGL, "wglSwapBuffers");
+	if (!w->wglGetProcAddress || !w->wglCreateContext || !w->wglMakeCurrent || !w->wglDeleteContext ||
+		!w->wglChoosePixelFormat || !w->wglSetPixelFormat || !w->wglSwapBuffers)
+	{
+		printf("%s does not export the wgl functions\n", szDLL);
+		return FALSE;
+	}
+
+	memset(&wc, 0, sizeof(wc));
+	wc.style			= CS_OWNDC;
+	wc.lpfnWndProc		= DefWindowProc;
+	wc.hInstance		= GetModuleHandle(NULL);
+	wc.hCursor			= LoadCursor(NULL, IDC_ARROW);
+	wc.lpszClassName	= "gldreplay";
+	RegisterClass(&wc);
+	w->hWnd = CreateWindow("gldreplay", "gldreplay", WS_OVERLAPPEDWINDOW | WS_VISIBLE,
+		CW_USEDEFAULT, CW_USEDEFAULT, 640, 480, NULL, NULL, wc.hInstance, NULL);
+	if (!w->hWnd)
+		return FALSE;
+	w->hDC = GetDC(w->hWnd);
+
+	memset(&pfd, 0, sizeof(pfd));
+	pfd.nSize		= sizeof(pfd);
+	pfd.nVersion	= 1;
+	pfd.dwFlags		= PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER;
+	pfd.iPixelType	= PFD_TYPE_RGBA;
+	pfd.cColorBits	= 32;
+	pfd.cDepthBits	= 24;
+	pfd.cStencilBits= 8;
+	iPF = w->wglChoosePixelFormat(w->hDC, &pfd);
+	if (!iPF || !w->wglSetPixelFormat(w->hDC, iPF, &pfd)) {
+		printf("No suitable pixel format\n");
+		return FALSE;
+	}
+	w->hRC = w->wglCreateContext(w->hDC);
+	if (!w->hRC || !w->wglMakeCurrent(w->hDC, w->hRC)) {
+		printf("Unable to create a GL context\n");
+		return FALSE;
+	}
+	return TRUE;
+}
+
+static void _gldReplayDestroyWindow(
+	GLD_replayWindow *w)
+{
+	if (w->hRC) {
+		w->wglMakeCurrent(NULL, NULL);
+		w->wglDeleteContext(w->hRC);
+	}
+	if (w->hDC)
+		ReleaseDC(w->hWnd, w->hDC);
+	if (w->hWnd)
+		DestroyWindow(w->hWnd);
+	if (w->hGL)
+		FreeLibrary(w->hGL);
+}
+
+static void _gldReplayResolve(
+	GLD_replay *r,
+	GLD_replayWindow *w)
+{
+	// Core entry points are exported; extensions come from the context
+	void	**ppTable = (void**)&r->Table;
+	DWORD	i;
+
+	for (i=0; i<GLD_TRACE_SLOTS; i++) {
+		ppTable[i] = (void*)GetProcAddress(w->hGL, _gldTraceNames[i]);
+		if (!ppTable[i])
+			ppTable[i] = (void*)w->wglGetProcAddress(_gldTraceNames[i]);
+	}
+}
+
+// ***********************************************************************
+
+static BOOL _gldReplayRun(
+	GLD_replay *r,
+	GLD_replayWindow *w,
+	DWORD dwMaxFrames)
+{
+	//
+	// Issues every op in the stream. Returns FALSE if it stopped early
+	// on a corrupt op.
+	//
+
+	MSG		msg;
+	DWORD	dwOp, dwWidth, dwHeight;
+
+	while ((r->pCur < r->pEnd) && !r->bError) {
+		dwOp = (DWORD)_gldReplayVarint(r);
+
+		if (dwOp < GLD_TRACE_SLOTS) {
+			r->dwSlot		= dwOp;
+			r->bSkip		= GL_FALSE;
+			r->dwInlineUsed	= 0;
+			_gldReplayFuncs[dwOp](r);
+			r->dwCalls++;
+			if (r->bSkip) {
+				r->dwSkipped++;
+				if (!((void**)&r->Table)[dwOp])
+					r->dwMissing++;
+			}
+			continue;
+		}
+
+		switch (dwOp) {
+		case GLD_TRACE_OP_FRAME:
+			if (w)
+				w->wglSwapBuffers(w->hDC);
+			r->dwFrames++;
+			if (w) {
+				while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+					DispatchMessage(&msg);
+			}
+			if (dwMaxFrames && (r->dwFrames == dwMaxFrames))
+				return TRUE;
+			break;
+		case GLD_TRACE_OP_RESIZE:
+			dwWidth		= (DWORD)_gldReplayVarint(r);
+			dwHeight	= (DWORD)_gldReplayVarint(r);
+			if (w)
+				_gldReplayResize(w, dwWidth, dwHeight);
+			break;
+		case GLD_TRACE_OP_BLOB:
+			_gldReplayDefineBlob(r);
+			break;
+		case GLD_TRACE_OP_BLOB_RESET:
+			_gldReplayFreeBlobs(r);
+			break;
+		case GLD_TRACE_OP_END:
+			return TRUE;
+		default:
+			r->bError = GL_TRUE;
+			break;
+		}
+	}
+	return !r->bError;
+}
+
+// ***********************************************************************
+
+int main(
+	int argc,
+	char *argv[])
+{
+	static GLD_replay	r;
+	GLD_replayWindow	w;
+	const char			*szDLL		= "opengl32.dll";
+	const char			*szTrace	= NULL;
+	DWORD				dwMaxFrames	= 0;
+	DWORD				dwSize;
+	BYTE				*pStream;
+	LARGE_INTEGER		qwFreq, qwStart, qwEnd;
+	double				fSeconds;
+	BOOL				bOK;
+	int					i;
+
+	for (i=1; i<argc; i++) {
+		if (!strcmp(argv[i], "-gl") && (i + 1 < argc))
+			szDLL = argv[++i];
+		else if (!strcmp(argv[i], "-frames") && (i + 1 < argc))
+			dwMaxFrames = atoi(argv[++i]);
+		else
+			szTrace = argv[i];
+	}
+	if (!szTrace) {
+		printf("Usage: gldreplay [-gl <opengl32.dll>] [-frames <n>] <trace file>\n");
+		return 1;
+	}
+
+	pStream = _gldReplayLoad(szTrace, &dwSize);
+	if (!pStream)
+		return 1;
+
+	memset(&w, 0, sizeof(w));
+	if (!_gldReplayCreateWindow(&w, szDLL)) {
+		_gldReplayDestroyWindow(&w);
+		free(pStream);
+		return 1;
+	}
+	_gldReplayResolve(&r, &w);
+	r.pCur	= pStream;
+	r.pEnd	= pStream + dwSize;
+
+	QueryPerformanceFrequency(&qwFreq);
+	QueryPerformanceCounter(&qwStart);
+	bOK = _gldReplayRun(&r, &w, dwMaxFrames);
+	if (r.Table.Finish)
+		r.Table.Finish();
+	QueryPerformanceCounter(&qwEnd);
+	fSeconds = (double)(qwEnd.QuadPart - qwStart.QuadPart) / (double)qwFreq.QuadPart;
+
+	if (!bOK)
+		printf("Trace is corrupt at byte %u; stopped there\n", (DWORD)(r.pCur - pStream));
+	printf("%s on %s\n", szTrace, szDLL);
+	printf("  %u frames, %u calls (%u skipped, %u missing from the backend)\n",
+		r.dwFrames, r.dwCalls, r.dwSkipped, r.dwMissing);
+	printf("  %.3f s, %.3f ms/frame, %.1f fps, %.2f Mcalls/s\n",
+		fSeconds,
+		r.dwFrames ? 1000.0 * fSeconds / r.dwFrames : 0.0,
+		fSeconds > 0.0 ? r.dwFrames / fSeconds : 0.0,
+		fSeconds > 0.0 ? r.dwCalls / fSeconds / 1000000.0 : 0.0);
+
+	_gldReplayFreeBlobs(&r);
+	_gldReplayDestroyWindow(&w);
+	free(pStream);
+	return bOK ? 0 : 1;
+}
+
+// ***********************************************************************